@@ -11,6 +11,11 @@
  ** @{ */
 
 /** \brief driver que maneja la lectura de datos obtenida a partir de un acelerómetro.
+ **
+ ** En modo continuo los tres ejes se muestrean con el barrido multicanal del ADC
+ ** (CH1, CH2 y CH3), a una frecuencia configurable y con muestras equiespaciadas,
+ ** y se leen por bloques ya convertidos a unidades de gravedad (por ejemplo para
+ ** analizar vibraciones con la FFT).
  **
  **/
 
@@ -23,6 +28,7 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261014 v0.0.2 modo continuo de los tres ejes y lectura por bloques en g
  * 20210609 v0.0.1 initials initial version
  */
 
@@ -35,6 +41,12 @@
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/** @brief Ejes del acelerómetro */
+typedef enum {
+	ADXL335_X = 0,		/*!< Eje x (CH1) */
+	ADXL335_Y,			/*!< Eje y (CH2) */
+	ADXL335_Z,			/*!< Eje z (CH3) */
+} adxl335_axis_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -73,6 +85,43 @@ int ReadXValueInt();
 int ReadYValueInt();
 int ReadZValueInt();
 
+/** @fn bool ADXL335InitContinuous(uint32_t sample_frec, uint16_t frame_size, void *func_p, void *param_p)
+ * @brief Función que inicializa los tres ejes en modo continuo (barrido de CH1, CH2 y CH3)
+ * @note No puede usarse junto con las lecturas simples (ReadXValue, etc.). Se construyen
+ * las tablas de calibración del ADC de los tres canales.
+ * @param[in] sample_frec Frecuencia de muestreo por eje (en Hz)
+ * @param[in] frame_size Muestras por eje de cada bloque (máximo ADC_CONT_MAX_FRAME_SIZE, 0: ADC_CONT_DEFAULT_FRAME)
+ * @param[in] func_p Función llamada (desde la ISR) con cada bloque convertido (puede ser NULL)
+ * @param[in] param_p Parámetro de func_p
+ * @return 1 (true) si las tablas de calibración están disponibles
+ */
+bool ADXL335InitContinuous(uint32_t sample_frec, uint16_t frame_size, void *func_p, void *param_p);
+/** @fn void ADXL335StartContinuous(void)
+ * @brief Función que inicia el muestreo continuo de los tres ejes
+ */
+void ADXL335StartContinuous(void);
+/** @fn void ADXL335StopContinuous(void)
+ * @brief Función que detiene el muestreo continuo
+ */
+void ADXL335StopContinuous(void);
+/** @fn uint16_t ADXL335ReadBlock(float *x, float *y, float *z, uint64_t *timestamp)
+ * @brief Función que lee el bloque más antiguo del modo continuo en unidades de gravedad
+ * @note No bloqueante: pensada para llamarse luego de la función de func_p.
+ * @param[out] x Aceleración en el eje x (arreglo de frame_size muestras, puede ser NULL)
+ * @param[out] y Aceleración en el eje y (arreglo de frame_size muestras, puede ser NULL)
+ * @param[out] z Aceleración en el eje z (arreglo de frame_size muestras, puede ser NULL)
+ * @param[out] timestamp Tiempo de adquisición de la primera muestra en us (puede ser NULL)
+ * @return Cantidad de muestras por eje (0 si no hay bloques disponibles)
+ */
+uint16_t ADXL335ReadBlock(float *x, float *y, float *z, uint64_t *timestamp);
+/** @fn void ADXL335SetCalibration(adxl335_axis_t axis, float zero_g, float sensitivity)
+ * @brief Función que ajusta la calibración de un eje (por defecto 1650 mV y 300 mV/g)
+ * @param[in] axis Eje
+ * @param[in] zero_g Tensión a 0 g (en mV)
+ * @param[in] sensitivity Sensibilidad (en mV/g)
+ */
+void ADXL335SetCalibration(adxl335_axis_t axis, float zero_g, float sensitivity);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
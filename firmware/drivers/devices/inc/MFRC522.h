@@ -25,15 +25,23 @@
 #include <string.h> //some functions need NULL to be defined
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 /*******************************************************************************
  * Types/enumerations/variables
  ******************************************************************************/
-// send only one byte per transfer, see WriteRegister functions
-#define BUFFER_SIZE  1 
+// address + whole FIFO in one transfer, see WriteRegister functions
+#define BUFFER_SIZE  65 
 // Defined as 4MHz in the original library
 #define MFRC522_BIT_RATE 4000000 
 // Used for ADT object allocation
 #define MFRC_MAX_INSTANCES 2	 
+// Max wait for the IRQ pin in PCD_CommunicateWithPICC (the PCD timer ends at 25 ms)
+#define MFRC_IRQ_TIMEOUT_MS 40
+// Time the antenna field is on before REQA in the scan (PICC power up)
+#define MFRC_FIELD_ON_MS 5
+#define MFRC_SCAN_TASK_STACK CONFIG_DRIVERS_MFRC522_SCAN_TASK_STACK
+#define MFRC_SCAN_TASK_PRIO 4
 
 static const uint8_t FIFO_SIZE = 64; // Size of the MFRC522 FIFO
 
@@ -294,6 +302,11 @@ struct MFRC522_T {
 		_chipSelectPin; // = {1, 8}; // As default example use GPIO1[8]= P1_5
 	gpio_t
 		_resetPowerDownPin; // = {3, 4}; //As default example use GPIO3[4]= P6_5
+	bool _hardwareCS; // CS driven by the SPI peripheral (set by PCD_Init)
+	bool _irqMode; // Wait the IRQ pin instead of polling ComIrqReg (PCD_EnableIrq)
+	gpio_t _irqPin;
+	SemaphoreHandle_t _irqSem; // Given by the IRQ pin interruption
+	StaticSemaphore_t _irqSemBuffer;
 	uint8_t Tx_Buf[BUFFER_SIZE];
 	uint8_t Rx_Buf[BUFFER_SIZE];
 };
@@ -301,6 +314,9 @@ struct MFRC522_T {
 // Pointer to a MFRC5222 ADT object
 typedef struct MFRC522_T *MFRC522Ptr_t;
 
+// Called by the scan task with the reader that read a new card (mfrc->uid)
+typedef void (*MFRC522_CardCallback_t)(MFRC522Ptr_t mfrc, void *param);
+
 /**
  * Function to setup a MFRC522 ADT object
  * @return an initialized  ADT object
@@ -331,6 +347,14 @@ void PCD_AntennaOn(MFRC522Ptr_t mfrc);
 void PCD_AntennaOff(MFRC522Ptr_t mfrc);
 uint8_t PCD_GetAntennaGain(MFRC522Ptr_t mfrc);
 void PCD_SetAntennaGain(MFRC522Ptr_t mfrc, uint8_t mask);
+/**
+ * Uses the IRQ pin of the MFRC522: PCD_CommunicateWithPICC enables the
+ * completion and timer interrupts and blocks until the pin goes low, instead
+ * of reading ComIrqReg in a loop. Call after PCD_Init.
+ * @param irqPin GPIO connected to the IRQ pin
+ * @return true if the IRQ mode is enabled
+ */
+bool PCD_EnableIrq(MFRC522Ptr_t mfrc, gpio_t irqPin);
 
 /*******************************************************************************
 * Functions for communicating with PICCs
@@ -408,4 +432,26 @@ bool MIFARE_UnbrickUidSector(MFRC522Ptr_t mfrc, bool logErrors);
 bool PICC_IsNewCardPresent(MFRC522Ptr_t mfrc);
 bool PICC_ReadCardSerial(MFRC522Ptr_t mfrc);
 
+/*******************************************************************************
+* Scan scheduler
+*******************************************************************************/
+/**
+ * Starts a task that scans the readers in turn every period: for each one the
+ * antenna is turned on, a new card is requested and, if one answers, its UID is
+ * read, the callback is called and the card is halted. The antenna is off the
+ * rest of the period and only one reader uses the SPI bus at a time.
+ * @param readers Readers initialized with PCD_Init (and PCD_EnableIrq)
+ * @param count Number of readers (up to MFRC_MAX_INSTANCES)
+ * @param period_ms Scan period in ms
+ * @param func_p Callback for each card read
+ * @param param Callback parameter
+ * @return true if the scan started
+ */
+bool MFRC522_StartScan(MFRC522Ptr_t *readers, uint8_t count, uint16_t period_ms,
+					   MFRC522_CardCallback_t func_p, void *param);
+/**
+ * Stops the scan task, after the current period.
+ */
+void MFRC522_StopScan(void);
+
 #endif
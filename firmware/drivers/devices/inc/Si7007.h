@@ -11,6 +11,14 @@
  **
  ** This is a driver for Si7007
  **
+ ** @note Si7007Init reads the sensor outputs with a single ADC conversion on
+ ** every measurement. Si7007InitContinuous samples both outputs with the ADC
+ ** in continuous mode (oversampled) and a timer averages the frames and low
+ ** pass filters them: Si7007MeasureTemperature/Humidity then return the last
+ ** filtered value without waiting for a conversion (safe from any task).
+ ** Continuous mode uses the ADC unit: other ADC_SINGLE inputs can not be used
+ ** at the same time.
+ **
  **/
 
 /*
@@ -23,11 +31,13 @@
  * modification history (new versions first)
  * -----------------------------------------------------------
  * 20211006 v0.1 initials initial version Maria Casablanca
+ * 20261014 v1.2 continuous mode with filtered cached values
  */
 
 /*==================[inclusions]=============================================*/
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "gpio_mcu.h"
 #include "analog_io_mcu.h"
 
@@ -53,15 +63,30 @@ typedef struct {				/*!< Si7007 Inputs config struct*/
  */
 bool Si7007Init(Si7007_config *pins);
 
+/** @fn bool Si7007InitContinuous(Si7007_config *pins, uint16_t filter_ms);
+ * @brief Initialization of Si7007 in continuous mode (non blocking measurements).
+ * @param[in] *pins
+ * @param[in] filter_ms Time constant of the low pass filter of the measurements (ms)
+ * @return TRUE if no error.
+ */
+bool Si7007InitContinuous(Si7007_config *pins, uint16_t filter_ms);
+
+/** @fn bool Si7007Ready(void)
+ * @brief Checks if the first filtered values are available (continuous mode)
+ * @param[in] No Parameter
+ * @return TRUE if the measurements are valid.
+ */
+bool Si7007Ready(void);
+
 /** @fn uint16_t Si7007MeasureTemperature(void)
- * @brief Measures the current temperature
+ * @brief Measures the current temperature (last filtered value in continuous mode)
  * @param[in] No Parameter
  * @return value of temperature in °C
  */
 float Si7007MeasureTemperature(void);
 
 /** @fn uint16_t Si7007MeasureHumidity(void)
- * @brief Measures the current relative humidity
+ * @brief Measures the current relative humidity (last filtered value in continuous mode)
  * @param[in] No Parameter
  * @return value of relative humidity in %
  */
@@ -0,0 +1,187 @@
+#ifndef ANALOG_MUX_H
+#define ANALOG_MUX_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Analog_Mux Analog multiplexer
+ ** @{ */
+
+/** \brief Scan engine for an analog multiplexer (CD4051, 74HC4067) in front of an analog input.
+ *
+ * The select lines of the mux are a bundle of fast outputs (gpio_fast_out_mcu.h),
+ * so the channel is changed with a single CPU instruction. A timer paces the
+ * scans (one per sample period): on each alarm a driver task converts every
+ * channel of the mux with the analog input in single mode and stores the samples
+ * in blocks with the layout of the continuous internal ADC (analog_block_t),
+ * one row per mux channel (pad).
+ *
+ * The scan is pipelined: the select lines of the next channel are written right
+ * after the conversion of the current one, so the mux settles while the sample
+ * is stored and the loop goes on. Before converting, only the part of the
+ * settling time not elapsed yet is waited. The last conversion of a scan
+ * selects the first channel, which settles between scans.
+ *
+ * @code
+ * static analog_mux_t mux;
+ * analog_mux_config_t config = {
+ *     .input = CH0, .select = {GPIO_0, GPIO_1, GPIO_2}, .select_lines = 3,
+ *     .settle_us = 5, .sample_frec = 2000, .frame_size = 32
+ * };
+ * AnalogMuxInit(&mux, &config);
+ * AnalogMuxStart(&mux);
+ * ...
+ * analog_mux_block_t *block = AnalogMuxGetBlock(&mux);
+ * if(block != NULL){
+ *     AnalogMuxBlockToFloat(&mux, block, 5, pad_mv);
+ *     AnalogMuxReleaseBlock(&mux, block);
+ * }
+ * @endcode
+ *
+ * @note The settling time depends on the source impedance of the pads and the
+ * ADC sampling capacitor (i.e. a few us for buffered piezo signals). Scans that
+ * start while the previous one is running, or when every block is in use, are
+ * lost and counted as overruns.
+ *
+ * @note The analog input is used in single mode: it can't be scanned in continuous
+ * mode at the same time.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gpio_mcu.h"
+#include "analog_io_mcu.h"
+#include "timer_mcu.h"
+/*==================[macros]=================================================*/
+#define ANALOG_MUX_MAX_LINES		4		/*!< Max select lines (74HC4067: 16 channels) */
+#define ANALOG_MUX_MAX_CH			(1 << ANALOG_MUX_MAX_LINES)	/*!< Max channels of the mux */
+#define ANALOG_MUX_MAX_FRAME_SIZE	32		/*!< Max samples per channel of a block */
+#define ANALOG_MUX_BLOCK_RING_SIZE	4		/*!< Blocks of each mux */
+#define ANALOG_MUX_TASK_STACK		2048	/*!< Stack of the scan task */
+#define ANALOG_MUX_TASK_PRIORITY	(configMAX_PRIORITIES - 2)	/*!< Priority of the scan task */
+/*==================[typedef]================================================*/
+/**
+ * @brief Analog mux config structure
+ */
+typedef struct {
+	adc_ch_t input;							/*!< Analog input connected to the mux output */
+	gpio_t select[ANALOG_MUX_MAX_LINES];	/*!< Select lines (first: least significant bit) */
+	uint8_t select_lines;					/*!< Number of select lines (channels: 2 ^ select_lines) */
+	uint16_t settle_us;						/*!< Settling time after changing the channel (in us) */
+	uint32_t sample_frec;					/*!< Sample frequency per channel (in Hz) */
+	uint16_t frame_size;					/*!< Samples per channel of each block, max ANALOG_MUX_MAX_FRAME_SIZE */
+	void *func_p;							/*!< Pointer to callback function called (from the scan task) on every block (can be NULL) */
+	void *param_p;							/*!< Pointer to callback function parameters */
+} analog_mux_config_t;
+
+/**
+ * @brief Block of samples, one row per mux channel (same layout as analog_block_t)
+ */
+typedef struct {
+	uint16_t data[ANALOG_MUX_MAX_CH][ANALOG_MUX_MAX_FRAME_SIZE];	/*!< Raw samples (12 bits) of each channel */
+	uint16_t lenght[ANALOG_MUX_MAX_CH];							/*!< Number of valid samples of each channel */
+	uint16_t channels;											/*!< Bit mask of the channels present in the block */
+	uint32_t sample_frec;										/*!< Sample frequency per channel (in Hz) */
+	uint64_t timestamp;											/*!< Acquisition time of the first sample (in us since boot) */
+} analog_mux_block_t;
+
+/**
+ * @brief Analog mux instance (driver data, don't modify)
+ */
+typedef struct {
+	analog_mux_config_t config;								/*!< Configuration */
+	int8_t bundle;											/*!< Fast outputs bundle of the select lines */
+	uint8_t channels;										/*!< Channels of the mux */
+	analog_mux_block_t blocks[ANALOG_MUX_BLOCK_RING_SIZE];	/*!< Blocks ring */
+	volatile uint32_t written;								/*!< Blocks completed by the scan task */
+	volatile uint32_t taken;								/*!< Blocks taken with AnalogMuxGetBlock */
+	volatile uint32_t released;								/*!< Blocks released */
+	uint16_t index;											/*!< Samples per channel of the block being filled */
+	uint64_t select_time;									/*!< Time the current channel was selected (us) */
+	volatile bool running;									/*!< Scanning (cleared by AnalogMuxStop) */
+	uint32_t overruns;										/*!< Scans lost */
+	timer_handle_t timer;									/*!< Scan timer */
+	TaskHandle_t task;										/*!< Scan task */
+} analog_mux_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Analog mux initialization (stopped, first channel selected)
+ *
+ * @param mux Analog mux instance (must remain valid, i.e. static)
+ * @param config Analog mux config structure
+ * @return true     Mux initialized
+ * @return false    Invalid configuration, no free fast outputs or timer, or task not created
+ */
+bool AnalogMuxInit(analog_mux_t *mux, const analog_mux_config_t *config);
+
+/**
+ * @brief Start scanning the channels
+ *
+ * @param mux Analog mux instance
+ */
+void AnalogMuxStart(analog_mux_t *mux);
+
+/**
+ * @brief Stop scanning the channels (the block being filled is discarded)
+ *
+ * @param mux Analog mux instance
+ */
+void AnalogMuxStop(analog_mux_t *mux);
+
+/**
+ * @brief Get the next block of samples
+ *
+ * @note Non blocking. Blocks must be released with AnalogMuxReleaseBlock() in the
+ * same order they were obtained.
+ *
+ * @param mux Analog mux instance
+ * @return Pointer to the block, or NULL if there is no block completed
+ */
+analog_mux_block_t* AnalogMuxGetBlock(analog_mux_t *mux);
+
+/**
+ * @brief Give back a block obtained with AnalogMuxGetBlock()
+ *
+ * @param mux Analog mux instance
+ * @param block Block to release
+ */
+void AnalogMuxReleaseBlock(analog_mux_t *mux, analog_mux_block_t *block);
+
+/**
+ * @brief Convert the samples of one channel of a block to float values (in mV)
+ *
+ * @param mux Analog mux instance
+ * @param block Block of samples
+ * @param channel Mux channel selected
+ * @param values Array to store converted values (of lenght = block->lenght[channel])
+ */
+void AnalogMuxBlockToFloat(const analog_mux_t *mux, const analog_mux_block_t *block, uint8_t channel, float *values);
+
+/**
+ * @brief Scans lost (previous scan still running or all blocks in use)
+ *
+ * @param mux Analog mux instance
+ * @return Overruns since AnalogMuxInit()
+ */
+uint32_t AnalogMuxGetOverruns(const analog_mux_t *mux);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ANALOG_MUX_H */
+
+/*==================[end of file]============================================*/
@@ -7,8 +7,12 @@
 /** \addtogroup BUZZER Buzzer
  ** @{ */
 
-/** @brief 
+/** @brief Buzzer driver (PWM tones).
  *
+ * @note Melodies play in the background: BuzzerCompileRtttl converts a RTTTL
+ * string into an array of notes (frequency and duration) once, and
+ * BuzzerPlayNotes plays the array from a timer, changing the PWM frequency at
+ * the end of each note. No task is blocked while the melody plays.
  *
  * @author Albano Peñalva
  * 
@@ -17,13 +21,16 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 08/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Background note sequencer and RTTTL compiler   |
  *
  */
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
+#define BUZZER_MAX_NOTES	128		/*!< Notes of the melodies played by BuzzerPlayRtttl */
 /* Note frequency (in Hz) */
 #define NOTE_B0  31
 #define NOTE_C1  33
@@ -115,6 +122,13 @@
 #define NOTE_D8  4699
 #define NOTE_DS8 4978
 /*==================[typedef]================================================*/
+/**
+ * @brief Note of a compiled melody
+ */
+typedef struct {
+	uint16_t freq;			/*!< Tone frequency (in Hz, 0: silence) */
+	uint16_t duration;		/*!< Note duration (in ms) */
+} buzzer_note_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -157,10 +171,44 @@ void BuzzerPlayTone(uint16_t freq, uint16_t duration);
 /**
  * @brief Plays a melody stored in format RTTTL (Ring Tone Text Transfer Language).
  * 
+ * @note The melody is compiled (up to BUZZER_MAX_NOTES notes) and played in
+ * the background, the function returns immediately.
+ * 
  * @param rtttl_melody String containing text with a RTTTL melody.
  */
 void BuzzerPlayRtttl(const char * rtttl_melody);
 
+/**
+ * @brief Converts a RTTTL melody into an array of notes.
+ * 
+ * @param rtttl_melody String containing text with a RTTTL melody.
+ * @param notes Array to store the notes.
+ * @param max_notes Lenght of notes array (extra notes are ignored).
+ * @return Number of notes stored.
+ */
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t * notes, uint16_t max_notes);
+
+/**
+ * @brief Plays an array of notes in the background (stops the current melody).
+ * 
+ * @param notes Notes (the array must remain valid until the melody ends).
+ * @param lenght Lenght of notes array.
+ */
+void BuzzerPlayNotes(const buzzer_note_t * notes, uint16_t lenght);
+
+/**
+ * @brief Stops the melody being played.
+ */
+void BuzzerStop(void);
+
+/**
+ * @brief Checks if a melody is being played.
+ * 
+ * @return true Playing
+ * @return false Melody ended (or stopped)
+ */
+bool BuzzerIsPlaying(void);
+
 /**
  * @brief Buzzer de-initialization.
  */
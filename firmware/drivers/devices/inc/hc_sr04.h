@@ -14,6 +14,13 @@
  * 
  * @note When disconnected return 0.
  * 
+ * @note Asynchronous mode (HcSr04StartAsync): a driver task triggers the sensors
+ * added with HcSr04AddSensor in turns (round-robin, so the echo of one sensor is
+ * not received by another one) and the echo pulse is timed in the GPIO interrupt
+ * of both edges with the CPU cycle counter, less than 0.01 us of resolution instead
+ * of the 10 us steps of the blocking functions. The CPU is free while waiting and
+ * each distance is passed to a callback.
+ * 
  * @note When ussing dedicated connector in ESP-EDU:
  * |   HC_SR04      |   EDU-CIAA	|
  * |:--------------:|:-------------:|
@@ -29,6 +36,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Asynchronous round-robin ranging of several sensors					|
  * 
  **/
 
@@ -37,8 +45,17 @@
 #include <stdint.h>
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define HC_SR04_MAX_SENSORS		4		/*!< Max sensors of the asynchronous mode */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Function called by the driver task with each distance measured in asynchronous mode
+ * 
+ * @param sensor Sensor index (returned by HcSr04AddSensor)
+ * @param distance Distance in cm (0: no echo, 300: out of range)
+ * @param param Parameter given to HcSr04StartAsync
+ */
+typedef void (*hc_sr04_func_t)(uint8_t sensor, float distance, void *param);
 
 /*==================[external data declaration]==============================*/
 
@@ -66,6 +83,30 @@ uint16_t HcSr04ReadDistanceInCentimeters(void);
  */
 uint16_t HcSr04ReadDistanceInInches(void);
 
+/**
+ * @brief Add a sensor to the asynchronous mode
+ * 
+ * @note The sensor initialized with HcSr04Init is the sensor 0.
+ * 
+ * @param echo GPIO number wher echo pin is connected
+ * @param trigger GPIO number wher trigger pin is connected
+ * @return int8_t sensor index, or -1 if there are HC_SR04_MAX_SENSORS already
+ */
+int8_t HcSr04AddSensor(gpio_t echo, gpio_t trigger);
+
+/**
+ * @brief Start the asynchronous round-robin ranging
+ * 
+ * Every period_ms all the sensors are measured, one after the other (up to 40 ms
+ * each when there is no echo). The blocking functions must not be used afterwards.
+ * 
+ * @param period_ms Period of each round (in ms)
+ * @param func_p Function called with each distance (from the driver task)
+ * @param param_p Parameter passed to func_p
+ * @return false if already started, no sensors or no callback
+ */
+bool HcSr04StartAsync(uint32_t period_ms, hc_sr04_func_t func_p, void *param_p);
+
 /**
  * @brief HC_SR04 de-initialization.
  * 
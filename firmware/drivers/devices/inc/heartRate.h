@@ -57,9 +57,38 @@
 #include <stdint.h>
 #include "stdbool.h"
 
+//Beat detector state: one per channel (i.e. IR and green, or two sensors)
+typedef struct
+{
+  int16_t IR_AC_Max;
+  int16_t IR_AC_Min;
+  int16_t IR_AC_Signal_Current;
+  int16_t IR_AC_Signal_Previous;
+  int16_t IR_AC_Signal_min;
+  int16_t IR_AC_Signal_max;
+  int16_t IR_Average_Estimated;
+  int16_t positiveEdge;
+  int16_t negativeEdge;
+  int32_t ir_avg_reg;   //DC estimator
+  int16_t cbuf[32];     //FIR filter taps
+  uint8_t offset;
+  int16_t minAmplitude; //Peak to peak AC amplitude of a beat (default 20)
+} heartRate_t;
+
+//Single channel functions (state in a default instance)
 bool checkForBeat(int32_t sample);
 int16_t averageDCEstimator(int32_t *p, uint16_t x);
 int16_t lowPassFIRFilter(int16_t din);
 int32_t mul16(int16_t x, int16_t y);
 
+//Multi-instance functions
+void heartRateInit(heartRate_t *hr);
+bool heartRateCheckForBeat(heartRate_t *hr, int32_t sample);
+//Processes a batch of samples (i.e. a FIFO read), returns the number of beats detected
+//and the index in samples of the first maxBeats of them
+uint16_t heartRateCheckForBeats(heartRate_t *hr, const uint32_t *samples, uint16_t lenght, uint16_t *beats, uint16_t maxBeats);
+//Changes the minimum peak to peak amplitude of a beat, i.e. twice the threshold of a
+//noise floor estimator (noise_floor.h) of the AC signal, so the detector follows the noise
+void heartRateSetMinAmplitude(heartRate_t *hr, int16_t minAmplitude);
+
 #endif /* MODULES_LPC4337_M4_DRIVERS_DEVICES_INC_HEARTRATE_H_ */
@@ -10,6 +10,11 @@
 /** \brief The HX711 amplifier is a breakout board that allows you to easily read load cells to measure weight. It communicates with the EDU-ESP
  * board via I2C.
  * 
+ * @note Load cell arrays use the multi-device mode (HX711_InitMulti): up to HX711_MAX_CHANNELS
+ * HX711 share one PD_SCK line, driven through a dedicated GPIO bundle (gpio_fast_out_mcu.h),
+ * and every DOUT line is sampled at the same time on each clock edge (GPIOReadAllFast). All
+ * the channels are read in the time of one, and their conversions stay in step.
+ * 
  * @author Juan Ignacio Cerrudo
  *
  * @section changelog
@@ -17,12 +22,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         						|
+ * | 14/10/2026 | Interrupt driven readout with moving average           				|
+ * | 15/10/2026 | Multi-device readout with a shared clock line           				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
+#define HX711_RING_SIZE     32      /*!< Samples stored by the interrupt driven readout (power of two) */
+#define HX711_AVERAGE_MAX   16      /*!< Max moving average window */
+#define HX711_MAX_CHANNELS  8       /*!< Max HX711 sharing the clock line in the multi-device mode */
 
 /*==================[typedef]================================================*/
 
@@ -110,6 +120,66 @@ void HX711_setOffset(double offset);
  */
 double HX711_getOffset(void);
 
+/** @fn bool HX711_startInterrupt(uint8_t average)
+ * @brief Starts the interrupt driven readout (call after HX711_Init)
+ * The DOUT falling edge (conversion ready) wakes up a driver task that clocks the
+ * 24 bits plus the gain pulses with interrupts disabled (well under the 60 us of
+ * PD_SCK high that powers the chip down), stores the sample in a ring and updates
+ * a moving average. Weighing tasks read the results without blocking.
+ * @note Samples are signed 24 bits values (not the HX711_read() format), so the
+ * tare of this mode must be set with HX711_tareAsync().
+ * @param[in] average Moving average window (1 to HX711_AVERAGE_MAX)
+ * @return false if already started
+ */
+bool HX711_startInterrupt(uint8_t average);
+/** @fn uint32_t HX711_readSamples(int32_t *values, uint32_t n)
+ * @brief Takes the samples stored by the interrupt driven readout (non blocking)
+ * @param[out] values Samples array
+ * @param[in] n Max number of samples
+ * @return Number of samples stored in values
+ */
+uint32_t HX711_readSamples(int32_t *values, uint32_t n);
+/** @fn bool HX711_getAverage(double *average)
+ * @brief Returns the moving average of the interrupt driven readout (non blocking)
+ * @param[out] average Average of the last samples (window given to HX711_startInterrupt)
+ * @return false if no samples were converted yet
+ */
+bool HX711_getAverage(double *average);
+/** @fn float HX711_getUnitsAsync(void)
+ * @brief Returns (moving average - OFFSET) / SCALE (non blocking)
+ * @return Read value (0 if no samples were converted yet)
+ */
+float HX711_getUnitsAsync(void);
+/** @fn bool HX711_tareAsync(void)
+ * @brief Set the OFFSET value for tare weight from the moving average (non blocking)
+ * @return false if no samples were converted yet
+ */
+bool HX711_tareAsync(void);
+/** @fn bool HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t channels)
+ * @brief Multi-device mode: several HX711 with a shared clock pin, read together
+ * @param[in] gain Gain of all the channels (128, 64 or 32)
+ * @param[in] pd_sck Clock pin shared by all the HX711 (uses a dedicated GPIO channel)
+ * @param[in] dout Data pin of each HX711
+ * @param[in] channels Number of HX711 (up to HX711_MAX_CHANNELS)
+ * @return false if there are too many channels or no free dedicated GPIO channel
+ */
+bool HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t channels);
+/** @fn bool HX711_startMulti(void)
+ * @brief Starts the readout of the multi-device mode (call after HX711_InitMulti)
+ * Any DOUT falling edge wakes up a driver task, that waits until all the channels
+ * are ready and clocks the 24 bits of all of them at once (with interrupts disabled).
+ * Each channel gets its own ring of signed 24 bits samples.
+ * @return false if already started or not initialized
+ */
+bool HX711_startMulti(void);
+/** @fn uint32_t HX711_readChannel(uint8_t channel, int32_t *values, uint32_t n)
+ * @brief Takes the samples of one channel of the multi-device mode (non blocking)
+ * @param[in] channel Channel (index of its DOUT pin in HX711_InitMulti)
+ * @param[out] values Samples array
+ * @param[in] n Max number of samples
+ * @return Number of samples stored in values
+ */
+uint32_t HX711_readChannel(uint8_t channel, int32_t *values, uint32_t n);
 /** @fn HX711_powerDown(void)
  * @brief Puts the chip into power down mode
  */
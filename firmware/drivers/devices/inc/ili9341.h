@@ -33,6 +33,17 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 14/10/2026 | Fills written with queued DMA transactions     |
+ * | 14/10/2026 | SPI device added once, D/C set per transaction |
+ * | 14/10/2026 | Window write from a RAM buffer                 |
+ * | 14/10/2026 | Non blocking window write                      |
+ * | 14/10/2026 | Characters and icons expanded to RGB565 by rows|
+ * | 14/10/2026 | Span primitives for lines and filled shapes    |
+ * | 14/10/2026 | RLE compressed pictures                        |
+ * | 15/10/2026 | Fills in DMA transactions of max size          |
+ * | 15/10/2026 | Window write with end of transfer callback     |
+ * | 15/10/2026 | Low SPI bus priority, pixels in 2 KB bursts    |
+ * | 15/10/2026 | LRU cache of glyphs expanded to RGB565         |
  *
  */
 
@@ -117,6 +128,9 @@ void ILI9341Rotate(ili9341_orientation_t orientation);
 
 /**
  * @brief  		Draw a single character on the LCD
+ * @note		With CONFIG_DRIVERS_ILI9341_GLYPH_CACHE the glyph is expanded to RGB565 once for
+ * 				each font and colors, and kept in an LRU cache: repeated characters (i.e. digits
+ * 				of a readout) are written by DMA straight from RAM.
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	data: Character to be displayed
@@ -127,8 +141,19 @@ void ILI9341Rotate(ili9341_orientation_t orientation);
  */
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Glyph cache statistics since the start
+ * @param[out]  hits: Characters drawn from the cache
+ * @param[out]  misses: Characters expanded (or drawn without cache)
+ * @retval		None
+ */
+void ILI9341GetGlyphCacheStats(uint32_t * hits, uint32_t * misses);
+
 /**
  * @brief  		Draw a single character on the LCD
+ * @note		With CONFIG_DRIVERS_ILI9341_GLYPH_CACHE the glyph is expanded to RGB565 once for
+ * 				each font and colors, and kept in an LRU cache: repeated characters (i.e. digits
+ * 				of a readout) are written by DMA straight from RAM.
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	icon: Icon to be displayed
@@ -185,6 +210,26 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
  */
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Draws horizontal line on the LCD as a single window (clipped to the screen)
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y: Y coordinate of the line
+ * @param[in]  	color: Line color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawHLine(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Draws vertical line on the LCD as a single window (clipped to the screen)
+ * @param[in]  	x: X coordinate of the line
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Line color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawVLine(int16_t x, int16_t y0, int16_t y1, uint16_t color);
+
 /**
  * @brief  		Draws rectangle on the LCD
  * @param[in]  	x0: X coordinate of top left point
@@ -267,6 +312,73 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a RLE compressed picture on the LCD
+ * @note		The picture is a sequence of packets. Header byte with bit 7 set: run of
+ * 				(header & 0x7F) + 1 pixels of the color that follows (2 bytes). Bit 7 cleared:
+ * 				header + 1 literal pixels follow (2 bytes each). Colors are RGB565 high byte
+ * 				first, as in ILI9341DrawPicture. Pictures are decoded by blocks while the
+ * 				previous block is written by DMA.
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	rle: Compressed picture (i.e. made with picture_to_rle.py)
+ * @retval 		None
+ */
+void ILI9341DrawPictureRLE(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* rle);
+
+/**
+ * @brief  		Write a window of pixels from a RAM buffer with queued DMA transactions
+ * @note		Pixels are RGB565 in LCD byte order (high byte first), i.e. as rendered by
+ * 				ili9341_canvas. The buffer must be in DMA capable RAM.
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	width: Window width
+ * @param[in]  	height: Window height
+ * @param[in]	pixels: width x height pixels, row by row
+ * @retval		None
+ */
+void ILI9341DrawWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels);
+
+/**
+ * @brief  		Start writing a window of pixels from a RAM buffer and return while DMA sends it
+ * @note		The buffer must not be modified until ILI9341DrawWindowWait returns. Any other
+ * 				ILI9341 function waits for the transfer to finish first. The SPI bus is held
+ * 				meanwhile, so other devices of the bus wait too.
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	width: Window width
+ * @param[in]  	height: Window height
+ * @param[in]	pixels: width x height pixels, row by row (LCD byte order, DMA capable RAM)
+ * @retval		None
+ */
+void ILI9341DrawWindowStart(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels);
+
+/**
+ * @brief  		Wait the end of the window write started by ILI9341DrawWindowStart
+ * @retval		None
+ */
+void ILI9341DrawWindowWait(void);
+
+/**
+ * @brief  		Start writing a window of pixels from a RAM buffer and call a function when DMA
+ * 				has sent it (i.e. to tell a graphics library that the buffer is free)
+ * @note		The SPI bus is not held: transactions of other devices can go between the chunks
+ * 				of the window. The buffer must not be modified until func_p is called. Any other
+ * 				ILI9341 function waits for the transfer to finish first.
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	width: Window width
+ * @param[in]  	height: Window height
+ * @param[in]	pixels: width x height pixels, row by row (LCD byte order, DMA capable RAM)
+ * @param[in]	func_p: Function called from the SPI ISR at the end of the window (must be in IRAM)
+ * @param[in]	param_p: Parameter passed to func_p
+ * @retval		None
+ */
+void ILI9341DrawWindowNotify(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels,
+							 void (*func_p)(void*), void *param_p);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
@@ -0,0 +1,205 @@
+#ifndef ILI9341_CANVAS_H_
+#define ILI9341_CANVAS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup ILI9341_Canvas ILI9341 Canvas
+ ** @{
+ * @brief  RAM renderer for the ILI9341 LCD with dirty rows flush
+ *
+ * @note A canvas is a RAM buffer that covers a rectangular area of the screen (the
+ * full 240x320 frame takes 150 KB, so canvases cover only the areas that are updated,
+ * i.e. a header or a numeric value). Primitives draw into the buffer, with screen
+ * coordinates clipped to the canvas, and ILI9341CanvasFlush writes to the LCD only
+ * the rows modified since the previous flush, as one window written by DMA.
+ *
+ * @note Areas bigger than a canvas buffer are rendered by strips with ILI9341CanvasRender:
+ * with two strip buffers the CPU renders a strip while DMA writes the previous one,
+ * so rendering and SPI transfer times overlap instead of being added.
+ *
+ * @note Drawing a string directly on the LCD sets a window and writes every
+ * character separately; on a canvas it costs a memory write per pixel and the flush
+ * a single burst.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 14/10/2026 | Document creation		                         |
+ * | 14/10/2026 | Double buffered strip rendering                |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "icons.h"
+/*==================[macros]=================================================*/
+/** @brief Bytes of the buffer of a canvas */
+#define ILI9341_CANVAS_BYTES(width, height)	((uint32_t)(width) * (height) * 2)
+/*==================[typedef]================================================*/
+/**
+ * @brief  Canvas: RAM buffer of an area of the screen
+ */
+typedef struct {
+	uint16_t x;				/*!< Screen X position of top left corner */
+	uint16_t y;				/*!< Screen Y position of top left corner */
+	uint16_t width;			/*!< Width in pixels */
+	uint16_t height;		/*!< Height in pixels */
+	uint16_t *buffer;		/*!< width x height pixels, in LCD byte order (DMA capable RAM) */
+	uint16_t dirty_y0;		/*!< First row modified since the last flush */
+	uint16_t dirty_y1;		/*!< Last row modified since the last flush */
+	bool dirty;				/*!< Rows to flush */
+} ili9341_canvas_t;
+
+/**
+ * @brief  Two strip buffers to render an area with ILI9341CanvasRender
+ */
+typedef struct {
+	uint16_t *buffer[2];	/*!< Strip buffers (DMA capable RAM) */
+	uint32_t pixels;		/*!< Pixels of each buffer (strip height = pixels / area width) */
+} ili9341_strips_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a canvas (it's flushed entirely on the first flush)
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	width: Width in pixels
+ * @param[in]  	height: Height in pixels
+ * @param[in]  	buffer: Buffer of ILI9341_CANVAS_BYTES(width, height) bytes (i.e. static array)
+ * @retval 		None
+ */
+void ILI9341CanvasInit(ili9341_canvas_t * canvas, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t * buffer);
+
+/**
+ * @brief  		Fill a canvas with a color
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	color: Color
+ * @retval 		None
+ */
+void ILI9341CanvasFill(ili9341_canvas_t * canvas, uint16_t color);
+
+/**
+ * @brief  		Draw a pixel on a canvas
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position
+ * @param[in]  	y: Screen Y position
+ * @param[in]  	color: Color
+ * @retval 		None
+ */
+void ILI9341CanvasDrawPixel(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Draw a filled rectangle on a canvas
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: Screen X position of a corner
+ * @param[in]  	y0: Screen Y position of a corner
+ * @param[in]  	x1: Screen X position of the opposite corner
+ * @param[in]  	y1: Screen Y position of the opposite corner
+ * @param[in]  	color: Color
+ * @retval 		None
+ */
+void ILI9341CanvasDrawFilledRectangle(ili9341_canvas_t * canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw a line on a canvas
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: Screen X position of line start
+ * @param[in]  	y0: Screen Y position of line start
+ * @param[in]  	x1: Screen X position of line end
+ * @param[in]  	y1: Screen Y position of line end
+ * @param[in]  	color: Color
+ * @retval 		None
+ */
+void ILI9341CanvasDrawLine(ili9341_canvas_t * canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw a character on a canvas
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	data: Character
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Character color
+ * @param[in]  	background: Background color
+ * @retval 		Character width in pixels
+ */
+uint16_t ILI9341CanvasDrawChar(ili9341_canvas_t * canvas, int16_t x, int16_t y, char data, Font_t * font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw a string on a canvas (same spacing as ILI9341DrawString)
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	str: String
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Characters color
+ * @param[in]  	background: Background color
+ * @retval 		None
+ */
+void ILI9341CanvasDrawString(ili9341_canvas_t * canvas, int16_t x, int16_t y, char * str, Font_t * font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw an icon on a canvas
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	icon: Icon
+ * @param[in]  	icon_font: Icons font
+ * @param[in]  	foreground: Icon color
+ * @param[in]  	background: Background color
+ * @retval 		None
+ */
+void ILI9341CanvasDrawIcon(ili9341_canvas_t * canvas, int16_t x, int16_t y, icon_t icon, icon_font_t * icon_font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw a picture on a canvas (same format as ILI9341DrawPicture)
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Pointer to first byte of picture
+ * @retval 		None
+ */
+void ILI9341CanvasDrawPicture(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t * pic);
+
+/**
+ * @brief  		Write to the LCD the rows modified since the last flush
+ * @note		Rows are written with the canvas width, so they are a single window.
+ * @param[in]  	canvas: Canvas
+ * @retval 		None
+ */
+void ILI9341CanvasFlush(ili9341_canvas_t * canvas);
+
+/**
+ * @brief  		Render an area of the screen by strips, overlapping rendering and DMA transfer
+ * @note		render_p is called once per strip with a canvas that covers its rows, and it
+ * 				must draw every pixel of the area (i.e. ILI9341CanvasFill first): primitives
+ * 				outside the strip are clipped. While it renders a strip the previous one is
+ * 				written by DMA from the other buffer.
+ * @param[in]  	strips: Strip buffers
+ * @param[in]  	x: Screen X position of top left corner
+ * @param[in]  	y: Screen Y position of top left corner
+ * @param[in]  	width: Area width in pixels
+ * @param[in]  	height: Area height in pixels
+ * @param[in]  	render_p: Function that draws the area on each strip canvas
+ * @param[in]  	param_p: Parameter passed to render_p
+ * @retval 		None
+ */
+void ILI9341CanvasRender(ili9341_strips_t * strips, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+						 void (*render_p)(ili9341_canvas_t * canvas, void * param), void * param_p);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ILI9341_CANVAS_H_ */
+
+/*==================[end of file]============================================*/
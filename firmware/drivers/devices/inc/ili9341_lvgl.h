@@ -0,0 +1,71 @@
+#ifndef ILI9341_LVGL_H_
+#define ILI9341_LVGL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup ILI9341_LVGL ILI9341 LVGL
+ ** @{
+ * @brief  LVGL display port for the ILI9341 LCD
+ *
+ * @note LVGL renders only the areas of the screen that changed (dirty areas) into
+ * two partial buffers of CONFIG_DRIVERS_LVGL_BUFFER_LINES lines: the flush callback
+ * sets the window of each area and writes it with queued DMA transactions
+ * (ILI9341DrawWindowNotify), and the end of the last transaction tells LVGL the
+ * buffer is free (lv_display_flush_ready, from the SPI ISR). Meanwhile LVGL renders
+ * the next area in the other buffer, so the SPI bus keeps transferring while the
+ * CPU renders. The bus is not held between flushes, other devices share it.
+ *
+ * @note Requires LVGL 9 as a managed component of the project (in main/idf_component.yml:
+ * `lvgl/lvgl: "^9.1"`) and CONFIG_DRIVERS_LVGL enabled in menuconfig.
+ *
+ * @note LVGL and the ILI9341 functions are not thread safe: lv_timer_handler and every
+ * lv_* call must be done from the same task.
+ *
+ * @code
+ * ILI9341LvglInit(SPI_1, GPIO_9, GPIO_18, ILI9341_Portrait_1);
+ * lv_obj_t * label = lv_label_create(lv_screen_active());
+ * lv_label_set_text(label, "ESP-EDU");
+ * while(1){
+ *     vTaskDelay(pdMS_TO_TICKS(lv_timer_handler()));
+ * }
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "lvgl.h"
+#include "spi_mcu.h"
+#include "ili9341.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes the LCD, LVGL and an LVGL display of the LCD size
+ * @param[in]  	spi_dev: Number of SPI device to control LCD driver
+ * @param[in]  	gpio_dc: Number of GPIO pin to use as data/command
+ * @param[in]  	gpio_rst: Number of GPIO pin to use as hardware reset
+ * @param[in]  	orientation: LCD orientation (sets the display width and height)
+ * @retval 		LVGL display (default display), NULL when fails
+ */
+lv_display_t * ILI9341LvglInit(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst, ili9341_orientation_t orientation);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ILI9341_LVGL_H_ */
+
+/*==================[end of file]============================================*/
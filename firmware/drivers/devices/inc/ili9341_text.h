@@ -0,0 +1,91 @@
+#ifndef ILI9341_TEXT_H_
+#define ILI9341_TEXT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup ILI9341_Text ILI9341 Text
+ ** @{
+ * @brief  Text widgets for the ILI9341 LCD that redraw only the characters that changed
+ *
+ * @note A text widget keeps the string shown on the LCD. A new value is compared
+ * character by character with it: a character is redrawn only if it changed or moved
+ * (fonts are proportional, a narrower digit moves the next ones), and the columns left
+ * by a shorter string are cleared. There is no erase of the whole string before drawing,
+ * and a steady value (i.e. a clock between minutes) doesn't write the LCD at all.
+ *
+ * @note Redraws are limited to one per period: values set faster are kept and the last
+ * one is drawn by the next ILI9341TextSet or ILI9341TextUpdate after the period.
+ *
+ * @code
+ * static ili9341_text_t bpm = {.x = 20, .y = 60, .font = &font_89, .foreground = ILI9341_BLUE,
+ *                              .background = ILI9341_WHITE, .period = 250};
+ * ILI9341TextInit(&bpm);
+ * ...
+ * ILI9341TextSet(&bpm, freq);
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+/*==================[macros]=================================================*/
+#define ILI9341_TEXT_MAX	16			/*!< Max characters of a text widget */
+/*==================[typedef]================================================*/
+/**
+ * @brief  Text widget
+ */
+typedef struct {
+	uint16_t x;							/*!< X position of top left corner */
+	uint16_t y;							/*!< Y position of top left corner */
+	Font_t *font;						/*!< Font */
+	uint16_t foreground;				/*!< Characters color */
+	uint16_t background;				/*!< Background color */
+	uint16_t period;					/*!< Min time between redraws (ms, 0: no limit) */
+	char shown[ILI9341_TEXT_MAX + 1];	/*!< String on the LCD */
+	char value[ILI9341_TEXT_MAX + 1];	/*!< Last string set */
+	uint16_t width;						/*!< Width of the string on the LCD (pixels) */
+	int64_t last_draw;					/*!< Time of the last redraw (us) */
+} ili9341_text_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a text widget (empty: the first value is drawn entirely)
+ * @param[in]  	text: Text widget with position, font, colors and period set
+ * @retval 		None
+ */
+void ILI9341TextInit(ili9341_text_t * text);
+
+/**
+ * @brief  		Set the value of a text widget, and redraw the characters that changed if
+ * 				the period since the last redraw has elapsed
+ * @param[in]  	text: Text widget
+ * @param[in]  	str: New string (up to ILI9341_TEXT_MAX characters, without new lines)
+ * @retval 		true if the LCD was written
+ */
+bool ILI9341TextSet(ili9341_text_t * text, const char * str);
+
+/**
+ * @brief  		Redraw a value set during the last period, if the period has elapsed
+ * @param[in]  	text: Text widget
+ * @retval 		true if the LCD was written
+ */
+bool ILI9341TextUpdate(ili9341_text_t * text);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ILI9341_TEXT_H_ */
+
+/*==================[end of file]============================================*/
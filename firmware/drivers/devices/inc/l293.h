@@ -26,11 +26,16 @@
  * | 	3A		 	| 	GPIO_18		|
  * | 	4A		 	| 	GPIO_9		|
  *
+ * @note L293SetSpeedRamp changes the speed of a motor with limited rate and
+ * acceleration (see "motion.h"), from a timer: the motors aren't stressed by
+ * sudden changes and the caller isn't blocked.
+ *
  * @section changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 14/10/2026 | Speed ramps, backward direction fixed          |
  *
  */
 
@@ -70,6 +75,23 @@ uint8_t L293Init(void);
  */
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed);
 
+/**
+ * @brief  		Change the speed of a motor with a ramp (returns immediately)
+ * @param[in]  	motor: 	motor to be configured
+ * @param[in]  	speed: 	from -100 to 100 (as L293SetSpeed)
+ * @retval 		0 when success, 1 when fails
+ */
+uint8_t L293SetSpeedRamp(l293_motor_t motor, int8_t speed);
+
+/**
+ * @brief  		Change the limits of the ramps (default: 200 %/s, 800 %/s^2)
+ * @param[in]  	motor: 	motor to be configured
+ * @param[in]  	rate: 	max speed change (%/s)
+ * @param[in]  	accel: 	acceleration of the speed change (%/s^2)
+ * @retval 		0 when success, 1 when fails
+ */
+uint8_t L293SetRamp(l293_motor_t motor, uint16_t rate, uint16_t accel);
+
 /**
  * @brief  	De-initializes L293 Driver
  * @param	None
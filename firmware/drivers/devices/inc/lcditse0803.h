@@ -23,6 +23,9 @@
  * | 	SEL3	 	| 	GPIO_9		|
  * | 	Gnd 	    | 	GND     	|
  * 
+ * @note LcdItsE0803Write only stores the value (it can be called from any task
+ * or ISR); a 10 ms timer latches the digits into the display when it changes.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -30,6 +33,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Timer driven latch of the display value								|
  * 
  **/
 
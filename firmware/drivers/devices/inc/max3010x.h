@@ -2,7 +2,7 @@
  This is a library written for the Maxim MAX30105 Optical Smoke Detector
  It should also work with the MAX30102. However, the MAX30102 does not have a Green LED.
  These sensors use I2C to communicate, as well as a single (optional)
- interrupt line that is not currently supported in this driver.
+ interrupt line, used by MAX3010X_startInterrupt to drain the FIFO when it's almost full.
 
  Written by Peter Jansen and Nathan Seidle (SparkFun)
  BSD license, all text above must be included in any redistribution.
@@ -13,6 +13,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "gpio_mcu.h"
 
 #define MAX30105_ADDRESS          0x57 //7-bit I2C Address
 //Note that MAX30102 has the same I2C address and Part ID
@@ -38,6 +39,14 @@
 
 #endif
 
+#define MAX3010X_FIFO_DEPTH       32 //Samples stored by the sensor FIFO
+//Bytes of a burst that drains a full FIFO with Red+IR (3 bytes per LED)
+#define MAX3010X_BATCH_BYTES      (MAX3010X_FIFO_DEPTH * 2 * 3)
+
+//Function called by the driver task with each batch read in interrupt mode
+//(red and ir are only valid during the call)
+typedef void (*MAX3010X_batch_func_t)(const uint32_t *red, const uint32_t *ir, uint8_t samples, void *param);
+
 
   bool MAX3010X_begin(void);
 
@@ -97,6 +106,15 @@
   uint32_t MAX3010X_getFIFORed(void); //Returns the FIFO sample pointed to by tail
   uint32_t MAX3010X_getFIFOIR(void); //Returns the FIFO sample pointed to by tail
   uint32_t MAX3010X_getFIFOGreen(void); //Returns the FIFO sample pointed to by tail
+  //Reads the samples waiting in the sensor FIFO (up to maxSamples) in one I2C burst
+  //Red and IR samples go to the caller's arrays; Green is discarded
+  //Returns number of samples read
+  uint8_t MAX3010X_readBatch(uint32_t *red, uint32_t *ir, uint8_t maxSamples);
+  //Interrupt mode: the A_FULL interrupt on intPin wakes up a driver task when the FIFO
+  //holds samples (17 to 32) and func_p receives them in batches, with no polling
+  //With CONFIG_DRIVERS_POWER_MANAGEMENT intPin also wakes up the chip from light sleep
+  //Call after MAX3010X_setup. Returns false if already started
+  bool MAX3010X_startInterrupt(gpio_t intPin, uint8_t samples, MAX3010X_batch_func_t func_p, void *param_p);
 
   uint8_t MAX3010X_getWritePointer(void);
   uint8_t MAX3010X_getReadPointer(void);
@@ -0,0 +1,193 @@
+#ifndef MCP3208_H
+#define MCP3208_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup MCP3208 MCP3208
+ ** @{ */
+
+/** \brief Driver for the MCP3208 (8 channels, 12 bits SPI ADC) and compatible converters.
+ *
+ * Extends the 4 analog inputs of the ESP-EDU to 8 more channels per converter
+ * (i.e. 16 drum pads with two of them, on SPI_2 and SPI_3). A timer paces the
+ * scans: on each alarm a driver task queues one transaction per enabled
+ * channel (SpiQueue), the SPI DMA converts them back to back and the results
+ * are stored in blocks with the layout of the continuous internal ADC
+ * (analog_block_t): samples de-interleaved per channel, valid samples of each
+ * channel, channel mask, sample frequency and timestamp of the first sample.
+ * The code that processes the internal ADC blocks works on these the same way.
+ *
+ * @code
+ * static mcp3208_t adc;
+ * mcp3208_config_t config = {
+ *     .device = SPI_2, .bitrate = 2000000, .channels = 0xFF, .vref = 3300,
+ *     .sample_frec = 4000, .frame_size = 64
+ * };
+ * Mcp3208Init(&adc, &config);
+ * Mcp3208Start(&adc);
+ * ...
+ * mcp3208_block_t *block = Mcp3208GetBlock(&adc);
+ * if(block != NULL){
+ *     Mcp3208BlockToFloat(&adc, block, 3, pad_mv);
+ *     Mcp3208ReleaseBlock(&adc, block);
+ * }
+ * @endcode
+ *
+ * @note A conversion takes 24 clocks (32 are sent so the DMA buffers are whole
+ * words): at 2 MHz (max at 5 V, 1 MHz at 2.7 V) one channel takes 16 us, so
+ * sample_frec * enabled channels must stay under ~50000. Scans that start
+ * while the previous one is running, or when every block is in use, are lost
+ * and counted as overruns.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "spi_mcu.h"
+#include "timer_mcu.h"
+/*==================[macros]=================================================*/
+#define MCP3208_CH_NUM			8		/*!< Channels of the converter */
+#define MCP3208_MAX_FRAME_SIZE	64		/*!< Max samples per channel of a block */
+#define MCP3208_BLOCK_RING_SIZE	4		/*!< Blocks of each converter */
+#define MCP3208_FULL_SCALE		4096	/*!< Codes of the converter (12 bits) */
+#define MCP3208_TASK_STACK		2048	/*!< Stack of the scan task */
+#define MCP3208_TASK_PRIORITY	(configMAX_PRIORITIES - 2)	/*!< Priority of the scan task */
+/*==================[typedef]================================================*/
+/**
+ * @brief Converter config structure
+ */
+typedef struct {
+	spi_dev_t device;		/*!< SPI device (chip select) of the converter */
+	uint32_t bitrate;		/*!< SPI clock (up to 2 MHz at 5 V, 1 MHz at 2.7 V) */
+	uint8_t channels;		/*!< Bit mask of the channels scanned */
+	uint16_t vref;			/*!< Reference voltage (mV) */
+	uint32_t sample_frec;	/*!< Sample frequency per channel (in Hz) */
+	uint16_t frame_size;	/*!< Samples per channel of each block, max MCP3208_MAX_FRAME_SIZE */
+	void *func_p;			/*!< Pointer to callback function called (from the scan task) on every block (can be NULL) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} mcp3208_config_t;
+
+/**
+ * @brief Block of samples, de-interleaved per channel (same layout as analog_block_t)
+ */
+typedef struct {
+	uint16_t data[MCP3208_CH_NUM][MCP3208_MAX_FRAME_SIZE];	/*!< Raw samples (12 bits) of each channel */
+	uint16_t lenght[MCP3208_CH_NUM];						/*!< Number of valid samples of each channel */
+	uint8_t channels;										/*!< Bit mask of the channels present in the block */
+	uint32_t sample_frec;									/*!< Sample frequency per channel (in Hz) */
+	uint64_t timestamp;										/*!< Acquisition time of the first sample (in us since boot) */
+} mcp3208_block_t;
+
+/**
+ * @brief Converter instance (driver data, don't modify)
+ */
+typedef struct {
+	mcp3208_config_t config;							/*!< Configuration */
+	uint8_t scan[MCP3208_CH_NUM];						/*!< Channels of a scan, in order */
+	uint8_t scan_lenght;								/*!< Channels of a scan */
+	spi_trans_t trans[MCP3208_CH_NUM];					/*!< Transaction of each channel of a scan */
+	uint32_t tx[MCP3208_CH_NUM];						/*!< Command of each channel (DMA) */
+	uint32_t rx[MCP3208_CH_NUM];						/*!< Result of each channel (DMA) */
+	mcp3208_block_t blocks[MCP3208_BLOCK_RING_SIZE];	/*!< Blocks ring */
+	volatile uint32_t written;							/*!< Blocks completed by the scan task */
+	volatile uint32_t taken;							/*!< Blocks taken with Mcp3208GetBlock */
+	volatile uint32_t released;							/*!< Blocks released */
+	uint16_t index;										/*!< Samples per channel of the block being filled */
+	volatile bool running;								/*!< Scanning (cleared by Mcp3208Stop) */
+	uint32_t overruns;									/*!< Scans lost */
+	timer_handle_t timer;								/*!< Scan timer */
+	TaskHandle_t task;									/*!< Scan task */
+} mcp3208_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Converter initialization (stopped)
+ *
+ * @param adc Converter instance (must remain valid, i.e. static)
+ * @param config Converter config structure
+ * @return true     Converter initialized
+ * @return false    Invalid configuration, no free timer or task not created
+ */
+bool Mcp3208Init(mcp3208_t *adc, const mcp3208_config_t *config);
+
+/**
+ * @brief Start scanning the channels
+ *
+ * @param adc Converter instance
+ */
+void Mcp3208Start(mcp3208_t *adc);
+
+/**
+ * @brief Stop scanning the channels (the block being filled is discarded)
+ *
+ * @param adc Converter instance
+ */
+void Mcp3208Stop(mcp3208_t *adc);
+
+/**
+ * @brief Convert one channel, waiting for the result
+ *
+ * @note Only while the converter is stopped.
+ *
+ * @param adc Converter instance
+ * @param channel Channel (0 to 7)
+ * @return Raw sample (12 bits)
+ */
+uint16_t Mcp3208ReadSingle(mcp3208_t *adc, uint8_t channel);
+
+/**
+ * @brief Get the next block of samples
+ *
+ * @note Non blocking. Blocks must be released with Mcp3208ReleaseBlock() in the
+ * same order they were obtained.
+ *
+ * @param adc Converter instance
+ * @return Pointer to the block, or NULL if there is no block completed
+ */
+mcp3208_block_t* Mcp3208GetBlock(mcp3208_t *adc);
+
+/**
+ * @brief Give back a block obtained with Mcp3208GetBlock()
+ *
+ * @param adc Converter instance
+ * @param block Block to release
+ */
+void Mcp3208ReleaseBlock(mcp3208_t *adc, mcp3208_block_t *block);
+
+/**
+ * @brief Convert the samples of one channel of a block to float values (in mV)
+ *
+ * @param adc Converter instance
+ * @param block Block of samples
+ * @param channel Channel selected
+ * @param values Array to store converted values (of lenght = block->lenght[channel])
+ */
+void Mcp3208BlockToFloat(const mcp3208_t *adc, const mcp3208_block_t *block, uint8_t channel, float *values);
+
+/**
+ * @brief Scans lost (previous scan still running or all blocks in use)
+ *
+ * @param adc Converter instance
+ * @return Overruns since Mcp3208Init()
+ */
+uint32_t Mcp3208GetOverruns(const mcp3208_t *adc);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MCP3208_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,115 @@
+#ifndef MOTION_H
+#define MOTION_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Motion Motion
+ ** @{ */
+
+/** \brief Trapezoidal motion planner for PWM actuators (servos, DC motors).
+ *
+ * @note Each axis moves its position towards a target with limited speed and
+ * acceleration: it accelerates, cruises at the max speed and decelerates to
+ * stop at the target. A single periodic timer (esp_timer) advances every axis
+ * moving at a fixed rate and calls the output function of the axis when its
+ * position changes (i.e. to update a PWM duty). The timer only runs while an
+ * axis is moving.
+ *
+ * @note Profiles are computed in 16.16 fixed point, with the same steps for
+ * the same moves. The position units are chosen by the driver of the axis
+ * (i.e. hundredths of degree for the servos, % of speed for the motors).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MOTION_MAX_AXES		6		/*!< 4 servos and 2 motors */
+#define MOTION_RATE_HZ		50		/*!< Profile update rate (servo PWM frame) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Output of an axis, called from the planner timer with the new position
+ */
+typedef void (*motion_output_t)(uint8_t channel, int32_t position);
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Planner initialization (only the first call creates the timer).
+ *
+ * @param rate_hz Profile update rate (1 to 1000 Hz)
+ * @return true if the timer was created
+ */
+bool MotionInit(uint16_t rate_hz);
+
+/**
+ * @brief Create an axis.
+ *
+ * @param func_p Output function
+ * @param channel Parameter of the output function (i.e. PWM output)
+ * @param position Initial position
+ * @param max_speed Max speed (units/s)
+ * @param accel Acceleration and deceleration (units/s^2)
+ * @return int8_t Axis number, -1 if there are MOTION_MAX_AXES axes
+ */
+int8_t MotionAxisCreate(motion_output_t func_p, uint8_t channel, int32_t position, uint32_t max_speed, uint32_t accel);
+
+/**
+ * @brief Change the speed and acceleration limits of an axis.
+ *
+ * @param axis Axis number
+ * @param max_speed Max speed (units/s)
+ * @param accel Acceleration and deceleration (units/s^2)
+ */
+void MotionSetLimits(int8_t axis, uint32_t max_speed, uint32_t accel);
+
+/**
+ * @brief Start a move to a target from the current position and speed.
+ *
+ * @param axis Axis number
+ * @param target Target position
+ */
+void MotionMoveTo(int8_t axis, int32_t target);
+
+/**
+ * @brief Set the position of an axis without a move (its move stops).
+ *
+ * @note The output function isn't called: the driver already set the output.
+ *
+ * @param axis Axis number
+ * @param position Current position
+ */
+void MotionSetPosition(int8_t axis, int32_t position);
+
+/**
+ * @brief Current position of an axis.
+ *
+ * @param axis Axis number
+ * @return int32_t Position
+ */
+int32_t MotionGetPosition(int8_t axis);
+
+/**
+ * @brief Check if an axis is moving.
+ *
+ * @param axis Axis number
+ * @return true The axis didn't reach its target
+ */
+bool MotionBusy(int8_t axis);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOTION_H */
+
+/*==================[end of file]============================================*/
@@ -17,11 +17,16 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 14/10/2026 | FIFO streaming of accel+gyro frames into a ring buffer		|
+ * | 14/10/2026 | DMP firmware loading and quaternion packets (opt-in)		|
+ * | 14/10/2026 | Data-ready interrupt mode with FIFO overflow counters		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "i2c_mcu.h"
+#include "ring_buffer_mcu.h"
+#include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 #undef pgm_read_byte
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
@@ -30,7 +35,7 @@
 //#define pgm_read_word(x) (*(x))
 //#define pgm_read_float(x) (*(x))
 //#define PSTR(STR) STR
-//#define MPU6050_INCLUDE_DMP_MOTIONAPPS20
+//#define MPU6050_INCLUDE_DMP_MOTIONAPPS20	// uncomment to build the DMP functions
 #define MPU6050_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for InvenSense evaluation board
 #define MPU6050_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC)
 #define MPU6050_DEFAULT_ADDRESS     MPU6050_ADDRESS_AD0_LOW
@@ -407,9 +412,27 @@
 #define MPU6050_DMP_MEMORY_BANKS        8
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
-// note: DMP code memory blocks defined at end of header file
+
+#define MPU6050_FIFO_SIZE           1024    // FIFO buffer bytes
+#define MPU6050_FIFO_FRAME_SIZE     12      // accel+gyro frame bytes in FIFO streaming mode
+#define MPU6050_FIFO_BURST_FRAMES   21      // frames per I2C burst (252 bytes, 1 byte transfer length)
+#define MPU6050_DMP_PACKET_SIZE         28  // MotionApps v6.12 FIFO packet: quaternion, accel, gyro
+#define MPU6050_DMP_START_ADDRESS       0x0400
 
 /*==================[typedef]================================================*/
+/** @brief Accel+gyro frame of the FIFO streaming mode (ring buffer element) */
+typedef struct {
+    int16_t accel[3];   /*!< X, Y, Z acceleration */
+    int16_t gyro[3];    /*!< X, Y, Z rotation */
+} mpu6050_frame_t;
+
+/** @brief Counters of the data-ready interrupt mode */
+typedef struct {
+    uint32_t dataReady;     /*!< Data-ready pulses received */
+    uint32_t reads;         /*!< FIFO reads */
+    uint32_t frames;        /*!< Frames stored in the ring buffer */
+    uint32_t fifoOverflow;  /*!< FIFO overflows (the FIFO was reset and its frames lost) */
+} mpu6050_int_stats_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -2648,6 +2671,120 @@ void MPU6050_setFIFOByte(uint8_t data);
  */
 void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length);
 
+/** Start FIFO streaming of accel+gyro frames.
+ * Disables the FIFO, sets the sample rate divider, enables only the
+ * accelerometer and gyroscope axes in FIFO_EN and resets and enables the FIFO.
+ * Frames are written at Sample Rate = Gyroscope Output Rate / (1 + rate), where
+ * the Gyroscope Output Rate is 8 kHz with the DLPF disabled and 1 kHz otherwise.
+ * @param rate Sample rate divider (SMPLRT_DIV)
+ * @see MPU6050_readFIFOStream()
+ */
+void MPU6050_startFIFOStream(uint8_t rate);
+
+/** Read the FIFO frames into a ring buffer of mpu6050_frame_t.
+ * Reads FIFO_COUNT and then the complete frames (up to the ring buffer free
+ * space) in bursts of MPU6050_FIFO_BURST_FRAMES frames, instead of a 14 byte
+ * register read per sample. If the FIFO has overflowed, frame alignment is lost:
+ * it's reset and no frames are read.
+ * @param rb Ring buffer of mpu6050_frame_t elements
+ * @return Number of frames stored in the ring buffer
+ * @see MPU6050_startFIFOStream()
+ */
+uint16_t MPU6050_readFIFOStream(ring_buffer_t *rb);
+
+/** Start the data-ready interrupt mode.
+ * Enables the DATA_RDY and FIFO_OFLOW interrupts (50 us pulses, active high).
+ * Each pulse on intPin wakes up a driver task, which counts it and, every
+ * frames data-ready pulses, reads INT_STATUS and the FIFO into rb with
+ * MPU6050_readFIFOStream(). There's no polling: I2C is used only when data
+ * exists, and the consumer task is notified (xTaskNotifyGive) after each read
+ * that stores frames, so it can wait for them with ulTaskNotifyTake().
+ * Call after MPU6050_startFIFOStream().
+ * @param intPin GPIO connected to the INT pin
+ * @param rb Ring buffer of mpu6050_frame_t elements
+ * @param frames Frames per FIFO read (1 to MPU6050_FIFO_BURST_FRAMES, 0 is 1)
+ * @param consumer Task to notify (NULL: no notification)
+ * @return False if already started
+ * @see MPU6050_getInterruptStats()
+ */
+bool MPU6050_startInterrupt(gpio_t intPin, ring_buffer_t *rb, uint8_t frames, TaskHandle_t consumer);
+
+/** Get the counters of the data-ready interrupt mode.
+ * @param stats Counters since MPU6050_startInterrupt()
+ */
+void MPU6050_getInterruptStats(mpu6050_int_stats_t *stats);
+
+#ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+// DMP (MotionApps) mode
+
+/** Select the DMP memory bank for MEM_R_W accesses.
+ * @param bank Memory bank (0 to MPU6050_DMP_MEMORY_BANKS - 1)
+ * @param prefetchEnabled Prefetch flag
+ * @param userBank User bank flag
+ */
+void MPU6050_setMemoryBank(uint8_t bank, bool prefetchEnabled, bool userBank);
+
+/** Set the DMP memory address (inside the bank) for MEM_R_W accesses.
+ * @param address Start address
+ */
+void MPU6050_setMemoryStartAddress(uint8_t address);
+
+/** Write a block to DMP memory, in chunks of MPU6050_DMP_MEMORY_CHUNK_SIZE bytes.
+ * @param data Data to write
+ * @param dataSize Number of bytes
+ * @param bank First memory bank
+ * @param address First address inside the bank
+ * @param verify Read back each chunk and compare it
+ * @return false if verification failed
+ */
+bool MPU6050_writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify);
+
+/** Enable or disable the DMP.
+ * @param enabled New DMP enabled state
+ * @see MPU6050_USERCTRL_DMP_EN_BIT
+ */
+void MPU6050_setDMPEnabled(bool enabled);
+
+/** Reset the DMP.
+ * @see MPU6050_USERCTRL_DMP_RESET_BIT
+ */
+void MPU6050_resetDMP();
+
+/** Initialize the DMP with the MotionApps v6.12 firmware.
+ * Resets the device, configures it as the MotionApps firmware expects (PLL
+ * clock, 200 Hz sample rate, DLPF 188 Hz, 2000 deg/s, 2 g), loads and verifies
+ * the firmware image, sets its start address and enables the DMP interrupt. The
+ * image is not part of this driver: it's the dmpMemory array provided with the
+ * InvenSense MotionApps / i2cdevlib sources. Call MPU6050_setDMPEnabled(true)
+ * to start it; the DMP then writes a MPU6050_DMP_PACKET_SIZE packet to the FIFO
+ * per sample, so orientation fusion doesn't run on the ESP32.
+ * @param firmware DMP firmware image
+ * @param size Image size in bytes
+ * @return 0 on success, 1 if the firmware verification failed
+ */
+uint8_t MPU6050_dmpInitialize(const uint8_t *firmware, uint16_t size);
+
+/** Read the newest DMP packet from the FIFO.
+ * Older packets are discarded. If the FIFO has overflowed it's reset, since
+ * packet alignment is lost.
+ * @param packet Buffer of MPU6050_DMP_PACKET_SIZE bytes
+ * @return true if a packet was read
+ */
+bool MPU6050_dmpReadPacket(uint8_t *packet);
+
+/** Get the orientation quaternion of a DMP packet.
+ * @param packet DMP packet
+ * @param q w, x, y, z (unit quaternion)
+ */
+void MPU6050_dmpGetQuaternion(const uint8_t *packet, float *q);
+
+/** Get the raw accel and gyro readings of a DMP packet.
+ * @param packet DMP packet
+ * @param frame Accel and gyro readings
+ */
+void MPU6050_dmpGetFrame(const uint8_t *packet, mpu6050_frame_t *frame);
+#endif /* MPU6050_INCLUDE_DMP_MOTIONAPPS20 */
+
 // WHO_AM_I register
 /** Get Device ID.
  * This register is used to verify the identity of the device (0b110100, 0x34).
@@ -0,0 +1,123 @@
+#ifndef NEOPIXEL_EFFECTS_H
+#define NEOPIXEL_EFFECTS_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup NeoPixel_Effects NeoPixel_Effects
+ ** @{ */
+
+/** \brief Animated effects for the stripe handled by "neopixel_stripe.h".
+ *
+ * @note A single periodic timer (esp_timer) computes a frame of the active
+ * effect in the back buffer and starts its non-blocking transmission
+ * (NeoPixelShow). The timer only runs while an effect is active: functions
+ * that start an effect return immediately and replace the previous one, whose
+ * first frame is shown on the next timer period.
+ *
+ * @note Frames are computed incrementally in fixed point: fades and decays
+ * scale the colors with a 16 bits time fraction and the rainbow advances the
+ * hue of each pixel with one addition (NeoPixelHSV2Color).
+ *
+ * @note The stripe must be initialized with NeoPixelInit first. Functions in
+ * "neopixel_stripe.h" that update the stripe shouldn't be used while an effect
+ * is active.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Frames skipped while a long stripe is streamed						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "neopixel_stripe.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Effects
+ */
+typedef enum {
+	NEOPIXEL_EFFECT_NONE,		/*!< No effect active */
+	NEOPIXEL_EFFECT_FADE,		/*!< All pixels fade from one color to another */
+	NEOPIXEL_EFFECT_CHASE,		/*!< Segment of pixels moving along the stripe */
+	NEOPIXEL_EFFECT_FLASH,		/*!< All pixels lit and decaying to off (i.e. hit feedback) */
+	NEOPIXEL_EFFECT_RAINBOW,	/*!< Rotating rainbow */
+} neopixel_effect_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Effects engine initialization.
+ * 
+ * @param frame_rate    Frames per second computed while an effect is active (1 to 1000)
+ * @return true if the timer was created
+ */
+bool NeoPixelEffectsInit(uint16_t frame_rate);
+
+/**
+ * @brief Fade all the pixels from a color to another one (the last color is kept).
+ * 
+ * @param from          Initial 24 bits color
+ * @param to            Final 24 bits color
+ * @param duration_ms   Fade duration (ms)
+ */
+void NeoPixelEffectFade(neopixel_color_t from, neopixel_color_t to, uint16_t duration_ms);
+
+/**
+ * @brief Move a segment of pixels along the stripe (until stopped).
+ * 
+ * @param color         24 bits color of the segment
+ * @param background    24 bits color of the rest of the pixels
+ * @param lenght        Pixels of the segment
+ * @param step_ms       Time between steps of one pixel (ms)
+ * @param upwards       Direction: true: upwards, false: downwards
+ */
+void NeoPixelEffectChase(neopixel_color_t color, neopixel_color_t background, uint16_t lenght, uint16_t step_ms, bool upwards);
+
+/**
+ * @brief Light all the pixels and decay them to off.
+ * 
+ * @note Intensity decays with the square of the remaining time, so it falls fast
+ * at first and slowly at the end. A new flash restarts the effect.
+ * @param color         24 bits color
+ * @param decay_ms      Time until the pixels are off (ms)
+ */
+void NeoPixelEffectFlash(neopixel_color_t color, uint16_t decay_ms);
+
+/**
+ * @brief Rotate a rainbow along the stripe (until stopped).
+ * 
+ * @param hue_step      Hue (HSV color model) advanced on each frame
+ * @param sat           Color saturation of all the NeoPixels (HSV color model)
+ * @param val           Color value or brightness of all the NeoPixels (HSV color model)
+ * @param reps          Number of repetitions of the color pattern
+ */
+void NeoPixelEffectRainbow(uint16_t hue_step, uint8_t sat, uint8_t val, uint8_t reps);
+
+/**
+ * @brief Stop the active effect (pixels keep the last frame).
+ * 
+ */
+void NeoPixelEffectStop(void);
+
+/**
+ * @brief Effect active.
+ * 
+ * @return neopixel_effect_t Effect (NEOPIXEL_EFFECT_NONE once a fade or a flash finishes)
+ */
+neopixel_effect_t NeoPixelEffectActive(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
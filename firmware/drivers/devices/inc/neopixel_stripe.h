@@ -9,8 +9,19 @@
 
 /** \brief NeoPixel driver for the ESP-EDU Board.
  *
- * @note This driver can handle only one stripe of NeoPixel at a time
- * (with no limits in the qty of leds in the array).
+ * @note This driver can handle only one stripe of NeoPixel at a time.
+ * 
+ * @note Frames are transmitted in background: functions that update the stripe
+ * encode the colors in one of two frame buffers and return while the frame is
+ * transmitted from it (they only wait if the previous frame isn't finished).
+ * To update many pixels with a single transmission, modify the color array
+ * passed to NeoPixelInit (back buffer) and then call NeoPixelShow.
+ * 
+ * @note Stripes longer than WS2812B_MAX_LEDS have no frame buffers: frames are
+ * encoded from the color array while they are transmitted (see
+ * ws2812bSendColors), so they only need the RAM of their colors. The array
+ * passed to the update functions (i.e. the back buffer) must then not be
+ * modified until the transmission finishes (NeoPixelBusy, NeoPixelWait).
  * 
  * @note ESP-EDU have one individual NeoPixel connected to GPIO_8, that can be used with this driver.
  * 
@@ -21,14 +32,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Non-blocking frame update (NeoPixelShow)								|
+ * | 14/10/2026 | Gamma and brightness lookup table									|
+ * | 14/10/2026 | Back buffer access for "neopixel_effects.h"							|
+ * | 15/10/2026 | Long stripes streamed from the color array								|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
+#include "ws2812b.h"
 /*==================[macros]=================================================*/
 #define BUILT_IN_RGB_LED_PIN          GPIO_8        /*> ESP32-C6-DevKitC-1 NeoPixel it's connected at GPIO_8 */
 #define BUILT_IN_RGB_LED_LENGTH       1             /*> ESP32-C6-DevKitC-1 NeoPixel has one pixel */
@@ -78,7 +95,7 @@ typedef uint32_t neopixel_color_t;
  * 
  * @param pin           GPIO number where NeoPixel data pin (DIN) will be connected
  * @param len           Number of NeoPixels in the stripe
- * @param color_array   Array of len length, to store each NeoPixel color
+ * @param color_array   Array of len length, to store each NeoPixel color (back buffer)
  */
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array);
 
@@ -110,6 +127,52 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color);
  */
 void NeoPixelSetArray(neopixel_color_t *color_array);
 
+/**
+ * @brief Start the transmission of the colors of the color array passed to NeoPixelInit.
+ * 
+ * @note The colors are copied to a frame buffer (with brightness and gamma
+ * correction applied), so the color array can be modified as soon as it returns.
+ */
+void NeoPixelShow(void);
+
+/**
+ * @brief Color array passed to NeoPixelInit (back buffer).
+ * 
+ * @return neopixel_color_t* Color array
+ */
+neopixel_color_t * NeoPixelGetArray(void);
+
+/**
+ * @brief Number of NeoPixels transmitted (stripe length).
+ * 
+ * @return uint16_t Number of NeoPixels
+ */
+uint16_t NeoPixelGetLength(void);
+
+/**
+ * @brief Set a function to be called when a frame transmission finishes.
+ * 
+ * @note It's called from the RMT interrupt (it must be short and placed
+ * in IRAM, i.e. notify a task).
+ * 
+ * @param func_p    Function (NULL to disable)
+ * @param param_p   Parameter passed to func_p
+ */
+void NeoPixelShowCallback(void (*func_p)(void *param), void *param_p);
+
+/**
+ * @brief Frame transmission in progress.
+ * 
+ * @return true if a frame is being transmitted
+ */
+bool NeoPixelBusy(void);
+
+/**
+ * @brief Wait for the frame transmission in progress to finish.
+ * 
+ */
+void NeoPixelWait(void);
+
 /**
  * @brief Shift the all NeoPixel colors in the array 1 position (up or down)
  * 
@@ -122,6 +185,9 @@ void NeoPixelShift(bool upwards);
  * @brief Change NeoPixel brightness.
  * 
  * @note: by default NeoPixels bright is at maximum (255)
+ * @note: a table of the 256 levels with brightness and gamma correction is
+ * rebuilt when the brightness changes, so frames are encoded with one lookup
+ * per color component.
  * @param bright Brightness level (0 to 255).
  */
 void NeoPixelBrightness(uint8_t bright);
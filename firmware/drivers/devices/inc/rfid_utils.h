@@ -16,6 +16,18 @@
 
 #include "MFRC522.h"
 
+/**
+ * Card session: keeps the sector authenticated between block accesses, so a
+ * read-modify-write or a multi-block transfer in the same sector authenticates
+ * only once. Start it after PICC_ReadCardSerial, end it with rfidSessionEnd
+ * (card halted and encryption stopped).
+ */
+typedef struct {
+	MFRC522Ptr_t mfrc;	// Reader
+	MIFARE_Key key;		// Key A of the sectors accessed
+	int16_t sector;		// Sector authenticated, -1 if none
+} rfid_session_t;
+
 /**
  * Setup an MFRC522_T instance and pin configurations. 
  * Tailored to LPCXpresso4337, to be used in other boards check pin configuration and SPI settings. 
@@ -41,4 +53,54 @@ int readCardBalance(MFRC522Ptr_t mfrc522);
  */
 int writeCardBalance(MFRC522Ptr_t mfrc522, int newBalance);
 
+/**
+ * Example function to add (or subtract) an amount to the card balance, with a
+ * single authentication for the read and the write
+ * @param  mfrc522    mfrc522 MFRC522 ADT pointer
+ * @param  delta      Amount to add to the balance
+ * @param  newBalance Out: balance written (can be NULL)
+ * @return            0 if no errors
+ */
+int updateCardBalance(MFRC522Ptr_t mfrc522, int delta, int *newBalance);
+
+/**
+ * Start a card session on the selected card (see PICC_ReadCardSerial)
+ * @param session Session to start
+ * @param mfrc522 MFRC522 ADT pointer
+ * @param key     Key A of the sectors, NULL for the factory default FFFFFFFFFFFFh
+ */
+void rfidSessionBegin(rfid_session_t *session, MFRC522Ptr_t mfrc522,
+					  const MIFARE_Key *key);
+
+/**
+ * Read consecutive blocks, authenticating each sector only if it's not the
+ * one already authenticated
+ * @param  session   Card session
+ * @param  blockAddr First block, 0 to 255
+ * @param  data      Out: 16 bytes per block
+ * @param  blocks    Number of blocks to read
+ * @return           0 is no error, -1 is authentication error -2 is read error
+ */
+int rfidSessionRead(rfid_session_t *session, uint8_t blockAddr, uint8_t *data,
+					uint8_t blocks);
+
+/**
+ * Write consecutive data blocks, authenticating each sector only if it's not
+ * the one already authenticated. Sector trailers are not written.
+ * @param  session   Card session
+ * @param  blockAddr First block, 0 to 255
+ * @param  data      16 bytes per block
+ * @param  blocks    Number of blocks to write
+ * @return           0 is no error, -1 is authentication error -2 is write
+ *                   error, -3 if a block is a sector trailer
+ */
+int rfidSessionWrite(rfid_session_t *session, uint8_t blockAddr,
+					 const uint8_t *data, uint8_t blocks);
+
+/**
+ * End a card session: halt the card and stop the encryption
+ * @param session Card session
+ */
+void rfidSessionEnd(rfid_session_t *session);
+
 #endif
@@ -10,6 +10,11 @@
 /** \brief Servo driver for the ESP-EDU Board.
  *
  * @note This driver can handle up to 4 SG90 microservos.
+ *
+ * @note ServoMove sets the angle at once. ServoMoveSmooth moves the servo to
+ * the angle with limited speed and acceleration (trapezoidal profile, see
+ * "motion.h"), updating the pulse width on every PWM frame from a timer: 
+ * several servos can move at the same time without blocking the caller.
  * 
  * @author Albano Peñalva
  *
@@ -18,6 +23,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/01/2024 | Document creation		                         						|
+ * | 14/10/2026 | Highest PWM resolution and smooth moves (motion planner)				|
  * 
  **/
 
@@ -55,6 +61,32 @@ uint8_t ServoInit(servo_out_t servo, gpio_t gpio);
  */
 void ServoMove(servo_out_t servo, int8_t ang);
 
+/**
+ * @brief Move the servo to an angle with limited speed and acceleration 
+ * (returns immediately, a new move replaces the previous one).
+ * 
+ * @param servo Servo number
+ * @param ang Servo angle (from -90 to 90 degrees)
+ */
+void ServoMoveSmooth(servo_out_t servo, int8_t ang);
+
+/**
+ * @brief Change the limits of the smooth moves (default: 180 degrees/s, 720 degrees/s^2).
+ * 
+ * @param servo Servo number
+ * @param speed Max speed (degrees/s)
+ * @param accel Acceleration and deceleration (degrees/s^2)
+ */
+void ServoSetSpeed(servo_out_t servo, uint16_t speed, uint16_t accel);
+
+/**
+ * @brief Check if a smooth move is in progress.
+ * 
+ * @param servo Servo number
+ * @return true The servo didn't reach the angle
+ */
+bool ServoBusy(servo_out_t servo);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
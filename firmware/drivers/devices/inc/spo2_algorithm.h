@@ -80,11 +80,82 @@
 
 //uch_spo2_table is approximated as  -45.060*ratioAverage* ratioAverage + 30.354 *ratioAverage + 94.845 ;
 
-static  int32_t an_x[ BUFFER_SIZE]; //ir
-static  int32_t an_y[ BUFFER_SIZE]; //red
+/**
+* \brief        Window algorithm configuration (one per instance)
+* \par          Details
+*               Longer windows average more beats (better accuracy, more latency). At sampling
+*               frequencies above FreqS the valley distance scales with it (4 samples at 25 Hz).
+*/
+typedef struct {
+  int32_t n_sample_rate;    // sampling frequency (Hz)
+  int32_t n_buffer_size;    // window length (samples)
+  int32_t n_min_distance;   // minimum distance between valleys (samples)
+  int32_t *pn_x;            // rings of n_buffer_size raw samples: ir
+  int32_t *pn_y;            // red
+} maxim_spo2_config_t;
+
+/**
+* \brief        Sliding window state
+* \par          Details
+*               New samples overwrite the oldest ones in the rings of the configuration and
+*               update a running sum of the IR window, so each batch costs its own length and
+*               the window is never shifted or copied.
+*/
+typedef struct {
+  maxim_spo2_config_t s_cfg;
+  int32_t n_head;           // oldest sample in the rings
+  int32_t n_count;          // samples in the window (up to n_buffer_size)
+  uint32_t un_ir_sum;       // running sum of the IR window (DC mean)
+} maxim_spo2_window_t;
+
+#define HR_SPO2_HISTORY 8     // raw samples kept to locate valleys (power of 2, > MA4_SIZE + flat valleys)
+#define HR_SPO2_INTERVALS 4   // beat intervals averaged for the heart rate
+#define HR_SPO2_RATIOS 5      // beat ratios for the SpO2 median (as in the window algorithm)
+
+/**
+* \brief        Incremental heart rate/SpO2 estimator state
+* \par          Details
+*               Same steps as maxim_heart_rate_and_oxygen_saturation, updated sample by sample:
+*               IR DC is a running mean, valleys are detected on the 4 point moving average as
+*               they pass and each beat adds one interval and one AC/DC ratio to short histories.
+*/
+typedef struct {
+  int32_t n_sample_rate;                    // sampling frequency (Hz)
+  int32_t n_dc_shift;                       // IR DC running mean time constant (2^n samples, about 1 s)
+  int32_t n_ir_dc;                          // IR DC << n_dc_shift
+  int32_t n_th;                             // running mean of the smoothed signal (valley threshold)
+  int32_t an_ma4[MA4_SIZE];                 // last inverted, DC free IR samples
+  int32_t n_ma4_sum;
+  int32_t n_ma4_prev;                       // previous moving average output
+  int32_t n_cand_loc;                       // left edge of the valley in progress (-1: none)
+  int32_t n_cand_val;
+  uint32_t aun_ir[HR_SPO2_HISTORY];         // last raw samples
+  uint32_t aun_red[HR_SPO2_HISTORY];
+  int32_t n_count;                          // samples processed
+  int32_t n_valley_loc;                     // last valley (-1: none)
+  uint32_t un_valley_ir, un_valley_red;     // raw samples at the last valley
+  uint32_t un_ir_max, un_red_max;           // raw maxima since the last valley
+  int32_t n_ir_max_loc, n_red_max_loc;
+  int32_t an_interval[HR_SPO2_INTERVALS];   // last beat intervals (samples)
+  int32_t n_interval_count;
+  int32_t an_ratio[HR_SPO2_RATIOS];         // last beat ratios
+  int32_t n_ratio_count;
+  int32_t n_heart_rate;                     // results (-999 if not valid)
+  int8_t ch_hr_valid;
+  int32_t n_spo2;
+  int8_t ch_spo2_valid;
+} maxim_hr_spo2_t;
 
 
 void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
+void maxim_heart_rate_and_oxygen_saturation_config(const maxim_spo2_config_t *ps_cfg, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
+
+void maxim_spo2_window_init(maxim_spo2_window_t *ps_win, const maxim_spo2_config_t *ps_cfg);
+void maxim_spo2_window_push(maxim_spo2_window_t *ps_win, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t n_length);
+void maxim_spo2_window_calc(const maxim_spo2_window_t *ps_win, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
+
+void maxim_hr_spo2_init(maxim_hr_spo2_t *ps_est, int32_t n_sample_rate);
+void maxim_hr_spo2_update(maxim_hr_spo2_t *ps_est, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t n_length);
 
 
 void maxim_find_peaks(int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height, int32_t n_min_distance, int32_t n_max_num);
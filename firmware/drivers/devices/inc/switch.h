@@ -12,6 +12,12 @@
  * @note ESP-EDU have 2 switches connected to GPIO_4 and GPIO_15. 
  * The latter is also routed to J2 connector.
  *
+ * @note SwitchesEventsInit debounces both switches: an edge interrupt saves
+ * the time of the edge and a timer checks, once the switch has been stable for
+ * the debounce time, if its state changed. Press, release and long press events
+ * are posted to a queue, so tasks block on SwitchesWaitEvent instead of
+ * polling SwitchesRead. It replaces the SwitchActivInt callbacks.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,19 +25,40 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Debounced press/release/long press events								|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
 /*==================[macros]=================================================*/
+#define SWITCH_EVENT_QUEUE	8	/*!< Events stored while no task reads them */
 
 /*==================[typedef]================================================*/
 typedef enum switches {
     SWITCH_1 = (1 << 0),  /**< Routed to GPIO_4 */
     SWITCH_2 = (1 << 1),  /**< Routed to GPIO_15 */
 } switch_t;
+
+/**
+ * @brief Switch events
+ */
+typedef enum {
+	SWITCH_PRESSED,		/**< Switch pressed (stable for the debounce time) */
+	SWITCH_RELEASED,	/**< Switch released (stable for the debounce time) */
+	SWITCH_LONG_PRESS,	/**< Switch still pressed after the long press time */
+} switch_event_type_t;
+
+/**
+ * @brief Switch event
+ */
+typedef struct {
+	switch_t sw;				/**< Switch */
+	switch_event_type_t type;	/**< Event */
+	int64_t time;				/**< Time of the last edge before the event (usec since boot) */
+} switch_event_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -58,6 +85,26 @@ int8_t SwitchesRead(void);
  */
 void SwitchActivInt(switch_t tec, void *ptrIntFunc, void *args);
 
+/**
+ * @brief Enables the debounced events of both switches
+ * 
+ * @param debounce_ms Time the switch must be stable to report a change (msec)
+ * @param long_press_ms Time pressed to report a long press (msec, 0: no long press events)
+ * @return true Events enabled
+ * @return false No memory for the queue or the timers
+ */
+bool SwitchesEventsInit(uint16_t debounce_ms, uint16_t long_press_ms);
+
+/**
+ * @brief Waits for a switch event
+ * 
+ * @param event Event received
+ * @param ticks_to_wait Max time to wait (portMAX_DELAY: forever)
+ * @return true Event received
+ * @return false Timeout (or events not enabled)
+ */
+bool SwitchesWaitEvent(switch_event_t *event, TickType_t ticks_to_wait);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
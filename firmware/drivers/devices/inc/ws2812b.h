@@ -11,6 +11,18 @@
 /** \brief Driver for handling WS2812B RGB leds.
  *
  * @note For handling NeoPixels arrays use "neopixel_stripe.h".
+ *
+ * @note Bits are generated by the RMT peripheral: ws2812bSend only queues the
+ * color of a led in a frame buffer and ws2812bSendRet starts the transmission of
+ * the frame followed by the ret command, then returns. The RMT memory is refilled
+ * from its interrupt, so the CPU is free while the frame is transmitted and the
+ * bit timing is not affected by other interrupts.
+ *
+ * @note ws2812bSendColors streams a frame of any length without a frame buffer:
+ * an RMT encoder converts each color (through a level table) to its bits when
+ * the interrupt refills the channel memory, so only the RMT memory and the
+ * color array are needed (i.e. 1000 leds take the 4000 bytes of their colors
+ * instead of 96 KB of RMT symbols, or 3 KB of G, R and B bytes).
  * 
  * @author Albano Peñalva
  *
@@ -19,15 +31,21 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | RMT transmission in background instead of NOP timed bit-bang			|
+ * | 14/10/2026 | End of transmission callback											|
+ * | 15/10/2026 | Streaming encoder of color arrays (ws2812bSendColors)					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+/** @brief Maximum number of leds of a frame queued with ws2812bSend */
+#define WS2812B_MAX_LEDS	256
 
 /*==================[typedef]================================================*/
 /**
@@ -51,18 +69,79 @@ typedef struct rgb_led{
 void ws2812bInit(gpio_t pin);
 
 /**
- * @brief Send color information to NeoPixel.
+ * @brief Queue color information of the next NeoPixel of the frame.
+ * 
+ * @note The first color of a frame waits for the previous frame to finish.
+ * Colors beyond WS2812B_MAX_LEDS are discarded.
  * 
  * @param data NeoPixel color
  */
 void ws2812bSend(rgb_led_t led_color);
 
 /**
- * @brief Send a ret command to NeoPixel.
+ * @brief Start the transmission of the queued colors followed by a ret command.
  * 
+ * @note It doesn't wait for the transmission to finish (does nothing if no color
+ * was queued).
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief Start the transmission of a frame followed by a ret command.
+ * 
+ * @note Bytes are sent as they are (no gamma correction) and the buffer must not
+ * be modified until the transmission finishes (see ws2812bWait).
+ * 
+ * @param grb Green, red and blue bytes of each led
+ * @param leds Number of leds
+ */
+void ws2812bSendFrame(const uint8_t *grb, uint16_t leds);
+
+/**
+ * @brief Start the transmission of a frame encoded from an array of colors,
+ * followed by a ret command.
+ * @note The colors are read while the frame is transmitted (from the RMT
+ * interrupt): the array and the table must not be modified until the
+ * transmission finishes (see ws2812bWait). It waits for the previous frame.
+ * @param colors Color of each led (0x00RRGGBB), NULL to turn all the leds off
+ * @param leds Number of leds (no limit)
+ * @param lut Level sent for each value of a component (NULL: gamma correction)
+ */
+void ws2812bSendColors(const uint32_t *colors, uint16_t leds, const uint8_t *lut);
+
+/**
+ * @brief Transmission in progress.
+ * 
+ * @return true if a frame is being transmitted
+ */
+bool ws2812bBusy(void);
+
+/**
+ * @brief Set a function to be called when the transmission of all the frames
+ * started finishes.
+ * 
+ * @note It's called from the RMT interrupt (it must be short and placed
+ * in IRAM, i.e. notify a task).
+ * 
+ * @param func_p Function (NULL to disable)
+ * @param param_p Parameter passed to func_p
+ */
+void ws2812bSetDoneCallback(void (*func_p)(void *param), void *param_p);
+
+/**
+ * @brief Gamma correction of a color component (as applied by ws2812bSend).
+ * 
+ * @param component Color level (0 to 255)
+ * @return uint8_t Corrected level
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
+/**
+ * @brief Wait for the transmission in progress to finish.
+ * 
+ */
+void ws2812bWait(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -11,11 +11,13 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261014 v0.0.2 modo continuo de los tres ejes y lectura por bloques en g
  * 20210609 v0.0.1 initials initial version
  */
 
 /*==================[inclusions]=============================================*/
 #include "ADXL335.h"
+#include <stddef.h>
 
 /*==================[macros and definitions]=================================*/
 /** @def MAX_VOLTAGE
@@ -34,6 +36,14 @@
  * @brief Valor de la sensibilidad dado por el driver
  */
 #define SENSITIVITY 300.0
+/** @def Z_DIVIDER
+ * @brief Factor del divisor resistivo del canal z (compartido con el HC-SR04)
+ */
+#define Z_DIVIDER 4
+/** @def AXIS_NUM
+ * @brief Cantidad de ejes
+ */
+#define AXIS_NUM 3
 
 /*==================[internal data declaration]==============================*/
 
@@ -41,6 +51,11 @@ bool conversion; /**< booleando si realiza o no la conversión*/
 uint16_t valor; /**< Valor convertido*/
 uint8_t canal; /**< Canal de la placa*/
 
+static const adc_ch_t axis_ch[AXIS_NUM] = {CH1, CH2, CH3}; /**< Canal de cada eje*/
+static const float divider[AXIS_NUM] = {1, 1, Z_DIVIDER}; /**< Divisor resistivo de cada eje*/
+static float zero_g_mv[AXIS_NUM] = {OFFSET, OFFSET, OFFSET}; /**< Tensión a 0 g de cada eje (en mV)*/
+static float inv_sensitivity[AXIS_NUM] = {1.0 / SENSITIVITY, 1.0 / SENSITIVITY, 1.0 / SENSITIVITY}; /**< Inversa de la sensibilidad de cada eje (en g/mV)*/
+
 /*==================[internal functions declaration]=========================*/
 
 /**@fn float UnitConvert(uint16_t value)
@@ -102,12 +117,70 @@ float ReadYValue(){
 
 int ReadZValueInt(){
     AnalogInputReadSingle(my_ad_z.input, &valor);
-	return valor*4; /* Resistor divider for HCSR-04 */
+	return valor*Z_DIVIDER; /* Resistor divider for HCSR-04 */
 }
 
 float ReadZValue(){
 	AnalogInputReadSingle(my_ad_z.input, &valor);
-	return UnitConvert(valor*4); /* Resistor divider for HCSR-04 */
+	return UnitConvert(valor*Z_DIVIDER); /* Resistor divider for HCSR-04 */
+}
+
+bool ADXL335InitContinuous(uint32_t sample_frec, uint16_t frame_size, void *func_p, void *param_p){
+	bool lut = true;
+	analog_input_config_t config = {CH1, ADC_CONTINUOUS, func_p, param_p, sample_frec, frame_size, 0};
+	for(uint8_t i = 0; i < AXIS_NUM; i++){
+		config.input = axis_ch[i];
+		AnalogInputInit(&config);
+	}
+	/* Tablas de calibración: la conversión de cada muestra es una lectura indexada */
+	for(uint8_t i = 0; i < AXIS_NUM; i++){
+		lut &= AnalogInputLUTInit(axis_ch[i]);
+	}
+	return lut;
+}
+
+void ADXL335StartContinuous(void){
+	/* Se barren todos los canales inicializados en modo continuo */
+	AnalogStartContinuous(CH1);
+}
+
+void ADXL335StopContinuous(void){
+	AnalogStopContinuous(CH1);
+}
+
+uint16_t ADXL335ReadBlock(float *x, float *y, float *z, uint64_t *timestamp){
+	float *values[AXIS_NUM] = {x, y, z};
+	uint16_t lenght = UINT16_MAX;
+	analog_block_t *block = AnalogInputGetBlock();
+	if(block == NULL){
+		return 0;
+	}
+	for(uint8_t i = 0; i < AXIS_NUM; i++){
+		if(block->lenght[axis_ch[i]] < lenght){
+			lenght = block->lenght[axis_ch[i]];
+		}
+	}
+	for(uint8_t i = 0; i < AXIS_NUM; i++){
+		if(values[i] != NULL){
+			/* mV calibrados y luego g */
+			AnalogBlockToFloat(block, axis_ch[i], values[i]);
+			for(uint16_t j = 0; j < lenght; j++){
+				values[i][j] = (values[i][j] * divider[i] - zero_g_mv[i]) * inv_sensitivity[i];
+			}
+		}
+	}
+	if(timestamp != NULL){
+		*timestamp = block->timestamp;
+	}
+	AnalogInputReleaseBlock(block);
+	return lenght;
+}
+
+void ADXL335SetCalibration(adxl335_axis_t axis, float zero_g, float sensitivity){
+	if(axis < AXIS_NUM && sensitivity > 0){
+		zero_g_mv[axis] = zero_g;
+		inv_sensitivity[axis] = 1.0 / sensitivity;
+	}
 }
 
 bool ADXL335DeInit(gpio_t gSelect1, gpio_t gSelect2){
@@ -9,6 +9,8 @@
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
 #include "uart_mcu.h"
+#include "freertos/task.h"
+#include "static_alloc_mcu.h"
 
 
 #define SPI_BR 4000000				/*!< Frequency of sck for SPI communication */
@@ -16,19 +18,30 @@
 // ADT object allocation counter
 static int MFRC_Instance_Counter = 0;
 
+// Scan scheduler
+static MFRC522Ptr_t scan_readers[MFRC_MAX_INSTANCES];
+static uint8_t scan_count;
+static TickType_t scan_period;
+static MFRC522_CardCallback_t scan_func_p;
+static void *scan_param;
+static TaskHandle_t scan_task_handle = NULL;
+static volatile bool scan_running = false;		/* Scan requested */
+static volatile bool scan_busy = false;			/* Scan task in the scan loop */
+STATIC_TASK_DEFINE(scan_task, MFRC_SCAN_TASK_STACK);
+
 
 /*
  * @brief: SPI port configuration compatible with LCD interface
  */
-spi_mcu_config_t spi_conf = {
+static spi_mcu_config_t spi_conf = {
 	.device = 0,
 	.clk_mode = MODE0, 
 	.bitrate = SPI_BR, 
 	.transfer_mode = SPI_POLLING, 
 	.func_p = NULL,
-	.param_p = NULL };
+	.param_p = NULL,
+	.priority = SPI_PRIORITY_HIGH };
 
-static spi_dev_t mfrc522_spi;							/*!< uC SPI port */
 static gpio_t mfrc522_dc, mfrc522_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
 
@@ -39,6 +52,9 @@ MFRC522Ptr_t MFRC522_Init() {
 	// allocate instance struct array
 	static struct MFRC522_T mfrc_Instances[MFRC_MAX_INSTANCES];
 	
+	if (MFRC_Instance_Counter >= MFRC_MAX_INSTANCES) {
+		return NULL;
+	}
 	//		struct MFRC522_T mfrc_struct;
 	//		Chip_SSP_DATA_SETUP_T data_setup;
 
@@ -61,6 +77,43 @@ MFRC522Ptr_t MFRC522_Init() {
 * Basic interface functions for communicating with the MFRC522
 *******************************************************************************/
 
+/**
+ * Selects the SPI device whose hardware CS is the chip select pin, so the
+ * peripheral drives it. Other pins are driven by GPIO around each transfer.
+ */
+static void PCD_SelectSpiDevice(MFRC522Ptr_t mfrc) {
+	mfrc->_hardwareCS = true;
+	switch (mfrc->_chipSelectPin) {
+	case GPIO_19:
+		mfrc->spi_dev = SPI_1;
+		break;
+	case GPIO_18:
+		mfrc->spi_dev = SPI_2;
+		break;
+	case GPIO_9:
+		mfrc->spi_dev = SPI_3;
+		break;
+	default:
+		mfrc->_hardwareCS = false;
+		break;
+	}
+}
+
+/**
+ * One SPI transaction (address + data) of Tx_Buf into Rx_Buf.
+ */
+static void PCD_Transfer(MFRC522Ptr_t mfrc, uint8_t length) {
+	spi_conf.device = mfrc->spi_dev;
+	SpiInit(&spi_conf);
+	if (!mfrc->_hardwareCS) {
+		GPIOOffFast(mfrc->_chipSelectPin); // Select slave
+	}
+	SpiReadWrite(mfrc->spi_dev, mfrc->Tx_Buf, mfrc->Rx_Buf, length);
+	if (!mfrc->_hardwareCS) {
+		GPIOOnFast(mfrc->_chipSelectPin); // Release slave again
+	}
+}
+
 /**
  * Writes a uint8_t to the specified register in the MFRC522 chip.
  * The interface is described in the datasheet section 8.1.2.
@@ -70,25 +123,11 @@ void PCD_WriteRegister(
 	uint8_t reg,  ///< The register to write to. One of the PCD_Register enums.
 	uint8_t value ///< The value to write.
 	) {
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
-	
-	
 	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
 	// 8.1.2.3.
-	// SPI.transfer(reg & 0x7E);
 	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-
-	// SPI.transfer(value);
-	mfrc->Tx_Buf[0] = value;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-	// Release slave again
-    GPIOOn(mfrc522_dc);
-
+	mfrc->Tx_Buf[1] = value;
+	PCD_Transfer(mfrc, 2);
 } // End PCD_WriteRegister()
 
 /**
@@ -101,23 +140,17 @@ void PCD_WriteNRegister(
 	uint8_t count, ///< The number of uint8_ts to write to the register
 	uint8_t *values ///< The values to write. uint8_t array.
 	) {
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
-
-	//	SPI.transfer(reg & 0x7E);
-	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
-	// 8.1.2.3.
-	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-	SpiWrite(mfrc522_spi, values, count);
-	
-	// Release slave again
-    GPIOOn(mfrc522_dc);
-
+	// More than a FIFO of data (never used) is written in several transfers
+	while (count > 0) {
+		uint8_t n = (count < BUFFER_SIZE - 1) ? count : BUFFER_SIZE - 1;
+		// MSB == 0 is for writing. LSB is not used in address. Datasheet
+		// section 8.1.2.3.
+		mfrc->Tx_Buf[0] = (reg & 0x7E);
+		memcpy(&mfrc->Tx_Buf[1], values, n);
+		PCD_Transfer(mfrc, n + 1);
+		values += n;
+		count -= n;
+	}
 } // End PCD_WriteRegister()
 
 /**
@@ -128,29 +161,12 @@ uint8_t PCD_ReadRegister(
 	MFRC522Ptr_t mfrc,
 	uint8_t reg ///< The register to read from. One of the PCD_Register enums.
 	) {
-	uint8_t value;
-
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
-
 	// MSB == 1 is for reading. LSB ==0, not used in address. Datasheet section
-	// 8.1.2.3.
-	//	SPI.transfer(0x80 | (reg & 0x7E));
+	// 8.1.2.3. The value is read back while sending 0 to stop reading.
 	mfrc->Tx_Buf[0] = 0x80 | (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-	// Read the value back. Send 0 to stop reading.
-	//	value = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0x00;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	value = mfrc->Rx_Buf[0];
-
-	// Release slave again
-    GPIOOn(mfrc522_dc);
-	return value;
+	mfrc->Tx_Buf[1] = 0x00;
+	PCD_Transfer(mfrc, 2);
+	return mfrc->Rx_Buf[1];
 } // End PCD_ReadRegister()
 
 /**
@@ -164,69 +180,32 @@ void PCD_ReadNRegister(
 	uint8_t *values, ///< uint8_t array to store the values in.
 	uint8_t rxAlign ///< Only bit positions rxAlign..7 in values[0] are updated.
 	) {
-	//		 rxAlign=0;
-	if (count == 0) {
-		return;
-	}
-	// UartSendString(SERIAL_PORT_PC,F("Reading "));	UartSendString(SERIAL_PORT_PC,count); UartSendString(SERIAL_PORT_PC,F(" uint8_ts from
-	// register."));
 	uint8_t address = 0x80 | (reg & 0x7E); // MSB == 1 is for reading. LSB is
 										   // not used in address. Datasheet
 										   // section 8.1.2.3.
 	uint8_t index = 0;					   // Index in values array.
 
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-
-    // Select slave
-	GPIOOff(mfrc522_dc);
-
-	// One read is performed outside of the loop
-	count--;
-
-	// Tell MFRC522 which address we want to read
-	//	SPI.transfer(address);
-	mfrc->Tx_Buf[0] = address;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-
 	while (index < count) {
-		if (index == 0 &&
-			rxAlign) { // Only update bit positions rxAlign..7 in values[0]
+		uint8_t n = count - index;
+		if (n > BUFFER_SIZE - 1) {
+			n = BUFFER_SIZE - 1;
+		}
+		// The address is sent n times (each byte returns the previous read)
+		// and 0 at the end to stop reading, all in one transfer.
+		memset(mfrc->Tx_Buf, address, n);
+		mfrc->Tx_Buf[n] = 0;
+		PCD_Transfer(mfrc, n + 1);
+		if (index == 0 && rxAlign) { // Only update bit positions rxAlign..7 in values[0]
 			// Create bit mask for bit positions rxAlign..7
-			uint8_t mask = 0;
-			uint8_t i;
-			for (i = rxAlign; i <= 7; i++) {
-				mask |= (1 << i);
-			}
-
-			// Read value and tell that we want to read the same address again.
-			//			uint8_t value = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			uint8_t value = mfrc->Rx_Buf[0];
-
-			// Apply mask to both current value of values[0] and the new data in
-			// value.
-			values[0] = (values[index] & ~mask) | (value & mask);
-		} else { // Normal case
-			// Read value and tell that we want to read the same address again.
-			//				values[index] = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			values[index] = mfrc->Rx_Buf[0];
+			uint8_t mask = (uint8_t)(0xFF << rxAlign);
+			// Apply mask to both current value of values[0] and the new data
+			values[0] = (values[0] & ~mask) | (mfrc->Rx_Buf[1] & mask);
+			memcpy(&values[1], &mfrc->Rx_Buf[2], n - 1);
+		} else {
+			memcpy(&values[index], &mfrc->Rx_Buf[1], n);
 		}
-		index++;
+		index += n;
 	}
-
-	// Read the final uint8_t. Send 0 to stop reading.
-	//	values[index] = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	values[index] = mfrc->Rx_Buf[0];
-
-	// Release slave again
-    GPIOOn(mfrc522_dc);
 } // End PCD_ReadRegister()
 
 /**
@@ -314,17 +293,20 @@ PCD_CalculateCRC(MFRC522Ptr_t mfrc,
  */
 void PCD_Init(MFRC522Ptr_t mfrc) {
 
-	/* SPI configuration */
-	spi_conf.device = mfrc->spi_dev;
-	mfrc522_spi = mfrc->spi_dev;
+	/* SPI configuration: hardware CS if the pin is one of the SPI CS */
+	PCD_SelectSpiDevice(mfrc);
 	/* GPIOs configuration and initialization */
 	mfrc522_dc = mfrc->_chipSelectPin;
 	mfrc522_rst = mfrc->_resetPowerDownPin;
-	GPIOInit(mfrc522_dc, GPIO_OUTPUT);
+	if (!mfrc->_hardwareCS) {
+		GPIOInit(mfrc522_dc, GPIO_OUTPUT);
+	}
 	GPIOInit(mfrc522_rst, GPIO_OUTPUT);
 
 	DelayUs(10);
-	GPIOOn(mfrc522_dc);
+	if (!mfrc->_hardwareCS) {
+		GPIOOn(mfrc522_dc);
+	}
 	
 	if (GPIORead(mfrc522_rst) == false) { // The MFRC522 chip is in power down mode.
 		GPIOOn(mfrc522_rst); // Exit power down mode. This triggers a hard reset.
@@ -437,6 +419,36 @@ void PCD_SetAntennaGain(MFRC522Ptr_t mfrc, uint8_t mask) {
 /*******************************************************************************
 * Functions for communicating with PICCs
 *******************************************************************************/
+/**
+ * IRQ pin interruption: wakes the task waiting in PCD_CommunicateWithPICC.
+ */
+static void IRAM_ATTR PCD_IrqIsr(void *param) {
+	MFRC522Ptr_t mfrc = (MFRC522Ptr_t)param;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	xSemaphoreGiveFromISR(mfrc->_irqSem, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * Waits for the IRQ pin instead of polling ComIrqReg.
+ */
+bool PCD_EnableIrq(MFRC522Ptr_t mfrc, gpio_t irqPin) {
+	if (mfrc->_irqMode) {
+		return true;
+	}
+	mfrc->_irqSem = xSemaphoreCreateBinaryStatic(&mfrc->_irqSemBuffer);
+	if (mfrc->_irqSem == NULL) {
+		return false;
+	}
+	mfrc->_irqPin = irqPin;
+	PCD_WriteRegister(mfrc, ComIEnReg, 0x80); // IRqInv = 1: IRQ pin active low
+	PCD_WriteRegister(mfrc, DivIEnReg, 0x80); // IRQPushPull = 1
+	GPIOInit(irqPin, GPIO_INPUT);
+	GPIOActivInt(irqPin, PCD_IrqIsr, false, mfrc);
+	mfrc->_irqMode = true;
+	return true;
+} // End PCD_EnableIrq()
+
 /**
  * Executes the Transceive command.
  * CRC validation can only be done if backData and backLen are specified.
@@ -511,6 +523,11 @@ StatusCode PCD_CommunicateWithPICC(
 	PCD_WriteRegister(mfrc, CommandReg, PCD_Idle); // Stop any active command.
 	PCD_WriteRegister(mfrc, ComIrqReg,
 					  0x7F); // Clear all seven interrupt request bits
+	if (mfrc->_irqMode) {
+		// IRQ pin low on the success bits or the timer (IRqInv = 1)
+		PCD_WriteRegister(mfrc, ComIEnReg, 0x80 | waitIRq | 0x01);
+		xSemaphoreTake(mfrc->_irqSem, 0); // Discard a previous interruption
+	}
 	PCD_SetRegisterBitMask(mfrc, FIFOLevelReg,
 						   0x80); // FlushBuffer = 1, FIFO initialization
 	PCD_WriteNRegister(mfrc, FIFODataReg, sendLen,
@@ -526,9 +543,20 @@ StatusCode PCD_CommunicateWithPICC(
 	// Wait for the command to complete.
 	// In PCD_Init() we set the TAuto flag in TModeReg. This means the timer
 	// automatically starts when the PCD stops transmitting.
+	if (mfrc->_irqMode) {
+		// The task sleeps until the IRQ pin signals success or the timer
+		xSemaphoreTake(mfrc->_irqSem, pdMS_TO_TICKS(MFRC_IRQ_TIMEOUT_MS));
+		PCD_WriteRegister(mfrc, ComIEnReg, 0x80); // Disable the interrupts
+		n = PCD_ReadRegister(mfrc, ComIrqReg);
+		if (!(n & waitIRq)) {
+			// Timer interrupt - nothing received in 25ms, or no interruption
+			// at all: communication with the MFRC522 might be down.
+			return STATUS_TIMEOUT;
+		}
+	}
 	// Each iteration of the do-while-loop takes 17.86�s.
 	i = 2000;
-	while (1) {
+	while (!mfrc->_irqMode) {
 		n = PCD_ReadRegister(mfrc, ComIrqReg); // ComIrqReg[7..0] bits are: Set1
 											   // TxIRq RxIRq IdleIRq HiAlertIRq
 											   // LoAlertIRq ErrIRq TimerIRq
@@ -2304,3 +2332,64 @@ bool PICC_ReadCardSerial(MFRC522Ptr_t mfrc) {
 	StatusCode result = PICC_Select(mfrc, &(mfrc->uid), 0);
 	return (result == STATUS_OK);
 } // End
+
+/*******************************************************************************
+* Scan scheduler
+*******************************************************************************/
+
+/**
+ * Scan task: readers are scanned in turn, with the antenna on only while
+ * each one looks for a card. The task is created once and waits for the next
+ * MFRC522_StartScan when the scan is stopped (its stack can be static).
+ */
+static void MFRC522_ScanTask(void *param) {
+	while (1) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		TickType_t last_wake = xTaskGetTickCount();
+		while (scan_running) {
+			for (uint8_t i = 0; i < scan_count; i++) {
+				MFRC522Ptr_t mfrc = scan_readers[i];
+				PCD_AntennaOn(mfrc);
+				DelayMs(MFRC_FIELD_ON_MS); // PICC power up
+				if (PICC_IsNewCardPresent(mfrc) && PICC_ReadCardSerial(mfrc)) {
+					scan_func_p(mfrc, scan_param);
+					PICC_HaltA(mfrc);
+					PCD_StopCrypto1(mfrc);
+				}
+				PCD_AntennaOff(mfrc);
+			}
+			vTaskDelayUntil(&last_wake, scan_period);
+		}
+		scan_busy = false;
+	}
+}
+
+bool MFRC522_StartScan(MFRC522Ptr_t *readers, uint8_t count, uint16_t period_ms,
+					   MFRC522_CardCallback_t func_p, void *param) {
+	if (scan_busy || count == 0 ||
+		count > MFRC_MAX_INSTANCES || func_p == NULL) {
+		return false;
+	}
+	for (uint8_t i = 0; i < count; i++) {
+		scan_readers[i] = readers[i];
+		PCD_AntennaOff(readers[i]);
+	}
+	scan_count = count;
+	scan_period = pdMS_TO_TICKS(period_ms) > 0 ? pdMS_TO_TICKS(period_ms) : 1;
+	scan_func_p = func_p;
+	scan_param = param;
+	if (scan_task_handle == NULL &&
+		STATIC_TASK_CREATE(scan_task, MFRC522_ScanTask, "mfrc522_scan", NULL,
+						   MFRC_SCAN_TASK_PRIO, &scan_task_handle) != pdPASS) {
+		scan_task_handle = NULL;
+		return false;
+	}
+	scan_busy = true;
+	scan_running = true;
+	xTaskNotifyGive(scan_task_handle);
+	return true;
+}
+
+void MFRC522_StopScan(void) {
+	scan_running = false;
+}
@@ -50,6 +50,7 @@
  * -----------------------------------------------------------
  * 20210901 v0.1 initials initial version Maria Casablanca
  * 20242703 v1.1 converted to ESP IDF by JC
+ * 20261014 v1.2 continuous mode with filtered cached values
  */
 
 /*==================[inclusions]=============================================*/
@@ -58,16 +59,28 @@
 #include "gpio_mcu.h"
 #include <stdio.h>
 #include <stdint.h>
+#include "esp_timer.h"
 
 /*==================[macros and definitions]=================================*/
 
 #define V_REF 3.3                /**< Tensión de referencia*/
 #define TOTAL_BITS 1024          /**< Cantidad total de bits*/
+#define CONT_SAMPLE_FREC 1000    /**< Frecuencia de muestreo por canal en modo continuo (Hz)*/
+#define CONT_OVERSAMPLING 16     /**< Sobremuestreo en modo continuo*/
+#define CONT_FRAME_SIZE 16       /**< Muestras por canal en cada frame DMA*/
+#define CONT_UPDATE_US 50000     /**< Periodo de actualización de los valores filtrados (us)*/
 
 /*==================[internal data declaration]==============================*/
 
 analog_input_config_t temp_config;
 analog_input_config_t hum_config;
+static esp_timer_handle_t si7007_timer = NULL;
+static volatile bool si7007_continuous = false;
+static volatile float temp_filtered;      /**< Última temperatura filtrada (°C)*/
+static volatile float hum_filtered;       /**< Última humedad filtrada (%)*/
+static float filter_alpha;
+static bool filter_ready;
+static float block_mv[ADC_CONT_MAX_FRAME_SIZE];
 
 /*==================[internal functions declaration]=========================*/
 
@@ -76,6 +89,51 @@ analog_input_config_t hum_config;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static float Si7007Temperature(float mv){
+	return -46.85 + ((mv/1000.0)/V_REF)*175.71;
+}
+
+static float Si7007Humidity(float mv){
+	return -6 + ((mv/1000.0)/V_REF)*125;
+}
+
+/**
+ * @brief Mean of the samples of a channel of a block (in mV)
+ */
+static bool Si7007BlockMean(analog_block_t *block, adc_ch_t channel, float *mean){
+	uint16_t lenght = block->lenght[channel];
+	float sum = 0;
+	if(lenght == 0){
+		return false;
+	}
+	AnalogBlockToFloat(block, channel, block_mv);
+	for(uint16_t i = 0; i < lenght; i++){
+		sum += block_mv[i];
+	}
+	*mean = sum / lenght;
+	return true;
+}
+
+/**
+ * @brief Periodic update of the filtered values from the converted DMA frames
+ */
+static void Si7007Update(void *param){
+	analog_block_t *block;
+	float mv;
+	while((block = AnalogInputGetBlock()) != NULL){
+		if(Si7007BlockMean(block, temp_config.input, &mv)){
+			// first order low pass filter, the first value initializes it
+			float temp = Si7007Temperature(mv);
+			temp_filtered = filter_ready ? temp_filtered + filter_alpha * (temp - temp_filtered) : temp;
+		}
+		if(Si7007BlockMean(block, hum_config.input, &mv)){
+			float hum = Si7007Humidity(mv);
+			hum_filtered = filter_ready ? hum_filtered + filter_alpha * (hum - hum_filtered) : hum;
+			filter_ready = true;
+		}
+		AnalogInputReleaseBlock(block);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -96,32 +154,82 @@ bool Si7007Init(Si7007_config *pins){
 	return true;
 }
 
+bool Si7007InitContinuous(Si7007_config *pins, uint16_t filter_ms){
+	if(si7007_continuous){
+		return true;
+	}
+	GPIOInit(pins->select, GPIO_OUTPUT);
+	GPIOOn(pins->select); //Lo pongo en 1 para que PWM 2 sea temperatura y PWM 1 humedad.
+
+	analog_input_config_t cont_config = {
+		.mode = ADC_CONTINUOUS,
+		.func_p = NULL,
+		.param_p = NULL,
+		.sample_frec = CONT_SAMPLE_FREC,
+		.frame_size = CONT_FRAME_SIZE,
+		.oversampling = CONT_OVERSAMPLING,
+	};
+	temp_config = cont_config;
+	temp_config.input = pins->PWM_2;
+	hum_config = cont_config;
+	hum_config.input = pins->PWM_1;
+	AnalogInputInit(&temp_config);
+	AnalogInputInit(&hum_config);
+	// calibrated mV from a lookup table, if there is memory for it
+	AnalogInputLUTInit(temp_config.input);
+	AnalogInputLUTInit(hum_config.input);
+
+	// filter coefficient for a time constant of filter_ms at the update rate
+	filter_alpha = (float)(CONT_UPDATE_US / 1000) / (filter_ms + CONT_UPDATE_US / 1000);
+	filter_ready = false;
+	if(si7007_timer == NULL){
+		esp_timer_create_args_t timer_args = {
+			.callback = Si7007Update,
+			.name = "si7007"
+		};
+		if(esp_timer_create(&timer_args, &si7007_timer) != ESP_OK){
+			return false;
+		}
+	}
+	AnalogStartContinuous(temp_config.input);
+	esp_timer_start_periodic(si7007_timer, CONT_UPDATE_US);
+	si7007_continuous = true;
+	return true;
+}
+
+bool Si7007Ready(void){
+	return !si7007_continuous || filter_ready;
+}
+
 float Si7007MeasureTemperature(void){
 
 	uint16_t value;
-	float temperature = 0;
-	float valor = 0;
 	
+	if(si7007_continuous){
+		return temp_filtered;
+	}
 	AnalogInputReadSingle(temp_config.input, &value);
-	valor = (value/1000.0)/V_REF;
-	temperature = -46.85 + (valor*175.71);
-	return temperature;
+	return Si7007Temperature(value);
 
 }
 
 float Si7007MeasureHumidity(void){
 
 	uint16_t value;
-	float humidity = 0;
-	float valor = 0;
 	
+	if(si7007_continuous){
+		return hum_filtered;
+	}
 	AnalogInputReadSingle(hum_config.input, &value);
-	valor = (value/1000.0)/V_REF;
-	humidity = -6 + (valor*125);
-	return humidity;
+	return Si7007Humidity(value);
 }
 
 bool Si7007Deinit(Si7007_config *pins){
+	if(si7007_continuous){
+		esp_timer_stop(si7007_timer);
+		AnalogStopContinuous(temp_config.input);
+		si7007_continuous = false;
+	}
 	return true;
 }
 
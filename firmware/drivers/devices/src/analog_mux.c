@@ -0,0 +1,162 @@
+/**
+ * @file analog_mux.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "analog_mux.h"
+#include <string.h>
+#include "gpio_fast_out_mcu.h"
+#include "time_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define RAW_TO_MV			(3300.0f / 4095.0f)		/*!< Raw to mV conversion (without calibration) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Select a channel of the mux
+ */
+static void AnalogMuxSelect(analog_mux_t *mux, uint8_t channel){
+	GPIOFastBundleWrite(mux->bundle, mux->channels - 1, channel);
+	mux->select_time = TimeNowUs();
+}
+
+/**
+ * @brief Convert every channel of the mux, selecting the next one right after each conversion
+ */
+static void AnalogMuxScan(analog_mux_t *mux){
+	analog_mux_block_t *block = &mux->blocks[mux->written % ANALOG_MUX_BLOCK_RING_SIZE];
+	if(mux->index == 0){
+		block->timestamp = TimerHandleGetAlarmTime(mux->timer);
+	}
+	for(uint8_t ch = 0; ch < mux->channels; ch++){
+		// only the part of the settling time not elapsed since the channel was selected
+		while(TimeNowUs() - mux->select_time < mux->config.settle_us){
+		}
+		uint16_t raw;
+		AnalogInputReadSingle(mux->config.input, &raw);
+		// the next channel (the first one after the last) settles while the sample is stored
+		AnalogMuxSelect(mux, (ch + 1) & (mux->channels - 1));
+		block->data[ch][mux->index] = raw;
+	}
+	if(++mux->index < mux->config.frame_size){
+		return;
+	}
+	for(uint8_t ch = 0; ch < ANALOG_MUX_MAX_CH; ch++){
+		block->lenght[ch] = (ch < mux->channels) ? mux->index : 0;
+	}
+	block->channels = (1UL << mux->channels) - 1;
+	block->sample_frec = mux->config.sample_frec;
+	mux->index = 0;
+	__atomic_store_n(&mux->written, mux->written + 1, __ATOMIC_RELEASE);
+	if(mux->config.func_p != NULL){
+		((void (*)(void *))mux->config.func_p)(mux->config.param_p);
+	}
+}
+
+/**
+ * @brief Scan task: one scan on each alarm of the timer
+ */
+static void AnalogMuxTask(void *param){
+	analog_mux_t *mux = param;
+	while(true){
+		uint32_t alarms = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!mux->running){
+			mux->index = 0;
+			continue;
+		}
+		// alarms while the previous scan was running
+		mux->overruns += alarms - 1;
+		if(mux->index == 0 && mux->written - __atomic_load_n(&mux->released, __ATOMIC_ACQUIRE) >= ANALOG_MUX_BLOCK_RING_SIZE){
+			// every block in use
+			mux->overruns++;
+			continue;
+		}
+		AnalogMuxScan(mux);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool AnalogMuxInit(analog_mux_t *mux, const analog_mux_config_t *config){
+	if(config->select_lines == 0 || config->select_lines > ANALOG_MUX_MAX_LINES || config->sample_frec == 0 ||
+		config->frame_size == 0 || config->frame_size > ANALOG_MUX_MAX_FRAME_SIZE){
+		return false;
+	}
+	memset(mux, 0, sizeof(analog_mux_t));
+	mux->config = *config;
+	mux->channels = 1 << config->select_lines;
+	mux->bundle = GPIOFastBundleInit(mux->config.select, config->select_lines);
+	if(mux->bundle < 0){
+		return false;
+	}
+	AnalogMuxSelect(mux, 0);
+	analog_input_config_t input = {
+		.input = config->input,
+		.mode = ADC_SINGLE,
+	};
+	AnalogInputInit(&input);
+	timer_handle_config_t timer = {
+		.period = TIME_US_PER_S / config->sample_frec,
+		.mode = TIMER_PERIODIC,
+	};
+	mux->timer = TimerCreate(&timer);
+	if(mux->timer == NULL){
+		return false;
+	}
+	if(xTaskCreate(AnalogMuxTask, "MUX", ANALOG_MUX_TASK_STACK, mux, ANALOG_MUX_TASK_PRIORITY, &mux->task) != pdPASS){
+		TimerDelete(mux->timer);
+		mux->timer = NULL;
+		return false;
+	}
+	TimerHandleNotifyTask(mux->timer, mux->task);
+	return true;
+}
+
+void AnalogMuxStart(analog_mux_t *mux){
+	mux->running = true;
+	TimerHandleStart(mux->timer);
+}
+
+void AnalogMuxStop(analog_mux_t *mux){
+	TimerHandleStop(mux->timer);
+	mux->running = false;
+	// the task discards the block being filled
+	xTaskNotifyGive(mux->task);
+}
+
+analog_mux_block_t* AnalogMuxGetBlock(analog_mux_t *mux){
+	if(mux->taken == __atomic_load_n(&mux->written, __ATOMIC_ACQUIRE)){
+		return NULL;
+	}
+	return &mux->blocks[mux->taken++ % ANALOG_MUX_BLOCK_RING_SIZE];
+}
+
+void AnalogMuxReleaseBlock(analog_mux_t *mux, analog_mux_block_t *block){
+	__atomic_store_n(&mux->released, mux->released + 1, __ATOMIC_RELEASE);
+}
+
+void AnalogMuxBlockToFloat(const analog_mux_t *mux, const analog_mux_block_t *block, uint8_t channel, float *values){
+	const uint16_t *lut = AnalogInputGetLUT(mux->config.input);
+	for(uint16_t i = 0; i < block->lenght[channel]; i++){
+		uint16_t raw = block->data[channel][i];
+		values[i] = (lut != NULL) ? lut[raw] : raw * RAW_TO_MV;
+	}
+}
+
+uint32_t AnalogMuxGetOverruns(const analog_mux_t *mux){
+	return mux->overruns;
+}
+
+/*==================[end of file]============================================*/
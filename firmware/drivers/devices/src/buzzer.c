@@ -13,11 +13,20 @@
 #include "buzzer.h"
 #include "delay_mcu.h"
 #include "pwm_mcu.h"
+#include <stddef.h>
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define PWM_BUZZER      PWM_3
 #define PWM_DC          50
 #define OCTAVE_OFFSET   0
+#define US_PER_MS       1000
 /*==================[internal data declaration]==============================*/
+static esp_timer_handle_t sequencer_timer = NULL;   /*!< Ends the current note */
+static const buzzer_note_t * melody = NULL;         /*!< Notes being played */
+static uint16_t melody_lenght = 0;
+static uint16_t melody_index = 0;                   /*!< Next note */
+static volatile bool playing = false;
+static buzzer_note_t rtttl_notes[BUZZER_MAX_NOTES];  /*!< Melody compiled by BuzzerPlayRtttl */
 
 /*==================[internal functions declaration]=========================*/
 
@@ -39,11 +48,38 @@ bool isDigit(char c){
         return false;
     }
 }
+
+/**
+ * @brief Sequencer: starts the next note and sets the timer at its end
+ */
+static void BuzzerNextNote(void * param){
+    if(melody_index >= melody_lenght){
+        PWMOff(PWM_BUZZER);
+        playing = false;
+        return;
+    }
+    const buzzer_note_t * note = &melody[melody_index++];
+    if(note->freq){
+        PWMSetFreq(PWM_BUZZER, note->freq);
+        PWMOn(PWM_BUZZER);
+    }
+    else{
+        PWMOff(PWM_BUZZER);
+    }
+    esp_timer_start_once(sequencer_timer, (uint64_t)note->duration * US_PER_MS);
+}
 /*==================[external functions definition]==========================*/
 void BuzzerInit(gpio_t pin){
     PWMInit(PWM_BUZZER, pin, NOTE_C4);
     PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
     PWMOff(PWM_BUZZER);
+    if(sequencer_timer == NULL){
+        esp_timer_create_args_t timer_args = {
+            .callback = BuzzerNextNote,
+            .name = "buzzer"
+        };
+        esp_timer_create(&timer_args, &sequencer_timer);
+    }
 }
 
 void BuzzerOn(void){
@@ -65,7 +101,8 @@ void BuzzerPlayTone(uint16_t freq, uint16_t duration){
 	PWMOff(PWM_BUZZER);
 }
 
-void BuzzerPlayRtttl(const char * rtttl_melody){
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t * notes_out, uint16_t max_notes){
+    uint16_t lenght = 0;
     uint8_t default_dur = 4;
     uint8_t default_oct = 6;
     int bpm = 63;
@@ -116,7 +153,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
     wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
 
     /* now begin note loop */
-    while(*rtttl_melody){
+    while(*rtttl_melody && lenght < max_notes){
         /* first, get note duration, if available */
         num = 0;
         while(isDigit(*rtttl_melody)){
@@ -178,14 +215,43 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         if(*rtttl_melody == ','){
             rtttl_melody++; // skip comma for next note (or we may be at the end)
         }
-        /* now play the note */
-        if(note){
-            BuzzerPlayTone(notes[(scale - 4) * 12 + note], duration);
-        }
-        else{
-            DelayMs(duration);
-        }
+        /* now store the note */
+        notes_out[lenght].freq = note ? notes[(scale - 4) * 12 + note] : 0;
+        notes_out[lenght].duration = duration;
+        lenght++;
     }
+    return lenght;
+}
+
+void BuzzerPlayRtttl(const char * rtttl_melody){
+    /* the compiled melody can't change while it's played */
+    BuzzerStop();
+    BuzzerPlayNotes(rtttl_notes, BuzzerCompileRtttl(rtttl_melody, rtttl_notes, BUZZER_MAX_NOTES));
+}
+
+void BuzzerPlayNotes(const buzzer_note_t * notes, uint16_t lenght){
+    if(sequencer_timer == NULL){
+        return;
+    }
+    BuzzerStop();
+    melody = notes;
+    melody_lenght = lenght;
+    melody_index = 0;
+    playing = true;
+    BuzzerNextNote(NULL);
+}
+
+void BuzzerStop(void){
+    if(sequencer_timer != NULL){
+        esp_timer_stop(sequencer_timer);
+    }
+    playing = false;
+    melody_lenght = 0;
+    PWMOff(PWM_BUZZER);
+}
+
+bool BuzzerIsPlaying(void){
+    return playing;
 }
 
 void BuzzerDeinit(void){
@@ -12,6 +12,13 @@
 /*==================[inclusions]=============================================*/
 #include "hc_sr04.h"
 #include "delay_mcu.h"
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "static_alloc_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_US		17700	/* maximun distance time in us (300cm or 118inch) */
 #define MAX_CM		300		/* maximun distance time in cm */
@@ -19,8 +26,33 @@
 #define US2CM		59		/* scale factor to conver pulse width to cm */
 #define US2INCH		150		/* scale factor to conver pulse width to inch */
 #define WAIT_MAX	5900	/* maximun time to wait for echo signal */
+#define US2CM_F		58.3f	/* scale factor to conver pulse width to cm (343 m/s) */
+#define ECHO_TIMEOUT_MS	40	/* maximun echo pulse (no obstacle) */
+#define HC_SR04_TASK_STACK	CONFIG_DRIVERS_HC_SR04_TASK_STACK
+#define HC_SR04_TASK_PRIO	9
 /*==================[internal data declaration]==============================*/
 static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
+/** @brief Echo timing state of the asynchronous mode */
+typedef enum {
+	ECHO_IDLE,				/*!< No measurement in progress */
+	ECHO_WAIT_RISE,			/*!< Trigger sent, waiting for the echo pulse */
+	ECHO_WAIT_FALL,			/*!< Echo pulse in progress */
+} echo_state_t;
+/** @brief Sensor of the asynchronous mode */
+typedef struct {
+	gpio_t echo;			/*!< Echo pin */
+	gpio_t trigger;			/*!< Trigger pin */
+} hc_sr04_sensor_t;
+static hc_sr04_sensor_t sensors[HC_SR04_MAX_SENSORS];	/**< Sensors of the asynchronous mode */
+static uint8_t sensors_qty = 0;							/**< Number of sensors */
+static volatile uint8_t active_sensor;					/**< Sensor being measured */
+static volatile echo_state_t echo_state = ECHO_IDLE;	/**< Echo timing state */
+static volatile uint32_t echo_start, echo_cycles;		/**< Echo pulse start and width (CPU cycles) */
+static TaskHandle_t async_task = NULL;					/**< Driver task */
+STATIC_TASK_DEFINE(async_task, HC_SR04_TASK_STACK);
+static hc_sr04_func_t async_func;						/**< Distance callback */
+static void *async_param;								/**< Distance callback parameter */
+static uint32_t async_period;							/**< Round period (ms) */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -28,6 +60,52 @@ static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Echo pin ISR (both edges): times the echo pulse of the active sensor
+ */
+static void IRAM_ATTR HcSr04EchoIsr(void *param){
+	uint32_t now = esp_cpu_get_cycle_count();
+	BaseType_t task_woken = pdFALSE;
+	if((uintptr_t)param != active_sensor){
+		return;
+	}
+	if(echo_state == ECHO_WAIT_RISE){
+		echo_start = now;
+		echo_state = ECHO_WAIT_FALL;
+	} else if(echo_state == ECHO_WAIT_FALL){
+		echo_cycles = now - echo_start;
+		echo_state = ECHO_IDLE;
+		vTaskNotifyGiveFromISR(async_task, &task_woken);
+		portYIELD_FROM_ISR(task_woken);
+	}
+}
+
+/**
+ * @brief Driver task: measures the sensors in turns
+ */
+static void HcSr04Task(void *param){
+	TickType_t last_wake = xTaskGetTickCount();
+	while(1){
+		for(uint8_t i = 0; i < sensors_qty; i++){
+			float distance = 0;
+			active_sensor = i;
+			ulTaskNotifyTake(pdTRUE, 0);
+			echo_state = ECHO_WAIT_RISE;
+			GPIOOn(sensors[i].trigger);
+			DelayUs(10);
+			GPIOOff(sensors[i].trigger);
+			if(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ECHO_TIMEOUT_MS) + 1)){
+				distance = (float)echo_cycles / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ / US2CM_F;
+				if(distance > MAX_CM){
+					distance = MAX_CM;
+				}
+			}
+			echo_state = ECHO_IDLE;
+			async_func(i, distance, async_param);
+		}
+		vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(async_period));
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -39,6 +117,36 @@ bool HcSr04Init(gpio_t echo, gpio_t trigger){
 	GPIOInit(echo, GPIO_INPUT);
 	GPIOInit(trigger, GPIO_OUTPUT);
 
+	/** Sensor 0 of the asynchronous mode */
+	sensors[0].echo = echo;
+	sensors[0].trigger = trigger;
+	sensors_qty = 1;
+
+	return true;
+}
+
+int8_t HcSr04AddSensor(gpio_t echo, gpio_t trigger){
+	if(sensors_qty >= HC_SR04_MAX_SENSORS || async_task != NULL){
+		return -1;
+	}
+	GPIOInit(echo, GPIO_INPUT);
+	GPIOInit(trigger, GPIO_OUTPUT);
+	sensors[sensors_qty].echo = echo;
+	sensors[sensors_qty].trigger = trigger;
+	return sensors_qty++;
+}
+
+bool HcSr04StartAsync(uint32_t period_ms, hc_sr04_func_t func_p, void *param_p){
+	if(async_task != NULL || sensors_qty == 0 || func_p == NULL){
+		return false;
+	}
+	async_func = func_p;
+	async_param = param_p;
+	async_period = period_ms;
+	STATIC_TASK_CREATE(async_task, HcSr04Task, "HC_SR04", NULL, HC_SR04_TASK_PRIO, &async_task);
+	for(uint8_t i = 0; i < sensors_qty; i++){
+		GPIOActivIntAnyEdge(sensors[i].echo, HcSr04EchoIsr, (void *)(uintptr_t)i);
+	}
 	return true;
 }
 
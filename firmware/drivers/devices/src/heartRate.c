@@ -53,55 +53,53 @@
 
 #include "heartRate.h"
 
-int16_t IR_AC_Max = 20;
-int16_t IR_AC_Min = -20;
+static heartRate_t defaultHeartRate = {.IR_AC_Max = 20, .IR_AC_Min = -20, .minAmplitude = 20};
 
-int16_t IR_AC_Signal_Current = 0;
-int16_t IR_AC_Signal_Previous;
-int16_t IR_AC_Signal_min = 0;
-int16_t IR_AC_Signal_max = 0;
-int16_t IR_Average_Estimated;
+static const uint16_t FIRCoeffs[12] = {172, 321, 579, 927, 1360, 1858, 2390, 2916, 3391, 3768, 4012, 4096};
 
-int16_t positiveEdge = 0;
-int16_t negativeEdge = 0;
-int32_t ir_avg_reg = 0;
+//  Low Pass FIR Filter of an instance
+static inline int16_t heartRateFIRFilter(heartRate_t *hr, int16_t din)
+{
+  hr->cbuf[hr->offset] = din;
 
-int16_t cbuf[32];
-uint8_t offset = 0;
+  int32_t z = mul16(FIRCoeffs[11], hr->cbuf[(hr->offset - 11) & 0x1F]);
 
-static const uint16_t FIRCoeffs[12] = {172, 321, 579, 927, 1360, 1858, 2390, 2916, 3391, 3768, 4012, 4096};
+  for (uint8_t i = 0 ; i < 11 ; i++)
+  {
+    z += mul16(FIRCoeffs[i], hr->cbuf[(hr->offset - i) & 0x1F] + hr->cbuf[(hr->offset - 22 + i) & 0x1F]);
+  }
 
-//  Heart Rate Monitor functions takes a sample value and the sample number
-//  Returns true if a beat is detected
-//  A running average of four samples is recommended for display on the screen.
-bool checkForBeat(int32_t sample)
+  hr->offset++;
+  hr->offset %= 32; //Wrap condition
+
+  return(z >> 15);
+}
+
+//  Beat detection step of an instance (inlined in the batch loop)
+static inline bool heartRateStep(heartRate_t *hr, int32_t sample)
 {
   bool beatDetected = false;
 
   //  Save current state
-  IR_AC_Signal_Previous = IR_AC_Signal_Current;
-
-  //This is good to view for debugging
-  //Serial.print("Signal_Current: ");
-  //Serial.println(IR_AC_Signal_Current);
+  hr->IR_AC_Signal_Previous = hr->IR_AC_Signal_Current;
 
   //  Process next data sample
-  IR_Average_Estimated = averageDCEstimator(&ir_avg_reg, sample);
-  IR_AC_Signal_Current = lowPassFIRFilter(sample - IR_Average_Estimated);
+  hr->IR_Average_Estimated = averageDCEstimator(&hr->ir_avg_reg, sample);
+  hr->IR_AC_Signal_Current = heartRateFIRFilter(hr, sample - hr->IR_Average_Estimated);
 
   //  Detect positive zero crossing (rising edge)
-  if ((IR_AC_Signal_Previous < 0) & (IR_AC_Signal_Current >= 0))
+  if ((hr->IR_AC_Signal_Previous < 0) & (hr->IR_AC_Signal_Current >= 0))
   {
 
-    IR_AC_Max = IR_AC_Signal_max; //Adjust our AC max and min
-    IR_AC_Min = IR_AC_Signal_min;
+    hr->IR_AC_Max = hr->IR_AC_Signal_max; //Adjust our AC max and min
+    hr->IR_AC_Min = hr->IR_AC_Signal_min;
 
-    positiveEdge = 1;
-    negativeEdge = 0;
-    IR_AC_Signal_max = 0;
+    hr->positiveEdge = 1;
+    hr->negativeEdge = 0;
+    hr->IR_AC_Signal_max = 0;
 
     //if ((IR_AC_Max - IR_AC_Min) > 100 & (IR_AC_Max - IR_AC_Min) < 1000)
-    if (((IR_AC_Max - IR_AC_Min) > 20) & ((IR_AC_Max - IR_AC_Min) < 1000))
+    if (((hr->IR_AC_Max - hr->IR_AC_Min) > hr->minAmplitude) & ((hr->IR_AC_Max - hr->IR_AC_Min) < 1000))
     {
       //Heart beat!!!
       beatDetected = true;
@@ -109,51 +107,77 @@ bool checkForBeat(int32_t sample)
   }
 
   //  Detect negative zero crossing (falling edge)
-  if ((IR_AC_Signal_Previous > 0) & (IR_AC_Signal_Current <= 0))
+  if ((hr->IR_AC_Signal_Previous > 0) & (hr->IR_AC_Signal_Current <= 0))
   {
-    positiveEdge = 0;
-    negativeEdge = 1;
-    IR_AC_Signal_min = 0;
+    hr->positiveEdge = 0;
+    hr->negativeEdge = 1;
+    hr->IR_AC_Signal_min = 0;
   }
 
   //  Find Maximum value in positive cycle
-  if (positiveEdge & (IR_AC_Signal_Current > IR_AC_Signal_Previous))
+  if (hr->positiveEdge & (hr->IR_AC_Signal_Current > hr->IR_AC_Signal_Previous))
   {
-    IR_AC_Signal_max = IR_AC_Signal_Current;
+    hr->IR_AC_Signal_max = hr->IR_AC_Signal_Current;
   }
 
   //  Find Minimum value in negative cycle
-  if (negativeEdge & (IR_AC_Signal_Current < IR_AC_Signal_Previous))
+  if (hr->negativeEdge & (hr->IR_AC_Signal_Current < hr->IR_AC_Signal_Previous))
   {
-    IR_AC_Signal_min = IR_AC_Signal_Current;
+    hr->IR_AC_Signal_min = hr->IR_AC_Signal_Current;
   }
 
   return(beatDetected);
 }
 
-//  Average DC Estimator
-int16_t averageDCEstimator(int32_t *p, uint16_t x)
+//  Heart Rate Monitor functions takes a sample value and the sample number
+//  Returns true if a beat is detected
+//  A running average of four samples is recommended for display on the screen.
+bool checkForBeat(int32_t sample)
 {
-  *p += ((((long) x << 15) - *p) >> 4);
-  return (*p >> 15);
+  return heartRateStep(&defaultHeartRate, sample);
 }
 
-//  Low Pass FIR Filter
-int16_t lowPassFIRFilter(int16_t din)
+void heartRateInit(heartRate_t *hr)
 {
-  cbuf[offset] = din;
+  *hr = (heartRate_t){.IR_AC_Max = 20, .IR_AC_Min = -20, .minAmplitude = 20};
+}
 
-  int32_t z = mul16(FIRCoeffs[11], cbuf[(offset - 11) & 0x1F]);
+void heartRateSetMinAmplitude(heartRate_t *hr, int16_t minAmplitude)
+{
+  hr->minAmplitude = minAmplitude;
+}
 
-  for (uint8_t i = 0 ; i < 11 ; i++)
+bool heartRateCheckForBeat(heartRate_t *hr, int32_t sample)
+{
+  return heartRateStep(hr, sample);
+}
+
+uint16_t heartRateCheckForBeats(heartRate_t *hr, const uint32_t *samples, uint16_t lenght, uint16_t *beats, uint16_t maxBeats)
+{
+  uint16_t beatCount = 0;
+
+  for (uint16_t i = 0; i < lenght; i++)
   {
-    z += mul16(FIRCoeffs[i], cbuf[(offset - i) & 0x1F] + cbuf[(offset - 22 + i) & 0x1F]);
+    if (heartRateStep(hr, samples[i]))
+    {
+      if (beatCount < maxBeats) beats[beatCount] = i;
+      beatCount++;
+    }
   }
+  return beatCount;
+}
 
-  offset++;
-  offset %= 32; //Wrap condition
+//  Average DC Estimator
+int16_t averageDCEstimator(int32_t *p, uint16_t x)
+{
+  *p += ((((long) x << 15) - *p) >> 4);
+  return (*p >> 15);
+}
 
-  return(z >> 15);
+//  Low Pass FIR Filter
+int16_t lowPassFIRFilter(int16_t din)
+{
+  return heartRateFIRFilter(&defaultHeartRate, din);
 }
 
 //  Integer multiplier
@@ -8,12 +8,20 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include "hx711.h"
 
 #include <delay_mcu.h>
+#include "gpio_fast_out_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ring_buffer_mcu.h"
+#include "static_alloc_mcu.h"
 
 /*==================[macros and definitions]=================================*/
+#define HX711_TASK_STACK    CONFIG_DRIVERS_HX711_TASK_STACK
+#define HX711_TASK_PRIO     9
 
 /*==================[internal data declaration]==============================*/
 uint8_t GAIN;		             /*!<  Amplification factor */
@@ -24,6 +32,28 @@ float SCALE;	                 /*!<  Used to return weight in grams, kg, ounces,
 gpio_t internal_pd_sck;
 gpio_t internal_dout;
 
+// Interrupt driven readout: the DOUT ISR wakes up the driver task, which clocks the sample out
+static TaskHandle_t interruptTask = NULL;
+STATIC_TASK_DEFINE(interruptTask, HX711_TASK_STACK);
+static portMUX_TYPE shiftMux = portMUX_INITIALIZER_UNLOCKED;
+static ring_buffer_t sampleRing;
+static int32_t sampleStorage[HX711_RING_SIZE];
+static int32_t averageWindow[HX711_AVERAGE_MAX];
+static int64_t averageSum;
+static uint8_t averageLenght;
+static uint8_t averageCount;
+static uint8_t averageIndex;
+
+// Multi-device mode: shared PD_SCK in a dedicated GPIO bundle, all DOUT read at once
+static TaskHandle_t multiTask = NULL;
+STATIC_TASK_DEFINE(multiTask, HX711_TASK_STACK);
+static int8_t multiClock = -1;
+static gpio_t multiDout[HX711_MAX_CHANNELS];
+static uint32_t multiMask;       // GPIOs of all the DOUT lines
+static uint8_t multiChannels = 0;
+static ring_buffer_t multiRing[HX711_MAX_CHANNELS];
+static int32_t multiStorage[HX711_MAX_CHANNELS][HX711_RING_SIZE];
+
 /*==================[internal functions declaration]=========================*/
 
 uint8_t shiftIn(void)
@@ -32,13 +62,137 @@ uint8_t shiftIn(void)
 
     for (uint8_t i = 0; i < 8; ++i)
     {
-    	GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
-        value |= GPIORead(internal_dout) << (7 - i);
-        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    	GPIOOnFast(internal_pd_sck);//PD_SCK_SET_HIGH;
+        value |= GPIOReadFast(internal_dout) << (7 - i);
+        GPIOOffFast(internal_pd_sck);//PD_SCK_SET_LOW;
     }
     return value;
 }
 
+// Clocks out a sample (24 bits, MSB first, two's complement) and the GAIN pulses
+// that select the next conversion. Interrupts are disabled so PD_SCK is never high
+// for more than a few us
+static int32_t shiftSample(void)
+{
+    uint32_t value = 0;
+
+    taskENTER_CRITICAL(&shiftMux);
+    for (uint8_t i = 0; i < 24; i++)
+    {
+        GPIOOnFast(internal_pd_sck);//PD_SCK_SET_HIGH;
+        DelayUs(1);
+        GPIOOffFast(internal_pd_sck);//PD_SCK_SET_LOW;
+        value = (value << 1) | GPIOReadFast(internal_dout);
+    }
+    for (uint8_t i = 0; i < GAIN; i++)
+    {
+        GPIOOnFast(internal_pd_sck);//PD_SCK_SET_HIGH;
+        DelayUs(1);
+        GPIOOffFast(internal_pd_sck);//PD_SCK_SET_LOW;
+        DelayUs(1);
+    }
+    taskEXIT_CRITICAL(&shiftMux);
+
+    // sign extension of the 24 bits value
+    if (value & 0x800000)
+        value |= 0xFF000000;
+    return (int32_t)value;
+}
+
+// DOUT ISR (falling edge: conversion ready)
+static void IRAM_ATTR HX711_isr(void *param)
+{
+    BaseType_t taskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(interruptTask, &taskWoken);
+    portYIELD_FROM_ISR(taskWoken);
+}
+
+// Driver task: reads each conversion and updates the ring and the moving average
+static void HX711_task(void *param)
+{
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // DOUT also falls while the bits are clocked out: those edges are discarded here
+        if (!HX711_isReady())
+            continue;
+        int32_t sample = shiftSample();
+        RingBufferPush(&sampleRing, &sample);
+
+        taskENTER_CRITICAL(&shiftMux);
+        if (averageCount == averageLenght)
+            averageSum -= averageWindow[averageIndex];
+        else
+            averageCount++;
+        averageWindow[averageIndex] = sample;
+        averageSum += sample;
+        averageIndex = (averageIndex + 1) % averageLenght;
+        taskEXIT_CRITICAL(&shiftMux);
+    }
+}
+
+// Clocks out the samples of all the channels at once: each rising edge of the shared
+// PD_SCK shifts one bit out of every HX711, and all DOUT are sampled in one register
+// read. The decoding is done after, with interrupts enabled
+static void shiftSamples(int32_t *samples)
+{
+    uint32_t bits[24];
+
+    taskENTER_CRITICAL(&shiftMux);
+    for (uint8_t i = 0; i < 24; i++)
+    {
+        GPIOFastBundleWrite(multiClock, 1, 1);//PD_SCK_SET_HIGH;
+        DelayUs(1);
+        GPIOFastBundleWrite(multiClock, 1, 0);//PD_SCK_SET_LOW;
+        bits[i] = GPIOReadAllFast();
+    }
+    for (uint8_t i = 0; i < GAIN; i++)
+    {
+        GPIOFastBundleWrite(multiClock, 1, 1);//PD_SCK_SET_HIGH;
+        DelayUs(1);
+        GPIOFastBundleWrite(multiClock, 1, 0);//PD_SCK_SET_LOW;
+        DelayUs(1);
+    }
+    taskEXIT_CRITICAL(&shiftMux);
+
+    for (uint8_t c = 0; c < multiChannels; c++)
+    {
+        uint32_t value = 0;
+        for (uint8_t i = 0; i < 24; i++)
+            value = (value << 1) | ((bits[i] >> multiDout[c]) & 1);
+        // sign extension of the 24 bits value
+        if (value & 0x800000)
+            value |= 0xFF000000;
+        samples[c] = (int32_t)value;
+    }
+}
+
+// DOUT ISR of the multi-device mode (falling edge of any channel)
+static void IRAM_ATTR HX711_multiIsr(void *param)
+{
+    BaseType_t taskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(multiTask, &taskWoken);
+    portYIELD_FROM_ISR(taskWoken);
+}
+
+// Multi-device driver task: reads all the channels when all of them are ready
+static void HX711_multiTask(void *param)
+{
+    int32_t samples[HX711_MAX_CHANNELS];
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // The last channel to finish its conversion starts the readout (and the
+        // DOUT edges while the bits are clocked out are discarded here)
+        if ((GPIOReadAllFast() & multiMask) != 0)
+            continue;
+        shiftSamples(samples);
+        for (uint8_t c = 0; c < multiChannels; c++)
+            RingBufferPush(&multiRing[c], &samples[c]);
+    }
+}
+
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -59,7 +213,7 @@ int HX711_isReady(void)
     return (GPIORead(internal_dout)) == 0;
 }
 
-void HX711_setGain(uint8_t gain)
+static void HX711_setGainPulses(uint8_t gain)
 {
 	switch (gain)
 	{
@@ -73,7 +227,11 @@ void HX711_setGain(uint8_t gain)
 			GAIN = 2;
 			break;
 	}
+}
 
+void HX711_setGain(uint8_t gain)
+{
+	HX711_setGainPulses(gain);
 	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
 	HX711_read();
 }
@@ -161,6 +319,111 @@ double HX711_getOffset(void)
 	return OFFSET;
 }
 
+bool HX711_startInterrupt(uint8_t average)
+{
+    if (interruptTask != NULL)
+        return false;
+    if (average < 1)
+        average = 1;
+    if (average > HX711_AVERAGE_MAX)
+        average = HX711_AVERAGE_MAX;
+
+    averageLenght = average;
+    averageCount = 0;
+    averageIndex = 0;
+    averageSum = 0;
+    RingBufferInit(&sampleRing, sampleStorage, sizeof(int32_t), HX711_RING_SIZE);
+    STATIC_TASK_CREATE(interruptTask, HX711_task, "HX711", NULL, HX711_TASK_PRIO, &interruptTask);
+
+    GPIOActivInt(internal_dout, HX711_isr, false, NULL);
+    // a conversion may be ready since before the ISR was attached
+    xTaskNotifyGive(interruptTask);
+    return true;
+}
+
+uint32_t HX711_readSamples(int32_t *values, uint32_t n)
+{
+    return RingBufferRead(&sampleRing, values, n);
+}
+
+bool HX711_getAverage(double *average)
+{
+    int64_t sum;
+    uint8_t count;
+
+    taskENTER_CRITICAL(&shiftMux);
+    sum = averageSum;
+    count = averageCount;
+    taskEXIT_CRITICAL(&shiftMux);
+    if (count == 0)
+        return false;
+    *average = (double)sum / count;
+    return true;
+}
+
+float HX711_getUnitsAsync(void)
+{
+    double average;
+
+    if (!HX711_getAverage(&average))
+        return 0;
+    return (average - OFFSET) / SCALE;
+}
+
+bool HX711_tareAsync(void)
+{
+    double average;
+
+    if (!HX711_getAverage(&average))
+        return false;
+    HX711_setOffset(average);
+    return true;
+}
+
+bool HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t channels)
+{
+    if (channels == 0 || channels > HX711_MAX_CHANNELS)
+        return false;
+    if (multiClock < 0)
+    {
+        multiClock = GPIOFastBundleInit(&pd_sck, 1);
+        if (multiClock < 0)
+            return false;
+    }
+    GPIOFastBundleWrite(multiClock, 1, 0);//PD_SCK_SET_LOW;
+    multiMask = 0;
+    for (uint8_t c = 0; c < channels; c++)
+    {
+        multiDout[c] = dout[c];
+        multiMask |= 1UL << dout[c];
+        GPIOInit(dout[c], GPIO_INPUT);//DOUT_SET_INPUT;
+        RingBufferInit(&multiRing[c], multiStorage[c], sizeof(int32_t), HX711_RING_SIZE);
+    }
+    multiChannels = channels;
+    // The gain is set by the pulses after the first readout
+    HX711_setGainPulses(gain);
+    return true;
+}
+
+bool HX711_startMulti(void)
+{
+    if (multiTask != NULL || multiChannels == 0)
+        return false;
+    STATIC_TASK_CREATE(multiTask, HX711_multiTask, "HX711_multi", NULL, HX711_TASK_PRIO, &multiTask);
+    for (uint8_t c = 0; c < multiChannels; c++)
+        GPIOActivInt(multiDout[c], HX711_multiIsr, false, NULL);
+    // conversions may be ready since before the ISRs were attached
+    xTaskNotifyGive(multiTask);
+    return true;
+}
+
+uint32_t HX711_readChannel(uint8_t channel, int32_t *values, uint32_t n)
+{
+    if (channel >= multiChannels)
+        return 0;
+    return RingBufferRead(&multiRing[channel], values, n);
+}
+
 void HX711_powerDown(void)
 {
 	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
@@ -15,6 +15,9 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "trace_mcu.h"
+#include "esp_attr.h"
+#include "sdkconfig.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -22,7 +25,12 @@
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
-#define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define MAX_DMA_SIZE 4092			/*!< Maximum length of a DMA transaction (SPI bus max transfer size) */
+#define SPI_BURST 2048				/*!< Max length of a DMA transaction when the bus is shared (~0.8 ms) */
+#define BITMAP_BUFFER_SIZE 2048		/*!< Bytes of each buffer where glyphs and icons are expanded to RGB565 */
+#define RLE_RUN 0x80				/*!< RLE packet header: run of one color (else literal pixels) */
+#define GLYPH_CACHE_SIZE CONFIG_DRIVERS_ILI9341_GLYPH_CACHE	/*!< Bytes of the glyph sprites cache (0: no cache) */
+#define GLYPH_CACHE_ENTRIES 16		/*!< Max sprites in the cache */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -74,6 +82,19 @@ typedef struct {
 	ili9341_orientation_t orientation;	/*!< LCD Orientation */
 } orientation_properties_t;
 
+/**
+ * @brief Glyph expanded to RGB565 in the cache
+ */
+typedef struct {
+	const Font_t *font;		/*!< Font (NULL: free entry) */
+	char data;				/*!< Character */
+	uint16_t foreground;	/*!< Color of bits set */
+	uint16_t background;	/*!< Color of bits cleared */
+	uint32_t offset;		/*!< Position of the sprite in the cache */
+	uint32_t bytes;			/*!< Bytes of the sprite */
+	uint32_t last_use;		/*!< Use counter at the last hit (LRU) */
+} glyph_sprite_t;
+
 /**
  * @brief Structure to configure or write LCD
  */
@@ -103,6 +124,66 @@ void WriteLCD(lcd_cmd_t * data);
  */
 void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
+/**
+ * @brief  		Write pixels data to LCD memory (after MEM_WRITE) with queued DMA transactions
+ * @param[in]  	data: Pixels data (DMA capable memory)
+ * @param[in]  	bytes_count: Number of bytes to write
+ * @param[in]  	chunk: Bytes of each transaction
+ * @param[in]  	repeat: true: the same chunk is written until bytes_count (i.e. a fill color)
+ * @retval 		None
+ */
+static void WriteData(const uint8_t * data, int32_t bytes_count, uint32_t chunk, bool repeat);
+
+/**
+ * @brief  		Queue pixels data to LCD memory (after MEM_WRITE) and return without waiting
+ * 				the last transactions. The bus is held until WriteDataWait.
+ * @param[in]  	data: Pixels data (DMA capable memory)
+ * @param[in]  	bytes_count: Number of bytes to write
+ * @param[in]  	chunk: Bytes of each transaction
+ * @param[in]  	repeat: true: the same chunk is written until bytes_count (i.e. a fill color)
+ * @param[in]  	func_p: Called from the ISR at the end of the last transaction (NULL: none). With
+ * 				a callback the bus is not held: other devices' transactions can go between the
+ * 				chunks (the LCD keeps writing memory until the next command).
+ * @param[in]  	param_p: Parameter of func_p
+ * @retval 		None
+ */
+static void WriteDataStart(const uint8_t * data, int32_t bytes_count, uint32_t chunk, bool repeat,
+						   void (*func_p)(void*), void *param_p);
+
+/**
+ * @brief  		Wait the transactions queued by WriteDataStart and release the bus (if held)
+ * @retval 		None
+ */
+static void WriteDataWait(void);
+
+/**
+ * @brief  		Draw a 1 bit per pixel bitmap (font or icon format, MSB first). Rows are expanded
+ * 				to RGB565 in a buffer while the previous rows are written by DMA.
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	width: Bitmap width
+ * @param[in]  	height: Bitmap height
+ * @param[in]  	data: Bitmap data
+ * @param[in]  	foreground: Color of bits set
+ * @param[in]  	background: Color of bits cleared
+ * @retval 		None
+ */
+static void DrawBitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t * data,
+					   uint16_t foreground, uint16_t background);
+
+#if GLYPH_CACHE_SIZE > 0
+/**
+ * @brief  		Find a glyph sprite in the cache, or expand it in the cache evicting the least
+ * 				recently used sprites until it fits
+ * @param[in]  	font: Font
+ * @param[in]  	data: Character
+ * @param[in]  	foreground: Color of bits set
+ * @param[in]  	background: Color of bits cleared
+ * @retval 		Sprite (NULL if the glyph is bigger than the cache)
+ */
+static glyph_sprite_t * GlyphCacheGet(const Font_t * font, char data, uint16_t foreground, uint16_t background);
+#endif
+
 /**
  * @brief  		Fill an srea of LCD with a determined color
  * @param[in]  	x1: Start column
@@ -174,16 +255,31 @@ lcd_cmd_t lcd_on = {DISPLAY_ON, NULL, NULL};		/*!< Exit sleep mode */
 /*
  * @brief: SPI port configuration compatible with LCD interface
  */
-spi_mcu_config_t spi_conf = {
+static spi_mcu_config_t spi_conf = {
 	.device = NULL, 
 	.clk_mode = MODE0, 
 	.bitrate = SPI_BR, 
 	.transfer_mode = SPI_POLLING, 
 	.func_p = NULL,
-	.param_p = NULL };
+	.param_p = NULL,
+	.priority = SPI_PRIORITY_LOW,
+	.max_burst = SPI_BURST };
 
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
+static spi_trans_t pixel_trans[SPI_QUEUE_SIZE];	/*!< Transactions to write pixels data */
+static uint8_t pixel_queued = 0;			/*!< Pixels transactions in flight */
+static bool pixel_bus_held = false;			/*!< Bus held by the pixels transactions in flight */
+static uint8_t bitmap_buffer[2][BITMAP_BUFFER_SIZE];	/*!< Buffers where bitmaps are expanded to RGB565 */
+WORD_ALIGNED_ATTR DMA_ATTR static uint8_t fill_buffer[MAX_DMA_SIZE];	/*!< Fill color, repeated in transactions of max size */
+static uint16_t fill_color;					/*!< Color of fill_buffer */
+static uint16_t fill_ready = 0;				/*!< Bytes of fill_buffer with fill_color */
+#if GLYPH_CACHE_SIZE > 0
+WORD_ALIGNED_ATTR DMA_ATTR static uint8_t glyph_cache[GLYPH_CACHE_SIZE];	/*!< Glyph sprites (RGB565, LCD byte order) */
+static glyph_sprite_t glyph_sprites[GLYPH_CACHE_ENTRIES];	/*!< Sprites in glyph_cache */
+static uint32_t glyph_uses = 0;				/*!< Use counter (LRU) */
+#endif
+static uint32_t glyph_hits = 0, glyph_misses = 0;	/*!< Glyph cache statistics */
 
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
@@ -193,20 +289,38 @@ static orientation_properties_t lcd_orientation = {
 
 /*==================[internal functions definition]==========================*/
 
+static void DcCommand(void *param){
+	GPIOOff(ili9341_dc);
+}
+
+static void DcData(void *param){
+	GPIOOn(ili9341_dc);
+}
+
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
+	/* D/C is set by the SPI driver before each transaction, the bus is held for both */
+	spi_trans_t trans = {.pre_func_p = DcCommand};
+	/* A window write in progress must finish before the next command */
+	WriteDataWait();
+	TRACE_BEGIN(TRACE_LCD_WRITE, data->cmd);
+	SpiAcquire(ili9341_spi);
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
 		/* Send command */
-		GPIOOff(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+		trans.tx_buffer = &data->cmd;
+		trans.lenght = 1;
+		SpiTransmit(ili9341_spi, &trans);
 	}
 	/* If there are parameters or data to send */
 	if (data->databytes != NULL){
 		/* Send parameters or data */
-		GPIOOn(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+		trans.tx_buffer = data->data;
+		trans.lenght = data->databytes;
+		trans.pre_func_p = DcData;
+		SpiTransmit(ili9341_spi, &trans);
 	}
+	SpiRelease(ili9341_spi);
+	TRACE_END(TRACE_LCD_WRITE, data->cmd);
 }
 
 void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
@@ -232,10 +346,9 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	int32_t bytes_count;
+	int16_t x_dist, y_dist;
+	uint32_t chunk;
 
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
@@ -247,26 +360,194 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	}
 	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
 	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
+	chunk = (bytes_count < (int32_t)SpiGetMaxBurst(ili9341_spi)) ? bytes_count : SpiGetMaxBurst(ili9341_spi);
 	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+	/* The buffer keeps the last color: only a new color or a longer chunk writes it */
+	if (color != fill_color){
+		fill_ready = 0;
+		fill_color = color;
+	}
+	for (uint16_t i = fill_ready; i < chunk; i += 2){
+		fill_buffer[i] = HighByte(color);
+		fill_buffer[i + 1] = LowByte(color);
+	}
+	if (chunk > fill_ready){
+		fill_ready = chunk;
+	}
+	/* Start writing LCD memory: the chunks are queued back to back, and waited once at the end */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	WriteData(fill_buffer, bytes_count, chunk, true);
+}
+
+static void WriteData(const uint8_t * data, int32_t bytes_count, uint32_t chunk, bool repeat){
+	WriteDataStart(data, bytes_count, chunk, repeat, NULL, NULL);
+	WriteDataWait();
+}
+
+static void WriteDataStart(const uint8_t * data, int32_t bytes_count, uint32_t chunk, bool repeat,
+						   void (*func_p)(void*), void *param_p){
+	/* Pixels are queued to be written by DMA, keeping SPI_QUEUE_SIZE transactions in flight */
+	WriteDataWait();
+	/* Split in bursts: devices of higher priority go between them */
+	if(chunk > SpiGetMaxBurst(ili9341_spi)){
+		chunk = SpiGetMaxBurst(ili9341_spi);
+	}
+	/* Without a callback the caller waits the end: the bus is held meanwhile */
+	pixel_bus_held = (func_p == NULL);
+	if(pixel_bus_held){
+		SpiAcquire(ili9341_spi);
+	}
+	while(bytes_count > 0){
+		spi_trans_t *trans = (pixel_queued < SPI_QUEUE_SIZE) ? &pixel_trans[pixel_queued++] : SpiGetResult(ili9341_spi, SPI_WAIT_FOREVER);
+		trans->tx_buffer = (uint8_t *)data;
+		trans->rx_buffer = NULL;
+		trans->lenght = (bytes_count > (int32_t)chunk) ? chunk : bytes_count;
+		trans->pre_func_p = DcData;
+		trans->func_p = (bytes_count > (int32_t)chunk) ? NULL : func_p;
+		trans->param_p = param_p;
+		SpiQueue(ili9341_spi, trans);
+		bytes_count -= chunk;
+		if(!repeat){
+			data += chunk;
+		}
+	}
+	/* Bus is released when the last transactions are finished */
+	if(pixel_queued == 0 && pixel_bus_held){
+		SpiRelease(ili9341_spi);
+		pixel_bus_held = false;
+	}
+}
+
+static void WriteDataWait(void){
+	if(pixel_queued == 0){
+		return;
+	}
+	/* Every transaction must be finished before the next command */
+	while(pixel_queued > 0){
+		SpiGetResult(ili9341_spi, SPI_WAIT_FOREVER);
+		pixel_queued--;
+	}
+	if(pixel_bus_held){
+		SpiRelease(ili9341_spi);
+		pixel_bus_held = false;
+	}
+}
+
+static void DrawBitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t * data,
+					   uint16_t foreground, uint16_t background){
+	uint16_t bytes_row = (width + 7) / 8;
+	uint16_t rows_chunk = (width > 0) ? BITMAP_BUFFER_SIZE / (width * 2) : 0;
+	uint8_t buf = 0;
+
+	/* At least one row must fit in a buffer */
+	if (width == 0 || height == 0 || rows_chunk == 0){
+		return;
 	}
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+	for (uint16_t i = 0; i < height; i += rows_chunk){
+		uint16_t rows = (height - i < rows_chunk) ? height - i : rows_chunk;
+		uint8_t * p = bitmap_buffer[buf];
+		/* Expand the rows while the other buffer is written */
+		for (uint16_t r = i; r < i + rows; r++){
+			const uint8_t * row = &data[r * bytes_row];
+			for (uint16_t j = 0; j < width; j++){
+				uint16_t color = (row[j / 8] & (MSK_BIT8 >> (j % 8))) ? foreground : background;
+				*p++ = HighByte(color);
+				*p++ = LowByte(color);
+			}
+		}
+		WriteDataStart(bitmap_buffer[buf], rows * width * 2, MAX_DMA_SIZE, false, NULL, NULL);
+		buf ^= 1;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	WriteDataWait();
 }
 
+#if GLYPH_CACHE_SIZE > 0
+static glyph_sprite_t * GlyphCacheGet(const Font_t * font, char data, uint16_t foreground, uint16_t background){
+	const char_info_t * info = &font->info[data - ' '];
+	uint32_t bytes = ((uint32_t)info->width * font->font_height * 2 + 3) & ~3;
+	glyph_sprite_t * sprite = NULL;
+
+	glyph_uses++;
+	for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+		glyph_sprite_t * s = &glyph_sprites[i];
+		if (s->font == font && s->data == data && s->foreground == foreground && s->background == background){
+			s->last_use = glyph_uses;
+			glyph_hits++;
+			return s;
+		}
+	}
+	glyph_misses++;
+	if (bytes > GLYPH_CACHE_SIZE){
+		return NULL;
+	}
+	while (sprite == NULL){
+		/* First fit between the sprites in use, ordered by position */
+		uint32_t start = 0, end;
+		glyph_sprite_t * free_entry = NULL, * lru = NULL;
+		for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+			if (glyph_sprites[i].font == NULL){
+				free_entry = &glyph_sprites[i];
+			}else if (lru == NULL || glyph_sprites[i].last_use < lru->last_use){
+				lru = &glyph_sprites[i];
+			}
+		}
+		if (free_entry != NULL){
+			while (true){
+				glyph_sprite_t * next = NULL;
+				for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+					glyph_sprite_t * s = &glyph_sprites[i];
+					if (s->font != NULL && s->offset >= start && (next == NULL || s->offset < next->offset)){
+						next = s;
+					}
+				}
+				end = (next != NULL) ? next->offset : GLYPH_CACHE_SIZE;
+				if (end - start >= bytes){
+					sprite = free_entry;
+					break;
+				}
+				if (next == NULL){
+					break;
+				}
+				start = next->offset + next->bytes;
+			}
+		}
+		/* No room: the least recently used sprite is evicted */
+		if (sprite == NULL){
+			lru->font = NULL;
+		}else{
+			sprite->offset = start;
+		}
+	}
+	/* Expand the glyph in the cache */
+	uint16_t bytes_row = (info->width + 7) / 8;
+	const uint8_t * bitmap = &font->data[info->offset];
+	uint8_t * p = &glyph_cache[sprite->offset];
+	for (uint16_t r = 0; r < font->font_height; r++){
+		const uint8_t * row = &bitmap[r * bytes_row];
+		for (uint16_t j = 0; j < info->width; j++){
+			uint16_t color = (row[j / 8] & (MSK_BIT8 >> (j % 8))) ? foreground : background;
+			*p++ = HighByte(color);
+			*p++ = LowByte(color);
+		}
+	}
+	sprite->font = font;
+	sprite->data = data;
+	sprite->foreground = foreground;
+	sprite->background = background;
+	sprite->bytes = bytes;
+	sprite->last_use = glyph_uses;
+	return sprite;
+}
+#endif
+
 /*==================[external functions definition]==========================*/
 
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
@@ -278,6 +559,8 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	ili9341_rst = gpio_rst;
 	GPIOInit(ili9341_dc, GPIO_OUTPUT);
 	GPIOInit(ili9341_rst, GPIO_OUTPUT);
+	/* The device is added to the bus once */
+	SpiInit(&spi_conf);
 
 	/* RST must be held low for minimum 10µsec after VCC have been applied */
 	DelayUs(10);
@@ -311,7 +594,7 @@ void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
 }
 
 void ILI9341Fill(uint16_t color){
-	Fill(0, 0, lcd_orientation.width, lcd_orientation.height, color);
+	Fill(0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1, color);
 }
 
 void ILI9341Rotate(ili9341_orientation_t orientation){
@@ -350,73 +633,44 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	char_info_t * info = &font->info[data - ' '];
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + font->info[data - ' '].width) > lcd_orientation.width)	{
+	if ((lcd_x + info->width) > lcd_orientation.width)	{
 		lcd_y += font->font_height;
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+#if GLYPH_CACHE_SIZE > 0
+	/* Cached glyphs are written straight from RAM */
+	glyph_sprite_t * sprite = GlyphCacheGet(font, data, foreground, background);
+	if (sprite != NULL){
+		if (info->width == 0){
+			return;
 		}
+		SetCursorPosition(lcd_x, lcd_y, lcd_x + info->width - 1, lcd_y + font->font_height - 1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		WriteData(&glyph_cache[sprite->offset], (int32_t)info->width * font->font_height * 2, MAX_DMA_SIZE, false);
+		return;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+#endif
+	/* Draw font data: the whole character is written as one window */
+	DrawBitmap(lcd_x, lcd_y, info->width, font->font_height, &font->data[info->offset], foreground, background);
+}
+
+void ILI9341GetGlyphCacheStats(uint32_t * hits, uint32_t * misses){
+	*hits = glyph_hits;
+	*misses = glyph_misses;
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -428,49 +682,8 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
-	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	/* Draw icon data: the whole icon is written as one window */
+	DrawBitmap(lcd_x, lcd_y, icon_font->width, icon_font->height, &icon_font->data[icon * icon_font->offset], foreground, background);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
@@ -536,6 +749,7 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static uint16_t run_x, run_y, next_x, next_y;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -573,37 +787,89 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	if (x_dist == 0 || y_dist == 0){
 		Fill(x0, y0, x1, y1, color);
 	}
-	/* Diagonal line */
+	/* Diagonal line: consecutive points with the same row (or column if the line is
+	   more vertical than horizontal) are drawn as one span */
 	else{
 		error = x_dist - y_dist;
+		run_x = x0;
+		run_y = y0;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
 			if (x0 == x1 && y0 == y1){
+				Fill(run_x, run_y, x0, y0, color);
 				break;
 			}
 			error_2 = 2 * error;
+			next_x = x0;
+			next_y = y0;
 			/* Determine if line must grow in x direction */
 			if (error_2 > -y_dist){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
+				next_x += x_grow;	/* Move start point */
 			}
 			/* Determine if line must grow in y direction */
 			if (error_2 < x_dist){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+				next_y += y_grow;	/* Move start point */
+			}
+			/* Draw the run when leaving its row (or column) */
+			if ((x_dist >= y_dist) ? (next_y != y0) : (next_x != x0)){
+				Fill(run_x, run_y, x0, y0, color);
+				run_x = next_x;
+				run_y = next_y;
 			}
+			x0 = next_x;
+			y0 = next_y;
 		}
 	}
 }
 
+void ILI9341DrawHLine(int16_t x0, int16_t x1, int16_t y, uint16_t color){
+	int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	/* Clip to the screen */
+	if (y < 0 || y >= lcd_orientation.height || x1 < 0 || x0 >= lcd_orientation.width){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	Fill(x0, y, x1, y, color);
+}
+
+void ILI9341DrawVLine(int16_t x, int16_t y0, int16_t y1, uint16_t color){
+	int16_t aux;
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Clip to the screen */
+	if (x < 0 || x >= lcd_orientation.width || y1 < 0 || y0 >= lcd_orientation.height){
+		return;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	Fill(x, y0, x, y1, color);
+}
+
 void ILI9341DrawRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	ILI9341DrawLine(x0, y0, x1, y0, color);		/* Draw top line */
-	ILI9341DrawLine(x1, y0, x1, y1, color);		/* Draw right line */
-	ILI9341DrawLine(x0, y1, x1, y1, color);		/* Draw bottom line */
-	ILI9341DrawLine(x0, y0, x0, y1, color);		/* Draw left line */
+	ILI9341DrawHLine(x0, x1, y0, color);		/* Draw top line */
+	ILI9341DrawVLine(x1, y0, y1, color);		/* Draw right line */
+	ILI9341DrawHLine(x0, x1, y1, color);		/* Draw bottom line */
+	ILI9341DrawVLine(x0, y0, y1, color);		/* Draw left line */
 }
 
 void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
@@ -647,19 +913,18 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	static int16_t f, ddF_x, ddF_y, x, y, x_prev, y_prev;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
+	x_prev = 0;
+	y_prev = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
+	/* Each row of the circle is drawn once, as a single span */
+	ILI9341DrawHLine(x0 - r, x0 + r, y0, color);
 
     while (x < y){
         if (f >= 0){
@@ -671,11 +936,20 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         ddF_x += 2;
         f += ddF_x;
 
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
+		/* Rows y0 +/- x: x grows on every step, so they are new rows */
+		if (x <= y){
+			ILI9341DrawHLine(x0 - y, x0 + y, y0 + x, color);
+			ILI9341DrawHLine(x0 - y, x0 + y, y0 - x, color);
+		}
+		/* Rows y0 +/- y: drawn with the widest x when y changes */
+		if (y != y_prev){
+			if (y_prev > x_prev){
+				ILI9341DrawHLine(x0 - x_prev, x0 + x_prev, y0 + y_prev, color);
+				ILI9341DrawHLine(x0 - x_prev, x0 + x_prev, y0 - y_prev, color);
+			}
+			y_prev = y;
+		}
+		x_prev = x;
     }
 }
 
@@ -747,7 +1021,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			ILI9341DrawHLine((int)curx1, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -761,7 +1035,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			ILI9341DrawHLine((int)curx1, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
@@ -778,7 +1052,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			ILI9341DrawHLine((int)curx1, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -790,19 +1064,18 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			ILI9341DrawHLine((int)curx1, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
+		ILI9341DrawHLine(x_1, x_aux, y_1, color);
   	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
 	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint8_t buf = 0;
 
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
@@ -813,21 +1086,97 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	/* Pictures in flash are copied to RAM by blocks (DMA can't read flash), each block
+	   is copied while the previous one is written */
+	while (bytes_count > 0){
+		int32_t n = (bytes_count > BITMAP_BUFFER_SIZE) ? BITMAP_BUFFER_SIZE : bytes_count;
+		for (int32_t i = 0; i < n; i++){
+			bitmap_buffer[buf][i] = pic[i];
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+		WriteDataStart(bitmap_buffer[buf], n, MAX_DMA_SIZE, false, NULL, NULL);
+		pic += n;
+		bytes_count -= n;
+		buf ^= 1;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	WriteDataWait();
+}
+
+void ILI9341DrawPictureRLE(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* rle){
+	uint32_t pixels = (uint32_t)width * height;
+	uint16_t count = 0;				/* Pixels left in the current packet */
+	bool run = false;				/* Current packet is a run of one color */
+	uint8_t buf = 0;
+
+	if (pixels == 0){
+		return;
+	}
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+
+	while (pixels > 0){
+		uint8_t * p = bitmap_buffer[buf];
+		uint32_t n = (pixels > BITMAP_BUFFER_SIZE / 2) ? BITMAP_BUFFER_SIZE / 2 : pixels;
+		/* Decode the next pixels while the other buffer is written */
+		for (uint32_t i = 0; i < n; i++){
+			if (count == 0){
+				run = (*rle & RLE_RUN) != 0;
+				count = (*rle & ~RLE_RUN) + 1;
+				rle++;
+			}
+			*p++ = rle[0];
+			*p++ = rle[1];
+			count--;
+			/* A run keeps its color until the last pixel */
+			if (!run || count == 0){
+				rle += 2;
+			}
+		}
+		WriteDataStart(bitmap_buffer[buf], n * 2, MAX_DMA_SIZE, false, NULL, NULL);
+		pixels -= n;
+		buf ^= 1;
+	}
+	WriteDataWait();
+}
+
+void ILI9341DrawWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels){
+	if (width == 0 || height == 0){
+		return;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	WriteData((const uint8_t *)pixels, (int32_t)width * height * 2, MAX_DMA_SIZE, false);
+}
+
+void ILI9341DrawWindowStart(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels){
+	if (width == 0 || height == 0){
+		return;
+	}
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	WriteDataStart((const uint8_t *)pixels, (int32_t)width * height * 2, MAX_DMA_SIZE, false, NULL, NULL);
+}
+
+void ILI9341DrawWindowNotify(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* pixels,
+							 void (*func_p)(void*), void *param_p){
+	if (width == 0 || height == 0){
+		func_p(param_p);
+		return;
+	}
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	WriteDataStart((const uint8_t *)pixels, (int32_t)width * height * 2, MAX_DMA_SIZE, false, func_p, param_p);
+}
+
+void ILI9341DrawWindowWait(void){
+	WriteDataWait();
 }
 
 uint8_t ILI9341DeInit(void){
@@ -0,0 +1,252 @@
+/**
+ * @file ili9341_canvas.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ili9341_canvas.h"
+#include "ili9341.h"
+/*==================[macros and definitions]=================================*/
+#define MSK_BIT8 0x80				/*!< 8th bit mask */
+/** @brief RGB565 color in LCD byte order (high byte first) */
+#define LCD_COLOR(c) ((uint16_t)(((c) >> 8) | ((c) << 8)))
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		Add rows (canvas coordinates) to the area to flush
+ */
+static void CanvasDirty(ili9341_canvas_t * canvas, int16_t y0, int16_t y1);
+
+/**
+ * @brief  		Draw a 1 bit per pixel bitmap (font or icon format, MSB first)
+ */
+static void CanvasDrawBitmap(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t width, uint16_t height,
+							 const uint8_t * data, uint16_t foreground, uint16_t background);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void CanvasDirty(ili9341_canvas_t * canvas, int16_t y0, int16_t y1){
+	if (!canvas->dirty){
+		canvas->dirty_y0 = y0;
+		canvas->dirty_y1 = y1;
+		canvas->dirty = true;
+	}
+	else{
+		if (y0 < canvas->dirty_y0){
+			canvas->dirty_y0 = y0;
+		}
+		if (y1 > canvas->dirty_y1){
+			canvas->dirty_y1 = y1;
+		}
+	}
+}
+
+static void CanvasDrawBitmap(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t width, uint16_t height,
+							 const uint8_t * data, uint16_t foreground, uint16_t background){
+	uint16_t bytes_row = (width + 7) / 8;
+	uint16_t fg = LCD_COLOR(foreground);
+	uint16_t bg = LCD_COLOR(background);
+	/* Bitmap area clipped to the canvas (canvas coordinates) */
+	int16_t cx = x - canvas->x;
+	int16_t cy = y - canvas->y;
+	int16_t i0 = (cy < 0) ? -cy : 0;
+	int16_t j0 = (cx < 0) ? -cx : 0;
+	int16_t i1 = (cy + height > canvas->height) ? canvas->height - cy : height;
+	int16_t j1 = (cx + width > canvas->width) ? canvas->width - cx : width;
+	if (i0 >= i1 || j0 >= j1){
+		return;
+	}
+	for (int16_t i = i0; i < i1; i++){
+		const uint8_t * row = &data[i * bytes_row];
+		uint16_t * pixel = &canvas->buffer[(cy + i) * canvas->width + cx];
+		for (int16_t j = j0; j < j1; j++){
+			pixel[j] = (row[j / 8] & (MSK_BIT8 >> (j % 8))) ? fg : bg;
+		}
+	}
+	CanvasDirty(canvas, cy + i0, cy + i1 - 1);
+}
+/*==================[external functions definition]==========================*/
+void ILI9341CanvasInit(ili9341_canvas_t * canvas, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t * buffer){
+	canvas->x = x;
+	canvas->y = y;
+	canvas->width = width;
+	canvas->height = height;
+	canvas->buffer = buffer;
+	canvas->dirty = false;
+	CanvasDirty(canvas, 0, height - 1);
+}
+
+void ILI9341CanvasFill(ili9341_canvas_t * canvas, uint16_t color){
+	uint16_t c = LCD_COLOR(color);
+	uint32_t n = (uint32_t)canvas->width * canvas->height;
+	for (uint32_t i = 0; i < n; i++){
+		canvas->buffer[i] = c;
+	}
+	CanvasDirty(canvas, 0, canvas->height - 1);
+}
+
+void ILI9341CanvasDrawPixel(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t color){
+	int16_t cx = x - canvas->x;
+	int16_t cy = y - canvas->y;
+	if (cx < 0 || cy < 0 || cx >= canvas->width || cy >= canvas->height){
+		return;
+	}
+	canvas->buffer[cy * canvas->width + cx] = LCD_COLOR(color);
+	CanvasDirty(canvas, cy, cy);
+}
+
+void ILI9341CanvasDrawFilledRectangle(ili9341_canvas_t * canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Clip to the canvas (canvas coordinates) */
+	x0 -= canvas->x;
+	x1 -= canvas->x;
+	y0 -= canvas->y;
+	y1 -= canvas->y;
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= canvas->width){
+		x1 = canvas->width - 1;
+	}
+	if (y1 >= canvas->height){
+		y1 = canvas->height - 1;
+	}
+	if (x0 > x1 || y0 > y1){
+		return;
+	}
+	uint16_t c = LCD_COLOR(color);
+	for (int16_t i = y0; i <= y1; i++){
+		uint16_t * pixel = &canvas->buffer[i * canvas->width];
+		for (int16_t j = x0; j <= x1; j++){
+			pixel[j] = c;
+		}
+	}
+	CanvasDirty(canvas, y0, y1);
+}
+
+void ILI9341CanvasDrawLine(ili9341_canvas_t * canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t x_dist = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int16_t y_dist = (y1 > y0) ? y1 - y0 : y0 - y1;
+	int16_t x_grow = (x0 > x1) ? -1 : 1;
+	int16_t y_grow = (y0 > y1) ? -1 : 1;
+	int16_t error = x_dist - y_dist;
+	int16_t error_2;
+
+	while (1){
+		ILI9341CanvasDrawPixel(canvas, x0, y0, color);
+		if (x0 == x1 && y0 == y1){
+			break;
+		}
+		error_2 = 2 * error;
+		/* Determine if line must grow in x direction */
+		if (error_2 > -y_dist){
+			error -= y_dist;
+			x0 += x_grow;
+		}
+		/* Determine if line must grow in y direction */
+		if (error_2 < x_dist){
+			error += x_dist;
+			y0 += y_grow;
+		}
+	}
+}
+
+uint16_t ILI9341CanvasDrawChar(ili9341_canvas_t * canvas, int16_t x, int16_t y, char data, Font_t * font, uint16_t foreground, uint16_t background){
+	char_info_t * info = &font->info[data - ' '];
+	CanvasDrawBitmap(canvas, x, y, info->width, font->font_height, &font->data[info->offset], foreground, background);
+	return info->width;
+}
+
+void ILI9341CanvasDrawString(ili9341_canvas_t * canvas, int16_t x, int16_t y, char * str, Font_t * font, uint16_t foreground, uint16_t background){
+	int16_t lcd_x = x;
+	int16_t lcd_y = y;
+
+	while (*str != '\0'){
+		/* New line */
+		if (*str == '\n'){
+			lcd_y += font->font_height + 1;
+			lcd_x = x;
+		}
+		else if (*str != '\r'){
+			lcd_x += ILI9341CanvasDrawChar(canvas, lcd_x, lcd_y, *str, font, foreground, background) + 1;
+		}
+		str++;
+	}
+}
+
+void ILI9341CanvasDrawIcon(ili9341_canvas_t * canvas, int16_t x, int16_t y, icon_t icon, icon_font_t * icon_font, uint16_t foreground, uint16_t background){
+	CanvasDrawBitmap(canvas, x, y, icon_font->width, icon_font->height, &icon_font->data[icon * icon_font->offset], foreground, background);
+}
+
+void ILI9341CanvasDrawPicture(ili9341_canvas_t * canvas, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t * pic){
+	int16_t cx = x - canvas->x;
+	int16_t cy = y - canvas->y;
+	int16_t i0 = (cy < 0) ? -cy : 0;
+	int16_t j0 = (cx < 0) ? -cx : 0;
+	int16_t i1 = (cy + height > canvas->height) ? canvas->height - cy : height;
+	int16_t j1 = (cx + width > canvas->width) ? canvas->width - cx : width;
+	if (i0 >= i1 || j0 >= j1){
+		return;
+	}
+	for (int16_t i = i0; i < i1; i++){
+		/* Pictures are already in LCD byte order */
+		const uint8_t * src = &pic[(i * width) * 2];
+		uint8_t * pixel = (uint8_t *)&canvas->buffer[(cy + i) * canvas->width + cx];
+		for (int16_t j = j0 * 2; j < j1 * 2; j++){
+			pixel[j] = src[j];
+		}
+	}
+	CanvasDirty(canvas, cy + i0, cy + i1 - 1);
+}
+
+void ILI9341CanvasFlush(ili9341_canvas_t * canvas){
+	if (!canvas->dirty){
+		return;
+	}
+	ILI9341DrawWindow(canvas->x, canvas->y + canvas->dirty_y0, canvas->width, canvas->dirty_y1 - canvas->dirty_y0 + 1,
+					  &canvas->buffer[canvas->dirty_y0 * canvas->width]);
+	canvas->dirty = false;
+}
+
+void ILI9341CanvasRender(ili9341_strips_t * strips, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+						 void (*render_p)(ili9341_canvas_t * canvas, void * param), void * param_p){
+	ili9341_canvas_t strip;
+	uint16_t strip_height = strips->pixels / width;
+	uint8_t buf = 0;
+	if (strip_height == 0){
+		return;
+	}
+	for (uint16_t row = 0; row < height; row += strip_height){
+		uint16_t rows = (height - row < strip_height) ? height - row : strip_height;
+		/* The other buffer may still be in flight, this one was finished before it started */
+		ILI9341CanvasInit(&strip, x, y + row, width, rows, strips->buffer[buf]);
+		render_p(&strip, param_p);
+		ILI9341DrawWindowStart(x, y + row, width, rows, strip.buffer);
+		buf ^= 1;
+	}
+	ILI9341DrawWindowWait();
+}
+
+/*==================[end of file]============================================*/
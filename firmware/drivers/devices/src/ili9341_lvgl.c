@@ -0,0 +1,87 @@
+/**
+ * @file ili9341_lvgl.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ili9341_lvgl.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+/*==================[macros and definitions]=================================*/
+/** @brief Pixels of each partial buffer: lines of the longest side (landscape) */
+#define LVGL_BUFFER_PIXELS	(ILI9341_HEIGHT * CONFIG_DRIVERS_LVGL_BUFFER_LINES)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		End of the window write of a flush (SPI ISR): the buffer can be rendered again
+ */
+static void LvglFlushReady(void *param);
+
+/**
+ * @brief  		LVGL flush callback: write a rendered area
+ */
+static void LvglFlush(lv_display_t * display, const lv_area_t * area, uint8_t * px_map);
+
+/**
+ * @brief  		LVGL tick (ms)
+ */
+static uint32_t LvglTick(void);
+/*==================[internal data definition]===============================*/
+WORD_ALIGNED_ATTR DMA_ATTR static uint16_t lvgl_buffer[2][LVGL_BUFFER_PIXELS];	/*!< Partial render buffers */
+static lv_display_t * lvgl_display = NULL;		/*!< LVGL display of the LCD */
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void IRAM_ATTR LvglFlushReady(void *param){
+	lv_display_flush_ready(param);
+}
+
+static void LvglFlush(lv_display_t * display, const lv_area_t * area, uint8_t * px_map){
+	uint16_t width = lv_area_get_width(area);
+	uint16_t height = lv_area_get_height(area);
+	/* LVGL renders RGB565 in CPU byte order, the LCD takes the high byte first */
+	lv_draw_sw_rgb565_swap(px_map, (uint32_t)width * height);
+	ILI9341DrawWindowNotify(area->x1, area->y1, width, height, (const uint16_t *)px_map, LvglFlushReady, display);
+}
+
+static uint32_t LvglTick(void){
+	return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+/*==================[external functions definition]==========================*/
+lv_display_t * ILI9341LvglInit(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst, ili9341_orientation_t orientation){
+	uint16_t width = ILI9341_WIDTH, height = ILI9341_HEIGHT;
+	if (!ILI9341Init(spi_dev, gpio_dc, gpio_rst)){
+		return NULL;
+	}
+	ILI9341Rotate(orientation);
+	if (orientation == ILI9341_Landscape_1 || orientation == ILI9341_Landscape_2){
+		width = ILI9341_HEIGHT;
+		height = ILI9341_WIDTH;
+	}
+	if (!lv_is_initialized()){
+		lv_init();
+	}
+	lv_tick_set_cb(LvglTick);
+	lvgl_display = lv_display_create(width, height);
+	if (lvgl_display == NULL){
+		return NULL;
+	}
+	lv_display_set_color_format(lvgl_display, LV_COLOR_FORMAT_RGB565);
+	lv_display_set_flush_cb(lvgl_display, LvglFlush);
+	/* Two buffers: one is rendered while DMA writes the other */
+	lv_display_set_buffers(lvgl_display, lvgl_buffer[0], lvgl_buffer[1], sizeof(lvgl_buffer[0]),
+						   LV_DISPLAY_RENDER_MODE_PARTIAL);
+	return lvgl_display;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,91 @@
+/**
+ * @file ili9341_text.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "ili9341_text.h"
+#include "ili9341.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define CHAR_SPACE 1				/*!< Columns between characters (as ILI9341DrawString) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		Redraw the characters of value that differ from the ones shown
+ */
+static void TextDraw(ili9341_text_t * text);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void TextDraw(ili9341_text_t * text){
+	uint16_t height = text->font->font_height;
+	uint16_t x_shown = 0, x_value = 0;
+	bool shown_end = false;
+
+	for (uint8_t i = 0; text->value[i] != '\0'; i++){
+		uint16_t width = text->font->info[text->value[i] - ' '].width;
+		/* A character is kept if it's the same at the same position */
+		if (shown_end || text->shown[i] != text->value[i] || x_shown != x_value){
+			ILI9341DrawChar(text->x + x_value, text->y, text->value[i], text->font, text->foreground, text->background);
+			/* The space after it is cleared only where the previous string was drawn */
+			if (x_value + width < text->width){
+				ILI9341DrawVLine(text->x + x_value + width, text->y, text->y + height - 1, text->background);
+			}
+		}
+		if (!shown_end){
+			if (text->shown[i] == '\0'){
+				shown_end = true;
+			}else{
+				x_shown += text->font->info[text->shown[i] - ' '].width + CHAR_SPACE;
+			}
+		}
+		x_value += width + CHAR_SPACE;
+	}
+	/* Columns of the previous string beyond the new one */
+	if (x_value < text->width){
+		ILI9341DrawFilledRectangle(text->x + x_value, text->y, text->x + text->width - 1, text->y + height - 1, text->background);
+	}
+	text->width = x_value;
+	strcpy(text->shown, text->value);
+	text->last_draw = esp_timer_get_time();
+}
+
+/*==================[external functions definition]==========================*/
+void ILI9341TextInit(ili9341_text_t * text){
+	text->shown[0] = '\0';
+	text->value[0] = '\0';
+	text->width = 0;
+	text->last_draw = 0;
+}
+
+bool ILI9341TextSet(ili9341_text_t * text, const char * str){
+	strncpy(text->value, str, ILI9341_TEXT_MAX);
+	text->value[ILI9341_TEXT_MAX] = '\0';
+	return ILI9341TextUpdate(text);
+}
+
+bool ILI9341TextUpdate(ili9341_text_t * text){
+	/* Nothing changed since the last redraw, or too soon */
+	if (strcmp(text->value, text->shown) == 0){
+		return false;
+	}
+	if (text->last_draw != 0 && esp_timer_get_time() - text->last_draw < (int64_t)text->period * 1000){
+		return false;
+	}
+	TextDraw(text);
+	return true;
+}
+
+/*==================[end of file]============================================*/
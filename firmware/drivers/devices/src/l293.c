@@ -13,6 +13,7 @@
 #include "l293.h"
 #include "gpio_mcu.h"
 #include "pwm_mcu.h"
+#include "motion.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_F_SPEED 	100		/*!< Max foward speed  */
 #define MAX_B_SPEED 	-100	/*!< Max backward speed */
@@ -24,16 +25,64 @@
 #define EN_3_4			GPIO_19
 #define A_3				GPIO_18
 #define A_4				GPIO_9
+#define RAMP_RATE		200		/*!< Default speed change of ramps (%/s) */
+#define RAMP_ACCEL		800		/*!< Default acceleration of the speed change of ramps (%/s^2) */
 /*==================[typedef]================================================*/
-
+/**
+ * @brief Pins of a motor
+ */
+typedef struct {
+	pwm_out_t en;
+	gpio_t a_f;		/*!< On for foward */
+	gpio_t a_b;		/*!< On for backward */
+} l293_pins_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static const l293_pins_t l293_pins[N_MOTORS] = {
+	{PWM_0, A_1, A_2},
+	{PWM_1, A_3, A_4},
+};
+static int8_t motor_speed[N_MOTORS];
+static int8_t motor_axis[N_MOTORS] = {-1, -1};
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Set the speed of a motor (also output of the motion axes)
+ */
+static void L293Output(uint8_t motor, int32_t speed){
+	const l293_pins_t *pins = &l293_pins[motor];
+	if(speed > MAX_F_SPEED){
+		speed = MAX_F_SPEED;
+	} else if(speed < MAX_B_SPEED){
+		speed = MAX_B_SPEED;
+	}
+	motor_speed[motor] = speed;
+	if(speed == 0){
+		PWMSetDutyCycle(pins->en, 0);
+		GPIOOff(pins->a_f);
+		GPIOOff(pins->a_b);
+	} else if(speed > 0){
+		PWMSetDutyCycle(pins->en, speed);
+		GPIOOff(pins->a_b);
+		GPIOOn(pins->a_f);
+	} else{
+		PWMSetDutyCycle(pins->en, -speed);
+		GPIOOff(pins->a_f);
+		GPIOOn(pins->a_b);
+	}
+}
 
+/**
+ * @brief Motion axis of a motor, created on the first ramp
+ */
+static int8_t L293Axis(l293_motor_t motor){
+	if(motor_axis[motor] < 0 && MotionInit(MOTION_RATE_HZ)){
+		motor_axis[motor] = MotionAxisCreate(L293Output, motor, motor_speed[motor], RAMP_RATE, RAMP_ACCEL);
+	}
+	return motor_axis[motor];
+}
 /*==================[external data definition]===============================*/
 
 /*==================[external functions definition]==========================*/
@@ -49,56 +98,49 @@ uint8_t L293Init(void){
 }
 
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed){
-	uint8_t err = 0;
+	if(motor >= N_MOTORS){
+		return 1;
+	}
+	// stops a ramp in progress
+	MotionSetPosition(motor_axis[motor], speed);
+	L293Output(motor, speed);
+	return 0;
+}
 
-	switch(motor){
-	case MOTOR_1:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOff(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_0, -speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
-		break;
-	case MOTOR_2:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOff(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_1, -speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
-		break;
-	default:
-		err = 1;
-		break;
+uint8_t L293SetSpeedRamp(l293_motor_t motor, int8_t speed){
+	if(motor >= N_MOTORS){
+		return 1;
+	}
+	int8_t axis = L293Axis(motor);
+	if(axis < 0){
+		return L293SetSpeed(motor, speed);
 	}
+	if(speed > MAX_F_SPEED){
+		speed = MAX_F_SPEED;
+	} else if(speed < MAX_B_SPEED){
+		speed = MAX_B_SPEED;
+	}
+	MotionMoveTo(axis, speed);
+	return 0;
+}
 
-	return err;
+uint8_t L293SetRamp(l293_motor_t motor, uint16_t rate, uint16_t accel){
+	if(motor >= N_MOTORS || rate == 0 || accel == 0){
+		return 1;
+	}
+	int8_t axis = L293Axis(motor);
+	if(axis < 0){
+		return 1;
+	}
+	MotionSetLimits(axis, rate, accel);
+	return 0;
 }
 
 uint8_t L293DeInit(void){
+	for(uint8_t i = 0; i < N_MOTORS; i++){
+		MotionSetPosition(motor_axis[i], 0);
+		motor_speed[i] = 0;
+	}
 	PWMOff(PWM_0);
 	PWMOff(PWM_1);
 	return 1;
@@ -12,6 +12,8 @@
 /*==================[inclusions]=============================================*/
 #include "lcditse0803.h"
 #include "gpio_mcu.h"
+#include <stddef.h>
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_BCD_1	GPIO_20
 #define GPIO_BCD_2	GPIO_21
@@ -20,18 +22,48 @@
 #define GPIO_SEL_1	GPIO_19
 #define GPIO_SEL_2	GPIO_18
 #define GPIO_SEL_3	GPIO_9
+#define BCD_MASK	(GPIO_MASK(GPIO_BCD_1) | GPIO_MASK(GPIO_BCD_2) | GPIO_MASK(GPIO_BCD_3) | GPIO_MASK(GPIO_BCD_4))
+#define SEL_MASK	(GPIO_MASK(GPIO_SEL_1) | GPIO_MASK(GPIO_SEL_2) | GPIO_MASK(GPIO_SEL_3))
+#define DIGITS		3
+#define BCD_BLANK	0x0F		/*!< BCD code that turns a digit off */
+#define LCD_OFF		0x8000		/*!< Flag of display_value: display turned off */
+#define LATCH_NONE	0xFFFF		/*!< latched_value before the first refresh */
+#define REFRESH_US	10000		/*!< Refresh period (10 ms) */
 /*==================[internal data definition]===============================*/
-static uint16_t actual_value = 0; /*variable that saves the value to be shown in the display LCD*/
+static volatile uint16_t display_value = 0; /*value to be shown in the display LCD (and LCD_OFF flag)*/
+static uint16_t latched_value = LATCH_NONE;	/*value latched in the display*/
+static esp_timer_handle_t refresh_timer = NULL;
+static const uint32_t sel_pin[DIGITS] = {GPIO_MASK(GPIO_SEL_1), GPIO_MASK(GPIO_SEL_2), GPIO_MASK(GPIO_SEL_3)};
 /*==================[internal functions declaration]=========================*/
-/** @brief Aux function to load a digit to the LCD Display
+/** @brief Aux function to load the digits to the LCD Display
  *
+ * Each digit is latched with one write of its BCD code and select pin (the
+ * BCD pins are consecutive) and the falling edge of the select pin.
  */
-bool LcdItsE0803BCDtoPin(uint8_t value){
-	GPIOState(GPIO_BCD_1, (value & (1<<0))>>0);
-	GPIOState(GPIO_BCD_2, (value & (1<<1))>>1);
-	GPIOState(GPIO_BCD_3, (value & (1<<2))>>2);
-	GPIOState(GPIO_BCD_4, (value & (1<<3))>>3);
-	return true;
+static void LcdItsE0803Latch(uint16_t value){
+	uint32_t pattern[DIGITS];
+	if(value & LCD_OFF){
+		pattern[0] = pattern[1] = pattern[2] = (uint32_t)BCD_BLANK << GPIO_BCD_1;
+	}
+	else{
+		pattern[0] = (uint32_t)(value / 100) << GPIO_BCD_1;
+		pattern[1] = (uint32_t)((value / 10) % 10) << GPIO_BCD_1;
+		pattern[2] = (uint32_t)(value % 10) << GPIO_BCD_1;
+	}
+	for(uint8_t i = 0; i < DIGITS; i++){
+		GPIOWriteMask(BCD_MASK | SEL_MASK, pattern[i] | sel_pin[i]);
+		GPIOWriteMask(sel_pin[i], 0);
+	}
+}
+
+/** @brief Refresh: latches the display only when the value changes
+ */
+static void LcdItsE0803Refresh(void *param){
+	uint16_t value = display_value;
+	if(value != latched_value){
+		LcdItsE0803Latch(value);
+		latched_value = value;
+	}
 }
 /*==================[external functions definition]==========================*/
 bool LcdItsE0803Init(void){
@@ -46,34 +78,25 @@ bool LcdItsE0803Init(void){
 	GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
 	GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
 
-	actual_value=0;
-	LcdItsE0803Write(actual_value);
+	display_value = 0;
+	latched_value = LATCH_NONE;
+	LcdItsE0803Refresh(NULL);
+	if(refresh_timer == NULL){
+		esp_timer_create_args_t timer_args = {
+			.callback = LcdItsE0803Refresh,
+			.name = "lcditse0803"
+		};
+		if(esp_timer_create(&timer_args, &refresh_timer) != ESP_OK){
+			return false;
+		}
+	}
+	esp_timer_start_periodic(refresh_timer, REFRESH_US);
 	return true;
 };
 
-bool LcdItsE0803Write(uint16_t value) {
-	uint8_t units, tens, hundreds;
+bool IRAM_ATTR LcdItsE0803Write(uint16_t value) {
 	if(value<1000)	 {
-		actual_value = value;
-
-		hundreds = value/100;
-		tens = (value-(hundreds*100))/10;
-		units = (value-(hundreds*100)-(tens*10));
-
-		/* Write hundreds */
-		LcdItsE0803BCDtoPin(hundreds);
-		GPIOOn(GPIO_SEL_1);
-		GPIOOff(GPIO_SEL_1);
-
-		/* Write tens */
-		LcdItsE0803BCDtoPin(tens);
-		GPIOOn(GPIO_SEL_2);
-		GPIOOff(GPIO_SEL_2);
-
-		/* Write units */
-		LcdItsE0803BCDtoPin(units);
-		GPIOOn(GPIO_SEL_3);
-		GPIOOff(GPIO_SEL_3);
+		display_value = value;
 		return true; /* return 1 for values lower than 999 */
 	}
 	else
@@ -81,24 +104,17 @@ bool LcdItsE0803Write(uint16_t value) {
 }
 
 uint16_t LcdItsE0803Read(void){
-	return (actual_value);
+	return (display_value & ~LCD_OFF);
 }
 
 void LcdItsE0803Off(void){
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_1);
-	GPIOOff(GPIO_SEL_1);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_2);
-	GPIOOff(GPIO_SEL_2);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_3);
-	GPIOOff(GPIO_SEL_3);
+	display_value |= LCD_OFF;
 }
 
 bool LcdItsE0803DeInit(void){
+	if(refresh_timer != NULL){
+		esp_timer_stop(refresh_timer);
+	}
 	GPIODeinit();
 	return true;
 }
@@ -2,7 +2,7 @@
   This is a library written for the Maxim MAX3010X Optical Smoke Detector
   It should also work with the MAX30102. However, the MAX30102 does not have a Green LED.
   These sensors use I2C to communicate, as well as a single (optional)
-  interrupt line that is not currently supported in this driver.
+  interrupt line, used by MAX3010X_startInterrupt to drain the FIFO when it's almost full.
   Written by Peter Jansen and Nathan Seidle (SparkFun)
   BSD license, all text above must be included in any redistribution.
  *****************************************************/
@@ -11,6 +11,15 @@
 #include "i2c_mcu.h"
 #include "string.h"
 #include "delay_mcu.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "static_alloc_mcu.h"
+#include "power_mcu.h"
+#include "driver/gpio.h"
+
+#define MAX3010X_TASK_STACK 	CONFIG_DRIVERS_MAX3010X_TASK_STACK
+#define MAX3010X_TASK_PRIO  	9
 
 
 uint8_t activeLEDs; //Gets set during setup. Allows check() to calculate how many bytes to read from FIFO
@@ -19,6 +28,16 @@ uint8_t revisionID;
 
 sense_struct sense;
 
+//Interrupt mode: the ISR wakes up the driver task, which drains the FIFO and calls the batch function
+static TaskHandle_t interruptTask = NULL;
+STATIC_TASK_DEFINE(interruptTask, MAX3010X_TASK_STACK);
+static MAX3010X_batch_func_t batchFunc;
+static void *batchParam;
+static uint32_t batchRed[MAX3010X_FIFO_DEPTH];
+static uint32_t batchIR[MAX3010X_FIFO_DEPTH];
+static gpio_t batchPin;
+static bool batchWake = false; //INT pin wakes up from light sleep: level interrupt, masked until the status is read
+
 // Status Registers
 static const uint8_t MAX3010X_INTSTAT1 =		0x00;
 static const uint8_t MAX3010X_INTSTAT2 =		0x01;
@@ -148,6 +167,10 @@ static const uint8_t MAX_30105_EXPECTEDPARTID = 0x15;
 bool MAX3010X_begin(void) {
 
 	I2C_initialize(400000);
+	// Shadow of the configuration registers: bitMask then writes without reading first
+	// (the die temperature config is left out, its enable bit clears on its own)
+	I2C_addShadow(MAX30105_ADDRESS, MAX3010X_INTENABLE1, MAX3010X_INTENABLE2 - MAX3010X_INTENABLE1 + 1);
+	I2C_addShadow(MAX30105_ADDRESS, MAX3010X_FIFOCONFIG, MAX3010X_MULTILEDCONFIG2 - MAX3010X_FIFOCONFIG + 1);
 
   // Step 1: Initial Communication and Verification
   // Check that a MAX3010X is connected
@@ -214,6 +237,8 @@ void MAX3010X_disableDIETEMPRDY(void) {
 
 void MAX3010X_softReset(void) {
   bitMask(MAX3010X_MODECONFIG, MAX3010X_RESET_MASK, MAX3010X_RESET);
+  // Registers are back to their POR values
+  I2C_invalidateShadow(MAX30105_ADDRESS);
 
   // Poll for bit to clear, reset is then complete
   // Timeout after 100ms
@@ -709,6 +734,102 @@ uint16_t MAX3010X_check(void)
   return (numberOfSamples); //Let the world know how much new data we found
 }
 
+//Number of samples waiting in the sensor FIFO
+//Pointers and overflow counter are read in one transaction: with equal pointers a
+//non zero overflow counter means the FIFO is full (samples were lost)
+static uint8_t MAX3010X_pendingSamples(void)
+{
+  uint8_t pointers[3]; //FIFO_WR_PTR, OVF_COUNTER, FIFO_RD_PTR
+  I2C_readBytes(MAX30105_ADDRESS, MAX3010X_FIFOWRITEPTR, 3, pointers, 0);
+
+  int numberOfSamples = (pointers[0] & 0x1F) - (pointers[2] & 0x1F);
+  if (numberOfSamples < 0) numberOfSamples += MAX3010X_FIFO_DEPTH; //Wrap condition
+  if (numberOfSamples == 0 && pointers[1] != 0) numberOfSamples = MAX3010X_FIFO_DEPTH;
+  return numberOfSamples;
+}
+
+//Drains the sensor FIFO with a single I2C burst into the caller's arrays
+//Returns number of samples copied (the rest stay in the sensor for the next call)
+uint8_t MAX3010X_readBatch(uint32_t *red, uint32_t *ir, uint8_t maxSamples)
+{
+  uint8_t buffer[MAX3010X_BATCH_BYTES];
+  uint8_t sampleBytes = activeLEDs * 3;
+  uint8_t numberOfSamples = MAX3010X_pendingSamples();
+
+  if (numberOfSamples > maxSamples) numberOfSamples = maxSamples;
+  //A full FIFO with Red+IR fits in one burst; with 3 LEDs it takes two calls
+  if (numberOfSamples > MAX3010X_BATCH_BYTES / sampleBytes) numberOfSamples = MAX3010X_BATCH_BYTES / sampleBytes;
+  if (numberOfSamples == 0) return 0;
+
+  //FIFO_DATA address doesn't auto increment: the whole burst reads the FIFO
+  I2C_readBytes(MAX30105_ADDRESS, MAX3010X_FIFODATA, numberOfSamples * sampleBytes, buffer, 0);
+
+  const uint8_t *sample = buffer;
+  for (uint8_t i = 0; i < numberOfSamples; i++)
+  {
+    //Three bytes per LED, MSB first, 18 bits
+    red[i] = (((uint32_t)sample[0] << 16) | ((uint32_t)sample[1] << 8) | sample[2]) & 0x3FFFF;
+    if (activeLEDs > 1 && ir != NULL)
+      ir[i] = (((uint32_t)sample[3] << 16) | ((uint32_t)sample[4] << 8) | sample[5]) & 0x3FFFF;
+    sample += sampleBytes;
+  }
+
+  return numberOfSamples;
+}
+
+//INT pin ISR (active low): defers the FIFO read to the driver task
+static void IRAM_ATTR MAX3010X_isr(void *param)
+{
+  BaseType_t taskWoken = pdFALSE;
+  if (batchWake) gpio_intr_disable((gpio_num_t)batchPin);
+  vTaskNotifyGiveFromISR(interruptTask, &taskWoken);
+  portYIELD_FROM_ISR(taskWoken);
+}
+
+//Driver task: sleeps until the FIFO is almost full, then hands out its samples
+static void MAX3010X_task(void *param)
+{
+  while (1)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    PowerAcquire(POWER_LOCK_BUS);
+    //Reading the status releases the INT pin, so the next A_FULL is a new edge
+    MAX3010X_getINT1();
+
+    uint8_t numberOfSamples;
+    while ((numberOfSamples = MAX3010X_readBatch(batchRed, batchIR, MAX3010X_FIFO_DEPTH)) > 0)
+      batchFunc(batchRed, batchIR, numberOfSamples, batchParam);
+    PowerRelease(POWER_LOCK_BUS);
+    if (batchWake) gpio_intr_enable((gpio_num_t)batchPin);
+  }
+}
+
+bool MAX3010X_startInterrupt(gpio_t intPin, uint8_t samples, MAX3010X_batch_func_t func_p, void *param_p)
+{
+  if (interruptTask != NULL || func_p == NULL) return false;
+
+  //A_FULL field is the number of free FIFO slots left when the interrupt asserts (0 to 15)
+  if (samples > MAX3010X_FIFO_DEPTH) samples = MAX3010X_FIFO_DEPTH;
+  if (samples < MAX3010X_FIFO_DEPTH - 15) samples = MAX3010X_FIFO_DEPTH - 15;
+
+  batchFunc = func_p;
+  batchParam = param_p;
+  STATIC_TASK_CREATE(interruptTask, MAX3010X_task, "MAX3010X", NULL, MAX3010X_TASK_PRIO, &interruptTask);
+
+  MAX3010X_setFIFOAlmostFull(MAX3010X_FIFO_DEPTH - samples);
+  MAX3010X_enableAFULL();
+
+  //INT is open drain: input with pull-up, asserted on the falling edge
+  GPIOInit(intPin, GPIO_INPUT);
+  GPIOActivInt(intPin, MAX3010X_isr, false, NULL);
+  batchPin = intPin;
+  batchWake = PowerWakeOnGpio(intPin, false);
+
+  //Drain what's already stored (the pin may be low since before the ISR was attached)
+  xTaskNotifyGive(interruptTask);
+  return true;
+}
+
 //Check for new data but give up after a certain amount of time
 //Returns true if new data was found
 //Returns false if new data was not found
@@ -728,16 +849,10 @@ bool MAX3010X_safeCheck(uint8_t maxTimeToCheck)
 }
 
 //Given a register, read it, mask it, and then set the thing
+//(configuration registers are taken from the I2C shadow, without reading them)
 void bitMask(uint8_t reg, uint8_t mask, uint8_t thing)
 {
-  // Grab current register context
-  uint8_t originalContents = readRegister8(reg);
-
-  // Zero-out the portions of the register we're interested in
-  originalContents = originalContents & mask;
-
-  // Change contents
-  writeRegister8(reg, originalContents | thing);
+  I2C_updateBits(MAX30105_ADDRESS, reg, ~mask, thing);
 }
 
 //
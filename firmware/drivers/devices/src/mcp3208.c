@@ -0,0 +1,186 @@
+/**
+ * @file mcp3208.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "mcp3208.h"
+#include <string.h>
+/*==================[macros and definitions]=================================*/
+#define CMD_START			0x04	/*!< Start bit (second byte of the command) */
+#define CMD_SINGLE			0x02	/*!< Single ended input (not differential) */
+#define TRANS_BYTES			4		/*!< Leading zeros, start, SGL, D2 | D1, D0 | 12 bits result */
+#define US_PER_S			1000000
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Command of a single ended conversion (leading zero byte so the transaction is a whole word)
+ */
+static uint32_t Mcp3208Command(uint8_t channel){
+	uint8_t cmd[TRANS_BYTES] = {0x00, CMD_START | CMD_SINGLE | (channel >> 2), (channel & 0x03) << 6, 0x00};
+	uint32_t word;
+	memcpy(&word, cmd, TRANS_BYTES);
+	return word;
+}
+
+/**
+ * @brief Result of a conversion (12 bits at the end of the transaction)
+ */
+static uint16_t Mcp3208Result(const uint32_t *rx){
+	const uint8_t *data = (const uint8_t *)rx;
+	return ((data[2] & 0x0F) << 8) | data[3];
+}
+
+/**
+ * @brief Queue the transactions of a scan and store their results in the current block
+ */
+static void Mcp3208Scan(mcp3208_t *adc){
+	mcp3208_block_t *block = &adc->blocks[adc->written % MCP3208_BLOCK_RING_SIZE];
+	if(adc->index == 0){
+		block->timestamp = TimerHandleGetAlarmTime(adc->timer);
+	}
+	// the SPI DMA converts the channels back to back, the task sleeps meanwhile
+	SpiAcquire(adc->config.device);
+	for(uint8_t i = 0; i < adc->scan_lenght; i++){
+		SpiQueue(adc->config.device, &adc->trans[i]);
+	}
+	for(uint8_t i = 0; i < adc->scan_lenght; i++){
+		spi_trans_t *trans = SpiGetResult(adc->config.device, SPI_WAIT_FOREVER);
+		uint8_t k = trans - adc->trans;
+		block->data[adc->scan[k]][adc->index] = Mcp3208Result(&adc->rx[k]);
+	}
+	SpiRelease(adc->config.device);
+	if(++adc->index < adc->config.frame_size){
+		return;
+	}
+	for(uint8_t ch = 0; ch < MCP3208_CH_NUM; ch++){
+		block->lenght[ch] = (adc->config.channels & (1 << ch)) ? adc->index : 0;
+	}
+	block->channels = adc->config.channels;
+	block->sample_frec = adc->config.sample_frec;
+	adc->index = 0;
+	__atomic_store_n(&adc->written, adc->written + 1, __ATOMIC_RELEASE);
+	if(adc->config.func_p != NULL){
+		((void (*)(void *))adc->config.func_p)(adc->config.param_p);
+	}
+}
+
+/**
+ * @brief Scan task: one scan on each alarm of the timer
+ */
+static void Mcp3208Task(void *param){
+	mcp3208_t *adc = param;
+	while(true){
+		uint32_t alarms = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!adc->running){
+			adc->index = 0;
+			continue;
+		}
+		// alarms while the previous scan was running
+		adc->overruns += alarms - 1;
+		if(adc->index == 0 && adc->written - __atomic_load_n(&adc->released, __ATOMIC_ACQUIRE) >= MCP3208_BLOCK_RING_SIZE){
+			// every block in use
+			adc->overruns++;
+			continue;
+		}
+		Mcp3208Scan(adc);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool Mcp3208Init(mcp3208_t *adc, const mcp3208_config_t *config){
+	if(config->channels == 0 || config->sample_frec == 0 || config->frame_size == 0 ||
+		config->frame_size > MCP3208_MAX_FRAME_SIZE){
+		return false;
+	}
+	memset(adc, 0, sizeof(mcp3208_t));
+	adc->config = *config;
+	for(uint8_t ch = 0; ch < MCP3208_CH_NUM; ch++){
+		if(config->channels & (1 << ch)){
+			uint8_t i = adc->scan_lenght++;
+			adc->scan[i] = ch;
+			adc->tx[i] = Mcp3208Command(ch);
+			adc->trans[i].tx_buffer = (uint8_t *)&adc->tx[i];
+			adc->trans[i].rx_buffer = (uint8_t *)&adc->rx[i];
+			adc->trans[i].lenght = TRANS_BYTES;
+		}
+	}
+	spi_mcu_config_t spi = {
+		.device = config->device,
+		.clk_mode = MODE0,
+		.bitrate = config->bitrate,
+		.transfer_mode = SPI_POLLING,
+	};
+	SpiInit(&spi);
+	timer_handle_config_t timer = {
+		.period = US_PER_S / config->sample_frec,
+		.mode = TIMER_PERIODIC,
+	};
+	adc->timer = TimerCreate(&timer);
+	if(adc->timer == NULL){
+		return false;
+	}
+	if(xTaskCreate(Mcp3208Task, "MCP3208", MCP3208_TASK_STACK, adc, MCP3208_TASK_PRIORITY, &adc->task) != pdPASS){
+		TimerDelete(adc->timer);
+		adc->timer = NULL;
+		return false;
+	}
+	TimerHandleNotifyTask(adc->timer, adc->task);
+	return true;
+}
+
+void Mcp3208Start(mcp3208_t *adc){
+	adc->running = true;
+	TimerHandleStart(adc->timer);
+}
+
+void Mcp3208Stop(mcp3208_t *adc){
+	TimerHandleStop(adc->timer);
+	adc->running = false;
+	// the task discards the block being filled
+	xTaskNotifyGive(adc->task);
+}
+
+uint16_t Mcp3208ReadSingle(mcp3208_t *adc, uint8_t channel){
+	uint32_t tx = Mcp3208Command(channel & (MCP3208_CH_NUM - 1));
+	uint32_t rx = 0;
+	SpiReadWrite(adc->config.device, (uint8_t *)&tx, (uint8_t *)&rx, TRANS_BYTES);
+	return Mcp3208Result(&rx);
+}
+
+mcp3208_block_t* Mcp3208GetBlock(mcp3208_t *adc){
+	if(adc->taken == __atomic_load_n(&adc->written, __ATOMIC_ACQUIRE)){
+		return NULL;
+	}
+	return &adc->blocks[adc->taken++ % MCP3208_BLOCK_RING_SIZE];
+}
+
+void Mcp3208ReleaseBlock(mcp3208_t *adc, mcp3208_block_t *block){
+	__atomic_store_n(&adc->released, adc->released + 1, __ATOMIC_RELEASE);
+}
+
+void Mcp3208BlockToFloat(const mcp3208_t *adc, const mcp3208_block_t *block, uint8_t channel, float *values){
+	float scale = (float)adc->config.vref / MCP3208_FULL_SCALE;
+	for(uint16_t i = 0; i < block->lenght[channel]; i++){
+		values[i] = block->data[channel][i] * scale;
+	}
+}
+
+uint32_t Mcp3208GetOverruns(const mcp3208_t *adc){
+	return adc->overruns;
+}
+
+/*==================[end of file]============================================*/
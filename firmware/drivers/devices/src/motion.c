@@ -0,0 +1,231 @@
+/**
+ * @file motion.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "motion.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define Q16_ONE         65536           // 1.0 in 16.16 fixed point
+#define US_PER_S        1000000
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Axis state (positions, speeds and accelerations in 16.16 per tick)
+ */
+typedef struct {
+	motion_output_t func_p;         // output function (NULL: axis not created)
+	uint8_t channel;                // output function parameter
+	bool moving;                    // target not reached
+	int64_t position;               // current position
+	int64_t target;                 // target position
+	int64_t speed;                  // current speed (per tick)
+	int64_t max_speed;              // max speed (per tick)
+	int64_t accel;                  // acceleration (per tick^2)
+	int32_t output;                 // last position sent to the output
+} motion_axis_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static motion_axis_t axes[MOTION_MAX_AXES];
+static esp_timer_handle_t motion_timer = NULL;
+static uint32_t rate = MOTION_RATE_HZ;
+static uint32_t period_us;
+static portMUX_TYPE axes_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static int64_t MotionSign(int64_t value){
+	return (value > 0) - (value < 0);
+}
+
+/**
+ * @brief Advance the profile of an axis one tick
+ *
+ * @return true if the axis is still moving
+ */
+static bool MotionStep(motion_axis_t *axis){
+	int64_t dist = axis->target - axis->position;
+	int64_t dir = MotionSign(dist);
+	int64_t v = axis->speed;
+	int64_t a = axis->accel;
+	// distance to stop from the current speed: v^2 / 2a
+	int64_t stop = (v * v) / (2 * a);
+	if(v * dir < 0 || stop >= dist * dir || v * MotionSign(v) > axis->max_speed){
+		// moving away, close to the target or too fast: decelerate
+		if(v * MotionSign(v) <= a){
+			v = 0;
+		}
+		else{
+			v -= MotionSign(v) * a;
+		}
+	}
+	else{
+		// accelerate (or cruise) towards the target
+		v += dir * a;
+		if(v * dir > axis->max_speed){
+			v = dir * axis->max_speed;
+		}
+	}
+	axis->position += v;
+	axis->speed = v;
+	dist = axis->target - axis->position;
+	// on the target (or went past it in the last tick): stop on it
+	if(MotionSign(dist) != dir || (v == 0 && dist * dir <= a)){
+		axis->position = axis->target;
+		axis->speed = 0;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Planner timer: advances every axis moving and updates its output
+ */
+static void MotionTimer(void *param){
+	int32_t outputs[MOTION_MAX_AXES];
+	bool changed[MOTION_MAX_AXES];
+	bool moving = false;
+	taskENTER_CRITICAL(&axes_mux);
+	for(uint8_t i = 0; i < MOTION_MAX_AXES; i++){
+		changed[i] = false;
+		if(axes[i].func_p == NULL || !axes[i].moving){
+			continue;
+		}
+		axes[i].moving = MotionStep(&axes[i]);
+		moving |= axes[i].moving;
+		int32_t output = (int32_t)((axes[i].position + Q16_ONE / 2) >> 16);
+		if(output != axes[i].output){
+			axes[i].output = output;
+			outputs[i] = output;
+			changed[i] = true;
+		}
+	}
+	taskEXIT_CRITICAL(&axes_mux);
+	// the outputs (i.e. LEDC updates) are called out of the critical section
+	for(uint8_t i = 0; i < MOTION_MAX_AXES; i++){
+		if(changed[i]){
+			axes[i].func_p(axes[i].channel, outputs[i]);
+		}
+	}
+	if(!moving){
+		esp_timer_stop(motion_timer);
+		// a move started before the timer was stopped must keep it running
+		for(uint8_t i = 0; i < MOTION_MAX_AXES; i++){
+			if(axes[i].moving){
+				esp_timer_start_periodic(motion_timer, period_us);
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Limits of an axis converted to 16.16 per tick (acceleration at least 1)
+ */
+static void MotionLimits(motion_axis_t *axis, uint32_t max_speed, uint32_t accel){
+	axis->max_speed = ((int64_t)max_speed * Q16_ONE) / rate;
+	axis->accel = ((int64_t)accel * Q16_ONE) / ((int64_t)rate * rate);
+	if(axis->accel < 1){
+		axis->accel = 1;
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool MotionInit(uint16_t rate_hz){
+	if(motion_timer != NULL){
+		return true;
+	}
+	if(rate_hz == 0 || rate_hz > 1000){
+		return false;
+	}
+	rate = rate_hz;
+	period_us = US_PER_S / rate;
+	esp_timer_create_args_t timer_args = {
+		.callback = MotionTimer,
+		.name = "motion"
+	};
+	return esp_timer_create(&timer_args, &motion_timer) == ESP_OK;
+}
+
+int8_t MotionAxisCreate(motion_output_t func_p, uint8_t channel, int32_t position, uint32_t max_speed, uint32_t accel){
+	if(func_p == NULL){
+		return -1;
+	}
+	int8_t axis = -1;
+	taskENTER_CRITICAL(&axes_mux);
+	for(uint8_t i = 0; i < MOTION_MAX_AXES; i++){
+		if(axes[i].func_p == NULL){
+			axes[i].func_p = func_p;
+			axes[i].channel = channel;
+			axes[i].moving = false;
+			axes[i].position = axes[i].target = (int64_t)position * Q16_ONE;
+			axes[i].speed = 0;
+			axes[i].output = position;
+			MotionLimits(&axes[i], max_speed, accel);
+			axis = i;
+			break;
+		}
+	}
+	taskEXIT_CRITICAL(&axes_mux);
+	return axis;
+}
+
+void MotionSetLimits(int8_t axis, uint32_t max_speed, uint32_t accel){
+	if(axis < 0 || axis >= MOTION_MAX_AXES){
+		return;
+	}
+	taskENTER_CRITICAL(&axes_mux);
+	MotionLimits(&axes[axis], max_speed, accel);
+	taskEXIT_CRITICAL(&axes_mux);
+}
+
+void MotionMoveTo(int8_t axis, int32_t target){
+	if(axis < 0 || axis >= MOTION_MAX_AXES || motion_timer == NULL){
+		return;
+	}
+	taskENTER_CRITICAL(&axes_mux);
+	axes[axis].target = (int64_t)target * Q16_ONE;
+	axes[axis].moving = (axes[axis].target != axes[axis].position) || (axes[axis].speed != 0);
+	taskEXIT_CRITICAL(&axes_mux);
+	if(axes[axis].moving && !esp_timer_is_active(motion_timer)){
+		esp_timer_start_periodic(motion_timer, period_us);
+	}
+}
+
+void MotionSetPosition(int8_t axis, int32_t position){
+	if(axis < 0 || axis >= MOTION_MAX_AXES){
+		return;
+	}
+	taskENTER_CRITICAL(&axes_mux);
+	axes[axis].position = axes[axis].target = (int64_t)position * Q16_ONE;
+	axes[axis].speed = 0;
+	axes[axis].moving = false;
+	axes[axis].output = position;
+	taskEXIT_CRITICAL(&axes_mux);
+}
+
+int32_t MotionGetPosition(int8_t axis){
+	if(axis < 0 || axis >= MOTION_MAX_AXES){
+		return 0;
+	}
+	return axes[axis].output;
+}
+
+bool MotionBusy(int8_t axis){
+	if(axis < 0 || axis >= MOTION_MAX_AXES){
+		return false;
+	}
+	return axes[axis].moving;
+}
+
+/*==================[end of file]============================================*/
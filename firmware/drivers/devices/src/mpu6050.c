@@ -13,12 +13,24 @@
 #include "mpu6050.h"
 #include "math.h"
 #include <string.h>
+#include "delay_mcu.h"
+#include "static_alloc_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
+#define MPU6050_TASK_STACK  CONFIG_DRIVERS_MPU6050_TASK_STACK
+#define MPU6050_TASK_PRIO   9
 
 /*==================[internal data definition]===============================*/
 uint8_t devAddr;
 uint8_t buffer[14];
+
+// Data-ready interrupt mode: the ISR wakes up the driver task, which reads the FIFO
+static TaskHandle_t interruptTask = NULL;
+STATIC_TASK_DEFINE(interruptTask, MPU6050_TASK_STACK);
+static ring_buffer_t *interruptRing;
+static uint8_t interruptFrames;
+static TaskHandle_t interruptConsumer;
+static mpu6050_int_stats_t interruptStats;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[external functions definition]==========================*/
@@ -47,6 +59,11 @@ void MPU6050_Address(uint8_t address) {
 
 void MPU6050_initialize() {
 	devAddr = MPU6050_DEFAULT_ADDRESS;
+	/* Shadow of the configuration registers: the bit setters write without reading first.
+	 * USER_CTRL and SIGNAL_PATH_RESET are left out (their reset bits clear on their own) */
+	I2C_addShadow(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_RA_ZG_OFFS_TC - MPU6050_RA_XG_OFFS_TC + 1);
+	I2C_addShadow(devAddr, MPU6050_RA_SELF_TEST_X, MPU6050_RA_INT_ENABLE - MPU6050_RA_SELF_TEST_X + 1);
+	I2C_addShadow(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_RA_PWR_MGMT_2 - MPU6050_RA_PWR_MGMT_1 + 1);
     MPU6050_setClockSource(MPU6050_CLOCK_PLL_XGYRO);
     MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_250);
     MPU6050_setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
@@ -2409,6 +2426,8 @@ void MPU6050_resetSensors() {
  */
 void MPU6050_reset() {
     I2C_writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true);
+    // Registers are back to their reset values
+    I2C_invalidateShadow(devAddr);
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2740,6 +2759,222 @@ void MPU6050_setFIFOByte(uint8_t data) {
     I2C_writeByte(devAddr, MPU6050_RA_FIFO_R_W, data);
 }
 
+/** Start FIFO streaming of accel+gyro frames.
+ * @param rate Sample rate divider (SMPLRT_DIV)
+ * @see MPU6050_readFIFOStream()
+ */
+void MPU6050_startFIFOStream(uint8_t rate) {
+    MPU6050_setFIFOEnabled(false);
+    I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+    MPU6050_resetFIFO();
+    MPU6050_setRate(rate);
+    // frames in register order: ACCEL_XOUT to ACCEL_ZOUT, GYRO_XOUT to GYRO_ZOUT
+    I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT) |
+                  (1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT));
+    MPU6050_setFIFOEnabled(true);
+}
+/** Read the FIFO frames into a ring buffer of mpu6050_frame_t.
+ * @param rb Ring buffer of mpu6050_frame_t elements
+ * @return Number of frames stored in the ring buffer
+ * @see MPU6050_startFIFOStream()
+ */
+uint16_t MPU6050_readFIFOStream(ring_buffer_t *rb) {
+    uint8_t data[MPU6050_FIFO_BURST_FRAMES * MPU6050_FIFO_FRAME_SIZE];
+    mpu6050_frame_t frames[MPU6050_FIFO_BURST_FRAMES];
+    uint16_t count = MPU6050_getFIFOCount();
+    uint16_t stored = 0;
+
+    if (count >= MPU6050_FIFO_SIZE) {
+        MPU6050_resetFIFO();
+        return 0;
+    }
+    uint32_t pending = count / MPU6050_FIFO_FRAME_SIZE;
+    uint32_t space = RingBufferFree(rb);
+    if (pending > space) {
+        pending = space;
+    }
+    while (pending > 0) {
+        uint8_t n = (pending > MPU6050_FIFO_BURST_FRAMES) ? MPU6050_FIFO_BURST_FRAMES : pending;
+        I2C_readBytes(devAddr, MPU6050_RA_FIFO_R_W, n * MPU6050_FIFO_FRAME_SIZE, data, I2C_MASTER_TIMEOUT_MS);
+        for (uint8_t i = 0; i < n; i++) {
+            const uint8_t *frame = &data[i * MPU6050_FIFO_FRAME_SIZE];
+            for (uint8_t j = 0; j < 3; j++) {
+                frames[i].accel[j] = (((int16_t)frame[2 * j]) << 8) | frame[2 * j + 1];
+                frames[i].gyro[j] = (((int16_t)frame[6 + 2 * j]) << 8) | frame[6 + 2 * j + 1];
+            }
+        }
+        stored += RingBufferWrite(rb, frames, n);
+        pending -= n;
+    }
+    return stored;
+}
+
+// INT pin ISR (data-ready or FIFO overflow pulse): defers the I2C access to the driver task
+static void IRAM_ATTR MPU6050_isr(void *param) {
+    BaseType_t taskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(interruptTask, &taskWoken);
+    portYIELD_FROM_ISR(taskWoken);
+}
+
+// Driver task: counts the pulses and reads the FIFO every interruptFrames of them
+static void MPU6050_task(void *param) {
+    uint32_t pending = 0;
+    while (1) {
+        uint32_t pulses = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        interruptStats.dataReady += pulses;
+        pending += pulses;
+        if (pending < interruptFrames) {
+            continue;
+        }
+        pending = 0;
+        // reading INT_STATUS clears the overflow bit as well
+        if (MPU6050_getIntStatus() & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
+            interruptStats.fifoOverflow++;
+        }
+        uint16_t stored = MPU6050_readFIFOStream(interruptRing);
+        interruptStats.frames += stored;
+        interruptStats.reads++;
+        if (stored > 0 && interruptConsumer != NULL) {
+            xTaskNotifyGive(interruptConsumer);
+        }
+    }
+}
+
+bool MPU6050_startInterrupt(gpio_t intPin, ring_buffer_t *rb, uint8_t frames, TaskHandle_t consumer) {
+    if (interruptTask != NULL) return false;
+    if (frames == 0) frames = 1;
+    if (frames > MPU6050_FIFO_BURST_FRAMES) frames = MPU6050_FIFO_BURST_FRAMES;
+
+    interruptRing = rb;
+    interruptFrames = frames;
+    interruptConsumer = consumer;
+    memset(&interruptStats, 0, sizeof(interruptStats));
+    STATIC_TASK_CREATE(interruptTask, MPU6050_task, "MPU6050", NULL, MPU6050_TASK_PRIO, &interruptTask);
+
+    // active high push-pull pulses, the status bits are kept until INT_STATUS is read
+    MPU6050_setInterruptMode(false);
+    MPU6050_setInterruptDrive(false);
+    MPU6050_setInterruptLatch(false);
+    MPU6050_setInterruptLatchClear(false);
+    MPU6050_setIntEnabled((1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT) | (1 << MPU6050_INTERRUPT_DATA_RDY_BIT));
+    MPU6050_getIntStatus();
+
+    GPIOInit(intPin, GPIO_INPUT);
+    GPIOActivInt(intPin, MPU6050_isr, true, NULL);
+    return true;
+}
+
+void MPU6050_getInterruptStats(mpu6050_int_stats_t *stats) {
+    *stats = interruptStats;
+}
+
+#ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+// BANK_SEL, MEM_START_ADDR and MEM_R_W registers
+
+void MPU6050_setMemoryBank(uint8_t bank, bool prefetchEnabled, bool userBank) {
+    bank &= 0x1F;
+    if (userBank) bank |= 0x20;
+    if (prefetchEnabled) bank |= 0x40;
+    I2C_writeByte(devAddr, MPU6050_RA_BANK_SEL, bank);
+}
+void MPU6050_setMemoryStartAddress(uint8_t address) {
+    I2C_writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address);
+}
+bool MPU6050_writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify) {
+    uint8_t verifyBuffer[MPU6050_DMP_MEMORY_CHUNK_SIZE];
+    uint16_t chunkSize;
+
+    MPU6050_setMemoryBank(bank, false, false);
+    MPU6050_setMemoryStartAddress(address);
+    for (uint16_t i = 0; i < dataSize;) {
+        // chunks don't cross bank boundaries
+        chunkSize = MPU6050_DMP_MEMORY_CHUNK_SIZE;
+        if (i + chunkSize > dataSize) chunkSize = dataSize - i;
+        if (chunkSize > MPU6050_DMP_MEMORY_BANK_SIZE - address) chunkSize = MPU6050_DMP_MEMORY_BANK_SIZE - address;
+        I2C_writeBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, (uint8_t *)&data[i]);
+        if (verify) {
+            MPU6050_setMemoryBank(bank, false, false);
+            MPU6050_setMemoryStartAddress(address);
+            I2C_readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, verifyBuffer, I2C_MASTER_TIMEOUT_MS);
+            if (memcmp(&data[i], verifyBuffer, chunkSize) != 0) {
+                return false;
+            }
+        }
+        i += chunkSize;
+        address += chunkSize;	// wraps to 0 at the end of the bank
+        if (i < dataSize) {
+            if (address == 0) bank++;
+            MPU6050_setMemoryBank(bank, false, false);
+            MPU6050_setMemoryStartAddress(address);
+        }
+    }
+    return true;
+}
+void MPU6050_setDMPEnabled(bool enabled) {
+    I2C_writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, enabled);
+}
+void MPU6050_resetDMP() {
+    I2C_writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT, true);
+}
+
+// DMP (MotionApps v6.12)
+
+uint8_t MPU6050_dmpInitialize(const uint8_t *firmware, uint16_t size) {
+    MPU6050_reset();
+    DelayMs(100);
+    I2C_writeByte(devAddr, MPU6050_RA_USER_CTRL, 1 << MPU6050_USERCTRL_FIFO_RESET_BIT);
+    I2C_writeByte(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_CLOCK_PLL_XGYRO);
+    I2C_writeByte(devAddr, MPU6050_RA_INT_ENABLE, 0x00);
+    I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, 0x00);		// the DMP writes the FIFO by itself
+    MPU6050_setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
+    I2C_writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x80);	// INT active low
+    MPU6050_setRate(4);										// 1 kHz / (1 + 4) = 200 Hz
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_188);
+
+    if (!MPU6050_writeMemoryBlock(firmware, size, 0, 0, true)) {
+        return 1;
+    }
+    I2C_writeWord(devAddr, MPU6050_RA_DMP_CFG_1, MPU6050_DMP_START_ADDRESS);
+    MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+
+    I2C_writeByte(devAddr, MPU6050_RA_USER_CTRL, (1 << MPU6050_USERCTRL_DMP_EN_BIT) | (1 << MPU6050_USERCTRL_FIFO_EN_BIT));
+    I2C_writeByte(devAddr, MPU6050_RA_INT_ENABLE, 1 << MPU6050_INTERRUPT_DMP_INT_BIT);
+    MPU6050_resetFIFO();
+    MPU6050_setDMPEnabled(false);
+    return 0;
+}
+bool MPU6050_dmpReadPacket(uint8_t *packet) {
+    uint16_t count = MPU6050_getFIFOCount();
+
+    if (count >= MPU6050_FIFO_SIZE) {
+        MPU6050_resetFIFO();
+        return false;
+    }
+    if (count < MPU6050_DMP_PACKET_SIZE) {
+        return false;
+    }
+    // FIFO reads pop data: the last one is the newest packet
+    for (uint16_t n = count / MPU6050_DMP_PACKET_SIZE; n > 0; n--) {
+        I2C_readBytes(devAddr, MPU6050_RA_FIFO_R_W, MPU6050_DMP_PACKET_SIZE, packet, I2C_MASTER_TIMEOUT_MS);
+    }
+    return true;
+}
+void MPU6050_dmpGetQuaternion(const uint8_t *packet, float *q) {
+    // 4 x 32 bit, Q30 fixed point
+    for (uint8_t i = 0; i < 4; i++) {
+        int32_t v = ((int32_t)packet[4 * i] << 24) | ((int32_t)packet[4 * i + 1] << 16) |
+                    ((int32_t)packet[4 * i + 2] << 8) | packet[4 * i + 3];
+        q[i] = v / 1073741824.0f;
+    }
+}
+void MPU6050_dmpGetFrame(const uint8_t *packet, mpu6050_frame_t *frame) {
+    for (uint8_t j = 0; j < 3; j++) {
+        frame->accel[j] = (((int16_t)packet[16 + 2 * j]) << 8) | packet[16 + 2 * j + 1];
+        frame->gyro[j] = (((int16_t)packet[22 + 2 * j]) << 8) | packet[22 + 2 * j + 1];
+    }
+}
+#endif /* MPU6050_INCLUDE_DMP_MOTIONAPPS20 */
+
 // WHO_AM_I register
 
 /** Get Device ID.
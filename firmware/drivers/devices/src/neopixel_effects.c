@@ -0,0 +1,281 @@
+/**
+ * @file neopixel_effects.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "neopixel_effects.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define RED_OFFSET      16
+#define GREEN_OFFSET    8
+#define BLUE_OFFSET     0
+#define FRACTION_ONE    65536           // 1.0 in the 16 bits time fraction
+#define US_PER_MS       1000
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Parameters and progress of the active effect
+ */
+typedef struct {
+	neopixel_effect_t effect;
+	uint32_t id;                    // incremented when an effect starts
+	uint32_t elapsed_us;            // time since the effect started
+	uint32_t duration_us;           // fade and flash duration, chase step
+	neopixel_color_t color;         // fade initial color, chase and flash color
+	neopixel_color_t color2;        // fade final color, chase background
+	uint32_t last_step;             // chase step of the last frame shown
+	uint16_t lenght;                // chase segment lenght
+	bool upwards;                   // chase direction
+	uint16_t hue;                   // rainbow hue of the first pixel
+	uint16_t hue_step;              // rainbow hue advanced on each frame
+	uint32_t hue_delta;             // rainbow hue between pixels (16 bits fraction)
+	uint8_t sat;                    // rainbow saturation
+	uint8_t val;                    // rainbow value
+} effect_state_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static esp_timer_handle_t effects_timer = NULL;
+static uint32_t frame_period_us = 0;
+static effect_state_t state = {.effect = NEOPIXEL_EFFECT_NONE};
+static portMUX_TYPE state_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Scale a color by a 16 bits fraction
+ */
+static neopixel_color_t NeoPixelEffectScale(neopixel_color_t color, uint32_t scale){
+	uint32_t red = (((color >> RED_OFFSET) & 0xFF) * scale) >> 16;
+	uint32_t green = (((color >> GREEN_OFFSET) & 0xFF) * scale) >> 16;
+	uint32_t blue = (((color >> BLUE_OFFSET) & 0xFF) * scale) >> 16;
+	return (red << RED_OFFSET) | (green << GREEN_OFFSET) | (blue << BLUE_OFFSET);
+}
+
+/**
+ * @brief Interpolate two colors by a 16 bits fraction
+ */
+static neopixel_color_t NeoPixelEffectLerp(neopixel_color_t from, neopixel_color_t to, uint32_t t){
+	neopixel_color_t color = 0;
+	for (uint8_t offset = 0; offset <= RED_OFFSET; offset += GREEN_OFFSET){
+		int32_t a = (from >> offset) & 0xFF;
+		int32_t b = (to >> offset) & 0xFF;
+		color |= (neopixel_color_t)(a + (((b - a) * (int32_t)t) >> 16)) << offset;
+	}
+	return color;
+}
+
+/**
+ * @brief Fraction of the duration elapsed (16 bits, saturated at 1.0)
+ */
+static uint32_t NeoPixelEffectFraction(const effect_state_t *effect){
+	if(effect->duration_us == 0 || effect->elapsed_us >= effect->duration_us){
+		return FRACTION_ONE;
+	}
+	return ((uint64_t)effect->elapsed_us * FRACTION_ONE) / effect->duration_us;
+}
+
+static void NeoPixelEffectFill(neopixel_color_t *colors, uint16_t len, neopixel_color_t color){
+	for (uint16_t i = 0; i < len; i++){
+		colors[i] = color;
+	}
+}
+
+/**
+ * @brief Compute the frame of an effect in the back buffer
+ * 
+ * @return true if the frame changed and must be shown
+ */
+static bool NeoPixelEffectFrame(effect_state_t *effect, bool *finished){
+	neopixel_color_t *colors = NeoPixelGetArray();
+	uint16_t len = NeoPixelGetLength();
+	uint32_t t = NeoPixelEffectFraction(effect);
+	*finished = false;
+	switch(effect->effect){
+		case NEOPIXEL_EFFECT_FADE:
+			NeoPixelEffectFill(colors, len, NeoPixelEffectLerp(effect->color, effect->color2, t));
+			*finished = (t == FRACTION_ONE);
+		break;
+		case NEOPIXEL_EFFECT_FLASH:{
+			uint32_t remaining = FRACTION_ONE - t;
+			NeoPixelEffectFill(colors, len, NeoPixelEffectScale(effect->color, (remaining * remaining) >> 16));
+			*finished = (t == FRACTION_ONE);
+		}
+		break;
+		case NEOPIXEL_EFFECT_CHASE:{
+			uint32_t step = effect->elapsed_us / effect->duration_us;
+			if(step == effect->last_step){
+				return false;
+			}
+			effect->last_step = step;
+			uint16_t pos = step % len;
+			if(!effect->upwards){
+				pos = len - 1 - pos;
+			}
+			for (uint16_t i = 0; i < len; i++){
+				colors[i] = ((uint16_t)(i + len - pos) % len < effect->lenght) ? effect->color : effect->color2;
+			}
+		}
+		break;
+		case NEOPIXEL_EFFECT_RAINBOW:{
+			uint32_t hue = (uint32_t)effect->hue << 16;
+			for (uint16_t i = 0; i < len; i++){
+				colors[i] = NeoPixelHSV2Color(hue >> 16, effect->sat, effect->val);
+				hue += effect->hue_delta;
+			}
+			effect->hue += effect->hue_step;
+		}
+		break;
+		default:
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Timer callback (esp_timer task): compute and show the next frame
+ */
+static void NeoPixelEffectsTimer(void *param){
+	effect_state_t effect;
+	bool finished;
+	if(NeoPixelGetLength() > WS2812B_MAX_LEDS && NeoPixelBusy()){
+		// long stripes are streamed from the back buffer: skip this frame, keeping the time
+		taskENTER_CRITICAL(&state_mux);
+		state.elapsed_us += frame_period_us;
+		taskEXIT_CRITICAL(&state_mux);
+		return;
+	}
+	taskENTER_CRITICAL(&state_mux);
+	effect = state;
+	taskEXIT_CRITICAL(&state_mux);
+	bool show = NeoPixelEffectFrame(&effect, &finished);
+	taskENTER_CRITICAL(&state_mux);
+	// an effect started meanwhile replaces this frame
+	if(effect.id == state.id){
+		state.elapsed_us += frame_period_us;
+		state.last_step = effect.last_step;
+		state.hue = effect.hue;
+		if(finished){
+			state.effect = NEOPIXEL_EFFECT_NONE;
+		}
+	}
+	else{
+		show = false;
+		finished = false;
+	}
+	taskEXIT_CRITICAL(&state_mux);
+	if(show){
+		NeoPixelShow();
+	}
+	if(finished){
+		esp_timer_stop(effects_timer);
+		// an effect started before the timer was stopped must keep it running
+		if(NeoPixelEffectActive() != NEOPIXEL_EFFECT_NONE){
+			esp_timer_start_periodic(effects_timer, frame_period_us);
+		}
+	}
+}
+
+/**
+ * @brief Replace the active effect and start the timer
+ */
+static void NeoPixelEffectStart(const effect_state_t *effect){
+	if(effects_timer == NULL || NeoPixelGetLength() == 0){
+		return;
+	}
+	taskENTER_CRITICAL(&state_mux);
+	uint32_t id = state.id + 1;
+	state = *effect;
+	state.id = id;
+	state.elapsed_us = 0;
+	state.last_step = UINT32_MAX;
+	taskEXIT_CRITICAL(&state_mux);
+	if(!esp_timer_is_active(effects_timer)){
+		esp_timer_start_periodic(effects_timer, frame_period_us);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool NeoPixelEffectsInit(uint16_t frame_rate){
+	if(frame_rate == 0 || frame_rate > US_PER_MS){
+		return false;
+	}
+	frame_period_us = 1000000 / frame_rate;
+	if(effects_timer != NULL){
+		return true;
+	}
+	esp_timer_create_args_t timer_args = {
+		.callback = NeoPixelEffectsTimer,
+		.name = "neopixel_fx"
+	};
+	return esp_timer_create(&timer_args, &effects_timer) == ESP_OK;
+}
+
+void NeoPixelEffectFade(neopixel_color_t from, neopixel_color_t to, uint16_t duration_ms){
+	effect_state_t effect = {
+		.effect = NEOPIXEL_EFFECT_FADE,
+		.duration_us = (uint32_t)duration_ms * US_PER_MS,
+		.color = from,
+		.color2 = to,
+	};
+	NeoPixelEffectStart(&effect);
+}
+
+void NeoPixelEffectChase(neopixel_color_t color, neopixel_color_t background, uint16_t lenght, uint16_t step_ms, bool upwards){
+	effect_state_t effect = {
+		.effect = NEOPIXEL_EFFECT_CHASE,
+		.duration_us = (step_ms > 0) ? (uint32_t)step_ms * US_PER_MS : 1,
+		.color = color,
+		.color2 = background,
+		.lenght = lenght,
+		.upwards = upwards,
+	};
+	NeoPixelEffectStart(&effect);
+}
+
+void NeoPixelEffectFlash(neopixel_color_t color, uint16_t decay_ms){
+	effect_state_t effect = {
+		.effect = NEOPIXEL_EFFECT_FLASH,
+		.duration_us = (uint32_t)decay_ms * US_PER_MS,
+		.color = color,
+	};
+	NeoPixelEffectStart(&effect);
+}
+
+void NeoPixelEffectRainbow(uint16_t hue_step, uint8_t sat, uint8_t val, uint8_t reps){
+	uint16_t len = NeoPixelGetLength();
+	effect_state_t effect = {
+		.effect = NEOPIXEL_EFFECT_RAINBOW,
+		.hue_step = hue_step,
+		.hue_delta = (len > 0) ? (uint32_t)(((uint64_t)reps << 32) / len) : 0,
+		.sat = sat,
+		.val = val,
+	};
+	NeoPixelEffectStart(&effect);
+}
+
+void NeoPixelEffectStop(void){
+	if(effects_timer == NULL){
+		return;
+	}
+	esp_timer_stop(effects_timer);
+	taskENTER_CRITICAL(&state_mux);
+	state.effect = NEOPIXEL_EFFECT_NONE;
+	state.id++;
+	taskEXIT_CRITICAL(&state_mux);
+}
+
+neopixel_effect_t NeoPixelEffectActive(void){
+	return state.effect;
+}
+
+/*==================[end of file]============================================*/
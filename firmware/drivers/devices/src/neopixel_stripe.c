@@ -11,6 +11,8 @@
 
 /*==================[inclusions]=============================================*/
 #include "neopixel_stripe.h"
+#include <stddef.h>
+#include <string.h>
 #include "ws2812b.h"
 /*==================[macros and definitions]=================================*/
 #define RED_MSK         0x00FF0000
@@ -28,31 +30,63 @@ neopixel_color_t *stripe_colors;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static uint8_t frame_grb[2][WS2812B_MAX_LEDS * 3];	// frame transmitted and frame being encoded
+static uint8_t frame_back = 0;						// frame_grb buffer to encode next
+static uint8_t level_lut[256];						// gamma corrected level with stripe_bright applied
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Rebuild level_lut for the current brightness.
+ */
+static void NeoPixelBuildLut(void){
+	for (uint16_t level = 0; level < 256; level++){
+		level_lut[level] = ws2812bGammaCorrection((level * stripe_bright) >> BRIGHT_OFFSET);
+	}
+}
+
+/**
+ * @brief Encode colors (through level_lut) in the free frame buffer and
+ * start its transmission (NULL: all off).
+ * 
+ * @note It's encoded while the previous frame is transmitted from the other
+ * buffer, so it only waits if that transmission isn't finished yet.
+ */
+static void NeoPixelTransmit(const neopixel_color_t *color_array){
+	if(stripe_length > WS2812B_MAX_LEDS){
+		// streamed from the color array: no frame buffer
+		ws2812bSendColors(color_array, stripe_length, level_lut);
+		return;
+	}
+	uint8_t *grb = frame_grb[frame_back];
+	uint16_t leds = stripe_length;
+	if(color_array == NULL){
+		memset(grb, 0, leds * 3);
+	}
+	else{
+		for (uint16_t i = 0; i < leds; i++){
+			neopixel_color_t color = color_array[i];
+			grb[3 * i] = level_lut[(color & GREEN_MSK) >> GREEN_OFFSET];
+			grb[3 * i + 1] = level_lut[(color & RED_MSK) >> RED_OFFSET];
+			grb[3 * i + 2] = level_lut[(color & BLUE_MSK) >> BLUE_OFFSET];
+		}
+	}
+	ws2812bWait();
+	ws2812bSendFrame(grb, leds);
+	frame_back ^= 1;
+}
 
 /*==================[external functions definition]==========================*/
 
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
+	NeoPixelBuildLut();
     ws2812bInit(pin);
 }
 
 void NeoPixelAllOff(void){
-    rgb_led_t led;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		led.red = 0;
-		led.green = 0;
-		led.blue = 0;
-		ws2812bSend(led);
-	}
-	ws2812bSendRet();
+	NeoPixelTransmit(NULL);
 }
 
 void NeoPixelAllColor(neopixel_color_t color){
@@ -68,21 +102,31 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
 }
 
 void NeoPixelSetArray(neopixel_color_t *color_array){
-    rgb_led_t led;
-	uint16_t red, green, blue;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		red = ((color_array[i] & RED_MSK) >> RED_OFFSET) * stripe_bright;
-		green = ((color_array[i] & GREEN_MSK) >> GREEN_OFFSET) * stripe_bright;
-		blue = ((color_array[i] & BLUE_MSK) >> BLUE_OFFSET) * stripe_bright;
-		led.red = red >> BRIGHT_OFFSET;
-		led.green = green >> BRIGHT_OFFSET;
-		led.blue = blue >> BRIGHT_OFFSET;
-		ws2812bSend(led);
-	}
-	ws2812bSendRet();
+	NeoPixelTransmit(color_array);
+}
+
+void NeoPixelShow(void){
+	NeoPixelTransmit(stripe_colors);
+}
+
+neopixel_color_t * NeoPixelGetArray(void){
+	return stripe_colors;
+}
+
+uint16_t NeoPixelGetLength(void){
+	return stripe_length;
+}
+
+void NeoPixelShowCallback(void (*func_p)(void *param), void *param_p){
+	ws2812bSetDoneCallback(func_p, param_p);
+}
+
+bool NeoPixelBusy(void){
+	return ws2812bBusy();
+}
+
+void NeoPixelWait(void){
+	ws2812bWait();
 }
 
 void NeoPixelShift(bool upwards){
@@ -105,7 +149,14 @@ void NeoPixelShift(bool upwards){
 }
 
 void NeoPixelBrightness(uint8_t bright){
-	stripe_bright = bright;
+	if(bright != stripe_bright){
+		if(stripe_length > WS2812B_MAX_LEDS){
+			// level_lut is read while a streamed frame is transmitted
+			ws2812bWait();
+		}
+		stripe_bright = bright;
+		NeoPixelBuildLut();
+	}
 	NeoPixelSetArray(stripe_colors);
 }
 
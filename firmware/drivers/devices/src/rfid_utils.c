@@ -12,59 +12,77 @@
 // auxBuffer used to store the read end write data, each block have 16 bytes,
 // auxBuffer must have 18 slots, see MIFARE_Read()
 static uint8_t auxBuffer[18];
-static uint8_t size = sizeof(auxBuffer);
 
 // return status from MFRC522 functions
 static StatusCode status;
 
+#define BLOCK_SIZE 16
+#define BALANCE_SECTOR 1
+#define BALANCE_BLOCK 4
 
 /****************************************
  * Private Functions
  ****************************************/
 
 /**
- * Read 16 bytes from a block inside a sector
- * @param  mfrc522   MFRC522 ADT pointer
- * @param  sector    card sector, 0 to 15
- * @param  blockAddr card block address, 0 to 63
- * @return           0 is no error, -1 is authentication error -2 is read error
+ * Sector of a block (MIFARE Classic 1K/4K layout)
  */
-static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
-						 uint8_t blockAddr) {
+static int16_t blockSector(uint8_t blockAddr) {
+	if (blockAddr < 128) {
+		return blockAddr / 4;
+	}
+	return 32 + (blockAddr - 128) / 16;
+}
 
-	MIFARE_Key key;
-	int i;
-	// using FFFFFFFFFFFFh which is the default at chip delivery from the
-	// factory
-	for (i = 0; i < 6; i++) {
-		key.keybyte[i] = 0xFF;
+/**
+ * True if the block is the trailer (keys and access bits) of its sector
+ */
+static bool isSectorTrailer(uint8_t blockAddr) {
+	if (blockAddr < 128) {
+		return (blockAddr % 4) == 3;
 	}
+	return ((blockAddr - 128) % 16) == 15;
+}
 
+/**
+ * Authenticate the sector of a block, if it isn't already
+ * @return 0 is no error, -1 is authentication error
+ */
+static int sessionAuthenticate(rfid_session_t *session, uint8_t blockAddr) {
+	int16_t sector = blockSector(blockAddr);
+	if (sector == session->sector) {
+		return 0;
+	}
 	// Authenticate using key A
-	status = (StatusCode)PCD_Authenticate(mfrc522, PICC_CMD_MF_AUTH_KEY_A,
-										  blockAddr, &key, &(mfrc522->uid));
+	status = (StatusCode)PCD_Authenticate(session->mfrc, PICC_CMD_MF_AUTH_KEY_A,
+										  blockAddr, &session->key,
+										  &(session->mfrc->uid));
 	if (status != STATUS_OK) {
+		session->sector = -1;
 		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
 		UartSendString(UART_PC,GetStatusCodeName(status));
 		return -1;
 	}
-
-	// Read data from the block
-	status = (StatusCode)MIFARE_Read(mfrc522, blockAddr, auxBuffer, &size);
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"MIFARE_Read() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -2;
-	}
-
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
+	session->sector = sector;
 	return 0;
 }
 
+/**
+ * Read 16 bytes from a block inside a sector
+ * @param  mfrc522   MFRC522 ADT pointer
+ * @param  sector    card sector, 0 to 15
+ * @param  blockAddr card block address, 0 to 63
+ * @return           0 is no error, -1 is authentication error -2 is read error
+ */
+static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
+						 uint8_t blockAddr) {
+	rfid_session_t session;
+	rfidSessionBegin(&session, mfrc522, NULL);
+	int result = rfidSessionRead(&session, blockAddr, auxBuffer, 1);
+	rfidSessionEnd(&session);
+	return result;
+}
+
 /**
  * Write 16 bytes to a block inside a sector
  * @param  mfrc522   MFRC522 ADT pointer
@@ -74,37 +92,33 @@ static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
  */
 static int writeCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 						  uint8_t blockAddr) {
+	rfid_session_t session;
+	rfidSessionBegin(&session, mfrc522, NULL);
+	int result = rfidSessionWrite(&session, blockAddr, auxBuffer, 1);
+	rfidSessionEnd(&session);
+	return result;
+}
 
-	MIFARE_Key key;
+/**
+ * Set the balance bytes of the block, auxBuffer[0] is the MSB
+ */
+static void setBalanceBlock(int balance) {
+	auxBuffer[0] = balance >> 24;
+	auxBuffer[1] = balance >> 16;
+	auxBuffer[2] = balance >> 8;
+	auxBuffer[3] = balance & 0x000000FF;
 	int i;
-	// using FFFFFFFFFFFF which is the default at chip delivery from the factory
-	for (i = 0; i < 6; i++) {
-		key.keybyte[i] = 0xFF;
-	}
-
-	// Authenticate using key A
-	status = (StatusCode)PCD_Authenticate(mfrc522, PICC_CMD_MF_AUTH_KEY_A,
-										  blockAddr, &key, &(mfrc522->uid));
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -1;
-	}
-
-	// Write data from the block, always write 16 bytes
-	status = (StatusCode)MIFARE_Write(mfrc522, blockAddr, auxBuffer, 16);
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"MIFARE_Write() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -2;
+	for (i = 4; i < BLOCK_SIZE; i++) {
+		auxBuffer[i] = 0xBB;
 	}
+}
 
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
-	return 0;
+/**
+ * Get the balance from the block bytes, auxBuffer[0] is the MSB
+ */
+static int getBalanceBlock(void) {
+	return (int)auxBuffer[3] | (int)(auxBuffer[2] << 8) |
+		   (int)(auxBuffer[1] << 16) | (int)(auxBuffer[0] << 24);
 }
 
 /****************************************
@@ -139,20 +153,10 @@ void setupRFID(MFRC522Ptr_t* mfrc522) {
  * @return         the balance is stored in the PICC, -999 for reading errors
  */
 int readCardBalance(MFRC522Ptr_t mfrc522) {
-
-	int balance;
-
-	int readStatus = readCardBlock(mfrc522, 1, 4);
-
-	if (readStatus == 0) {
-		// convert the balance bytes to an integer, byte[0] is the MSB
-		balance = (int)auxBuffer[3] | (int)(auxBuffer[2] << 8) |
-				  (int)(auxBuffer[1] << 16) | (int)(auxBuffer[0] << 24);
-	} else {
-		balance = -999;
+	if (readCardBlock(mfrc522, BALANCE_SECTOR, BALANCE_BLOCK) != 0) {
+		return -999;
 	}
-
-	return balance;
+	return getBalanceBlock();
 }
 
 /**
@@ -163,18 +167,89 @@ int readCardBalance(MFRC522Ptr_t mfrc522) {
  * @return            0 is no errors
  */
 int writeCardBalance(MFRC522Ptr_t mfrc522, int newBalance) {
+	setBalanceBlock(newBalance);
+	return writeCardBlock(mfrc522, BALANCE_SECTOR, BALANCE_BLOCK);
+}
 
-	// set the 16 bytes auxBuffer, auxBuffer[0] is the MSB
-	auxBuffer[0] = newBalance >> 24;
-	auxBuffer[1] = newBalance >> 16;
-	auxBuffer[2] = newBalance >> 8;
-	auxBuffer[3] = newBalance & 0x000000FF;
+int updateCardBalance(MFRC522Ptr_t mfrc522, int delta, int *newBalance) {
+	rfid_session_t session;
+	rfidSessionBegin(&session, mfrc522, NULL);
+	// The write reuses the authentication of the read
+	int result = rfidSessionRead(&session, BALANCE_BLOCK, auxBuffer, 1);
+	if (result == 0) {
+		int balance = getBalanceBlock() + delta;
+		setBalanceBlock(balance);
+		result = rfidSessionWrite(&session, BALANCE_BLOCK, auxBuffer, 1);
+		if (result == 0 && newBalance != NULL) {
+			*newBalance = balance;
+		}
+	}
+	rfidSessionEnd(&session);
+	return result;
+}
+
+void rfidSessionBegin(rfid_session_t *session, MFRC522Ptr_t mfrc522,
+					  const MIFARE_Key *key) {
+	session->mfrc = mfrc522;
+	session->sector = -1;
 	int i;
-	for (i = 4; i < size; i++) {
-		auxBuffer[i] = 0xBB;
+	for (i = 0; i < MF_KEY_SIZE; i++) {
+		// using FFFFFFFFFFFFh which is the default at chip delivery from the
+		// factory
+		session->key.keybyte[i] = (key != NULL) ? key->keybyte[i] : 0xFF;
+	}
+}
+
+int rfidSessionRead(rfid_session_t *session, uint8_t blockAddr, uint8_t *data,
+					uint8_t blocks) {
+	// MIFARE_Read needs room for the data and its CRC
+	uint8_t block[BLOCK_SIZE + 2];
+	uint8_t i;
+	for (i = 0; i < blocks; i++) {
+		uint8_t size = sizeof(block);
+		if (sessionAuthenticate(session, blockAddr + i) != 0) {
+			return -1;
+		}
+		status = (StatusCode)MIFARE_Read(session->mfrc, blockAddr + i, block, &size);
+		if (status != STATUS_OK) {
+			UartSendString(UART_PC,"MIFARE_Read() failed: ");
+			UartSendString(UART_PC,GetStatusCodeName(status));
+			return -2;
+		}
+		memcpy(&data[i * BLOCK_SIZE], block, BLOCK_SIZE);
 	}
+	return 0;
+}
 
-	int writeStatus = writeCardBlock(mfrc522, 1, 4);
+int rfidSessionWrite(rfid_session_t *session, uint8_t blockAddr,
+					 const uint8_t *data, uint8_t blocks) {
+	uint8_t block[BLOCK_SIZE];
+	uint8_t i;
+	for (i = 0; i < blocks; i++) {
+		if (isSectorTrailer(blockAddr + i)) {
+			return -3;
+		}
+	}
+	for (i = 0; i < blocks; i++) {
+		if (sessionAuthenticate(session, blockAddr + i) != 0) {
+			return -1;
+		}
+		// Write data from the block, always write 16 bytes
+		memcpy(block, &data[i * BLOCK_SIZE], BLOCK_SIZE);
+		status = (StatusCode)MIFARE_Write(session->mfrc, blockAddr + i, block, BLOCK_SIZE);
+		if (status != STATUS_OK) {
+			UartSendString(UART_PC,"MIFARE_Write() failed: ");
+			UartSendString(UART_PC,GetStatusCodeName(status));
+			return -2;
+		}
+	}
+	return 0;
+}
 
-	return writeStatus;
+void rfidSessionEnd(rfid_session_t *session) {
+	// Halt PICC
+	PICC_HaltA(session->mfrc);
+	// Stop encryption on PCD
+	PCD_StopCrypto1(session->mfrc);
+	session->sector = -1;
 }
@@ -2,74 +2,112 @@
 /*==================[inclusions]=============================================*/
 #include "servo_sg90.h"
 #include "pwm_mcu.h"
+#include "motion.h"
 /*==================[macros and definitions]=================================*/
 #define SERVO_FREQ 	50
+#define N_SERVOS	4
 #define MIN_ANG		-90
 #define MAX_ANG		90
-#define ANG_RANGE	180.0
-#define PERIOD_MS   20.0
-#define PULSEW_MS   1.0
-#define PERCENT   	100.0
+#define PERIOD_US   20000		/*!< PWM period (us) */
+#define CENTER_US   1500		/*!< Pulse width at 0 degrees (us) */
+#define CDEG		100			/*!< Position units of the motion axes: hundredths of degree */
+#define SERVO_SPEED	180			/*!< Default speed of smooth moves (degrees/s) */
+#define SERVO_ACCEL	720			/*!< Default acceleration of smooth moves (degrees/s^2) */
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static const pwm_out_t servo_pwm[N_SERVOS] = {PWM_0, PWM_1, PWM_2, PWM_3};
+static int16_t servo_pos[N_SERVOS];				/*!< Last position (hundredths of degree) */
+static int8_t servo_axis[N_SERVOS] = {-1, -1, -1, -1};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-uint8_t Angle2DutyCicle(int8_t angle){
-	static float h_time;
-	static float duty_cicle;
-	static int16_t deg;
-	deg = 2 * angle + MAX_ANG;	// NOTE: adjusted (angle x 2) for the available servos
-	h_time = (float)(deg/ANG_RANGE) + PULSEW_MS;
-	duty_cicle = (float)(h_time/PERIOD_MS) * PERCENT;
-	return (uint8_t) duty_cicle;
+/**
+ * @brief Pulse width to the PWM counts of the servo, from hundredths of degree
+ * 
+ * The pulse goes from 0.5 ms (-90 degrees) to 2.5 ms (90 degrees): angle x 2 
+ * for the available servos.
+ */
+static uint32_t Angle2Duty(servo_out_t servo, int32_t cdeg){
+	uint32_t h_us = CENTER_US + cdeg / 9;
+	// h_us <= 2500 and duty max < 2^20: no overflow
+	return (h_us * (PWMGetDutyMax(servo_pwm[servo]) + 1)) / PERIOD_US;
+}
+
+/**
+ * @brief Output of the motion axes: updates the PWM duty of the servo
+ */
+static void ServoOutput(uint8_t servo, int32_t cdeg){
+	servo_pos[servo] = cdeg;
+	PWMSetDuty(servo_pwm[servo], Angle2Duty(servo, cdeg));
+}
+
+/**
+ * @brief Motion axis of a servo, created on the first smooth move
+ */
+static int8_t ServoAxis(servo_out_t servo){
+	if(servo_axis[servo] < 0 && MotionInit(MOTION_RATE_HZ)){
+		servo_axis[servo] = MotionAxisCreate(ServoOutput, servo, servo_pos[servo], 
+			SERVO_SPEED * CDEG, SERVO_ACCEL * CDEG);
+	}
+	return servo_axis[servo];
 }
 /*==================[external functions definition]==========================*/
 
 uint8_t ServoInit(servo_out_t servo, gpio_t gpio){
-	switch(servo){
-		case SERVO_0:
-			PWMInit(PWM_0, gpio, SERVO_FREQ);
-			break;
-		case SERVO_1:
-			PWMInit(PWM_1, gpio, SERVO_FREQ);
-			break;
-		case SERVO_2:
-			PWMInit(PWM_2, gpio, SERVO_FREQ);
-			break;
-		case SERVO_3:
-			PWMInit(PWM_3, gpio, SERVO_FREQ);
-			break;
+	if(servo >= N_SERVOS){
+		return 1;
 	}
-	return 0;
+	/* highest resolution available at 50 Hz: smooth moves change the pulse 
+	 * width in steps of a few ns instead of 1% (200 us) */
+	return PWMInitResolution(servo_pwm[servo], gpio, SERVO_FREQ, 0);
 }
 
 void ServoMove(servo_out_t servo, int8_t ang){
-	static uint8_t dc;
+	if(servo >= N_SERVOS){
+		return;
+	}
 	if(ang < MIN_ANG){
 		ang = MIN_ANG;
 	} else if(ang > MAX_ANG){
 		ang = MAX_ANG;
 	}
-	dc = Angle2DutyCicle(ang);
-	switch(servo){
-		case SERVO_0:
-			PWMSetDutyCycle(PWM_0, dc);
-			break;
-		case SERVO_1:
-			PWMSetDutyCycle(PWM_1, dc);
-			break;
-		case SERVO_2:
-			PWMSetDutyCycle(PWM_2, dc);
-			break;
-		case SERVO_3:
-			PWMSetDutyCycle(PWM_3, dc);
-			break;
+	// stops a smooth move in progress
+	MotionSetPosition(servo_axis[servo], ang * CDEG);
+	ServoOutput(servo, ang * CDEG);
+}
+
+void ServoMoveSmooth(servo_out_t servo, int8_t ang){
+	if(servo >= N_SERVOS){
+		return;
+	}
+	if(ang < MIN_ANG){
+		ang = MIN_ANG;
+	} else if(ang > MAX_ANG){
+		ang = MAX_ANG;
+	}
+	int8_t axis = ServoAxis(servo);
+	if(axis < 0){
+		ServoMove(servo, ang);
+		return;
+	}
+	MotionMoveTo(axis, ang * CDEG);
+}
+
+void ServoSetSpeed(servo_out_t servo, uint16_t speed, uint16_t accel){
+	if(servo >= N_SERVOS || speed == 0 || accel == 0){
+		return;
+	}
+	MotionSetLimits(ServoAxis(servo), (uint32_t)speed * CDEG, (uint32_t)accel * CDEG);
+}
+
+bool ServoBusy(servo_out_t servo){
+	if(servo >= N_SERVOS){
+		return false;
 	}
+	return MotionBusy(servo_axis[servo]);
 }
 
 /*==================[end of file]============================================*/
@@ -57,6 +57,7 @@
 *******************************************************************************
 */
 
+#include <stddef.h>
 #include "spo2_algorithm.h"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
@@ -72,29 +73,171 @@ const uint8_t uch_spo2_table[184]={ 95, 95, 95, 96, 96, 96, 97, 97, 97, 97, 97,
               28, 27, 26, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 7, 6, 5,
               3, 2, 1 } ;
 
-void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid,
+typedef struct {
+  const uint32_t *pun_ir;     // raw IR samples
+  const uint32_t *pun_red;    // raw red samples
+  int32_t n_head;             // oldest sample of the window
+  int32_t n_size;             // buffer length (the window wraps around it)
+  int32_t n_length;           // samples in the window
+} maxim_ring_t;
+
+static inline int32_t maxim_ring_idx(const maxim_ring_t *ps_ring, int32_t k)
+{
+  k += ps_ring->n_head;
+  return (k >= ps_ring->n_size) ? k - ps_ring->n_size : k;
+}
+
+static int32_t maxim_smoothed_ir(const maxim_ring_t *ps_ring, uint32_t un_ir_mean, int32_t k)
+/**
+* \brief        Sample k of the inverted, DC free IR after the 4 pt moving average
+* \par          Details
+*               Same value an_x[k] had in the window algorithm (the last MA4_SIZE samples are
+*               not averaged), computed from the raw samples instead of a work buffer.
+*
+* \retval       Smoothed sample
+*/
+{
+  int32_t j, n_sum = 0;
+  if (k >= ps_ring->n_length-MA4_SIZE)
+    return (int32_t)(un_ir_mean - ps_ring->pun_ir[maxim_ring_idx(ps_ring, k)]);
+  for (j=0; j<MA4_SIZE; j++) n_sum += (int32_t)(un_ir_mean - ps_ring->pun_ir[maxim_ring_idx(ps_ring, k+j)]);
+  return n_sum/(int)4;
+}
+
+static void maxim_keep_peak(int32_t *pn_locs, int32_t *pn_vals, int32_t *pn_npks, int32_t n_loc, int32_t n_val, int32_t n_min_distance, int32_t n_max_num)
+/**
+* \brief        Add a peak found left to right, keeping the peaks apart
+* \par          Details
+*               Online form of maxim_remove_close_peaks: a peak closer than n_min_distance to the
+*               last one kept replaces it if it is higher (the earlier one wins ties) and is
+*               dropped otherwise, so the kept peaks stay in ascending order and the work per
+*               peak is constant. Peaks within n_min_distance of index -1 (lag-zero peak of
+*               autocorr) are dropped.
+*
+* \retval       None
+*/
+{
+  if (n_loc + 1 <= n_min_distance)
+    return;
+  if (*pn_npks > 0 && n_loc - pn_locs[*pn_npks-1] <= n_min_distance){
+    if (n_val > pn_vals[*pn_npks-1]){
+      pn_locs[*pn_npks-1] = n_loc;
+      pn_vals[*pn_npks-1] = n_val;
+    }
+    return;
+  }
+  if (*pn_npks < n_max_num){
+    pn_locs[*pn_npks] = n_loc;
+    pn_vals[(*pn_npks)++] = n_val;
+  }
+}
+
+static int32_t maxim_select(int32_t *pn_x, int32_t n_size, int32_t n_k)
+/**
+* \brief        k-th smallest value (partial selection, as nth_element)
+* \par          Details
+*               Partitions pn_x around pivots until position n_k holds the value it would have
+*               if sorted; values before it are not larger and values after it are not smaller.
+*
+* \retval       pn_x[n_k]
+*/
+{
+  int32_t n_lo = 0, n_hi = n_size-1, i, j, n_pivot, n_temp;
+  while (n_lo < n_hi){
+    n_pivot = pn_x[(n_lo+n_hi)/2];
+    i = n_lo;
+    j = n_hi;
+    while (i <= j){
+      while (pn_x[i] < n_pivot) i++;
+      while (pn_x[j] > n_pivot) j--;
+      if (i <= j){
+        n_temp = pn_x[i]; pn_x[i] = pn_x[j]; pn_x[j] = n_temp;
+        i++;
+        j--;
+      }
+    }
+    if (n_k <= j) n_hi = j;
+    else if (n_k >= i) n_lo = i;
+    else break;
+  }
+  return pn_x[n_k];
+}
+
+static int32_t maxim_median(int32_t *pn_x, int32_t n_size)
+/**
+* \brief        Median of the beat ratios (reorders pn_x)
+* \par          Details
+*               Mean of the two middle values for 4 or more values, the middle one otherwise
+*               (pn_x[0] if there are none), selected without sorting.
+*
+* \retval       Median
+*/
+{
+  int32_t n_middle_idx = n_size/2, n_upper, n_lower, k;
+  if (n_size == 0)
+    return pn_x[0];
+  n_upper = maxim_select(pn_x, n_size, n_middle_idx);
+  if (n_middle_idx <= 1)
+    return n_upper;
+  // after the selection the lower middle value is the largest one before n_middle_idx
+  n_lower = pn_x[0];
+  for (k=1; k<n_middle_idx; k++) if (pn_x[k] > n_lower) n_lower = pn_x[k];
+  return (n_lower + n_upper)/2;
+}
+
+static void maxim_find_valleys(const maxim_ring_t *ps_ring, uint32_t un_ir_mean, int32_t *pn_locs, int32_t *pn_npks, int32_t n_min_height, int32_t n_min_distance)
+/**
+* \brief        Find valleys
+* \par          Details
+*               maxim_find_peaks on the smoothed, inverted IR (at most 15 peaks): a single pass
+*               that keeps the peaks apart as they are found (maxim_keep_peak), so the work does
+*               not depend on the number of candidates and the locations come out ascending.
+*
+* \retval       None
+*/
+{
+  int32_t an_val[15];
+  int32_t i = 1, n_width, n_x;
+  int32_t n_size = ps_ring->n_length;
+  *pn_npks = 0;
+
+  // as maxim_peaks_above_min_height (a flat top reaching the end of the window is not a peak)
+  while (i < n_size-1){
+    n_x = maxim_smoothed_ir(ps_ring, un_ir_mean, i);
+    if (n_x > n_min_height && n_x > maxim_smoothed_ir(ps_ring, un_ir_mean, i-1)){      // find left edge of potential peaks
+      n_width = 1;
+      while (i+n_width < n_size && n_x == maxim_smoothed_ir(ps_ring, un_ir_mean, i+n_width))  // find flat peaks
+        n_width++;
+      if (i+n_width < n_size && n_x > maxim_smoothed_ir(ps_ring, un_ir_mean, i+n_width)){      // find right edge of peaks
+        maxim_keep_peak(pn_locs, an_val, pn_npks, i, n_x, n_min_distance, 15);
+        // for flat peaks, peak location is left edge
+        i += n_width+1;
+      }
+      else
+        i += n_width;
+    }
+    else
+      i++;
+  }
+}
+
+static void maxim_window_calc(const maxim_ring_t *ps_ring, uint32_t un_ir_sum, int32_t n_sample_rate, int32_t n_min_distance, int32_t *pn_spo2, int8_t *pch_spo2_valid,
                 int32_t *pn_heart_rate, int8_t *pch_hr_valid)
 /**
-* \brief        Calculate the heart rate and SpO2 level
+* \brief        Calculate the heart rate and SpO2 level of a window
 * \par          Details
 *               By detecting  peaks of PPG cycle and corresponding AC/DC of red/infra-red signal, the an_ratio for the SPO2 is computed.
 *               Since this algorithm is aiming for Arm M0/M3. formaula for SPO2 did not achieve the accuracy due to register overflow.
 *               Thus, accurate SPO2 is precalculated and save longo uch_spo2_table[] per each an_ratio.
-*
-* \param[in]    *pun_ir_buffer           - IR sensor data buffer
-* \param[in]    n_ir_buffer_length      - IR sensor data buffer length
-* \param[in]    *pun_red_buffer          - Red sensor data buffer
-* \param[out]    *pn_spo2                - Calculated SpO2 value
-* \param[out]    *pch_spo2_valid         - 1 if the calculated SpO2 value is valid
-* \param[out]    *pn_heart_rate          - Calculated heart rate value
-* \param[out]    *pch_hr_valid           - 1 if the calculated heart rate value is valid
+*               The DC mean comes from the running sum of the IR samples, the smoothed signal is
+*               computed as it is read and AC/DC are taken from the raw samples: no work buffers.
 *
 * \retval       None
 */
 {
   uint32_t un_ir_mean;
   int32_t k, n_i_ratio_count;
-  int32_t i, n_exact_ir_valley_locs_count, n_middle_idx;
+  int32_t i, n_exact_ir_valley_locs_count;
   int32_t n_th1, n_npks;
   int32_t an_ir_valley_locs[15] ;
   int32_t n_peak_interval_sum;
@@ -106,37 +249,40 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
   int32_t n_x_dc_max_idx = 0;
   int32_t an_ratio[5], n_ratio_average;
   int32_t n_nume, n_denom ;
+  int32_t n_ir_buffer_length = ps_ring->n_length;
+  int32_t an_ma4[MA4_SIZE], n_ma4_sum, n_x;
 
-  // calculates DC mean and subtract DC from ir
-  un_ir_mean =0;
-  for (k=0 ; k<n_ir_buffer_length ; k++ ) un_ir_mean += pun_ir_buffer[k] ;
-  un_ir_mean =un_ir_mean/n_ir_buffer_length ;
+// raw samples of the window: RED(=y) and IR(=X)
+#define RAW_X(k) ((int32_t)ps_ring->pun_ir[maxim_ring_idx(ps_ring, (k))])
+#define RAW_Y(k) ((int32_t)ps_ring->pun_red[maxim_ring_idx(ps_ring, (k))])
 
-  // remove DC and invert signal so that we can use peak detector as valley detector
-  for (k=0 ; k<n_ir_buffer_length ; k++ )
-    an_x[k] = -1*(pun_ir_buffer[k] - un_ir_mean) ;
+  // DC mean
+  un_ir_mean =un_ir_sum/n_ir_buffer_length ;
 
-  // 4 pt Moving Average
-  for(k=0; k< BUFFER_SIZE-MA4_SIZE; k++){
-    an_x[k]=( an_x[k]+an_x[k+1]+ an_x[k+2]+ an_x[k+3])/(int)4;
-  }
-  // calculate threshold
+  // calculate threshold: mean of the inverted, DC free signal after the 4 pt moving average
+  // (running sum of the last MA4_SIZE samples; the last MA4_SIZE samples are not averaged)
   n_th1=0;
-  for ( k=0 ; k<BUFFER_SIZE ;k++){
-    n_th1 +=  an_x[k];
+  n_ma4_sum=0;
+  for ( k=0 ; k<MA4_SIZE ;k++) an_ma4[k]=0;
+  for ( k=0 ; k<n_ir_buffer_length ;k++){
+    n_x = (int32_t)(un_ir_mean - (uint32_t)RAW_X(k));
+    if (k >= n_ir_buffer_length-MA4_SIZE) n_th1 += n_x;
+    n_ma4_sum += n_x - an_ma4[k % MA4_SIZE];
+    an_ma4[k % MA4_SIZE] = n_x;
+    if (k >= MA4_SIZE-1 && k < n_ir_buffer_length-1) n_th1 += n_ma4_sum/(int)4;
   }
-  n_th1=  n_th1/ ( BUFFER_SIZE);
+  n_th1=  n_th1/ ( n_ir_buffer_length);
   if( n_th1<30) n_th1=30; // min allowed
   if( n_th1>60) n_th1=60; // max allowed
 
   for ( k=0 ; k<15;k++) an_ir_valley_locs[k]=0;
   // since we flipped signal, we use peak detector as valley detector
-  maxim_find_peaks( an_ir_valley_locs, &n_npks, an_x, BUFFER_SIZE, n_th1, 4, 15 );//peak_height, peak_distance, max_num_peaks
+  maxim_find_valleys( ps_ring, un_ir_mean, an_ir_valley_locs, &n_npks, n_th1, n_min_distance );//peak_height, peak_distance
   n_peak_interval_sum =0;
   if (n_npks>=2){
     for (k=1; k<n_npks; k++) n_peak_interval_sum += (an_ir_valley_locs[k] -an_ir_valley_locs[k -1] ) ;
     n_peak_interval_sum =n_peak_interval_sum/(n_npks-1);
-    *pn_heart_rate =(int32_t)( (FreqS*60)/ n_peak_interval_sum );
+    *pn_heart_rate =(int32_t)( (n_sample_rate*60)/ n_peak_interval_sum );
     *pch_hr_valid  = 1;
   }
   else  {
@@ -144,12 +290,6 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
     *pch_hr_valid  = 0;
   }
 
-  //  load raw value again for SPO2 calculation : RED(=y) and IR(=X)
-  for (k=0 ; k<n_ir_buffer_length ; k++ )  {
-      an_x[k] =  pun_ir_buffer[k] ;
-      an_y[k] =  pun_red_buffer[k] ;
-  }
-
   // find precise min near an_ir_valley_locs
   n_exact_ir_valley_locs_count =n_npks;
 
@@ -160,7 +300,7 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
   n_i_ratio_count = 0;
   for(k=0; k< 5; k++) an_ratio[k]=0;
   for (k=0; k< n_exact_ir_valley_locs_count; k++){
-    if (an_ir_valley_locs[k] > BUFFER_SIZE ){
+    if (an_ir_valley_locs[k] > n_ir_buffer_length ){
       *pn_spo2 =  -999 ; // do not use SPO2 since valley loc is out of range
       *pch_spo2_valid  = 0;
       return;
@@ -173,15 +313,15 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
     n_x_dc_max= -16777216;
     if (an_ir_valley_locs[k+1]-an_ir_valley_locs[k] >3){
         for (i=an_ir_valley_locs[k]; i< an_ir_valley_locs[k+1]; i++){
-          if (an_x[i]> n_x_dc_max) {n_x_dc_max =an_x[i]; n_x_dc_max_idx=i;}
-          if (an_y[i]> n_y_dc_max) {n_y_dc_max =an_y[i]; n_y_dc_max_idx=i;}
+          if (RAW_X(i)> n_x_dc_max) {n_x_dc_max =RAW_X(i); n_x_dc_max_idx=i;}
+          if (RAW_Y(i)> n_y_dc_max) {n_y_dc_max =RAW_Y(i); n_y_dc_max_idx=i;}
       }
-      n_y_ac= (an_y[an_ir_valley_locs[k+1]] - an_y[an_ir_valley_locs[k] ] )*(n_y_dc_max_idx -an_ir_valley_locs[k]); //red
-      n_y_ac=  an_y[an_ir_valley_locs[k]] + n_y_ac/ (an_ir_valley_locs[k+1] - an_ir_valley_locs[k])  ;
-      n_y_ac=  an_y[n_y_dc_max_idx] - n_y_ac;    // subracting linear DC compoenents from raw
-      n_x_ac= (an_x[an_ir_valley_locs[k+1]] - an_x[an_ir_valley_locs[k] ] )*(n_x_dc_max_idx -an_ir_valley_locs[k]); // ir
-      n_x_ac=  an_x[an_ir_valley_locs[k]] + n_x_ac/ (an_ir_valley_locs[k+1] - an_ir_valley_locs[k]);
-      n_x_ac=  an_x[n_y_dc_max_idx] - n_x_ac;      // subracting linear DC compoenents from raw
+      n_y_ac= (RAW_Y(an_ir_valley_locs[k+1]) - RAW_Y(an_ir_valley_locs[k]) )*(n_y_dc_max_idx -an_ir_valley_locs[k]); //red
+      n_y_ac=  RAW_Y(an_ir_valley_locs[k]) + n_y_ac/ (an_ir_valley_locs[k+1] - an_ir_valley_locs[k])  ;
+      n_y_ac=  RAW_Y(n_y_dc_max_idx) - n_y_ac;    // subracting linear DC compoenents from raw
+      n_x_ac= (RAW_X(an_ir_valley_locs[k+1]) - RAW_X(an_ir_valley_locs[k]) )*(n_x_dc_max_idx -an_ir_valley_locs[k]); // ir
+      n_x_ac=  RAW_X(an_ir_valley_locs[k]) + n_x_ac/ (an_ir_valley_locs[k+1] - an_ir_valley_locs[k]);
+      n_x_ac=  RAW_X(n_y_dc_max_idx) - n_x_ac;      // subracting linear DC compoenents from raw
       n_nume=( n_y_ac *n_x_dc_max)>>7 ; //prepare X100 to preserve floating value
       n_denom= ( n_x_ac *n_y_dc_max)>>7;
       if (n_denom>0  && n_i_ratio_count <5 &&  n_nume != 0)
@@ -191,14 +331,10 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
       }
     }
   }
+#undef RAW_X
+#undef RAW_Y
   // choose median value since PPG signal may varies from beat to beat
-  maxim_sort_ascend(an_ratio, n_i_ratio_count);
-  n_middle_idx= n_i_ratio_count/2;
-
-  if (n_middle_idx >1)
-    n_ratio_average =( an_ratio[n_middle_idx-1] +an_ratio[n_middle_idx])/2; // use median
-  else
-    n_ratio_average = an_ratio[n_middle_idx ];
+  n_ratio_average = maxim_median(an_ratio, n_i_ratio_count);
 
   if( n_ratio_average>2 && n_ratio_average <184){
     n_spo2_calc= uch_spo2_table[n_ratio_average] ;
@@ -211,19 +347,352 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
   }
 }
 
+void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid,
+                int32_t *pn_heart_rate, int8_t *pch_hr_valid)
+/**
+* \brief        Calculate the heart rate and SpO2 level (FreqS window of BUFFER_SIZE samples)
+* \par          Details
+*               Window algorithm with the fixed MAXREFDES117# configuration, see maxim_heart_rate_and_oxygen_saturation_config.
+*
+* \retval       None
+*/
+{
+  maxim_spo2_config_t s_cfg = { FreqS, MIN(n_ir_buffer_length, BUFFER_SIZE), 4, NULL, NULL };
+  maxim_heart_rate_and_oxygen_saturation_config(&s_cfg, pun_ir_buffer, pun_red_buffer, pn_spo2, pch_spo2_valid, pn_heart_rate, pch_hr_valid);
+}
+
+void maxim_heart_rate_and_oxygen_saturation_config(const maxim_spo2_config_t *ps_cfg, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid,
+                int32_t *pn_heart_rate, int8_t *pch_hr_valid)
+/**
+* \brief        Calculate the heart rate and SpO2 level
+* \par          Details
+*               Window algorithm on the first n_buffer_size samples of the buffers (the work
+*               buffers of the configuration are not used). To update a window with each batch
+*               of new samples without copying it, see maxim_spo2_window_push.
+*
+* \param[in]    *ps_cfg                  - Sampling frequency, window length (samples in the buffers) and valley distance
+* \param[in]    *pun_ir_buffer           - IR sensor data buffer
+* \param[in]    *pun_red_buffer          - Red sensor data buffer
+* \param[out]    *pn_spo2                - Calculated SpO2 value
+* \param[out]    *pch_spo2_valid         - 1 if the calculated SpO2 value is valid
+* \param[out]    *pn_heart_rate          - Calculated heart rate value
+* \param[out]    *pch_hr_valid           - 1 if the calculated heart rate value is valid
+*
+* \retval       None
+*/
+{
+  maxim_ring_t s_ring = { pun_ir_buffer, pun_red_buffer, 0, ps_cfg->n_buffer_size, ps_cfg->n_buffer_size };
+  uint32_t un_ir_sum = 0;
+  int32_t k;
+
+  for (k=0 ; k<ps_cfg->n_buffer_size ; k++ ) un_ir_sum += pun_ir_buffer[k] ;
+  maxim_window_calc(&s_ring, un_ir_sum, ps_cfg->n_sample_rate, ps_cfg->n_min_distance, pn_spo2, pch_spo2_valid, pn_heart_rate, pch_hr_valid);
+}
+
+void maxim_spo2_window_init(maxim_spo2_window_t *ps_win, const maxim_spo2_config_t *ps_cfg)
+/**
+* \brief        Initialize a sliding window (empty)
+*
+* \param[out]   *ps_win                 - Window state
+* \param[in]    *ps_cfg                 - Configuration: pn_x and pn_y hold the raw IR and red rings
+*
+* \retval       None
+*/
+{
+  ps_win->s_cfg = *ps_cfg;
+  ps_win->n_head = 0;
+  ps_win->n_count = 0;
+  ps_win->un_ir_sum = 0;
+}
+
+void maxim_spo2_window_push(maxim_spo2_window_t *ps_win, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t n_length)
+/**
+* \brief        Add new samples to a sliding window
+* \par          Details
+*               The oldest samples are overwritten in the rings and the IR running sum (DC mean)
+*               is updated with the samples in and out: work proportional to n_length.
+*
+* \param[in,out] *ps_win                - Window state
+* \param[in]    *pun_ir_buffer           - IR sensor samples
+* \param[in]    *pun_red_buffer          - Red sensor samples
+* \param[in]    n_length                - Number of samples
+*
+* \retval       None
+*/
+{
+  int32_t k;
+  int32_t n_size = ps_win->s_cfg.n_buffer_size;
+  uint32_t *pun_ir = (uint32_t *)ps_win->s_cfg.pn_x;
+
+  for (k=0; k<n_length; k++){
+    int32_t n_idx = ps_win->n_head + ps_win->n_count;
+    if (n_idx >= n_size) n_idx -= n_size;
+    if (ps_win->n_count == n_size){
+      ps_win->un_ir_sum -= pun_ir[n_idx];     // oldest sample out
+      if (++ps_win->n_head == n_size) ps_win->n_head = 0;
+    }
+    else
+      ps_win->n_count++;
+    pun_ir[n_idx] = pun_ir_buffer[k];
+    ps_win->s_cfg.pn_y[n_idx] = (int32_t)pun_red_buffer[k];
+    ps_win->un_ir_sum += pun_ir_buffer[k];
+  }
+}
+
+void maxim_spo2_window_calc(const maxim_spo2_window_t *ps_win, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid)
+/**
+* \brief        Calculate the heart rate and SpO2 level of a sliding window
+* \par          Details
+*               Same results as maxim_heart_rate_and_oxygen_saturation_config on the last
+*               n_buffer_size samples pushed. Not valid until the window is full.
+*
+* \param[in]    *ps_win                  - Window state
+* \param[out]    *pn_spo2                - Calculated SpO2 value
+* \param[out]    *pch_spo2_valid         - 1 if the calculated SpO2 value is valid
+* \param[out]    *pn_heart_rate          - Calculated heart rate value
+* \param[out]    *pch_hr_valid           - 1 if the calculated heart rate value is valid
+*
+* \retval       None
+*/
+{
+  maxim_ring_t s_ring = { (const uint32_t *)ps_win->s_cfg.pn_x, (const uint32_t *)ps_win->s_cfg.pn_y,
+                          ps_win->n_head, ps_win->s_cfg.n_buffer_size, ps_win->n_count };
+
+  if (ps_win->n_count < ps_win->s_cfg.n_buffer_size){
+    *pn_heart_rate = -999;
+    *pch_hr_valid  = 0;
+    *pn_spo2 =  -999 ;
+    *pch_spo2_valid  = 0;
+    return;
+  }
+  maxim_window_calc(&s_ring, ps_win->un_ir_sum, ps_win->s_cfg.n_sample_rate, ps_win->s_cfg.n_min_distance, pn_spo2, pch_spo2_valid, pn_heart_rate, pch_hr_valid);
+}
+
+
+static int32_t maxim_ratio_median(int32_t *pn_ratio, int32_t n_count)
+/**
+* \brief        Median of the beat ratios (same rule as maxim_heart_rate_and_oxygen_saturation)
+*
+* \retval       Ratio
+*/
+{
+  int32_t an_work[HR_SPO2_RATIOS];
+  int32_t k;
+  for (k=0; k<n_count; k++) an_work[k] = pn_ratio[k];
+  return maxim_median(an_work, n_count);
+}
+
+static void maxim_hr_spo2_beat(maxim_hr_spo2_t *ps_est, int32_t n_loc)
+/**
+* \brief        Close the beat that ends on the valley at n_loc
+* \par          Details
+*               Adds the valley interval to the heart rate and, as the window algorithm does
+*               between each pair of valleys, the ratio of AC (raw maximum minus the line joining
+*               both valleys) over DC (raw maximum) of red and IR to the SpO2.
+*
+* \retval       None
+*/
+{
+  int32_t n_dist, n_nume, n_denom, n_sum, k;
+  int64_t n_y_ac, n_x_ac;
+  uint32_t un_ir = ps_est->aun_ir[n_loc & (HR_SPO2_HISTORY-1)];
+  uint32_t un_red = ps_est->aun_red[n_loc & (HR_SPO2_HISTORY-1)];
+
+  if (ps_est->n_valley_loc >= 0){
+    n_dist = n_loc - ps_est->n_valley_loc;
+    // heart rate: mean of the last intervals
+    ps_est->an_interval[ps_est->n_interval_count % HR_SPO2_INTERVALS] = n_dist;
+    ps_est->n_interval_count++;
+    n_sum = 0;
+    for (k=0; k<MIN(ps_est->n_interval_count, HR_SPO2_INTERVALS); k++) n_sum += ps_est->an_interval[k];
+    ps_est->n_heart_rate = (ps_est->n_sample_rate*60*k)/n_sum;
+    ps_est->ch_hr_valid = 1;
+
+    if (n_dist >3){
+      n_y_ac = (int64_t)((int32_t)un_red - (int32_t)ps_est->un_valley_red)*(ps_est->n_red_max_loc - ps_est->n_valley_loc)/n_dist;
+      n_y_ac = (int64_t)ps_est->un_red_max - (ps_est->un_valley_red + n_y_ac);    // subracting linear DC compoenents from raw
+      n_x_ac = (int64_t)((int32_t)un_ir - (int32_t)ps_est->un_valley_ir)*(ps_est->n_ir_max_loc - ps_est->n_valley_loc)/n_dist;
+      n_x_ac = (int64_t)ps_est->un_ir_max - (ps_est->un_valley_ir + n_x_ac);
+      n_nume = (int32_t)((n_y_ac*ps_est->un_ir_max)>>7);
+      n_denom = (int32_t)((n_x_ac*ps_est->un_red_max)>>7);
+      if (n_denom>0 && n_nume != 0){
+        ps_est->an_ratio[ps_est->n_ratio_count % HR_SPO2_RATIOS] = ((int64_t)n_nume*100)/n_denom;
+        ps_est->n_ratio_count++;
+        n_nume = maxim_ratio_median(ps_est->an_ratio, MIN(ps_est->n_ratio_count, HR_SPO2_RATIOS));
+        if (n_nume>2 && n_nume <184){
+          ps_est->n_spo2 = uch_spo2_table[n_nume];
+          ps_est->ch_spo2_valid = 1;
+        }
+        else{
+          ps_est->n_spo2 = -999;
+          ps_est->ch_spo2_valid = 0;
+        }
+      }
+    }
+  }
+
+  // new beat: maxima since the valley (the samples already stored after it)
+  ps_est->n_valley_loc = n_loc;
+  ps_est->un_valley_ir = un_ir;
+  ps_est->un_valley_red = un_red;
+  ps_est->un_ir_max = 0;
+  ps_est->un_red_max = 0;
+  for (k=n_loc; k<ps_est->n_count; k++){
+    if (ps_est->aun_ir[k & (HR_SPO2_HISTORY-1)] > ps_est->un_ir_max){
+      ps_est->un_ir_max = ps_est->aun_ir[k & (HR_SPO2_HISTORY-1)];
+      ps_est->n_ir_max_loc = k;
+    }
+    if (ps_est->aun_red[k & (HR_SPO2_HISTORY-1)] > ps_est->un_red_max){
+      ps_est->un_red_max = ps_est->aun_red[k & (HR_SPO2_HISTORY-1)];
+      ps_est->n_red_max_loc = k;
+    }
+  }
+}
+
+void maxim_hr_spo2_init(maxim_hr_spo2_t *ps_est, int32_t n_sample_rate)
+/**
+* \brief        Initialize the incremental heart rate/SpO2 estimator
+*
+* \param[out]   *ps_est                 - Estimator state
+* \param[in]    n_sample_rate           - Sampling frequency (Hz)
+*
+* \retval       None
+*/
+{
+  int32_t k;
+  ps_est->n_sample_rate = n_sample_rate;
+  for (ps_est->n_dc_shift=0; (1<<ps_est->n_dc_shift) < n_sample_rate; ps_est->n_dc_shift++);
+  ps_est->n_ir_dc = 0;
+  ps_est->n_th = 0;
+  for (k=0; k<MA4_SIZE; k++) ps_est->an_ma4[k] = 0;
+  ps_est->n_ma4_sum = 0;
+  ps_est->n_ma4_prev = 0;
+  ps_est->n_cand_loc = -1;
+  ps_est->n_cand_val = 0;
+  ps_est->n_count = 0;
+  ps_est->n_valley_loc = -1;
+  ps_est->n_interval_count = 0;
+  ps_est->n_ratio_count = 0;
+  ps_est->n_heart_rate = -999;
+  ps_est->ch_hr_valid = 0;
+  ps_est->n_spo2 = -999;
+  ps_est->ch_spo2_valid = 0;
+}
+
+void maxim_hr_spo2_update(maxim_hr_spo2_t *ps_est, uint32_t *pun_ir_buffer, uint32_t *pun_red_buffer, int32_t n_length)
+/**
+* \brief        Update the heart rate and SpO2 level with new samples
+* \par          Details
+*               Work per sample is constant (no window sorts or searches), so results can be
+*               read after every batch (i.e. each FIFO read) in ps_est->n_heart_rate and ps_est->n_spo2.
+*               Two seconds without valleys (less than 30 bpm) invalidate both results.
+*
+* \param[in,out] *ps_est                - Estimator state
+* \param[in]    *pun_ir_buffer           - IR sensor samples
+* \param[in]    *pun_red_buffer          - Red sensor samples
+* \param[in]    n_length                - Number of samples
+*
+* \retval       None
+*/
+{
+  int32_t k, n_x, n_ma4, n_th1;
+  int32_t n_min_distance = ps_est->n_sample_rate/4;  // up to 240 bpm
+
+  for (k=0; k<n_length; k++){
+    int32_t n_idx = ps_est->n_count & (HR_SPO2_HISTORY-1);
+    ps_est->aun_ir[n_idx] = pun_ir_buffer[k];
+    ps_est->aun_red[n_idx] = pun_red_buffer[k];
+
+    // running DC mean and DC free, inverted IR (so that valleys are peaks)
+    if (ps_est->n_count == 0) ps_est->n_ir_dc = (int32_t)pun_ir_buffer[k] << ps_est->n_dc_shift;
+    ps_est->n_ir_dc += (int32_t)pun_ir_buffer[k] - (ps_est->n_ir_dc >> ps_est->n_dc_shift);
+    n_x = (ps_est->n_ir_dc >> ps_est->n_dc_shift) - (int32_t)pun_ir_buffer[k];
+
+    // 4 pt moving average: its sample n_count - MA4_SIZE + 1 matches an_x[] of the window algorithm
+    ps_est->n_ma4_sum += n_x - ps_est->an_ma4[ps_est->n_count % MA4_SIZE];
+    ps_est->an_ma4[ps_est->n_count % MA4_SIZE] = n_x;
+    n_ma4 = ps_est->n_ma4_sum/4;
+    ps_est->n_th += (n_ma4 - ps_est->n_th) >> ps_est->n_dc_shift;
+    ps_est->n_count++;
+    if (ps_est->n_count < MA4_SIZE){
+      ps_est->n_ma4_prev = n_ma4;
+      continue;
+    }
+
+    // raw maxima of the current beat
+    if (ps_est->n_valley_loc >= 0){
+      if (pun_ir_buffer[k] > ps_est->un_ir_max){
+        ps_est->un_ir_max = pun_ir_buffer[k];
+        ps_est->n_ir_max_loc = ps_est->n_count - 1;
+      }
+      if (pun_red_buffer[k] > ps_est->un_red_max){
+        ps_est->un_red_max = pun_red_buffer[k];
+        ps_est->n_red_max_loc = ps_est->n_count - 1;
+      }
+    }
+
+    // peak detector as in maxim_peaks_above_min_height: left edge, flat top, right edge
+    n_th1 = ps_est->n_th;
+    if( n_th1<30) n_th1=30; // min allowed
+    if( n_th1>60) n_th1=60; // max allowed
+    if (n_ma4 > ps_est->n_ma4_prev){
+      ps_est->n_cand_loc = ps_est->n_count - MA4_SIZE;   // first raw sample of the average
+      ps_est->n_cand_val = n_ma4;
+    }
+    else if (ps_est->n_cand_loc >= 0 && n_ma4 < ps_est->n_cand_val){
+      if (ps_est->n_cand_val > n_th1 && ps_est->n_count - ps_est->n_cand_loc <= HR_SPO2_HISTORY &&
+          (ps_est->n_valley_loc < 0 || ps_est->n_cand_loc - ps_est->n_valley_loc > n_min_distance))
+        maxim_hr_spo2_beat(ps_est, ps_est->n_cand_loc);
+      ps_est->n_cand_loc = -1;
+    }
+    ps_est->n_ma4_prev = n_ma4;
+
+    // no pulse
+    if (ps_est->n_valley_loc >= 0 && ps_est->n_count - ps_est->n_valley_loc > 2*ps_est->n_sample_rate){
+      ps_est->n_valley_loc = -1;
+      ps_est->n_interval_count = 0;
+      ps_est->n_ratio_count = 0;
+      ps_est->n_heart_rate = -999;
+      ps_est->ch_hr_valid = 0;
+      ps_est->n_spo2 = -999;
+      ps_est->ch_spo2_valid = 0;
+    }
+  }
+}
+
 
 void maxim_find_peaks( int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height, int32_t n_min_distance, int32_t n_max_num )
 /**
 * \brief        Find peaks
 * \par          Details
-*               Find at most MAX_NUM peaks above MIN_HEIGHT separated by at least MIN_DISTANCE
+*               Find at most MAX_NUM peaks above MIN_HEIGHT separated by at least MIN_DISTANCE,
+*               in ascending order. Single pass: the distance is enforced as the peaks are found
+*               (a close peak replaces the previous one if it is higher), without sorting.
 *
 * \retval       None
 */
 {
-  maxim_peaks_above_min_height( pn_locs, n_npks, pn_x, n_size, n_min_height );
-  maxim_remove_close_peaks( pn_locs, n_npks, pn_x, n_min_distance );
-  *n_npks = MIN( *n_npks, n_max_num );
+  int32_t an_val[15];
+  int32_t i = 1, n_width;
+  *n_npks = 0;
+  n_max_num = MIN( n_max_num, 15 );
+
+  while (i < n_size-1){
+    if (pn_x[i] > n_min_height && pn_x[i] > pn_x[i-1]){      // find left edge of potential peaks
+      n_width = 1;
+      while (i+n_width < n_size && pn_x[i] == pn_x[i+n_width])  // find flat peaks
+        n_width++;
+      if (i+n_width < n_size && pn_x[i] > pn_x[i+n_width]){      // find right edge of peaks
+        maxim_keep_peak( pn_locs, an_val, n_npks, i, pn_x[i], n_min_distance, n_max_num );
+        // for flat peaks, peak location is left edge
+        i += n_width+1;
+      }
+      else
+        i += n_width;
+    }
+    else
+      i++;
+  }
 }
 
 void maxim_peaks_above_min_height( int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height )
@@ -260,29 +729,18 @@ void maxim_remove_close_peaks(int32_t *pn_locs, int32_t *pn_npks, int32_t *pn_x,
 /**
 * \brief        Remove peaks
 * \par          Details
-*               Remove peaks separated by less than MIN_DISTANCE
+*               Remove peaks separated by less than MIN_DISTANCE (pn_locs in ascending order, as
+*               given by maxim_peaks_above_min_height): one pass with the rule of maxim_find_peaks.
 *
 * \retval       None
 */
 {
+  int32_t an_val[15];
+  int32_t k, n_old_npks = MIN( *pn_npks, 15 );
 
-  int32_t i, j, n_old_npks, n_dist;
-
-  /* Order peaks from large to small */
-  maxim_sort_indices_descend( pn_x, pn_locs, *pn_npks );
-
-  for ( i = -1; i < *pn_npks; i++ ){
-    n_old_npks = *pn_npks;
-    *pn_npks = i+1;
-    for ( j = i+1; j < n_old_npks; j++ ){
-      n_dist =  pn_locs[j] - ( i == -1 ? -1 : pn_locs[i] ); // lag-zero peak of autocorr is at index -1
-      if ( n_dist > n_min_distance || n_dist < -n_min_distance )
-        pn_locs[(*pn_npks)++] = pn_locs[j];
-    }
-  }
-
-  // Resort indices int32_to ascending order
-  maxim_sort_ascend( pn_locs, *pn_npks );
+  *pn_npks = 0;
+  for ( k = 0; k < n_old_npks; k++ )
+    maxim_keep_peak( pn_locs, an_val, pn_npks, pn_locs[k], pn_x[pn_locs[k]], n_min_distance, 15 );
 }
 
 void maxim_sort_ascend(int32_t  *pn_x, int32_t n_size)
@@ -12,18 +12,114 @@
 /*==================[inclusions]=============================================*/
 #include "switch.h"
 #include "gpio_mcu.h"
+#include <stddef.h>
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "time_mcu.h"
+#include "static_alloc_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_SWITCH1 GPIO_4
 #define GPIO_SWITCH2 GPIO_15
+#define SWITCH_QTY		2
+#define US_PER_MS		1000
 /*==================[internal data declaration]==============================*/
-
+/**
+ * @brief Debounce state of a switch
+ */
+typedef struct {
+	gpio_t gpio;					/*!< Switch GPIO (low when pressed) */
+	switch_t sw;					/*!< Switch */
+	bool pressed;					/*!< Debounced state */
+	bool pending;					/*!< Edge waiting for the stable check */
+	int64_t edge_time;				/*!< Time of the last edge */
+	esp_timer_handle_t debounce;	/*!< Stable state check */
+	esp_timer_handle_t long_press;	/*!< Long press timeout */
+} switch_debounce_t;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static switch_debounce_t switches[SWITCH_QTY] = {
+	{.gpio = GPIO_SWITCH1, .sw = SWITCH_1},
+	{.gpio = GPIO_SWITCH2, .sw = SWITCH_2},
+};
+static QueueHandle_t event_queue = NULL;
+STATIC_QUEUE_DEFINE(event_queue, SWITCH_EVENT_QUEUE, sizeof(switch_event_t));
+static uint32_t debounce_us;
+static uint32_t long_press_us;
+static portMUX_TYPE switch_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void SwitchPostEvent(switch_debounce_t *sw, switch_event_type_t type, int64_t time){
+	switch_event_t event = {
+		.sw = sw->sw,
+		.type = type,
+		.time = time,
+	};
+	/* if no task reads the events the newest ones are lost */
+	xQueueSend(event_queue, &event, 0);
+}
+
+/**
+ * @brief Edge interruption: only saves the time, following edges of the
+ * bounce just move it
+ */
+static void IRAM_ATTR SwitchEdgeIsr(void *args){
+	switch_debounce_t *sw = (switch_debounce_t *)args;
+	bool start;
+	taskENTER_CRITICAL_ISR(&switch_mux);
+	sw->edge_time = TimeNowUs();
+	start = !sw->pending;
+	sw->pending = true;
+	taskEXIT_CRITICAL_ISR(&switch_mux);
+	if(start){
+		esp_timer_start_once(sw->debounce, debounce_us);
+	}
+}
+
+/**
+ * @brief Checks the switch state once it's stable for the debounce time
+ */
+static void SwitchDebounceTimer(void *args){
+	switch_debounce_t *sw = (switch_debounce_t *)args;
+	int64_t edge_time;
+	int64_t elapsed;
+	taskENTER_CRITICAL(&switch_mux);
+	edge_time = sw->edge_time;
+	elapsed = TimeNowUs() - edge_time;
+	if(elapsed < debounce_us){
+		taskEXIT_CRITICAL(&switch_mux);
+		/* still bouncing: check again debounce_us after the last edge */
+		esp_timer_start_once(sw->debounce, debounce_us - elapsed);
+		return;
+	}
+	sw->pending = false;
+	taskEXIT_CRITICAL(&switch_mux);
+	bool pressed = !GPIORead(sw->gpio);
+	if(pressed == sw->pressed){
+		return;
+	}
+	sw->pressed = pressed;
+	if(pressed){
+		SwitchPostEvent(sw, SWITCH_PRESSED, edge_time);
+		if(long_press_us > 0){
+			esp_timer_start_once(sw->long_press, long_press_us);
+		}
+	}
+	else{
+		if(long_press_us > 0){
+			esp_timer_stop(sw->long_press);
+		}
+		SwitchPostEvent(sw, SWITCH_RELEASED, edge_time);
+	}
+}
+
+static void SwitchLongPressTimer(void *args){
+	switch_debounce_t *sw = (switch_debounce_t *)args;
+	if(sw->pressed){
+		SwitchPostEvent(sw, SWITCH_LONG_PRESS, TimeNowUs());
+	}
+}
 
 /*==================[external functions definition]==========================*/
 int8_t SwitchesInit(void){
@@ -54,4 +150,42 @@ void SwitchActivInt(switch_t sw, void *ptr_int_func, void *args){
 		break;
 	}
 }
+
+bool SwitchesEventsInit(uint16_t debounce_ms, uint16_t long_press_ms){
+	if(event_queue != NULL){
+		return true;
+	}
+	debounce_us = (uint32_t)debounce_ms * US_PER_MS;
+	long_press_us = (uint32_t)long_press_ms * US_PER_MS;
+	event_queue = STATIC_QUEUE_CREATE(event_queue, SWITCH_EVENT_QUEUE, sizeof(switch_event_t));
+	if(event_queue == NULL){
+		return false;
+	}
+	for(uint8_t i = 0; i < SWITCH_QTY; i++){
+		esp_timer_create_args_t debounce_args = {
+			.callback = SwitchDebounceTimer,
+			.arg = &switches[i],
+			.name = "switch_debounce"
+		};
+		esp_timer_create_args_t long_press_args = {
+			.callback = SwitchLongPressTimer,
+			.arg = &switches[i],
+			.name = "switch_long"
+		};
+		if(esp_timer_create(&debounce_args, &switches[i].debounce) != ESP_OK ||
+		   esp_timer_create(&long_press_args, &switches[i].long_press) != ESP_OK){
+			return false;
+		}
+		switches[i].pressed = !GPIORead(switches[i].gpio);
+		GPIOActivIntAnyEdge(switches[i].gpio, SwitchEdgeIsr, &switches[i]);
+	}
+	return true;
+}
+
+bool SwitchesWaitEvent(switch_event_t *event, TickType_t ticks_to_wait){
+	if(event_queue == NULL){
+		return false;
+	}
+	return xQueueReceive(event_queue, event, ticks_to_wait) == pdTRUE;
+}
 /*==================[end of file]============================================*/
@@ -11,17 +11,42 @@
 
 /*==================[inclusions]=============================================*/
 #include "ws2812b.h"
+#include <stddef.h>
+#include <stdbool.h>
 #include "gpio_mcu.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "gpio_fast_out_mcu.h"
-#include "delay_mcu.h"
+#include "driver/rmt_tx.h"
 /*==================[macros and definitions]=================================*/
-#define RET_CMD (50)    // ret command 50us low
-#define BIT_0   (1)     // bit 0
-#define BIT_7   (1<<7)  // bit 0
+#define RMT_RESOLUTION  10000000    // 10 MHz, 0.1us per tick
+#define RMT_MEM_SYMBOLS 48          // RMT channel memory (symbols)
+#define RMT_QUEUE_DEPTH 4           // pending transactions (frame + ret)
+#define T0H_TICKS       4           // bit 0: 0.4us high
+#define T0L_TICKS       9           // bit 0: 0.85us low
+#define T1H_TICKS       8           // bit 1: 0.8us high
+#define T1L_TICKS       5           // bit 1: 0.45us low
+#define RET_CMD         (50)        // ret command 50us low
+#define RET_TICKS       (RET_CMD * (RMT_RESOLUTION / 1000000) / 2)
+#define RED_OFFSET      16
+#define GREEN_OFFSET    8
+#define BLUE_OFFSET     0
 /*==================[internal data declaration]==============================*/
 gpio_t pin_number;
+/**
+ * @brief Encoder of a frame of 0x00RRGGBB colors: each color is converted to its
+ * G, R and B bytes when the RMT memory is refilled, so the frame isn't copied.
+ */
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encoder_t *bytes_encoder;   // bits of the G, R and B bytes of one led
+    rmt_encoder_t *ret_encoder;     // ret command after the last led
+    const uint32_t *colors;
+    const uint8_t *lut;             // level of each component
+    uint16_t leds;
+    uint8_t stride;                 // 0: the same color for all the leds
+    uint16_t led;                   // led being encoded
+    bool ret;                       // all the leds encoded, ret command being encoded
+} color_encoder_t;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -44,333 +69,199 @@ static const uint8_t gamma_table[256] = {
     184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
     218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
     255};
+
+static rmt_channel_handle_t led_chan = NULL;
+static rmt_encoder_handle_t bytes_encoder = NULL;
+static rmt_encoder_handle_t ret_encoder = NULL;
+static color_encoder_t color_encoder;
+static const uint32_t color_off = 0;
+static const rmt_symbol_word_t ret_symbol = {
+    .level0 = 0, .duration0 = RET_TICKS,
+    .level1 = 0, .duration1 = RET_TICKS,
+};
+static const rmt_transmit_config_t tx_config = {
+    .loop_count = 0,
+};
+static uint8_t frame_buffer[WS2812B_MAX_LEDS * 3];  // G, R, B bytes queued by ws2812bSend
+static uint16_t frame_bytes = 0;
+static volatile uint8_t tx_pending = 0;           // transactions queued to the RMT channel
+static portMUX_TYPE tx_mux = portMUX_INITIALIZER_UNLOCKED;
+static void (*done_func_p)(void *param) = NULL;
+static void *done_param_p = NULL;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-void IRAM_ATTR ws2812bSendHigh(gpio_t pin){
-    GPIOFastWrite(1);
-    //delay 0.8us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
-    __asm__ __volatile__ ("nop");   // 30
-    __asm__ __volatile__ ("nop");   // 31
-    __asm__ __volatile__ ("nop");   // 32
-    __asm__ __volatile__ ("nop");   // 33
-    __asm__ __volatile__ ("nop");   // 34
-    __asm__ __volatile__ ("nop");   // 35
-    __asm__ __volatile__ ("nop");   // 36
-    __asm__ __volatile__ ("nop");   // 37
-    __asm__ __volatile__ ("nop");   // 38
-    __asm__ __volatile__ ("nop");   // 39
-    __asm__ __volatile__ ("nop");   // 40
-    __asm__ __volatile__ ("nop");   // 41
-    __asm__ __volatile__ ("nop");   // 42
-    __asm__ __volatile__ ("nop");   // 43
-    __asm__ __volatile__ ("nop");   // 44
-    __asm__ __volatile__ ("nop");   // 45
-    __asm__ __volatile__ ("nop");   // 46
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 48
-    __asm__ __volatile__ ("nop");   // 49
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 60
-    __asm__ __volatile__ ("nop");   // 61
-    __asm__ __volatile__ ("nop");   // 62
-    __asm__ __volatile__ ("nop");   // 63
-    __asm__ __volatile__ ("nop");   // 64
-    __asm__ __volatile__ ("nop");   // 65
-    __asm__ __volatile__ ("nop");   // 66
-    __asm__ __volatile__ ("nop");   // 67
-    __asm__ __volatile__ ("nop");   // 68
-    __asm__ __volatile__ ("nop");   // 69
-    __asm__ __volatile__ ("nop");   // 70
-    __asm__ __volatile__ ("nop");   // 71
-    __asm__ __volatile__ ("nop");   // 72
-    __asm__ __volatile__ ("nop");   // 73
-    __asm__ __volatile__ ("nop");   // 74
-    __asm__ __volatile__ ("nop");   // 75
-    __asm__ __volatile__ ("nop");   // 76
-    __asm__ __volatile__ ("nop");   // 77
-    __asm__ __volatile__ ("nop");   // 78
-    __asm__ __volatile__ ("nop");   // 79
-    __asm__ __volatile__ ("nop");   // 80
-    __asm__ __volatile__ ("nop");   // 81
-    __asm__ __volatile__ ("nop");   // 82
-    __asm__ __volatile__ ("nop");   // 83
-    __asm__ __volatile__ ("nop");   // 84
-    __asm__ __volatile__ ("nop");   // 85
-    __asm__ __volatile__ ("nop");   // 86
-    __asm__ __volatile__ ("nop");   // 87
-    __asm__ __volatile__ ("nop");   // 88
-    __asm__ __volatile__ ("nop");   // 89
-    __asm__ __volatile__ ("nop");   // 90
-    __asm__ __volatile__ ("nop");   // 91
-    
-    GPIOFastWrite(0);
-	//delay 0.45us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
+
+static bool IRAM_ATTR ws2812bTxDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata, void *user_ctx){
+    bool frame_done = false;
+    taskENTER_CRITICAL_ISR(&tx_mux);
+    if(tx_pending > 0){
+        tx_pending--;
+        frame_done = (tx_pending == 0);
+    }
+    taskEXIT_CRITICAL_ISR(&tx_mux);
+    if(frame_done && done_func_p != NULL){
+        done_func_p(done_param_p);
+    }
+    return false;
+}
+
+/**
+ * @brief Encode the leds of the frame from the current one until the RMT memory
+ * (ping-pong halves of RMT_MEM_SYMBOLS) is full, then the ret command.
+ * 
+ * @note Called from the RMT interrupt on every refill: only the bits of the
+ * current led are kept, by the bytes encoder.
+ */
+static size_t IRAM_ATTR ws2812bEncodeColors(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+                                            const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state){
+    color_encoder_t *enc = __containerof(encoder, color_encoder_t, base);
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+    size_t symbols = 0;
+
+    while(!enc->ret && enc->led < enc->leds){
+        uint32_t color = enc->colors[enc->led * enc->stride];
+        uint8_t grb[3] = {
+            enc->lut[(color >> GREEN_OFFSET) & 0xFF],
+            enc->lut[(color >> RED_OFFSET) & 0xFF],
+            enc->lut[(color >> BLUE_OFFSET) & 0xFF],
+        };
+        symbols += enc->bytes_encoder->encode(enc->bytes_encoder, channel, grb, sizeof(grb), &state);
+        if(state & RMT_ENCODING_COMPLETE){
+            enc->led++;
+        }
+        if(state & RMT_ENCODING_MEM_FULL){
+            *ret_state = RMT_ENCODING_MEM_FULL;
+            return symbols;
+        }
+    }
+    enc->ret = true;
+    symbols += enc->ret_encoder->encode(enc->ret_encoder, channel, &ret_symbol, sizeof(ret_symbol), &state);
+    if(state & RMT_ENCODING_COMPLETE){
+        enc->led = 0;
+        enc->ret = false;
+        session_state |= RMT_ENCODING_COMPLETE;
+    }
+    if(state & RMT_ENCODING_MEM_FULL){
+        session_state |= RMT_ENCODING_MEM_FULL;
+    }
+    *ret_state = session_state;
+    return symbols;
 }
 
-void IRAM_ATTR ws2812bSendLow(gpio_t pin){
-    GPIOFastWrite(1);
-    //delay 0.4us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
+static esp_err_t ws2812bResetColors(rmt_encoder_t *encoder){
+    color_encoder_t *enc = __containerof(encoder, color_encoder_t, base);
+    rmt_encoder_reset(enc->bytes_encoder);
+    rmt_encoder_reset(enc->ret_encoder);
+    enc->led = 0;
+    enc->ret = false;
+    return ESP_OK;
+}
 
-    GPIOFastWrite(0);
-	//delay 0.85us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
-    __asm__ __volatile__ ("nop");   // 30
-    __asm__ __volatile__ ("nop");   // 31
-    __asm__ __volatile__ ("nop");   // 32
-    __asm__ __volatile__ ("nop");   // 33
-    __asm__ __volatile__ ("nop");   // 34
-    __asm__ __volatile__ ("nop");   // 35
-    __asm__ __volatile__ ("nop");   // 36
-    __asm__ __volatile__ ("nop");   // 37
-    __asm__ __volatile__ ("nop");   // 38
-    __asm__ __volatile__ ("nop");   // 39
-    __asm__ __volatile__ ("nop");   // 40
-    __asm__ __volatile__ ("nop");   // 41
-    __asm__ __volatile__ ("nop");   // 42
-    __asm__ __volatile__ ("nop");   // 43
-    __asm__ __volatile__ ("nop");   // 44
-    __asm__ __volatile__ ("nop");   // 45
-    __asm__ __volatile__ ("nop");   // 46
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 48
-    __asm__ __volatile__ ("nop");   // 49
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 60
-    __asm__ __volatile__ ("nop");   // 61
-    __asm__ __volatile__ ("nop");   // 62
-    __asm__ __volatile__ ("nop");   // 63
-    __asm__ __volatile__ ("nop");   // 64
-    __asm__ __volatile__ ("nop");   // 65
-    __asm__ __volatile__ ("nop");   // 66
-    __asm__ __volatile__ ("nop");   // 67
-    __asm__ __volatile__ ("nop");   // 68
-    __asm__ __volatile__ ("nop");   // 69
-    __asm__ __volatile__ ("nop");   // 70
-    __asm__ __volatile__ ("nop");   // 71
-    __asm__ __volatile__ ("nop");   // 72
-    __asm__ __volatile__ ("nop");   // 73
-    __asm__ __volatile__ ("nop");   // 74
-    __asm__ __volatile__ ("nop");   // 75
-    __asm__ __volatile__ ("nop");   // 76
-    __asm__ __volatile__ ("nop");   // 77
-    __asm__ __volatile__ ("nop");   // 78
-    __asm__ __volatile__ ("nop");   // 79
-    __asm__ __volatile__ ("nop");   // 80
-    __asm__ __volatile__ ("nop");   // 81
-    __asm__ __volatile__ ("nop");   // 82
-    __asm__ __volatile__ ("nop");   // 83
-    __asm__ __volatile__ ("nop");   // 84
-    __asm__ __volatile__ ("nop");   // 85
-    __asm__ __volatile__ ("nop");   // 86
-    __asm__ __volatile__ ("nop");   // 87
-    __asm__ __volatile__ ("nop");   // 88
-    __asm__ __volatile__ ("nop");   // 89
-    __asm__ __volatile__ ("nop");   // 90
-    __asm__ __volatile__ ("nop");   // 91
-    __asm__ __volatile__ ("nop");   // 92
-    __asm__ __volatile__ ("nop");   // 93
-    __asm__ __volatile__ ("nop");   // 94
+static esp_err_t ws2812bDelColors(rmt_encoder_t *encoder){
+    return ESP_OK;
 }
 
+/*==================[external functions definition]==========================*/
 uint8_t ws2812bGammaCorrection(uint8_t component){
     return gamma_table[component];
 }
 
-/*==================[external functions definition]==========================*/
-
 void ws2812bInit(gpio_t pin){
     pin_number = pin;
-    GPIOFastInit(&pin, 1);
+    if(led_chan != NULL){
+        return;
+    }
+    rmt_tx_channel_config_t chan_config = {
+        .gpio_num = pin,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = RMT_RESOLUTION,
+        .mem_block_symbols = RMT_MEM_SYMBOLS,
+        .trans_queue_depth = RMT_QUEUE_DEPTH,
+    };
+    ESP_ERROR_CHECK(rmt_new_tx_channel(&chan_config, &led_chan));
+    rmt_bytes_encoder_config_t bytes_config = {
+        .bit0 = {.level0 = 1, .duration0 = T0H_TICKS, .level1 = 0, .duration1 = T0L_TICKS},
+        .bit1 = {.level0 = 1, .duration0 = T1H_TICKS, .level1 = 0, .duration1 = T1L_TICKS},
+        .flags.msb_first = 1,
+    };
+    ESP_ERROR_CHECK(rmt_new_bytes_encoder(&bytes_config, &bytes_encoder));
+    rmt_copy_encoder_config_t copy_config = {};
+    ESP_ERROR_CHECK(rmt_new_copy_encoder(&copy_config, &ret_encoder));
+    color_encoder.base.encode = ws2812bEncodeColors;
+    color_encoder.base.reset = ws2812bResetColors;
+    color_encoder.base.del = ws2812bDelColors;
+    color_encoder.bytes_encoder = bytes_encoder;
+    color_encoder.ret_encoder = ret_encoder;
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = ws2812bTxDone,
+    };
+    ESP_ERROR_CHECK(rmt_tx_register_event_callbacks(led_chan, &callbacks, NULL));
+    ESP_ERROR_CHECK(rmt_enable(led_chan));
 }
 
 void ws2812bSend(rgb_led_t led_color){
-    uint8_t i;
-	// Blue
-	for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.green) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
+    if(frame_bytes == 0){
+        // the previous frame may still be transmitted from the buffer
+        ws2812bWait();
     }
-	// Red
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.red) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Green
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.blue) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
+    if(frame_bytes > sizeof(frame_buffer) - 3){
+        return;
     }
+    frame_buffer[frame_bytes++] = ws2812bGammaCorrection(led_color.green);
+    frame_buffer[frame_bytes++] = ws2812bGammaCorrection(led_color.red);
+    frame_buffer[frame_bytes++] = ws2812bGammaCorrection(led_color.blue);
 }
 
 void ws2812bSendRet(void){
-    GPIOFastWrite(0);
-    DelayUs(RET_CMD);
+    if(frame_bytes == 0){
+        return;
+    }
+    ws2812bSendFrame(frame_buffer, frame_bytes / 3);
+    frame_bytes = 0;
+}
+
+void ws2812bSendFrame(const uint8_t *grb, uint16_t leds){
+    if(led_chan == NULL || leds == 0){
+        return;
+    }
+    taskENTER_CRITICAL(&tx_mux);
+    tx_pending += 2;
+    taskEXIT_CRITICAL(&tx_mux);
+    rmt_transmit(led_chan, bytes_encoder, grb, (size_t)leds * 3, &tx_config);
+    rmt_transmit(led_chan, ret_encoder, &ret_symbol, sizeof(ret_symbol), &tx_config);
+}
+
+void ws2812bSendColors(const uint32_t *colors, uint16_t leds, const uint8_t *lut){
+    if(led_chan == NULL || leds == 0){
+        return;
+    }
+    // the encoder is shared by the frames: the previous one must be finished
+    ws2812bWait();
+    color_encoder.colors = (colors == NULL) ? &color_off : colors;
+    color_encoder.stride = (colors == NULL) ? 0 : 1;
+    color_encoder.lut = (lut == NULL) ? gamma_table : lut;
+    color_encoder.leds = leds;
+    taskENTER_CRITICAL(&tx_mux);
+    tx_pending += 1;
+    taskEXIT_CRITICAL(&tx_mux);
+    rmt_transmit(led_chan, &color_encoder.base, color_encoder.colors, sizeof(uint32_t), &tx_config);
+}
+
+bool ws2812bBusy(void){
+    return tx_pending != 0;
+}
+
+void ws2812bSetDoneCallback(void (*func_p)(void *param), void *param_p){
+    done_func_p = func_p;
+    done_param_p = param_p;
+}
+
+void ws2812bWait(void){
+    if(led_chan != NULL){
+        rmt_tx_wait_all_done(led_chan, -1);
+    }
 }
 
 /*==================[end of file]============================================*/
@@ -0,0 +1,158 @@
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Host_Sim Host Simulation
+ ** @{ */
+
+/** \brief Host (x86) build of the projects, driven by recorded captures.
+ *
+ * The project sources (app_main and its tasks) are compiled unchanged against
+ * thin fakes of the drivers they use (timer_mcu, analog_io_mcu, uart_mcu,
+ * gpio_mcu, audio_out_mcu, nvs_mcu, neopixel) and of FreeRTOS (tasks,
+ * notifications, queues, semaphores). The middleware is the same library built
+ * by signal_processing/test_sim.
+ *
+ * Scheduling: tasks are coroutines run one at a time by priority, as FreeRTOS
+ * would with a single core. The time is virtual: the code of a task takes no
+ * time, and the time jumps to the next alarm (timers, ADC frames, DAC samples)
+ * or task wake up when every task is blocked. The same capture always gives
+ * the same output, and an hour of recording runs in seconds: thresholds and
+ * cooldowns can be swept over long captures, and the algorithms profiled with
+ * desktop tools (perf, gprof, valgrind, sanitizers).
+ *
+ * Analog inputs: the samples come from a capture file, one column per channel:
+ * - Text (scope_decoder.py output): "time ch ch ..." per line, the time column
+ *   is ignored; a single column is a capture without time (i.e. proyecto_AD).
+ *   The channel of each column is given with --channels (default 1,0, the
+ *   pads[] table of DrumPads) and the sample frequency with --fs. With --mv the
+ *   values are mV instead of raw 12 bits samples.
+ * - Binary: the capture format of adc_replay_mcu.h (make_replay_capture.py),
+ *   with its channels and sample frequency.
+ *
+ * Single reads return the sample at the virtual time; continuous mode delivers
+ * a block each frame. The simulation ends when a read goes past the end of the
+ * capture (or at --time): the tasks run until they block and a report with the
+ * CPU time of each task is printed on stderr.
+ *
+ * UART_PC output goes to stdout (or --uart file). Each --rx text is received by
+ * UART_PC at start, followed by '\n' (i.e. --rx ":set 0 threshold 350").
+ *
+ * @code
+ * ./sim_drumpads capture.txt --rx ":set 0 threshold 300" --uart hits.bin
+ * @endcode
+ *
+ * The functions below are used by the fakes.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "analog_io_mcu.h"
+/*==================[macros]=================================================*/
+#define HOST_SIM_MAX_ALARMS		16			/*!< Alarms of the fakes (timers, ADC, DAC, UART) */
+#define HOST_SIM_MAX_TASKS		32			/*!< Tasks created */
+#define HOST_SIM_TASK_STACK		(256 * 1024)	/*!< Host stack of each task (bytes, the stack size of xTaskCreate is ignored) */
+#define HOST_SIM_MAX_RX			16			/*!< --rx texts */
+/*==================[typedef]================================================*/
+/**
+ * @brief Virtual alarm (callback called from the scheduler, as from an ISR)
+ */
+typedef struct host_sim_alarm host_sim_alarm_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Virtual time since the start of the simulation
+ *
+ * @return uint64_t Time (in us)
+ */
+uint64_t HostSimTimeUs(void);
+
+/**
+ * @brief Create an alarm (stopped)
+ *
+ * @param func_p Callback called on each alarm
+ * @param param_p Callback parameter
+ * @return host_sim_alarm_t* Alarm, NULL if there are HOST_SIM_MAX_ALARMS
+ */
+host_sim_alarm_t* HostSimAlarmCreate(void (*func_p)(void *param), void *param_p);
+
+/**
+ * @brief Start (or restart) an alarm
+ *
+ * @param alarm Alarm
+ * @param delay Time to the first alarm (in us)
+ * @param period Time between alarms (in us, 0: one shot)
+ */
+void HostSimAlarmStart(host_sim_alarm_t *alarm, uint64_t delay, uint64_t period);
+
+/**
+ * @brief Stop an alarm
+ *
+ * @param alarm Alarm
+ */
+void HostSimAlarmStop(host_sim_alarm_t *alarm);
+
+/**
+ * @brief Read a sample of the capture
+ *
+ * @note Past the end of the capture the simulation stops.
+ *
+ * @param channel ADC channel
+ * @param sample Sample number, counted at sample_frec (a time in us with sample_frec = 1000000)
+ * @param sample_frec Sample frequency of the reader (Hz)
+ * @param raw Raw sample (12 bits, 0 if the channel is not in the capture)
+ * @return true     Sample read
+ * @return false    End of the capture
+ */
+bool HostSimCaptureRead(adc_ch_t channel, uint64_t sample, uint32_t sample_frec, uint16_t *raw);
+
+/**
+ * @brief Output file of a UART
+ *
+ * @param port UART port (uart_mcu_port_t)
+ * @return FILE* stdout or the --uart file
+ */
+FILE* HostSimUartFile(uint8_t port);
+
+/**
+ * @brief Texts received by UART_PC at start (--rx, each one ending in '\n')
+ *
+ * @param n Number of texts
+ * @return const char* const* Texts
+ */
+const char* const* HostSimRxTexts(uint8_t *n);
+
+/**
+ * @brief End the simulation: the tasks run until they block, and the time no longer advances
+ */
+void HostSimStop(void);
+
+/**
+ * @brief Run the scheduler until the simulation ends
+ */
+void HostSimRun(void);
+
+/**
+ * @brief Print the virtual time, the host time and the CPU time of each task
+ *
+ * @param out Output file
+ */
+void HostSimReport(FILE *out);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HOST_SIM_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,13 @@
+// Host simulation replacement of esp_attr.h: code and data placement attributes are ignored
+
+#ifndef _esp_attr_h_
+#define _esp_attr_h_
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define WORD_ALIGNED_ATTR   __attribute__((aligned(4)))
+#define FORCE_INLINE_ATTR   static inline __attribute__((always_inline))
+
+#endif // _esp_attr_h_
@@ -0,0 +1,25 @@
+// Host simulation replacement of esp_mac.h: every node has the same MAC address
+
+#ifndef _esp_mac_h_
+#define _esp_mac_h_
+
+#include <stdint.h>
+#include <string.h>
+#include "esp_err.h"
+
+typedef enum {
+    ESP_MAC_WIFI_STA,
+    ESP_MAC_WIFI_SOFTAP,
+    ESP_MAC_BT,
+    ESP_MAC_ETH,
+    ESP_MAC_IEEE802154,
+    ESP_MAC_BASE,
+} esp_mac_type_t;
+
+static inline esp_err_t esp_read_mac(uint8_t *mac, esp_mac_type_t type){
+    static const uint8_t sim_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+    memcpy(mac, sim_mac, sizeof(sim_mac));
+    return ESP_OK;
+}
+
+#endif // _esp_mac_h_
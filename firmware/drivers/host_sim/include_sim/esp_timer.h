@@ -0,0 +1,10 @@
+// Host simulation replacement of esp_timer.h: the time since boot is the virtual time of host_sim
+
+#ifndef _esp_timer_h_
+#define _esp_timer_h_
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif // _esp_timer_h_
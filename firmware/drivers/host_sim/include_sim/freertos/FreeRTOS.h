@@ -0,0 +1,51 @@
+// Host simulation replacement of FreeRTOS.h: types and macros of the cooperative scheduler of host_sim
+
+#ifndef _freertos_h_
+#define _freertos_h_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t StackType_t;
+
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+
+#define configTICK_RATE_HZ      CONFIG_FREERTOS_HZ
+#define configMAX_PRIORITIES    25
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define pdTICKS_TO_MS(ticks)    ((uint32_t)(((uint64_t)(ticks) * 1000U) / configTICK_RATE_HZ))
+#define tskNO_AFFINITY          0x7FFFFFFF
+#define configASSERT(x)         ((void)(x))
+
+// Tasks never run in parallel and alarms never interrupt a task: critical sections are empty
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux)     ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)      ((void)(mux))
+#define portENTER_CRITICAL_SAFE(mux)    ((void)(mux))
+#define portEXIT_CRITICAL_SAFE(mux)     ((void)(mux))
+#define taskENTER_CRITICAL(mux)         ((void)(mux))
+#define taskEXIT_CRITICAL(mux)          ((void)(mux))
+#define taskENTER_CRITICAL_ISR(mux)     ((void)(mux))
+#define taskEXIT_CRITICAL_ISR(mux)      ((void)(mux))
+#define portYIELD_FROM_ISR(...)         ((void)0)
+
+// Storage of the static objects (the simulator allocates its own)
+typedef struct { uint8_t dummy; } StaticTask_t;
+typedef struct { uint8_t dummy; } StaticQueue_t;
+typedef StaticQueue_t StaticSemaphore_t;
+typedef struct { uint8_t dummy; } StaticStreamBuffer_t;
+
+#endif // _freertos_h_
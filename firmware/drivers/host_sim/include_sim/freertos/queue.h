@@ -0,0 +1,28 @@
+// Host simulation replacement of queue.h (semaphores are queues of items without data, as in FreeRTOS)
+
+#ifndef _queue_h_
+#define _queue_h_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_sim_queue * QueueHandle_t;
+
+QueueHandle_t xQueueGenericCreate(UBaseType_t lenght, UBaseType_t item_size, UBaseType_t initial);
+#define xQueueCreate(lenght, item_size)     xQueueGenericCreate((lenght), (item_size), 0)
+#define xQueueCreateStatic(lenght, item_size, storage, buffer) \
+    ((void)(storage), (void)(buffer), xQueueGenericCreate((lenght), (item_size), 0))
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueGenericSend(QueueHandle_t queue, const void *item, TickType_t ticks, bool overwrite);
+#define xQueueSend(queue, item, ticks)          xQueueGenericSend((queue), (item), (ticks), false)
+#define xQueueSendToBack(queue, item, ticks)    xQueueGenericSend((queue), (item), (ticks), false)
+#define xQueueOverwrite(queue, item)            xQueueGenericSend((queue), (item), 0, true)
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *task_woken);
+#define xQueueSendToBackFromISR(queue, item, task_woken)    xQueueSendFromISR((queue), (item), (task_woken))
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void *item, BaseType_t *task_woken);
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+BaseType_t xQueueReset(QueueHandle_t queue);
+
+#endif // _queue_h_
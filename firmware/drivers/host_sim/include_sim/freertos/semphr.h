@@ -0,0 +1,25 @@
+// Host simulation replacement of semphr.h: semaphores and mutexes over the queues of host_sim
+// (no priority inheritance: a task never runs while another one holds the CPU)
+
+#ifndef _semphr_h_
+#define _semphr_h_
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define xSemaphoreCreateBinary()                    xQueueGenericCreate(1, 0, 0)
+#define xSemaphoreCreateMutex()                     xQueueGenericCreate(1, 0, 1)
+#define xSemaphoreCreateRecursiveMutex()            xQueueGenericCreate(1, 0, 1)
+#define xSemaphoreCreateCounting(max, initial)      xQueueGenericCreate((max), 0, (initial))
+#define xSemaphoreCreateBinaryStatic(buffer)        ((void)(buffer), xSemaphoreCreateBinary())
+#define xSemaphoreCreateMutexStatic(buffer)         ((void)(buffer), xSemaphoreCreateMutex())
+#define xSemaphoreCreateCountingStatic(max, initial, buffer)    ((void)(buffer), xSemaphoreCreateCounting((max), (initial)))
+#define vSemaphoreDelete(sem)                       vQueueDelete(sem)
+#define xSemaphoreTake(sem, ticks)                  xQueueReceive((sem), NULL, (ticks))
+#define xSemaphoreGive(sem)                         xQueueGenericSend((sem), NULL, 0, false)
+#define xSemaphoreTakeFromISR(sem, task_woken)      xQueueReceiveFromISR((sem), NULL, (task_woken))
+#define xSemaphoreGiveFromISR(sem, task_woken)      xQueueSendFromISR((sem), NULL, (task_woken))
+#define uxSemaphoreGetCount(sem)                    uxQueueMessagesWaiting(sem)
+
+#endif // _semphr_h_
@@ -0,0 +1,19 @@
+// Host simulation replacement of stream_buffer.h: byte streams over the queues of host_sim
+
+#ifndef _stream_buffer_h_
+#define _stream_buffer_h_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_sim_queue * StreamBufferHandle_t;
+
+StreamBufferHandle_t xStreamBufferGenericCreate(size_t size, size_t trigger);
+#define xStreamBufferCreate(size, trigger)  xStreamBufferGenericCreate((size), (trigger))
+#define xStreamBufferCreateStatic(size, trigger, storage, buffer) \
+    ((void)(storage), (void)(buffer), xStreamBufferGenericCreate((size), (trigger)))
+size_t xStreamBufferSend(StreamBufferHandle_t stream, const void *data, size_t lenght, TickType_t ticks);
+size_t xStreamBufferReceive(StreamBufferHandle_t stream, void *data, size_t lenght, TickType_t ticks);
+size_t xStreamBufferBytesAvailable(StreamBufferHandle_t stream);
+size_t xStreamBufferSpacesAvailable(StreamBufferHandle_t stream);
+
+#endif // _stream_buffer_h_
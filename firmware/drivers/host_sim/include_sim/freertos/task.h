@@ -0,0 +1,52 @@
+// Host simulation replacement of task.h: tasks are coroutines of the host_sim scheduler, run
+// one at a time in virtual time (the time only advances when every task is blocked)
+
+#ifndef _task_h_
+#define _task_h_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_sim_task * TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
+BaseType_t xTaskCreate(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle);
+TaskHandle_t xTaskCreateStatic(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio,
+                               StackType_t *stack_buffer, StaticTask_t *task_buffer);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio,
+                                   TaskHandle_t *handle, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskDelayUntil(TickType_t *previous, TickType_t increment);
+#define vTaskDelayUntil(previous, increment)    ((void)xTaskDelayUntil(previous, increment))
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char *pcTaskGetName(TaskHandle_t task);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t prio);
+void vTaskSuspend(TaskHandle_t task);
+void vTaskResume(TaskHandle_t task);
+#define taskYIELD()     vTaskDelay(0)
+
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previous);
+BaseType_t xTaskGenericNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previous,
+                                     BaseType_t *task_woken);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *task_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value, TickType_t ticks);
+#define xTaskNotify(task, value, action)    xTaskGenericNotify((task), (value), (action), NULL)
+#define xTaskNotifyGive(task)               xTaskGenericNotify((task), 0, eIncrement, NULL)
+#define xTaskNotifyFromISR(task, value, action, task_woken) \
+    xTaskGenericNotifyFromISR((task), (value), (action), NULL, (task_woken))
+#define xTaskNotifyAndQuery(task, value, action, previous) \
+    xTaskGenericNotify((task), (value), (action), (previous))
+
+#endif // _task_h_
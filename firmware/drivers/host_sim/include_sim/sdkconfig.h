@@ -0,0 +1,10 @@
+// Host simulation replacement of the sdkconfig.h generated by ESP-IDF (no Bluetooth, trace or task monitor)
+
+#ifndef _sdkconfig_h_
+#define _sdkconfig_h_
+
+#define CONFIG_DSP_MAX_FFT_SIZE 4096
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#define CONFIG_FREERTOS_HZ 1000
+
+#endif // _sdkconfig_h_
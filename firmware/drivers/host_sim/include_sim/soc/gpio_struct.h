@@ -0,0 +1,24 @@
+// Host simulation replacement of soc/gpio_struct.h: the GPIO registers are variables of gpio_sim.c
+
+#ifndef _soc_gpio_struct_h_
+#define _soc_gpio_struct_h_
+
+#include <stdint.h>
+
+typedef union {
+    uint32_t val;
+} gpio_sim_reg_t;
+
+typedef struct {
+    gpio_sim_reg_t out;
+    gpio_sim_reg_t out_w1ts;
+    gpio_sim_reg_t out_w1tc;
+    gpio_sim_reg_t enable;
+    gpio_sim_reg_t enable_w1ts;
+    gpio_sim_reg_t enable_w1tc;
+    gpio_sim_reg_t in;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
+
+#endif // _soc_gpio_struct_h_
@@ -0,0 +1,11 @@
+# Runs a simulator on a capture and compares its UART output with the golden file:
+#
+#   cmake -DSIM=sim_drumpads -DCAPTURE=capture.txt -DARGS="--fs;4000" -DGOLDEN=hits.bin -DOUTPUT=out.bin -P run_capture.cmake
+execute_process(COMMAND ${SIM} ${CAPTURE} ${ARGS} --uart ${OUTPUT} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SIM} failed: ${result}")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${OUTPUT} ${GOLDEN} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${OUTPUT} differs from ${GOLDEN}")
+endif()
@@ -0,0 +1,390 @@
+/**
+ * @file analog_io_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief analog_io_mcu with the samples of the capture of host_sim and a DAC that only consumes samples
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "analog_io_mcu.h"
+#include "time_mcu.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+#define ADC_FULL_SCALE_MV	3300	/*!< mV of the last code (ideal conversion, as without calibration) */
+#define ADC_MAX_CODE		4095	/*!< 12 bits */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Continuous mode
+ */
+typedef struct {
+	uint8_t channels;								/*!< Bit mask of the scanned channels */
+	uint32_t sample_frec;							/*!< Sample frequency per channel (Hz) */
+	uint16_t frame_size;							/*!< Samples per channel of each block */
+	uint8_t decimation[ADC_CH_NUM];					/*!< Decimation of each channel */
+	uint8_t filter[ADC_CH_NUM];						/*!< IIR filter coefficient asked for each channel (0: none) */
+	uint8_t filter_on;								/*!< Bit mask of the channels with a filter */
+	float filter_out[ADC_CH_NUM];					/*!< IIR filter output (-1: no sample yet) */
+	void (*func_p)(void *param);					/*!< Frame callback */
+	void *param_p;									/*!< Frame callback parameter */
+	host_sim_alarm_t *alarm;						/*!< Frame alarm */
+	uint64_t frames;								/*!< Frames converted since the start */
+	analog_block_t blocks[ADC_BLOCK_RING_SIZE];		/*!< Blocks ring */
+	uint32_t written;								/*!< Blocks delivered */
+	uint32_t taken;									/*!< Blocks taken */
+	uint32_t released;								/*!< Blocks released */
+	uint64_t frame_time;							/*!< Timestamp of the last block (us) */
+} adc_continuous_t;
+
+/**
+ * @brief Threshold monitor
+ */
+typedef struct {
+	bool used;										/*!< Taken by AnalogInputMonitorInit() */
+	analog_monitor_config_t config;					/*!< Configuration */
+	uint16_t low;									/*!< Low limit (raw) */
+	uint16_t high;									/*!< High limit (raw) */
+	bool armed;										/*!< Watching the samples */
+	bool fired;										/*!< Limits crossed since armed */
+} adc_monitor_t;
+
+/**
+ * @brief Output stream
+ */
+typedef struct {
+	analog_output_stream_config_t config;			/*!< Configuration */
+	host_sim_alarm_t *alarm;						/*!< Sample alarm */
+	uint32_t queued;								/*!< Samples stored */
+	uint32_t underruns;								/*!< Samples with the buffer empty */
+} dac_stream_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static adc_continuous_t adc = {0};
+static adc_monitor_t adc_monitor[ADC_MONITOR_NUM] = {0};
+static uint16_t adc_lut[ADC_CH_NUM][ADC_MAX_CODE + 1];
+static bool adc_lut_ok[ADC_CH_NUM] = {false};
+static dac_stream_t dac_stream = {0};
+static uint8_t dac_value = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Hardware IIR filter of a channel (it starts at the first sample, without the rise from 0)
+ */
+static uint16_t AnalogSimFilter(uint8_t ch, uint16_t raw){
+	if(!(adc.filter_on & (1 << ch))){
+		return raw;
+	}
+	if(adc.filter_out[ch] < 0){
+		adc.filter_out[ch] = raw;
+	}
+	adc.filter_out[ch] += (raw - adc.filter_out[ch]) / adc.filter[ch];
+	return (uint16_t)(adc.filter_out[ch] + 0.5f);
+}
+
+/**
+ * @brief Compare the samples of a new block with the armed monitors (the hardware does it per conversion)
+ */
+static void AnalogSimMonitors(const analog_block_t *block){
+	for(uint8_t m = 0; m < ADC_MONITOR_NUM; m++){
+		adc_monitor_t *mon = &adc_monitor[m];
+		if(!mon->armed){
+			continue;
+		}
+		const uint16_t *data = block->data[mon->config.input];
+		for(uint16_t i = 0; i < block->lenght[mon->config.input]; i++){
+			if(data[i] > mon->high || data[i] < mon->low){
+				mon->armed = false;
+				mon->fired = true;
+				if(mon->config.func_p != NULL){
+					((void (*)(void *))mon->config.func_p)(mon->config.param_p);
+				}
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Frame alarm: fill the next block with the capture (the frame is lost if every block is in use)
+ */
+static void AnalogSimFrame(void *param){
+	uint64_t first = adc.frames * adc.frame_size;
+	adc.frames++;
+	if(adc.written - adc.released >= ADC_BLOCK_RING_SIZE){
+		return;
+	}
+	analog_block_t *block = &adc.blocks[adc.written % ADC_BLOCK_RING_SIZE];
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		block->lenght[ch] = 0;
+		if(!(adc.channels & (1 << ch))){
+			continue;
+		}
+		// samples of the channel rate that fall in the frame
+		uint8_t dec = adc.decimation[ch];
+		uint64_t k = (first + dec - 1) / dec;
+		uint16_t n = 0;
+		for(; k * dec < first + adc.frame_size; k++){
+			if(!HostSimCaptureRead(ch, k, adc.sample_frec / dec, &block->data[ch][n])){
+				// end of the capture: the incomplete frame is not delivered
+				HostSimAlarmStop(adc.alarm);
+				return;
+			}
+			block->data[ch][n] = AnalogSimFilter(ch, block->data[ch][n]);
+			n++;
+		}
+		block->lenght[ch] = n;
+		block->decimation[ch] = dec;
+	}
+	block->channels = adc.channels;
+	block->sample_frec = adc.sample_frec;
+	block->timestamp = TimeNowUs() - (uint64_t)adc.frame_size * TIME_US_PER_S / adc.sample_frec;
+	adc.frame_time = block->timestamp;
+	adc.written++;
+	AnalogSimMonitors(block);
+	if(adc.func_p != NULL){
+		adc.func_p(adc.param_p);
+	}
+}
+
+/**
+ * @brief Sample alarm of the output stream
+ */
+static void AnalogSimStreamSample(void *param){
+	if(dac_stream.queued == 0){
+		dac_stream.underruns++;
+		return;
+	}
+	dac_stream.queued--;
+	if(dac_stream.queued == dac_stream.config.low_level && dac_stream.config.func_p != NULL){
+		((void (*)(void *))dac_stream.config.func_p)(dac_stream.config.param_p);
+	}
+}
+
+/**
+ * @brief Ideal conversion of a raw sample (mV)
+ */
+static uint16_t AnalogSimRawToMv(uint16_t raw){
+	return (uint32_t)raw * ADC_FULL_SCALE_MV / ADC_MAX_CODE;
+}
+
+/*==================[external functions definition]==========================*/
+void AnalogInputInit(analog_input_config_t *config){
+	if(config->mode != ADC_CONTINUOUS){
+		return;
+	}
+	adc.channels |= 1 << config->input;
+	adc.sample_frec = config->sample_frec;
+	// rounded down to a power of two, as the driver
+	adc.decimation[config->input] = 1;
+	while(adc.decimation[config->input] * 2 <= config->decimation && adc.decimation[config->input] < ADC_CONT_MAX_DECIMATION){
+		adc.decimation[config->input] *= 2;
+	}
+	// rounded down to a supported coefficient, as the driver
+	adc.filter[config->input] = 0;
+	for(uint8_t k = 2; k <= 64; k *= 2){
+		if(k <= config->filter && k != 32){
+			adc.filter[config->input] = k;
+		}
+	}
+	adc.frame_size = (config->frame_size == 0) ? ADC_CONT_DEFAULT_FRAME : config->frame_size;
+	if(adc.frame_size > ADC_CONT_MAX_FRAME_SIZE){
+		adc.frame_size = ADC_CONT_MAX_FRAME_SIZE;
+	}
+	adc.func_p = config->func_p;
+	adc.param_p = config->param_p;
+}
+
+void AnalogOutputInit(void){
+}
+
+void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
+	HostSimCaptureRead(channel, TimeNowUs(), TIME_US_PER_S, value);
+}
+
+bool AnalogStartContinuous(adc_ch_t channel){
+	// the filters go to the first channels that ask for one
+	adc.filter_on = 0;
+	for(uint8_t ch = 0, f = 0; ch < ADC_CH_NUM && f < ADC_FILTER_NUM; ch++){
+		if((adc.channels & (1 << ch)) && adc.filter[ch] != 0){
+			adc.filter_on |= 1 << ch;
+			adc.filter_out[ch] = -1;
+			f++;
+		}
+	}
+	if(adc.alarm == NULL){
+		adc.alarm = HostSimAlarmCreate(AnalogSimFrame, NULL);
+	}
+	if(adc.alarm == NULL || adc.sample_frec == 0){
+		return false;
+	}
+	uint64_t period = (uint64_t)adc.frame_size * TIME_US_PER_S / adc.sample_frec;
+	HostSimAlarmStart(adc.alarm, period, period);
+	return true;
+}
+
+void AnalogStopContinuous(adc_ch_t channel){
+	if(adc.alarm != NULL){
+		HostSimAlarmStop(adc.alarm);
+	}
+}
+
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	analog_block_t *block = AnalogInputGetBlock();
+	if(block == NULL){
+		return 0;
+	}
+	uint16_t n = block->lenght[channel];
+	memcpy(values, block->data[channel], n * sizeof(uint16_t));
+	AnalogInputReleaseBlock(block);
+	return n;
+}
+
+uint64_t AnalogInputGetFrameTime(void){
+	return adc.frame_time;
+}
+
+analog_block_t* AnalogInputGetBlock(void){
+	if(adc.taken == adc.written){
+		return NULL;
+	}
+	return &adc.blocks[adc.taken++ % ADC_BLOCK_RING_SIZE];
+}
+
+void AnalogInputReleaseBlock(analog_block_t *block){
+	adc.released++;
+}
+
+bool AnalogInputSkipBlock(void){
+	if(adc.taken == adc.written){
+		return false;
+	}
+	adc.taken++;
+	adc.released++;
+	return true;
+}
+
+int8_t AnalogInputMonitorInit(analog_monitor_config_t *config){
+	for(int8_t m = 0; m < ADC_MONITOR_NUM; m++){
+		if(!adc_monitor[m].used){
+			adc_monitor[m] = (adc_monitor_t){.used = true, .config = *config, .high = ADC_MAX_CODE};
+			return m;
+		}
+	}
+	return -1;
+}
+
+void AnalogInputMonitorArm(uint8_t monitor, uint16_t low, uint16_t high){
+	if(monitor >= ADC_MONITOR_NUM || !adc_monitor[monitor].used){
+		return;
+	}
+	adc_monitor[monitor].low = low;
+	adc_monitor[monitor].high = high;
+	adc_monitor[monitor].fired = false;
+	adc_monitor[monitor].armed = true;
+}
+
+void AnalogInputMonitorDisarm(uint8_t monitor){
+	if(monitor >= ADC_MONITOR_NUM){
+		return;
+	}
+	adc_monitor[monitor].armed = false;
+	adc_monitor[monitor].fired = false;
+}
+
+bool AnalogInputMonitorFired(uint8_t monitor){
+	return (monitor < ADC_MONITOR_NUM) && adc_monitor[monitor].fired;
+}
+
+void AnalogBlockToFloat(const analog_block_t *block, adc_ch_t channel, float *values){
+	for(uint16_t i = 0; i < block->lenght[channel]; i++){
+		values[i] = AnalogRawToMv(channel, block->data[channel][i]);
+	}
+}
+
+void AnalogBlockToMv(const analog_block_t *block, adc_ch_t channel, uint16_t *values){
+	for(uint16_t i = 0; i < block->lenght[channel]; i++){
+		values[i] = AnalogRawToMv(channel, block->data[channel][i]);
+	}
+}
+
+bool AnalogInputLUTInit(adc_ch_t channel){
+	for(uint16_t raw = 0; raw <= ADC_MAX_CODE; raw++){
+		adc_lut[channel][raw] = AnalogSimRawToMv(raw);
+	}
+	adc_lut_ok[channel] = true;
+	return true;
+}
+
+const uint16_t* AnalogInputGetLUT(adc_ch_t channel){
+	return adc_lut_ok[channel] ? adc_lut[channel] : NULL;
+}
+
+uint16_t AnalogRawToMv(adc_ch_t channel, uint16_t raw){
+	raw &= ADC_MAX_CODE;
+	return adc_lut_ok[channel] ? adc_lut[channel][raw] : AnalogSimRawToMv(raw);
+}
+
+void AnalogOutputWrite(uint8_t value){
+	dac_value = value;
+}
+
+bool AnalogOutputStreamInit(analog_output_stream_config_t *config){
+	if(config->sample_rate == 0 || config->sample_rate > TIME_US_PER_S){
+		return false;
+	}
+	if(dac_stream.alarm == NULL){
+		dac_stream.alarm = HostSimAlarmCreate(AnalogSimStreamSample, NULL);
+		if(dac_stream.alarm == NULL){
+			return false;
+		}
+	}
+	dac_stream.config = *config;
+	if(dac_stream.config.low_level == 0){
+		dac_stream.config.low_level = DAC_STREAM_BUFFER_SIZE / 2;
+	}
+	dac_stream.queued = 0;
+	dac_stream.underruns = 0;
+	return true;
+}
+
+void AnalogOutputStreamStart(void){
+	uint64_t period = TIME_US_PER_S / dac_stream.config.sample_rate;
+	HostSimAlarmStart(dac_stream.alarm, period, period);
+}
+
+void AnalogOutputStreamStop(void){
+	HostSimAlarmStop(dac_stream.alarm);
+}
+
+uint32_t AnalogOutputStreamWrite(const uint8_t *values, uint32_t lenght){
+	uint32_t n = DAC_STREAM_BUFFER_SIZE - dac_stream.queued;
+	n = (lenght < n) ? lenght : n;
+	dac_stream.queued += n;
+	if(n > 0){
+		dac_value = values[n - 1];
+	}
+	return n;
+}
+
+uint32_t AnalogOutputStreamWritePCM(const int16_t *values, uint32_t lenght, float gain){
+	uint32_t n = DAC_STREAM_BUFFER_SIZE - dac_stream.queued;
+	n = (lenght < n) ? lenght : n;
+	dac_stream.queued += n;
+	return n;
+}
+
+uint32_t AnalogOutputStreamFree(void){
+	return DAC_STREAM_BUFFER_SIZE - dac_stream.queued;
+}
+
+uint32_t AnalogOutputStreamGetUnderruns(void){
+	return dac_stream.underruns;
+}
+
+/*==================[end of file]============================================*/
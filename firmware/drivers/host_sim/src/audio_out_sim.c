@@ -0,0 +1,89 @@
+/**
+ * @file audio_out_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief audio_out_mcu that consumes a DMA buffer of samples every AUDIO_OUT_DMA_FRAME sample periods
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "audio_out_mcu.h"
+#include "time_mcu.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static audio_out_config_t audio_config;
+static host_sim_alarm_t *audio_alarm = NULL;
+static uint32_t audio_queued = 0;
+static uint32_t audio_underruns = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief End of a DMA buffer
+ */
+static void AudioOutSimFrame(void *param){
+	if(audio_queued < AUDIO_OUT_DMA_FRAME){
+		audio_underruns += AUDIO_OUT_DMA_FRAME - audio_queued;
+		audio_queued = 0;
+	}else{
+		audio_queued -= AUDIO_OUT_DMA_FRAME;
+	}
+	if(audio_queued <= audio_config.low_level && audio_config.func_p != NULL){
+		((void (*)(void *))audio_config.func_p)(audio_config.param_p);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool AudioOutInit(const audio_out_config_t *config){
+	if(config->sample_rate == 0){
+		return false;
+	}
+	if(audio_alarm == NULL){
+		audio_alarm = HostSimAlarmCreate(AudioOutSimFrame, NULL);
+		if(audio_alarm == NULL){
+			return false;
+		}
+	}
+	audio_config = *config;
+	if(audio_config.low_level == 0){
+		audio_config.low_level = AUDIO_OUT_BUFFER_SIZE / 2;
+	}
+	audio_queued = 0;
+	audio_underruns = 0;
+	return true;
+}
+
+void AudioOutStart(void){
+	uint64_t period = (uint64_t)AUDIO_OUT_DMA_FRAME * TIME_US_PER_S / audio_config.sample_rate;
+	HostSimAlarmStart(audio_alarm, period, period);
+}
+
+void AudioOutStop(void){
+	HostSimAlarmStop(audio_alarm);
+}
+
+uint32_t AudioOutWrite(const int16_t *values, uint32_t lenght, float gain){
+	uint32_t n = AUDIO_OUT_BUFFER_SIZE - audio_queued;
+	n = (lenght < n) ? lenght : n;
+	audio_queued += n;
+	return n;
+}
+
+uint32_t AudioOutFree(void){
+	return AUDIO_OUT_BUFFER_SIZE - audio_queued;
+}
+
+uint32_t AudioOutGetUnderruns(void){
+	return audio_underruns;
+}
+
+/*==================[end of file]============================================*/
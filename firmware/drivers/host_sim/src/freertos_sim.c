@@ -0,0 +1,722 @@
+/**
+ * @file freertos_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Cooperative scheduler in virtual time with the FreeRTOS API used by the projects
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/stream_buffer.h"
+#include "esp_timer.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_TICK		(1000000ULL / configTICK_RATE_HZ)	/*!< Virtual time of a tick */
+#define NO_TIMEOUT		UINT64_MAX							/*!< Deadline of portMAX_DELAY */
+
+/**
+ * @brief State of a task
+ */
+typedef enum {
+	TASK_READY,
+	TASK_BLOCKED,
+	TASK_SUSPENDED,
+	TASK_DELETED,
+} task_state_t;
+
+/**
+ * @brief Task (coroutine)
+ */
+struct host_sim_task {
+	ucontext_t context;				/*!< Context saved while the task does not run */
+	void *stack;					/*!< Host stack */
+	TaskFunction_t func;			/*!< Task function */
+	void *param;					/*!< Task function parameter */
+	char name[16];					/*!< Task name */
+	UBaseType_t prio;				/*!< Priority */
+	task_state_t state;				/*!< State */
+	const void *wait_object;		/*!< Object waited while blocked (NULL: delay) */
+	uint64_t wake_time;				/*!< Timeout of the wait (us, NO_TIMEOUT: none) */
+	bool woken;						/*!< Unblocked by an event (not by the timeout) */
+	uint32_t notify_value;			/*!< Notification value */
+	bool notify_pending;			/*!< Notification received and not yet taken */
+	uint64_t cpu_ns;				/*!< Host time spent running (ns) */
+	uint32_t runs;					/*!< Times the task was resumed */
+};
+
+/**
+ * @brief Queue (semaphores: items without data; stream buffers: items of one byte)
+ */
+struct host_sim_queue {
+	uint8_t *storage;				/*!< Items */
+	UBaseType_t lenght;				/*!< Max items */
+	UBaseType_t item_size;			/*!< Bytes of an item */
+	UBaseType_t count;				/*!< Items stored */
+	UBaseType_t head;				/*!< Oldest item */
+	size_t trigger;					/*!< Bytes that unblock a stream buffer receiver */
+};
+
+/**
+ * @brief Alarm
+ */
+struct host_sim_alarm {
+	void (*func_p)(void *param);	/*!< Callback */
+	void *param_p;					/*!< Callback parameter */
+	bool running;					/*!< Armed */
+	uint64_t next;					/*!< Time of the next alarm (us) */
+	uint64_t period;				/*!< Period (us, 0: one shot) */
+};
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static struct host_sim_task *tasks[HOST_SIM_MAX_TASKS];	/*!< Created tasks */
+static uint8_t n_tasks = 0;
+static struct host_sim_task *current = NULL;	/*!< Running task (NULL: scheduler or alarm callback) */
+static ucontext_t scheduler_context;
+static host_sim_alarm_t alarms[HOST_SIM_MAX_ALARMS];
+static uint8_t n_alarms = 0;
+static uint64_t sim_time = 0;					/*!< Virtual time (us) */
+static bool stopping = false;					/*!< The time no longer advances */
+static bool yield_pending = false;				/*!< A task of higher priority than the running one was woken */
+static uint64_t host_ns = 0;					/*!< Host time of HostSimRun (ns) */
+static uint64_t switches = 0;					/*!< Context switches */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Host monotonic time (ns)
+ */
+static uint64_t SimHostNs(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @brief Abort the simulation on a misuse of the API
+ */
+static void SimFatal(const char *msg){
+	fprintf(stderr, "host_sim: %s (task %s)\n", msg, (current != NULL) ? current->name : "-");
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Give the CPU back to the scheduler (the task resumes here)
+ */
+static void SimSwitch(void){
+	swapcontext(&current->context, &scheduler_context);
+}
+
+/**
+ * @brief First function of every task: a task function that returns is deleted
+ */
+static void SimTaskEntry(void){
+	current->func(current->param);
+	current->state = TASK_DELETED;
+	SimSwitch();
+}
+
+/**
+ * @brief Absolute deadline of a wait of some ticks
+ */
+static uint64_t SimDeadline(TickType_t ticks){
+	return (ticks == portMAX_DELAY) ? NO_TIMEOUT : sim_time + ticks * US_PER_TICK;
+}
+
+/**
+ * @brief Block the running task until the object wakes it or the deadline (true if woken)
+ */
+static bool SimBlock(const void *object, uint64_t deadline){
+	struct host_sim_task *task = current;
+	if(deadline <= sim_time){
+		return false;
+	}
+	if(task == NULL){
+		SimFatal("blocking call outside a task");
+	}
+	task->state = TASK_BLOCKED;
+	task->wait_object = object;
+	task->wake_time = deadline;
+	task->woken = false;
+	SimSwitch();
+	return task->woken;
+}
+
+/**
+ * @brief Unblock a task (it runs first if its priority is higher than the running one)
+ */
+static void SimWake(struct host_sim_task *task){
+	task->state = TASK_READY;
+	task->wait_object = NULL;
+	task->woken = true;
+	if(current != NULL && task->prio > current->prio){
+		yield_pending = true;
+	}
+}
+
+/**
+ * @brief Unblock every task waiting on an object (true if some task was woken)
+ */
+static bool SimWakeAll(const void *object){
+	bool woken = false;
+	for(uint8_t i = 0; i < n_tasks; i++){
+		if(tasks[i]->state == TASK_BLOCKED && tasks[i]->wait_object == object){
+			SimWake(tasks[i]);
+			woken = true;
+		}
+	}
+	return woken;
+}
+
+/**
+ * @brief Preemption: after an API call from a task, a woken task of higher priority runs first
+ */
+static void SimPreempt(void){
+	bool yield = yield_pending;
+	yield_pending = false;
+	if(yield && current != NULL){
+		SimSwitch();
+	}
+}
+
+/**
+ * @brief Highest priority ready task (round robin among the same priority)
+ */
+static struct host_sim_task* SimNextTask(void){
+	static uint8_t last = 0;
+	struct host_sim_task *next = NULL;
+	uint8_t next_i = 0;
+	for(uint8_t k = 1; k <= n_tasks; k++){
+		uint8_t i = (last + k) % n_tasks;
+		if(tasks[i]->state == TASK_READY && (next == NULL || tasks[i]->prio > next->prio)){
+			next = tasks[i];
+			next_i = i;
+		}
+	}
+	last = next_i;
+	return next;
+}
+
+/**
+ * @brief Every task is blocked: advance the time to the next alarm or timeout and fire them (false: nothing left)
+ */
+static bool SimAdvance(void){
+	uint64_t next = NO_TIMEOUT;
+	if(stopping){
+		return false;
+	}
+	for(uint8_t i = 0; i < n_alarms; i++){
+		if(alarms[i].running && alarms[i].next < next){
+			next = alarms[i].next;
+		}
+	}
+	for(uint8_t i = 0; i < n_tasks; i++){
+		if(tasks[i]->state == TASK_BLOCKED && tasks[i]->wake_time < next){
+			next = tasks[i]->wake_time;
+		}
+	}
+	if(next == NO_TIMEOUT){
+		return false;
+	}
+	if(next > sim_time){
+		sim_time = next;
+	}
+	// alarms first, as interrupts
+	for(uint8_t i = 0; i < n_alarms; i++){
+		host_sim_alarm_t *alarm = &alarms[i];
+		if(alarm->running && alarm->next <= sim_time){
+			if(alarm->period > 0){
+				alarm->next += alarm->period;
+			}else{
+				alarm->running = false;
+			}
+			alarm->func_p(alarm->param_p);
+		}
+	}
+	for(uint8_t i = 0; i < n_tasks; i++){
+		if(tasks[i]->state == TASK_BLOCKED && tasks[i]->wake_time <= sim_time){
+			tasks[i]->state = TASK_READY;
+			tasks[i]->wait_object = NULL;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Update the notification of a task (true if it was woken)
+ */
+static BaseType_t SimNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previous, bool *woken){
+	BaseType_t ok = pdPASS;
+	if(previous != NULL){
+		*previous = task->notify_value;
+	}
+	switch(action){
+	case eSetBits:
+		task->notify_value |= value;
+		break;
+	case eIncrement:
+		task->notify_value++;
+		break;
+	case eSetValueWithOverwrite:
+		task->notify_value = value;
+		break;
+	case eSetValueWithoutOverwrite:
+		if(task->notify_pending){
+			ok = pdFAIL;
+		}else{
+			task->notify_value = value;
+		}
+		break;
+	default:
+		break;
+	}
+	task->notify_pending = true;
+	*woken = task->state == TASK_BLOCKED && task->wait_object == &task->notify_value;
+	if(*woken){
+		SimWake(task);
+	}
+	return ok;
+}
+
+/**
+ * @brief Store an item (overwrite: the newest one is replaced if full)
+ */
+static bool SimQueuePut(QueueHandle_t queue, const void *item, bool overwrite){
+	UBaseType_t pos;
+	if(queue->count < queue->lenght){
+		pos = (queue->head + queue->count++) % queue->lenght;
+	}else if(overwrite){
+		pos = (queue->head + queue->count - 1) % queue->lenght;
+	}else{
+		return false;
+	}
+	if(queue->item_size > 0 && item != NULL){
+		memcpy(&queue->storage[pos * queue->item_size], item, queue->item_size);
+	}
+	return true;
+}
+
+/**
+ * @brief Take the oldest item (peek: it is not removed)
+ */
+static bool SimQueueGet(QueueHandle_t queue, void *item, bool peek){
+	if(queue->count == 0){
+		return false;
+	}
+	if(queue->item_size > 0 && item != NULL){
+		memcpy(item, &queue->storage[queue->head * queue->item_size], queue->item_size);
+	}
+	if(!peek){
+		queue->head = (queue->head + 1) % queue->lenght;
+		queue->count--;
+	}
+	return true;
+}
+
+/*==================[external functions definition]==========================*/
+int64_t esp_timer_get_time(void){
+	return (int64_t)sim_time;
+}
+
+uint64_t HostSimTimeUs(void){
+	return sim_time;
+}
+
+host_sim_alarm_t* HostSimAlarmCreate(void (*func_p)(void *param), void *param_p){
+	if(n_alarms == HOST_SIM_MAX_ALARMS){
+		return NULL;
+	}
+	host_sim_alarm_t *alarm = &alarms[n_alarms++];
+	alarm->func_p = func_p;
+	alarm->param_p = param_p;
+	alarm->running = false;
+	return alarm;
+}
+
+void HostSimAlarmStart(host_sim_alarm_t *alarm, uint64_t delay, uint64_t period){
+	alarm->next = sim_time + delay;
+	alarm->period = period;
+	alarm->running = true;
+}
+
+void HostSimAlarmStop(host_sim_alarm_t *alarm){
+	alarm->running = false;
+}
+
+void HostSimStop(void){
+	stopping = true;
+}
+
+void HostSimRun(void){
+	uint64_t start = SimHostNs();
+	while(true){
+		struct host_sim_task *task = SimNextTask();
+		if(task == NULL){
+			if(!SimAdvance()){
+				break;
+			}
+			continue;
+		}
+		uint64_t t0 = SimHostNs();
+		current = task;
+		swapcontext(&scheduler_context, &task->context);
+		current = NULL;
+		task->cpu_ns += SimHostNs() - t0;
+		task->runs++;
+		switches++;
+		if(task->state == TASK_DELETED && task->stack != NULL){
+			free(task->stack);
+			task->stack = NULL;
+		}
+	}
+	host_ns = SimHostNs() - start;
+}
+
+void HostSimReport(FILE *out){
+	static const char *states[] = {"ready", "blocked", "suspended", "deleted"};
+	double sim_s = sim_time / 1e6;
+	double host_s = host_ns / 1e9;
+	fprintf(out, "host_sim: %.6f s simulated in %.3f s (%.1fx real time), %llu context switches\n",
+			sim_s, host_s, (host_s > 0) ? sim_s / host_s : 0, (unsigned long long)switches);
+	fprintf(out, "%-16s %-10s %10s %12s %10s\n", "task", "state", "runs", "cpu (ms)", "cpu/time");
+	for(uint8_t i = 0; i < n_tasks; i++){
+		struct host_sim_task *task = tasks[i];
+		fprintf(out, "%-16s %-10s %10u %12.3f %9.3f%%\n", task->name, states[task->state], task->runs,
+				task->cpu_ns / 1e6, (sim_time > 0) ? task->cpu_ns / (sim_time * 10.0) : 0);
+	}
+}
+
+BaseType_t xTaskCreate(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle){
+	if(n_tasks == HOST_SIM_MAX_TASKS){
+		return pdFAIL;
+	}
+	struct host_sim_task *task = calloc(1, sizeof(struct host_sim_task));
+	task->stack = malloc(HOST_SIM_TASK_STACK);
+	getcontext(&task->context);
+	task->context.uc_stack.ss_sp = task->stack;
+	task->context.uc_stack.ss_size = HOST_SIM_TASK_STACK;
+	task->context.uc_link = NULL;
+	makecontext(&task->context, SimTaskEntry, 0);
+	task->func = func;
+	task->param = param;
+	strncpy(task->name, name, sizeof(task->name) - 1);
+	task->prio = (prio < configMAX_PRIORITIES) ? prio : configMAX_PRIORITIES - 1;
+	task->state = TASK_READY;
+	tasks[n_tasks++] = task;
+	if(handle != NULL){
+		*handle = task;
+	}
+	// a new task of higher priority runs at once
+	if(current != NULL && task->prio > current->prio){
+		yield_pending = true;
+		SimPreempt();
+	}
+	return pdPASS;
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio,
+							   StackType_t *stack_buffer, StaticTask_t *task_buffer){
+	TaskHandle_t task = NULL;
+	xTaskCreate(func, name, stack, param, prio, &task);
+	return task;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t func, const char *name, uint32_t stack, void *param, UBaseType_t prio,
+								   TaskHandle_t *handle, BaseType_t core){
+	return xTaskCreate(func, name, stack, param, prio, handle);
+}
+
+void vTaskDelete(TaskHandle_t task){
+	if(task == NULL || task == current){
+		current->state = TASK_DELETED;
+		SimSwitch();
+		return;
+	}
+	task->state = TASK_DELETED;
+	free(task->stack);
+	task->stack = NULL;
+}
+
+void vTaskDelay(TickType_t ticks){
+	if(current == NULL){
+		SimFatal("vTaskDelay outside a task");
+	}
+	if(ticks == 0){
+		// yield: the other ready tasks of the same priority run first
+		SimSwitch();
+		return;
+	}
+	SimBlock(NULL, SimDeadline(ticks));
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *previous, TickType_t increment){
+	uint64_t wake = (uint64_t)(*previous + increment) * US_PER_TICK;
+	*previous += increment;
+	if(wake <= sim_time){
+		return pdFALSE;
+	}
+	SimBlock(NULL, wake);
+	return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount(void){
+	return (TickType_t)(sim_time / US_PER_TICK);
+}
+
+TickType_t xTaskGetTickCountFromISR(void){
+	return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void){
+	return current;
+}
+
+char *pcTaskGetName(TaskHandle_t task){
+	task = (task != NULL) ? task : current;
+	return (task != NULL) ? task->name : "-";
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task){
+	task = (task != NULL) ? task : current;
+	return task->prio;
+}
+
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t prio){
+	task = (task != NULL) ? task : current;
+	task->prio = (prio < configMAX_PRIORITIES) ? prio : configMAX_PRIORITIES - 1;
+	if(current != NULL && task != current && task->state == TASK_READY && task->prio > current->prio){
+		yield_pending = true;
+	}
+	SimPreempt();
+}
+
+void vTaskSuspend(TaskHandle_t task){
+	task = (task != NULL) ? task : current;
+	task->state = TASK_SUSPENDED;
+	if(task == current){
+		SimSwitch();
+	}
+}
+
+void vTaskResume(TaskHandle_t task){
+	if(task->state == TASK_SUSPENDED){
+		SimWake(task);
+		SimPreempt();
+	}
+}
+
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previous){
+	bool woken;
+	BaseType_t ok = SimNotify(task, value, action, previous, &woken);
+	SimPreempt();
+	return ok;
+}
+
+BaseType_t xTaskGenericNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previous,
+									 BaseType_t *task_woken){
+	bool woken;
+	BaseType_t ok = SimNotify(task, value, action, previous, &woken);
+	// from an ISR the woken task runs when the ISR ends, not in the middle of it
+	yield_pending = false;
+	if(task_woken != NULL && woken){
+		*task_woken = pdTRUE;
+	}
+	return ok;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *task_woken){
+	xTaskGenericNotifyFromISR(task, 0, eIncrement, NULL, task_woken);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks){
+	struct host_sim_task *task = current;
+	if(task == NULL){
+		SimFatal("ulTaskNotifyTake outside a task");
+	}
+	if(task->notify_value == 0){
+		SimBlock(&task->notify_value, SimDeadline(ticks));
+	}
+	uint32_t value = task->notify_value;
+	if(value > 0){
+		task->notify_value = clear ? 0 : value - 1;
+	}
+	task->notify_pending = false;
+	return value;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value, TickType_t ticks){
+	struct host_sim_task *task = current;
+	if(task == NULL){
+		SimFatal("xTaskNotifyWait outside a task");
+	}
+	if(!task->notify_pending){
+		task->notify_value &= ~clear_on_entry;
+		SimBlock(&task->notify_value, SimDeadline(ticks));
+	}
+	if(value != NULL){
+		*value = task->notify_value;
+	}
+	if(!task->notify_pending){
+		return pdFALSE;
+	}
+	task->notify_value &= ~clear_on_exit;
+	task->notify_pending = false;
+	return pdTRUE;
+}
+
+QueueHandle_t xQueueGenericCreate(UBaseType_t lenght, UBaseType_t item_size, UBaseType_t initial){
+	if(lenght == 0){
+		return NULL;
+	}
+	QueueHandle_t queue = calloc(1, sizeof(struct host_sim_queue));
+	queue->storage = (item_size > 0) ? malloc(lenght * item_size) : NULL;
+	queue->lenght = lenght;
+	queue->item_size = item_size;
+	queue->count = (initial < lenght) ? initial : lenght;
+	queue->trigger = 1;
+	return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue){
+	free(queue->storage);
+	free(queue);
+}
+
+BaseType_t xQueueGenericSend(QueueHandle_t queue, const void *item, TickType_t ticks, bool overwrite){
+	uint64_t deadline = SimDeadline(ticks);
+	while(!SimQueuePut(queue, item, overwrite)){
+		if(!SimBlock(queue, deadline)){
+			return pdFAIL;
+		}
+	}
+	SimWakeAll(queue);
+	SimPreempt();
+	return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *task_woken){
+	if(!SimQueuePut(queue, item, false)){
+		return pdFAIL;
+	}
+	if(SimWakeAll(queue) && task_woken != NULL){
+		*task_woken = pdTRUE;
+	}
+	yield_pending = false;
+	return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks){
+	uint64_t deadline = SimDeadline(ticks);
+	while(!SimQueueGet(queue, item, false)){
+		if(!SimBlock(queue, deadline)){
+			return pdFAIL;
+		}
+	}
+	SimWakeAll(queue);
+	SimPreempt();
+	return pdPASS;
+}
+
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void *item, BaseType_t *task_woken){
+	if(!SimQueueGet(queue, item, false)){
+		return pdFAIL;
+	}
+	if(SimWakeAll(queue) && task_woken != NULL){
+		*task_woken = pdTRUE;
+	}
+	yield_pending = false;
+	return pdPASS;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks){
+	uint64_t deadline = SimDeadline(ticks);
+	while(!SimQueueGet(queue, item, true)){
+		if(!SimBlock(queue, deadline)){
+			return pdFAIL;
+		}
+	}
+	return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue){
+	return queue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue){
+	return queue->lenght - queue->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue){
+	queue->count = 0;
+	queue->head = 0;
+	SimWakeAll(queue);
+	SimPreempt();
+	return pdPASS;
+}
+
+StreamBufferHandle_t xStreamBufferGenericCreate(size_t size, size_t trigger){
+	StreamBufferHandle_t stream = xQueueGenericCreate(size, 1, 0);
+	if(stream != NULL){
+		stream->trigger = (trigger > 0) ? trigger : 1;
+	}
+	return stream;
+}
+
+size_t xStreamBufferSend(StreamBufferHandle_t stream, const void *data, size_t lenght, TickType_t ticks){
+	uint64_t deadline = SimDeadline(ticks);
+	const uint8_t *bytes = data;
+	size_t n = 0;
+	while(stream->count == stream->lenght){
+		if(!SimBlock(stream, deadline)){
+			return 0;
+		}
+	}
+	while(n < lenght && SimQueuePut(stream, &bytes[n], false)){
+		n++;
+	}
+	SimWakeAll(stream);
+	SimPreempt();
+	return n;
+}
+
+size_t xStreamBufferReceive(StreamBufferHandle_t stream, void *data, size_t lenght, TickType_t ticks){
+	uint64_t deadline = SimDeadline(ticks);
+	uint8_t *bytes = data;
+	size_t n = 0;
+	while(stream->count < stream->trigger && stream->count < lenght){
+		if(!SimBlock(stream, deadline)){
+			break;
+		}
+	}
+	while(n < lenght && SimQueueGet(stream, &bytes[n], false)){
+		n++;
+	}
+	if(n > 0){
+		SimWakeAll(stream);
+		SimPreempt();
+	}
+	return n;
+}
+
+size_t xStreamBufferBytesAvailable(StreamBufferHandle_t stream){
+	return stream->count;
+}
+
+size_t xStreamBufferSpacesAvailable(StreamBufferHandle_t stream){
+	return stream->lenght - stream->count;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,73 @@
+/**
+ * @file gpio_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief gpio_mcu over variables (inputs read high, as with the pull-up; interrupts never fire)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "gpio_mcu.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+gpio_dev_t GPIO = {.in = {.val = 0xFFFFFFFF}};
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void GPIOInit(gpio_t pin, io_t io){
+	if(io == GPIO_OUTPUT){
+		GPIO.enable.val |= GPIO_MASK(pin);
+	}else{
+		GPIO.enable.val &= ~GPIO_MASK(pin);
+	}
+}
+
+void GPIOOn(gpio_t pin){
+	GPIO.out.val |= GPIO_MASK(pin);
+}
+
+void GPIOOff(gpio_t pin){
+	GPIO.out.val &= ~GPIO_MASK(pin);
+}
+
+void GPIOState(gpio_t pin, bool state){
+	if(state){
+		GPIOOn(pin);
+	}else{
+		GPIOOff(pin);
+	}
+}
+
+void GPIOToggle(gpio_t pin){
+	GPIO.out.val ^= GPIO_MASK(pin);
+}
+
+bool GPIORead(gpio_t pin){
+	uint32_t reg = (GPIO.enable.val & GPIO_MASK(pin)) ? GPIO.out.val : GPIO.in.val;
+	return (reg >> pin) & 1;
+}
+
+void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
+}
+
+void GPIOActivIntAnyEdge(gpio_t pin, void *ptr_int_func, void *args){
+}
+
+void GPIOInputFilter(gpio_t pin){
+}
+
+void GPIODeinit(void){
+	GPIO.enable.val = 0;
+}
+
+/*==================[end of file]============================================*/
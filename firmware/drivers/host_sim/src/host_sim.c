@@ -0,0 +1,311 @@
+/**
+ * @file host_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Entry point of the host simulation: options, capture and app_main
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "adc_replay_mcu.h"
+#include "time_mcu.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+#define CAPTURE_DEFAULT_FREC	20000		/*!< Sample frequency of text captures without --fs (Hz) */
+#define CAPTURE_DEFAULT_CHANNELS "1,0"		/*!< Channels of the columns without --channels (pads[] of DrumPads) */
+#define CAPTURE_MAX_LINE		256			/*!< Characters of a line of a text capture */
+#define ADC_FULL_SCALE_MV		3300		/*!< mV of the last code (--mv) */
+#define ADC_MAX_CODE			4095		/*!< 12 bits */
+#define MAIN_TASK_PRIORITY		1			/*!< Priority of app_main, as in ESP-IDF */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Capture
+ */
+typedef struct {
+	uint16_t *data[ADC_CH_NUM];		/*!< Raw samples of each channel */
+	uint32_t lenght;				/*!< Samples per channel */
+	uint32_t size;					/*!< Samples allocated per channel */
+	uint32_t sample_frec;			/*!< Sample frequency (Hz) */
+	uint8_t channels;				/*!< Bit mask of the channels */
+} capture_t;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Entry point of the project
+ */
+extern void app_main(void);
+/*==================[internal data definition]===============================*/
+static capture_t capture = {0};
+static FILE *uart_file = NULL;
+static const char *rx_texts[HOST_SIM_MAX_RX];
+static uint8_t n_rx = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Add a row of samples to the capture
+ */
+static void CaptureAppend(const uint8_t *column_ch, uint8_t n_columns, const uint16_t *row){
+	if(capture.lenght == capture.size){
+		capture.size = (capture.size > 0) ? 2 * capture.size : 65536;
+		for(uint8_t i = 0; i < n_columns; i++){
+			capture.data[column_ch[i]] = realloc(capture.data[column_ch[i]], capture.size * sizeof(uint16_t));
+		}
+	}
+	for(uint8_t i = 0; i < n_columns; i++){
+		capture.data[column_ch[i]][capture.lenght] = row[i];
+	}
+	capture.lenght++;
+}
+
+/**
+ * @brief Load a capture with the format of adc_replay_mcu.h
+ */
+static bool CaptureLoadBinary(FILE *file){
+	adc_replay_header_t header;
+	uint8_t column_ch[ADC_CH_NUM];
+	uint8_t n_columns = 0;
+	uint16_t block[ADC_CH_NUM][ADC_CONT_MAX_FRAME_SIZE];
+	uint16_t row[ADC_CH_NUM];
+	// little endian host: the header is read as is
+	if(fread(&header.magic, 4, 1, file) != 1 || fread(&header.version, 1, 1, file) != 1 ||
+	   fread(&header.channels, 1, 1, file) != 1 || fread(&header.frame_size, 2, 1, file) != 1 ||
+	   fread(&header.sample_frec, 4, 1, file) != 1 || fread(&header.blocks, 4, 1, file) != 1 ||
+	   header.version != ADC_REPLAY_VERSION || header.frame_size == 0 ||
+	   header.frame_size > ADC_CONT_MAX_FRAME_SIZE || header.sample_frec == 0){
+		return false;
+	}
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		if(header.channels & (1 << ch)){
+			column_ch[n_columns++] = ch;
+		}
+	}
+	capture.channels = header.channels;
+	capture.sample_frec = header.sample_frec;
+	while(true){
+		for(uint8_t i = 0; i < n_columns; i++){
+			if(fread(block[i], sizeof(uint16_t), header.frame_size, file) != header.frame_size){
+				return capture.lenght > 0;
+			}
+		}
+		for(uint16_t k = 0; k < header.frame_size; k++){
+			for(uint8_t i = 0; i < n_columns; i++){
+				row[i] = block[i][k];
+			}
+			CaptureAppend(column_ch, n_columns, row);
+		}
+	}
+}
+
+/**
+ * @brief Load a text capture: "time ch ch ..." (or a single column without time) per line
+ */
+static bool CaptureLoadText(FILE *file, const uint8_t *column_ch, uint8_t n_channels, bool mv){
+	char line[CAPTURE_MAX_LINE];
+	int16_t n_columns = -1;
+	while(fgets(line, sizeof(line), file) != NULL){
+		double values[ADC_CH_NUM + 1];
+		uint16_t row[ADC_CH_NUM];
+		uint8_t n = 0;
+		char *p = line;
+		char *end;
+		while(n <= ADC_CH_NUM){
+			while(*p == ' ' || *p == ',' || *p == '\t' || *p == ';'){
+				p++;
+			}
+			values[n] = strtod(p, &end);
+			if(end == p){
+				break;
+			}
+			n++;
+			p = end;
+		}
+		if(n == 0){
+			// empty line or header
+			continue;
+		}
+		if(n_columns < 0){
+			n_columns = n;
+			if((n == 1 ? 1 : n - 1) > n_channels){
+				fprintf(stderr, "host_sim: %d channels in the capture, %d given with --channels\n",
+						(n == 1) ? 1 : n - 1, n_channels);
+				return false;
+			}
+			for(uint8_t i = 0; i < ((n == 1) ? 1 : n - 1); i++){
+				capture.channels |= 1 << column_ch[i];
+			}
+		}
+		if(n != n_columns){
+			continue;
+		}
+		uint8_t first = (n == 1) ? 0 : 1;
+		for(uint8_t i = first; i < n; i++){
+			double raw = mv ? values[i] * ADC_MAX_CODE / ADC_FULL_SCALE_MV : values[i];
+			row[i - first] = (raw < 0) ? 0 : (raw > ADC_MAX_CODE) ? ADC_MAX_CODE : (uint16_t)(raw + 0.5);
+		}
+		CaptureAppend(column_ch, n - first, row);
+	}
+	return capture.lenght > 0;
+}
+
+/**
+ * @brief Load a capture (binary or text)
+ */
+static bool CaptureLoad(const char *path, const char *channels, uint32_t sample_frec, bool mv){
+	uint8_t column_ch[ADC_CH_NUM];
+	uint8_t n_channels = 0;
+	uint32_t magic = 0;
+	bool ok;
+	FILE *file = fopen(path, "rb");
+	if(file == NULL){
+		perror(path);
+		return false;
+	}
+	for(const char *p = channels; *p != '\0' && n_channels < ADC_CH_NUM; p++){
+		if(*p >= '0' && *p < '0' + ADC_CH_NUM){
+			column_ch[n_channels++] = *p - '0';
+		}
+	}
+	if(fread(&magic, sizeof(magic), 1, file) == 1 && magic == ADC_REPLAY_MAGIC){
+		rewind(file);
+		ok = CaptureLoadBinary(file);
+	}else{
+		rewind(file);
+		capture.sample_frec = sample_frec;
+		ok = CaptureLoadText(file, column_ch, n_channels, mv);
+	}
+	fclose(file);
+	if(!ok){
+		fprintf(stderr, "host_sim: %s is not a valid capture\n", path);
+	}
+	return ok;
+}
+
+/**
+ * @brief Task of app_main
+ */
+static void HostSimMainTask(void *param){
+	app_main();
+}
+
+/**
+ * @brief Alarm of --time
+ */
+static void HostSimTimeLimit(void *param){
+	HostSimStop();
+}
+
+/**
+ * @brief Usage
+ */
+static void HostSimUsage(const char *name){
+	fprintf(stderr,
+			"usage: %s capture [options]\n"
+			"  capture             text (time ch ch ... per line, or a single column) or adc_replay capture\n"
+			"  --channels 1,0      ADC channel of each column of a text capture (default %s)\n"
+			"  --fs 20000          sample frequency of a text capture (Hz, default %d)\n"
+			"  --mv                the values of a text capture are mV (default: raw 12 bits)\n"
+			"  --uart file         UART output (default stdout)\n"
+			"  --rx text           text received by UART_PC at start, '\\n' appended (repeatable)\n"
+			"  --time s            end after this virtual time (default: end of the capture)\n",
+			name, CAPTURE_DEFAULT_CHANNELS, CAPTURE_DEFAULT_FREC);
+}
+
+/*==================[external functions definition]==========================*/
+bool HostSimCaptureRead(adc_ch_t channel, uint64_t sample, uint32_t sample_frec, uint16_t *raw){
+	uint64_t index = sample * capture.sample_frec / sample_frec;
+	if(index >= capture.lenght){
+		HostSimStop();
+		return false;
+	}
+	*raw = (capture.channels & (1 << channel)) ? capture.data[channel][index] : 0;
+	return true;
+}
+
+FILE* HostSimUartFile(uint8_t port){
+	return uart_file;
+}
+
+const char* const* HostSimRxTexts(uint8_t *n){
+	*n = n_rx;
+	return rx_texts;
+}
+
+int main(int argc, char *argv[]){
+	static const struct option options[] = {
+		{"channels", required_argument, NULL, 'c'},
+		{"fs", required_argument, NULL, 'f'},
+		{"mv", no_argument, NULL, 'm'},
+		{"uart", required_argument, NULL, 'u'},
+		{"rx", required_argument, NULL, 'r'},
+		{"time", required_argument, NULL, 't'},
+		{"help", no_argument, NULL, 'h'},
+		{NULL, 0, NULL, 0},
+	};
+	const char *channels = CAPTURE_DEFAULT_CHANNELS;
+	uint32_t sample_frec = CAPTURE_DEFAULT_FREC;
+	bool mv = false;
+	double time_limit = 0;
+	int opt;
+	uart_file = stdout;
+	while((opt = getopt_long(argc, argv, "c:f:mu:r:t:h", options, NULL)) != -1){
+		switch(opt){
+		case 'c':
+			channels = optarg;
+			break;
+		case 'f':
+			sample_frec = strtoul(optarg, NULL, 10);
+			break;
+		case 'm':
+			mv = true;
+			break;
+		case 'u':
+			uart_file = fopen(optarg, "wb");
+			if(uart_file == NULL){
+				perror(optarg);
+				return EXIT_FAILURE;
+			}
+			break;
+		case 'r':
+			if(n_rx < HOST_SIM_MAX_RX){
+				char *text = malloc(strlen(optarg) + 2);
+				strcpy(text, optarg);
+				strcat(text, "\n");
+				rx_texts[n_rx++] = text;
+			}
+			break;
+		case 't':
+			time_limit = strtod(optarg, NULL);
+			break;
+		default:
+			HostSimUsage(argv[0]);
+			return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if(optind != argc - 1 || sample_frec == 0){
+		HostSimUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	if(!CaptureLoad(argv[optind], channels, sample_frec, mv)){
+		return EXIT_FAILURE;
+	}
+	fprintf(stderr, "host_sim: %s, %u samples per channel at %u Hz (%.3f s)\n", argv[optind],
+			capture.lenght, capture.sample_frec, (double)capture.lenght / capture.sample_frec);
+	if(time_limit > 0){
+		HostSimAlarmStart(HostSimAlarmCreate(HostSimTimeLimit, NULL), (uint64_t)(time_limit * TIME_US_PER_S), 0);
+	}
+	xTaskCreate(HostSimMainTask, "main", 0, NULL, MAIN_TASK_PRIORITY, NULL);
+	HostSimRun();
+	fflush(uart_file);
+	HostSimReport(stderr);
+	return EXIT_SUCCESS;
+}
+
+/*==================[end of file]============================================*/
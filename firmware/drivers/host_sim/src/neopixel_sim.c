@@ -0,0 +1,114 @@
+/**
+ * @file neopixel_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief neopixel_stripe and neopixel_effects over the back buffer only (nothing is shown, effects are not animated)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "neopixel_stripe.h"
+#include "neopixel_effects.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static neopixel_color_t *pixels = NULL;
+static uint16_t pixels_len = 0;
+static neopixel_effect_t effect = NEOPIXEL_EFFECT_NONE;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
+	pixels = color_array;
+	pixels_len = len;
+	NeoPixelAllOff();
+}
+
+void NeoPixelAllOff(void){
+	NeoPixelAllColor(0);
+}
+
+void NeoPixelAllColor(neopixel_color_t color){
+	for(uint16_t i = 0; i < pixels_len; i++){
+		pixels[i] = color;
+	}
+}
+
+void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
+	if(pixel < pixels_len){
+		pixels[pixel] = color;
+	}
+}
+
+void NeoPixelSetArray(neopixel_color_t *color_array){
+	for(uint16_t i = 0; i < pixels_len; i++){
+		pixels[i] = color_array[i];
+	}
+}
+
+void NeoPixelShow(void){
+}
+
+neopixel_color_t * NeoPixelGetArray(void){
+	return pixels;
+}
+
+uint16_t NeoPixelGetLength(void){
+	return pixels_len;
+}
+
+bool NeoPixelBusy(void){
+	return false;
+}
+
+void NeoPixelWait(void){
+}
+
+void NeoPixelBrightness(uint8_t bright){
+}
+
+neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue){
+	return ((neopixel_color_t)red << 16) | ((neopixel_color_t)green << 8) | blue;
+}
+
+bool NeoPixelEffectsInit(uint16_t frame_rate){
+	return true;
+}
+
+void NeoPixelEffectFade(neopixel_color_t from, neopixel_color_t to, uint16_t duration_ms){
+	NeoPixelAllColor(to);
+	effect = NEOPIXEL_EFFECT_NONE;
+}
+
+void NeoPixelEffectChase(neopixel_color_t color, neopixel_color_t background, uint16_t lenght, uint16_t step_ms, bool upwards){
+	NeoPixelAllColor(background);
+	effect = NEOPIXEL_EFFECT_CHASE;
+}
+
+void NeoPixelEffectFlash(neopixel_color_t color, uint16_t decay_ms){
+	NeoPixelAllColor(color);
+	effect = NEOPIXEL_EFFECT_FLASH;
+}
+
+void NeoPixelEffectRainbow(uint16_t hue_step, uint8_t sat, uint8_t val, uint8_t reps){
+	effect = NEOPIXEL_EFFECT_RAINBOW;
+}
+
+void NeoPixelEffectStop(void){
+	effect = NEOPIXEL_EFFECT_NONE;
+}
+
+neopixel_effect_t NeoPixelEffectActive(void){
+	return effect;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,91 @@
+/**
+ * @file nvs_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief nvs_mcu in memory (empty at every start, as a new chip)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "nvs_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define NVS_SIM_KEYS		16		/*!< Keys stored */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Key
+ */
+typedef struct {
+	char key[NVS_MAX_KEY + 1];		/*!< Name ("": free) */
+	uint8_t *data;					/*!< Value */
+	uint32_t lenght;				/*!< Bytes of the value */
+} nvs_sim_entry_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static nvs_sim_entry_t entries[NVS_SIM_KEYS];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Entry of a key (NULL if not stored)
+ */
+static nvs_sim_entry_t* NvsSimFind(const char *key){
+	for(uint8_t i = 0; i < NVS_SIM_KEYS; i++){
+		if(entries[i].data != NULL && strcmp(entries[i].key, key) == 0){
+			return &entries[i];
+		}
+	}
+	return NULL;
+}
+
+/*==================[external functions definition]==========================*/
+bool NvsInit(void){
+	return true;
+}
+
+bool NvsRead(const char *key, void *data, uint32_t *lenght){
+	nvs_sim_entry_t *entry = NvsSimFind(key);
+	if(entry == NULL || entry->lenght > *lenght){
+		return false;
+	}
+	memcpy(data, entry->data, entry->lenght);
+	*lenght = entry->lenght;
+	return true;
+}
+
+bool NvsWrite(const char *key, const void *data, uint32_t lenght){
+	nvs_sim_entry_t *entry = NvsSimFind(key);
+	if(strlen(key) > NVS_MAX_KEY){
+		return false;
+	}
+	for(uint8_t i = 0; i < NVS_SIM_KEYS && entry == NULL; i++){
+		if(entries[i].data == NULL){
+			entry = &entries[i];
+			strcpy(entry->key, key);
+		}
+	}
+	if(entry == NULL){
+		return false;
+	}
+	free(entry->data);
+	entry->data = malloc(lenght ? lenght : 1);
+	memcpy(entry->data, data, lenght);
+	entry->lenght = lenght;
+	return true;
+}
+
+bool NvsErase(const char *key){
+	nvs_sim_entry_t *entry = NvsSimFind(key);
+	if(entry != NULL){
+		free(entry->data);
+		entry->data = NULL;
+	}
+	return true;
+}
+
+/*==================[end of file]============================================*/
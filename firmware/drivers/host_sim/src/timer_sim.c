@@ -0,0 +1,217 @@
+/**
+ * @file timer_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief timer_mcu over the virtual alarms of host_sim (alarms are never late: no latency or jitter)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "timer_mcu.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+/**
+ * @brief Timer of the table
+ */
+struct timer_data {
+	bool used;								/*!< Taken by TimerInit or TimerCreate */
+	timer_handle_config_t config;			/*!< Configuration */
+	host_sim_alarm_t *alarm;				/*!< Virtual alarm */
+	TaskHandle_t notify;					/*!< Task notified on each alarm */
+	bool running;							/*!< Started */
+	uint64_t start_time;					/*!< Time of the last start or alarm (us) */
+	uint64_t alarm_time;					/*!< Time of the last alarm (us) */
+	uint32_t alarms;						/*!< Alarms since the stats were enabled */
+	bool etm;								/*!< GPIO action on each alarm */
+	gpio_t etm_pin;							/*!< GPIO of the action */
+	timer_etm_action_t etm_action;			/*!< Action */
+};
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static struct timer_data timers[TIMER_MAX_QTY];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Alarm of a timer
+ */
+static void TimerSimAlarm(void *param){
+	struct timer_data *timer = param;
+	timer->alarm_time = HostSimTimeUs();
+	timer->start_time = timer->alarm_time;
+	timer->alarms++;
+	timer->running = timer->config.mode == TIMER_PERIODIC;
+	if(timer->etm){
+		switch(timer->etm_action){
+		case TIMER_ETM_GPIO_SET:
+			GPIOOn(timer->etm_pin);
+			break;
+		case TIMER_ETM_GPIO_CLEAR:
+			GPIOOff(timer->etm_pin);
+			break;
+		default:
+			GPIOToggle(timer->etm_pin);
+			break;
+		}
+	}
+	if(timer->config.yield_func_p != NULL){
+		timer->config.yield_func_p(timer->config.param_p);
+	}else if(timer->config.func_p != NULL){
+		timer->config.func_p(timer->config.param_p);
+	}
+	if(timer->notify != NULL){
+		vTaskNotifyGiveFromISR(timer->notify, NULL);
+	}
+}
+
+/**
+ * @brief Take an entry of the table
+ */
+static timer_handle_t TimerSimSetup(struct timer_data *timer, const timer_handle_config_t *config){
+	if(timer->alarm == NULL){
+		timer->alarm = HostSimAlarmCreate(TimerSimAlarm, timer);
+		if(timer->alarm == NULL){
+			return NULL;
+		}
+	}
+	HostSimAlarmStop(timer->alarm);
+	timer->used = true;
+	timer->config = *config;
+	timer->notify = NULL;
+	timer->etm = false;
+	return timer;
+}
+
+/*==================[external functions definition]==========================*/
+void TimerInit(timer_config_t *timer_ini){
+	timer_handle_config_t config = {
+		.period = timer_ini->period,
+		.mode = TIMER_PERIODIC,
+		.func_p = timer_ini->func_p,
+		.param_p = timer_ini->param_p,
+		.yield_func_p = timer_ini->yield_func_p,
+	};
+	TimerSimSetup(&timers[timer_ini->timer], &config);
+}
+
+void TimerNotifyTask(timer_mcu_t timer, TaskHandle_t task){
+	TimerHandleNotifyTask(&timers[timer], task);
+}
+
+void TimerStart(timer_mcu_t timer){
+	TimerHandleStart(&timers[timer]);
+}
+
+uint32_t TimerRead(timer_mcu_t timer){
+	return TimerHandleRead(&timers[timer]);
+}
+
+uint64_t TimerGetAlarmTime(timer_mcu_t timer){
+	return TimerHandleGetAlarmTime(&timers[timer]);
+}
+
+void TimerStatsEnable(timer_mcu_t timer, bool enable){
+	TimerHandleStatsEnable(&timers[timer], enable);
+}
+
+void TimerGetStats(timer_mcu_t timer, timer_stats_t *stats){
+	TimerHandleGetStats(&timers[timer], stats);
+}
+
+void TimerStop(timer_mcu_t timer){
+	TimerHandleStop(&timers[timer]);
+}
+
+void TimerReset(timer_mcu_t timer){
+	TimerHandleReset(&timers[timer]);
+}
+
+void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
+	TimerHandleUpdatePeriod(&timers[timer], period);
+}
+
+bool TimerEtmGpio(timer_mcu_t timer, gpio_t pin, timer_etm_action_t action){
+	return TimerHandleEtmGpio(&timers[timer], pin, action);
+}
+
+timer_handle_t TimerGetHandle(timer_mcu_t timer){
+	return timers[timer].used ? &timers[timer] : NULL;
+}
+
+timer_handle_t TimerCreate(const timer_handle_config_t *config){
+	// the entries of TimerInit are taken from the start, the created ones from the end
+	for(int8_t i = TIMER_MAX_QTY - 1; i >= 0; i--){
+		if(!timers[i].used){
+			return TimerSimSetup(&timers[i], config);
+		}
+	}
+	return NULL;
+}
+
+void TimerDelete(timer_handle_t timer){
+	TimerHandleStop(timer);
+	timer->used = false;
+}
+
+void TimerHandleStart(timer_handle_t timer){
+	uint64_t period = timer->config.period;
+	timer->start_time = HostSimTimeUs();
+	timer->running = true;
+	HostSimAlarmStart(timer->alarm, period, (timer->config.mode == TIMER_PERIODIC) ? period : 0);
+}
+
+void TimerHandleStop(timer_handle_t timer){
+	timer->running = false;
+	HostSimAlarmStop(timer->alarm);
+}
+
+void TimerHandleReset(timer_handle_t timer){
+	TimerHandleStart(timer);
+}
+
+uint32_t TimerHandleRead(timer_handle_t timer){
+	return (uint32_t)(HostSimTimeUs() - timer->start_time);
+}
+
+uint64_t TimerHandleGetAlarmTime(timer_handle_t timer){
+	return timer->alarm_time;
+}
+
+void TimerHandleUpdatePeriod(timer_handle_t timer, uint32_t period){
+	timer->config.period = period;
+	if(timer->running){
+		// from the last alarm, as the reload of the hardware counter
+		uint64_t elapsed = HostSimTimeUs() - timer->start_time;
+		uint64_t mode_period = (timer->config.mode == TIMER_PERIODIC) ? period : 0;
+		HostSimAlarmStart(timer->alarm, (elapsed < period) ? period - elapsed : 0, mode_period);
+	}
+}
+
+void TimerHandleNotifyTask(timer_handle_t timer, TaskHandle_t task){
+	timer->notify = task;
+}
+
+void TimerHandleStatsEnable(timer_handle_t timer, bool enable){
+	timer->alarms = 0;
+}
+
+void TimerHandleGetStats(timer_handle_t timer, timer_stats_t *stats){
+	memset(stats, 0, sizeof(timer_stats_t));
+	stats->alarms = timer->alarms;
+}
+
+bool TimerHandleEtmGpio(timer_handle_t timer, gpio_t pin, timer_etm_action_t action){
+	timer->etm = true;
+	timer->etm_pin = pin;
+	timer->etm_action = action;
+	return true;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,145 @@
+/**
+ * @file uart_sim.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief uart_mcu to host files: transmissions are written at once, the --rx texts are received at start
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "uart_mcu.h"
+#include "host_sim.h"
+/*==================[macros and definitions]=================================*/
+#define UART_PORTS			3		/*!< UART_PC, UART_CONNECTOR and UART_USB */
+#define UART_RX_SIZE		256		/*!< Bytes received and not yet read (legacy interrupt callback) */
+#define UART_RX_TASK_PRIO	(configMAX_PRIORITIES - 2)	/*!< Priority of the receiving task, as the event task of the driver */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Port
+ */
+typedef struct {
+	serial_config_t config;			/*!< Configuration */
+	uint8_t rx[UART_RX_SIZE];		/*!< Received bytes for UartReadByte */
+	uint16_t rx_head;				/*!< Next byte to read */
+	uint16_t rx_count;				/*!< Bytes to read */
+} uart_sim_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uart_sim_t uarts[UART_PORTS];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Deliver received bytes to the callbacks of a port (frames without the pattern if there is one)
+ */
+static void UartSimReceive(uart_sim_t *uart, const char *text){
+	uint16_t lenght = strlen(text);
+	if(uart->config.rx_func_p != NULL){
+		char frame[UART_RX_SIZE];
+		uint16_t n = 0;
+		for(uint16_t i = 0; i < lenght; i++){
+			if(uart->config.rx_pattern != UART_NO_PATTERN && (uint8_t)text[i] == uart->config.rx_pattern){
+				frame[n] = '\0';
+				uart->config.rx_func_p((uint8_t *)frame, n, uart->config.param_p);
+				n = 0;
+			}else if(n < UART_RX_SIZE - 1){
+				frame[n++] = text[i];
+			}
+		}
+		if(uart->config.rx_pattern == UART_NO_PATTERN && n > 0){
+			frame[n] = '\0';
+			uart->config.rx_func_p((uint8_t *)frame, n, uart->config.param_p);
+		}
+	}
+	if(uart->config.func_p != UART_NO_INT){
+		for(uint16_t i = 0; i < lenght && uart->rx_count < UART_RX_SIZE; i++){
+			uart->rx[(uart->rx_head + uart->rx_count++) % UART_RX_SIZE] = text[i];
+		}
+		((void (*)(void *))uart->config.func_p)(uart->config.param_p);
+	}
+}
+
+/**
+ * @brief Receiving task of UART_PC: the --rx texts, once
+ */
+static void UartSimRxTask(void *param){
+	uint8_t n;
+	const char* const* texts = HostSimRxTexts(&n);
+	for(uint8_t i = 0; i < n; i++){
+		UartSimReceive(param, texts[i]);
+	}
+	vTaskDelete(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+void UartInit(serial_config_t *port_config){
+	uart_sim_t *uart = &uarts[port_config->port];
+	uint8_t n;
+	uart->config = *port_config;
+	HostSimRxTexts(&n);
+	if(port_config->port == UART_PC && n > 0 && (port_config->rx_func_p != NULL || port_config->func_p != UART_NO_INT)){
+		xTaskCreate(UartSimRxTask, "UartSimRx", 0, uart, UART_RX_TASK_PRIO, NULL);
+	}
+}
+
+uint8_t UartReadByte(uart_mcu_port_t port, uint8_t *data){
+	uart_sim_t *uart = &uarts[port];
+	if(uart->rx_count == 0){
+		return false;
+	}
+	*data = uart->rx[uart->rx_head];
+	uart->rx_head = (uart->rx_head + 1) % UART_RX_SIZE;
+	uart->rx_count--;
+	return true;
+}
+
+uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes){
+	uint16_t n = 0;
+	while(n < nbytes && UartReadByte(port, &data[n])){
+		n++;
+	}
+	return n == nbytes;
+}
+
+void UartSendByte(uart_mcu_port_t port, const char *data){
+	UartWrite(port, data, 1);
+}
+
+void UartSendString(uart_mcu_port_t port, const char *msg){
+	UartWrite(port, msg, strlen(msg));
+}
+
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
+	UartWrite(port, data, nbytes);
+}
+
+uint32_t UartWrite(uart_mcu_port_t port, const void *data, uint32_t nbytes){
+	return fwrite(data, 1, nbytes, HostSimUartFile(port));
+}
+
+bool UartWriteAsync(uart_mcu_port_t port, const void *data, uint32_t nbytes, TaskHandle_t notify){
+	UartWrite(port, data, nbytes);
+	if(notify != NULL){
+		xTaskNotifyGive(notify);
+	}
+	return true;
+}
+
+uint8_t* UartItoa(uint32_t val, uint8_t base){
+	static uint8_t buf[32] = {0};
+	uint32_t i = 30;
+	if(val == 0){
+		return (uint8_t*)"0";
+	}
+	for(; val && i ; --i, val /= base){
+		buf[i] = "0123456789abcdef"[val % base];
+	}
+	return &buf[i+1];
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,247 @@
+#ifndef ADC_REPLAY_MCU_H
+#define ADC_REPLAY_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup ADC_Replay ADC Replay
+ ** @{ */
+
+/** \brief Replay of recorded ADC captures through the block interface of the continuous ADC.
+ *
+ * A capture recorded in the field (i.e. the scope mode of a project, converted
+ * with make_replay_capture.py) is read from a data partition or streamed over a
+ * serial link (AdcReplayFeed()), and delivered as blocks with the layout of the
+ * continuous ADC (analog_block_t). The code that processes the live blocks
+ * (AnalogInputGetBlock()) processes the replayed ones unchanged, with the same
+ * samples every time: detection problems can be reproduced without the drummer.
+ *
+ * Capture format (little endian):
+ *
+ * | Bytes      | Content                                                |
+ * |:----------:|:-------------------------------------------------------|
+ * | 4          | ADC_REPLAY_MAGIC                                       |
+ * | 1          | ADC_REPLAY_VERSION                                     |
+ * | 1          | Bit mask of the channels (as analog_block_t.channels)  |
+ * | 2          | Samples per channel of each block                      |
+ * | 4          | Sample frequency per channel (Hz)                      |
+ * | 4          | Number of blocks (0 if unknown, only streamed)         |
+ * | ...        | Blocks: raw samples (uint16) of the lowest channel,    |
+ * |            | then the next one, ...                                 |
+ *
+ * Pacing:
+ * - ADC_REPLAY_REAL_TIME: a timer delivers a block every frame period, as the
+ *   ADC would. If every block is still in use the alarm is lost (counted as an
+ *   overrun) and the capture waits, so no sample is skipped.
+ * - ADC_REPLAY_MAX_SPEED: a block is delivered as soon as one is released, so
+ *   the consumer sets the pace and AdcReplayGetStats() gives its throughput in
+ *   samples per second.
+ *
+ * The timestamp of each block is the start time plus the time of its first
+ * sample in the capture.
+ *
+ * @code
+ * static adc_replay_t replay;
+ * adc_replay_config_t config = {
+ *     .partition = "capture", .pace = ADC_REPLAY_MAX_SPEED, .func_p = BlockCallback
+ * };
+ * AdcReplayInit(&replay, &config);
+ * AdcReplayStart(&replay);
+ * ...
+ * analog_block_t *block = AdcReplayGetBlock(&replay);
+ * if(block != NULL){
+ *     AnalogBlockToFloat(block, CH1, pad_mv);
+ *     AdcReplayReleaseBlock(&replay, block);
+ * }
+ * @endcode
+ *
+ * @note Streamed captures start with the header; the stream ends when no byte
+ * arrives for ADC_REPLAY_STREAM_TIMEOUT_MS.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/stream_buffer.h"
+#include "esp_partition.h"
+#include "analog_io_mcu.h"
+#include "timer_mcu.h"
+/*==================[macros]=================================================*/
+#define ADC_REPLAY_MAGIC				0x52434441	/*!< "ADCR" */
+#define ADC_REPLAY_VERSION				1			/*!< Capture format */
+#define ADC_REPLAY_BLOCK_RING_SIZE		4			/*!< Blocks of each replay */
+#define ADC_REPLAY_STREAM_SIZE			4096		/*!< Bytes stored of a streamed capture */
+#define ADC_REPLAY_STREAM_TIMEOUT_MS	1000		/*!< Time without bytes that ends a streamed capture */
+#define ADC_REPLAY_TASK_STACK			2048		/*!< Stack of the replay task */
+#define ADC_REPLAY_TASK_PRIORITY		(configMAX_PRIORITIES - 2)	/*!< Priority of the replay task */
+/*==================[typedef]================================================*/
+/**
+ * @brief Pace of the replay
+ */
+typedef enum {
+	ADC_REPLAY_REAL_TIME,		/*!< A block every frame period, as the ADC */
+	ADC_REPLAY_MAX_SPEED,		/*!< A block as soon as one is released */
+} adc_replay_pace_t;
+
+/**
+ * @brief ADC replay config structure
+ */
+typedef struct {
+	const char *partition;		/*!< Label of the data partition with the capture (NULL: streamed with AdcReplayFeed()) */
+	adc_replay_pace_t pace;		/*!< Pace of the replay */
+	bool loop;					/*!< Start the capture again at its end (only from a partition) */
+	void *func_p;				/*!< Pointer to callback function called (from the replay task) on every block (can be NULL) */
+	void *param_p;				/*!< Pointer to callback function parameters */
+} adc_replay_config_t;
+
+/**
+ * @brief Header of a capture
+ */
+typedef struct {
+	uint32_t magic;				/*!< ADC_REPLAY_MAGIC */
+	uint8_t version;			/*!< ADC_REPLAY_VERSION */
+	uint8_t channels;			/*!< Bit mask of the channels */
+	uint16_t frame_size;		/*!< Samples per channel of each block, max ADC_CONT_MAX_FRAME_SIZE */
+	uint32_t sample_frec;		/*!< Sample frequency per channel (Hz) */
+	uint32_t blocks;			/*!< Blocks of the capture (0: unknown) */
+} adc_replay_header_t;
+
+/**
+ * @brief Throughput of a replay
+ */
+typedef struct {
+	uint32_t blocks;			/*!< Blocks delivered */
+	uint64_t samples;			/*!< Samples released (all channels) */
+	uint64_t elapsed_us;		/*!< Time from AdcReplayStart() to the last block released (or now) */
+	float samples_per_s;		/*!< Samples (all channels) released per second */
+	uint32_t overruns;			/*!< Alarms lost in real time (every block in use) */
+	bool done;					/*!< End of the capture reached */
+} adc_replay_stats_t;
+
+/**
+ * @brief ADC replay instance (driver data, don't modify)
+ */
+typedef struct {
+	adc_replay_config_t config;							/*!< Configuration */
+	adc_replay_header_t header;							/*!< Header of the capture */
+	bool header_ok;										/*!< Header read and valid */
+	uint8_t n_channels;									/*!< Channels of the capture */
+	const uint8_t *capture;								/*!< Capture mapped from the partition (NULL: streamed) */
+	esp_partition_mmap_handle_t mmap_handle;			/*!< Mapping of the partition */
+	uint32_t pos;										/*!< Next block of the capture */
+	StreamBufferHandle_t stream;						/*!< Bytes of a streamed capture */
+	StaticStreamBuffer_t stream_buffer;					/*!< Stream buffer data */
+	uint8_t stream_storage[ADC_REPLAY_STREAM_SIZE + 1];	/*!< Stream buffer storage */
+	analog_block_t blocks[ADC_REPLAY_BLOCK_RING_SIZE];	/*!< Blocks ring */
+	volatile uint32_t written;							/*!< Blocks delivered */
+	volatile uint32_t taken;							/*!< Blocks taken with AdcReplayGetBlock */
+	volatile uint32_t released;							/*!< Blocks released */
+	volatile bool running;								/*!< Replaying (cleared by AdcReplayStop) */
+	volatile bool done;									/*!< End of the capture */
+	uint32_t overruns;									/*!< Alarms lost */
+	uint64_t start_time;								/*!< Time of AdcReplayStart (us) */
+	uint64_t release_time;								/*!< Time of the last release (us) */
+	timer_handle_t timer;								/*!< Pace timer (real time) */
+	TaskHandle_t task;									/*!< Replay task */
+} adc_replay_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief ADC replay initialization (stopped)
+ *
+ * @note From a partition the header is checked here; a streamed header is read when the replay starts.
+ *
+ * @param replay ADC replay instance (must remain valid, i.e. static)
+ * @param config ADC replay config structure
+ * @return true     Replay initialized
+ * @return false    Partition not found, invalid capture, no free timer or task not created
+ */
+bool AdcReplayInit(adc_replay_t *replay, const adc_replay_config_t *config);
+
+/**
+ * @brief Start (or resume) delivering blocks
+ *
+ * @param replay ADC replay instance
+ */
+void AdcReplayStart(adc_replay_t *replay);
+
+/**
+ * @brief Stop delivering blocks (the capture resumes from the next block)
+ *
+ * @param replay ADC replay instance
+ */
+void AdcReplayStop(adc_replay_t *replay);
+
+/**
+ * @brief Go back to the start of a capture from a partition (the statistics are cleared)
+ *
+ * @note Only with the replay stopped and every block released.
+ *
+ * @param replay ADC replay instance
+ */
+void AdcReplayRewind(adc_replay_t *replay);
+
+/**
+ * @brief Give bytes of a streamed capture (i.e. from the receiving callback of a UART)
+ *
+ * @note Blocks while the stream is full: the sender must not go faster than the replay.
+ *
+ * @param replay ADC replay instance
+ * @param data Bytes of the capture
+ * @param lenght Number of bytes
+ */
+void AdcReplayFeed(adc_replay_t *replay, const uint8_t *data, uint32_t lenght);
+
+/**
+ * @brief Get the next block of samples
+ *
+ * @note Non blocking. Blocks must be released with AdcReplayReleaseBlock() in the
+ * same order they were obtained.
+ *
+ * @param replay ADC replay instance
+ * @return Pointer to the block, or NULL if there is no block delivered
+ */
+analog_block_t* AdcReplayGetBlock(adc_replay_t *replay);
+
+/**
+ * @brief Give back a block obtained with AdcReplayGetBlock()
+ *
+ * @param replay ADC replay instance
+ * @param block Block to release
+ */
+void AdcReplayReleaseBlock(adc_replay_t *replay, analog_block_t *block);
+
+/**
+ * @brief Header of the capture
+ *
+ * @param replay ADC replay instance
+ * @return Header, or NULL if it was not read yet (streamed) or is invalid
+ */
+const adc_replay_header_t* AdcReplayGetHeader(const adc_replay_t *replay);
+
+/**
+ * @brief Throughput of the replay
+ *
+ * @param replay ADC replay instance
+ * @param stats Statistics
+ */
+void AdcReplayGetStats(const adc_replay_t *replay, adc_replay_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ADC_REPLAY_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -21,11 +21,23 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 14/10/2026 | Continuous mode with multi-channel scanning     						|
+ * | 14/10/2026 | Block-based acquisition API                     						|
+ * | 14/10/2026 | Calibrated raw to mV lookup tables              						|
+ * | 14/10/2026 | Oversampling and decimation in continuous mode  						|
+ * | 14/10/2026 | Frame and block timestamps                      						|
+ * | 14/10/2026 | Timer driven audio output stream                						|
+ * | 14/10/2026 | 16 bits PCM stream writes with noise shaping    						|
+ * | 15/10/2026 | Per channel decimation in continuous mode (shared scan slots)			|
+ * | 15/10/2026 | Threshold monitors in continuous mode           						|
+ * | 15/10/2026 | Hardware IIR filters in continuous mode         						|
+ * | 15/10/2026 | Continuous start fails on conversion rates out of range				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +52,15 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_CH_NUM				4		/*!< Number of analog inputs */
+#define ADC_BLOCK_RING_SIZE		4		/*!< Number of preallocated blocks for the block API */
+#define ADC_CONT_MAX_FRAME_SIZE	256		/*!< Max samples per channel in a continuous mode frame */
+#define ADC_CONT_DEFAULT_FRAME	64		/*!< Samples per channel used when frame_size = 0 */
+#define ADC_CONT_MAX_DECIMATION	8		/*!< Max decimation of a slow channel in continuous mode */
+#define ADC_MONITOR_NUM			2		/*!< Threshold monitors of the ADC digital controller */
+#define ADC_FILTER_NUM			2		/*!< IIR filters of the ADC digital controller */
+#define DAC_STREAM_BUFFER_SIZE	1024	/*!< Samples stored by the audio output stream (power of two) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -48,17 +69,80 @@ typedef enum adc_mode {
 typedef struct {			
 	adc_ch_t input;			/*!< Inputs: CH0, CH1, CH2, CH3 */
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
-	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) on every DMA frame (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint32_t sample_frec;	/*!< Sample frequency per channel (in Hz) (only for continuous mode)  */
+	uint16_t frame_size;	/*!< Samples per channel in each DMA frame, max ADC_CONT_MAX_FRAME_SIZE (only for continuous mode) */
+	uint8_t oversampling;	/*!< Oversampling ratio: 0 or 1 (disabled), 2, 4, 8 or 16 (only for continuous mode) */
+	uint8_t decimation;		/*!< Decimation of this channel: 0 or 1 (sample_frec), 2, 4 or 8 (sample_frec / decimation) (only for continuous mode) */
+	uint8_t filter;			/*!< Hardware IIR filter coefficient of this channel: 0 (disabled), 2, 4, 8, 16 or 64 (only for continuous mode) */
 } analog_input_config_t;	
 
+/**
+ * @brief Block of samples from one DMA frame, de-interleaved per channel
+ * 
+ */
+typedef struct {
+	uint16_t data[ADC_CH_NUM][ADC_CONT_MAX_FRAME_SIZE];	/*!< Raw samples (12 bits) of each channel */
+	uint16_t lenght[ADC_CH_NUM];						/*!< Number of valid samples of each channel */
+	uint8_t channels;									/*!< Bit mask of the channels present in the block */
+	uint32_t sample_frec;								/*!< Sample frequency of the full rate channels (in Hz) */
+	uint8_t decimation[ADC_CH_NUM];						/*!< Decimation of each channel (its sample frequency is sample_frec / decimation) */
+	uint64_t timestamp;									/*!< Acquisition time of the first sample of the full rate channels (in us since boot) */
+} analog_block_t;
+
+/**
+ * @brief Threshold monitor config structure (continuous mode)
+ * 
+ */
+typedef struct {
+	adc_ch_t input;			/*!< Channel watched by the monitor: CH0, CH1, CH2, CH3 */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) when the monitor fires (can be NULL) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_monitor_config_t;
+
+/**
+ * @brief Analog output stream config structure
+ * 
+ */
+typedef struct {
+	uint32_t sample_rate;	/*!< Output sample rate (in Hz) */
+	uint32_t low_level;		/*!< Stored samples that fire the refill callback (0: DAC_STREAM_BUFFER_SIZE / 2) */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) when the stored samples fall to low_level (can be NULL) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_output_stream_config_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Analog input initialization
  * 
+ * @note With oversampling the ADC converts at sample_frec * oversampling and a 2nd order
+ * CIC decimator delivers sample_frec samples per second with lower noise. 
+ * frame_size is limited to ADC_CONT_MAX_FRAME_SIZE / oversampling.
+ * 
+ * @note In continuous mode every initialized channel is added to the scan list of
+ * the ADC unit. All scanned channels share the same sample frequency, frame size
+ * and callback (the ones given in the last call are used).
+ * 
+ * @note Slow channels (i.e. a pressure or a pedal sensor next to a piezo) can be given a
+ * decimation, set per channel. They share the scan slots that follow the full rate
+ * channels, so the ADC converts fewer samples: a piezo and two pedals with decimation 2
+ * take 2 conversions per sample period instead of 3. The slots left free are used to
+ * convert the slow channels more often, and their decimator averages the extra samples.
+ * Slow channels deliver frame_size / decimation samples per frame (one more or one less
+ * when the decimation does not divide frame_size).
+ * 
+ * @note A channel can be given a filter coefficient k: the ADC digital controller
+ * smooths its samples before the DMA, out = out + (in - out) / k, with no CPU cost.
+ * The time constant is about k conversions of the channel (k / (sample_frec *
+ * oversampling) for full rate channels). There are ADC_FILTER_NUM filters, taken by
+ * the first channels (CH0 first) that ask for one; the threshold monitors see the
+ * filtered samples. Other coefficients are rounded down to the supported ones.
+ * 
+ * @note Single and continuous modes can not be used at the same time.
+ * 
  * @param config Analog inputs config structure
  * @return null
  */
@@ -83,9 +167,18 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * All channels initialized in continuous mode are scanned, not only the selected one.
+ * 
+ * @note The ADC converts at sample_frec * oversampling * scan slots (one slot per full
+ * rate channel, plus the shared slots of the decimated ones). A rate out of the range
+ * of the ADC (SOC_ADC_SAMPLE_FREQ_THRES_LOW to SOC_ADC_SAMPLE_FREQ_THRES_HIGH) is not
+ * clamped: the conversion is not started, lower sample_frec, oversampling or channels.
+ * 
  * @param channel Channel selected
+ * @return true		Conversion running
+ * @return false	Channel not initialized in continuous mode or conversion rate out of range
  */
-void AnalogStartContinuous(adc_ch_t channel);
+bool AnalogStartContinuous(adc_ch_t channel);
 
 /**
  * @brief Stop convertion for ADC module
@@ -95,12 +188,159 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the samples of one channel from the oldest converted DMA frame
+ * 
+ * @note Non blocking. Intended to be called after the conversion callback is fired.
+ * The other channels samples of the frame are discarded.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (of lenght = frame_size)
+ * @return Number of samples stored in values (0 if no frame was available)
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Return the conversion end time of the last sample read in continuous mode
+ * 
+ * @note The time is captured in the conversion ISR, when the last sample of a frame is ready,
+ * and taken back to the last sample read with the number of bytes converted since.
+ * 
+ * @return Time in us since boot
+ */
+uint64_t AnalogInputGetFrameTime(void);
+
+/**
+ * @brief Get the next block of samples converted in continuous mode
+ * 
+ * Reads the oldest DMA frame and de-interleaves it into one of the preallocated
+ * blocks of the ring, so a task can process all the samples of a frame per wakeup.
+ * 
+ * @note Non blocking. Blocks must be released with AnalogInputReleaseBlock() in the
+ * same order they were obtained.
+ * 
+ * @return Pointer to the block, or NULL if there is no frame available or all
+ * blocks are in use
+ */
+analog_block_t* AnalogInputGetBlock(void);
+
+/**
+ * @brief Give back a block obtained with AnalogInputGetBlock()
+ * 
+ * @param block Block to release
+ */
+void AnalogInputReleaseBlock(analog_block_t *block);
+
+/**
+ * @brief Discard the oldest converted DMA frame without de-interleaving it
+ * 
+ * For the frames that are not worth looking at (i.e. while no threshold monitor
+ * fired): the frame is only taken out of the driver, so the next ones keep being
+ * stored. The samples of the frame do not go through the decimators.
+ * 
+ * @note Non blocking.
+ * 
+ * @return true     A frame was discarded
+ * @return false    No frame available
+ */
+bool AnalogInputSkipBlock(void);
+
+/**
+ * @brief Threshold monitor initialization (continuous mode)
+ * 
+ * The ADC digital controller compares every converted sample of the channel with
+ * the limits of the monitor and raises an interrupt when one is crossed, with no
+ * CPU involved in between. A monitor fires once per AnalogInputMonitorArm(): its
+ * interrupt is disabled on the first crossing, so a hit does not raise one
+ * interrupt per sample over the limits.
+ * 
+ * @note The channel must be initialized in continuous mode. The limits are compared
+ * with the raw samples of the scan (before oversampling and decimation).
+ * 
+ * @param config Threshold monitor config structure
+ * @return Monitor number (0 to ADC_MONITOR_NUM - 1), or -1 if all monitors are in use
+ */
+int8_t AnalogInputMonitorInit(analog_monitor_config_t *config);
+
+/**
+ * @brief Set the limits of a monitor and enable it
+ * 
+ * @param monitor Monitor number
+ * @param low Raw value (12 bits) under which the monitor fires (0: never)
+ * @param high Raw value (12 bits) over which the monitor fires (4095: never)
+ */
+void AnalogInputMonitorArm(uint8_t monitor, uint16_t low, uint16_t high);
+
+/**
+ * @brief Disable a monitor
+ * 
+ * @param monitor Monitor number
+ */
+void AnalogInputMonitorDisarm(uint8_t monitor);
+
+/**
+ * @brief Return if a monitor fired since it was armed
+ * 
+ * @param monitor Monitor number
+ * @return true     A sample crossed the limits (the monitor is disabled)
+ * @return false    No crossing, or the monitor is not armed
+ */
+bool AnalogInputMonitorFired(uint8_t monitor);
+
+/**
+ * @brief Convert the samples of one channel of a block to float values (in mV)
+ * 
+ * @param block Block of samples
+ * @param channel Channel selected
+ * @param values Array to store converted values (of lenght = block->lenght[channel])
+ */
+void AnalogBlockToFloat(const analog_block_t *block, adc_ch_t channel, float *values);
+
+/**
+ * @brief Convert the samples of one channel of a block to calibrated mV
+ * 
+ * @note The channel lookup table must be built first with AnalogInputLUTInit(),
+ * without it the values are not calibrated (raw * 3300 / 4095)
+ * 
+ * @param block Block of samples
+ * @param channel Channel selected
+ * @param values Array to store converted values (of lenght = block->lenght[channel])
+ */
+void AnalogBlockToMv(const analog_block_t *block, adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Build the raw to mV lookup table of a channel
+ * 
+ * The table has one entry for each raw value (4096 entries) and is filled with the
+ * curve fitting calibration scheme of the channel, so the conversion in the hot path
+ * is a single indexed load. Once built it is also used by AnalogBlockToFloat().
+ * 
+ * @note Call it after AnalogInputInit(). It takes 8kB of heap per channel.
+ * 
+ * @param channel Channel selected
+ * @return true     Lookup table available
+ * @return false    Not possible to create the calibration scheme or the table
+ */
+bool AnalogInputLUTInit(adc_ch_t channel);
+
+/**
+ * @brief Return the raw to mV lookup table of a channel
+ * 
+ * @param channel Channel selected
+ * @return Pointer to the table (indexed by raw value), or NULL if not built
+ */
+const uint16_t* AnalogInputGetLUT(adc_ch_t channel);
+
+/**
+ * @brief Convert a raw value to calibrated mV using the channel lookup table
+ * 
+ * @note The channel lookup table must be built first with AnalogInputLUTInit(),
+ * without it the value is not calibrated (raw * 3300 / 4095)
+ * 
+ * @param channel Channel selected
+ * @param raw Raw value (12 bits)
+ * @return Calibrated value in mV
+ */
+uint16_t AnalogRawToMv(adc_ch_t channel, uint16_t raw);
 
 /**
  * @brief Digital-to-Analog convert.
@@ -109,6 +349,77 @@ void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
  */
 void AnalogOutputWrite(uint8_t value);
 
+/**
+ * @brief Analog output stream initialization (DAC clocked by a hardware timer)
+ * 
+ * A dedicated timer fires at the sample rate and its ISR takes one sample from a
+ * ring buffer of DAC_STREAM_BUFFER_SIZE samples and writes it to the DAC, so the
+ * output timing does not depend on task scheduling. Tasks fill the buffer with
+ * AnalogOutputStreamWrite().
+ * 
+ * @note If the buffer gets empty the last sample is held (and an underrun is counted).
+ * 
+ * @note The DAC is initialized if AnalogOutputInit() was not called before. The stream
+ * takes one of the general purpose timers, so one less is available for timer_mcu.
+ * 
+ * @param config Analog output stream config structure
+ * @return true     Stream initialized (stopped)
+ * @return false    Invalid sample rate or timer not available
+ */
+bool AnalogOutputStreamInit(analog_output_stream_config_t *config);
+
+/**
+ * @brief Start the analog output stream
+ */
+void AnalogOutputStreamStart(void);
+
+/**
+ * @brief Stop the analog output stream, discarding stored samples and leaving the DAC at mid scale
+ */
+void AnalogOutputStreamStop(void);
+
+/**
+ * @brief Store samples to be played by the analog output stream
+ * 
+ * @note Non blocking: only the samples that fit in the buffer are stored.
+ * 
+ * @param values Samples to play (from 0 to 255, as in AnalogOutputWrite())
+ * @param lenght Number of samples
+ * @return Number of samples stored
+ */
+uint32_t AnalogOutputStreamWrite(const uint8_t *values, uint32_t lenght);
+
+/**
+ * @brief Store 16 bits PCM samples to be played by the analog output stream
+ * 
+ * The gain is applied and the samples are mapped to the DAC pulse density (-128 to
+ * 127) once per block. The quantization error of each sample is added to the next
+ * one (1st order noise shaping), so the lower 8 bits are not lost but moved to
+ * high frequencies, filtered out by the DAC output.
+ * 
+ * @note Non blocking: only the samples that fit in the buffer are converted and stored.
+ * 
+ * @param values Signed PCM samples (full scale: -32768 to 32767)
+ * @param lenght Number of samples
+ * @param gain Gain applied to the samples (1.0 maps full scale PCM to full scale DAC)
+ * @return Number of samples stored
+ */
+uint32_t AnalogOutputStreamWritePCM(const int16_t *values, uint32_t lenght, float gain);
+
+/**
+ * @brief Number of samples that can be stored in the analog output stream buffer
+ * 
+ * @return Free space (in samples)
+ */
+uint32_t AnalogOutputStreamFree(void);
+
+/**
+ * @brief Number of samples periods in which the analog output stream buffer was empty
+ * 
+ * @return Underruns since AnalogOutputStreamInit()
+ */
+uint32_t AnalogOutputStreamGetUnderruns(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
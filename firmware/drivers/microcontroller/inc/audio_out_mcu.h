@@ -0,0 +1,135 @@
+#ifndef AUDIO_OUT_MCU_H
+#define AUDIO_OUT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Audio_Out Audio output
+ ** @{ */
+
+/** \brief 16 bits audio output by I2S (external DAC) or PDM, with DMA.
+ *
+ * An alternative to the analog output stream (analog_io_mcu.h), that plays
+ * 8 bits samples through the sigma-delta modulator and needs a timer
+ * interrupt per sample. Here blocks of 16 bits samples (i.e. from the
+ * audio mixer) are copied to the DMA buffers of the I2S peripheral, that
+ * sends them with no CPU intervention:
+ *
+ * - AUDIO_OUT_I2S: standard (Philips) I2S, mono, to an external DAC or
+ *   amplifier (i.e. PCM5102, MAX98357A) on bclk, ws and dout.
+ * - AUDIO_OUT_PDM: 1 bit PDM on dout (clock on bclk), to a PDM amplifier or
+ *   a passive low pass filter.
+ *
+ * The API follows the analog output stream: AudioOutWrite queues samples
+ * without waiting, AudioOutFree gives the space left and the callback is
+ * called (from the DMA ISR) when the queued samples fall to low_level, so a
+ * task can mix the next blocks.
+ *
+ * @code
+ * audio_out_config_t audio = {
+ *     .mode = AUDIO_OUT_I2S, .sample_rate = 8000,
+ *     .bclk = GPIO_20, .ws = GPIO_21, .dout = GPIO_22,
+ *     .low_level = 64, .func_p = AudioRefill
+ * };
+ * AudioOutInit(&audio);
+ * AudioMixerProcess(&mixer, mix, 64);
+ * AudioOutWrite(mix, 64, 1.0);
+ * AudioOutStart();
+ * @endcode
+ *
+ * @note The queue holds AUDIO_OUT_BUFFER_SIZE samples: AUDIO_OUT_DMA_BUFFERS DMA
+ * buffers of AUDIO_OUT_DMA_FRAME samples. If it empties, silence is sent and
+ * the underrun is counted.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+#define AUDIO_OUT_DMA_FRAME		64		/*!< Samples of each DMA buffer */
+#define AUDIO_OUT_DMA_BUFFERS	8		/*!< DMA buffers */
+#define AUDIO_OUT_BUFFER_SIZE	(AUDIO_OUT_DMA_FRAME * AUDIO_OUT_DMA_BUFFERS)	/*!< Samples queued by the output */
+/*==================[typedef]================================================*/
+/**
+ * @brief Output format
+ */
+typedef enum {
+	AUDIO_OUT_I2S = 0,		/*!< Standard I2S (bclk, ws, dout) */
+	AUDIO_OUT_PDM,			/*!< PDM (clock on bclk, data on dout) */
+} audio_out_mode_t;
+
+/**
+ * @brief Audio output config structure
+ */
+typedef struct {
+	audio_out_mode_t mode;	/*!< Output format */
+	uint32_t sample_rate;	/*!< Output sample rate (in Hz) */
+	gpio_t bclk;			/*!< Bit clock (PDM: clock) */
+	gpio_t ws;				/*!< Word select (not used by PDM) */
+	gpio_t dout;			/*!< Data */
+	uint32_t low_level;		/*!< Queued samples that fire the refill callback (0: AUDIO_OUT_BUFFER_SIZE / 2) */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) when the queued samples fall to low_level (can be NULL) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} audio_out_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Audio output initialization (stopped)
+ *
+ * @param config Audio output config structure
+ * @return true     Output initialized
+ * @return false    Invalid configuration or I2S peripheral not available
+ */
+bool AudioOutInit(const audio_out_config_t *config);
+
+/**
+ * @brief Start sending samples (the ones queued before start are sent first)
+ */
+void AudioOutStart(void);
+
+/**
+ * @brief Stop sending samples (the queued ones are discarded)
+ */
+void AudioOutStop(void);
+
+/**
+ * @brief Queue samples to be played, without waiting
+ *
+ * @param values 16 bits PCM samples
+ * @param lenght Number of samples
+ * @param gain Gain applied to the samples (1.0: unchanged, the result is saturated)
+ * @return Number of samples queued (less than lenght if there was no space)
+ */
+uint32_t AudioOutWrite(const int16_t *values, uint32_t lenght, float gain);
+
+/**
+ * @brief Samples that can be queued now
+ *
+ * @return Free space (in samples)
+ */
+uint32_t AudioOutFree(void);
+
+/**
+ * @brief DMA buffers sent with no samples queued (silence)
+ *
+ * @return Underruns since AudioOutInit()
+ */
+uint32_t AudioOutGetUnderruns(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* AUDIO_OUT_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -13,6 +13,13 @@
  * so it can be used to communicate with common Android apps, like "Bluetooth Electronics"
  * (https://play.google.com/store/apps/details?id=com.keuwl.arduinobluetooth)
  * 
+ * @note Mouse reports carry 16 bits X and Y deltas. BleHidMoveMouse accumulates the
+ * motion (i.e. from an IMU sampled at 100 Hz or more) and sends one report per
+ * connection interval, so fast motion neither saturates the deltas nor floods the
+ * stack. BleHidHighRate requests a 7.5 ms connection interval for smooth tracking.
+ * Hosts paired with a previous firmware cache the old report map: remove the pairing
+ * and pair again.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -20,6 +27,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Mouse motion accumulator, 16 bits deltas and high rate mode			|
  * 
  **/
 
@@ -209,6 +217,28 @@ void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cm
  */
 void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y);
 
+/**
+ * @brief Accumulate mouse motion, to be sent in the next connection interval
+ * 
+ * @note Doesn't block: it can be called at the sensor rate, deltas are added until the
+ * next report. Use it or BleHidSendMouse, not both.
+ * 
+ * @param mouse_button      Button pressed (state held until the next call)
+ * @param delta_x           X cursor relative position
+ * @param delta_y           Y cursor relative position
+ */
+void BleHidMoveMouse(mouse_cmd_t mouse_button, int16_t delta_x, int16_t delta_y);
+
+/**
+ * @brief Request a short connection interval (7.5 ms) for high rate mouse reports
+ * 
+ * @note The central may reject it or choose another value, the accumulated motion is
+ * sent with the interval finally used.
+ * 
+ * @param enable            true: 7.5 ms interval, false: 30 to 50 ms interval
+ */
+void BleHidHighRate(bool enable);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -12,6 +12,83 @@
  * @note This driver emulates HM-10 functionalities (same services and characteristics),
  * so it can be used to communicate with common Android apps, like "Bluetooth Electronics"
  * (https://play.google.com/store/apps/details?id=com.keuwl.arduinobluetooth)
+ *
+ * @note With service = BLE_SERVICE_MIDI the device exposes the BLE-MIDI service instead,
+ * so it can be used as a MIDI controller by a DAW. BleSendBuffer must then send
+ * BLE-MIDI packets (see midi.h), that are notified without delays between them.
+ *
+ * @note The device accepts an ATT MTU of up to BLE_MTU_MAX and asks for the data length
+ * extension on every connection, so each notification carries up to BLE_MTU_MAX - 3
+ * bytes in one link layer packet. The MTU exchange is started by the client (most
+ * phones and PCs do it when they connect); until then messages are split in
+ * notifications of 20 bytes. BleMaxPayload returns the current size, to batch
+ * short messages in one send.
+ *
+ * @note Sent data is copied once into a TX ring of BLE_TX_RING_SIZE bytes and a driver
+ * task notifies it. Messages written while the previous notifications are in flight
+ * are joined in MTU sized notifications (BLE-MIDI packets are notified one by one).
+ * At most BLE_TX_CREDITS notifications are handed to the stack at a time and none
+ * while it reports congestion, so the stack buffers are never overrun. BleSendBuffer
+ * waits for space in the ring; BleWrite never waits, it returns false and counts the
+ * bytes as dropped (see BleTxStats), so the caller can skip or resend them.
+ *
+ * @note A profile (ble_profile_t) sets the advertising interval and, after every
+ * connection, asks the central for a connection interval and the LE 2M PHY. The
+ * central has the last word: the values it accepts are logged.
+ *
+ * @note With streams in the configuration the device also exposes a sensor service
+ * (UUID E5D50000-8B2F-4C3A-9D1E-6A7B8C9D0E1F) with one notify characteristic per
+ * stream (UUID E5D5xxxx-..., xxxx = 0001 + stream index, named with a user
+ * description), alongside the SPP or MIDI service. Each notification of a stream
+ * is one binary frame defined by the application (i.e. packed int16 samples). A
+ * client subscribes only to the streams it needs, and BleStreamSubscribed lets the
+ * application skip the computing and packing of the others.
+ *
+ * @note Data written by the client is copied to a block of a memory pool (see
+ * mem_pool_mcu.h) and only a reference to it is queued to the read task, that
+ * returns the block after calling the read function. BleRxStats shows how many
+ * blocks were needed and how many writes were lost because the pool was empty.
+ *
+ * @note With a command table in the configuration, the read task parses the
+ * commands of each write in place, in the pool block, and calls the handler of
+ * each opcode with a pointer to its arguments (no copies, no switch in the
+ * application). The opcode is looked up in a 256 entries index built by BleInit.
+ * Commands are either binary frames (opcode, length, length bytes of arguments;
+ * several per write) or text lines (opcode character and arguments up to '\n',
+ * '\r', ';' or the end of the write, terminated in place with '\0' so they can be
+ * parsed with sscanf or atoi):
+ *
+ * @code
+ * static void SetRate(uint8_t *args, uint8_t length, void *param){
+ *     rate = atoi((char *)args);              // "F250\n"
+ * }
+ * static const ble_cmd_t commands[] = {
+ *     {'F', 1, SetRate, NULL},
+ *     {'A', 0, FilterOn, NULL},
+ * };
+ * ble_config_t ble_configuration = {"ESP_EDU", ReadData, BLE_SERVICE_SPP, BLE_PROFILE_DEFAULT,
+ *     .commands = commands, .command_num = 2, .command_format = BLE_CMD_TEXT};
+ * @endcode
+ *
+ * Writes (binary) or lines (text) that don't start with a registered opcode, or
+ * whose arguments are shorter than min_length, are given to the read function.
+ *
+ * @note BleBroadcastInit starts a connectionless broadcast mode instead of BleInit
+ * (no GATT services): the latest readings set with BleBroadcastSet are packed in
+ * the payload of a non connectable extended advertising set (BLE 5), sent every
+ * interval_ms. A gateway scanning continuously collects them from dozens of nodes,
+ * without connections and their scheduling. The readings go in a manufacturer
+ * specific data structure (company ID BLE_BROADCAST_COMPANY_ID):
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 2          | Company ID (little endian)                             |
+ * | 1          | Sequence number (incremented on every payload change)  |
+ * | 1 + 1 + n  | Each reading: id, n, n bytes of data                   |
+ *
+ * followed by the complete local name. The payload of the controller is only
+ * rewritten once per interval, and only if a reading changed. Needs
+ * CONFIG_BT_BLE_50_FEATURES_SUPPORTED.
  * 
  * @author Albano Peñalva
  *
@@ -20,14 +97,30 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | BLE-MIDI service		                         						|
+ * | 14/10/2026 | MTU exchange and data length extension          						|
+ * | 14/10/2026 | Non-blocking TX ring with flow control          						|
+ * | 14/10/2026 | Connection parameters profiles and 2M PHY       						|
+ * | 14/10/2026 | Binary sensor service with a characteristic per stream				|
+ * | 15/10/2026 | Received data in a memory pool (queued by reference)					|
+ * | 15/10/2026 | Broadcast mode with extended advertising								|
+ * | 15/10/2026 | Command dispatch table (parsed in place)								|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "mem_pool_mcu.h"
 /*==================[macros]=================================================*/
 #define BLE_NO_INT	0		/*!< Flag used when no reading interruption is required */
+#define BLE_MTU_DEFAULT	23	/*!< ATT MTU before the exchange (20 bytes per notification) */
+#define BLE_MTU_MAX		247	/*!< Max ATT MTU accepted (244 bytes per notification) */
+#define BLE_TX_RING_SIZE	2048	/*!< Bytes of the TX ring (power of two, 4 bytes of each message are its header) */
+#define BLE_STREAM_MAX		4		/*!< Max streams of the sensor service */
+#define BLE_BROADCAST_MAX_DATA		191		/*!< Max bytes of the readings of a broadcast payload (with their id and length) */
+#define BLE_BROADCAST_MAX_READINGS	8		/*!< Max readings of a broadcast payload */
+#define BLE_BROADCAST_COMPANY_ID	0xFFFF	/*!< Company ID of the manufacturer data (reserved for tests and internal use) */
 /*==================[typedef]================================================*/
 /**
  * @brief Prototype of callback function for reading received data 
@@ -37,14 +130,85 @@
  */
 typedef void (*read_func) (uint8_t * data, uint8_t length);
 
+/**
+ * @brief Handler of a received command
+ * 
+ * @param args      pointer to the arguments, in the received block (valid until the handler returns)
+ * @param length    number of bytes of the arguments (without the '\0' of text commands)
+ * @param param     parameter of the command
+ */
+typedef void (*ble_cmd_handler_t) (uint8_t * args, uint8_t length, void * param);
+
+/**
+ * @brief Entry of the command table
+ */
+typedef struct {
+	uint8_t opcode;					/*!< First byte of the command */
+	uint8_t min_length;				/*!< Min bytes of arguments (shorter commands go to func_p) */
+	ble_cmd_handler_t handler_p;	/*!< Handler of the command */
+	void * param;					/*!< Parameter of the handler */
+} ble_cmd_t;
+
+/**
+ * @brief Framing of the commands
+ */
+typedef enum ble_cmd_format {
+	BLE_CMD_BINARY,			/*!< Opcode, length and length bytes of arguments (default) */
+	BLE_CMD_TEXT			/*!< Opcode character and arguments up to '\n', '\r', ';' or the end of the write */
+} ble_cmd_format_t;
+
+/**
+ * @brief BLE services
+ */
+typedef enum ble_service {
+	BLE_SERVICE_SPP,		/*!< HM-10 serial port service (default) */
+	BLE_SERVICE_MIDI		/*!< BLE-MIDI service (MIDI over Bluetooth LE specification) */
+} ble_service_t;
+
+/**
+ * @brief Connection parameters profiles
+ */
+typedef enum ble_profile {
+	BLE_PROFILE_DEFAULT,		/*!< Parameters chosen by the central (default) */
+	BLE_PROFILE_THROUGHPUT,		/*!< 7.5 to 15 ms interval and 2M PHY (streaming) */
+	BLE_PROFILE_LOW_LATENCY,	/*!< 7.5 ms interval and 2M PHY (i.e. MIDI, HID) */
+	BLE_PROFILE_LOW_POWER		/*!< 100 to 200 ms interval, slave latency 4, slow advertising */
+} ble_profile_t;
+
 /**
  * @brief BLE configuration struct
  */
 typedef struct {			
 	char * device_name;		/*!< BLE device name */
 	read_func func_p;		/*!< Pointer to callback function to call when receiving data (= BLE_NO_INT if not requiered) */
+	ble_service_t service;	/*!< Service exposed by the device */
+	ble_profile_t profile;	/*!< Connection parameters profile */
+	const char * const * streams;	/*!< Names of the streams of the sensor service (NULL: no sensor service) */
+	uint8_t stream_num;		/*!< Number of streams (up to BLE_STREAM_MAX) */
+	const ble_cmd_t * commands;		/*!< Command table (NULL: every write goes to func_p) */
+	uint8_t command_num;	/*!< Number of commands */
+	ble_cmd_format_t command_format;	/*!< Framing of the commands */
 } ble_config_t;
 
+/**
+ * @brief Broadcast mode configuration struct
+ */
+typedef struct {
+	char * device_name;		/*!< BLE device name (in the payload, after the readings) */
+	uint32_t interval_ms;	/*!< Advertising interval (20 ms to 10 s; 0: 1 s) */
+	int8_t tx_power;		/*!< Transmission power (dBm, -24 to 20; the controller uses the closest one) */
+	bool long_range;		/*!< LE Coded PHY (4 times the range, 8 times the air time) instead of 1M */
+} ble_broadcast_config_t;
+
+/**
+ * @brief TX path counters
+ */
+typedef struct {
+	uint32_t queued;		/*!< Bytes waiting in the TX ring */
+	uint32_t sent;			/*!< Bytes notified since initialization */
+	uint32_t dropped;		/*!< Bytes rejected by BleWrite (ring full) or discarded on disconnection */
+} ble_tx_stats_t;
+
 /**
  * @brief BLE connection status
  */
@@ -65,6 +229,28 @@ typedef enum ble_status {
  */
 void BleInit(ble_config_t * ble_device);
 
+/**
+ * @brief Bluetooth initialization in broadcast mode (instead of BleInit)
+ * 
+ * @note The advertising starts with an empty payload, BleBroadcastSet adds the readings.
+ * 
+ * @param config Broadcast configuration struct
+ * @return true     Advertising set configured
+ * @return false    Bluetooth could not be started (or no BLE 5 support)
+ */
+bool BleBroadcastInit(const ble_broadcast_config_t * config);
+
+/**
+ * @brief Set the latest value of a reading of the broadcast payload (sent in the next interval)
+ * 
+ * @param id Reading id (defined by the application, i.e. one per sensor)
+ * @param data Value (i.e. packed int16 or float)
+ * @param nbytes Bytes of the value (the same every time for an id)
+ * @return true     Reading updated
+ * @return false    Not in broadcast mode, or no room in the payload for a new reading
+ */
+bool BleBroadcastSet(uint8_t id, const void *data, uint8_t nbytes);
+
 /**
  * @brief Gets BLE connection status
  * 
@@ -72,6 +258,42 @@ void BleInit(ble_config_t * ble_device);
  */
 ble_status_t BleStatus(void);
 
+/**
+ * @brief Change the connection parameters profile (requested now if connected)
+ * 
+ * @note The advertising interval is only set by BleInit.
+ * 
+ * @param profile Connection parameters profile
+ */
+void BleSetProfile(ble_profile_t profile);
+
+/**
+ * @brief Checks if the connected client is subscribed to a stream
+ * 
+ * @param stream Stream index (order of ble_config_t.streams)
+ * @return true     Frames of the stream are being received
+ * @return false    Not connected or not subscribed (there is no need to compute them)
+ */
+bool BleStreamSubscribed(uint8_t stream);
+
+/**
+ * @brief Queue a frame of a stream to be notified, without waiting
+ * 
+ * @param stream Stream index (order of ble_config_t.streams)
+ * @param data Frame (i.e. packed binary samples)
+ * @param nbytes Bytes of the frame (up to BleMaxPayload)
+ * @return true     Frame queued
+ * @return false    Not subscribed, frame too long, or no space in the TX ring (counted as dropped)
+ */
+bool BleStreamSend(uint8_t stream, const void *data, uint16_t nbytes);
+
+/**
+ * @brief Max bytes of one notification with the current MTU (BLE_MTU_DEFAULT - 3 until the exchange)
+ * 
+ * @return uint16_t Bytes per notification
+ */
+uint16_t BleMaxPayload(void);
+
 /**
  * @brief Send a single byte trough BLE (if connected)
  * 
@@ -87,12 +309,48 @@ void BleSendByte(const char *data);
 void BleSendString(const char *msg);
 
 /**
- * @brief Send multiple bytes through serial port
+ * @brief Send multiple bytes trough BLE (if connected)
+ * 
+ * @note Data is split in notifications of BleMaxPayload bytes.
  * 
  * @param data Pointer to array of data to be transmitted
  * @param nbytes Number of bytes to be sended
  */
-void BleSendBuffer(const char *data, uint8_t nbytes);
+void BleSendBuffer(const char *data, uint16_t nbytes);
+
+/**
+ * @brief Queue a message to be sent trough BLE without waiting (if connected)
+ * 
+ * @note The message is queued entirely or not at all. With BLE_SERVICE_MIDI each
+ * message is one BLE-MIDI packet.
+ * 
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended (up to BleTxFree)
+ * @return true     Message queued
+ * @return false    Not connected, or no space in the TX ring (the bytes are counted as dropped)
+ */
+bool BleWrite(const uint8_t *data, uint16_t nbytes);
+
+/**
+ * @brief Bytes of the largest message that BleWrite can queue now
+ * 
+ * @return uint32_t Free bytes
+ */
+uint32_t BleTxFree(void);
+
+/**
+ * @brief Gets the TX path counters
+ * 
+ * @param stats Counters
+ */
+void BleTxStats(ble_tx_stats_t *stats);
+
+/**
+ * @brief Gets the usage of the pool of received data
+ * 
+ * @param stats Statistics (failures: writes of the client lost)
+ */
+void BleRxStats(mem_pool_stats_t *stats);
 
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
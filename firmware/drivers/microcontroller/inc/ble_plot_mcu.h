@@ -0,0 +1,120 @@
+#ifndef BLE_PLOT_MCU_H
+#define BLE_PLOT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup BLE_Plot BLE plotter
+ ** @{ */
+
+/** \brief Binary plot frames over a stream of the BLE sensor service.
+ *
+ * Signals (one or more channels of floats) are quantized to int16 with a
+ * scale computed for each frame, and packed in frames of as many samples as
+ * fit in a notification of the negotiated MTU (or max_samples, to bound the
+ * latency of slow signals). No text is formatted: a 244 bytes notification
+ * carries 118 samples instead of ~25 formatted as "*G%.2f*".
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 2          | Index of the first sample (per channel)                |
+ * | 1          | Number of channels                                     |
+ * | 1          | Flags (BLE_PLOT_FLAG_END: last frame of a block)       |
+ * | 4          | Scale (float): value = sample * scale                  |
+ * | ...        | int16 samples, interleaved (s0 ch0, s0 ch1, s1 ch0...) |
+ *
+ * Multi-byte fields are little endian. The index counts the samples written
+ * since the last BlePlotFlush (wrapping at 65536), so the receiver places
+ * every frame and sees the gaps of lost ones. Blocks (i.e. a spectrum) are
+ * written and then flushed: the last frame has BLE_PLOT_FLAG_END and the next
+ * block starts at index 0. The host side decoder is
+ * middelware/signal_processing/tools/ble_plot_decoder.py.
+ *
+ * @code
+ * static const char * const streams[] = {"ECG"};
+ * static ble_plot_t plot;
+ * ...
+ * BlePlotInit(&plot, 0, 1, 50);        // stream 0, one channel, 50 samples per frame
+ * ...
+ * const float *channels[] = {ecg_filt};
+ * BlePlotWrite(&plot, channels, CHUNK);
+ * @endcode
+ *
+ * @note Frames are queued with BleStreamSend, without waiting: if the client
+ * is not subscribed to the stream or the TX ring is full, the samples are
+ * counted as dropped.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble_mcu.h"
+/*==================[macros]=================================================*/
+#define BLE_PLOT_HEADER			8		/*!< Bytes of the frame header */
+#define BLE_PLOT_MAX_SAMPLES	((BLE_MTU_MAX - 3 - BLE_PLOT_HEADER) / 2)	/*!< Max samples of a frame (all channels) */
+#define BLE_PLOT_MAX_CHANNELS	4		/*!< Max channels of a plot */
+#define BLE_PLOT_FLAG_END		0x01	/*!< Last frame of a block (BlePlotFlush) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Plot stream
+ */
+typedef struct {
+	uint8_t stream;							/*!< Stream of the sensor service */
+	uint8_t channels;						/*!< Channels of each sample */
+	uint16_t max_samples;					/*!< Max samples per channel of a frame (0: as many as fit) */
+	uint16_t index;							/*!< Index of the first pending sample */
+	uint16_t pending;						/*!< Samples per channel waiting for a frame */
+	float samples[BLE_PLOT_MAX_SAMPLES];	/*!< Pending samples (interleaved) */
+	uint32_t frames;						/*!< Frames queued */
+	uint32_t dropped;						/*!< Samples per channel lost (not subscribed or TX ring full) */
+} ble_plot_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a plot stream
+ *
+ * @param plot Plot stream
+ * @param stream Stream of the sensor service (index in ble_config_t.streams)
+ * @param channels Channels of each sample (up to BLE_PLOT_MAX_CHANNELS)
+ * @param max_samples Max samples per channel of a frame (0: as many as fit in a notification)
+ * @return true     Plot stream initialized
+ * @return false    Invalid number of channels
+ */
+bool BlePlotInit(ble_plot_t *plot, uint8_t stream, uint8_t channels, uint16_t max_samples);
+
+/**
+ * @brief Add samples to the plot (a frame is queued every time one is completed)
+ *
+ * @param plot Plot stream
+ * @param data Samples of each channel
+ * @param lenght Samples per channel
+ * @return true     All the completed frames were queued
+ * @return false    Some samples were dropped
+ */
+bool BlePlotWrite(ble_plot_t *plot, const float * const *data, uint16_t lenght);
+
+/**
+ * @brief Queue the pending samples as the last frame of a block (the next sample has index 0)
+ *
+ * @param plot Plot stream
+ * @return true     Frame queued (or nothing pending)
+ * @return false    Samples dropped
+ */
+bool BlePlotFlush(ble_plot_t *plot);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BLE_PLOT_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,153 @@
+#ifndef BOOT_MCU_H
+#define BOOT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup BOOT Boot
+ ** @{ */
+
+/** \brief Startup profiler and parallel initialization of the drivers.
+ *
+ * The initialization of the application is described as a table of steps, each
+ * one with the steps it depends on. BootRun starts every step as soon as its
+ * dependencies finished, in BOOT_WORKERS tasks and in the calling task, so
+ * independent initializations (i.e. BleInit, with NVS and the controller, and
+ * the LCD init sequence, mostly delays) run at the same time. It returns when
+ * all of them finished: the time to the first sample is the longest chain of
+ * dependencies instead of the sum of all of them.
+ *
+ * Lazy steps are not run at boot, but by the first BootRequire of the step (in
+ * the calling task, after its dependencies), for peripherals that aren't used
+ * right away.
+ *
+ * Start and end times (us since boot) of each step, and marks of the
+ * application (i.e. the first sample), are kept for BootReport:
+ *
+ * @code
+ * enum {STEP_BLE, STEP_LCD, STEP_SENSOR, STEP_BUZZER};
+ * static bool LcdInit(void *param){
+ *     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
+ *     return true;
+ * }
+ * ...
+ * static boot_step_t steps[] = {
+ *     [STEP_BLE] =    {"BLE", BleStart, &ble_configuration},
+ *     [STEP_LCD] =    {"LCD", LcdInit, NULL},
+ *     [STEP_SENSOR] = {"MAX30102", SensorInit, NULL},
+ *     [STEP_BUZZER] = {"Buzzer", BuzzerStart, NULL, .lazy = true},
+ * };
+ * BootRun(steps, 4);
+ * ...
+ * BootMark("first sample");
+ * BootReport(PrintUart);
+ * ...
+ * BootRequire(STEP_BUZZER);
+ * @endcode
+ *
+ * @note Steps that share a bus or a peripheral must depend on each other (i.e.
+ * two sensors on the same I2C bus). A step whose dependencies failed isn't run
+ * and fails too.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define BOOT_MAX_STEPS		16		/*!< Max steps of the initialization table */
+#define BOOT_MAX_MARKS		8		/*!< Max marks of the application (the rest are ignored) */
+#define BOOT_WORKERS		2		/*!< Tasks that run steps besides the one that calls BootRun */
+#define BOOT_DEP(step)		(1UL << (step))		/*!< Dependency on a step (index in the table) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Initialization of a step
+ *
+ * @param param Parameter of the step
+ * @return true if the initialization succeeded
+ */
+typedef bool (*boot_init_t)(void *param);
+
+/**
+ * @brief State of a step
+ */
+typedef enum {
+	BOOT_PENDING = 0,		/*!< Not started */
+	BOOT_RUNNING,			/*!< Initialization in progress */
+	BOOT_DONE,				/*!< Finished */
+	BOOT_FAILED,			/*!< Its initialization or one of its dependencies failed */
+} boot_state_t;
+
+/**
+ * @brief Step of the initialization table
+ */
+typedef struct {
+	const char *name;		/*!< Name in the report */
+	boot_init_t init_p;		/*!< Initialization */
+	void *param;			/*!< Parameter of init_p */
+	uint32_t deps;			/*!< Steps that must finish first (BOOT_DEP(a) | BOOT_DEP(b)) */
+	bool lazy;				/*!< Run by BootRequire instead of BootRun */
+	boot_state_t state;		/*!< State (set by the driver) */
+	int64_t start_us;		/*!< Start time, us since boot (set by the driver) */
+	int64_t end_us;			/*!< End time, us since boot (set by the driver) */
+} boot_step_t;
+
+/**
+ * @brief Function that sends a line of the report (i.e. UartSendString)
+ */
+typedef void (*boot_print_t)(const char *line);
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Run the steps of an initialization table that aren't lazy, each one as
+ * soon as its dependencies finished, and wait until all of them finished.
+ *
+ * @note The table must stay valid (static) for BootRequire and BootReport. It
+ * can be run only once.
+ *
+ * @param steps Initialization table
+ * @param n_steps Number of steps (up to BOOT_MAX_STEPS)
+ * @return true if all the steps run succeeded
+ */
+bool BootRun(boot_step_t *steps, uint8_t n_steps);
+
+/**
+ * @brief Wait until a step finished, running it (and its lazy dependencies) in
+ * the calling task if it wasn't started.
+ *
+ * @param step Index of the step in the table
+ * @return true if the step succeeded
+ */
+bool BootRequire(uint8_t step);
+
+/**
+ * @brief Record the time of an event of the application (i.e. the first sample).
+ *
+ * @param name Name in the report (string constant)
+ */
+void BootMark(const char *name);
+
+/**
+ * @brief Send a table with the start, end and duration of each step and the
+ * time of each mark.
+ *
+ * @param print_p Function that sends each line (ended with "\r\n")
+ */
+void BootReport(boot_print_t print_p);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BOOT_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,10 @@
  * @note All delays will block the current RTOS task, with the exception of 
  * DelayUs with usec < 50.
  *
+ * @note The timer is allocated on the first delay and runs free: its alarm is set
+ * at the earliest deadline of the tasks waiting, so several tasks can delay at
+ * the same time, each one for its own time.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,6 +25,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Persistent delay timer (no allocation per delay)						|
+ * | 14/10/2026 | Concurrent delays multiplexed on one timer							|
  * 
  **/
 
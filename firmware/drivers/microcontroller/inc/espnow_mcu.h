@@ -0,0 +1,194 @@
+#ifndef ESPNOW_MCU_H
+#define ESPNOW_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup EspNow ESP-NOW link
+ ** @{ */
+
+/** \brief Low latency events between boards over ESP-NOW (hits of trigger boards to a sound board).
+ *
+ * ESP-NOW sends Wi-Fi action frames directly between stations: there is no
+ * access point, association or IP stack in the path, and a short message
+ * arrives in about 1 ms. Every board must use the same Wi-Fi channel.
+ *
+ * Each message is an espnow_msg_t of 8 bytes:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 1          | Type (espnow_msg_type_t)                               |
+ * | 1          | Sequence number of the sender                          |
+ * | 1          | PAD (or controller)                                    |
+ * | 1          | Velocity (or value)                                    |
+ * | 4          | Time of the event in the sender (us, low 32 bits)      |
+ *
+ * The receiver keeps the last sequence number of each sender (up to
+ * ESPNOW_MAX_PEERS boards): the gaps are counted as lost messages and passed
+ * to the callback, and the repeated ones (a retry after a lost ACK) are
+ * discarded. Messages to the peers of the configuration are acknowledged and
+ * retried by the MAC; without peers they are broadcast (every board receives
+ * them, without retries).
+ *
+ * The received messages are delivered by a task of high priority, not from
+ * the Wi-Fi task.
+ *
+ * Clock synchronization: a master board sends an ESPNOW_MSG_SYNC beacon every
+ * period (EspNowSyncStart) with its time, taken just before sending it (48
+ * bits: the PAD and value fields carry the high bytes). The receivers feed
+ * the local time of the reception (EspNowGetRxTime) and the master time
+ * (EspNowSyncTime) to a time_sync_t of the middleware, and convert their
+ * timestamps to the master time base:
+ *
+ * @code
+ * static void EspNowCallback(const uint8_t *mac, const espnow_msg_t *msg, uint8_t lost, void *param){
+ *     if(msg->type == ESPNOW_MSG_SYNC){
+ *         TimeSyncUpdate(&sync, EspNowGetRxTime(), EspNowSyncTime(msg));
+ *     }
+ * }
+ * @endcode
+ *
+ * @code
+ * static const uint8_t sound_board[][ESPNOW_MAC_LENGHT] = {{0x40, 0x4C, 0xCA, 0x01, 0x02, 0x03}};
+ * espnow_config_t espnow = {
+ *     .channel = 1,
+ *     .peers = sound_board,
+ *     .n_peers = 1,
+ * };
+ * EspNowInit(&espnow);
+ * ...
+ * EspNowSend(ESPNOW_MSG_HIT, pad, velocity, (uint32_t)onset_time);
+ * @endcode
+ *
+ * @note Needs CONFIG_DRIVERS_ESPNOW (ESP-EDU drivers menu). If the Wi-Fi is
+ * already started (i.e. by WifiUdpInit) the channel of its access point is used
+ * and the configured one is ignored.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define ESPNOW_MAC_LENGHT		6		/*!< Bytes of a MAC address */
+#define ESPNOW_MAX_PEERS		8		/*!< Senders tracked by a receiver (and receivers of a sender) */
+#define ESPNOW_RX_QUEUE			16		/*!< Messages waiting for the callback */
+/*==================[typedef]================================================*/
+/**
+ * @brief Message types
+ */
+typedef enum {
+	ESPNOW_MSG_HIT = 1,				/*!< Hit: PAD and velocity */
+	ESPNOW_MSG_CC,					/*!< Control change: controller and value (i.e. hi-hat pedal) */
+	ESPNOW_MSG_CHOKE,				/*!< Stop the sound of a PAD */
+	ESPNOW_MSG_SYNC,				/*!< Clock beacon: time of the master (EspNowSyncTime) */
+	ESPNOW_MSG_USER = 0x80,			/*!< First type defined by the application */
+} espnow_msg_type_t;
+
+/**
+ * @brief Message
+ */
+typedef struct {
+	uint8_t type;					/*!< espnow_msg_type_t */
+	uint8_t seq;					/*!< Sequence number of the sender */
+	uint8_t pad;					/*!< PAD (or controller) */
+	uint8_t value;					/*!< Velocity (or value) */
+	uint32_t timestamp;				/*!< Time of the event in the sender (us, low 32 bits) */
+} espnow_msg_t;
+
+/**
+ * @brief Configuration
+ */
+typedef struct {
+	uint8_t channel;										/*!< Wi-Fi channel (1 to 13, the same on every board) */
+	const uint8_t (*peers)[ESPNOW_MAC_LENGHT];				/*!< MAC addresses of the receivers (NULL: broadcast) */
+	uint8_t n_peers;										/*!< Number of receivers (up to ESPNOW_MAX_PEERS) */
+	void (*func_p)(const uint8_t *mac, const espnow_msg_t *msg, uint8_t lost, void *param);	/*!< Message received (sender, message, messages lost before it) */
+	void *param_p;											/*!< Callback parameter */
+} espnow_config_t;
+
+/**
+ * @brief Statistics
+ */
+typedef struct {
+	uint32_t sent;					/*!< Messages sent */
+	uint32_t send_failed;			/*!< Messages not acknowledged by a peer (or not queued) */
+	uint32_t received;				/*!< Messages received */
+	uint32_t lost;					/*!< Gaps in the sequence numbers of the senders */
+	uint32_t repeated;				/*!< Repeated messages discarded */
+	uint32_t overflows;				/*!< Messages lost with the reception queue full */
+} espnow_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the Wi-Fi (if it is not started), ESP-NOW and the reception task
+ *
+ * @param config Configuration
+ * @return true     ESP-NOW started
+ * @return false    Invalid configuration, or the Wi-Fi or ESP-NOW could not be started
+ */
+bool EspNowInit(const espnow_config_t *config);
+
+/**
+ * @brief Send a message to the peers (or broadcast it), without waiting
+ *
+ * @param type Message type
+ * @param pad PAD (or controller)
+ * @param value Velocity (or value)
+ * @param timestamp Time of the event (us, i.e. TimeNowUs() or the onset of the hit)
+ * @return true     Message queued
+ * @return false    ESP-NOW could not queue the message
+ */
+bool EspNowSend(uint8_t type, uint8_t pad, uint8_t value, uint32_t timestamp);
+
+/**
+ * @brief Send an ESPNOW_MSG_SYNC beacon every period (clock master)
+ *
+ * @param period_ms Beacon period (ms, i.e. 500; 0 stops the beacons)
+ */
+void EspNowSyncStart(uint32_t period_ms);
+
+/**
+ * @brief Local time of the reception of the message being delivered (call it from the callback)
+ *
+ * @return uint64_t Time (us, TimeNowUs), taken in the Wi-Fi task when the message arrived
+ */
+uint64_t EspNowGetRxTime(void);
+
+/**
+ * @brief Master time of an ESPNOW_MSG_SYNC beacon
+ *
+ * @param msg Beacon
+ * @return uint64_t Time of the master when it sent the beacon (us)
+ */
+uint64_t EspNowSyncTime(const espnow_msg_t *msg);
+
+/**
+ * @brief MAC address of this board (to configure the peers of the others)
+ *
+ * @param mac MAC address (ESPNOW_MAC_LENGHT bytes)
+ */
+void EspNowGetMac(uint8_t *mac);
+
+/**
+ * @brief Read the statistics
+ *
+ * @param stats Statistics
+ */
+void EspNowGetStats(espnow_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ESPNOW_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,146 @@
+#ifndef EVENT_BUS_MCU_H
+#define EVENT_BUS_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Event_Bus Event Bus
+ ** @{ */
+
+/** \brief Lock-free single-publisher/multi-subscriber event bus.
+ *
+ * This driver provide a ring of fixed size events that one producer (a task or an
+ * ISR) publishes and that several consumers read, each one with its own read cursor:
+ * every subscriber gets every event, at its own pace, and the producer publishes
+ * once no matter how many subscribers there are (i.e. a hit read by the LED, the
+ * audio, the MIDI and the telemetry tasks).
+ *
+ * A subscriber can ask to be notified on every publish, as with xTaskNotifyGive()
+ * or, with notify bits, as with xTaskNotify() and eSetBits (so a task can wait for
+ * the bus and for other sources at once). A publish notifies only the subscribers
+ * with a task.
+ *
+ * An event is dropped (and counted) only when the slowest subscriber has the whole
+ * ring pending; the ring size is the burst of events that the slowest consumer can
+ * fall behind without losing any.
+ *
+ * @note Only one producer is allowed for each bus, and each subscriber must be read
+ * by a single task. EventBusPublishFromISR and EventBusRead are placed in IRAM.
+ *
+ * @note The number of events must be a power of two. Storage is provided by the user
+ * (no heap is used).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros]=================================================*/
+#define EVENT_BUS_MAX_SUBSCRIBERS	8		/*!< Max subscribers of a bus */
+#define EVENT_BUS_ALIGN				32		/*!< Alignment of publisher and subscriber indexes */
+/*==================[typedef]================================================*/
+/**
+ * @brief Subscriber of an event bus
+ */
+typedef struct {
+	volatile uint32_t tail __attribute__((aligned(EVENT_BUS_ALIGN)));	/*!< Read index (only modified by the subscriber) */
+	TaskHandle_t task;			/*!< Task notified on publish (NULL: the subscriber polls) */
+	uint32_t notify_bits;		/*!< Bits set in the task notification value (0: notification count, as xTaskNotifyGive) */
+} event_bus_subscriber_t;
+
+/**
+ * @brief Event bus structure
+ */
+typedef struct {
+	volatile uint32_t head __attribute__((aligned(EVENT_BUS_ALIGN)));	/*!< Write index (only modified by the publisher) */
+	uint8_t *storage;			/*!< Events storage (event_size * event_num bytes) */
+	uint32_t event_size;		/*!< Size of each event (in bytes) */
+	uint32_t mask;				/*!< event_num - 1 */
+	volatile uint8_t subscribers;	/*!< Number of subscribers */
+	event_bus_subscriber_t subscriber[EVENT_BUS_MAX_SUBSCRIBERS];	/*!< Subscribers */
+	volatile uint32_t overflows;/*!< Number of events dropped because a subscriber had the ring full */
+} event_bus_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Event bus initialization
+ *
+ * @param bus Pointer to event bus structure
+ * @param storage Array to store events (of event_size * event_num bytes)
+ * @param event_size Size of each event (in bytes)
+ * @param event_num Number of events (must be a power of two)
+ * @return true     Event bus initialized
+ * @return false    event_num is not a power of two
+ */
+bool EventBusInit(event_bus_t *bus, void *storage, uint32_t event_size, uint32_t event_num);
+
+/**
+ * @brief Add a subscriber to the bus
+ *
+ * The subscriber gets the events published from now on.
+ *
+ * @param bus Pointer to event bus structure
+ * @param task Task notified on every publish (NULL: no notification)
+ * @param notify_bits Bits set in the notification value of the task (0: notification count)
+ * @return Subscriber number, or -1 if the bus already has EVENT_BUS_MAX_SUBSCRIBERS
+ */
+int8_t EventBusSubscribe(event_bus_t *bus, TaskHandle_t task, uint32_t notify_bits);
+
+/**
+ * @brief Publish one event (from a task) and notify the subscribers
+ *
+ * @param bus Pointer to event bus structure
+ * @param event Pointer to the event
+ * @return true     Event published
+ * @return false    A subscriber has the ring full (event dropped)
+ */
+bool EventBusPublish(event_bus_t *bus, const void *event);
+
+/**
+ * @brief Publish one event from an ISR and notify the subscribers
+ *
+ * @param bus Pointer to event bus structure
+ * @param event Pointer to the event
+ * @param task_woken Set to pdTRUE if a subscriber must run (can be NULL)
+ * @return true     Event published
+ * @return false    A subscriber has the ring full (event dropped)
+ */
+bool EventBusPublishFromISR(event_bus_t *bus, const void *event, BaseType_t *task_woken);
+
+/**
+ * @brief Take the oldest event not read by a subscriber
+ *
+ * @param bus Pointer to event bus structure
+ * @param subscriber Subscriber number
+ * @param event Pointer to variable where the event will be stored
+ * @return true     Event read
+ * @return false    No pending events
+ */
+bool EventBusRead(event_bus_t *bus, uint8_t subscriber, void *event);
+
+/**
+ * @brief Number of events not read by a subscriber
+ *
+ * @param bus Pointer to event bus structure
+ * @param subscriber Subscriber number
+ * @return Number of events
+ */
+uint32_t EventBusPending(event_bus_t *bus, uint8_t subscriber);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* EVENT_BUS_MCU_H */
+
+/*==================[end of file]============================================*/
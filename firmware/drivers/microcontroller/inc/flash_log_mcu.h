@@ -0,0 +1,146 @@
+#ifndef FLASH_LOG_MCU_H
+#define FLASH_LOG_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Flash_Log Flash ring logger
+ ** @{ */
+
+/** \brief Recording of telemetry frames in a flash data partition, as an append-only ring.
+ *
+ * Hours of signals (PPG, pads, IMU) are recorded on the board without a host
+ * connected. Frames (i.e. encoded with TelemetryEncode, or any other byte
+ * frames) are copied into a RAM buffer of one flash sector; a full buffer is
+ * written by a task of low priority, so FlashLogWrite only copies and never
+ * waits for the flash. Each sector is erased and written once per turn of the
+ * ring (no write amplification), and when the partition is full the oldest
+ * sector is overwritten.
+ *
+ * Each sector of FLASH_LOG_SECTOR bytes starts with a header:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 4          | FLASH_LOG_MAGIC                                        |
+ * | 4          | Sequence number of the sector (never reused)           |
+ * | 8          | Time of the first frame (us, TimeNowUs)                |
+ * | 2 + n      | Each frame: n (little endian) and n bytes              |
+ * | ...        | 0xFF up to the end of the sector                       |
+ *
+ * A frame is never split between sectors. The headers are the index of the
+ * log: FlashLogInit finds the newest sector reading only the headers, and
+ * FlashLogDump seeks the first sector of a time with a binary search on them.
+ *
+ * FlashLogDump sends the written sectors, as they are in the flash, through a
+ * UART port (i.e. UART_USB): the host side decoder is
+ * middelware/signal_processing/tools/telemetry_decoder.py (source flashlog:FILE).
+ *
+ * @code
+ * FlashLogInit("log");
+ * ...
+ * uint16_t n = TelemetryEncode(&telemetry, frame);
+ * FlashLogWrite(frame, n);
+ * ...
+ * FlashLogDump(UART_USB, 0);
+ * @endcode
+ *
+ * @note Needs CONFIG_DRIVERS_FLASH_LOG (ESP-EDU drivers menu) and a data
+ * partition in the partition table of the project (i.e.
+ * "log, data, 0x41, , 1M,"). While the flash is erased or written the cache
+ * is disabled: tasks wait and interrupts not in IRAM are deferred, for about
+ * 30 ms per sector erase. Continuous ADC conversions go on by DMA, so its
+ * buffers must hold that time of samples.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define FLASH_LOG_SECTOR		4096		/*!< Bytes of a flash sector (erase unit) */
+#define FLASH_LOG_HEADER		16			/*!< Bytes of the header of a sector */
+#define FLASH_LOG_MAX_FRAME		(FLASH_LOG_SECTOR - FLASH_LOG_HEADER - 2)	/*!< Max bytes of a frame */
+#define FLASH_LOG_MAGIC			0x474F4C46	/*!< "FLOG" */
+#define FLASH_LOG_BUFFERS		3			/*!< Sector buffers in RAM (the one being filled and the ones waiting for the flash) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Statistics
+ */
+typedef struct {
+	uint32_t frames;				/*!< Frames written since FlashLogInit */
+	uint32_t bytes;					/*!< Bytes of the frames written */
+	uint32_t dropped;				/*!< Frames dropped (no free buffer or too large) */
+	uint32_t sectors_written;		/*!< Sectors written since FlashLogInit */
+	uint32_t write_errors;			/*!< Sectors the flash could not erase or write */
+	uint32_t sectors;				/*!< Sectors of the log */
+	uint32_t capacity;				/*!< Sectors of the partition */
+} flash_log_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Open the log of a partition (the frames are appended after the newest sector) and start the writing task
+ *
+ * @param partition Name of the data partition
+ * @return true     Log opened
+ * @return false    Partition not found (or smaller than 2 sectors)
+ */
+bool FlashLogInit(const char *partition);
+
+/**
+ * @brief Add a frame to the log (copied, without waiting for the flash)
+ *
+ * @param data Frame
+ * @param lenght Bytes of the frame (up to FLASH_LOG_MAX_FRAME)
+ * @return true     Frame queued
+ * @return false    Frame dropped (no free buffer or too large)
+ */
+bool FlashLogWrite(const void *data, uint16_t lenght);
+
+/**
+ * @brief Write the current sector now, even if it is not full (i.e. before stopping the recording)
+ */
+void FlashLogFlush(void);
+
+/**
+ * @brief Send the sectors of the log through a UART port, from the oldest one (blocks)
+ *
+ * @note The current sector is flushed first. Frames written during the dump are
+ * recorded, but not sent.
+ *
+ * @param port Port
+ * @param from_us Time of the first frame to send (us, 0: the whole log); the dump starts at the sector that contains it
+ * @return uint32_t Sectors sent
+ */
+uint32_t FlashLogDump(uart_mcu_port_t port, uint64_t from_us);
+
+/**
+ * @brief Erase the whole log (blocks for the erase of the partition, and FlashLogWrite meanwhile)
+ *
+ * @return true     Log erased
+ * @return false    Not initialized or flash error
+ */
+bool FlashLogErase(void);
+
+/**
+ * @brief Read the statistics
+ *
+ * @param stats Statistics
+ */
+void FlashLogGetStats(flash_log_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FLASH_LOG_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,12 @@
  ** @{ */
 
 /** \brief GPIO driver to use gpio ouputs with faster functions than gpio_mcu.
+ *
+ * @note Outputs are grouped in bundles of the CPU dedicated GPIO channels
+ * (GPIO_FAST_MAX_PINS on the ESP32-C6, shared by all the bundles). A write to a
+ * bundle is a single CPU instruction that changes all its pins at the same time,
+ * so several signals (i.e. LED strips or a parallel bus) can be driven in
+ * lock-step with GPIOFastBundleStream.
  * 
  * @author Albano Peñalva
  *
@@ -16,6 +22,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 14/10/2026 | Multiple bundles and parallel stream writer							|
  * 
  **/
 
@@ -24,6 +31,8 @@
 #include <stdint.h>
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define GPIO_FAST_MAX_PINS		8	/*!< Dedicated GPIO output channels (pins of all the bundles) */
+#define GPIO_FAST_MAX_BUNDLES	GPIO_FAST_MAX_PINS	/*!< Maximum number of bundles */
 
 /*==================[typedef]================================================*/
 
@@ -32,17 +41,50 @@
 /*==================[external functions declaration]=========================*/
 
 /**
- * @brief 
+ * @brief Create a bundle of fast outputs.
+ * 
+ * @param pin_list 	Pins of the bundle (bit 0 of the values written is the first pin)
+ * @param pin_qty 	Number of pins
+ * @return int8_t 	Bundle number (-1 if there are no free dedicated channels)
+ */
+int8_t GPIOFastBundleInit(gpio_t *pin_list, uint8_t pin_qty);
+
+/**
+ * @brief Write the pins of a bundle selected by a mask.
+ * 
+ * @param bundle 	Bundle number
+ * @param mask 		Pins to change (bit 0: first pin)
+ * @param value 	Pins values
+ */
+void GPIOFastBundleWrite(int8_t bundle, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Write a sequence of values to all the pins of a bundle.
+ * 
+ * @note Each value changes all the pins at the same time. With hold_cycles 0 values
+ * are written back to back (one write per CPU cycle group); else each write waits
+ * for its deadline, counted in CPU cycles from the first one. Interrupts aren't
+ * disabled: an interrupt can stretch a value, but it doesn't shift the following ones.
+ * 
+ * @param bundle 		Bundle number
+ * @param values 		Values (bit 0: first pin)
+ * @param lenght 		Lenght of values array
+ * @param hold_cycles 	CPU cycles between writes (0: as fast as possible)
+ */
+void GPIOFastBundleStream(int8_t bundle, const uint8_t *values, uint32_t lenght, uint32_t hold_cycles);
+
+/**
+ * @brief Create the default bundle, used by GPIOFastWrite.
  * 
- * @param pin_list 
- * @param pin_qty 
+ * @param pin_list 	Pins of the bundle
+ * @param pin_qty 	Number of pins
  */
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
 
 /**
- * @brief 
+ * @brief Write all the pins of the default bundle.
  * 
- * @param value 
+ * @param value 	Pins values (bit 0: first pin)
  */
 void GPIOFastWrite(uint16_t value);
 
@@ -19,6 +19,12 @@
  * @note GPIO_12 and GPIO_13 are not recommended for use, because using them will
  * overwrite the flash and debug functionalities via USB.
  * 
+ * @note GPIOOnFast, GPIOOffFast, GPIOStateFast, GPIOReadFast, GPIOReadAllFast and
+ * GPIOWriteMask are inlined register accesses (no argument checks, usable from IRAM
+ * ISRs) for bit-banged drivers. GPIOWriteMask changes several outputs with one write
+ * to the set and one to the clear register, and GPIOReadAllFast samples every input
+ * at the same instant.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -26,13 +32,22 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Input interruption on both edges		                         		|
+ * | 14/10/2026 | Register level fast read/write and masked writes               		|
+ * | 15/10/2026 | Simultaneous read of all the inputs				               		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "esp_attr.h"
+#include "soc/gpio_struct.h"
 /*==================[macros]=================================================*/
+/**
+ * @brief Mask of a GPIO for GPIOWriteMask
+ */
+#define GPIO_MASK(pin)		(1UL << (pin))
 
 /*==================[typedef]================================================*/
 /**
@@ -134,6 +149,15 @@ bool GPIORead(gpio_t pin);
  */
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
 
+/**
+ * @brief Configure GPIO input interruption on both edges (i.e. to time pulses)
+ * 
+ * @param pin GPIO number
+ * @param ptr_int_func Pointer to callback function
+ * @param args 
+ */
+void GPIOActivIntAnyEdge(gpio_t pin, void *ptr_int_func, void *args);
+
 /**
  * @brief Configure an input glitch filter to a GPIO
  * 
@@ -144,6 +168,70 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
  */
 void GPIOInputFilter(gpio_t pin);
 
+/**
+ * @brief Change GPIO state to high (register write, GPIO must be an output)
+ * 
+ * @param pin GPIO number
+ */
+FORCE_INLINE_ATTR void GPIOOnFast(gpio_t pin){
+	GPIO.out_w1ts.val = GPIO_MASK(pin);
+}
+
+/**
+ * @brief Change GPIO state to low (register write, GPIO must be an output)
+ * 
+ * @param pin GPIO number
+ */
+FORCE_INLINE_ATTR void GPIOOffFast(gpio_t pin){
+	GPIO.out_w1tc.val = GPIO_MASK(pin);
+}
+
+/**
+ * @brief Change GPIO state (register write, GPIO must be an output)
+ * 
+ * @param pin GPIO number
+ * @param state GPIO state (true: high - false: low)
+ */
+FORCE_INLINE_ATTR void GPIOStateFast(gpio_t pin, bool state){
+	if(state){
+		GPIO.out_w1ts.val = GPIO_MASK(pin);
+	}
+	else{
+		GPIO.out_w1tc.val = GPIO_MASK(pin);
+	}
+}
+
+/**
+ * @brief Reads GPIO state (register read)
+ * 
+ * @param pin GPIO number
+ * @return true GPIO input high
+ * @return false GPIO input low
+ */
+FORCE_INLINE_ATTR bool GPIOReadFast(gpio_t pin){
+	return (GPIO.in.val >> pin) & 1;
+}
+
+/**
+ * @brief Reads the state of all the GPIO inputs at the same time (register read)
+ * 
+ * @return uint32_t GPIO states (bit n: GPIO n)
+ */
+FORCE_INLINE_ATTR uint32_t GPIOReadAllFast(void){
+	return GPIO.in.val;
+}
+
+/**
+ * @brief Change the state of several GPIO outputs at the same time
+ * 
+ * @param mask GPIOs to change (i.e. GPIO_MASK(GPIO_20) | GPIO_MASK(GPIO_21))
+ * @param value New states (bit n: GPIO n), bits outside the mask are ignored
+ */
+FORCE_INLINE_ATTR void GPIOWriteMask(uint32_t mask, uint32_t value){
+	GPIO.out_w1ts.val = value & mask;
+	GPIO.out_w1tc.val = ~value & mask;
+}
+
 /**
  * @brief GPIO de-initialization
  * 
@@ -12,6 +12,29 @@
  * 
  * @note SDA: GPIO_6, SCL: GPIO_7.
  * 
+ * @note Register reads are a single transaction (register write and data read with a
+ * repeated start) and command links are built in the stack, so register accesses don't
+ * allocate memory.
+ *
+ * @note Register bursts can be queued with I2C_queue (up to I2C_QUEUE_SIZE): they're
+ * executed in order by a driver task while the caller keeps working. At the end of each
+ * one the driver calls its callback, notifies its task and posts it to the results read
+ * with I2C_getResult. The caller owns the i2c_trans_t and its buffer until it finishes.
+ *
+ * @note I2C_initialize configures bus 0 with the board pins. Other buses (if the chip has
+ * more than one controller) are configured with I2C_initializeBus, and I2C_addDevice assigns
+ * a device its bus and clock: a slow device doesn't throttle the fast ones, the clock is
+ * changed before each transaction that needs a different one. Devices not added use bus 0
+ * and its clock. Device addresses must be unique among buses.
+ *
+ * @note A device can keep a shadow of its configuration registers (I2C_addShadow): every
+ * read or write of those registers updates it, and I2C_writeBit, I2C_writeBits and
+ * I2C_updateBits take the current value from it instead of reading the register first,
+ * so a read-modify-write costs a single write transaction. Plain reads always go to the
+ * bus. Registers with bits that change on their own (status, self-clearing reset bits)
+ * must be left out, and the shadow must be invalidated after a device reset
+ * (I2C_invalidateShadow).
+ *
  * @note ESP-EDU have 4 I2C connector in the board (J4, J5, J6 and J8), but all of them are routed to the same I2C port.
  *
  * @author Juan Ignacio Cerrudo
@@ -21,6 +44,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 14/10/2026 | Transactions without heap allocated links      |
+ * | 14/10/2026 | Asynchronous register transactions             |
+ * | 14/10/2026 | Bus configuration and per device clock         |
+ * | 15/10/2026 | Register shadow for read-modify-write helpers  |
  *
  */
 
@@ -29,6 +56,8 @@
 #include <stdbool.h>
 #include "esp_log.h"
 #include "driver/i2c.h"
+#include "freertos/FreeRTOS.h"
+#include "soc/soc_caps.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 
@@ -40,6 +69,28 @@
 #define I2C_MASTER_TX_BUF_DISABLE   0       /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_RX_BUF_DISABLE   0       /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_TIMEOUT_MS       1000
+#define I2C_QUEUE_SIZE              8           /*!< Transactions that can be queued */
+#define I2C_BUS_0                   0           /*!< Bus of the ESP-EDU I2C connectors */
+#define I2C_BUS_NUM                 SOC_I2C_NUM /*!< Number of I2C controllers of the chip */
+#define I2C_MAX_DEVICES             8           /*!< Devices that can be added with I2C_addDevice */
+#define I2C_WAIT_FOREVER            0xFFFFFFFF  /*!< I2C_getResult without timeout */
+#define I2C_SHADOW_RANGES           8           /*!< Register ranges that can be added with I2C_addShadow */
+#define I2C_SHADOW_SIZE             128         /*!< Registers of all the shadows */
+
+/**
+ * @brief Queued register transaction (owned by the caller)
+ */
+typedef struct{
+	uint8_t devAddr;				/*!< I2C slave device address */
+	uint8_t regAddr;				/*!< First register to read or write */
+	bool write;						/*!< true: write data to the registers, false: read them into data */
+	uint8_t length;					/*!< Number of bytes */
+	uint8_t *data;					/*!< Data to write or buffer for the data read */
+	void (*func_p)(void*);			/*!< Callback at the end of the transaction, called from the driver task (NULL if not required) */
+	void *param_p;					/*!< Pointer to callback parameter */
+	TaskHandle_t task;				/*!< Task notified at the end of the transaction (NULL if not required) */
+	bool ok;						/*!< Result of the transaction (set by the driver) */
+} i2c_trans_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -49,6 +100,43 @@
  */
 bool I2C_initialize( uint32_t clockRateHz );
 
+/**
+ * @brief Initialize an I2C bus (calling it again on the same bus changes its clock)
+ * @param bus Bus number (less than I2C_BUS_NUM)
+ * @param sda SDA pin
+ * @param scl SCL pin
+ * @param clockRateHz Clock of the bus (i.e. 100000, 400000 or 1000000 for Fast-mode Plus)
+ * @return true if the bus is ready
+ */
+bool I2C_initializeBus(uint8_t bus, gpio_t sda, gpio_t scl, uint32_t clockRateHz);
+
+/**
+ * @brief Assign a device its bus and clock
+ * @param devAddr I2C slave device address
+ * @param bus Bus the device is connected to
+ * @param clockRateHz Device clock (0: clock of the bus)
+ * @return false if the bus doesn't exist or there's no room for more devices
+ */
+bool I2C_addDevice(uint8_t devAddr, uint8_t bus, uint32_t clockRateHz);
+
+/**
+ * @brief Keep a shadow of a range of configuration registers of a device (it can be
+ * called several times to add more ranges, adding the same range again does nothing).
+ * The registers are loaded on their first read
+ * @param devAddr I2C slave device address
+ * @param regAddr First register of the range
+ * @param count Number of registers
+ * @return false if there's no room for the range (I2C_SHADOW_RANGES, I2C_SHADOW_SIZE)
+ */
+bool I2C_addShadow(uint8_t devAddr, uint8_t regAddr, uint8_t count);
+
+/**
+ * @brief Forget the values of the shadow of a device (i.e. after a reset of the device),
+ * the next read-modify-write of each register reads it again
+ * @param devAddr I2C slave device address
+ */
+void I2C_invalidateShadow(uint8_t devAddr);
+
 /** @fn I2C_enable(bool isEnabled)
  * @brief Enable or disable I2C
  * @param isEnabled true = enable, false = disable
@@ -130,6 +218,17 @@ bool I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data
  */
 bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
 
+/**
+ * @brief Write the bits of mask in an 8-bit device register, keeping the others (the
+ * current value is taken from the shadow if the register has one).
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to write
+ * @param data Value of the bits (in their position)
+ * @return Status of operation (true = success)
+ */
+bool I2C_updateBits(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data);
+
 /** @fn I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data)
  * @brief Write single byte to an 8-bit device register.
  * @param devAddr I2C slave device address
@@ -186,6 +285,22 @@ bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr);
  */
 int8_t I2C_requestBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout);
 
+/**
+ * @brief Queue a register transaction, it's executed while the caller keeps working
+ * 
+ * @param trans Transaction (it and its buffer must remain valid until it finishes)
+ * @return true if queued, false if the queue is full or I2C isn't initialized
+ */
+bool I2C_queue(i2c_trans_t *trans);
+
+/**
+ * @brief Wait for the next finished transaction
+ * 
+ * @param timeout_ms Maximum time to wait (I2C_WAIT_FOREVER: no timeout)
+ * @return Finished transaction (check its ok field), NULL if timeout
+ */
+i2c_trans_t* I2C_getResult(uint32_t timeout_ms);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
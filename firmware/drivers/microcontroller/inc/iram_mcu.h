@@ -0,0 +1,51 @@
+#ifndef IRAM_MCU_H
+#define IRAM_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup IRAM IRAM placement
+ ** @{ */
+
+/** \brief Placement of the sampling and audio paths in internal RAM.
+ *
+ * Code running from flash stalls (or faults, in ISRs) while the flash is
+ * written or erased (i.e. NVS, sample bank updates), because the cache is
+ * disabled. With CONFIG_DRIVERS_SAMPLE_PATH_IN_IRAM (menuconfig: ESP-EDU
+ * drivers) the whole chain from the timer/ADC interruptions to the DAC write
+ * and the ring buffers runs from IRAM: the ESP-IDF gptimer, ADC continuous and
+ * sigma delta ISRs and control functions are placed in IRAM and the driver
+ * functions and user callbacks marked with SAMPLE_PATH_ATTR too.
+ *
+ * @note Callbacks given to TimerInit, AnalogInputInit (continuous mode) and
+ * AnalogOutputStreamInit should be marked with SAMPLE_PATH_ATTR and must only
+ * use data in RAM (SAMPLE_DATA_ATTR for constant tables they read).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "sdkconfig.h"
+#include "esp_attr.h"
+/*==================[macros]=================================================*/
+#if CONFIG_DRIVERS_SAMPLE_PATH_IN_IRAM
+#define SAMPLE_PATH_ATTR	IRAM_ATTR		/*!< Function of the sample path (in IRAM) */
+#define SAMPLE_DATA_ATTR	DRAM_ATTR		/*!< Constant data read by the sample path (in DRAM) */
+#else
+#define SAMPLE_PATH_ATTR
+#define SAMPLE_DATA_ATTR
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IRAM_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,162 @@
+#ifndef JITTER_BUFFER_MCU_H
+#define JITTER_BUFFER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Jitter_Buffer Jitter Buffer
+ ** @{ */
+
+/** \brief Adaptive jitter buffer for streamed samples (i.e. PCM audio received by UART).
+ *
+ * Samples arrive in bursts (UART or USB packets, a host that is not real time)
+ * but are played at a fixed rate by a timer ISR. The jitter buffer is a ring
+ * (ring_buffer_mcu.h) between the task that receives the samples
+ * (JitterBufferWrite) and the ISR that plays them (JitterBufferRead, one
+ * sample per period, in IRAM):
+ *
+ * - Playback starts once target samples are buffered (the latency that absorbs
+ *   the bursts). Meanwhile, and after an underrun, the last sample is held.
+ * - On an underrun the target grows by step (up to max_level), so a bursty
+ *   link ends up with the latency it needs.
+ * - Every window samples played without underruns, the target decays back
+ *   towards start_level, and if the buffer level never went under the target
+ *   one sample is dropped: the excess latency of a burst, or of a sender
+ *   slightly faster than the timer, is removed one sample at a time (with no
+ *   audible gaps).
+ * - Samples that do not fit are dropped and counted (overruns).
+ *
+ * @code
+ * static uint8_t storage[4096];
+ * static jitter_buffer_t stream;
+ * static void StreamRx(uint8_t *data, uint16_t lenght, void *param){
+ *     JitterBufferWrite(&stream, data, lenght);
+ * }
+ * static void PlaySample(void *param){
+ *     uint8_t sample;
+ *     JitterBufferRead(&stream, &sample);
+ *     AnalogOutputWrite(sample);
+ * }
+ * ...
+ * jitter_buffer_config_t config = {.storage = storage, .elem_size = 1, .elem_num = 4096, .window = 8000};
+ * JitterBufferInit(&stream, &config);
+ * @endcode
+ *
+ * @note Only one producer (task) and one consumer (ISR or task) are allowed for each
+ * jitter buffer. Adaptation is done by the consumer, so no locks are needed.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ring_buffer_mcu.h"
+/*==================[macros]=================================================*/
+#define JITTER_BUFFER_MAX_ELEM_SIZE	4		/*!< Max size of a sample (i.e. 16 bits stereo) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Jitter buffer config structure
+ */
+typedef struct {
+	void *storage;			/*!< Samples storage (elem_size * elem_num bytes) */
+	uint32_t elem_size;		/*!< Size of each sample (1 to JITTER_BUFFER_MAX_ELEM_SIZE bytes) */
+	uint32_t elem_num;		/*!< Number of samples (must be a power of two) */
+	uint32_t start_level;	/*!< Samples buffered before playing (0: elem_num / 8) */
+	uint32_t max_level;		/*!< Max samples buffered before playing (0: elem_num * 3 / 4) */
+	uint32_t step;			/*!< Growth of the buffered samples on each underrun (0: start_level / 2) */
+	uint32_t window;		/*!< Samples played between adaptations (i.e. 1 s of audio) */
+} jitter_buffer_config_t;
+
+/**
+ * @brief Jitter buffer statistics
+ */
+typedef struct {
+	uint32_t level;			/*!< Samples buffered */
+	uint32_t target;		/*!< Samples buffered before playing */
+	uint32_t underruns;		/*!< Times the buffer got empty while playing */
+	uint32_t overruns;		/*!< Samples dropped because the buffer was full */
+	uint32_t skipped;		/*!< Samples dropped to reduce the latency */
+	bool playing;			/*!< Playing (false: buffering) */
+} jitter_buffer_stats_t;
+
+/**
+ * @brief Jitter buffer structure
+ */
+typedef struct {
+	ring_buffer_t ring;		/*!< Samples */
+	uint32_t start_level;	/*!< Min target */
+	uint32_t max_level;		/*!< Max target */
+	uint32_t step;			/*!< Growth of the target on each underrun */
+	uint32_t window;		/*!< Samples played between adaptations */
+	uint32_t target;		/*!< Samples buffered before playing */
+	uint32_t played;		/*!< Samples played in the current window */
+	uint32_t min_level;		/*!< Min level of the current window */
+	bool window_underrun;	/*!< Underrun in the current window */
+	volatile bool playing;	/*!< Playing (false: buffering) */
+	volatile uint32_t underruns;	/*!< Times the buffer got empty while playing */
+	volatile uint32_t skipped;		/*!< Samples dropped to reduce the latency */
+	uint8_t last[JITTER_BUFFER_MAX_ELEM_SIZE];	/*!< Last sample played (held while buffering) */
+} jitter_buffer_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Jitter buffer initialization (buffering, the held sample is all zeros)
+ *
+ * @param jb Pointer to jitter buffer structure
+ * @param config Configuration
+ * @return true     Jitter buffer initialized
+ * @return false    Invalid configuration
+ */
+bool JitterBufferInit(jitter_buffer_t *jb, const jitter_buffer_config_t *config);
+
+/**
+ * @brief Store received samples (producer side)
+ *
+ * @param jb Pointer to jitter buffer structure
+ * @param elems Array of samples
+ * @param n Number of samples
+ * @return Number of samples stored (the rest are counted as overruns)
+ */
+uint32_t JitterBufferWrite(jitter_buffer_t *jb, const void *elems, uint32_t n);
+
+/**
+ * @brief Take the sample to play (consumer side, i.e. from the timer ISR)
+ *
+ * @param jb Pointer to jitter buffer structure
+ * @param elem Pointer to variable where the sample will be stored (the last one while buffering)
+ * @return true     New sample
+ * @return false    Buffering (the last sample was repeated)
+ */
+bool JitterBufferRead(jitter_buffer_t *jb, void *elem);
+
+/**
+ * @brief Jitter buffer statistics
+ *
+ * @param jb Pointer to jitter buffer structure
+ * @param stats Pointer to statistics structure
+ */
+void JitterBufferGetStats(jitter_buffer_t *jb, jitter_buffer_stats_t *stats);
+
+/**
+ * @brief Discard the buffered samples and go back to the start level (consumer side, with
+ * the playback stopped)
+ *
+ * @param jb Pointer to jitter buffer structure
+ */
+void JitterBufferFlush(jitter_buffer_t *jb);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* JITTER_BUFFER_MCU_H */
+
+/*==================[end of file]============================================*/
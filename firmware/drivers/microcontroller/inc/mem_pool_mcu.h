@@ -0,0 +1,138 @@
+#ifndef MEM_POOL_MCU_H
+#define MEM_POOL_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Mem_Pool Memory pool
+ ** @{ */
+
+/** \brief Fixed block memory pools.
+ *
+ * A pool splits a static storage in blocks of the same size. MemPoolAlloc and
+ * MemPoolFree take and return one block in constant time (the free blocks form
+ * a lock-free list), so buffers and messages (i.e. the data received by BLE,
+ * sample blocks) can be shared by several tasks and ISRs without the heap and
+ * without sizing one static array for each user. Both functions are placed in
+ * IRAM and can be called from IRAM safe ISRs.
+ *
+ * @code
+ * MEM_POOL_STORAGE_DEFINE(msg, sizeof(msg_t), 8);
+ * static mem_pool_t msg_pool;
+ * ...
+ * MemPoolInit(&msg_pool, msg_storage, sizeof(msg_t), 8);
+ * msg_t *msg = MemPoolAlloc(&msg_pool);
+ * if(msg != NULL){
+ *     ...
+ *     xQueueSend(queue, &msg, 0);      // only the pointer is copied
+ * }
+ * ...
+ * xQueueReceive(queue, &msg, portMAX_DELAY);
+ * ...
+ * MemPoolFree(&msg_pool, msg);
+ * @endcode
+ *
+ * The statistics of each pool (blocks in use, peak and failed allocations)
+ * show how many blocks are really needed.
+ *
+ * @note Blocks are aligned to MEM_POOL_ALIGN bytes. Up to 65534 blocks per pool.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MEM_POOL_ALIGN		4		/*!< Alignment of the blocks (bytes) */
+#define MEM_POOL_MAX_BLOCKS	0xFFFE	/*!< Max blocks of a pool */
+
+/** @brief Size of a block of a pool of elements of elem_size bytes */
+#define MEM_POOL_BLOCK_SIZE(elem_size)	\
+	(((elem_size) + MEM_POOL_ALIGN - 1) & ~(MEM_POOL_ALIGN - 1))
+/** @brief Bytes of the storage of a pool of block_num blocks of elem_size bytes */
+#define MEM_POOL_STORAGE_SIZE(elem_size, block_num)	\
+	(MEM_POOL_BLOCK_SIZE(elem_size) * (block_num))
+/** @brief Define the storage (id##_storage) of a pool */
+#define MEM_POOL_STORAGE_DEFINE(id, elem_size, block_num)	\
+	static uint8_t id##_storage[MEM_POOL_STORAGE_SIZE(elem_size, block_num)] __attribute__((aligned(MEM_POOL_ALIGN)))
+/*==================[typedef]================================================*/
+/**
+ * @brief Memory pool structure
+ */
+typedef struct {
+	uint8_t *storage;			/*!< Blocks */
+	uint32_t block_size;		/*!< Size of each block (bytes, multiple of MEM_POOL_ALIGN) */
+	uint16_t block_num;			/*!< Number of blocks */
+	volatile uint32_t head;		/*!< First free block (low 16 bits) and change counter (high 16 bits) */
+	volatile uint32_t in_use;	/*!< Blocks allocated */
+	volatile uint32_t peak;		/*!< Max blocks allocated at the same time */
+	volatile uint32_t allocs;	/*!< Successful allocations */
+	volatile uint32_t failures;	/*!< Allocations with the pool empty */
+} mem_pool_t;
+
+/**
+ * @brief Usage statistics of a pool
+ */
+typedef struct {
+	uint32_t block_size;		/*!< Size of each block (bytes) */
+	uint16_t block_num;			/*!< Number of blocks */
+	uint16_t in_use;			/*!< Blocks allocated */
+	uint16_t peak;				/*!< Max blocks allocated at the same time */
+	uint32_t allocs;			/*!< Successful allocations */
+	uint32_t failures;			/*!< Allocations with the pool empty */
+} mem_pool_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Memory pool initialization (all the blocks free)
+ *
+ * @param pool Pointer to pool structure
+ * @param storage Storage of MEM_POOL_STORAGE_SIZE(elem_size, block_num) bytes, aligned to MEM_POOL_ALIGN
+ * @param elem_size Size of the elements stored in each block (bytes)
+ * @param block_num Number of blocks (up to MEM_POOL_MAX_BLOCKS)
+ * @return true     Pool initialized
+ * @return false    Invalid parameters
+ */
+bool MemPoolInit(mem_pool_t *pool, void *storage, uint32_t elem_size, uint16_t block_num);
+
+/**
+ * @brief Take a block from a pool (from any task or ISR)
+ *
+ * @param pool Pointer to pool structure
+ * @return Pointer to the block, or NULL if the pool is empty
+ */
+void *MemPoolAlloc(mem_pool_t *pool);
+
+/**
+ * @brief Return a block to its pool (from any task or ISR)
+ *
+ * @param pool Pointer to pool structure
+ * @param block Block returned by MemPoolAlloc
+ * @return true     Block returned
+ * @return false    The block doesn't belong to the pool
+ */
+bool MemPoolFree(mem_pool_t *pool, void *block);
+
+/**
+ * @brief Usage statistics of a pool
+ *
+ * @param pool Pointer to pool structure
+ * @param stats Statistics
+ */
+void MemPoolGetStats(const mem_pool_t *pool, mem_pool_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MEM_POOL_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,210 @@
+#ifndef METRICS_MCU_H
+#define METRICS_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup METRICS Metrics registry
+ ** @{ */
+
+/** \brief Registry of runtime metrics: counters, gauges and histograms.
+ *
+ * Metrics are defined at file scope with the METRIC_*_DEFINE macros (static
+ * storage, histograms with fixed bucket bounds), registered once with
+ * MetricsRegister and updated with the inline functions below. Each update is
+ * a single atomic operation on a 32 bits word (two for a histogram: bucket and
+ * sum), without locks, so they can be called from ISRs and tasks at the same
+ * time (they are inlined: from an ISR in IRAM the metric must be in RAM, as
+ * the static storage of the macros is).
+ *
+ * @code
+ * METRIC_COUNTER_DEFINE(metric_drops, "adc_drops");
+ * METRIC_HISTOGRAM_DEFINE(metric_latency, "latency_us", 500, 1000, 2000, 5000);
+ * ...
+ * MetricsRegister(&metric_drops);
+ * MetricsRegister(&metric_latency);
+ * ...
+ * MetricsCount(&metric_drops, 1);
+ * MetricsObserve(&metric_latency, t_dac - t_onset);
+ * @endcode
+ *
+ * | Kind      | Values of the snapshot                                          |
+ * |:----------|:----------------------------------------------------------------|
+ * | Counter   | Count                                                           |
+ * | Gauge     | Last value, max value                                           |
+ * | Histogram | Count of each bucket (value <= bound, the last one over all), sum |
+ *
+ * MetricsDump sends all the values as one binary snapshot through a write
+ * function given by the application (i.e. to UART), and MetricsSnapshot
+ * builds it in a buffer (i.e. to be sent by BLE):
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 4          | "MET" and version (METRICS_VERSION)                    |
+ * | 4          | Time of the snapshot (ms since boot)                   |
+ * | 1          | Number of metrics n                                    |
+ * | 2 + 4 * k  | n times: kind, number of values k and the values       |
+ * | 2          | CRC16-CCITT (0x1021, init 0xFFFF) of the previous bytes|
+ *
+ * Values are little endian, metrics in order of registration. Names and
+ * bucket bounds are not sent: MetricsDescribe lists them as text, and the host
+ * side decoder, tools/metrics_decoder.py of the middleware, names the metrics
+ * with them.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_attr.h"
+/*==================[macros]=================================================*/
+#define METRICS_VERSION		1		/*!< Version of the snapshot format */
+#define METRICS_MAX			32		/*!< Max number of registered metrics */
+#define METRICS_MAX_BUCKETS	16		/*!< Max bounds of a histogram */
+
+/** Counter (only goes up, until MetricsReset) */
+#define METRIC_COUNTER_DEFINE(id, name)									\
+	static uint32_t id##_values[1];										\
+	static metric_t id = {name, METRIC_COUNTER, 0, NULL, id##_values}
+/** Gauge (last value and max) */
+#define METRIC_GAUGE_DEFINE(id, name)									\
+	static uint32_t id##_values[2];										\
+	static metric_t id = {name, METRIC_GAUGE, 0, NULL, id##_values}
+/** Histogram with the upper bounds of its buckets (ascending, up to METRICS_MAX_BUCKETS) */
+#define METRIC_HISTOGRAM_DEFINE(id, name, ...)							\
+	static const uint32_t id##_bounds[] = {__VA_ARGS__};				\
+	static uint32_t id##_values[sizeof(id##_bounds) / sizeof(uint32_t) + 2];	\
+	static metric_t id = {name, METRIC_HISTOGRAM, sizeof(id##_bounds) / sizeof(uint32_t), id##_bounds, id##_values}
+/*==================[typedef]================================================*/
+/**
+ * @brief Kinds of metrics
+ */
+typedef enum {
+	METRIC_COUNTER,				/*!< Count of events */
+	METRIC_GAUGE,				/*!< Level (last value and max) */
+	METRIC_HISTOGRAM			/*!< Distribution of a value in fixed buckets */
+} metric_kind_t;
+
+/**
+ * @brief Metric (defined with the METRIC_*_DEFINE macros)
+ */
+typedef struct {
+	const char *name;			/*!< Name (for MetricsDescribe) */
+	uint8_t kind;				/*!< Kind of metric (metric_kind_t) */
+	uint8_t buckets;			/*!< Bounds of a histogram */
+	const uint32_t *bounds;		/*!< Upper bound of each bucket of a histogram */
+	uint32_t *values;			/*!< Values (see the snapshot table) */
+} metric_t;
+
+/**
+ * @brief Function that sends a part of the snapshot (i.e. UartWrite to a port)
+ */
+typedef void (*metrics_write_t)(const void *data, uint32_t lenght);
+
+/**
+ * @brief Function that sends a line of the description (i.e. UartSendString to a port)
+ */
+typedef void (*metrics_print_t)(const char *line);
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Add n events to a counter (from ISRs or tasks)
+ *
+ * @param metric Counter
+ * @param n Events
+ */
+FORCE_INLINE_ATTR void MetricsCount(metric_t *metric, uint32_t n){
+	__atomic_fetch_add(&metric->values[0], n, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Set the value of a gauge and keep its max (from ISRs or tasks)
+ *
+ * @param metric Gauge
+ * @param value Value
+ */
+FORCE_INLINE_ATTR void MetricsSet(metric_t *metric, uint32_t value){
+	__atomic_store_n(&metric->values[0], value, __ATOMIC_RELAXED);
+	uint32_t max = __atomic_load_n(&metric->values[1], __ATOMIC_RELAXED);
+	// only when the max is beaten (rare): retried if another update got in between
+	while(value > max && !__atomic_compare_exchange_n(&metric->values[1], &max, value, true,
+													  __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+	}
+}
+
+/**
+ * @brief Add a value to a histogram (from ISRs or tasks)
+ *
+ * @param metric Histogram
+ * @param value Value
+ */
+FORCE_INLINE_ATTR void MetricsObserve(metric_t *metric, uint32_t value){
+	uint8_t bucket = 0;
+	while(bucket < metric->buckets && value > metric->bounds[bucket]){
+		bucket++;
+	}
+	__atomic_fetch_add(&metric->values[bucket], 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&metric->values[metric->buckets + 1], value, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Add a metric to the registry (once, before its first snapshot)
+ *
+ * @param metric Metric (defined with a METRIC_*_DEFINE macro)
+ * @return true     Metric registered
+ * @return false    Registry full (METRICS_MAX), metric already registered or too many buckets
+ */
+bool MetricsRegister(metric_t *metric);
+
+/**
+ * @brief Clear the counters and histograms, and the max of the gauges (to their last value)
+ */
+void MetricsReset(void);
+
+/**
+ * @brief Bytes of a snapshot of the registered metrics
+ *
+ * @return Bytes
+ */
+uint32_t MetricsSnapshotSize(void);
+
+/**
+ * @brief Build a snapshot of the registered metrics in a buffer (see the format above)
+ *
+ * @param buffer Buffer
+ * @param size Bytes of the buffer
+ * @return Bytes of the snapshot (0 if it does not fit)
+ */
+uint32_t MetricsSnapshot(uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Send a snapshot of the registered metrics (see the format above)
+ *
+ * @param write_p Function that sends each part of the snapshot
+ */
+void MetricsDump(metrics_write_t write_p);
+
+/**
+ * @brief Send a description of the registered metrics, one text line each ("index kind name [bounds]")
+ *
+ * @param print_p Function that sends each line
+ */
+void MetricsDescribe(metrics_print_t print_p);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* METRICS_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,87 @@
+#ifndef NVS_MCU_H
+#define NVS_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup NVS Non volatile storage
+ ** @{ */
+
+/** \brief Non volatile storage driver for the ESP-EDU Board.
+ *
+ * Stores small blobs (settings, calibrations) by key in the NVS partition of
+ * the flash, so they survive resets and reflashing of the application. All
+ * the keys of the drivers and projects share the NVS_NAMESPACE namespace.
+ *
+ * @note Writing erases flash pages and stalls the CPU cache for a few ms: write
+ * from a low priority task, never from the sample path.
+ *
+ * @note The BLE driver also initializes the NVS partition (NvsInit() can be
+ * called before or after BleInit()).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define NVS_NAMESPACE		"drivers"	/*!< Namespace of the keys */
+#define NVS_MAX_KEY			15			/*!< Max characters of a key */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize the NVS partition (erased if it is full or has another layout)
+ *
+ * @return true     NVS ready
+ * @return false    NVS partition not found
+ */
+bool NvsInit(void);
+
+/**
+ * @brief Read a blob
+ *
+ * @param key       Key of the blob (up to NVS_MAX_KEY characters)
+ * @param data      Buffer for the blob
+ * @param lenght    Size of data, updated with the bytes of the blob
+ * @return true     Blob read
+ * @return false    Key not found, or blob larger than data
+ */
+bool NvsRead(const char *key, void *data, uint32_t *lenght);
+
+/**
+ * @brief Write a blob (replaces the previous blob of the key)
+ *
+ * @param key       Key of the blob (up to NVS_MAX_KEY characters)
+ * @param data      Blob
+ * @param lenght    Bytes of the blob
+ * @return true     Blob written
+ * @return false    NVS full or not initialized
+ */
+bool NvsWrite(const char *key, const void *data, uint32_t lenght);
+
+/**
+ * @brief Erase a blob
+ *
+ * @param key       Key of the blob
+ * @return true     Blob erased (or not found)
+ * @return false    NVS not initialized
+ */
+bool NvsErase(const char *key);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* NVS_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,144 @@
+#ifndef POWER_MCU_H
+#define POWER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup POWER Power management
+ ** @{ */
+
+/** \brief Dynamic frequency scaling and automatic light sleep.
+ *
+ * PowerInit configures esp_pm: the CPU runs at min_freq_mhz and, with
+ * light_sleep, the chip sleeps whenever all the tasks are blocked (tickless
+ * idle) until the next FreeRTOS timeout, esp_timer alarm or wake up pin.
+ * Sensors with FIFO read in batches (i.e. from the sensor hub) spend most of
+ * the time asleep.
+ *
+ * The code that needs the chip awake and fast holds a lock:
+ *
+ * - POWER_LOCK_BUS: I2C / SPI transfers (APB at max frequency, no light
+ *   sleep, so the bus clocks don't change in the middle of a transfer). The
+ *   sensor hub holds it while it reads a group of sensors and MAX3010X while
+ *   it drains the FIFO.
+ * - POWER_LOCK_DSP: processing bursts (CPU at max frequency).
+ *
+ * @code
+ * PowerAcquire(POWER_LOCK_DSP);
+ * FFTMagnitude(signal, spectrum, 512);
+ * PowerRelease(POWER_LOCK_DSP);
+ * @endcode
+ *
+ * Locks are counted (acquired n times, released n times) and are only used
+ * from tasks. The time each one was held is kept to estimate the consumption
+ * (PowerGetStats).
+ *
+ * Edge interrupts of the GPIOs don't wake up the chip: PowerWakeOnGpio makes
+ * a pin wake it up while it is at a level, as the INT pin of the MAX3010X
+ * (low until its status is read). The pin interrupt becomes level triggered,
+ * so its ISR must disable it (gpio_intr_disable) until the source is cleared.
+ *
+ * @note Needs CONFIG_DRIVERS_POWER_MANAGEMENT (menuconfig: ESP-EDU drivers),
+ * that enables esp_pm and the tickless idle. Without it the functions do
+ * nothing and drivers can call them anyway.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Power management locks
+ */
+typedef enum {
+	POWER_LOCK_BUS = 0,		/*!< Bus transfers: APB at max frequency, no light sleep */
+	POWER_LOCK_DSP,			/*!< Processing: CPU at max frequency */
+	POWER_LOCKS				/*!< Number of locks */
+} power_lock_t;
+
+/**
+ * @brief Power management mode
+ */
+typedef struct {
+	uint16_t max_freq_mhz;	/*!< CPU frequency with a lock held (MHz, 0: CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ) */
+	uint16_t min_freq_mhz;	/*!< CPU frequency when no lock is held (MHz, 0: 40, the XTAL frequency) */
+	bool light_sleep;		/*!< Automatic light sleep when all the tasks are blocked */
+} power_config_t;
+
+/**
+ * @brief Time the locks were held since PowerInit
+ */
+typedef struct {
+	uint64_t time_us;					/*!< Time since PowerInit (us) */
+	uint64_t active_us;					/*!< Time with at least one lock held (us) */
+	uint64_t lock_us[POWER_LOCKS];		/*!< Time each lock was held (us) */
+} power_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+#if CONFIG_DRIVERS_POWER_MANAGEMENT
+/**
+ * @brief Configure the frequency scaling and light sleep (can be called again to change the mode).
+ *
+ * @param config Mode (NULL: max and min at CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, no light sleep)
+ * @return true if esp_pm accepted the mode
+ */
+bool PowerInit(const power_config_t *config);
+
+/**
+ * @brief Acquire a lock (the chip is kept awake and fast until it's released).
+ *
+ * @param lock Lock
+ */
+void PowerAcquire(power_lock_t lock);
+
+/**
+ * @brief Release a lock.
+ *
+ * @param lock Lock
+ */
+void PowerRelease(power_lock_t lock);
+
+/**
+ * @brief Wake up from light sleep while a pin is at a level.
+ *
+ * @param pin GPIO (already initialized as input)
+ * @param level Level that wakes up the chip
+ * @return true if the wake up was enabled
+ */
+bool PowerWakeOnGpio(gpio_t pin, bool level);
+
+/**
+ * @brief Time the locks were held since PowerInit.
+ *
+ * @param stats Statistics
+ */
+void PowerGetStats(power_stats_t *stats);
+#else
+static inline bool PowerInit(const power_config_t *config){ return false; }
+static inline void PowerAcquire(power_lock_t lock){}
+static inline void PowerRelease(power_lock_t lock){}
+static inline bool PowerWakeOnGpio(gpio_t pin, bool level){ return false; }
+static inline void PowerGetStats(power_stats_t *stats){ *stats = (power_stats_t){0}; }
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POWER_MCU_H */
+
+/*==================[end of file]============================================*/
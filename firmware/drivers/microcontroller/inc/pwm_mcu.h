@@ -14,6 +14,11 @@
  * @note It can setup up to 4 PWM outputs, with independet duty 
  * cycle and frequency configuration
  *
+ * @note Besides the duty cycle in %, the duty can be set in counts (up to
+ * PWMGetDutyMax, with the resolution chosen in PWMInitResolution), ramped by
+ * the LEDC hardware fade (PWMFade) or changed on several outputs at once
+ * (PWMSetDutyMulti, PWMSync to align their periods).
+ *
  * @author Albano Peñalva
  * 
  * @section changelog
@@ -21,11 +26,13 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 23/01/2024 | Document creation		                         |
+ * | 14/10/2026 | Duty resolution, hardware fade and multi output updates |
  *
  */
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
 
@@ -52,6 +59,19 @@ typedef enum pwm_out {
  */
 uint8_t PWMInit(pwm_out_t out, gpio_t gpio, uint16_t freq);
 
+/**
+ * @brief Single PWM output inicialization with a given duty resolution
+ * 
+ * @note The resolution is limited by the frequency: 80 MHz / 2^resolution >= freq.
+ * 
+ * @param out PWM output
+ * @param gpio GPIO pin number
+ * @param freq PWM wave frequency
+ * @param resolution Duty resolution in bits (1 to 20, 0: highest for the frequency)
+ * @return uint8_t 0 if the output was configured
+ */
+uint8_t PWMInitResolution(pwm_out_t out, gpio_t gpio, uint32_t freq, uint8_t resolution);
+
 /**
  * @brief Resume PWM output
  * 
@@ -74,6 +94,60 @@ void PWMOff(pwm_out_t out);
  */
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle);
 
+/**
+ * @brief Change PWM duty of an PWM output in counts
+ * 
+ * @param out PWM output 
+ * @param duty Duty in counts (0 to PWMGetDutyMax)
+ */
+void PWMSetDuty(pwm_out_t out, uint32_t duty);
+
+/**
+ * @brief Duty counts of 100% of an PWM output (depends on its resolution)
+ * 
+ * @param out PWM output 
+ * @return uint32_t 2^resolution - 1
+ */
+uint32_t PWMGetDutyMax(pwm_out_t out);
+
+/**
+ * @brief Change the duty of several PWM outputs at once
+ * 
+ * @note The updates are latched back to back, each output changes at the end
+ * of its current period (at the same time if they are synchronized).
+ * 
+ * @param outs PWM outputs
+ * @param duties Duty of each output in counts
+ * @param lenght Number of outputs
+ */
+void PWMSetDutyMulti(const pwm_out_t *outs, const uint32_t *duties, uint8_t lenght);
+
+/**
+ * @brief Restart the periods of several PWM outputs at once (same phase)
+ * 
+ * @param outs PWM outputs
+ * @param lenght Number of outputs
+ */
+void PWMSync(const pwm_out_t *outs, uint8_t lenght);
+
+/**
+ * @brief Ramp the duty of an PWM output in hardware
+ * 
+ * @param out PWM output 
+ * @param duty Final duty in counts
+ * @param time_ms Ramp duration (ms)
+ * @param wait true: return at the end of the ramp - false: return immediately
+ * @return true The ramp started
+ */
+bool PWMFade(pwm_out_t out, uint32_t duty, uint32_t time_ms, bool wait);
+
+/**
+ * @brief Stop the ramp of an PWM output (the duty stays at its current value)
+ * 
+ * @param out PWM output 
+ */
+void PWMFadeStop(pwm_out_t out);
+
 /**
  * @brief Change frequency of an PWM output
  * 
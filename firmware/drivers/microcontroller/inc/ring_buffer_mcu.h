@@ -0,0 +1,187 @@
+#ifndef RING_BUFFER_MCU_H
+#define RING_BUFFER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Ring_Buffer Ring Buffer
+ ** @{ */
+
+/** \brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * This driver provide a ring buffer of fixed size elements to move data from an ISR
+ * (producer) to a task (consumer) without critical sections. The producer functions
+ * are placed in IRAM, so they can be called from IRAM safe ISRs. The consumer can also
+ * be an ISR (i.e. a timer that outputs one element per period): RingBufferPop,
+ * RingBufferRead, RingBufferPeek, RingBufferCount and RingBufferFree are placed in IRAM too.
+ *
+ * The consumer task can be notified when the number of stored elements reaches a
+ * watermark, so it wakes up once per batch instead of once per element.
+ *
+ * @note Only one producer and one consumer are allowed for each ring buffer.
+ *
+ * @note The number of elements must be a power of two. Storage is provided by the user
+ * (no heap is used).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 14/10/2026 | Consumer functions in IRAM	                         					|
+ * | 15/10/2026 | RingBufferPeek			                         					|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros]=================================================*/
+#define RING_BUFFER_ALIGN	32		/*!< Alignment of producer and consumer indexes */
+/*==================[typedef]================================================*/
+/**
+ * @brief Ring buffer structure
+ *
+ * @note Producer and consumer indexes are placed in different cache lines.
+ */
+typedef struct {
+	volatile uint32_t head __attribute__((aligned(RING_BUFFER_ALIGN)));	/*!< Write index (only modified by producer) */
+	volatile uint32_t tail __attribute__((aligned(RING_BUFFER_ALIGN)));	/*!< Read index (only modified by consumer) */
+	uint8_t *storage;			/*!< Elements storage (elem_size * elem_num bytes) */
+	uint32_t elem_size;			/*!< Size of each element (in bytes) */
+	uint32_t mask;				/*!< elem_num - 1 */
+	uint32_t watermark;			/*!< Number of elements that wakes up the consumer (0: disabled) */
+	TaskHandle_t consumer;		/*!< Task to notify when watermark is reached */
+	volatile uint32_t overflows;/*!< Number of elements dropped because the buffer was full */
+} ring_buffer_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Ring buffer initialization
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param storage Array to store elements (of elem_size * elem_num bytes)
+ * @param elem_size Size of each element (in bytes)
+ * @param elem_num Number of elements (must be a power of two)
+ * @return true     Ring buffer initialized
+ * @return false    elem_num is not a power of two
+ */
+bool RingBufferInit(ring_buffer_t *rb, void *storage, uint32_t elem_size, uint32_t elem_num);
+
+/**
+ * @brief Set the task to be notified when the buffer reaches a number of elements
+ *
+ * The task is notified (as with vTaskNotifyGiveFromISR) by RingBufferPushFromISR
+ * and RingBufferWriteFromISR when the stored elements get to the watermark.
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param consumer Task handle of the consumer
+ * @param watermark Number of elements (0 to disable notifications)
+ */
+void RingBufferSetWatermark(ring_buffer_t *rb, TaskHandle_t consumer, uint32_t watermark);
+
+/**
+ * @brief Store one element (producer side)
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elem Pointer to element to be stored
+ * @return true     Element stored
+ * @return false    Buffer full (element dropped)
+ */
+bool RingBufferPush(ring_buffer_t *rb, const void *elem);
+
+/**
+ * @brief Store one element from an ISR and notify the consumer at the watermark
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elem Pointer to element to be stored
+ * @param task_woken Set to pdTRUE if the consumer must run (can be NULL)
+ * @return true     Element stored
+ * @return false    Buffer full (element dropped)
+ */
+bool RingBufferPushFromISR(ring_buffer_t *rb, const void *elem, BaseType_t *task_woken);
+
+/**
+ * @brief Store multiple elements (producer side)
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elems Array of elements to be stored
+ * @param n Number of elements
+ * @return Number of elements stored
+ */
+uint32_t RingBufferWrite(ring_buffer_t *rb, const void *elems, uint32_t n);
+
+/**
+ * @brief Store multiple elements from an ISR and notify the consumer at the watermark
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elems Array of elements to be stored
+ * @param n Number of elements
+ * @param task_woken Set to pdTRUE if the consumer must run (can be NULL)
+ * @return Number of elements stored
+ */
+uint32_t RingBufferWriteFromISR(ring_buffer_t *rb, const void *elems, uint32_t n, BaseType_t *task_woken);
+
+/**
+ * @brief Take one element (consumer side)
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elem Pointer to variable where element will be stored
+ * @return true     Element read
+ * @return false    Buffer empty
+ */
+bool RingBufferPop(ring_buffer_t *rb, void *elem);
+
+/**
+ * @brief Take multiple elements (consumer side)
+ *
+ * @param rb Pointer to ring buffer structure
+ * @param elems Array where elements will be stored
+ * @param n Max number of elements to read
+ * @return Number of elements read
+ */
+uint32_t RingBufferRead(ring_buffer_t *rb, void *elems, uint32_t n);
+
+/**
+ * @brief Copy the oldest elements without taking them (consumer side)
+ * @param rb Pointer to ring buffer structure
+ * @param elems Array where elements will be copied
+ * @param n Max number of elements to copy
+ * @return Number of elements copied
+ */
+uint32_t RingBufferPeek(ring_buffer_t *rb, void *elems, uint32_t n);
+
+/**
+ * @brief Number of elements stored
+ *
+ * @param rb Pointer to ring buffer structure
+ * @return Number of elements
+ */
+uint32_t RingBufferCount(ring_buffer_t *rb);
+
+/**
+ * @brief Number of free elements
+ *
+ * @param rb Pointer to ring buffer structure
+ * @return Number of elements
+ */
+uint32_t RingBufferFree(ring_buffer_t *rb);
+
+/**
+ * @brief Discard all stored elements (consumer side)
+ *
+ * @param rb Pointer to ring buffer structure
+ */
+void RingBufferFlush(ring_buffer_t *rb);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RING_BUFFER_MCU_H */
+
+/*==================[end of file]============================================*/
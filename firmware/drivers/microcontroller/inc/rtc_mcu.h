@@ -26,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Calendar time anchored to the monotonic time base (time_mcu.h)		|
  * 
  **/
 
@@ -72,6 +73,25 @@ bool RtcConfig(rtc_t * rtc);
  */
 void RtcRead(rtc_t * rtc);
 
+/**
+ * @brief Converts a timestamp of the monotonic time base to date and time.
+ * 
+ * @note RtcConfig anchors the calendar to the monotonic clock, so timestamps 
+ * taken by the drivers (TimeNowUs) are converted without reading the RTC again.
+ * 
+ * @param time_us   Timestamp (in us since boot, from TimeNowUs).
+ * @param rtc       Pointer to structure to store date and time.
+ */
+void RtcFromTimestamp(uint64_t time_us, rtc_t * rtc);
+
+/**
+ * @brief Converts a timestamp of the monotonic time base to calendar time.
+ * 
+ * @param time_us   Timestamp (in us since boot, from TimeNowUs).
+ * @return int64_t  Calendar time (in us since the epoch, 0 at boot if RtcConfig wasn't called).
+ */
+int64_t RtcTimestampToEpochUs(uint64_t time_us);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
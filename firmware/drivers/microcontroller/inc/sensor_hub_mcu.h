@@ -0,0 +1,176 @@
+#ifndef SENSOR_HUB_MCU_H
+#define SENSOR_HUB_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup SENSOR_HUB Sensor hub
+ ** @{ */
+
+/** \brief Periodic reads of several sensors from a single task.
+ *
+ * Instead of one task and one timer per sensor, each sensor registers its
+ * period, the bus it uses and a batch read function (i.e. one that drains the
+ * sensor FIFO or reads all its registers in one burst). One high priority task
+ * calls the read functions:
+ *
+ * - Earliest deadline first: a sensor is released every period and its
+ *   deadline is the next release. Among the released sensors the one with the
+ *   earliest deadline is read first.
+ * - Sensors released within coalesce_us of each other are read in the same
+ *   wake up, and all the ones that use the same bus are read back to back: the
+ *   bus lock function (i.e. SpiAcquire / SpiRelease) is called once per group
+ *   and the bus is busy in bursts, not spread over the whole period.
+ * - A one shot esp_timer wakes the task at the next release, so the task
+ *   doesn't run when no sensor is due.
+ *
+ * @code
+ * static void ReadImu(void *param){
+ *     MPU6050_readFIFOStream(&imu_ring);
+ * }
+ * static void ReadPpg(void *param){
+ *     MAX3010X_readBatch(red, ir, MAX3010X_FIFO_DEPTH);
+ * }
+ * ...
+ * sensor_hub_sensor_t imu = {.name = "imu", .bus = SENSOR_HUB_BUS_I2C, .period_us = 10000, .read_p = ReadImu};
+ * sensor_hub_sensor_t ppg = {.name = "ppg", .bus = SENSOR_HUB_BUS_I2C, .period_us = 40000, .read_p = ReadPpg};
+ * SensorHubInit(0, 0);
+ * SensorHubAdd(&imu);
+ * SensorHubAdd(&ppg);
+ * SensorHubStart();
+ * @endcode
+ *
+ * Read functions run in the hub task: they must not block for long (a read
+ * that takes longer than the period of another sensor makes it miss its
+ * deadline, counted in sensor_hub_stats_t). SensorHubBusLoad gives the share
+ * of time each bus was used by the hub, to check the bus utilization.
+ *
+ * @note With CONFIG_DRIVERS_POWER_MANAGEMENT each group of reads holds
+ * POWER_LOCK_BUS (power_mcu.h), and the chip can sleep between releases.
+ *
+ * @note With CONFIG_DRIVERS_TRACE each read is traced as TRACE_SENSOR_READ
+ * (arg: sensor id).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define SENSOR_HUB_MAX_SENSORS		8		/*!< Max sensors registered */
+#define SENSOR_HUB_COALESCE_US		1000	/*!< Default coalescing window (us) */
+#define SENSOR_HUB_TASK_PRIO		10		/*!< Default hub task priority */
+/*==================[typedef]================================================*/
+/**
+ * @brief Bus used by a sensor
+ */
+typedef enum {
+	SENSOR_HUB_BUS_I2C = 0,		/*!< I2C (MAX3010X, MPU6050) */
+	SENSOR_HUB_BUS_SPI,			/*!< SPI */
+	SENSOR_HUB_BUS_ADC,			/*!< ADC (Si7007, ADXL335) */
+	SENSOR_HUB_BUS_GPIO,		/*!< Bit banged GPIO (HX711) */
+	SENSOR_HUB_BUSES			/*!< Number of buses */
+} sensor_hub_bus_t;
+
+/**
+ * @brief Batch read function of a sensor
+ */
+typedef void (*sensor_hub_read_t)(void *param);
+
+/**
+ * @brief Bus lock function (lock true before a group of reads, false after it)
+ */
+typedef void (*sensor_hub_lock_t)(bool lock);
+
+/**
+ * @brief Sensor registered in the hub
+ */
+typedef struct {
+	const char *name;			/*!< Sensor name */
+	sensor_hub_bus_t bus;		/*!< Bus used by the read function */
+	uint32_t period_us;			/*!< Read period (us) */
+	sensor_hub_read_t read_p;	/*!< Batch read function */
+	void *param;				/*!< Parameter of the read function */
+} sensor_hub_sensor_t;
+
+/**
+ * @brief Statistics of a sensor since SensorHubStart
+ */
+typedef struct {
+	uint32_t reads;				/*!< Reads done */
+	uint32_t misses;			/*!< Deadlines missed (read after the next release, or periods skipped) */
+	uint32_t max_late_us;		/*!< Max delay from the release to the start of the read (us) */
+	uint32_t max_read_us;		/*!< Max duration of the read function (us) */
+} sensor_hub_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Create the hub task (stopped, with no sensors).
+ *
+ * @param priority Hub task priority (0: SENSOR_HUB_TASK_PRIO)
+ * @param coalesce_us Sensors released within this time are read together (0: SENSOR_HUB_COALESCE_US)
+ * @return true if the task was created
+ */
+bool SensorHubInit(uint8_t priority, uint32_t coalesce_us);
+
+/**
+ * @brief Register a sensor (only while the hub is stopped).
+ *
+ * @param sensor Sensor (copied)
+ * @return int8_t Sensor id, or -1 if the hub is full, running or the sensor isn't valid
+ */
+int8_t SensorHubAdd(const sensor_hub_sensor_t *sensor);
+
+/**
+ * @brief Set the function that locks a bus around each group of reads.
+ *
+ * @param bus Bus
+ * @param lock_p Lock function (NULL: none)
+ */
+void SensorHubSetBusLock(sensor_hub_bus_t bus, sensor_hub_lock_t lock_p);
+
+/**
+ * @brief Start reading the sensors (all of them are released at once) and clear the statistics.
+ *
+ * @return true if the hub was started
+ */
+bool SensorHubStart(void);
+
+/**
+ * @brief Stop reading the sensors (the read in progress is completed).
+ */
+void SensorHubStop(void);
+
+/**
+ * @brief Statistics of a sensor.
+ *
+ * @param id Sensor id (returned by SensorHubAdd)
+ * @param stats Statistics
+ * @return true if the id is valid
+ */
+bool SensorHubGetStats(int8_t id, sensor_hub_stats_t *stats);
+
+/**
+ * @brief Share of time a bus was used by the hub since SensorHubStart.
+ *
+ * @param bus Bus
+ * @return uint16_t Bus load (in 0.1 %)
+ */
+uint16_t SensorHubBusLoad(sensor_hub_bus_t bus);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SENSOR_HUB_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,24 @@
  * 
  * @note MISO: GPIO_22, MOSI: GPIO_21, SCLK: GPIO_20, CS1: GPIO_19, CS2: GPIO_18, CS3: GPIO_9
  * 
+ * @note Besides the blocking functions, transactions can be queued with SpiQueue (up to
+ * SPI_QUEUE_SIZE per device) and are transferred by DMA while the caller keeps working.
+ * The caller owns the spi_trans_t pool: a transaction and its buffers must not be modified
+ * until SpiGetResult returns it. Results are returned in order and every queued transaction
+ * must be retrieved. Buffers must be in internal RAM (DMA capable, not const data in flash).
+ * Don't use the blocking functions on a device with queued transactions pending.
+ * 
+ * @note SpiInit adds each device to the bus only once (again only if its configuration
+ * changes), so drivers can call it before every access. For a burst of short transactions
+ * (i.e. command + data of a display) the bus can be held with SpiAcquire / SpiRelease.
+ * 
+ * @note Bus arbitration: each device has a priority and a max burst. A device of lower
+ * priority than another device of the bus doesn't hold it (SpiAcquire only marks the
+ * burst), so the transactions of the higher priority one (i.e. the RFID reader polling)
+ * go between its transactions instead of waiting a whole display flush. Drivers split
+ * long DMA transfers in transactions of SpiGetMaxBurst bytes: a high priority transaction
+ * waits at most one of them. Devices of equal priority hold the bus as usual.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,12 +39,19 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 14/10/2026 | Queued DMA transactions with completion callbacks						|
+ * | 14/10/2026 | Devices added once, bus acquisition and pre-transfer callbacks		|
+ * | 15/10/2026 | Bus arbitration with device priority and max burst					|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_SIZE		8			/*!< Transactions that can be queued on each device */
+#define SPI_WAIT_FOREVER	0xFFFFFFFF	/*!< SpiGetResult timeout to wait without limit */
+#define SPI_TRANS_PRIV_SIZE	8			/*!< Driver data of each transaction (64 bits words) */
+#define SPI_MAX_BURST		4092		/*!< Max bytes of a DMA transaction (bus max transfer size) */
 
 /*==================[typedef]================================================*/
 
@@ -58,6 +83,15 @@ typedef enum {
 	SPI_INTERRUPT,		/*!< Interrupción */
 } transfer_mode_t;
 
+/**
+ * @brief Bus priority of a device
+ */
+typedef enum {
+	SPI_PRIORITY_LOW = -1,		/*!< Doesn't hold the bus if a device of higher priority is added (i.e. a display) */
+	SPI_PRIORITY_NORMAL = 0,	/*!< Default */
+	SPI_PRIORITY_HIGH = 1,		/*!< Short latency sensitive transactions (i.e. RFID reader) */
+} spi_priority_t;
+
 /**
  * @brief SPI configuration structure
  */
@@ -66,9 +100,24 @@ typedef struct{
 	clk_mode_t clk_mode;			/*!< Mode: phase and polarity */
 	uint32_t bitrate;				/*!< Transfer speed (up to 26MHz) */
 	transfer_mode_t transfer_mode;	/*!< Transfer mode */
-	void *func_p;					/*!< Pointer to callback function for transaction end */
+	void *func_p;					/*!< Pointer to callback function for transaction end (SPI_INTERRUPT mode and queued transactions without own callback) */
 	void *param_p;					/*!< Pointer to callback parameter */
+	spi_priority_t priority;		/*!< Bus priority (default SPI_PRIORITY_NORMAL) */
+	uint32_t max_burst;				/*!< Max bytes of each DMA transaction of long transfers (0: SPI_MAX_BURST) */
 } spi_mcu_config_t;
+
+/**
+ * @brief Queued SPI transaction (owned by the caller)
+ */
+typedef struct{
+	uint8_t *tx_buffer;				/*!< Data to write (NULL: only read) */
+	uint8_t *rx_buffer;				/*!< Buffer for the data read (NULL: only write) */
+	uint32_t lenght;				/*!< Bytes to transfer */
+	void (*pre_func_p)(void*);		/*!< Callback before the transaction starts, i.e. to set a D/C pin (NULL if not required) */
+	void (*func_p)(void*);			/*!< Callback at the end of the transaction, called from an ISR (NULL: device callback) */
+	void *param_p;					/*!< Pointer to callback parameter */
+	uint64_t priv[SPI_TRANS_PRIV_SIZE];	/*!< Driver data (don't modify) */
+} spi_trans_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -108,6 +157,60 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Transfer a transaction, waiting for it to finish (polling)
+ * 
+ * @note Lowest latency for short transactions, specially with the bus acquired.
+ * 
+ * @param device SPI device
+ * @param trans Transaction (its callbacks are called)
+ */
+void SpiTransmit(spi_dev_t device, spi_trans_t * trans);
+
+/**
+ * @brief Queue a transaction to be transferred by DMA, without waiting
+ * 
+ * @param device SPI device
+ * @param trans Transaction (not modified until it's returned by SpiGetResult)
+ * @return true     Transaction queued
+ * @return false    Queue full (SPI_QUEUE_SIZE transactions pending)
+ */
+bool SpiQueue(spi_dev_t device, spi_trans_t * trans);
+
+/**
+ * @brief Wait for the oldest queued transaction of a device to finish
+ * 
+ * @param device SPI device
+ * @param timeout_ms Max time to wait (SPI_WAIT_FOREVER: no limit, 0: don't wait)
+ * @return spi_trans_t* Finished transaction (NULL if timeout)
+ */
+spi_trans_t * SpiGetResult(spi_dev_t device, uint32_t timeout_ms);
+
+/**
+ * @brief Hold the bus for a device, until SpiRelease (other devices wait)
+ * 
+ * @note If another device of the bus has higher priority the bus is not held: its
+ * transactions can go between the ones of this device.
+ * 
+ * @param device SPI device
+ */
+void SpiAcquire(spi_dev_t device);
+
+/**
+ * @brief Release the bus held with SpiAcquire
+ * 
+ * @param device SPI device
+ */
+void SpiRelease(spi_dev_t device);
+
+/**
+ * @brief Max bytes of each DMA transaction of a device, to split long transfers
+ * 
+ * @param device SPI device
+ * @return uint32_t Max burst (multiple of 4 bytes, up to SPI_MAX_BURST)
+ */
+uint32_t SpiGetMaxBurst(spi_dev_t device);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
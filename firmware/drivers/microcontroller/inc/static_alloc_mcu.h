@@ -0,0 +1,138 @@
+#ifndef STATIC_ALLOC_MCU_H
+#define STATIC_ALLOC_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup STATIC_ALLOC Static allocation
+ ** @{ */
+
+/** \brief Allocation of the FreeRTOS objects of the drivers.
+ *
+ * Drivers declare their tasks, queues and semaphores with the *_DEFINE macros
+ * (at file scope) and create them with the *_CREATE macros. With
+ * CONFIG_DRIVERS_STATIC_ALLOCATION (menuconfig: ESP-EDU drivers) the objects
+ * and task stacks are static buffers and the xxxCreateStatic functions are
+ * used: the heap isn't used when drivers are initialized and the RAM used is
+ * known at link time. Otherwise the objects are allocated from the heap.
+ *
+ * @note Each defined object can be created only once (the buffers are reused).
+ * The *S_DEFINE and *_CREATE_N macros define arrays of objects (i.e. one per
+ * port or bus) created by index.
+ *
+ * @note Stack sizes of the driver tasks are set in menuconfig too.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+/*==================[macros]=================================================*/
+#if CONFIG_DRIVERS_STATIC_ALLOCATION
+/** Task of the static allocation mode */
+#define STATIC_TASK_DEFINE(id, stack)					\
+	static StackType_t id##_stack[stack];				\
+	static StaticTask_t id##_tcb
+/** Create a task defined with STATIC_TASK_DEFINE (pdPASS if created) */
+#define STATIC_TASK_CREATE(id, func, name, param, prio, handle_p)	\
+	StaticTaskCreate(func, name, sizeof(id##_stack) / sizeof(StackType_t), param, prio, handle_p, id##_stack, &id##_tcb)
+/** Queue of lenght items of item_size bytes */
+#define STATIC_QUEUE_DEFINE(id, lenght, item_size)		\
+	static uint8_t id##_storage[(lenght) * (item_size)];	\
+	static StaticQueue_t id##_qcb
+#define STATIC_QUEUE_CREATE(id, lenght, item_size)		\
+	xQueueCreateStatic(lenght, item_size, id##_storage, &id##_qcb)
+/** Mutex, binary or counting semaphore */
+#define STATIC_SEMAPHORE_DEFINE(id)						\
+	static StaticSemaphore_t id##_scb
+#define STATIC_MUTEX_CREATE(id)							\
+	xSemaphoreCreateMutexStatic(&id##_scb)
+#define STATIC_BINARY_CREATE(id)						\
+	xSemaphoreCreateBinaryStatic(&id##_scb)
+#define STATIC_COUNTING_CREATE(id, max, initial)		\
+	xSemaphoreCreateCountingStatic(max, initial, &id##_scb)
+/** Arrays of n objects */
+#define STATIC_TASKS_DEFINE(id, n, stack)				\
+	static StackType_t id##_stack[n][stack];			\
+	static StaticTask_t id##_tcb[n]
+#define STATIC_TASK_CREATE_N(id, i, func, name, param, prio, handle_p)	\
+	StaticTaskCreate(func, name, sizeof(id##_stack[0]) / sizeof(StackType_t), param, prio, handle_p, id##_stack[i], &id##_tcb[i])
+#define STATIC_QUEUES_DEFINE(id, n, lenght, item_size)	\
+	static uint8_t id##_storage[n][(lenght) * (item_size)];	\
+	static StaticQueue_t id##_qcb[n]
+#define STATIC_QUEUE_CREATE_N(id, i, lenght, item_size)	\
+	xQueueCreateStatic(lenght, item_size, id##_storage[i], &id##_qcb[i])
+#define STATIC_SEMAPHORES_DEFINE(id, n)					\
+	static StaticSemaphore_t id##_scb[n]
+#define STATIC_MUTEX_CREATE_N(id, i)					\
+	xSemaphoreCreateMutexStatic(&id##_scb[i])
+#else
+#define STATIC_TASK_DEFINE(id, stack)					\
+	enum { id##_stack_size = (stack) }
+#define STATIC_TASK_CREATE(id, func, name, param, prio, handle_p)	\
+	xTaskCreate(func, name, id##_stack_size, param, prio, handle_p)
+#define STATIC_QUEUE_DEFINE(id, lenght, item_size)		\
+	struct id##_qcb
+#define STATIC_QUEUE_CREATE(id, lenght, item_size)		\
+	xQueueCreate(lenght, item_size)
+#define STATIC_SEMAPHORE_DEFINE(id)						\
+	struct id##_scb
+#define STATIC_MUTEX_CREATE(id)							\
+	xSemaphoreCreateMutex()
+#define STATIC_BINARY_CREATE(id)						\
+	xSemaphoreCreateBinary()
+#define STATIC_COUNTING_CREATE(id, max, initial)		\
+	xSemaphoreCreateCounting(max, initial)
+#define STATIC_TASKS_DEFINE(id, n, stack)				\
+	enum { id##_stack_size = (stack) }
+#define STATIC_TASK_CREATE_N(id, i, func, name, param, prio, handle_p)	\
+	xTaskCreate(func, name, id##_stack_size, param, prio, handle_p)
+#define STATIC_QUEUES_DEFINE(id, n, lenght, item_size)	\
+	struct id##_qcb
+#define STATIC_QUEUE_CREATE_N(id, i, lenght, item_size)	\
+	xQueueCreate(lenght, item_size)
+#define STATIC_SEMAPHORES_DEFINE(id, n)					\
+	struct id##_scb
+#define STATIC_MUTEX_CREATE_N(id, i)					\
+	xSemaphoreCreateMutex()
+#endif
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+#if CONFIG_DRIVERS_STATIC_ALLOCATION
+/**
+ * @brief xTaskCreateStatic with the result of xTaskCreate.
+ *
+ * @return pdPASS if the task was created
+ */
+static inline BaseType_t StaticTaskCreate(TaskFunction_t func, const char *name, uint32_t stack, void *param,
+										  UBaseType_t prio, TaskHandle_t *handle_p, StackType_t *stack_p, StaticTask_t *tcb_p){
+	TaskHandle_t task = xTaskCreateStatic(func, name, stack, param, prio, stack_p, tcb_p);
+	if(handle_p != NULL){
+		*handle_p = task;
+	}
+	return (task != NULL) ? pdPASS : pdFAIL;
+}
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STATIC_ALLOC_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,104 @@
+#ifndef TASK_MONITOR_MCU_H
+#define TASK_MONITOR_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup TASK_MONITOR Task monitor
+ ** @{ */
+
+/** \brief CPU load and stack usage of the FreeRTOS tasks.
+ *
+ * A periodic esp_timer samples the run time counters and the stack high water
+ * marks of every task (uxTaskGetSystemState). The CPU load of a task is the
+ * share of the run time it used between the last two samples, so it shows the
+ * load of the last period (not the average since boot). The minimum free stack
+ * is the lowest it ever was, to size the task stacks.
+ *
+ * The report is a text table sent line by line through a print function given
+ * by the application (i.e. to UART or BLE), requested by a command:
+ *
+ * @code
+ * static void PrintUart(const char *line){
+ *     UartSendString(UART_PC, line);
+ * }
+ * ...
+ * TaskMonitorReport(PrintUart);
+ * @endcode
+ *
+ * @note Needs CONFIG_DRIVERS_TASK_MONITOR (menuconfig: ESP-EDU drivers), that
+ * enables the FreeRTOS trace facility and run time stats. The run time counter
+ * is the esp_timer (1 us), so the sampling period must be much shorter than
+ * its overflow (71 minutes).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TASK_MONITOR_MAX_TASKS		24		/*!< Max tasks monitored (the rest are ignored) */
+#define TASK_MONITOR_NAME_LENGHT	16		/*!< Max lenght of a task name (with the '\0') */
+#define TASK_MONITOR_PERIOD_MS		1000	/*!< Default sampling period */
+/*==================[typedef]================================================*/
+/**
+ * @brief Usage of a task in the last sampling period
+ */
+typedef struct {
+	char name[TASK_MONITOR_NAME_LENGHT];	/*!< Task name */
+	uint8_t priority;						/*!< Current priority */
+	uint16_t cpu_load;						/*!< CPU load (in 0.1 %) */
+	uint32_t stack_free;					/*!< Minimum free stack since the task started (in bytes) */
+} task_monitor_t;
+
+/**
+ * @brief Function that sends a line of the report (i.e. BleSendString)
+ */
+typedef void (*task_monitor_print_t)(const char *line);
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start monitoring the tasks.
+ *
+ * @param period_ms Sampling period (in ms, 0: TASK_MONITOR_PERIOD_MS)
+ * @return true if the sampling timer was started
+ */
+bool TaskMonitorInit(uint32_t period_ms);
+
+/**
+ * @brief Stop monitoring the tasks (the last sample is kept).
+ */
+void TaskMonitorDeinit(void);
+
+/**
+ * @brief Usage of the tasks in the last sampling period.
+ *
+ * @param tasks Array where the task usages are copied
+ * @param max Lenght of the array
+ * @return uint8_t Number of tasks copied (0 until two samples were taken)
+ */
+uint8_t TaskMonitorGet(task_monitor_t *tasks, uint8_t max);
+
+/**
+ * @brief Send a table with the CPU load and the minimum free stack of each task.
+ *
+ * @param print_p Function that sends each line (ended with "\r\n")
+ */
+void TaskMonitorReport(task_monitor_print_t print_p);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TASK_MONITOR_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,90 @@
+#ifndef TIME_MCU_H
+#define TIME_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup TIME Time base
+ ** @{ */
+
+/** \brief Monotonic time base for the ESP-EDU Board.
+ *
+ * This driver provide a 64 bits microseconds clock counting from boot, shared
+ * by every driver to timestamp events (i.e. switch edges, ADC frames, timer
+ * alarms) with the same time base.
+ *
+ * @note The clock is the esp_timer counter: it is monotonic (it isn't changed
+ * by RtcConfig) and never overflows. Reads are inlined, don't need any
+ * initialization and can be used from tasks and IRAM ISRs.
+ *
+ * @note Calendar time of "rtc_mcu.h" is anchored to this clock, so timestamps
+ * can be converted to date and time with RtcFromTimestamp.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_attr.h"
+#include "esp_timer.h"
+/*==================[macros]=================================================*/
+#define TIME_US_PER_MS		1000ULL
+#define TIME_US_PER_S		1000000ULL
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Current time.
+ *
+ * @return uint64_t Time since boot (in us)
+ */
+FORCE_INLINE_ATTR uint64_t TimeNowUs(void){
+	return (uint64_t)esp_timer_get_time();
+}
+
+/**
+ * @brief Current time in ms (32 bits: it overflows every 49 days, use
+ * differences to compare times).
+ *
+ * @return uint32_t Time since boot (in ms)
+ */
+FORCE_INLINE_ATTR uint32_t TimeNowMs(void){
+	return (uint32_t)(TimeNowUs() / TIME_US_PER_MS);
+}
+
+/**
+ * @brief Time elapsed since a timestamp.
+ *
+ * @param since Timestamp (in us, from TimeNowUs)
+ * @return uint64_t Elapsed time (in us)
+ */
+FORCE_INLINE_ATTR uint64_t TimeElapsedUs(uint64_t since){
+	return TimeNowUs() - since;
+}
+
+/**
+ * @brief Check if a deadline was reached.
+ *
+ * @param deadline Timestamp (in us, from TimeNowUs)
+ * @return true The current time is equal or later than the deadline
+ */
+FORCE_INLINE_ATTR bool TimeReached(uint64_t deadline){
+	return TimeNowUs() >= deadline;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TIME_MCU_H */
+
+/*==================[end of file]============================================*/
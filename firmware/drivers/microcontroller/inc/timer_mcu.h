@@ -9,6 +9,23 @@
  ** @{ */
 
 /** \brief Timer driver for the ESP-EDU Board.
+ * 
+ * @note On each alarm the driver can notify a task directly (TimerNotifyTask),
+ * yielding at the end of the ISR only if the task has to run, so it runs right
+ * after the alarm. Callbacks that wake tasks themselves should be set in
+ * yield_func_p and return whether a yield is needed (func_p callbacks always yield).
+ * 
+ * @note Timers are entries of a table of TIMER_MAX_QTY, each one backed by a
+ * hardware timer: TimerCreate returns a handle to a periodic or one-shot timer
+ * (i.e. a short lived deadline) and TimerDelete releases its hardware timer.
+ * TIMER_A, TIMER_B and TIMER_C are timers of the same table created by TimerInit.
+ * The ESP32-C6 has two hardware timers, also used by other drivers (i.e. the
+ * analog output stream), so TimerCreate returns NULL when there is no free one.
+ * 
+ * @note TimerEtmGpio links the alarm of a timer to a GPIO action through the
+ * Event Task Matrix: the pin is set, cleared or toggled by the hardware at the
+ * alarm, with no ISR and no CPU jitter (i.e. a sampling clock for an external
+ * converter or a pulse output).
  * 
  * @author Albano Peñalva
  *
@@ -17,12 +34,22 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Alarm timestamps		                         						|
+ * | 14/10/2026 | Task notification on alarm and callbacks that return the yield		|
+ * | 14/10/2026 | Alarm latency and jitter measurement									|
+ * | 14/10/2026 | Handle based timers (table), one-shot mode							|
+ * | 14/10/2026 | ETM GPIO actions on alarm												|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define TIMER_MAX_QTY	4	/*!< Size of the timers table */
 
 /*==================[typedef]================================================*/
 /**
@@ -41,7 +68,57 @@ typedef struct {
 	uint32_t period;		/*!< Period (in us) */
 	void *func_p;			/*!< Pointer to callback function to call periodically */
 	void *param_p;			/*!< Pointer to callback function parameter */
+	bool (*yield_func_p)(void *param);	/*!< Callback that returns true if it woke a higher priority task (NULL: use func_p) */
 } timer_config_t;
+/**
+ * @brief Alarm mode of a timer created with TimerCreate
+ */
+typedef enum {
+	TIMER_PERIODIC,			/*!< Alarm every period, until stopped */
+	TIMER_ONE_SHOT			/*!< One alarm a period after each start */
+} timer_mode_t;
+
+/**
+ * @brief GPIO action triggered by the ETM on each alarm
+ */
+typedef enum {
+	TIMER_ETM_GPIO_SET,		/*!< Set the pin */
+	TIMER_ETM_GPIO_CLEAR,	/*!< Clear the pin */
+	TIMER_ETM_GPIO_TOGGLE	/*!< Toggle the pin (square wave of half the alarm frequency) */
+} timer_etm_action_t;
+
+/**
+ * @brief Handle of a timer of the table
+ */
+typedef struct timer_data * timer_handle_t;
+
+/**
+ * @brief Configuration of a timer created with TimerCreate
+ */
+typedef struct {
+	uint32_t period;		/*!< Period or one-shot delay (in us) */
+	timer_mode_t mode;		/*!< Periodic or one-shot */
+	void (*func_p)(void *param);		/*!< Callback called on each alarm (NULL: none) */
+	void *param_p;			/*!< Callback parameter */
+	bool (*yield_func_p)(void *param);	/*!< Callback that returns true if it woke a higher priority task (NULL: use func_p) */
+} timer_handle_config_t;
+
+/**
+ * @brief Alarm latency and jitter statistics of a timer
+ * 
+ * Latency is the timer count when the alarm ISR runs (us after the alarm). Jitter is
+ * the time between consecutive alarm ISRs minus the period. An alarm misses its
+ * deadline when it's serviced a period late or more. Only periodic timers are measured.
+ */
+typedef struct {
+	uint32_t alarms;		/*!< Alarms measured */
+	uint32_t missed;		/*!< Alarms that missed their deadline */
+	uint32_t latency_min;	/*!< Minimum latency (us) */
+	uint32_t latency_max;	/*!< Maximum latency (us) */
+	uint32_t latency_mean;	/*!< Mean latency (us) */
+	int32_t jitter_min;		/*!< Minimum jitter (us) */
+	int32_t jitter_max;		/*!< Maximum jitter (us) */
+} timer_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -54,6 +131,17 @@ typedef struct {
  */
 void TimerInit(timer_config_t *timer_ini);
 
+/**
+ * @brief Notify a task on each alarm of a timer
+ * 
+ * @note The notification is given from the ISR (vTaskNotifyGiveFromISR, the task
+ * waits with ulTaskNotifyTake) before calling the callback, if any.
+ * 
+ * @param timer Timer number
+ * @param task Task to notify (NULL to disable)
+ */
+void TimerNotifyTask(timer_mcu_t timer, TaskHandle_t task);
+
 /**
  * @brief Start timer count
  * 
@@ -71,6 +159,36 @@ void TimerStart(timer_mcu_t timer);
  */
 uint32_t TimerRead(timer_mcu_t timer);
 
+/**
+ * @brief Return the acquisition time of the last timer alarm.
+ * 
+ * The timestamp is captured in the timer ISR, so a task woken by the timer callback
+ * gets the exact time of the event that triggered it without reading the timer again.
+ * 
+ * @param timer Timer number
+ * @return Time of the last alarm in us since boot (0 if no alarm happened yet)
+ */
+uint64_t TimerGetAlarmTime(timer_mcu_t timer);
+
+/**
+ * @brief Start or stop the latency and jitter measurement of a timer
+ * 
+ * @note Statistics are reset when the measurement starts. It adds a few
+ * microseconds to each alarm ISR while enabled.
+ * 
+ * @param timer Timer number
+ * @param enable true: reset and start, false: stop (statistics are kept)
+ */
+void TimerStatsEnable(timer_mcu_t timer, bool enable);
+
+/**
+ * @brief Read the latency and jitter statistics of a timer
+ * 
+ * @param timer Timer number
+ * @param stats Statistics since the measurement started
+ */
+void TimerGetStats(timer_mcu_t timer, timer_stats_t *stats);
+
 /**
  * @brief Pause timer
  * 
@@ -98,6 +216,126 @@ void TimerReset(timer_mcu_t timer);
  */
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period);
 
+/**
+ * @brief Create a timer of the table
+ * 
+ * @note The timer is stopped after creation.
+ * 
+ * @param config Timer configuration
+ * @return timer_handle_t Timer handle (NULL if the table is full or there is no free hardware timer)
+ */
+timer_handle_t TimerCreate(const timer_handle_config_t *config);
+
+/**
+ * @brief Stop a timer and release its table entry and hardware timer
+ * 
+ * @param timer Timer handle
+ */
+void TimerDelete(timer_handle_t timer);
+
+/**
+ * @brief Start a timer (a one-shot timer alarms a period after this call)
+ * 
+ * @param timer Timer handle
+ */
+void TimerHandleStart(timer_handle_t timer);
+
+/**
+ * @brief Pause a timer
+ * 
+ * @param timer Timer handle
+ */
+void TimerHandleStop(timer_handle_t timer);
+
+/**
+ * @brief Reset a timer count to 0
+ * 
+ * @param timer Timer handle
+ */
+void TimerHandleReset(timer_handle_t timer);
+
+/**
+ * @brief Read the current count of a timer (see TimerRead)
+ * 
+ * @param timer Timer handle
+ * @return The current value of the timer in us
+ */
+uint32_t TimerHandleRead(timer_handle_t timer);
+
+/**
+ * @brief Return the time of the last alarm of a timer (see TimerGetAlarmTime)
+ * 
+ * @param timer Timer handle
+ * @return Time of the last alarm in us since boot (0 if no alarm happened yet)
+ */
+uint64_t TimerHandleGetAlarmTime(timer_handle_t timer);
+
+/**
+ * @brief Update the period (or one-shot delay) of a timer
+ * 
+ * @param timer Timer handle
+ * @param period Period (in us)
+ */
+void TimerHandleUpdatePeriod(timer_handle_t timer, uint32_t period);
+
+/**
+ * @brief Notify a task on each alarm of a timer (see TimerNotifyTask)
+ * 
+ * @param timer Timer handle
+ * @param task Task to notify (NULL to disable)
+ */
+void TimerHandleNotifyTask(timer_handle_t timer, TaskHandle_t task);
+
+/**
+ * @brief Start or stop the latency and jitter measurement of a timer (see TimerStatsEnable)
+ * 
+ * @param timer Timer handle
+ * @param enable true: reset and start, false: stop (statistics are kept)
+ */
+void TimerHandleStatsEnable(timer_handle_t timer, bool enable);
+
+/**
+ * @brief Read the latency and jitter statistics of a timer
+ * 
+ * @param timer Timer handle
+ * @param stats Statistics since the measurement started
+ */
+void TimerHandleGetStats(timer_handle_t timer, timer_stats_t *stats);
+
+/**
+ * @brief Trigger a GPIO action in hardware (ETM) on each alarm of a timer
+ * 
+ * @note The pin is configured as output. Calling it again with the same action
+ * adds pins (they change at the same time); a timer supports one action. If a
+ * periodic timer has no callbacks nor task to notify, its alarm ISR is removed
+ * (call it while the timer is stopped; TimerHandleNotifyTask and the statistics
+ * have no effect afterwards).
+ * 
+ * @param timer Timer handle
+ * @param pin GPIO
+ * @param action GPIO action
+ * @return true if the ETM channel was linked
+ */
+bool TimerHandleEtmGpio(timer_handle_t timer, gpio_t pin, timer_etm_action_t action);
+
+/**
+ * @brief Trigger a GPIO action in hardware (ETM) on each alarm of a timer (see TimerHandleEtmGpio)
+ * 
+ * @param timer Timer number
+ * @param pin GPIO
+ * @param action GPIO action
+ * @return true if the ETM channel was linked
+ */
+bool TimerEtmGpio(timer_mcu_t timer, gpio_t pin, timer_etm_action_t action);
+
+/**
+ * @brief Handle of a timer initialized with TimerInit
+ * 
+ * @param timer Timer number
+ * @return timer_handle_t Timer handle
+ */
+timer_handle_t TimerGetHandle(timer_mcu_t timer);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
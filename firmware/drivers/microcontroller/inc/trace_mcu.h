@@ -0,0 +1,148 @@
+#ifndef TRACE_MCU_H
+#define TRACE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup TRACE Event tracer
+ ** @{ */
+
+/** \brief Binary event tracer for ISR and task timelines.
+ *
+ * The TRACE_* macros store a fixed size record (timestamp, event id, kind and
+ * argument) in a RAM ring. Storing a record takes a few instructions and
+ * doesn't block (the slot is reserved with an atomic increment), so they can
+ * be used in ISRs and time critical tasks without changing the timing being
+ * observed, as printf does. When the ring is full the oldest records are
+ * overwritten: it always holds the last CONFIG_DRIVERS_TRACE_RECORDS events.
+ *
+ * Drivers trace their own events (timer alarms, LCD writes, BLE
+ * notifications, sensor hub reads); applications use ids from TRACE_USER on:
+ *
+ * @code
+ * #define TRACE_ADC_TASK	(TRACE_USER + 0)
+ * ...
+ * TRACE_BEGIN(TRACE_ADC_TASK, pad);
+ * ...
+ * TRACE_END(TRACE_ADC_TASK, pad);
+ * @endcode
+ *
+ * TraceDump sends the records through a write function given by the
+ * application (i.e. to UART) as a dump:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 4          | "TRC" and version (TRACE_VERSION)                      |
+ * | 2          | Number of records n                                    |
+ * | 4          | Events overwritten before the first record             |
+ * | 8 * n      | Records (trace_record_t), oldest first                 |
+ * | 2          | CRC16-CCITT (0x1021, init 0xFFFF) of the previous bytes|
+ *
+ * Values are little endian. The host side decoder, tools/trace_decoder.py of
+ * the middleware, prints the timeline and the duration of each BEGIN/END pair,
+ * or exports it to Chrome/Perfetto trace format.
+ *
+ * @note Needs CONFIG_DRIVERS_TRACE (menuconfig: ESP-EDU drivers), otherwise
+ * the macros don't add any code (their arguments must not have side effects).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+/*==================[macros]=================================================*/
+#define TRACE_VERSION		1		/*!< Version of the dump format */
+
+/* Events of the drivers */
+#define TRACE_TIMER_ISR		0		/*!< Timer alarm ISR (arg: timer) */
+#define TRACE_LCD_WRITE		1		/*!< ILI9341 command (arg: command) */
+#define TRACE_BLE_SEND		2		/*!< BLE notification (arg: bytes) */
+#define TRACE_SENSOR_READ	3		/*!< Sensor hub read (arg: sensor id) */
+#define TRACE_USER			16		/*!< First id of the application events */
+
+#if CONFIG_DRIVERS_TRACE
+/** Instant event */
+#define TRACE_EVENT(id, arg)	TraceRecord(id, TRACE_POINT, arg)
+/** Start of an interval (i.e. an ISR or the processing of a block) */
+#define TRACE_BEGIN(id, arg)	TraceRecord(id, TRACE_START, arg)
+/** End of an interval */
+#define TRACE_END(id, arg)		TraceRecord(id, TRACE_STOP, arg)
+#else
+#define TRACE_EVENT(id, arg)	((void)(id), (void)(arg))
+#define TRACE_BEGIN(id, arg)	((void)(id), (void)(arg))
+#define TRACE_END(id, arg)		((void)(id), (void)(arg))
+#endif
+/*==================[typedef]================================================*/
+/**
+ * @brief Kinds of records
+ */
+typedef enum {
+	TRACE_POINT,				/*!< Instant event */
+	TRACE_START,				/*!< Start of an interval */
+	TRACE_STOP					/*!< End of an interval */
+} trace_kind_t;
+
+/**
+ * @brief Record of an event (8 bytes)
+ */
+typedef struct {
+	uint32_t timestamp;			/*!< Time of the event (us since boot, 32 bits of TimeNowUs) */
+	uint8_t id;					/*!< Event id */
+	uint8_t kind;				/*!< Kind of record (trace_kind_t) */
+	uint16_t arg;				/*!< Argument of the event */
+} trace_record_t;
+
+/**
+ * @brief Function that sends a part of the dump (i.e. UartWrite to a port)
+ */
+typedef void (*trace_write_t)(const void *data, uint32_t lenght);
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clear the ring and start recording the events.
+ */
+void TraceStart(void);
+
+/**
+ * @brief Stop recording the events (the ring is kept until the next TraceStart).
+ */
+void TraceStop(void);
+
+/**
+ * @brief Store a record (use the TRACE_* macros).
+ *
+ * @note It can be called from ISRs (it is placed in IRAM).
+ *
+ * @param id Event id
+ * @param kind Kind of record
+ * @param arg Argument of the event
+ */
+void TraceRecord(uint8_t id, trace_kind_t kind, uint16_t arg);
+
+/**
+ * @brief Send the records of the ring (see the dump format above).
+ *
+ * @note Recording is stopped while the dump is sent and restarted afterwards
+ * (with the ring cleared) if it was on.
+ *
+ * @param write_p Function that sends each part of the dump
+ */
+void TraceDump(trace_write_t write_p);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TRACE_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -9,6 +9,30 @@
  ** @{ */
 
 /** \brief UART driver for the ESP-EDU Board.
+ * 
+ * Data is sent through the TX ring of the ESP-IDF UART driver (256 bytes by
+ * default, see serial_config_t.tx_buffer_size), so sending only copies the data and
+ * the driver feeds the hardware FIFO from its interrupt. UartWrite blocks only
+ * while the ring is full; UartWriteAsync returns at once and a driver task copies
+ * the data and notifies the caller when its buffer can be reused.
+ * 
+ * Reception can notify func_p (the data is then read with UartReadByte or
+ * UartReadBuffer) or hand the received data to rx_func_p. With rx_pattern the
+ * driver detects a frame terminator (i.e. '\n' for text lines) and rx_func_p
+ * receives one complete frame per call, so there are no per byte reads nor
+ * read timeouts.
+ * 
+ * Ring and event queue sizes are set per port: high rate telemetry ports can
+ * get large buffers while command ports stay small.
+ * 
+ * UART_USB is the native USB Serial/JTAG port of the ESP32-C6 (the same USB
+ * cable, without the USB-UART bridge of UART_PC): the data goes in USB full
+ * speed packets of 64 bytes and the host reads it as fast as it can (several
+ * times the 921600 baud of UART_PC), so baud_rate is ignored. It has the same
+ * functions as the other ports; without events, a driver task reads the
+ * received data for the callbacks. Use large rings (i.e. 4096 bytes) for raw
+ * ADC or telemetry streaming. If the console is on the USB Serial/JTAG port
+ * (CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG) the logs share it.
  * 
  * @author Albano Peñalva
  *
@@ -17,13 +41,22 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 02/07/2024 | Document creation		                         						|
+ * | 14/10/2026 | Bulk (UartWrite) and non blocking (UartWriteAsync) transmission		|
+ * | 14/10/2026 | RX/TX ring and event queue sizes per port								|
+ * | 14/10/2026 | Buffered reception (rx_func_p) with pattern detection					|
+ * | 15/10/2026 | USB Serial/JTAG port (UART_USB)										|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 /*==================[macros]=================================================*/
 #define UART_NO_INT	0		/*!< Flag used when no reading interruption is required */
+#define UART_TX_QUEUE_SIZE	8	/*!< Pending transmissions of UartWriteAsync (per port) */
+#define UART_NO_PATTERN	0		/*!< Buffered reception hands the data as it arrives */
 /*==================[typedef]================================================*/
 /**
  * @brief List of UART ports available in ESP-EDU
@@ -31,15 +64,30 @@
 typedef enum uart_ports{
 	UART_PC,				/*!< UART connected PC through USB port (indicated with UART) (also maped to TX: GPIO16, RX: GPIO17) */
 	UART_CONNECTOR,			/*!< UART connected to J2 connector (TX: GPIO18, RX: GPIO19) */
+	UART_USB,				/*!< USB Serial/JTAG port of the microcontroller (USB connector of the ESP32-C6, GPIO12 and GPIO13) */
 } uart_mcu_port_t;
+/**
+ * @brief Prototype of callback function for buffered reception
+ * 
+ * @param data      pointer to received data (followed by '\0', valid only during the call)
+ * @param lenght    number of bytes of received data (without the pattern)
+ * @param param     serial_config_t.param_p
+ */
+typedef void (*uart_rx_func_t)(uint8_t *data, uint16_t lenght, void *param);
+
 /**
  * @brief Serial port configuration struct
  */
 typedef struct {			
 	uart_mcu_port_t port;	/*!< port */
-	uint32_t baud_rate;		/*!< baudrate (bits per second) */
+	uint32_t baud_rate;		/*!< baudrate (bits per second, ignored by UART_USB) */
 	void *func_p;			/*!< Pointer to callback function to call when receiving data (= UART_NO_INT if not requiered)*/
 	void *param_p;			/*!< Pointer to callback function parameters */
+	uint32_t tx_buffer_size;/*!< TX ring size in bytes, greater than the 128 bytes hardware FIFO (0: 256 bytes) */
+	uint32_t rx_buffer_size;/*!< RX ring size in bytes, greater than the 128 bytes hardware FIFO (0: 256 bytes) */
+	uint32_t event_queue_size;/*!< Events queued for the receiving callback (0: 16) */
+	uart_rx_func_t rx_func_p;/*!< Callback that receives the data read by the driver (NULL if not requiered) */
+	uint8_t rx_pattern;		/*!< Frame terminator (i.e. '\n'): rx_func_p receives complete frames (UART_NO_PATTERN: data as it arrives) */
 } serial_config_t;
 /*==================[external data declaration]==============================*/
 
@@ -82,6 +130,7 @@ void UartSendByte(uart_mcu_port_t port, const char *data);
  * @brief Send a String trough serial port
  * 
  * @note Sends data untill finding the '\0' character (used to indicate a String end).
+ * Data is copied to the TX ring; the call blocks only while the ring is full.
  * 
  * @param port Port for sending data
  * @param msg Pointer to string to be transmitted
@@ -91,12 +140,40 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
 /**
  * @brief Send multiple bytes through serial port
  * 
+ * @note Data is copied to the TX ring; the call blocks only while the ring is full.
+ * 
  * @param port Port for sending data
  * @param data Pointer to array of data to be transmitted
  * @param nbytes Number of bytes to be sended
  */
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
 
+/**
+ * @brief Send multiple bytes (of any length) through serial port
+ * 
+ * @note Data is copied to the TX ring; the call blocks only while the ring is full.
+ * 
+ * @param port Port for sending data
+ * @param data Pointer to data to be transmitted
+ * @param nbytes Number of bytes to be sended
+ * @return uint32_t Number of bytes sended
+ */
+uint32_t UartWrite(uart_mcu_port_t port, const void *data, uint32_t nbytes);
+
+/**
+ * @brief Queue multiple bytes (of any length) to be sended through serial port, without blocking
+ * 
+ * @note Data is not copied, it must remain valid until the notification.
+ * 
+ * @param port Port for sending data
+ * @param data Pointer to data to be transmitted
+ * @param nbytes Number of bytes to be sended
+ * @param notify Task notified (as with xTaskNotifyGive) when data is in the TX ring and the buffer can be reused (NULL: no notification)
+ * @return true Transmission queued
+ * @return false Too many pending transmissions (UART_TX_QUEUE_SIZE), nothing is sended
+ */
+bool UartWriteAsync(uart_mcu_port_t port, const void *data, uint32_t nbytes, TaskHandle_t notify);
+
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
@@ -0,0 +1,163 @@
+#ifndef WIFI_UDP_MCU_H
+#define WIFI_UDP_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Wifi_Udp Wi-Fi UDP sink
+ ** @{ */
+
+/** \brief Wi-Fi station that streams batched telemetry frames to a host over UDP.
+ *
+ * Frames (i.e. encoded with TelemetryEncode, or any other byte frames) are
+ * copied into datagrams of up to datagram_size bytes and sent by a task to the
+ * configured host and port. A frame is never split between datagrams, so the
+ * receiver can decode each datagram on its own. A datagram is sent when the next
+ * frame does not fit, or after flush_ms with frames waiting, which bounds the
+ * latency of slow signals.
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 4          | Sequence number of the datagram                        |
+ * | 4          | Time of the first frame (us, TimeNowUs, low 32 bits)   |
+ * | ...        | Frames                                                 |
+ *
+ * Fields are little endian. The sequence number counts every datagram closed
+ * since WifiUdpInit, so the receiver detects the datagrams lost on the air (or
+ * by the stack) by the gaps. With 1400 bytes datagrams the station sustains
+ * several Mbit/s, beyond the 921600 baud of the UART and the throughput of BLE
+ * notifications. The Wi-Fi power save is disabled: with modem sleep the
+ * datagrams wait for the next beacon.
+ *
+ * WifiUdpSend does not wait: if every datagram buffer is waiting to be sent
+ * (the link is slower than the producer), the frame is counted as dropped.
+ * The host side decoder is middelware/signal_processing/tools/telemetry_decoder.py
+ * (source udp:PORT).
+ *
+ * @code
+ * wifi_udp_config_t wifi = {
+ *     .ssid = CONFIG_ESP_WIFI_SSID,
+ *     .password = CONFIG_ESP_WIFI_PASSWORD,
+ *     .max_retry = CONFIG_ESP_MAXIMUM_RETRY,
+ *     .host = "192.168.1.10",
+ *     .port = 5005,
+ * };
+ * WifiUdpInit(&wifi);
+ * ...
+ * uint16_t n = TelemetryEncode(&telemetry, frame);
+ * WifiUdpSend(frame, n);
+ * @endcode
+ *
+ * @note Needs CONFIG_DRIVERS_WIFI_UDP (ESP-EDU drivers menu). The Wi-Fi driver
+ * uses the NVS partition (WifiUdpInit calls NvsInit()).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define WIFI_UDP_HEADER				8		/*!< Bytes of the datagram header */
+#define WIFI_UDP_MAX_DATAGRAM		1472	/*!< Max bytes of a datagram (header and frames) without IP fragmentation */
+#define WIFI_UDP_DEFAULT_DATAGRAM	1400	/*!< Bytes of a datagram if datagram_size is 0 */
+#define WIFI_UDP_DEFAULT_FLUSH_MS	20		/*!< Max time a frame waits for a datagram if flush_ms is 0 */
+#define WIFI_UDP_BUFFERS			8		/*!< Datagram buffers (the one being filled and the ones waiting to be sent) */
+/*==================[typedef]================================================*/
+/**
+ * @brief State of the station
+ */
+typedef enum {
+	WIFI_UDP_DISCONNECTED,			/*!< Not connected (or max_retry reached) */
+	WIFI_UDP_CONNECTING,			/*!< Connecting to the access point */
+	WIFI_UDP_CONNECTED,				/*!< Connected, with an IP address */
+} wifi_udp_state_t;
+
+/**
+ * @brief Configuration
+ */
+typedef struct {
+	const char *ssid;				/*!< Network name */
+	const char *password;			/*!< Password (WPA2), "" for an open network */
+	uint8_t max_retry;				/*!< Reconnection attempts after a disconnection (0: forever) */
+	const char *host;				/*!< IPv4 address of the receiver (i.e. "192.168.1.10") */
+	uint16_t port;					/*!< UDP port of the receiver */
+	uint16_t datagram_size;			/*!< Max bytes of each datagram (0: WIFI_UDP_DEFAULT_DATAGRAM, up to WIFI_UDP_MAX_DATAGRAM) */
+	uint16_t flush_ms;				/*!< Max time a frame waits for a datagram (0: WIFI_UDP_DEFAULT_FLUSH_MS) */
+} wifi_udp_config_t;
+
+/**
+ * @brief Statistics
+ */
+typedef struct {
+	uint32_t datagrams;				/*!< Datagrams sent */
+	uint32_t bytes;					/*!< Bytes sent (with the headers) */
+	uint32_t frames;				/*!< Frames sent */
+	uint32_t dropped;				/*!< Frames dropped (no free buffer, too large or not sent) */
+	uint32_t send_errors;			/*!< Datagrams the stack could not send */
+	uint32_t reconnections;			/*!< Connections lost */
+	int8_t rssi;					/*!< Signal of the access point (dBm, 0 if disconnected) */
+} wifi_udp_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the station and the transmission task (the connection continues in the background)
+ *
+ * @param config Configuration
+ * @return true     Station started
+ * @return false    Invalid host address, or the Wi-Fi driver could not be started
+ */
+bool WifiUdpInit(const wifi_udp_config_t *config);
+
+/**
+ * @brief Wait until the station gets an IP address
+ *
+ * @param timeout_ms Max wait (ms)
+ * @return true     Connected
+ * @return false    Not connected within the timeout
+ */
+bool WifiUdpWaitConnected(uint32_t timeout_ms);
+
+/**
+ * @brief State of the station
+ *
+ * @return wifi_udp_state_t State
+ */
+wifi_udp_state_t WifiUdpGetState(void);
+
+/**
+ * @brief Add a frame to the current datagram (without waiting)
+ *
+ * @param data Frame
+ * @param lenght Bytes of the frame (up to datagram_size - WIFI_UDP_HEADER)
+ * @return true     Frame queued
+ * @return false    Frame dropped (no free buffer, too large, or not connected)
+ */
+bool WifiUdpSend(const uint8_t *data, uint16_t lenght);
+
+/**
+ * @brief Send the current datagram now, even if it is not full
+ */
+void WifiUdpFlush(void);
+
+/**
+ * @brief Read the statistics
+ *
+ * @param stats Statistics
+ */
+void WifiUdpGetStats(wifi_udp_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* WIFI_UDP_MCU_H */
+
+/*==================[end of file]============================================*/
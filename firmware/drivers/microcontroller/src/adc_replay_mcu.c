@@ -0,0 +1,261 @@
+/**
+ * @file adc_replay_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "adc_replay_mcu.h"
+#include <string.h>
+#include "time_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define HEADER_SIZE		16		/*!< Bytes of the header of a capture */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Read a 16 bits field (little endian)
+ */
+static uint16_t AdcReplayGet16(const uint8_t *p){
+	return p[0] | (p[1] << 8);
+}
+
+/**
+ * @brief Read a 32 bits field (little endian)
+ */
+static uint32_t AdcReplayGet32(const uint8_t *p){
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Unpack and check the header of a capture
+ */
+static bool AdcReplayParseHeader(adc_replay_t *replay, const uint8_t *bytes){
+	adc_replay_header_t *header = &replay->header;
+	header->magic = AdcReplayGet32(&bytes[0]);
+	header->version = bytes[4];
+	header->channels = bytes[5];
+	header->frame_size = AdcReplayGet16(&bytes[6]);
+	header->sample_frec = AdcReplayGet32(&bytes[8]);
+	header->blocks = AdcReplayGet32(&bytes[12]);
+	replay->n_channels = __builtin_popcount(header->channels);
+	replay->header_ok = header->magic == ADC_REPLAY_MAGIC && header->version == ADC_REPLAY_VERSION &&
+		header->channels != 0 && header->channels < (1 << ADC_CH_NUM) && header->frame_size > 0 &&
+		header->frame_size <= ADC_CONT_MAX_FRAME_SIZE && header->sample_frec > 0;
+	return replay->header_ok;
+}
+
+/**
+ * @brief Read bytes of a streamed capture (false if the stream ended)
+ */
+static bool AdcReplayReceive(adc_replay_t *replay, uint8_t *data, uint32_t lenght){
+	while(lenght > 0){
+		size_t n = xStreamBufferReceive(replay->stream, data, lenght, pdMS_TO_TICKS(ADC_REPLAY_STREAM_TIMEOUT_MS));
+		if(n == 0){
+			return false;
+		}
+		data += n;
+		lenght -= n;
+	}
+	return true;
+}
+
+/**
+ * @brief Fill the next block of the ring with the next block of the capture (false at the end of the capture)
+ */
+static bool AdcReplayNext(adc_replay_t *replay){
+	const adc_replay_header_t *header = &replay->header;
+	analog_block_t *block = &replay->blocks[replay->written % ADC_REPLAY_BLOCK_RING_SIZE];
+	uint32_t row = header->frame_size * sizeof(uint16_t);
+	if(replay->capture != NULL){
+		if(replay->pos == header->blocks){
+			if(!replay->config.loop){
+				return false;
+			}
+			replay->pos = 0;
+		}
+		const uint8_t *data = &replay->capture[HEADER_SIZE + replay->pos * row * replay->n_channels];
+		for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+			if(header->channels & (1 << ch)){
+				memcpy(block->data[ch], data, row);
+				data += row;
+			}
+		}
+	}else{
+		for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+			if((header->channels & (1 << ch)) && !AdcReplayReceive(replay, (uint8_t *)block->data[ch], row)){
+				return false;
+			}
+		}
+	}
+	replay->pos++;
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		block->lenght[ch] = (header->channels & (1 << ch)) ? header->frame_size : 0;
+	}
+	block->channels = header->channels;
+	block->sample_frec = header->sample_frec;
+	// time of the first sample in the capture (the same in every run)
+	block->timestamp = replay->start_time + (uint64_t)replay->written * header->frame_size * TIME_US_PER_S / header->sample_frec;
+	__atomic_store_n(&replay->written, replay->written + 1, __ATOMIC_RELEASE);
+	if(replay->config.func_p != NULL){
+		((void (*)(void *))replay->config.func_p)(replay->config.param_p);
+	}
+	return true;
+}
+
+/**
+ * @brief Replay task: a block on each alarm (real time) or on each release (max speed)
+ */
+static void AdcReplayTask(void *param){
+	adc_replay_t *replay = param;
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!replay->header_ok && replay->running && !replay->done){
+			// streamed capture: the header arrives first
+			uint8_t header[HEADER_SIZE];
+			if(!AdcReplayReceive(replay, header, HEADER_SIZE) || !AdcReplayParseHeader(replay, header)){
+				replay->done = true;
+				continue;
+			}
+			TimerHandleUpdatePeriod(replay->timer, (uint64_t)replay->header.frame_size * TIME_US_PER_S / replay->header.sample_frec);
+			replay->start_time = TimeNowUs();
+		}
+		while(replay->running && !replay->done){
+			if(replay->written - __atomic_load_n(&replay->released, __ATOMIC_ACQUIRE) >= ADC_REPLAY_BLOCK_RING_SIZE){
+				// every block in use: the capture waits for a release
+				replay->overruns += replay->config.pace == ADC_REPLAY_REAL_TIME;
+				break;
+			}
+			if(!AdcReplayNext(replay)){
+				replay->done = true;
+				break;
+			}
+			if(replay->config.pace == ADC_REPLAY_REAL_TIME){
+				break;
+			}
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool AdcReplayInit(adc_replay_t *replay, const adc_replay_config_t *config){
+	memset(replay, 0, sizeof(adc_replay_t));
+	replay->config = *config;
+	uint32_t period = TIME_US_PER_S / 1000;
+	if(config->partition != NULL){
+		uint8_t header[HEADER_SIZE];
+		const void *data;
+		const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, config->partition);
+		if(partition == NULL || esp_partition_read(partition, 0, header, HEADER_SIZE) != ESP_OK ||
+			!AdcReplayParseHeader(replay, header) || replay->header.blocks == 0){
+			return false;
+		}
+		uint32_t size = HEADER_SIZE + replay->header.blocks * replay->header.frame_size * sizeof(uint16_t) * replay->n_channels;
+		if(size > partition->size ||
+			esp_partition_mmap(partition, 0, size, ESP_PARTITION_MMAP_DATA, &data, &replay->mmap_handle) != ESP_OK){
+			return false;
+		}
+		replay->capture = data;
+		period = (uint64_t)replay->header.frame_size * TIME_US_PER_S / replay->header.sample_frec;
+	}else{
+		replay->config.loop = false;
+		replay->stream = xStreamBufferCreateStatic(ADC_REPLAY_STREAM_SIZE, 1, replay->stream_storage, &replay->stream_buffer);
+	}
+	timer_handle_config_t timer = {
+		.period = period,
+		.mode = TIMER_PERIODIC,
+	};
+	replay->timer = TimerCreate(&timer);
+	if(replay->timer == NULL){
+		return false;
+	}
+	if(xTaskCreate(AdcReplayTask, "REPLAY", ADC_REPLAY_TASK_STACK, replay, ADC_REPLAY_TASK_PRIORITY, &replay->task) != pdPASS){
+		TimerDelete(replay->timer);
+		replay->timer = NULL;
+		return false;
+	}
+	if(config->pace == ADC_REPLAY_REAL_TIME){
+		TimerHandleNotifyTask(replay->timer, replay->task);
+	}
+	return true;
+}
+
+void AdcReplayStart(adc_replay_t *replay){
+	if(replay->written == 0){
+		replay->start_time = TimeNowUs();
+	}
+	replay->running = true;
+	if(replay->config.pace == ADC_REPLAY_REAL_TIME){
+		TimerHandleStart(replay->timer);
+	}
+	xTaskNotifyGive(replay->task);
+}
+
+void AdcReplayStop(adc_replay_t *replay){
+	TimerHandleStop(replay->timer);
+	replay->running = false;
+}
+
+void AdcReplayRewind(adc_replay_t *replay){
+	if(replay->capture == NULL){
+		return;
+	}
+	replay->pos = 0;
+	replay->written = 0;
+	replay->taken = 0;
+	replay->released = 0;
+	replay->overruns = 0;
+	replay->release_time = 0;
+	replay->done = false;
+}
+
+void AdcReplayFeed(adc_replay_t *replay, const uint8_t *data, uint32_t lenght){
+	while(lenght > 0){
+		size_t n = xStreamBufferSend(replay->stream, data, lenght, portMAX_DELAY);
+		data += n;
+		lenght -= n;
+	}
+}
+
+analog_block_t* AdcReplayGetBlock(adc_replay_t *replay){
+	if(replay->taken == __atomic_load_n(&replay->written, __ATOMIC_ACQUIRE)){
+		return NULL;
+	}
+	return &replay->blocks[replay->taken++ % ADC_REPLAY_BLOCK_RING_SIZE];
+}
+
+void AdcReplayReleaseBlock(adc_replay_t *replay, analog_block_t *block){
+	replay->release_time = TimeNowUs();
+	__atomic_store_n(&replay->released, replay->released + 1, __ATOMIC_RELEASE);
+	if(replay->config.pace == ADC_REPLAY_MAX_SPEED){
+		xTaskNotifyGive(replay->task);
+	}
+}
+
+const adc_replay_header_t* AdcReplayGetHeader(const adc_replay_t *replay){
+	return replay->header_ok ? &replay->header : NULL;
+}
+
+void AdcReplayGetStats(const adc_replay_t *replay, adc_replay_stats_t *stats){
+	uint32_t released = __atomic_load_n(&replay->released, __ATOMIC_ACQUIRE);
+	uint64_t end = (replay->done && released == replay->written) ? replay->release_time : TimeNowUs();
+	stats->blocks = replay->written;
+	stats->samples = (uint64_t)released * replay->header.frame_size * replay->n_channels;
+	stats->elapsed_us = (replay->written > 0) ? end - replay->start_time : 0;
+	stats->samples_per_s = (stats->elapsed_us > 0) ? (float)stats->samples * TIME_US_PER_S / stats->elapsed_us : 0;
+	stats->overruns = replay->overruns;
+	stats->done = replay->done;
+}
+
+/*==================[end of file]============================================*/
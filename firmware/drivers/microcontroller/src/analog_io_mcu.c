@@ -10,22 +10,164 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
 #include "analog_io_mcu.h"
+#include "ring_buffer_mcu.h"
+#include "time_mcu.h"
+#include "iram_mcu.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
+#include "esp_intr_alloc.h"
+#include "soc/interrupts.h"
+#include "soc/apb_saradc_struct.h"
+#include "hal/adc_ll.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_continuous.h"
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CONT_FRAMES		4							// DMA frames stored by the continuous driver
+#define ADC_LUT_SIZE		(1 << ADC_BITWIDTH)			// one entry per raw value
+#define ADC_RAW_TO_MV		(3300.0f / 4095.0f)			// raw to mV conversion (without calibration)
+#define ADC_CONT_BUF_SIZE	(ADC_CH_NUM * ADC_CONT_MAX_FRAME_SIZE * SOC_ADC_DIGI_RESULT_BYTES)
+#define ADC_OVS_MAX_SHIFT	4							// max oversampling ratio = 16
+#define ADC_DEC_MAX_SHIFT	3							// max decimation of a slow channel = 8
+#define ADC_TIMESTAMPS		8							// frame marks kept (power of two, more than ADC_CONT_FRAMES)
+#define ADC_MON_INT_HIGH(m)	(1UL << (29 - (m)))			// APB_SARADC interrupt of the high limit of monitor m
+#define ADC_MON_INT_LOW(m)	(1UL << (27 - (m)))			// APB_SARADC interrupt of the low limit of monitor m
+#define ADC_MON_INT_ALL		(ADC_MON_INT_HIGH(0) | ADC_MON_INT_HIGH(1) | ADC_MON_INT_LOW(0) | ADC_MON_INT_LOW(1))
+#define DAC_STREAM_RES_HZ	10000000					// audio output timer resolution (10 MHz)
+#define DAC_STREAM_CHUNK	64							// samples converted per ring buffer write
+#define DAC_PCM_GAIN_SHIFT	8							// PCM gain format: Q8.8
+#define DAC_PCM_SHIFT		(8 + DAC_PCM_GAIN_SHIFT)	// 16 bits PCM * gain to 8 bits pulse density
+/*==================[typedef]================================================*/
+/**
+ * @brief State of the 2nd order CIC decimator of one channel
+ */
+typedef struct {
+	uint32_t integ1;		/*!< First integrator */
+	uint32_t integ2;		/*!< Second integrator */
+	uint32_t comb1;			/*!< First comb delay */
+	uint32_t comb2;			/*!< Second comb delay */
+	uint8_t count;			/*!< Input samples since last output */
+	uint8_t shift;			/*!< log2 of the ratio (oversampling, and decimation not done by the scan) */
+} adc_cic_t;
+
+/**
+ * @brief Threshold monitor
+ */
+typedef struct {
+	bool used;				/*!< Taken by AnalogInputMonitorInit() */
+	adc_ch_t input;			/*!< Channel watched */
+	uint16_t low;			/*!< Low limit (raw) */
+	uint16_t high;			/*!< High limit (raw) */
+	volatile bool armed;	/*!< Interrupt enabled */
+	volatile bool fired;	/*!< Limits crossed since armed */
+	void (*func_p)(void*);	/*!< Pointer to the callback */
+	void *param_p;			/*!< User data for the callback */
+} adc_monitor_t;
+/**
+ * @brief End of a frame stored by the continuous driver
+ */
+typedef struct {
+	uint64_t time;			/*!< Conversion end time */
+	uint32_t end;			/*!< Bytes stored in the driver pool up to the end of the frame */
+} adc_frame_mark_t;
 /*==================[internal data declaration]==============================*/
 adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
 adc_oneshot_unit_handle_t adc1_single; 
 adc_continuous_handle_t adc2_cont;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+static const adc_channel_t adc_channel_map[ADC_CH_NUM] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
+static uint8_t adc_cont_scan = 0;				/*!< Bit mask of channels in the scan list */
+static uint32_t adc_cont_sample_frec = 0;		/*!< Sample frequency per channel */
+static uint16_t adc_cont_frame_size = ADC_CONT_DEFAULT_FRAME;
+static uint8_t adc_cont_ovs = 1;				/*!< Oversampling ratio */
+static uint8_t adc_cont_ovs_shift = 0;			/*!< log2 of oversampling ratio */
+static uint8_t adc_cont_dec_shift[ADC_CH_NUM] = {0};	/*!< log2 of the decimation of each channel */
+static uint8_t adc_cont_slots = 0;				/*!< Conversions per sample period of the full rate channels */
+static uint8_t adc_cont_filter[ADC_CH_NUM] = {0};	/*!< Hardware IIR filter coefficient of each channel (0: none) */
+static adc_cic_t adc_cic[ADC_CH_NUM];			/*!< Decimators state */
+static adc_frame_mark_t adc_frame_mark[ADC_TIMESTAMPS];	/*!< Latest stored frames (only written by the ISRs) */
+static volatile uint8_t adc_frame_mark_head = 0;	/*!< Next mark to write (only modified by the ISRs) */
+static volatile uint32_t adc_stored_bytes = 0;	/*!< Bytes stored in the driver pool since start (ISRs) */
+static uint32_t adc_frame_bytes_last = 0;		/*!< Size of the last converted frame (ISRs) */
+static uint32_t adc_read_bytes = 0;				/*!< Bytes read from the driver pool since start */
+static uint64_t adc_last_frame_time = 0;		/*!< Conversion end time of the last read sample */
+static bool adc_cont_running = false;
+static void (*adc_cont_isr_p)(void*) = NULL;	/*!< Pointer to the frame callback */
+static void *adc_cont_user_data = NULL;			/*!< User data for the frame callback */
+static uint8_t adc_cont_frame[ADC_CONT_BUF_SIZE];
+static analog_block_t adc_blocks[ADC_BLOCK_RING_SIZE];	/*!< Ring of preallocated blocks */
+static uint8_t adc_block_head = 0;				/*!< Next block to hand out */
+static uint8_t adc_block_in_use = 0;			/*!< Blocks handed out and not released */
+static adc_cali_handle_t *adc_cali_handles[ADC_CH_NUM] = {&adc_calibration_single_0, &adc_calibration_single_1, 
+														  &adc_calibration_single_2, &adc_calibration_single_3};
+static uint16_t *adc_mv_lut[ADC_CH_NUM] = {NULL};	/*!< Raw to mV lookup tables */
+static adc_monitor_t adc_monitor[ADC_MONITOR_NUM];	/*!< Threshold monitors */
+static intr_handle_t adc_monitor_intr = NULL;	/*!< APB_SARADC interrupt (the continuous driver uses the DMA one) */
+static gptimer_handle_t dac_stream_timer = NULL;	/*!< Timer that clocks the audio output */
+static ring_buffer_t dac_stream_rb;				/*!< Pulse densities waiting to be output */
+static int8_t dac_stream_storage[DAC_STREAM_BUFFER_SIZE];
+static uint32_t dac_stream_low_level = 0;		/*!< Stored samples that fire the refill callback */
+static volatile uint32_t dac_stream_underruns = 0;
+static int32_t dac_stream_error = 0;			/*!< Quantization error carried to the next PCM sample */
+static void (*dac_stream_isr_p)(void*) = NULL;	/*!< Pointer to the refill callback */
+static void *dac_stream_user_data = NULL;		/*!< User data for the refill callback */
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_cont_conv_done_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	// mark the frame end: AdcContReadFrame times the bytes it reads by their position in the pool
+	adc_frame_bytes_last = edata->size;
+	adc_stored_bytes += edata->size;
+	adc_frame_mark[adc_frame_mark_head & (ADC_TIMESTAMPS - 1)] = (adc_frame_mark_t){.time = TimeNowUs(), .end = adc_stored_bytes};
+	adc_frame_mark_head++;
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_user_data);
+	}
+	return true;
+}
+
+static bool IRAM_ATTR dac_stream_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	int8_t density;
+	if(RingBufferPop(&dac_stream_rb, &density)){
+		sdm_channel_set_pulse_density(dac, density);
+		// ask for more samples once per crossing of the low level
+		if(RingBufferCount(&dac_stream_rb) == dac_stream_low_level && dac_stream_isr_p != NULL){
+			dac_stream_isr_p(dac_stream_user_data);
+		}
+	}
+	else{
+		// the last sample is held until new samples are stored
+		dac_stream_underruns++;
+	}
+	return true;
+}
+static void IRAM_ATTR adc_monitor_isr(void *arg){
+	uint32_t status = APB_SARADC.int_st.val & ADC_MON_INT_ALL;
+	APB_SARADC.int_clr.val = status;
+	for(uint8_t m = 0; m < ADC_MONITOR_NUM; m++){
+		if(status & (ADC_MON_INT_HIGH(m) | ADC_MON_INT_LOW(m))){
+			// once per arm: a hit keeps the samples over the limits for many conversions
+			APB_SARADC.int_ena.val &= ~(ADC_MON_INT_HIGH(m) | ADC_MON_INT_LOW(m));
+			adc_monitor[m].armed = false;
+			adc_monitor[m].fired = true;
+			if(adc_monitor[m].func_p != NULL){
+				adc_monitor[m].func_p(adc_monitor[m].param_p);
+			}
+		}
+	}
+}
+
+static bool IRAM_ATTR adc_cont_pool_ovf_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	// the frame just marked by adc_cont_conv_done_isr (same DMA interrupt) was not stored
+	adc_stored_bytes -= adc_frame_bytes_last;
+	adc_frame_mark_head--;
+	return false;
+}
 
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
@@ -39,6 +181,200 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Read up to one DMA frame from the continuous driver (non blocking)
+ * 
+ * The conversion time of the last byte read comes from the count of bytes read: the
+ * first frame mark at or after it ends a run of contiguous conversions (the frames
+ * dropped by the driver are not counted), so it is timed back from that mark.
+ * 
+ * @return Number of bytes stored in adc_cont_frame
+ */
+static uint32_t AdcContReadFrame(void){
+	uint32_t read_bytes = 0;
+	uint32_t frame_bytes = adc_cont_frame_size * adc_cont_ovs * adc_cont_slots * SOC_ADC_DIGI_RESULT_BYTES;
+	uint32_t byte_rate = adc_cont_sample_frec * adc_cont_ovs * adc_cont_slots * SOC_ADC_DIGI_RESULT_BYTES;
+	const adc_frame_mark_t *mark = NULL;
+	if(!adc_cont_running){
+		return 0;
+	}
+	if(adc_continuous_read(adc2_cont, adc_cont_frame, frame_bytes, &read_bytes, 0) != ESP_OK){
+		return 0;
+	}
+	adc_read_bytes += read_bytes;
+	// newest to oldest; the slot the ISR writes next is skipped
+	uint8_t head = adc_frame_mark_head;
+	for(uint8_t k = 1; k < ADC_TIMESTAMPS; k++){
+		const adc_frame_mark_t *m = &adc_frame_mark[(uint8_t)(head - k) & (ADC_TIMESTAMPS - 1)];
+		if((int32_t)(m->end - adc_read_bytes) < 0){
+			break;
+		}
+		mark = m;
+	}
+	if(mark != NULL && byte_rate > 0){
+		adc_last_frame_time = mark->time - (uint64_t)(mark->end - adc_read_bytes) * 1000000ULL / byte_rate;
+	}
+	return read_bytes;
+}
+
+/**
+ * @brief Feed one raw sample to the channel decimator (2nd order CIC)
+ * 
+ * The CIC gain (ratio^2) is removed with a shift, so outputs keep the 12 bits scale
+ * with the noise averaged over the oversampled inputs.
+ * 
+ * @param ch Channel
+ * @param raw Raw sample
+ * @param out Decimated sample (only valid if true is returned)
+ * @return true if a new decimated sample is available
+ */
+static bool AdcContDecimate(uint8_t ch, uint16_t raw, uint16_t *out){
+	adc_cic_t *cic = &adc_cic[ch];
+	uint32_t c1, c2;
+	if(cic->shift == 0){
+		*out = raw;
+		return true;
+	}
+	cic->integ1 += raw;
+	cic->integ2 += cic->integ1;
+	if(++cic->count < (1 << cic->shift)){
+		return false;
+	}
+	cic->count = 0;
+	c1 = cic->integ2 - cic->comb1;
+	cic->comb1 = cic->integ2;
+	c2 = c1 - cic->comb2;
+	cic->comb2 = c1;
+	*out = (c2 + (1UL << (2 * cic->shift - 1))) >> (2 * cic->shift);
+	return true;
+}
+
+/**
+ * @brief Build the scan pattern of the continuous mode
+ * 
+ * Full rate channels take one slot in every row of the pattern. Slow channels share
+ * the slots that follow them: a channel converted every h rows takes 1 / h of a shared
+ * slot. The channels are converted more often than their decimation asks (h is
+ * lowered) to fill the shared slots, or to fit the pattern in SOC_ADC_PATT_LEN_MAX
+ * entries; their decimators take the rest of the ratio.
+ * 
+ * @param pattern Channel of each pattern entry
+ * @return Number of pattern entries (rows * adc_cont_slots)
+ */
+static uint8_t AdcContSchedule(uint8_t *pattern){
+	uint8_t hw_shift[ADC_CH_NUM] = {0};			// log2 of the rows between conversions of each channel
+	int8_t grid[1 << ADC_DEC_MAX_SHIFT][ADC_CH_NUM];	// channel of each shared slot of each row
+	uint8_t shared, rows_shift;
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		hw_shift[ch] = (adc_cont_scan & (1 << ch)) ? adc_cont_dec_shift[ch] : 0;
+	}
+	while(true){
+		// load of the shared slots, in 1 / ADC_CONT_MAX_DECIMATION of a slot per row
+		uint8_t load = 0, every_row = 0;
+		int8_t slowest = -1;
+		for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+			if(!(adc_cont_scan & (1 << ch))){
+				continue;
+			}
+			if(hw_shift[ch] == 0){
+				every_row++;
+			}else{
+				load += ADC_CONT_MAX_DECIMATION >> hw_shift[ch];
+				if(slowest < 0 || hw_shift[ch] > hw_shift[slowest]){
+					slowest = ch;
+				}
+			}
+		}
+		rows_shift = (slowest < 0) ? 0 : hw_shift[slowest];
+		shared = (load + ADC_CONT_MAX_DECIMATION - 1) / ADC_CONT_MAX_DECIMATION;
+		uint8_t free = shared * ADC_CONT_MAX_DECIMATION - load;
+		if(slowest >= 0 && (free >= (ADC_CONT_MAX_DECIMATION >> rows_shift) ||
+		   ((every_row + shared) << rows_shift) > SOC_ADC_PATT_LEN_MAX)){
+			hw_shift[slowest]--;
+			continue;
+		}
+		adc_cont_slots = every_row + shared;
+		break;
+	}
+	// shared slots: most frequent channels first, each one in the first column with its rows free
+	memset(grid, -1, sizeof(grid));
+	uint8_t rows = 1 << rows_shift;
+	for(uint8_t shift = 1; shift <= rows_shift; shift++){
+		uint8_t step = 1 << shift;
+		for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+			if(!(adc_cont_scan & (1 << ch)) || hw_shift[ch] != shift){
+				continue;
+			}
+			bool placed = false;
+			for(uint8_t c = 0; c < shared && !placed; c++){
+				for(uint8_t phase = 0; phase < step && !placed; phase++){
+					placed = true;
+					for(uint8_t r = phase; r < rows; r += step){
+						placed &= (grid[r][c] < 0);
+					}
+					for(uint8_t r = phase; r < rows && placed; r += step){
+						grid[r][c] = ch;
+					}
+				}
+			}
+		}
+	}
+	uint8_t n = 0;
+	for(uint8_t r = 0; r < rows; r++){
+		for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+			if((adc_cont_scan & (1 << ch)) && hw_shift[ch] == 0){
+				pattern[n++] = ch;
+			}
+		}
+		for(uint8_t c = 0; c < shared; c++){
+			pattern[n++] = grid[r][c];
+		}
+	}
+	// the decimators take the ratio left by the scan
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		adc_cic[ch].shift = adc_cont_ovs_shift + adc_cont_dec_shift[ch] - hw_shift[ch];
+	}
+	return n;
+}
+
+/**
+ * @brief Write the limits of a monitor to the digital controller and enable its interrupt
+ * 
+ * @param m Monitor number
+ */
+static void AdcMonitorStart(uint8_t m){
+	adc_ll_digi_monitor_set_thres(m, ADC_UNIT_1, adc_channel_map[adc_monitor[m].input], adc_monitor[m].high, adc_monitor[m].low);
+	adc_ll_digi_monitor_enable(m, true);
+	APB_SARADC.int_clr.val = ADC_MON_INT_HIGH(m) | ADC_MON_INT_LOW(m);
+	APB_SARADC.int_ena.val |= (adc_monitor[m].high < (ADC_LUT_SIZE - 1) ? ADC_MON_INT_HIGH(m) : 0) |
+							  (adc_monitor[m].low > 0 ? ADC_MON_INT_LOW(m) : 0);
+}
+
+/**
+ * @brief Enable the hardware IIR filters of the channels that ask for one (first channels first)
+ */
+static void AdcContFilters(void){
+	uint8_t f = 0;
+	for(uint8_t ch = 0; ch < ADC_CH_NUM && f < ADC_FILTER_NUM; ch++){
+		if(!(adc_cont_scan & (1 << ch)) || adc_cont_filter[ch] == 0){
+			continue;
+		}
+		adc_digi_iir_filter_coeff_t coeff;
+		switch(adc_cont_filter[ch]){
+			case 2:		coeff = ADC_DIGI_IIR_FILTER_COEFF_2;	break;
+			case 4:		coeff = ADC_DIGI_IIR_FILTER_COEFF_4;	break;
+			case 8:		coeff = ADC_DIGI_IIR_FILTER_COEFF_8;	break;
+			case 16:	coeff = ADC_DIGI_IIR_FILTER_COEFF_16;	break;
+			default:	coeff = ADC_DIGI_IIR_FILTER_COEFF_64;	break;
+		}
+		adc_ll_digi_filter_set_factor(ADC_UNIT_1, f, adc_channel_map[ch], coeff);
+		adc_ll_digi_filter_enable(f, ADC_UNIT_1, true);
+		f++;
+	}
+	for(; f < ADC_FILTER_NUM; f++){
+		adc_ll_digi_filter_enable(f, ADC_UNIT_1, false);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -99,19 +435,42 @@ void AnalogInputInit(analog_input_config_t *config){
 			}
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			// add channel to the scan list (pattern is configured on start)
+			adc_cont_scan |= (1 << config->input);
+			adc_cont_isr_p = config->func_p;
+			adc_cont_user_data = config->param_p;
+			adc_cont_sample_frec = config->sample_frec;
+			// oversampling ratio rounded down to a power of two
+			adc_cont_ovs_shift = 0;
+			while((2 << adc_cont_ovs_shift) <= config->oversampling && adc_cont_ovs_shift < ADC_OVS_MAX_SHIFT){
+				adc_cont_ovs_shift++;
+			}
+			adc_cont_ovs = 1 << adc_cont_ovs_shift;
+			// decimation of the channel rounded down to a power of two
+			adc_cont_dec_shift[config->input] = 0;
+			while((2 << adc_cont_dec_shift[config->input]) <= config->decimation && adc_cont_dec_shift[config->input] < ADC_DEC_MAX_SHIFT){
+				adc_cont_dec_shift[config->input]++;
+			}
+			// filter coefficient rounded down to a supported one
+			adc_cont_filter[config->input] = 0;
+			for(uint8_t k = 2; k <= 64; k *= 2){
+				if(k <= config->filter && k != 32){
+					adc_cont_filter[config->input] = k;
+				}
+			}
+			if(config->frame_size == 0){
+				adc_cont_frame_size = ADC_CONT_DEFAULT_FRAME;
+			}else{
+				adc_cont_frame_size = config->frame_size;
+			}
+			// the oversampled frame must fit the DMA frame buffer
+			if(adc_cont_frame_size > ADC_CONT_MAX_FRAME_SIZE / adc_cont_ovs){
+				adc_cont_frame_size = ADC_CONT_MAX_FRAME_SIZE / adc_cont_ovs;
+			}
+			// scan list changed, handle must be created again
+			if(adc2_cont != NULL && !adc_cont_running){
+				adc_continuous_deinit(adc2_cont);
+				adc2_cont = NULL;
 			}
 		break;
 	}
@@ -128,39 +487,409 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
+	int raw = 0;
     switch(channel){
 		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, &raw);
 		break;
 		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, &raw);
 		break;
 		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, &raw);
 		break;
 		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, &raw);
 		break;
 	}
+	*value = raw;
 }
 
-void AnalogStartContinuous(adc_ch_t channel){
-
+bool AnalogStartContinuous(adc_ch_t channel){
+	if(adc_cont_running){
+		return true;
+	}
+	if(!(adc_cont_scan & (1 << channel))){
+		return false;
+	}
+	if(adc2_cont == NULL){
+		uint8_t channels[SOC_ADC_PATT_LEN_MAX];
+		uint8_t n = AdcContSchedule(channels);
+		uint32_t frame_bytes = adc_cont_frame_size * adc_cont_ovs * adc_cont_slots * SOC_ADC_DIGI_RESULT_BYTES;
+		uint32_t sample_freq = adc_cont_sample_frec * adc_cont_ovs * adc_cont_slots;
+		// not clamped: the block timing (timestamps, sample_frec of the blocks) comes from the asked rate
+		if(sample_freq < SOC_ADC_SAMPLE_FREQ_THRES_LOW || sample_freq > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+			return false;
+		}
+		adc_continuous_handle_cfg_t handle_config = {
+			.max_store_buf_size = frame_bytes * ADC_CONT_FRAMES,
+			.conv_frame_size = frame_bytes,
+		};
+		ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc2_cont));
+		// one pattern entry per slot of the scan
+		adc_digi_pattern_config_t adc_pattern[SOC_ADC_PATT_LEN_MAX] = {0};
+		for(uint8_t i = 0; i < n; i++){
+			adc_pattern[i].atten = ADC_ATTENUATION;
+			adc_pattern[i].channel = adc_channel_map[channels[i]];
+			adc_pattern[i].unit = ADC_UNIT_1;
+			adc_pattern[i].bit_width = ADC_BITWIDTH;
+		}
+		adc_continuous_config_t dig_config = {
+			.pattern_num = n,
+			.adc_pattern = adc_pattern,
+			.sample_freq_hz = sample_freq,
+			.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+			.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+		};
+		ESP_ERROR_CHECK(adc_continuous_config(adc2_cont, &dig_config));
+		adc_continuous_evt_cbs_t cont_cbs = {
+			.on_conv_done = adc_cont_conv_done_isr,
+			.on_pool_ovf = adc_cont_pool_ovf_isr,
+		};
+		ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc2_cont, &cont_cbs, NULL));
+	}
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		adc_cic[ch] = (adc_cic_t){.shift = adc_cic[ch].shift};
+	}
+	// the driver is stopped: the ISRs do not touch the marks
+	memset(adc_frame_mark, 0, sizeof(adc_frame_mark));
+	adc_stored_bytes = 0;
+	adc_read_bytes = 0;
+	ESP_ERROR_CHECK(adc_continuous_start(adc2_cont));
+	adc_cont_running = true;
+	// the controller is configured again on start, the filters and the armed monitors too
+	AdcContFilters();
+	for(uint8_t m = 0; m < ADC_MONITOR_NUM; m++){
+		if(adc_monitor[m].armed){
+			AdcMonitorStart(m);
+		}
+	}
+	return true;
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	if(adc_cont_running){
+		adc_continuous_stop(adc2_cont);
+		adc_cont_running = false;
+	}
+}
+
+uint64_t AnalogInputGetFrameTime(void){
+	return adc_last_frame_time;
+}
+
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	uint16_t n = 0;
+	uint16_t sample;
+	uint32_t read_bytes = AdcContReadFrame();
+	// de-interleave (and decimate) the selected channel samples
+	for(uint32_t i = 0; i < read_bytes; i += SOC_ADC_DIGI_RESULT_BYTES){
+		adc_digi_output_data_t *p = (adc_digi_output_data_t*)&adc_cont_frame[i];
+		if(p->type2.channel == adc_channel_map[channel] && AdcContDecimate(channel, p->type2.data, &sample)){
+			if(n < adc_cont_frame_size){
+				values[n++] = sample;
+			}
+		}
+	}
+	return n;
+}
+
+analog_block_t* AnalogInputGetBlock(void){
+	analog_block_t *block;
+	uint32_t read_bytes;
+	if(adc_block_in_use >= ADC_BLOCK_RING_SIZE){
+		return NULL;
+	}
+	read_bytes = AdcContReadFrame();
+	if(read_bytes == 0){
+		return NULL;
+	}
+	block = &adc_blocks[adc_block_head];
+	block->channels = adc_cont_scan;
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		block->lenght[ch] = 0;
+	}
+	// timestamp from the first full rate channel (or the first scanned one)
+	int8_t ch_first = -1;
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		block->decimation[ch] = 1 << adc_cont_dec_shift[ch];
+		if((adc_cont_scan & (1 << ch)) && (ch_first < 0 || (adc_cont_dec_shift[ch] < adc_cont_dec_shift[ch_first]))){
+			ch_first = ch;
+		}
+	}
+	// de-interleave (and decimate) all scanned channels
+	for(uint32_t i = 0; i < read_bytes; i += SOC_ADC_DIGI_RESULT_BYTES){
+		adc_digi_output_data_t *p = (adc_digi_output_data_t*)&adc_cont_frame[i];
+		uint8_t ch = p->type2.channel;
+		uint16_t sample;
+		if(ch < ADC_CH_NUM && AdcContDecimate(ch, p->type2.data, &sample)){
+			if(block->lenght[ch] < ADC_CONT_MAX_FRAME_SIZE){
+				block->data[ch][block->lenght[ch]++] = sample;
+			}
+		}
+	}
+	// timestamp of the first sample of the block
+	block->sample_frec = adc_cont_sample_frec;
+	block->timestamp = adc_last_frame_time;
+	if(adc_cont_sample_frec > 0 && ch_first >= 0 && block->lenght[ch_first] > 0){
+		block->timestamp -= ((uint64_t)(block->lenght[ch_first] - 1) * block->decimation[ch_first] * 1000000ULL) / adc_cont_sample_frec;
+	}
+	adc_block_head = (adc_block_head + 1) % ADC_BLOCK_RING_SIZE;
+	adc_block_in_use++;
+	return block;
+}
+
+void AnalogInputReleaseBlock(analog_block_t *block){
+	if(block != NULL && adc_block_in_use > 0){
+		adc_block_in_use--;
+	}
+}
+
+bool AnalogInputSkipBlock(void){
+	return AdcContReadFrame() > 0;
+}
+
+int8_t AnalogInputMonitorInit(analog_monitor_config_t *config){
+	int8_t m = 0;
+	while(m < ADC_MONITOR_NUM && adc_monitor[m].used){
+		m++;
+	}
+	if(m == ADC_MONITOR_NUM){
+		return -1;
+	}
+	if(adc_monitor_intr == NULL &&
+	   esp_intr_alloc(ETS_APB_ADC_INTR_SOURCE, ESP_INTR_FLAG_IRAM, adc_monitor_isr, NULL, &adc_monitor_intr) != ESP_OK){
+		return -1;
+	}
+	adc_monitor[m] = (adc_monitor_t){
+		.used = true,
+		.input = config->input,
+		.high = ADC_LUT_SIZE - 1,
+		.func_p = config->func_p,
+		.param_p = config->param_p,
+	};
+	return m;
+}
+
+void AnalogInputMonitorArm(uint8_t monitor, uint16_t low, uint16_t high){
+	if(monitor >= ADC_MONITOR_NUM || !adc_monitor[monitor].used){
+		return;
+	}
+	esp_intr_disable(adc_monitor_intr);
+	adc_monitor[monitor].low = low;
+	adc_monitor[monitor].high = (high < ADC_LUT_SIZE) ? high : ADC_LUT_SIZE - 1;
+	adc_monitor[monitor].fired = false;
+	adc_monitor[monitor].armed = true;
+	AdcMonitorStart(monitor);
+	esp_intr_enable(adc_monitor_intr);
+}
+
+void AnalogInputMonitorDisarm(uint8_t monitor){
+	if(monitor >= ADC_MONITOR_NUM || !adc_monitor[monitor].used){
+		return;
+	}
+	esp_intr_disable(adc_monitor_intr);
+	APB_SARADC.int_ena.val &= ~(ADC_MON_INT_HIGH(monitor) | ADC_MON_INT_LOW(monitor));
+	adc_ll_digi_monitor_enable(monitor, false);
+	adc_monitor[monitor].armed = false;
+	adc_monitor[monitor].fired = false;
+	esp_intr_enable(adc_monitor_intr);
+}
+
+bool AnalogInputMonitorFired(uint8_t monitor){
+	return (monitor < ADC_MONITOR_NUM) && adc_monitor[monitor].fired;
+}
+
+void AnalogBlockToFloat(const analog_block_t *block, adc_ch_t channel, float *values){
+	const uint16_t *lut = adc_mv_lut[channel];
+	if(lut != NULL){
+		for(uint16_t i = 0; i < block->lenght[channel]; i++){
+			values[i] = lut[block->data[channel][i]];
+		}
+	}else{
+		for(uint16_t i = 0; i < block->lenght[channel]; i++){
+			values[i] = block->data[channel][i] * ADC_RAW_TO_MV;
+		}
+	}
+}
 
+void AnalogBlockToMv(const analog_block_t *block, adc_ch_t channel, uint16_t *values){
+	const uint16_t *lut = adc_mv_lut[channel];
+	if(lut != NULL){
+		for(uint16_t i = 0; i < block->lenght[channel]; i++){
+			values[i] = lut[block->data[channel][i]];
+		}
+	}else{
+		for(uint16_t i = 0; i < block->lenght[channel]; i++){
+			values[i] = block->data[channel][i] * ADC_RAW_TO_MV;
+		}
+	}
+}
+
+bool AnalogInputLUTInit(adc_ch_t channel){
+	int mv;
+	if(adc_mv_lut[channel] != NULL){
+		return true;
+	}
+	// continuous mode channels do not have a calibration scheme yet
+	if(*adc_cali_handles[channel] == NULL){
+		adc_cali_curve_fitting_config_t cali_config = {
+			.unit_id = ADC_UNIT_1,
+			.chan = adc_channel_map[channel], 
+			.atten = ADC_ATTENUATION,
+			.bitwidth = ADC_BITWIDTH,
+		};
+		if(adc_cali_create_scheme_curve_fitting(&cali_config, adc_cali_handles[channel]) != ESP_OK){
+			return false;
+		}
+	}
+	adc_mv_lut[channel] = malloc(ADC_LUT_SIZE * sizeof(uint16_t));
+	if(adc_mv_lut[channel] == NULL){
+		return false;
+	}
+	for(uint16_t raw = 0; raw < ADC_LUT_SIZE; raw++){
+		adc_cali_raw_to_voltage(*adc_cali_handles[channel], raw, &mv);
+		adc_mv_lut[channel][raw] = mv;
+	}
+	return true;
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+const uint16_t* AnalogInputGetLUT(adc_ch_t channel){
+	return adc_mv_lut[channel];
+}
 
+uint16_t SAMPLE_PATH_ATTR AnalogRawToMv(adc_ch_t channel, uint16_t raw){
+	const uint16_t *lut = adc_mv_lut[channel];
+	raw &= ADC_LUT_SIZE - 1;
+	return (lut != NULL) ? lut[raw] : raw * ADC_RAW_TO_MV;
 }
 
-void AnalogOutputWrite(uint8_t value){
+void SAMPLE_PATH_ATTR AnalogOutputWrite(uint8_t value){
 	int8_t density = value - 128;
 	sdm_channel_set_pulse_density(dac, density);
 }
 
+bool AnalogOutputStreamInit(analog_output_stream_config_t *config){
+	if(config->sample_rate == 0 || config->sample_rate > DAC_STREAM_RES_HZ / 100){
+		return false;
+	}
+	if(dac == NULL){
+		AnalogOutputInit();
+	}
+	RingBufferInit(&dac_stream_rb, dac_stream_storage, sizeof(int8_t), DAC_STREAM_BUFFER_SIZE);
+	dac_stream_low_level = (config->low_level == 0) ? (DAC_STREAM_BUFFER_SIZE / 2) : config->low_level;
+	dac_stream_isr_p = config->func_p;
+	dac_stream_user_data = config->param_p;
+	dac_stream_underruns = 0;
+	dac_stream_error = 0;
+	if(dac_stream_timer == NULL){
+		gptimer_config_t timer_config = {
+			.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+			.direction = GPTIMER_COUNT_UP,
+			.resolution_hz = DAC_STREAM_RES_HZ,
+		};
+		if(gptimer_new_timer(&timer_config, &dac_stream_timer) != ESP_OK){
+			dac_stream_timer = NULL;
+			return false;
+		}
+		gptimer_event_callbacks_t callbacks = {
+			.on_alarm = dac_stream_isr,
+		};
+		gptimer_register_event_callbacks(dac_stream_timer, &callbacks, NULL);
+		gptimer_enable(dac_stream_timer);
+	}
+	// rounded to the nearest timer tick (exact for sample rates that divide 10 MHz)
+	gptimer_alarm_config_t alarm_config = {
+		.alarm_count = (DAC_STREAM_RES_HZ + config->sample_rate / 2) / config->sample_rate,
+		.reload_count = 0,
+		.flags.auto_reload_on_alarm = true,
+	};
+	gptimer_set_alarm_action(dac_stream_timer, &alarm_config);
+	return true;
+}
+
+void AnalogOutputStreamStart(void){
+	gptimer_start(dac_stream_timer);
+}
+
+void AnalogOutputStreamStop(void){
+	gptimer_stop(dac_stream_timer);
+	RingBufferFlush(&dac_stream_rb);
+	sdm_channel_set_pulse_density(dac, 0);
+	dac_stream_error = 0;
+}
+
+uint32_t AnalogOutputStreamWrite(const uint8_t *values, uint32_t lenght){
+	int8_t density[DAC_STREAM_CHUNK];
+	uint32_t stored = 0;
+	while(stored < lenght){
+		uint32_t n = lenght - stored;
+		if(n > DAC_STREAM_CHUNK){
+			n = DAC_STREAM_CHUNK;
+		}
+		for(uint32_t i = 0; i < n; i++){
+			density[i] = values[stored + i] - 128;
+		}
+		uint32_t written = RingBufferWrite(&dac_stream_rb, density, n);
+		stored += written;
+		if(written < n){
+			break;
+		}
+	}
+	return stored;
+}
+
+uint32_t AnalogOutputStreamWritePCM(const int16_t *values, uint32_t lenght, float gain){
+	int8_t density[DAC_STREAM_CHUNK];
+	int32_t g = lrintf(gain * (1 << DAC_PCM_GAIN_SHIFT));
+	int32_t error = dac_stream_error;
+	uint32_t room = RingBufferFree(&dac_stream_rb);
+	uint32_t stored = 0;
+	if(g > INT16_MAX){
+		g = INT16_MAX;
+	}
+	else if(g < 0){
+		g = 0;
+	}
+	// samples that don't fit are not converted, so the error feedback stays continuous
+	if(lenght > room){
+		lenght = room;
+	}
+	while(stored < lenght){
+		uint32_t n = lenght - stored;
+		if(n > DAC_STREAM_CHUNK){
+			n = DAC_STREAM_CHUNK;
+		}
+		for(uint32_t i = 0; i < n; i++){
+			int32_t v = values[stored + i] * g + error;
+			int32_t d = (v + (1 << (DAC_PCM_SHIFT - 1))) >> DAC_PCM_SHIFT;
+			if(d > INT8_MAX){
+				d = INT8_MAX;
+			}
+			else if(d < INT8_MIN){
+				d = INT8_MIN;
+			}
+			error = v - d * (1 << DAC_PCM_SHIFT);
+			// the error of saturated samples is not fed back
+			if(error >= (1 << (DAC_PCM_SHIFT - 1)) || error < -(1 << (DAC_PCM_SHIFT - 1))){
+				error = 0;
+			}
+			density[i] = d;
+		}
+		stored += RingBufferWrite(&dac_stream_rb, density, n);
+	}
+	dac_stream_error = error;
+	return stored;
+}
+
+uint32_t AnalogOutputStreamFree(void){
+	return RingBufferFree(&dac_stream_rb);
+}
+
+uint32_t AnalogOutputStreamGetUnderruns(void){
+	return dac_stream_underruns;
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,185 @@
+/**
+ * @file audio_out_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "audio_out_mcu.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "driver/i2s_std.h"
+#include "driver/i2s_pdm.h"
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_BYTES		sizeof(int16_t)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static i2s_chan_handle_t tx_chan = NULL;
+static bool running = false;
+static volatile uint32_t queued = 0;			/* Samples written and not sent yet */
+static volatile uint32_t underruns = 0;
+static uint32_t low_level;
+static void (*refill_p)(void *param) = NULL;
+static void *refill_param = NULL;
+static portMUX_TYPE audio_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief A DMA buffer was sent: its samples leave the queue
+ */
+static IRAM_ATTR bool AudioOutSent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx){
+	uint32_t samples = event->size / SAMPLE_BYTES;
+	bool refill;
+	taskENTER_CRITICAL_ISR(&audio_mux);
+	uint32_t before = queued;
+	if(samples > before){
+		// the buffer was (partially) filled with silence
+		samples = before;
+		underruns++;
+	}
+	queued = before - samples;
+	refill = (before > low_level) && (queued <= low_level);
+	taskEXIT_CRITICAL_ISR(&audio_mux);
+	if(refill && refill_p != NULL){
+		refill_p(refill_param);
+	}
+	return false;
+}
+
+/**
+ * @brief Copy samples to the DMA buffers (preloaded while stopped)
+ */
+static uint32_t AudioOutCopy(const int16_t *values, uint32_t lenght){
+	size_t bytes = 0;
+	if(running){
+		i2s_channel_write(tx_chan, values, lenght * SAMPLE_BYTES, &bytes, 0);
+	}else{
+		i2s_channel_preload_data(tx_chan, values, lenght * SAMPLE_BYTES, &bytes);
+	}
+	uint32_t n = bytes / SAMPLE_BYTES;
+	taskENTER_CRITICAL(&audio_mux);
+	queued += n;
+	taskEXIT_CRITICAL(&audio_mux);
+	return n;
+}
+
+/*==================[external functions definition]==========================*/
+bool AudioOutInit(const audio_out_config_t *config){
+	if(tx_chan != NULL || config->sample_rate == 0){
+		return false;
+	}
+	i2s_chan_config_t chan_config = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+	chan_config.dma_desc_num = AUDIO_OUT_DMA_BUFFERS;
+	chan_config.dma_frame_num = AUDIO_OUT_DMA_FRAME;
+	// silence instead of repeating the last buffer on underruns
+	chan_config.auto_clear = true;
+	if(i2s_new_channel(&chan_config, &tx_chan, NULL) != ESP_OK){
+		return false;
+	}
+	esp_err_t err;
+	if(config->mode == AUDIO_OUT_PDM){
+		i2s_pdm_tx_config_t pdm_config = {
+			.clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(config->sample_rate),
+			.slot_cfg = I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+			.gpio_cfg = {
+				.clk = (gpio_num_t)config->bclk,
+				.dout = (gpio_num_t)config->dout,
+			},
+		};
+		err = i2s_channel_init_pdm_tx_mode(tx_chan, &pdm_config);
+	}else{
+		i2s_std_config_t std_config = {
+			.clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(config->sample_rate),
+			.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+			.gpio_cfg = {
+				.mclk = I2S_GPIO_UNUSED,
+				.bclk = (gpio_num_t)config->bclk,
+				.ws = (gpio_num_t)config->ws,
+				.dout = (gpio_num_t)config->dout,
+				.din = I2S_GPIO_UNUSED,
+			},
+		};
+		err = i2s_channel_init_std_mode(tx_chan, &std_config);
+	}
+	i2s_event_callbacks_t callbacks = {
+		.on_sent = AudioOutSent,
+	};
+	if(err != ESP_OK || i2s_channel_register_event_callback(tx_chan, &callbacks, NULL) != ESP_OK){
+		i2s_del_channel(tx_chan);
+		tx_chan = NULL;
+		return false;
+	}
+	low_level = (config->low_level > 0) ? config->low_level : AUDIO_OUT_BUFFER_SIZE / 2;
+	refill_p = config->func_p;
+	refill_param = config->param_p;
+	queued = 0;
+	underruns = 0;
+	running = false;
+	return true;
+}
+
+void AudioOutStart(void){
+	if(tx_chan != NULL && !running){
+		running = (i2s_channel_enable(tx_chan) == ESP_OK);
+	}
+}
+
+void AudioOutStop(void){
+	if(tx_chan != NULL && running){
+		i2s_channel_disable(tx_chan);
+		running = false;
+		taskENTER_CRITICAL(&audio_mux);
+		queued = 0;
+		taskEXIT_CRITICAL(&audio_mux);
+	}
+}
+
+uint32_t AudioOutWrite(const int16_t *values, uint32_t lenght, float gain){
+	if(tx_chan == NULL){
+		return 0;
+	}
+	uint32_t free = AudioOutFree();
+	if(lenght > free){
+		lenght = free;
+	}
+	if(gain == 1.0f){
+		return AudioOutCopy(values, lenght);
+	}
+	// scaled by blocks of one DMA buffer: a single pass over the samples
+	int16_t block[AUDIO_OUT_DMA_FRAME];
+	uint32_t written = 0;
+	while(written < lenght){
+		uint32_t n = (lenght - written > AUDIO_OUT_DMA_FRAME) ? AUDIO_OUT_DMA_FRAME : lenght - written;
+		for(uint32_t i = 0; i < n; i++){
+			int32_t v = (int32_t)(values[written + i] * gain);
+			block[i] = (v > INT16_MAX) ? INT16_MAX : (v < INT16_MIN) ? INT16_MIN : v;
+		}
+		uint32_t copied = AudioOutCopy(block, n);
+		written += copied;
+		if(copied < n){
+			break;
+		}
+	}
+	return written;
+}
+
+uint32_t AudioOutFree(void){
+	uint32_t n = queued;
+	return (n < AUDIO_OUT_BUFFER_SIZE) ? AUDIO_OUT_BUFFER_SIZE - n : 0;
+}
+
+uint32_t AudioOutGetUnderruns(void){
+	return underruns;
+}
+
+/*==================[end of file]============================================*/
@@ -23,6 +23,7 @@
 #include "esp_gatts_api.h"
 #include "esp_bt_defs.h"
 #include "esp_bt_main.h"
+#include "esp_timer.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -34,10 +35,23 @@
 #define HID_KEYBOARD_IN_RPT_LEN     		8
 // HID LED output report length
 #define HID_LED_OUT_RPT_LEN         		1
-// HID mouse input report length
-#define HID_MOUSE_IN_RPT_LEN        		5
+// HID mouse input report length (buttons, 16 bits X and Y, wheel)
+#define HID_MOUSE_IN_RPT_LEN        		6
+// HID boot mouse input report length (buttons, 8 bits X and Y)
+#define HID_BOOT_MOUSE_IN_RPT_LEN   		3
 // HID consumer control input report length
 #define HID_CC_IN_RPT_LEN           		2
+// Mouse accumulator flush period until the connection interval is known (us)
+#define HID_MOUSE_FLUSH_DEFAULT_US  		15000
+// Connection interval unit (us)
+#define HID_CONN_INT_UNIT_US        		1250
+// High rate connection parameters: 7.5 to 11.25 ms interval, no slave latency, 4 s timeout
+#define HID_HIGH_RATE_INT_MIN       		6
+#define HID_HIGH_RATE_INT_MAX       		9
+// Default connection parameters: 30 to 50 ms interval
+#define HID_LOW_RATE_INT_MIN        		24
+#define HID_LOW_RATE_INT_MAX        		40
+#define HID_CONN_TIMEOUT            		400
 /*************************hid_dev**************************/
 /* HID Report type */
 #define HID_TYPE_INPUT       				1
@@ -531,12 +545,17 @@ static const uint8_t hidReportMap[] = {
     0x05, 0x01,  //     Usage Page (Generic Desktop)
     0x09, 0x30,  //     Usage (X)
     0x09, 0x31,  //     Usage (Y)
+    0x16, 0x01, 0x80,  //     Logical Minimum (-32767)
+    0x26, 0xFF, 0x7F,  //     Logical Maximum (32767)
+    0x75, 0x10,  //     Report Size (16)
+    0x95, 0x02,  //     Report Count (2)
+    0x81, 0x06,  //     Input (Data, Variable, Relative) - X & Y coordinate
     0x09, 0x38,  //     Usage (Wheel)
     0x15, 0x81,  //     Logical Minimum (-127)
     0x25, 0x7F,  //     Logical Maximum (127)
     0x75, 0x08,  //     Report Size (8)
-    0x95, 0x03,  //     Report Count (3)
-    0x81, 0x06,  //     Input (Data, Variable, Relative) - X & Y coordinate
+    0x95, 0x01,  //     Report Count (1)
+    0x81, 0x06,  //     Input (Data, Variable, Relative) - Wheel
     0xC0,        //   End Collection
     0xC0,        // End Collection
 
@@ -952,6 +971,14 @@ static esp_ble_adv_params_t hidd_adv_params = {
 static uint16_t hid_conn_id = 0;
 static bool sec_conn = false;
 ble_status_t status = BLE_OFF;
+static esp_bd_addr_t remote_bda;
+/* Mouse accumulator: deltas are added between connection events and sent once per interval */
+static esp_timer_handle_t mouse_timer = NULL;
+static portMUX_TYPE mouse_mux = portMUX_INITIALIZER_UNLOCKED;
+static int32_t mouse_acc_x = 0, mouse_acc_y = 0;
+static uint8_t mouse_buttons = 0, mouse_sent_buttons = 0;
+static uint32_t mouse_period_us = HID_MOUSE_FLUSH_DEFAULT_US;
+static bool high_rate = false;
 
 /*==================[external data definition]===============================*/
 /********************esp_hidd_prf_api**********************/
@@ -1286,6 +1313,67 @@ static void hid_add_id_tbl(void){
 }
 
 /***************************hidd****************************/
+/**
+ * @brief Send a mouse report with the format of the current protocol mode
+ */
+static void hid_mouse_send(uint8_t buttons, int16_t delta_x, int16_t delta_y){
+    uint8_t buffer[HID_MOUSE_IN_RPT_LEN];
+    uint8_t length;
+    buffer[0] = buttons;                    // Buttons
+    if(hidProtocolMode == HID_PROTOCOL_MODE_BOOT){
+        buffer[1] = (int8_t)delta_x;        // X
+        buffer[2] = (int8_t)delta_y;        // Y
+        length = HID_BOOT_MOUSE_IN_RPT_LEN;
+    }else{
+        buffer[1] = delta_x & 0xFF;         // X
+        buffer[2] = (uint16_t)delta_x >> 8;
+        buffer[3] = delta_y & 0xFF;         // Y
+        buffer[4] = (uint16_t)delta_y >> 8;
+        buffer[5] = 0;                      // Wheel
+        length = HID_MOUSE_IN_RPT_LEN;
+    }
+    hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
+                        HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT, length, buffer);
+}
+/**
+ * @brief Send the motion accumulated since the last connection interval (esp_timer callback)
+ * 
+ * Deltas beyond the report range are kept for the next interval, so fast motion is not lost.
+ */
+static void hid_mouse_flush(void *arg){
+    int32_t limit = (hidProtocolMode == HID_PROTOCOL_MODE_BOOT) ? INT8_MAX : INT16_MAX;
+    taskENTER_CRITICAL(&mouse_mux);
+    int32_t dx = (mouse_acc_x > limit) ? limit : (mouse_acc_x < -limit) ? -limit : mouse_acc_x;
+    int32_t dy = (mouse_acc_y > limit) ? limit : (mouse_acc_y < -limit) ? -limit : mouse_acc_y;
+    mouse_acc_x -= dx;
+    mouse_acc_y -= dy;
+    uint8_t buttons = mouse_buttons;
+    taskEXIT_CRITICAL(&mouse_mux);
+    if(status != BLE_CONNECTED || (dx == 0 && dy == 0 && buttons == mouse_sent_buttons)){
+        return;
+    }
+    mouse_sent_buttons = buttons;
+    hid_mouse_send(buttons, dx, dy);
+}
+/**
+ * @brief Restart the mouse accumulator flush with the current connection interval
+ */
+static void hid_mouse_timer_start(void){
+    esp_timer_stop(mouse_timer);
+    esp_timer_start_periodic(mouse_timer, mouse_period_us);
+}
+/**
+ * @brief Request the connection parameters of the current rate mode
+ */
+static void hid_update_conn_params(void){
+    esp_ble_conn_update_params_t conn_params = {0};
+    memcpy(conn_params.bda, remote_bda, sizeof(esp_bd_addr_t));
+    conn_params.min_int = high_rate ? HID_HIGH_RATE_INT_MIN : HID_LOW_RATE_INT_MIN;
+    conn_params.max_int = high_rate ? HID_HIGH_RATE_INT_MAX : HID_LOW_RATE_INT_MAX;
+    conn_params.latency = 0;
+    conn_params.timeout = HID_CONN_TIMEOUT;
+    esp_ble_gap_update_conn_params(&conn_params);
+}
 static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *param){
     switch(event) {
         case ESP_HIDD_EVENT_REG_FINISH: {
@@ -1312,6 +1400,12 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
             sec_conn = false;
             ESP_LOGI(TAG, "ESP_HIDD_EVENT_BLE_DISCONNECT");
             status = BLE_DISCONNECTED;
+            esp_timer_stop(mouse_timer);
+            taskENTER_CRITICAL(&mouse_mux);
+            mouse_acc_x = mouse_acc_y = 0;
+            mouse_buttons = mouse_sent_buttons = 0;
+            taskEXIT_CRITICAL(&mouse_mux);
+            mouse_period_us = HID_MOUSE_FLUSH_DEFAULT_US;
             esp_ble_gap_start_advertising(&hidd_adv_params);
             break;
         }
@@ -1356,6 +1450,22 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
         if(!param->ble_security.auth_cmpl.success) {
             ESP_LOGE(TAG, "fail reason = 0x%x",param->ble_security.auth_cmpl.fail_reason);
         }
+        memcpy(remote_bda, bd_addr, sizeof(esp_bd_addr_t));
+        if(high_rate){
+            hid_update_conn_params();
+        }
+        hid_mouse_timer_start();
+        break;
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+        /* the accumulated motion is sent once per connection interval */
+        ESP_LOGI(TAG, "conn interval %d x 1.25 ms, latency %d", param->update_conn_params.conn_int,
+                param->update_conn_params.latency);
+        if(param->update_conn_params.conn_int > 0){
+            mouse_period_us = param->update_conn_params.conn_int * HID_CONN_INT_UNIT_US;
+        }
+        if(status == BLE_CONNECTED){
+            hid_mouse_timer_start();
+        }
         break;
     default:
         break;
@@ -1412,6 +1522,11 @@ void BleHidInit(char * hid_dev_name){
     esp_ble_gap_set_security_param(ESP_BLE_SM_MAX_KEY_SIZE, &key_size, sizeof(uint8_t));
     esp_ble_gap_set_security_param(ESP_BLE_SM_SET_INIT_KEY, &init_key, sizeof(uint8_t));
     esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
+    esp_timer_create_args_t mouse_timer_args = {
+        .callback = hid_mouse_flush,
+        .name = "hid_mouse"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&mouse_timer_args, &mouse_timer));
 }
 
 ble_status_t BleHidStatus(void){
@@ -1441,17 +1556,28 @@ void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cm
 }
 
 void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y){
-    uint8_t buffer[HID_MOUSE_IN_RPT_LEN];
-    buffer[0] = mouse_button;       // Buttons
-    buffer[1] = delta_x;            // X
-    buffer[2] = delta_y;            // Y
-    buffer[3] = 0;                  // Wheel
-    buffer[4] = 0;                  // AC Pan
     if(status == BLE_CONNECTED){
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT, HID_MOUSE_IN_RPT_LEN, buffer);
+        hid_mouse_send(mouse_button, delta_x, delta_y);
     }
     return;
 }
 
+void BleHidMoveMouse(mouse_cmd_t mouse_button, int16_t delta_x, int16_t delta_y){
+    if(status != BLE_CONNECTED){
+        return;
+    }
+    taskENTER_CRITICAL(&mouse_mux);
+    mouse_acc_x += delta_x;
+    mouse_acc_y += delta_y;
+    mouse_buttons = mouse_button;
+    taskEXIT_CRITICAL(&mouse_mux);
+}
+
+void BleHidHighRate(bool enable){
+    high_rate = enable;
+    if(status == BLE_CONNECTED){
+        hid_update_conn_params();
+    }
+}
+
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -23,19 +23,36 @@
 #include "esp_gatts_api.h"
 #include "esp_bt_defs.h"
 #include "esp_bt_main.h"
+#include "esp_gatt_common_api.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "ring_buffer_mcu.h"
+#include "mem_pool_mcu.h"
+#include "static_alloc_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "ble_mcu"
-#define MTU_MAX_BYTES		20	 /* GATT Maximum Transmission Unit */
-#define PAYLOAD_SIZE        128  /* Maximun number of bytes transmitted in one transaction */
+#define ATT_HEADER_BYTES	3	 /* ATT header of a notification (opcode and handle) */
+#define BLE_DATA_LEN_MAX	251	 /* Max LL payload with data length extension (BLE 4.2 / 5) */
+#define PAYLOAD_SIZE        (BLE_MTU_MAX - ATT_HEADER_BYTES)  /* Maximun number of bytes transmitted in one transaction */
 #define SPP_PROFILE_NUM     1       
 #define SPP_PROFILE_APP_IDX 0
 #define ESP_SPP_APP_ID      0x56
 #define SPP_SVC_INST_ID     0
-#define SPP_DATA_MAX_LEN    (128) /* Maximun number of bytes transmitted in one transaction */
+#define SENSOR_SVC_INST_ID  1
+#define SPP_DATA_MAX_LEN    PAYLOAD_SIZE /* Maximun number of bytes transmitted in one transaction */
+#define BLE_TX_MSG_HEADER	sizeof(tx_msg_t)	/* Header of each message stored in the TX ring */
+#define BLE_TX_CREDITS		4	 /* Notifications handed to the stack and not yet sent (ESP_GATTS_CONF_EVT) */
+#define BLE_TX_CREDIT_TIMEOUT_MS	100	/* Wait for a credit before assuming it was lost */
+#define BLE_TX_WAIT_MS		10	 /* Period of the free space checks of BleSendBuffer */
+#define BLE_EVENTS_QUEUE	10	 /* Events waiting for bluetooth_events_task */
+#define BLE_READ_QUEUE		10	 /* Received data waiting for read_task */
+#define CMD_NONE			0xFF	 /* Opcode without entry in the command table */
+#define BLE_RX_BLOCKS		BLE_READ_QUEUE	 /* Payloads of the received data (pool blocks) */
 /* List of attributes to be added to the service database */
 enum{
     SPP_IDX_SVC,
@@ -46,12 +63,37 @@ enum{
     SPP_IDX_SPP_DATA_RECV_CFG,
     SPP_IDX_NB,
 };
+/* List of attributes of the BLE-MIDI service (the data value has the same index as in the SPP service) */
+enum{
+    MIDI_IDX_SVC,
+    MIDI_IDX_IO_CHAR,
+    MIDI_IDX_IO_VAL,
+    MIDI_IDX_IO_CFG,
+    MIDI_IDX_NB,
+};
+/* Attributes of each stream of the sensor service (after the service declaration) */
+enum{
+    STREAM_IDX_CHAR,
+    STREAM_IDX_VAL,
+    STREAM_IDX_CFG,
+    STREAM_IDX_DESC,
+    STREAM_IDX_NB,
+};
+#define SENSOR_IDX_NB(n)    (1 + (n) * STREAM_IDX_NB)   /* Attributes of the sensor service with n streams */
+#define SENSOR_IDX(s, a)    (1 + (s) * STREAM_IDX_NB + (a)) /* Attribute a of stream s */
+_Static_assert((int)MIDI_IDX_IO_VAL == (int)SPP_IDX_SPP_DATA_NOTIFY_VAL, "BleSendBuffer notifies the same index in both services");
 /* Characteristics UUID */
 #define ESP_GATT_UUID_SPP_SERVICE               0xFFE0  /* Service ID */
 #define ESP_GATT_UUID_SPP_DATA_RECEIVE_NOTIFY   0xFFE1  /* Characteristic ID */
 
 #define ADV_CONFIG_FLAG			                (1 << 0)
 #define SCAN_RSP_CONFIG_FLAG	                (1 << 1)
+
+#define BC_INSTANCE			0		/* Extended advertising set of the broadcast mode */
+#define BC_NAME_MAX			29		/* Max bytes of the name in the broadcast payload */
+#define BC_HEADER			3		/* Company ID and sequence number */
+#define BC_PAYLOAD_MAX		(2 + BC_HEADER + BLE_BROADCAST_MAX_DATA + 2 + BC_NAME_MAX)	/* AD structures (length and type, data) */
+#define BC_INTERVAL_MS		1000	/* Advertising interval if interval_ms is 0 */
 /*==================[typedef]================================================*/
 /* Commands for handling Bluetooth events */
 typedef enum {
@@ -59,22 +101,40 @@ typedef enum {
     CMD_BLUETOOTH_AUTH,          /* device authentification */
     CMD_BLUETOOTH_DATA,          /* data reception */
     CMD_BLUETOOTH_DISCONNECT,    /* device disconnection */
-    CMD_SEND_DATA,               /* data transmission */
 } comd_bt_ev_t;
-/* Struct used to handle Bluetooth events */
+/* Advertising and connection parameters of a profile (intervals in 0.625 ms / 1.25 ms units) */
+typedef struct {
+	uint16_t adv_int_min;		/* Advertising interval (0.625 ms units) */
+	uint16_t adv_int_max;
+	uint16_t conn_int_min;		/* Connection interval (1.25 ms units) */
+	uint16_t conn_int_max;
+	uint16_t latency;			/* Connection events the peripheral can skip */
+	uint16_t timeout;			/* Supervision timeout (10 ms units, 0: no update is requested) */
+	bool phy_2m;				/* Request the LE 2M PHY */
+} ble_profile_params_t;
+/* Header of a message in the TX ring */
+typedef struct {
+	uint16_t lenght;			/* Bytes of the message */
+	uint16_t handle;			/* Attribute notified with it */
+} tx_msg_t;
+/* Struct used to handle Bluetooth events (queued by value, received data is only referenced) */
 typedef struct {
 	uint16_t spp_conn_id;
 	esp_gatt_if_t spp_gatts_if;
 	uint16_t command;
 	size_t length;
-	uint8_t payload[PAYLOAD_SIZE];
+	uint8_t *payload;			/* Block of rx_pool (PAYLOAD_SIZE + 1 bytes), only for CMD_BLUETOOTH_DATA */
 	TaskHandle_t taskHandle;
 } CMD_t;
 /*==================[internal data declaration]==============================*/
 char * device_name; /* Device name */
 void (*ble_read_isr_p)(uint8_t * data, uint8_t length);  /* Pointer to callback function for reading data */
 ble_status_t status = BLE_OFF;
+static ble_service_t service = BLE_SERVICE_SPP;  /* Service exposed */
 static uint16_t spp_handle_table[SPP_IDX_NB];   /* Service database table */
+static volatile uint16_t mtu = BLE_MTU_DEFAULT;  /* ATT MTU of the connection (exchanged by the client) */
+static ble_profile_t profile = BLE_PROFILE_DEFAULT;  /* Connection parameters profile */
+static esp_bd_addr_t remote_bda;                 /* Address of the connected device */
 /* GATT profile struct */
 struct gatts_profile_inst {
 	esp_gatts_cb_t gatts_cb;
@@ -92,6 +152,50 @@ struct gatts_profile_inst {
 };
 QueueHandle_t xQueueEvents = NULL;  /* Queue for handling Bluettoth events */
 QueueHandle_t xQueueRead = NULL;    /* Queue for handling received data */
+/* RX path: payloads of the writes of the client, until read_task gives them to the application */
+static mem_pool_t rx_pool;
+/* one spare byte per block, to terminate in place a text command that ends the write */
+MEM_POOL_STORAGE_DEFINE(rx_pool, PAYLOAD_SIZE + 1, BLE_RX_BLOCKS);
+/* TX path: messages (length and bytes) written by the application and notified by ble_tx_task */
+static ring_buffer_t tx_ring;
+static uint8_t tx_ring_storage[BLE_TX_RING_SIZE];
+static SemaphoreHandle_t tx_mutex = NULL;       /* Serializes the producers of tx_ring */
+static SemaphoreHandle_t tx_credits = NULL;     /* Notifications that can be handed to the stack */
+static SemaphoreHandle_t tx_space = NULL;       /* Given when ble_tx_task frees space in tx_ring */
+static TaskHandle_t tx_task_handle = NULL;
+static volatile bool tx_congested = false;      /* The stack has no buffers for more notifications */
+static volatile uint32_t tx_sent = 0;           /* Bytes notified */
+static volatile uint32_t tx_dropped = 0;        /* Bytes rejected by BleWrite or discarded on disconnection */
+static uint16_t tx_conn_id = 0xffff;            /* Connection used by ble_tx_task */
+static esp_gatt_if_t tx_gatts_if = 0xff;
+/* Sensor service: one notify characteristic per stream */
+static uint8_t stream_num = 0;
+/* Command dispatch */
+static const ble_cmd_t *cmd_table = NULL;
+static ble_cmd_format_t cmd_format = BLE_CMD_BINARY;
+static uint8_t cmd_index[256];					/* Entry of cmd_table of each opcode (CMD_NONE: not registered) */
+static uint16_t sensor_handle_table[SENSOR_IDX_NB(BLE_STREAM_MAX)];
+static volatile bool stream_subscribed[BLE_STREAM_MAX];
+/* Broadcast mode: latest readings (id, n, data), packed in the advertising payload once per interval */
+static uint8_t bc_readings[BLE_BROADCAST_MAX_DATA];
+static uint8_t bc_lenght = 0;					/* Bytes of bc_readings used */
+static uint8_t bc_seq = 0;						/* Sequence number of the payload */
+static const char *bc_name = NULL;
+static volatile bool bc_changed = false;		/* A reading changed since the last payload */
+static volatile bool bc_busy = false;			/* Payload handed to the stack and not yet set */
+static bool bc_started = false;					/* Advertising set started */
+static SemaphoreHandle_t bc_mutex = NULL;		/* Serializes BleBroadcastSet and the packing */
+static esp_timer_handle_t bc_timer = NULL;
+/* Tasks, queues and semaphores (static buffers with CONFIG_DRIVERS_STATIC_ALLOCATION) */
+STATIC_QUEUE_DEFINE(ble_events, BLE_EVENTS_QUEUE, sizeof(CMD_t));
+STATIC_QUEUE_DEFINE(ble_read, BLE_READ_QUEUE, sizeof(CMD_t));
+STATIC_SEMAPHORE_DEFINE(tx_mutex);
+STATIC_SEMAPHORE_DEFINE(tx_credits);
+STATIC_SEMAPHORE_DEFINE(tx_space);
+STATIC_SEMAPHORE_DEFINE(bc_mutex);
+STATIC_TASK_DEFINE(read_task, CONFIG_DRIVERS_BLE_READ_TASK_STACK);
+STATIC_TASK_DEFINE(events_task, CONFIG_DRIVERS_BLE_EVENTS_TASK_STACK);
+STATIC_TASK_DEFINE(tx_task, CONFIG_DRIVERS_BLE_TX_TASK_STACK);
 
 /*==================[internal functions declaration]=========================*/
 static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
@@ -107,6 +211,17 @@ static const uint8_t spp_adv_data[23] = {
 	/* Complete Local Name in advertising */
 	0x0F,0x09, 'E', 'S', 'P', '_', 'E', 'D', 'U', '_', 'S', 'E', 'R','V', 'E', 'R'
 };
+/* Parameters of each profile */
+static const ble_profile_params_t profile_params[] = {
+	/* central's choice (advertised preference: 7.5 to 20 ms) */
+	[BLE_PROFILE_DEFAULT]		= {0x20, 0x40, 0x0006, 0x0010, 0, 0, false},
+	/* 7.5 to 15 ms, 2M PHY: several MTU sized notifications per event */
+	[BLE_PROFILE_THROUGHPUT]	= {0x20, 0x40, 0x0006, 0x000C, 0, 400, true},
+	/* 7.5 ms, 2M PHY: shortest time from a notification to the central */
+	[BLE_PROFILE_LOW_LATENCY]	= {0x20, 0x40, 0x0006, 0x0006, 0, 200, true},
+	/* 100 to 200 ms skipping up to 4 events, advertising every 0.5 to 1 s */
+	[BLE_PROFILE_LOW_POWER]		= {0x0320, 0x0640, 0x0050, 0x00A0, 4, 600, false},
+};
 /* Advertising parameters */
 static esp_ble_adv_params_t spp_adv_params = {
 	.adv_int_min		= 0x20,
@@ -194,6 +309,48 @@ static const esp_gatts_attr_db_t spp_gatt_db[SPP_IDX_NB] = {
 	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_description_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
 	sizeof(uint16_t),sizeof(spp_data_notify_ccc), (uint8_t *)spp_data_notify_ccc}},
 };
+/* BLE-MIDI service UUID: 03B80E5A-EDE8-4B33-A751-6CE34EC4C700 (LSB first) */
+static uint8_t midi_service_uuid[16] = {
+	0x00, 0xC7, 0xC4, 0x4E, 0xE3, 0x6C, 0x51, 0xA7, 0x33, 0x4B, 0xE8, 0xED, 0x5A, 0x0E, 0xB8, 0x03,
+};
+/* BLE-MIDI data I/O characteristic UUID: 7772E5DB-3868-4112-A1A9-F2669D106BF3 (LSB first) */
+static const uint8_t midi_io_uuid[16] = {
+	0xF3, 0x6B, 0x10, 0x9D, 0x66, 0xF2, 0xA9, 0xA1, 0x12, 0x41, 0x68, 0x38, 0xDB, 0xE5, 0x72, 0x77,
+};
+/* Reading the data I/O characteristic returns no payload */
+static const uint8_t  midi_io_val[1] = {0x00};
+/* BLE-MIDI Database Description */
+static const esp_gatts_attr_db_t midi_gatt_db[MIDI_IDX_NB] = {
+	/* MIDI -  Service Declaration */
+	[MIDI_IDX_SVC]						=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&primary_service_uuid, ESP_GATT_PERM_READ,
+	sizeof(midi_service_uuid), sizeof(midi_service_uuid), (uint8_t *)midi_service_uuid}},
+
+	/* MIDI -  data I/O characteristic Declaration */
+	[MIDI_IDX_IO_CHAR]					=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	(sizeof(uint8_t)),(sizeof(uint8_t)), (uint8_t *)&char_prop_read_write}},
+
+	/* MIDI -  data I/O characteristic Value */
+	[MIDI_IDX_IO_VAL]					=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_128, (uint8_t *)midi_io_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
+	SPP_DATA_MAX_LEN, 0, (uint8_t *)midi_io_val}},
+
+	/* MIDI -  data I/O characteristic - Client Characteristic Configuration Descriptor */
+	[MIDI_IDX_IO_CFG]					=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_client_config_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
+	sizeof(uint16_t),sizeof(spp_data_notify_ccc), (uint8_t *)spp_data_notify_ccc}},
+};
+/* Sensor service UUID: E5D50000-8B2F-4C3A-9D1E-6A7B8C9D0E1F (LSB first), streams are E5D5xxxx with xxxx = 0001 + stream */
+static uint8_t sensor_service_uuid[16] = {
+	0x1F, 0x0E, 0x9D, 0x8C, 0x7B, 0x6A, 0x1E, 0x9D, 0x3A, 0x4C, 0x2F, 0x8B, 0x00, 0x00, 0xD5, 0xE5,
+};
+static uint8_t stream_uuid[BLE_STREAM_MAX][16];
+static const uint8_t char_prop_notify = ESP_GATT_CHAR_PROP_BIT_READ|ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static const uint8_t stream_val[1] = {0x00};
+static uint8_t stream_ccc[BLE_STREAM_MAX][2];
+/* Sensor service Database Description (built by BleInit with the streams of the configuration) */
+static esp_gatts_attr_db_t sensor_gatt_db[SENSOR_IDX_NB(BLE_STREAM_MAX)];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -254,6 +411,35 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 		case ESP_GAP_BLE_KEY_EVT:
 
 			break;
+		case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+			ESP_LOGI(TAG, "Connection interval %d x 1.25 ms, latency %d, timeout %d x 10 ms",
+				param->update_conn_params.conn_int, param->update_conn_params.latency, param->update_conn_params.timeout);
+			break;
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+		case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+			ESP_LOGI(TAG, "PHY: tx %d, rx %d", param->phy_update.tx_phy, param->phy_update.rx_phy);
+			break;
+		case ESP_GAP_BLE_EXT_ADV_DATA_SET_COMPLETE_EVT:
+			if (!bc_started){
+				/* first payload: the broadcast starts */
+				esp_ble_gap_ext_adv_t ext_adv = {.instance = BC_INSTANCE, .duration = 0, .max_events = 0};
+				esp_ble_gap_ext_adv_start(1, &ext_adv);
+				bc_started = true;
+			}
+			bc_busy = false;
+			break;
+		case ESP_GAP_BLE_EXT_ADV_START_COMPLETE_EVT:
+			if (param->ext_adv_start.status != ESP_BT_STATUS_SUCCESS) {
+				ESP_LOGE(TAG, "broadcast start failed, error status = %x", param->ext_adv_start.status);
+				break;
+			}
+			ESP_LOGI(TAG, "Broadcast start");
+			break;
+#endif
+		case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+			ESP_LOGI(TAG, "Data length: tx %d, rx %d bytes", param->pkt_data_length_cmpl.params.tx_len,
+				param->pkt_data_length_cmpl.params.rx_len);
+			break;
 		case ESP_GAP_BLE_AUTH_CMPL_EVT: {
 			cmdBuf.command = CMD_BLUETOOTH_AUTH;
 			xQueueSend(xQueueEvents, &cmdBuf, 0);
@@ -290,6 +476,26 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 	}
 }
 
+/* Request the connection parameters and PHY of the profile to the central */
+static void ble_apply_profile(void){
+	const ble_profile_params_t *p = &profile_params[profile];
+	if(p->timeout == 0){
+		return;
+	}
+	esp_ble_conn_update_params_t conn_params = {
+		.min_int = p->conn_int_min,
+		.max_int = p->conn_int_max,
+		.latency = p->latency,
+		.timeout = p->timeout,
+	};
+	memcpy(conn_params.bda, remote_bda, sizeof(esp_bd_addr_t));
+	esp_ble_gap_update_conn_params(&conn_params);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+	esp_ble_gap_phy_mask_t phy = p->phy_2m ? ESP_BLE_GAP_PHY_2M_PREF_MASK : ESP_BLE_GAP_PHY_1M_PREF_MASK;
+	esp_ble_gap_set_preferred_phy(remote_bda, 0, phy, phy, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+}
+
 static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 										esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param) {
     esp_ble_gatts_cb_param_t *p_data = (esp_ble_gatts_cb_param_t *) param;
@@ -300,22 +506,49 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 			esp_ble_gap_set_device_name(device_name);
 			//generate a resolvable random address
 			esp_ble_gap_config_local_privacy(true);
-			esp_ble_gap_config_adv_data_raw((uint8_t *)spp_adv_data, sizeof(spp_adv_data));
-			esp_ble_gatts_create_attr_tab(spp_gatt_db, gatts_if, SPP_IDX_NB, SPP_SVC_INST_ID);
+			if(service == BLE_SERVICE_MIDI){
+				esp_ble_gatts_create_attr_tab(midi_gatt_db, gatts_if, MIDI_IDX_NB, SPP_SVC_INST_ID);
+			}else{
+				esp_ble_gap_config_adv_data_raw((uint8_t *)spp_adv_data, sizeof(spp_adv_data));
+				esp_ble_gatts_create_attr_tab(spp_gatt_db, gatts_if, SPP_IDX_NB, SPP_SVC_INST_ID);
+			}
+			if(stream_num > 0){
+				esp_ble_gatts_create_attr_tab(sensor_gatt_db, gatts_if, SENSOR_IDX_NB(stream_num), SENSOR_SVC_INST_ID);
+			}
 			break;
 		case ESP_GATTS_READ_EVT:
 			break;
 		case ESP_GATTS_WRITE_EVT:
+			/* subscriptions to the streams are not data for the application */
+			for(uint8_t k = 0; k < stream_num; k++){
+				if(param->write.handle == sensor_handle_table[SENSOR_IDX(k, STREAM_IDX_CFG)]){
+					stream_subscribed[k] = (param->write.len == 2) && (param->write.value[0] & 0x01);
+					return;
+				}
+			}
 			cmdBuf.command = CMD_BLUETOOTH_DATA;
-			memcpy(cmdBuf.payload, param->write.value, param->write.len);
-			cmdBuf.length = param->write.len;
-			xQueueSend(xQueueRead, &cmdBuf, 0);
+			cmdBuf.payload = MemPoolAlloc(&rx_pool);
+			if(cmdBuf.payload == NULL){
+				/* read_task is behind: the write is lost (counted as a failure of the pool) */
+				break;
+			}
+			cmdBuf.length = (param->write.len > PAYLOAD_SIZE) ? PAYLOAD_SIZE : param->write.len;
+			memcpy(cmdBuf.payload, param->write.value, cmdBuf.length);
+			if(xQueueSend(xQueueRead, &cmdBuf, 0) != pdTRUE){
+				MemPoolFree(&rx_pool, cmdBuf.payload);
+			}
 			break;
 		case ESP_GATTS_EXEC_WRITE_EVT:
 			break;
 		case ESP_GATTS_MTU_EVT:
+			/* notifications are fragmented with the MTU requested by the client (up to BLE_MTU_MAX) */
+			mtu = (param->mtu.mtu > BLE_MTU_MAX) ? BLE_MTU_MAX : param->mtu.mtu;
+			ESP_LOGI(TAG, "MTU %d", mtu);
 			break;
 		case ESP_GATTS_CONF_EVT:
+			/* a notification left the stack: one more can be sent */
+			xSemaphoreGive(tx_credits);
+			xTaskNotifyGive(tx_task_handle);
 			break;
 		case ESP_GATTS_UNREG_EVT:
 			break;
@@ -328,6 +561,11 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_CONNECT_EVT:
 			/* start security connect with peer device when receive the connect event sent by the master */
 			esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_MITM);
+			/* data length extension: a whole notification of BLE_MTU_MAX in one link layer packet */
+			mtu = BLE_MTU_DEFAULT;
+			esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, BLE_DATA_LEN_MAX);
+			memcpy(remote_bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+			ble_apply_profile();
 			cmdBuf.command = CMD_BLUETOOTH_CONNECT;
 			cmdBuf.spp_conn_id = p_data->connect.conn_id;
 			cmdBuf.spp_gatts_if = gatts_if;
@@ -336,6 +574,11 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_DISCONNECT_EVT:
 			cmdBuf.command = CMD_BLUETOOTH_DISCONNECT;
 			status = BLE_DISCONNECTED;
+			mtu = BLE_MTU_DEFAULT;
+			tx_congested = false;
+			memset((void *)stream_subscribed, 0, sizeof(stream_subscribed));
+			/* ble_tx_task discards the pending messages */
+			xTaskNotifyGive(tx_task_handle);
 			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
 			/* start advertising again when missing the connect */
 			esp_ble_gap_start_advertising(&spp_adv_params);
@@ -349,16 +592,23 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_LISTEN_EVT:
 			break;
 		case ESP_GATTS_CONGEST_EVT:
+			tx_congested = param->congest.congested;
+			if(!tx_congested){
+				xTaskNotifyGive(tx_task_handle);
+			}
 			break;
 		case ESP_GATTS_CREAT_ATTR_TAB_EVT: {
+			bool sensor = (param->add_attr_tab.svc_inst_id == SENSOR_SVC_INST_ID);
+			uint16_t num_handle = sensor ? SENSOR_IDX_NB(stream_num) : (service == BLE_SERVICE_MIDI) ? MIDI_IDX_NB : SPP_IDX_NB;
+			uint16_t *handle_table = sensor ? sensor_handle_table : spp_handle_table;
 			if (param->create.status == ESP_GATT_OK){
-				if(param->add_attr_tab.num_handle == SPP_IDX_NB) {
-					memcpy(spp_handle_table, param->add_attr_tab.handles,
-					sizeof(spp_handle_table));
-					esp_ble_gatts_start_service(spp_handle_table[SPP_IDX_SVC]);
+				if(param->add_attr_tab.num_handle == num_handle) {
+					memcpy(handle_table, param->add_attr_tab.handles,
+					num_handle * sizeof(uint16_t));
+					esp_ble_gatts_start_service(handle_table[0]);
 				}else{
-					ESP_LOGE(__FUNCTION__, "Create attribute table abnormally, num_handle (%d) doesn't equal to SPP_IDX_NB(%d)",
-						param->add_attr_tab.num_handle, SPP_IDX_NB);
+					ESP_LOGE(__FUNCTION__, "Create attribute table abnormally, num_handle (%d) doesn't equal to %d",
+						param->add_attr_tab.num_handle, num_handle);
 				}
 			}else{
 				ESP_LOGE(__FUNCTION__, " Create attribute table failed, error code = %x", param->create.status);
@@ -393,54 +643,96 @@ static void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_
 	} while (0);
 }
 
+/**
+ * @brief Call the handler of a command, if its opcode is registered and it has enough arguments.
+ */
+static bool cmd_dispatch(uint8_t opcode, uint8_t *args, uint8_t length){
+	uint8_t i = cmd_index[opcode];
+	if(i == CMD_NONE || length < cmd_table[i].min_length){
+		return false;
+	}
+	cmd_table[i].handler_p(args, length, cmd_table[i].param);
+	return true;
+}
+
+static void read_unknown(uint8_t *data, uint8_t length){
+	if(ble_read_isr_p != BLE_NO_INT){
+		ble_read_isr_p(data, length);
+	}
+}
+
+/**
+ * @brief Parse in place the binary frames of a write: opcode, length and arguments.
+ * From the first frame that can't be dispatched, the rest goes to the read function.
+ */
+static void cmd_parse_binary(uint8_t *data, uint8_t length){
+	uint8_t pos = 0;
+	while(pos < length){
+		uint8_t left = length - pos;
+		if(left < 2 || data[pos + 1] > left - 2 || !cmd_dispatch(data[pos], &data[pos + 2], data[pos + 1])){
+			read_unknown(&data[pos], left);
+			return;
+		}
+		pos += 2 + data[pos + 1];
+	}
+}
+
+/**
+ * @brief Parse in place the text lines of a write (the block has a spare byte for the last '\0').
+ */
+static void cmd_parse_text(uint8_t *data, uint8_t length){
+	uint8_t pos = 0;
+	while(pos < length){
+		uint8_t end = pos;
+		while(end < length && data[end] != '\n' && data[end] != '\r' && data[end] != ';'){
+			end++;
+		}
+		if(end > pos){
+			uint8_t separator = data[end];
+			data[end] = '\0';
+			if(!cmd_dispatch(data[pos], &data[pos + 1], end - pos - 1)){
+				data[end] = separator;
+				read_unknown(&data[pos], end - pos);
+			}
+		}
+		pos = end + 1;
+	}
+}
+
 static void read_task(void* pvParameters) {
 	CMD_t cmdBuf;
 	while(1) {
 		xQueueReceive(xQueueRead, &cmdBuf, portMAX_DELAY);
-		if(ble_read_isr_p != BLE_NO_INT){
-            ble_read_isr_p(cmdBuf.payload, cmdBuf.length);
-        }
+		if(cmd_table == NULL){
+			read_unknown(cmdBuf.payload, cmdBuf.length);
+		}else if(cmd_format == BLE_CMD_TEXT){
+			cmd_parse_text(cmdBuf.payload, cmdBuf.length);
+		}else{
+			cmd_parse_binary(cmdBuf.payload, cmdBuf.length);
+		}
+		MemPoolFree(&rx_pool, cmdBuf.payload);
 	} 
 }
 
 void bluetooth_events_task(void * arg) {
 	CMD_t cmdBuf;
-	uint16_t spp_conn_id = 0xffff;
-	esp_gatt_if_t spp_gatts_if = 0xff;
-	int data_sent, i;
 
 	while(1){
-		vTaskDelay(50 / portTICK_PERIOD_MS);
 		xQueueReceive(xQueueEvents, &cmdBuf, portMAX_DELAY);
         switch(cmdBuf.command){
             case CMD_BLUETOOTH_CONNECT:
-                spp_conn_id = cmdBuf.spp_conn_id;
-                spp_gatts_if = cmdBuf.spp_gatts_if;
+                tx_conn_id = cmdBuf.spp_conn_id;
+                tx_gatts_if = cmdBuf.spp_gatts_if;
             break;
             case CMD_BLUETOOTH_AUTH:
                 ESP_LOGI(TAG, "Device connected");
 				status = BLE_CONNECTED;
+				xTaskNotifyGive(tx_task_handle);
             break;
             case CMD_BLUETOOTH_DISCONNECT:
                 ESP_LOGI(TAG, "Device disconnected");
 				status = BLE_DISCONNECTED;
             break;
-            case CMD_SEND_DATA:
-                if (status == BLE_CONNECTED) {
-					data_sent = 0;
-					i = 0;
-					while(data_sent < cmdBuf.length){
-						if((cmdBuf.length - data_sent) > MTU_MAX_BYTES){
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], MTU_MAX_BYTES, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-							i++;
-						}else{
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], cmdBuf.length - data_sent, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-						}
-					}
-                }
-            break;
             case CMD_BLUETOOTH_DATA:
                 xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
             break;
@@ -448,11 +740,111 @@ void bluetooth_events_task(void * arg) {
 	} 
 }
 
-/*==================[external functions definition]==========================*/
-void BleInit(ble_config_t * ble_device){
-esp_err_t ret;
-    device_name = ble_device->device_name;
-    ble_read_isr_p = ble_device->func_p;
+/* Fill a notification of one attribute with the pending messages: consecutive messages of
+ * the SPP data are joined up to the MTU (it is a byte stream), BLE-MIDI packets and stream
+ * frames are notified one by one */
+static uint16_t ble_tx_fill(uint8_t *notify, uint16_t *handle, tx_msg_t *pending){
+	uint16_t max_bytes = mtu - ATT_HEADER_BYTES;
+	uint16_t n = 0;
+	while(n < max_bytes){
+		if(pending->lenght == 0){
+			bool join = (service != BLE_SERVICE_MIDI) && (*handle == spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL]);
+			tx_msg_t header;
+			if((n > 0 && !join) || RingBufferPeek(&tx_ring, &header, BLE_TX_MSG_HEADER) < BLE_TX_MSG_HEADER){
+				break;
+			}
+			/* a message is taken only when it is complete */
+			if(RingBufferCount(&tx_ring) < BLE_TX_MSG_HEADER + header.lenght){
+				break;
+			}
+			RingBufferRead(&tx_ring, pending, BLE_TX_MSG_HEADER);
+		}
+		if(n == 0){
+			*handle = pending->handle;
+		}else if(pending->handle != *handle){
+			break;
+		}
+		uint16_t k = (pending->lenght < max_bytes - n) ? pending->lenght : max_bytes - n;
+		k = RingBufferRead(&tx_ring, &notify[n], k);
+		if(k == 0){
+			break;
+		}
+		n += k;
+		pending->lenght -= k;
+	}
+	return n;
+}
+
+static void ble_tx_task(void * arg) {
+	static uint8_t notify[PAYLOAD_SIZE];
+	tx_msg_t pending = {0, 0};  /* bytes of the current message still in tx_ring */
+	uint16_t handle;
+	while(1){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(status != BLE_CONNECTED){
+			/* nobody to send them to: pending messages are discarded (not in the middle of a write) */
+			xSemaphoreTake(tx_mutex, portMAX_DELAY);
+			uint32_t count = RingBufferCount(&tx_ring);
+			RingBufferFlush(&tx_ring);
+			xSemaphoreGive(tx_mutex);
+			tx_dropped += count;
+			pending.lenght = 0;
+			while(xSemaphoreGive(tx_credits) == pdTRUE);
+			xSemaphoreGive(tx_space);
+			continue;
+		}
+		/* while the stack has credits and buffers, everything written so far is sent
+		 * (small writes made meanwhile are joined in MTU sized notifications) */
+		while(!tx_congested && status == BLE_CONNECTED && RingBufferCount(&tx_ring) > 0){
+			if(xSemaphoreTake(tx_credits, pdMS_TO_TICKS(BLE_TX_CREDIT_TIMEOUT_MS)) != pdTRUE){
+				ESP_LOGW(TAG, "TX credit lost");
+			}
+			uint16_t n = ble_tx_fill(notify, &handle, &pending);
+			xSemaphoreGive(tx_space);
+			if(n == 0){
+				xSemaphoreGive(tx_credits);
+				break;
+			}
+			TRACE_EVENT(TRACE_BLE_SEND, n);
+			if(esp_ble_gatts_send_indicate(tx_gatts_if, tx_conn_id, handle, n, notify, false) == ESP_OK){
+				tx_sent += n;
+			}else{
+				tx_dropped += n;
+				xSemaphoreGive(tx_credits);
+			}
+		}
+	}
+}
+
+/* Store a message for an attribute in tx_ring if it fits entirely. Each message (header and
+ * up to PAYLOAD_SIZE bytes, longer ones are split) is stored with one write, so ble_tx_task
+ * never sees a header without its bytes */
+static bool ble_tx_write(const uint8_t *data, uint16_t nbytes, uint16_t handle){
+	static uint8_t msg[BLE_TX_MSG_HEADER + PAYLOAD_SIZE];  /* protected by tx_mutex */
+	bool written = false;
+	uint16_t parts = (nbytes + PAYLOAD_SIZE - 1) / PAYLOAD_SIZE;
+	xSemaphoreTake(tx_mutex, portMAX_DELAY);
+	if(RingBufferFree(&tx_ring) >= (uint32_t)nbytes + parts * BLE_TX_MSG_HEADER){
+		while(nbytes > 0){
+			tx_msg_t header = {.lenght = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes, .handle = handle};
+			memcpy(msg, &header, BLE_TX_MSG_HEADER);
+			memcpy(&msg[BLE_TX_MSG_HEADER], data, header.lenght);
+			RingBufferWrite(&tx_ring, msg, BLE_TX_MSG_HEADER + header.lenght);
+			data += header.lenght;
+			nbytes -= header.lenght;
+		}
+		written = true;
+	}
+	xSemaphoreGive(tx_mutex);
+	if(written){
+		xTaskNotifyGive(tx_task_handle);
+	}
+	return written;
+}
+
+/* Start the controller (BLE only) and Bluedroid */
+static bool ble_stack_init(void){
+	esp_err_t ret;
 	/* Initialize NVS. */
 	ret = nvs_flash_init();
 	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -465,21 +857,131 @@ esp_err_t ret;
 	ret = esp_bt_controller_init(&bt_cfg);
 	if (ret) {
 		ESP_LOGE(TAG, "%s init controller failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bt_controller_enable(ESP_BT_MODE_BLE);
 	if (ret) {
 		ESP_LOGE(TAG, "%s enable controller failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bluedroid_init();
 	if (ret) {
 		ESP_LOGE(TAG, "%s init bluetooth failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bluedroid_enable();
 	if (ret) {
 		ESP_LOGE(TAG, "%s enable bluetooth failed: %s", __func__, esp_err_to_name(ret));
+		return false;
+	}
+	return true;
+}
+
+/* Parameters of the advertising set of the broadcast mode */
+static bool ble_broadcast_params(const ble_broadcast_config_t * config, uint32_t interval_ms){
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+	/* non connectable and non scannable: the payload goes in the auxiliary packets */
+	esp_ble_gap_ext_adv_params_t adv_params = {
+		.type = ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED,
+		.interval_min = interval_ms * 8 / 5,
+		.interval_max = interval_ms * 8 / 5,
+		.channel_map = ADV_CHNL_ALL,
+		.own_addr_type = BLE_ADDR_TYPE_PUBLIC,
+		.filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY,
+		.tx_power = config->tx_power,
+		.primary_phy = config->long_range ? ESP_BLE_GAP_PRI_PHY_CODED : ESP_BLE_GAP_PRI_PHY_1M,
+		.max_skip = 0,
+		.secondary_phy = config->long_range ? ESP_BLE_GAP_PHY_CODED : ESP_BLE_GAP_PHY_1M,
+		.sid = BC_INSTANCE,
+		.scan_req_notif = false,
+	};
+	esp_err_t ret = esp_ble_gap_ext_adv_set_params(BC_INSTANCE, &adv_params);
+	if (ret){
+		ESP_LOGE(TAG, "broadcast params error, error code = %x", ret);
+		return false;
+	}
+	return true;
+#else
+	ESP_LOGE(TAG, "broadcast mode needs CONFIG_BT_BLE_50_FEATURES_SUPPORTED");
+	return false;
+#endif
+}
+
+/* Pack the readings in the broadcast payload, if one changed (esp_timer task, every interval) */
+static void ble_broadcast_update(void *arg){
+	static uint8_t payload[BC_PAYLOAD_MAX];
+	if (!bc_changed || bc_busy){
+		return;
+	}
+	uint16_t n = 0;
+	xSemaphoreTake(bc_mutex, portMAX_DELAY);
+	bc_changed = false;
+	payload[n++] = 1 + BC_HEADER + bc_lenght;
+	payload[n++] = ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE;
+	payload[n++] = BLE_BROADCAST_COMPANY_ID & 0xFF;
+	payload[n++] = BLE_BROADCAST_COMPANY_ID >> 8;
+	payload[n++] = ++bc_seq;
+	memcpy(&payload[n], bc_readings, bc_lenght);
+	n += bc_lenght;
+	xSemaphoreGive(bc_mutex);
+	uint8_t name_lenght = strnlen(bc_name, BC_NAME_MAX);
+	payload[n++] = 1 + name_lenght;
+	payload[n++] = ESP_BLE_AD_TYPE_NAME_CMPL;
+	memcpy(&payload[n], bc_name, name_lenght);
+	n += name_lenght;
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+	bc_busy = true;
+	if (esp_ble_gap_config_ext_adv_data_raw(BC_INSTANCE, n, payload) != ESP_OK){
+		bc_busy = false;
+		bc_changed = true;
+	}
+#endif
+}
+
+/*==================[external functions definition]==========================*/
+void BleInit(ble_config_t * ble_device){
+esp_err_t ret;
+    device_name = ble_device->device_name;
+    ble_read_isr_p = ble_device->func_p;
+    service = ble_device->service;
+    profile = ble_device->profile;
+    stream_num = (ble_device->streams == NULL) ? 0 : ble_device->stream_num;
+    if(stream_num > BLE_STREAM_MAX){
+        stream_num = BLE_STREAM_MAX;
+    }
+    /* opcode -> entry index, so each command is dispatched without searching the table */
+    memset(cmd_index, CMD_NONE, sizeof(cmd_index));
+    cmd_table = ble_device->commands;
+    cmd_format = ble_device->command_format;
+    for(uint8_t i = 0; cmd_table != NULL && i < ble_device->command_num && i < CMD_NONE; i++){
+        cmd_index[cmd_table[i].opcode] = i;
+    }
+    /* sensor service: declaration, and characteristic, value, CCCD and name of each stream */
+    sensor_gatt_db[0] = (esp_gatts_attr_db_t){{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&primary_service_uuid, ESP_GATT_PERM_READ,
+        sizeof(sensor_service_uuid), sizeof(sensor_service_uuid), sensor_service_uuid}};
+    for(uint8_t k = 0; k < stream_num; k++){
+        memcpy(stream_uuid[k], sensor_service_uuid, sizeof(sensor_service_uuid));
+        stream_uuid[k][12] = (k + 1) & 0xFF;
+        stream_uuid[k][13] = (k + 1) >> 8;
+        sensor_gatt_db[SENSOR_IDX(k, STREAM_IDX_CHAR)] = (esp_gatts_attr_db_t){{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16,
+            (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ, sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_notify}};
+        sensor_gatt_db[SENSOR_IDX(k, STREAM_IDX_VAL)] = (esp_gatts_attr_db_t){{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_128,
+            stream_uuid[k], ESP_GATT_PERM_READ, PAYLOAD_SIZE, 0, (uint8_t *)stream_val}};
+        sensor_gatt_db[SENSOR_IDX(k, STREAM_IDX_CFG)] = (esp_gatts_attr_db_t){{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16,
+            (uint8_t *)&character_client_config_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE, sizeof(uint16_t), sizeof(uint16_t), stream_ccc[k]}};
+        sensor_gatt_db[SENSOR_IDX(k, STREAM_IDX_DESC)] = (esp_gatts_attr_db_t){{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16,
+            (uint8_t *)&character_description_uuid, ESP_GATT_PERM_READ, strlen(ble_device->streams[k]), strlen(ble_device->streams[k]),
+            (uint8_t *)ble_device->streams[k]}};
+    }
+    spp_adv_params.adv_int_min = profile_params[profile].adv_int_min;
+    spp_adv_params.adv_int_max = profile_params[profile].adv_int_max;
+    spp_adv_config.min_interval = profile_params[profile].conn_int_min;
+    spp_adv_config.max_interval = profile_params[profile].conn_int_max;
+    if(service == BLE_SERVICE_MIDI){
+        /* advertise the BLE-MIDI service, so DAWs can find the device */
+        spp_adv_config.p_service_uuid = midi_service_uuid;
+    }
+	if (!ble_stack_init()){
 		return;
 	}
 	ret = esp_ble_gatts_register_callback(gatts_event_handler);
@@ -497,6 +999,11 @@ esp_err_t ret;
 		ESP_LOGE(TAG, "gatts app register error, error code = %x", ret);
 		return;
 	}
+	/* MTU accepted when the client starts the exchange */
+	ret = esp_ble_gatt_set_local_mtu(BLE_MTU_MAX);
+	if (ret){
+		ESP_LOGE(TAG, "set local MTU error, error code = %x", ret);
+	}
 	/* set the security iocap & auth_req & key size & init key response key parameters to the stack*/
 	esp_ble_auth_req_t auth_req = ESP_LE_AUTH_REQ_SC_MITM_BOND;		//bonding with peer device after authentication
 	esp_ble_io_cap_t iocap = ESP_IO_CAP_NONE;			//set the IO capability to No output No input
@@ -517,50 +1024,158 @@ esp_err_t ret;
 	esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
 	
     /* Create Queue */
-	xQueueEvents = xQueueCreate(10, sizeof(CMD_t));
+	xQueueEvents = STATIC_QUEUE_CREATE(ble_events, BLE_EVENTS_QUEUE, sizeof(CMD_t));
 	configASSERT(xQueueEvents);
-	xQueueRead = xQueueCreate( 10, sizeof(CMD_t) );
+	xQueueRead = STATIC_QUEUE_CREATE(ble_read, BLE_READ_QUEUE, sizeof(CMD_t));
 	configASSERT(xQueueRead);
+	MemPoolInit(&rx_pool, rx_pool_storage, PAYLOAD_SIZE + 1, BLE_RX_BLOCKS);
+	RingBufferInit(&tx_ring, tx_ring_storage, sizeof(uint8_t), BLE_TX_RING_SIZE);
+	tx_mutex = STATIC_MUTEX_CREATE(tx_mutex);
+	tx_credits = STATIC_COUNTING_CREATE(tx_credits, BLE_TX_CREDITS, BLE_TX_CREDITS);
+	tx_space = STATIC_BINARY_CREATE(tx_space);
+	configASSERT(tx_mutex && tx_credits && tx_space);
 
 	/* Start tasks */
-	xTaskCreate(read_task, "read", 1024*4, NULL, 2, NULL);
-	xTaskCreate(bluetooth_events_task, "bluetooth_events", 1024*4, NULL, 10, NULL);
+	STATIC_TASK_CREATE(read_task, read_task, "read", NULL, 2, NULL);
+	STATIC_TASK_CREATE(events_task, bluetooth_events_task, "bluetooth_events", NULL, 10, NULL);
+	STATIC_TASK_CREATE(tx_task, ble_tx_task, "ble_tx", NULL, 9, &tx_task_handle);
+}
+
+bool BleBroadcastInit(const ble_broadcast_config_t * config){
+	if (bc_mutex != NULL){
+		return false;
+	}
+	bc_name = (config->device_name != NULL) ? config->device_name : "";
+	uint32_t interval_ms = (config->interval_ms == 0) ? BC_INTERVAL_MS : config->interval_ms;
+	bc_mutex = STATIC_MUTEX_CREATE(bc_mutex);
+	if (bc_mutex == NULL || !ble_stack_init()){
+		return false;
+	}
+	esp_err_t ret = esp_ble_gap_register_callback(gap_event_handler);
+	if (ret){
+		ESP_LOGE(TAG, "gap register error, error code = %x", ret);
+		return false;
+	}
+	if (!ble_broadcast_params(config, interval_ms)){
+		return false;
+	}
+	/* the first payload starts the advertising (ESP_GAP_BLE_EXT_ADV_DATA_SET_COMPLETE_EVT) */
+	bc_changed = true;
+	ble_broadcast_update(NULL);
+	esp_timer_create_args_t timer_args = {
+		.callback = ble_broadcast_update,
+		.name = "ble_broadcast"
+	};
+	if (esp_timer_create(&timer_args, &bc_timer) != ESP_OK){
+		return false;
+	}
+	return esp_timer_start_periodic(bc_timer, (uint64_t)interval_ms * 1000) == ESP_OK;
+}
+
+bool BleBroadcastSet(uint8_t id, const void *data, uint8_t nbytes){
+	if (bc_mutex == NULL){
+		return false;
+	}
+	bool set = false;
+	xSemaphoreTake(bc_mutex, portMAX_DELAY);
+	uint8_t i = 0;
+	uint8_t count = 0;
+	while (i < bc_lenght && bc_readings[i] != id){
+		i += 2 + bc_readings[i + 1];
+		count++;
+	}
+	if (i < bc_lenght){
+		if (bc_readings[i + 1] == nbytes){
+			memcpy(&bc_readings[i + 2], data, nbytes);
+			set = true;
+		}
+	}else if (count < BLE_BROADCAST_MAX_READINGS && bc_lenght + 2 + nbytes <= BLE_BROADCAST_MAX_DATA){
+		bc_readings[i] = id;
+		bc_readings[i + 1] = nbytes;
+		memcpy(&bc_readings[i + 2], data, nbytes);
+		bc_lenght += 2 + nbytes;
+		set = true;
+	}
+	bc_changed |= set;
+	xSemaphoreGive(bc_mutex);
+	return set;
 }
 
 ble_status_t BleStatus(void){
 	return status;
 }
 
-void BleSendByte(const char *data){
-	CMD_t cmdBuf;
+void BleSetProfile(ble_profile_t new_profile){
+	profile = new_profile;
 	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 1;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		ble_apply_profile();
 	}
 }
 
+bool BleStreamSubscribed(uint8_t stream){
+	return (stream < stream_num) && stream_subscribed[stream];
+}
+
+bool BleStreamSend(uint8_t stream, const void *data, uint16_t nbytes){
+	if(status != BLE_CONNECTED || !BleStreamSubscribed(stream) || nbytes == 0 || nbytes > BleMaxPayload()){
+		return false;
+	}
+	if(!ble_tx_write(data, nbytes, sensor_handle_table[SENSOR_IDX(stream, STREAM_IDX_VAL)])){
+		tx_dropped += nbytes;
+		return false;
+	}
+	return true;
+}
+
+uint16_t BleMaxPayload(void){
+	return mtu - ATT_HEADER_BYTES;
+}
+
+void BleSendByte(const char *data){
+	BleSendBuffer(data, 1);
+}
+
 void BleSendString(const char *msg){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 0;
-		while(msg[cmdBuf.length] != '\0'){
-			cmdBuf.length++;
+	BleSendBuffer(msg, strlen(msg));
+}
+
+void BleSendBuffer(const char *data, uint16_t nbytes){
+	/* messages longer than a notification are split, so they always fit in tx_ring */
+	while(nbytes > 0 && status == BLE_CONNECTED){
+		uint16_t n = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes;
+		if(ble_tx_write((const uint8_t *)data, n, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL])){
+			data += n;
+			nbytes -= n;
+		}else{
+			/* ring full: wait until ble_tx_task sends something */
+			xSemaphoreTake(tx_space, pdMS_TO_TICKS(BLE_TX_WAIT_MS));
 		}
-		memcpy(cmdBuf.payload, msg, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
 	}
 }
 
-void BleSendBuffer(const char *data, uint8_t nbytes){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = nbytes;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+bool BleWrite(const uint8_t *data, uint16_t nbytes){
+	if(status != BLE_CONNECTED || nbytes == 0){
+		return false;
 	}
+	if(!ble_tx_write(data, nbytes, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL])){
+		tx_dropped += nbytes;
+		return false;
+	}
+	return true;
+}
+
+uint32_t BleTxFree(void){
+	uint32_t free = RingBufferFree(&tx_ring);
+	return (free > BLE_TX_MSG_HEADER) ? free - BLE_TX_MSG_HEADER : 0;
+}
+
+void BleTxStats(ble_tx_stats_t *stats){
+	stats->queued = RingBufferCount(&tx_ring);
+	stats->sent = tx_sent;
+	stats->dropped = tx_dropped;
+}
+
+void BleRxStats(mem_pool_stats_t *stats){
+	MemPoolGetStats(&rx_pool, stats);
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
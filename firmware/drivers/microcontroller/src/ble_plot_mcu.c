@@ -0,0 +1,118 @@
+/**
+ * @file ble_plot_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ble_plot_mcu.h"
+#include <string.h>
+#include <math.h>
+/*==================[macros and definitions]=================================*/
+#define INT16_FULL_SCALE	32767.0f
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Samples per channel of a frame with the current MTU
+ */
+static uint16_t BlePlotCapacity(const ble_plot_t *plot){
+	uint16_t payload = BleMaxPayload();
+	uint16_t n = (payload > BLE_PLOT_HEADER) ? (payload - BLE_PLOT_HEADER) / (2 * plot->channels) : 0;
+	if(plot->max_samples > 0 && plot->max_samples < n){
+		n = plot->max_samples;
+	}
+	return n;
+}
+
+/**
+ * @brief Quantize and queue the first n pending samples per channel
+ */
+static bool BlePlotSendFrame(ble_plot_t *plot, uint16_t n, uint8_t flags){
+	static uint8_t frame[BLE_PLOT_HEADER + 2 * BLE_PLOT_MAX_SAMPLES] __attribute__((aligned(4)));
+	uint16_t total = n * plot->channels;
+	float max = 0;
+	for(uint16_t i = 0; i < total; i++){
+		float a = fabsf(plot->samples[i]);
+		if(a > max){
+			max = a;
+		}
+	}
+	float scale = (max > 0) ? max / INT16_FULL_SCALE : 1.0f;
+	float inv = 1.0f / scale;
+	memcpy(&frame[0], &plot->index, sizeof(uint16_t));
+	frame[2] = plot->channels;
+	frame[3] = flags;
+	memcpy(&frame[4], &scale, sizeof(float));
+	int16_t *q = (int16_t *)&frame[BLE_PLOT_HEADER];
+	for(uint16_t i = 0; i < total; i++){
+		q[i] = (int16_t)lrintf(plot->samples[i] * inv);
+	}
+	bool sent = (n > 0) && BleStreamSend(plot->stream, frame, BLE_PLOT_HEADER + 2 * total);
+	if(sent){
+		plot->frames++;
+	}else{
+		plot->dropped += n;
+	}
+	plot->index += n;
+	plot->pending -= n;
+	memmove(plot->samples, &plot->samples[total], plot->pending * plot->channels * sizeof(float));
+	return sent;
+}
+
+/*==================[external functions definition]==========================*/
+bool BlePlotInit(ble_plot_t *plot, uint8_t stream, uint8_t channels, uint16_t max_samples){
+	if(channels == 0 || channels > BLE_PLOT_MAX_CHANNELS){
+		return false;
+	}
+	plot->stream = stream;
+	plot->channels = channels;
+	plot->max_samples = max_samples;
+	plot->index = 0;
+	plot->pending = 0;
+	plot->frames = 0;
+	plot->dropped = 0;
+	return true;
+}
+
+bool BlePlotWrite(ble_plot_t *plot, const float * const *data, uint16_t lenght){
+	bool ok = true;
+	for(uint16_t i = 0; i < lenght; i++){
+		float *dst = &plot->samples[plot->pending * plot->channels];
+		for(uint8_t c = 0; c < plot->channels; c++){
+			dst[c] = data[c][i];
+		}
+		plot->pending++;
+		// the MTU can grow or shrink between writes: a frame never exceeds the current one
+		uint16_t capacity = BlePlotCapacity(plot);
+		if(plot->pending >= capacity || (plot->pending + 1) * plot->channels > BLE_PLOT_MAX_SAMPLES){
+			uint16_t n = (capacity < plot->pending) ? capacity : plot->pending;
+			ok &= BlePlotSendFrame(plot, (n > 0) ? n : plot->pending, 0);
+		}
+	}
+	return ok;
+}
+
+bool BlePlotFlush(ble_plot_t *plot){
+	bool ok = true;
+	while(plot->pending > 0){
+		uint16_t capacity = BlePlotCapacity(plot);
+		uint16_t n = (capacity > 0 && capacity < plot->pending) ? capacity : plot->pending;
+		ok &= BlePlotSendFrame(plot, n, (n == plot->pending) ? BLE_PLOT_FLAG_END : 0);
+	}
+	plot->index = 0;
+	return ok;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,269 @@
+/**
+ * @file boot_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "boot_mcu.h"
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include "static_alloc_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define BOOT_TASK_STACK		CONFIG_DRIVERS_BOOT_TASK_STACK
+#define LINE_LENGHT			64
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Event of the application
+ */
+typedef struct {
+	const char *name;
+	int64_t time_us;
+} boot_mark_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static boot_step_t *boot_steps = NULL;
+static uint8_t boot_n = 0;
+static EventGroupHandle_t boot_events;		/*!< One bit per finished step */
+static StaticEventGroup_t boot_events_buffer;
+static boot_mark_t boot_marks[BOOT_MAX_MARKS];
+static uint8_t boot_marks_n = 0;
+static portMUX_TYPE boot_mux = portMUX_INITIALIZER_UNLOCKED;
+STATIC_TASKS_DEFINE(boot_task, BOOT_WORKERS, BOOT_TASK_STACK);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool BootFinished(uint8_t i){
+	return boot_steps[i].state == BOOT_DONE || boot_steps[i].state == BOOT_FAILED;
+}
+
+/**
+ * @brief Run the initialization of a step claimed by the calling task (state BOOT_RUNNING).
+ */
+static void BootExecute(uint8_t i){
+	boot_step_t *step = &boot_steps[i];
+	step->start_us = esp_timer_get_time();
+	bool ok = (step->init_p == NULL) || step->init_p(step->param);
+	step->end_us = esp_timer_get_time();
+	taskENTER_CRITICAL(&boot_mux);
+	step->state = ok ? BOOT_DONE : BOOT_FAILED;
+	taskEXIT_CRITICAL(&boot_mux);
+	xEventGroupSetBits(boot_events, BOOT_DEP(i));
+}
+
+/**
+ * @brief Claim a step of BootRun whose dependencies finished. Steps whose
+ * dependencies failed are failed on the way.
+ *
+ * @return Index of the step, -1 if none is ready
+ */
+static int8_t BootTake(void){
+	int8_t ready = -1;
+	uint32_t failed = 0;
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&boot_mux);
+	for(uint8_t i = 0; i < boot_n && ready < 0; i++){
+		boot_step_t *step = &boot_steps[i];
+		if(step->lazy || step->state != BOOT_PENDING){
+			continue;
+		}
+		bool deps_done = true, deps_failed = false;
+		for(uint8_t d = 0; d < boot_n; d++){
+			if(step->deps & BOOT_DEP(d)){
+				deps_done &= BootFinished(d);
+				deps_failed |= (boot_steps[d].state == BOOT_FAILED);
+			}
+		}
+		if(deps_failed){
+			step->state = BOOT_FAILED;
+			step->start_us = step->end_us = now;
+			failed |= BOOT_DEP(i);
+		}else if(deps_done){
+			step->state = BOOT_RUNNING;
+			ready = i;
+		}
+	}
+	taskEXIT_CRITICAL(&boot_mux);
+	if(failed){
+		xEventGroupSetBits(boot_events, failed);
+	}
+	return ready;
+}
+
+/**
+ * @brief Run the steps of BootRun until none is left to start.
+ */
+static void BootWork(void){
+	while(true){
+		int8_t i = BootTake();
+		if(i >= 0){
+			BootExecute(i);
+			continue;
+		}
+		// nothing ready: wait for a running step, if any
+		uint32_t running = 0;
+		bool pending = false;
+		taskENTER_CRITICAL(&boot_mux);
+		for(uint8_t j = 0; j < boot_n; j++){
+			if(boot_steps[j].state == BOOT_RUNNING){
+				running |= BOOT_DEP(j);
+			}
+			pending |= (!boot_steps[j].lazy && boot_steps[j].state == BOOT_PENDING);
+		}
+		taskEXIT_CRITICAL(&boot_mux);
+		if(!pending){
+			return;
+		}
+		if(running == 0){
+			// circular dependencies: those steps can't start
+			uint32_t failed = 0;
+			taskENTER_CRITICAL(&boot_mux);
+			for(uint8_t j = 0; j < boot_n; j++){
+				if(!boot_steps[j].lazy && boot_steps[j].state == BOOT_PENDING){
+					boot_steps[j].state = BOOT_FAILED;
+					failed |= BOOT_DEP(j);
+				}
+			}
+			taskEXIT_CRITICAL(&boot_mux);
+			xEventGroupSetBits(boot_events, failed);
+			return;
+		}
+		xEventGroupWaitBits(boot_events, running, pdFALSE, pdFALSE, portMAX_DELAY);
+	}
+}
+
+/**
+ * @brief BootRequire of a step, failed beyond BOOT_MAX_STEPS nested dependencies (a cycle).
+ */
+static bool BootRequireDepth(uint8_t step, uint8_t depth){
+	boot_step_t *s = &boot_steps[step];
+	if(s->state == BOOT_PENDING){
+		bool deps_ok = (depth < BOOT_MAX_STEPS);
+		for(uint8_t d = 0; d < boot_n && deps_ok; d++){
+			if(s->deps & BOOT_DEP(d)){
+				deps_ok = BootRequireDepth(d, depth + 1);
+			}
+		}
+		bool claimed = false;
+		taskENTER_CRITICAL(&boot_mux);
+		if(s->state == BOOT_PENDING){
+			s->state = deps_ok ? BOOT_RUNNING : BOOT_FAILED;
+			claimed = true;
+		}
+		taskEXIT_CRITICAL(&boot_mux);
+		if(claimed && deps_ok){
+			BootExecute(step);
+		}else if(claimed){
+			s->start_us = s->end_us = esp_timer_get_time();
+			xEventGroupSetBits(boot_events, BOOT_DEP(step));
+		}
+	}
+	xEventGroupWaitBits(boot_events, BOOT_DEP(step), pdFALSE, pdTRUE, portMAX_DELAY);
+	return s->state == BOOT_DONE;
+}
+
+static void BootTask(void *param){
+	BootWork();
+	vTaskDelete(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+bool BootRun(boot_step_t *steps, uint8_t n_steps){
+	if(boot_steps != NULL || n_steps > BOOT_MAX_STEPS){
+		return false;
+	}
+	boot_events = xEventGroupCreateStatic(&boot_events_buffer);
+	uint32_t all = 0;
+	bool changed = true;
+	for(uint8_t i = 0; i < n_steps; i++){
+		steps[i].state = BOOT_PENDING;
+		steps[i].start_us = steps[i].end_us = 0;
+	}
+	// steps run at boot need their dependencies at boot too
+	while(changed){
+		changed = false;
+		for(uint8_t i = 0; i < n_steps; i++){
+			for(uint8_t d = 0; d < n_steps && !steps[i].lazy; d++){
+				if((steps[i].deps & BOOT_DEP(d)) && steps[d].lazy){
+					steps[d].lazy = false;
+					changed = true;
+				}
+			}
+		}
+	}
+	for(uint8_t i = 0; i < n_steps; i++){
+		if(!steps[i].lazy){
+			all |= BOOT_DEP(i);
+		}
+	}
+	boot_n = n_steps;
+	boot_steps = steps;
+
+	UBaseType_t priority = uxTaskPriorityGet(NULL);
+	for(uint8_t w = 0; w < BOOT_WORKERS; w++){
+		STATIC_TASK_CREATE_N(boot_task, w, BootTask, "Boot", NULL, priority, NULL);
+	}
+	BootWork();
+	// steps still running in the workers
+	if(all){
+		xEventGroupWaitBits(boot_events, all, pdFALSE, pdTRUE, portMAX_DELAY);
+	}
+	bool ok = true;
+	for(uint8_t i = 0; i < n_steps; i++){
+		ok &= steps[i].lazy || steps[i].state == BOOT_DONE;
+	}
+	return ok;
+}
+
+bool BootRequire(uint8_t step){
+	if(boot_steps == NULL || step >= boot_n){
+		return false;
+	}
+	return BootRequireDepth(step, 0);
+}
+
+void BootMark(const char *name){
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&boot_mux);
+	if(boot_marks_n < BOOT_MAX_MARKS){
+		boot_marks[boot_marks_n].name = name;
+		boot_marks[boot_marks_n].time_us = now;
+		boot_marks_n++;
+	}
+	taskEXIT_CRITICAL(&boot_mux);
+}
+
+void BootReport(boot_print_t print_p){
+	static const char *states[] = {"pending", "running", "ok", "failed"};
+	char line[LINE_LENGHT];
+	if(print_p == NULL){
+		return;
+	}
+	print_p("step              start us    end us   time us\r\n");
+	for(uint8_t i = 0; i < boot_n; i++){
+		boot_step_t *s = &boot_steps[i];
+		if(s->state == BOOT_DONE || s->state == BOOT_FAILED){
+			snprintf(line, sizeof(line), "%-16s  %8lu  %8lu  %8lu  %s\r\n", s->name, (unsigned long)s->start_us,
+					 (unsigned long)s->end_us, (unsigned long)(s->end_us - s->start_us), states[s->state]);
+		}else{
+			snprintf(line, sizeof(line), "%-16s  %8s  %8s  %8s  %s\r\n", s->name, "-", "-", "-", states[s->state]);
+		}
+		print_p(line);
+	}
+	uint8_t n = boot_marks_n;
+	for(uint8_t i = 0; i < n; i++){
+		snprintf(line, sizeof(line), "%-16s  %8lu\r\n", boot_marks[i].name, (unsigned long)boot_marks[i].time_us);
+		print_p(line);
+	}
+}
+
+/*==================[end of file]============================================*/
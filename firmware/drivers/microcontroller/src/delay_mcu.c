@@ -11,9 +11,11 @@
 
 /*==================[inclusions]=============================================*/
 #include "delay_mcu.h"
+#include <stddef.h>
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_rom_sys.h"
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
@@ -22,12 +24,48 @@
 #define MIN_US				50	    /*!< minimun delay in usec to use gptimer */
 #define MIN_MS				100	    /*!< minimun delay in msec to use vTaskDelay */
 /*==================[internal data declaration]==============================*/
-SemaphoreHandle_t xDelaySemaphore = NULL;
+/**
+ * @brief Task waiting for a delay (allocated on the stack of the task)
+ */
+typedef struct delay_waiter {
+	uint64_t deadline;				/*!< Timer count at the end of the delay */
+	SemaphoreHandle_t done;			/*!< Given by the timer ISR at the deadline */
+	struct delay_waiter *next;		/*!< Next deadline */
+} delay_waiter_t;
+
+static gptimer_handle_t delay_timer = NULL;		/*!< Free running timer, created on the first delay */
+static delay_waiter_t *delay_waiters = NULL;		/*!< Waiters sorted by deadline */
+static SemaphoreHandle_t delay_init_mutex = NULL;	/*!< Serializes the timer creation */
+static StaticSemaphore_t delay_init_mutex_buffer;
+static portMUX_TYPE delay_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Set the alarm at the first deadline (or disable it)
+ * 
+ * @note If the deadline already passed the alarm fires immediately.
+ */
+static void IRAM_ATTR delay_set_alarm(void){
+	if(delay_waiters != NULL){
+		gptimer_alarm_config_t alarm_config = {
+			.alarm_count = delay_waiters->deadline,
+		};
+		gptimer_set_alarm_action(delay_timer, &alarm_config);
+	}
+	else{
+		gptimer_set_alarm_action(delay_timer, NULL);
+	}
+}
+
 static bool IRAM_ATTR delay_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
 	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-	gptimer_stop(timer);
-	xSemaphoreGiveFromISR(xDelaySemaphore, &xHigherPriorityTaskWoken);
+	taskENTER_CRITICAL_ISR(&delay_mux);
+	// wake every task whose deadline passed
+	while(delay_waiters != NULL && delay_waiters->deadline <= edata->count_value){
+		xSemaphoreGiveFromISR(delay_waiters->done, &xHigherPriorityTaskWoken);
+		delay_waiters = delay_waiters->next;
+	}
+	delay_set_alarm();
+	taskEXIT_CRITICAL_ISR(&delay_mux);
 	return (xHigherPriorityTaskWoken == pdTRUE);
 }
 /*==================[internal data definition]===============================*/
@@ -35,6 +73,77 @@ static bool IRAM_ATTR delay_isr(gptimer_handle_t timer, const gptimer_alarm_even
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Create and start the free running timer (first delay only)
+ * 
+ * @return true if the timer is running
+ */
+static bool DelayTimerInit(void){
+	// statically allocated, so it can be created inside the critical section
+	taskENTER_CRITICAL(&delay_mux);
+	if(delay_init_mutex == NULL){
+		delay_init_mutex = xSemaphoreCreateMutexStatic(&delay_init_mutex_buffer);
+	}
+	taskEXIT_CRITICAL(&delay_mux);
+	xSemaphoreTake(delay_init_mutex, portMAX_DELAY);
+	if(delay_timer == NULL){
+		gptimer_handle_t timer = NULL;
+		gptimer_config_t delay_timer_config = {
+			.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+			.direction = GPTIMER_COUNT_UP,
+			.resolution_hz = US_RESOLUTION_HZ,
+		};
+		if(gptimer_new_timer(&delay_timer_config, &timer) == ESP_OK){
+			gptimer_event_callbacks_t delay_alarm = {
+				.on_alarm = delay_isr,
+			};
+			gptimer_register_event_callbacks(timer, &delay_alarm, NULL);
+			gptimer_enable(timer);
+			gptimer_start(timer);
+			delay_timer = timer;
+		}
+	}
+	xSemaphoreGive(delay_init_mutex);
+	return delay_timer != NULL;
+}
+
+/**
+ * @brief Block the calling task for a delay measured by the timer
+ * 
+ * @note One hardware timer runs free and its alarm is set at the earliest
+ * deadline of the tasks waiting, so any number of tasks can delay at the
+ * same time, each one for its own time.
+ * 
+ * @param usec Delay in usec
+ */
+static void DelayTimer(uint32_t usec){
+	delay_waiter_t waiter;
+	StaticSemaphore_t done_buffer;
+	uint64_t now;
+	if(delay_timer == NULL && !DelayTimerInit()){
+		// no free hardware timer: busy wait
+		esp_rom_delay_us(usec);
+		return;
+	}
+	waiter.done = xSemaphoreCreateBinaryStatic(&done_buffer);
+	taskENTER_CRITICAL(&delay_mux);
+	gptimer_get_raw_count(delay_timer, &now);
+	waiter.deadline = now + usec;
+	// insert sorted by deadline
+	delay_waiter_t **link = &delay_waiters;
+	while(*link != NULL && (*link)->deadline <= waiter.deadline){
+		link = &(*link)->next;
+	}
+	waiter.next = *link;
+	*link = &waiter;
+	if(delay_waiters == &waiter){
+		delay_set_alarm();
+	}
+	taskEXIT_CRITICAL(&delay_mux);
+	/* Wait for the timer to reach the deadline */
+	xSemaphoreTake(waiter.done, portMAX_DELAY);
+	vSemaphoreDelete(waiter.done);
+}
 
 /*==================[external functions definition]==========================*/
 void DelaySec(uint16_t sec){
@@ -44,32 +153,7 @@ void DelaySec(uint16_t sec){
 void DelayMs(uint16_t msec){
     // If the delay is too short, use the ESP32's internal timer
     if(msec<=MIN_MS){ 
-        if(xDelaySemaphore == NULL){
-            xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = msec*MSEC, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        DelayTimer((uint32_t)msec * MSEC);
     }else{       
         // If the delay is longer than the minimum delay, use vTaskDelay
         vTaskDelay(msec / portTICK_PERIOD_MS);
@@ -82,33 +166,7 @@ void DelayUs(uint16_t usec){
         esp_rom_delay_us(usec);
     }else{
         /* If the delay is longer than the minimum, use the ESP32's internal timer */
-        if(xDelaySemaphore == NULL){
-	        xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = usec, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                /* Wait for the timer to finish */
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        DelayTimer(usec);
     }
 }
 
@@ -0,0 +1,271 @@
+/**
+ * @file espnow_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "espnow_mcu.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_idf_version.h"
+#include "esp_wifi.h"
+#include "esp_event.h"
+#include "esp_now.h"
+#include "esp_mac.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "nvs_mcu.h"
+#include "time_mcu.h"
+#include "static_alloc_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "espnow_mcu"
+#define RX_TASK_PRIORITY	20		/*!< Priority of the reception task (above the processing tasks) */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Received message
+ */
+typedef struct {
+	uint8_t mac[ESPNOW_MAC_LENGHT];		/*!< Sender */
+	espnow_msg_t msg;					/*!< Message */
+	uint64_t time;						/*!< Local time of the reception (us) */
+} espnow_rx_t;
+
+/**
+ * @brief Sender tracked by the receiver
+ */
+typedef struct {
+	uint8_t mac[ESPNOW_MAC_LENGHT];		/*!< MAC address */
+	uint8_t last_seq;					/*!< Sequence number of its last message */
+} espnow_sender_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const uint8_t broadcast_mac[ESPNOW_MAC_LENGHT] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static espnow_config_t espnow_config;
+static QueueHandle_t rx_queue = NULL;
+static espnow_sender_t senders[ESPNOW_MAX_PEERS];
+static uint8_t n_senders = 0;
+static uint8_t tx_seq = 0;
+static uint32_t sync_period_ms = 0;
+static uint64_t rx_time = 0;
+static espnow_stats_t espnow_stats;
+
+/* Tasks and queues (static buffers with CONFIG_DRIVERS_STATIC_ALLOCATION) */
+STATIC_QUEUE_DEFINE(rx_queue, ESPNOW_RX_QUEUE, sizeof(espnow_rx_t));
+STATIC_TASK_DEFINE(rx_task, CONFIG_DRIVERS_ESPNOW_TASK_STACK);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Send callback (Wi-Fi task): counts the messages not acknowledged
+ */
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 5, 0)
+static void EspNowSent(const wifi_tx_info_t *info, esp_now_send_status_t status){
+#else
+static void EspNowSent(const uint8_t *mac, esp_now_send_status_t status){
+#endif
+	if(status != ESP_NOW_SEND_SUCCESS){
+		__atomic_fetch_add(&espnow_stats.send_failed, 1, __ATOMIC_RELAXED);
+	}
+}
+
+/**
+ * @brief Receive callback (Wi-Fi task): only queues the message
+ */
+static void EspNowReceived(const esp_now_recv_info_t *info, const uint8_t *data, int lenght){
+	espnow_rx_t rx;
+	rx.time = TimeNowUs();
+	if(lenght != sizeof(espnow_msg_t)){
+		return;
+	}
+	memcpy(rx.mac, info->src_addr, ESPNOW_MAC_LENGHT);
+	memcpy(&rx.msg, data, sizeof(espnow_msg_t));
+	if(xQueueSend(rx_queue, &rx, 0) != pdTRUE){
+		espnow_stats.overflows++;
+	}
+}
+
+/**
+ * @brief Entry of a sender in the table (NULL if the table is full)
+ */
+static espnow_sender_t* EspNowSender(const uint8_t *mac, bool *first){
+	for(uint8_t i = 0; i < n_senders; i++){
+		if(memcmp(senders[i].mac, mac, ESPNOW_MAC_LENGHT) == 0){
+			*first = false;
+			return &senders[i];
+		}
+	}
+	if(n_senders == ESPNOW_MAX_PEERS){
+		return NULL;
+	}
+	*first = true;
+	memcpy(senders[n_senders].mac, mac, ESPNOW_MAC_LENGHT);
+	return &senders[n_senders++];
+}
+
+/**
+ * @brief Send a clock beacon with the time just before sending it
+ */
+static void EspNowSendSync(void){
+	uint64_t now = TimeNowUs();
+	EspNowSend(ESPNOW_MSG_SYNC, (now >> 32) & 0xFF, (now >> 40) & 0xFF, (uint32_t)now);
+}
+
+/**
+ * @brief Reception task: sequence numbers of each sender and callback (and the clock beacons of the master)
+ */
+static void EspNowTask(void *param){
+	espnow_rx_t rx;
+	uint64_t next_sync = 0;
+	while(true){
+		TickType_t wait = portMAX_DELAY;
+		if(sync_period_ms > 0){
+			uint64_t now = TimeNowUs();
+			if(now >= next_sync){
+				EspNowSendSync();
+				next_sync = now + (uint64_t)sync_period_ms * TIME_US_PER_MS;
+			}
+			wait = pdMS_TO_TICKS((next_sync - now) / TIME_US_PER_MS) + 1;
+		}
+		if(xQueueReceive(rx_queue, &rx, wait) != pdTRUE){
+			continue;
+		}
+		uint8_t lost = 0;
+		bool first;
+		espnow_sender_t *sender = EspNowSender(rx.mac, &first);
+		if(sender != NULL && !first){
+			if(rx.msg.seq == sender->last_seq){
+				// the ACK was lost and the MAC sent it again
+				espnow_stats.repeated++;
+				continue;
+			}
+			lost = rx.msg.seq - sender->last_seq - 1;
+			espnow_stats.lost += lost;
+		}
+		if(sender != NULL){
+			sender->last_seq = rx.msg.seq;
+		}
+		espnow_stats.received++;
+		rx_time = rx.time;
+		if(espnow_config.func_p != NULL){
+			espnow_config.func_p(rx.mac, &rx.msg, lost, espnow_config.param_p);
+		}
+	}
+}
+
+/**
+ * @brief Start the Wi-Fi as a station without connection, on the configured channel
+ */
+static bool EspNowWifiStart(uint8_t channel){
+	wifi_mode_t mode;
+	if(esp_wifi_get_mode(&mode) != ESP_ERR_WIFI_NOT_INIT){
+		// already started (i.e. by WifiUdpInit): the channel is the one of the access point
+		return true;
+	}
+	if(channel < 1 || channel > 13 || !NvsInit()){
+		return false;
+	}
+	esp_err_t ret = esp_event_loop_create_default();
+	if(ret != ESP_OK && ret != ESP_ERR_INVALID_STATE){
+		return false;
+	}
+	wifi_init_config_t init_config = WIFI_INIT_CONFIG_DEFAULT();
+	ret = esp_wifi_init(&init_config);
+	if(ret != ESP_OK){
+		ESP_LOGE(TAG, "Wi-Fi init failed: %s", esp_err_to_name(ret));
+		return false;
+	}
+	if(esp_wifi_set_storage(WIFI_STORAGE_RAM) != ESP_OK || esp_wifi_set_mode(WIFI_MODE_STA) != ESP_OK ||
+	   esp_wifi_start() != ESP_OK || esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE) != ESP_OK){
+		return false;
+	}
+	// with modem sleep the radio is off between beacons and the messages are lost
+	esp_wifi_set_ps(WIFI_PS_NONE);
+	return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool EspNowInit(const espnow_config_t *config){
+	if(rx_queue != NULL || config->n_peers > ESPNOW_MAX_PEERS){
+		return false;
+	}
+	espnow_config = *config;
+	if(!EspNowWifiStart(config->channel)){
+		return false;
+	}
+	rx_queue = STATIC_QUEUE_CREATE(rx_queue, ESPNOW_RX_QUEUE, sizeof(espnow_rx_t));
+	if(rx_queue == NULL || esp_now_init() != ESP_OK){
+		return false;
+	}
+	esp_now_register_send_cb(EspNowSent);
+	esp_now_register_recv_cb(EspNowReceived);
+	// channel 0: the current one of the Wi-Fi
+	esp_now_peer_info_t peer = {
+		.channel = 0,
+		.ifidx = WIFI_IF_STA,
+		.encrypt = false,
+	};
+	if(config->peers == NULL || config->n_peers == 0){
+		memcpy(peer.peer_addr, broadcast_mac, ESPNOW_MAC_LENGHT);
+		if(esp_now_add_peer(&peer) != ESP_OK){
+			return false;
+		}
+	}else{
+		for(uint8_t i = 0; i < config->n_peers; i++){
+			memcpy(peer.peer_addr, config->peers[i], ESPNOW_MAC_LENGHT);
+			if(esp_now_add_peer(&peer) != ESP_OK){
+				return false;
+			}
+		}
+	}
+	return STATIC_TASK_CREATE(rx_task, EspNowTask, "espnow_task", NULL, RX_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+bool EspNowSend(uint8_t type, uint8_t pad, uint8_t value, uint32_t timestamp){
+	espnow_msg_t msg = {
+		.type = type,
+		.seq = __atomic_fetch_add(&tx_seq, 1, __ATOMIC_RELAXED),
+		.pad = pad,
+		.value = value,
+		.timestamp = timestamp,
+	};
+	if(rx_queue == NULL){
+		return false;
+	}
+	// NULL: every peer added (the broadcast address without peers)
+	if(esp_now_send(NULL, (const uint8_t *)&msg, sizeof(msg)) != ESP_OK){
+		__atomic_fetch_add(&espnow_stats.send_failed, 1, __ATOMIC_RELAXED);
+		return false;
+	}
+	__atomic_fetch_add(&espnow_stats.sent, 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+void EspNowSyncStart(uint32_t period_ms){
+	sync_period_ms = period_ms;
+}
+
+uint64_t EspNowGetRxTime(void){
+	return rx_time;
+}
+
+uint64_t EspNowSyncTime(const espnow_msg_t *msg){
+	return msg->timestamp | ((uint64_t)msg->pad << 32) | ((uint64_t)msg->value << 40);
+}
+
+void EspNowGetMac(uint8_t *mac){
+	esp_read_mac(mac, ESP_MAC_WIFI_STA);
+}
+
+void EspNowGetStats(espnow_stats_t *stats){
+	*stats = espnow_stats;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,123 @@
+/**
+ * @file event_bus_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "event_bus_mcu.h"
+#include <string.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Store the event if no subscriber has the ring full
+ */
+static IRAM_ATTR bool EventBusStore(event_bus_t *bus, const void *event){
+	uint32_t head = bus->head;
+	uint8_t n = bus->subscribers;
+	for(uint8_t i = 0; i < n; i++){
+		if(head - __atomic_load_n(&bus->subscriber[i].tail, __ATOMIC_ACQUIRE) > bus->mask){
+			bus->overflows++;
+			return false;
+		}
+	}
+	memcpy(&bus->storage[(head & bus->mask) * bus->event_size], event, bus->event_size);
+	// publish the event after it is copied
+	__atomic_store_n(&bus->head, head + 1, __ATOMIC_RELEASE);
+	return true;
+}
+/*==================[external functions definition]==========================*/
+bool EventBusInit(event_bus_t *bus, void *storage, uint32_t event_size, uint32_t event_num){
+	if(event_num == 0 || (event_num & (event_num - 1)) != 0){
+		return false;
+	}
+	bus->storage = storage;
+	bus->event_size = event_size;
+	bus->mask = event_num - 1;
+	bus->head = 0;
+	bus->subscribers = 0;
+	bus->overflows = 0;
+	return true;
+}
+
+int8_t EventBusSubscribe(event_bus_t *bus, TaskHandle_t task, uint32_t notify_bits){
+	uint8_t n = bus->subscribers;
+	if(n >= EVENT_BUS_MAX_SUBSCRIBERS){
+		return -1;
+	}
+	bus->subscriber[n].tail = __atomic_load_n(&bus->head, __ATOMIC_ACQUIRE);
+	bus->subscriber[n].task = task;
+	bus->subscriber[n].notify_bits = notify_bits;
+	// the publisher sees the subscriber once it is complete
+	__atomic_store_n(&bus->subscribers, n + 1, __ATOMIC_RELEASE);
+	return n;
+}
+
+bool EventBusPublish(event_bus_t *bus, const void *event){
+	if(!EventBusStore(bus, event)){
+		return false;
+	}
+	for(uint8_t i = 0; i < bus->subscribers; i++){
+		event_bus_subscriber_t *sub = &bus->subscriber[i];
+		if(sub->task == NULL){
+			continue;
+		}
+		if(sub->notify_bits == 0){
+			xTaskNotifyGive(sub->task);
+		}else{
+			xTaskNotify(sub->task, sub->notify_bits, eSetBits);
+		}
+	}
+	return true;
+}
+
+IRAM_ATTR bool EventBusPublishFromISR(event_bus_t *bus, const void *event, BaseType_t *task_woken){
+	if(!EventBusStore(bus, event)){
+		return false;
+	}
+	for(uint8_t i = 0; i < bus->subscribers; i++){
+		event_bus_subscriber_t *sub = &bus->subscriber[i];
+		if(sub->task == NULL){
+			continue;
+		}
+		if(sub->notify_bits == 0){
+			vTaskNotifyGiveFromISR(sub->task, task_woken);
+		}else{
+			xTaskNotifyFromISR(sub->task, sub->notify_bits, eSetBits, task_woken);
+		}
+	}
+	return true;
+}
+
+IRAM_ATTR bool EventBusRead(event_bus_t *bus, uint8_t subscriber, void *event){
+	event_bus_subscriber_t *sub = &bus->subscriber[subscriber];
+	uint32_t tail = sub->tail;
+	if(tail == __atomic_load_n(&bus->head, __ATOMIC_ACQUIRE)){
+		return false;
+	}
+	memcpy(event, &bus->storage[(tail & bus->mask) * bus->event_size], bus->event_size);
+	// release the slot after it is copied
+	__atomic_store_n(&sub->tail, tail + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+uint32_t EventBusPending(event_bus_t *bus, uint8_t subscriber){
+	return __atomic_load_n(&bus->head, __ATOMIC_ACQUIRE) - bus->subscriber[subscriber].tail;
+}
+
+/*==================[end of file]============================================*/
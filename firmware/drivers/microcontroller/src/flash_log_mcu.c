@@ -0,0 +1,304 @@
+/**
+ * @file flash_log_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "flash_log_mcu.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "time_mcu.h"
+#include "static_alloc_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "flash_log_mcu"
+#define WRITE_TASK_PRIORITY	2		/*!< Priority of the writing task (below the acquisition and processing tasks) */
+#define NO_BUFFER			0xFF	/*!< No sector buffer being filled */
+#define DUMP_CHUNK			256		/*!< Bytes of a sector read and sent at a time by FlashLogDump */
+#define FRAME_HEADER		2		/*!< Bytes of the length of a frame */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Sector buffer
+ */
+typedef struct {
+	uint16_t lenght;							/*!< Bytes used (header and frames) */
+	uint16_t frames;							/*!< Frames of the sector */
+	uint8_t data[FLASH_LOG_SECTOR];				/*!< Header and frames */
+} sector_buffer_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const esp_partition_t *log_partition = NULL;
+static sector_buffer_t buffers[FLASH_LOG_BUFFERS];
+static uint8_t current = NO_BUFFER;				/* Buffer being filled */
+static uint32_t head = 0;						/* Next sector to write */
+static uint32_t next_seq = 0;					/* Sequence number of the next sector */
+static volatile uint8_t pending = 0;			/* Buffers queued and not yet written */
+static flash_log_stats_t log_stats;
+static QueueHandle_t free_queue = NULL;			/* Indexes of the free buffers */
+static QueueHandle_t write_queue = NULL;		/* Indexes of the buffers to write */
+static SemaphoreHandle_t log_mutex = NULL;		/* Current buffer, ring position and statistics */
+
+/* Tasks, queues and semaphores (static buffers with CONFIG_DRIVERS_STATIC_ALLOCATION) */
+STATIC_QUEUE_DEFINE(free_queue, FLASH_LOG_BUFFERS, sizeof(uint8_t));
+STATIC_QUEUE_DEFINE(write_queue, FLASH_LOG_BUFFERS, sizeof(uint8_t));
+STATIC_SEMAPHORE_DEFINE(log_mutex);
+STATIC_TASK_DEFINE(log_task, CONFIG_DRIVERS_FLASH_LOG_TASK_STACK);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Write a field of n bytes (little endian)
+ */
+static void FlashLogPut(uint8_t *p, uint64_t value, uint8_t n){
+	for(uint8_t i = 0; i < n; i++){
+		p[i] = value >> (8 * i);
+	}
+}
+
+/**
+ * @brief Read the header of a sector (false if it was not written)
+ */
+static bool FlashLogReadHeader(uint32_t sector, uint32_t *seq, uint64_t *time){
+	uint8_t header[FLASH_LOG_HEADER];
+	if(esp_partition_read(log_partition, sector * FLASH_LOG_SECTOR, header, FLASH_LOG_HEADER) != ESP_OK){
+		return false;
+	}
+	uint32_t magic = header[0] | (header[1] << 8) | (header[2] << 16) | ((uint32_t)header[3] << 24);
+	*seq = header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+	*time = 0;
+	for(uint8_t i = 0; i < 8; i++){
+		*time |= (uint64_t)header[8 + i] << (8 * i);
+	}
+	return magic == FLASH_LOG_MAGIC;
+}
+
+/**
+ * @brief Oldest sector of the log (with log_mutex taken)
+ */
+static uint32_t FlashLogOldest(void){
+	return (head + log_stats.capacity - log_stats.sectors) % log_stats.capacity;
+}
+
+/**
+ * @brief Close the current buffer and queue it (with log_mutex taken)
+ */
+static void FlashLogClose(void){
+	sector_buffer_t *buffer = &buffers[current];
+	FlashLogPut(&buffer->data[0], FLASH_LOG_MAGIC, 4);
+	FlashLogPut(&buffer->data[4], next_seq++, 4);
+	pending++;
+	// there are as many places in the queue as buffers: it never fails
+	xQueueSend(write_queue, &current, 0);
+	current = NO_BUFFER;
+}
+
+/**
+ * @brief Writing task: erases the next sector and writes a full buffer in it
+ */
+static void FlashLogTask(void *param){
+	uint8_t index;
+	while(true){
+		if(xQueueReceive(write_queue, &index, portMAX_DELAY) != pdTRUE){
+			continue;
+		}
+		sector_buffer_t *buffer = &buffers[index];
+		uint32_t offset = head * FLASH_LOG_SECTOR;
+		// only the used bytes are written: the rest of the sector stays erased (0xFF)
+		bool ok = esp_partition_erase_range(log_partition, offset, FLASH_LOG_SECTOR) == ESP_OK &&
+				  esp_partition_write(log_partition, offset, buffer->data, buffer->lenght) == ESP_OK;
+		xSemaphoreTake(log_mutex, portMAX_DELAY);
+		if(ok){
+			log_stats.frames += buffer->frames;
+			log_stats.bytes += buffer->lenght - FLASH_LOG_HEADER - buffer->frames * FRAME_HEADER;
+			log_stats.sectors_written++;
+		}else{
+			log_stats.write_errors++;
+			log_stats.dropped += buffer->frames;
+		}
+		// the sector is no longer the oldest one, even if it could not be written
+		if(log_stats.sectors == log_stats.capacity){
+			log_stats.sectors--;
+		}
+		if(ok){
+			log_stats.sectors++;
+		}
+		head = (head + 1) % log_stats.capacity;
+		pending--;
+		xSemaphoreGive(log_mutex);
+		xQueueSend(free_queue, &index, 0);
+	}
+}
+
+/**
+ * @brief Wait until every queued buffer is in the flash
+ */
+static void FlashLogWaitWritten(void){
+	while(pending > 0){
+		vTaskDelay(1);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool FlashLogInit(const char *partition){
+	if(log_mutex != NULL){
+		return false;
+	}
+	log_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition);
+	if(log_partition == NULL || log_partition->size < 2 * FLASH_LOG_SECTOR){
+		ESP_LOGE(TAG, "Partition %s not found", partition);
+		return false;
+	}
+	log_stats.capacity = log_partition->size / FLASH_LOG_SECTOR;
+	// the newest sector has the highest sequence number: the log goes on after it
+	bool found = false;
+	uint32_t newest = 0;
+	uint32_t seq;
+	uint64_t time;
+	for(uint32_t i = 0; i < log_stats.capacity; i++){
+		if(FlashLogReadHeader(i, &seq, &time)){
+			log_stats.sectors++;
+			if(!found || seq - next_seq < UINT32_MAX / 2){
+				newest = i;
+				next_seq = seq + 1;
+				found = true;
+			}
+		}
+	}
+	head = found ? (newest + 1) % log_stats.capacity : 0;
+	ESP_LOGI(TAG, "%lu of %lu sectors used", (unsigned long)log_stats.sectors, (unsigned long)log_stats.capacity);
+
+	free_queue = STATIC_QUEUE_CREATE(free_queue, FLASH_LOG_BUFFERS, sizeof(uint8_t));
+	write_queue = STATIC_QUEUE_CREATE(write_queue, FLASH_LOG_BUFFERS, sizeof(uint8_t));
+	log_mutex = STATIC_MUTEX_CREATE(log_mutex);
+	if(free_queue == NULL || write_queue == NULL || log_mutex == NULL){
+		return false;
+	}
+	for(uint8_t i = 0; i < FLASH_LOG_BUFFERS; i++){
+		xQueueSend(free_queue, &i, 0);
+	}
+	return STATIC_TASK_CREATE(log_task, FlashLogTask, "flash_log_task", NULL, WRITE_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+bool FlashLogWrite(const void *data, uint16_t lenght){
+	if(log_mutex == NULL){
+		return false;
+	}
+	xSemaphoreTake(log_mutex, portMAX_DELAY);
+	if(lenght > FLASH_LOG_MAX_FRAME){
+		log_stats.dropped++;
+		xSemaphoreGive(log_mutex);
+		return false;
+	}
+	if(current != NO_BUFFER && buffers[current].lenght + FRAME_HEADER + lenght > FLASH_LOG_SECTOR){
+		FlashLogClose();
+	}
+	if(current == NO_BUFFER){
+		if(xQueueReceive(free_queue, &current, 0) != pdTRUE){
+			current = NO_BUFFER;
+			log_stats.dropped++;
+			xSemaphoreGive(log_mutex);
+			return false;
+		}
+		sector_buffer_t *buffer = &buffers[current];
+		memset(buffer->data, 0xFF, FLASH_LOG_SECTOR);
+		FlashLogPut(&buffer->data[8], TimeNowUs(), 8);
+		buffer->lenght = FLASH_LOG_HEADER;
+		buffer->frames = 0;
+	}
+	sector_buffer_t *buffer = &buffers[current];
+	FlashLogPut(&buffer->data[buffer->lenght], lenght, FRAME_HEADER);
+	memcpy(&buffer->data[buffer->lenght + FRAME_HEADER], data, lenght);
+	buffer->lenght += FRAME_HEADER + lenght;
+	buffer->frames++;
+	xSemaphoreGive(log_mutex);
+	return true;
+}
+
+void FlashLogFlush(void){
+	if(log_mutex == NULL){
+		return;
+	}
+	xSemaphoreTake(log_mutex, portMAX_DELAY);
+	if(current != NO_BUFFER){
+		FlashLogClose();
+	}
+	xSemaphoreGive(log_mutex);
+}
+
+uint32_t FlashLogDump(uart_mcu_port_t port, uint64_t from_us){
+	static uint8_t chunk[DUMP_CHUNK];
+	uint32_t seq;
+	uint64_t time;
+	if(log_mutex == NULL){
+		return 0;
+	}
+	FlashLogFlush();
+	FlashLogWaitWritten();
+	xSemaphoreTake(log_mutex, portMAX_DELAY);
+	uint32_t oldest = FlashLogOldest();
+	uint32_t count = log_stats.sectors;
+	xSemaphoreGive(log_mutex);
+	// binary search of the last sector that starts before from_us (the sectors are in time order)
+	uint32_t first = 0;
+	uint32_t last = count;
+	while(from_us > 0 && last - first > 1){
+		uint32_t middle = (first + last) / 2;
+		if(FlashLogReadHeader((oldest + middle) % log_stats.capacity, &seq, &time) && time <= from_us){
+			first = middle;
+		}else{
+			last = middle;
+		}
+	}
+	uint32_t sent = 0;
+	uint32_t expected = 0;
+	for(uint32_t i = first; i < count; i++){
+		uint32_t sector = (oldest + i) % log_stats.capacity;
+		// a sector overwritten during the dump (the log is full and still recording) ends it
+		if(!FlashLogReadHeader(sector, &seq, &time) || (sent > 0 && seq != expected)){
+			break;
+		}
+		expected = seq + 1;
+		for(uint32_t offset = 0; offset < FLASH_LOG_SECTOR; offset += DUMP_CHUNK){
+			esp_partition_read(log_partition, sector * FLASH_LOG_SECTOR + offset, chunk, DUMP_CHUNK);
+			UartWrite(port, chunk, DUMP_CHUNK);
+		}
+		sent++;
+	}
+	return sent;
+}
+
+bool FlashLogErase(void){
+	if(log_mutex == NULL){
+		return false;
+	}
+	FlashLogWaitWritten();
+	xSemaphoreTake(log_mutex, portMAX_DELAY);
+	bool ok = esp_partition_erase_range(log_partition, 0, log_stats.capacity * FLASH_LOG_SECTOR) == ESP_OK;
+	head = 0;
+	log_stats.sectors = 0;
+	xSemaphoreGive(log_mutex);
+	return ok;
+}
+
+void FlashLogGetStats(flash_log_stats_t *stats){
+	if(log_mutex == NULL){
+		memset(stats, 0, sizeof(flash_log_stats_t));
+		return;
+	}
+	xSemaphoreTake(log_mutex, portMAX_DELAY);
+	*stats = log_stats;
+	xSemaphoreGive(log_mutex);
+}
+
+/*==================[end of file]============================================*/
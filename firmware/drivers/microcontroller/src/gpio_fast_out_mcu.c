@@ -11,16 +11,28 @@
 
 /*==================[inclusions]=============================================*/
 #include "gpio_fast_out_mcu.h"
+#include "iram_mcu.h"
 #include "gpio_mcu.h"
 #include <stdint.h>
-#include <string.h>
+#include <stddef.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
+#include "hal/dedic_gpio_cpu_ll.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
 /*==================[macros and definitions]=================================*/
-
+/**
+ * @brief Dedicated GPIO bundle
+ */
+typedef struct {
+    dedic_gpio_bundle_handle_t handle;  /*!< IDF bundle handle */
+    uint32_t mask;                      /*!< Mask of the bundle pins (bit 0: first pin) */
+    uint32_t offset;                    /*!< First dedicated output channel of the bundle */
+} fast_bundle_t;
 /*==================[internal data declaration]==============================*/
-dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+static fast_bundle_t bundles[GPIO_FAST_MAX_BUNDLES];
+static uint8_t bundles_qty = 0;
+static int8_t default_bundle = -1;      /*!< Bundle created by GPIOFastInit */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -31,28 +43,66 @@ int bundleA_gpios[16];
 
 /*==================[external functions definition]==========================*/
 
-void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
+int8_t GPIOFastBundleInit(gpio_t *pin_list, uint8_t pin_qty){
+    int gpios[GPIO_FAST_MAX_PINS];
+    if(bundles_qty >= GPIO_FAST_MAX_BUNDLES || pin_qty == 0 || pin_qty > GPIO_FAST_MAX_PINS){
+        return -1;
+    }
     gpio_config_t io_conf = {
         .mode = GPIO_MODE_OUTPUT,
     };
     for (int i = 0; i < pin_qty; i++) {
-        io_conf.pin_bit_mask = 1ULL << bundleA_gpios[i];
+        gpios[i] = pin_list[i];
+        io_conf.pin_bit_mask = 1ULL << gpios[i];
         gpio_config(&io_conf);
     }
-    // Create bundleA, output only
-    dedic_gpio_bundle_config_t bundleA_config = {
-        .gpio_array = bundleA_gpios,
+    // Output only bundle, on the first free dedicated channels
+    dedic_gpio_bundle_config_t bundle_config = {
+        .gpio_array = gpios,
         .array_size = pin_qty,
         .flags = {
             .out_en = 1,
         },
     };
-    ESP_ERROR_CHECK(dedic_gpio_new_bundle(&bundleA_config, &bundleA));
+    fast_bundle_t *bundle = &bundles[bundles_qty];
+    if(dedic_gpio_new_bundle(&bundle_config, &bundle->handle) != ESP_OK){
+        return -1;
+    }
+    dedic_gpio_get_out_offset(bundle->handle, &bundle->offset);
+    bundle->mask = (1UL << pin_qty) - 1;
+    return bundles_qty++;
+}
+
+void GPIOFastBundleWrite(int8_t bundle, uint32_t mask, uint32_t value){
+    fast_bundle_t *b = &bundles[bundle];
+    mask &= b->mask;
+    dedic_gpio_cpu_ll_write_mask(mask << b->offset, value << b->offset);
+}
+
+void IRAM_ATTR GPIOFastBundleStream(int8_t bundle, const uint8_t *values, uint32_t lenght, uint32_t hold_cycles){
+    fast_bundle_t *b = &bundles[bundle];
+    uint32_t mask = b->mask << b->offset;
+    uint32_t offset = b->offset;
+    uint32_t next = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < lenght; i++) {
+        if(hold_cycles > 0){
+            // deadlines from the first write: a late write doesn't delay the next ones
+            while((int32_t)(esp_cpu_get_cycle_count() - next) < 0){
+            }
+            next += hold_cycles;
+        }
+        dedic_gpio_cpu_ll_write_mask(mask, (uint32_t)values[i] << offset);
+    }
+}
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+    default_bundle = GPIOFastBundleInit(pin_list, pin_qty);
+    ESP_ERROR_CHECK(default_bundle < 0 ? ESP_FAIL : ESP_OK);
 }
 
-void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+void SAMPLE_PATH_ATTR GPIOFastWrite(uint16_t value){
+    fast_bundle_t *b = &bundles[default_bundle];
+    dedic_gpio_cpu_ll_write_mask(b->mask << b->offset, (uint32_t)value << b->offset);
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
@@ -21,38 +21,41 @@ typedef struct{
 	uint64_t pin;				/*!< GPIO pin */
 	gpio_mode_t mode;			/*!< Input/Output mode */
 	gpio_pull_mode_t pull;		/*!< GPIO pull-up/pull-down resistor */
-	bool state;					/*!< GPIO output state */
 } digital_io_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Set the interruption type of a GPIO and add its handler
+ */
+static void GPIOAddIsr(gpio_t pin, gpio_int_type_t type, void *ptr_int_func, void *args);
 
 /*==================[internal data definition]===============================*/
 digital_io_t gpio_list[GPIO_QTY] = {
-	{GPIO_NUM_0, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO0*/
-	{GPIO_NUM_1, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO1*/
-	{GPIO_NUM_2, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO2*/
-	{GPIO_NUM_3, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO3*/
-	{GPIO_NUM_4, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO4*/
-	{GPIO_NUM_5, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO5*/
-	{GPIO_NUM_6, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO6*/
-	{GPIO_NUM_7, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO7*/
-	{GPIO_NUM_8, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO8*/
-	{GPIO_NUM_9, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO9*/
-	{GPIO_NUM_10, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO10*/
-	{GPIO_NUM_11, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO11*/
-	{GPIO_NUM_12, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO12*/
-	{GPIO_NUM_13, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO13*/
-	{GPIO_NUM_14, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO14*/
-	{GPIO_NUM_15, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO15*/
-	{GPIO_NUM_16, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO16*/
-	{GPIO_NUM_17, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO17*/
-	{GPIO_NUM_18, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO18*/
-	{GPIO_NUM_19, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO19*/
-	{GPIO_NUM_20, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO20*/
-	{GPIO_NUM_21, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO21*/
-	{GPIO_NUM_22, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO22*/
-	{GPIO_NUM_23, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO23*/
+	{GPIO_NUM_0, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO0*/
+	{GPIO_NUM_1, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO1*/
+	{GPIO_NUM_2, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO2*/
+	{GPIO_NUM_3, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO3*/
+	{GPIO_NUM_4, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO4*/
+	{GPIO_NUM_5, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO5*/
+	{GPIO_NUM_6, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO6*/
+	{GPIO_NUM_7, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO7*/
+	{GPIO_NUM_8, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO8*/
+	{GPIO_NUM_9, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO9*/
+	{GPIO_NUM_10, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO10*/
+	{GPIO_NUM_11, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO11*/
+	{GPIO_NUM_12, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO12*/
+	{GPIO_NUM_13, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO13*/
+	{GPIO_NUM_14, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO14*/
+	{GPIO_NUM_15, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO15*/
+	{GPIO_NUM_16, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO16*/
+	{GPIO_NUM_17, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO17*/
+	{GPIO_NUM_18, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO18*/
+	{GPIO_NUM_19, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO19*/
+	{GPIO_NUM_20, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO20*/
+	{GPIO_NUM_21, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO21*/
+	{GPIO_NUM_22, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO22*/
+	{GPIO_NUM_23, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY}, /* Configuration GPIO23*/
 };
 gpio_flex_glitch_filter_config_t filter_config = {
 	.clk_src = GLITCH_FILTER_CLK_SRC_DEFAULT,
@@ -62,6 +65,15 @@ gpio_flex_glitch_filter_config_t filter_config = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void GPIOAddIsr(gpio_t pin, gpio_int_type_t type, void *ptr_int_func, void *args){
+	static bool isr_service_installed = false;
+	gpio_set_intr_type(gpio_list[pin].pin, type);
+	if(!isr_service_installed){	
+		gpio_install_isr_service(0);
+		isr_service_installed = true;
+	}
+    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+}
 
 /*==================[external functions definition]==========================*/
 void GPIOInit(gpio_t pin, io_t io){
@@ -79,41 +91,32 @@ void GPIOInit(gpio_t pin, io_t io){
 }
 
 void GPIOOn(gpio_t pin){
-	gpio_list[pin].state = true;
-	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
+	GPIOOnFast(pin);
 }
 
 void GPIOOff(gpio_t pin){
-	gpio_list[pin].state = false;
-	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
+	GPIOOffFast(pin);
 }
 
 void GPIOState(gpio_t pin, bool state){
-	gpio_list[pin].state = state;
-	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
+	GPIOStateFast(pin, state);
 }
 
 void GPIOToggle(gpio_t pin){
-	gpio_list[pin].state = !gpio_list[pin].state;
-	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
+	/* the output register keeps the state, including GPIOWriteMask changes */
+	GPIOStateFast(pin, !((GPIO.out.val >> pin) & 1));
 }
 
 bool GPIORead(gpio_t pin){
-	return gpio_get_level(gpio_list[pin].pin);
+	return GPIOReadFast(pin);
 }
 
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
-	static bool isr_service_installed = false;
-	if(edge){
-		gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_POSEDGE);
-	} else{
-		gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_NEGEDGE);
-	}
-	if(!isr_service_installed){	
-		gpio_install_isr_service(0);
-		isr_service_installed = true;
-	}
-    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+	GPIOAddIsr(pin, edge ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE, ptr_int_func, args);
+}
+
+void GPIOActivIntAnyEdge(gpio_t pin, void *ptr_int_func, void *args){
+	GPIOAddIsr(pin, GPIO_INTR_ANYEDGE, ptr_int_func, args);
 }
 
 void GPIOInputFilter(gpio_t pin){
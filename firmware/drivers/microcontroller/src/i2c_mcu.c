@@ -10,47 +10,324 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
 #include <esp_log.h>
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 //#include "sdkconfig.h"
 
 #include "i2c_mcu.h"
+#include "static_alloc_mcu.h"
 /*==================[macros and definitions]=================================*/
-#define I2C_NUM I2C_NUM_0
+#define I2C_TICKS   (I2C_MASTER_TIMEOUT_MS/portTICK_PERIOD_MS)
+#define I2C_LINK_SIZE   I2C_LINK_RECOMMENDED_SIZE(3)    /*!< Command link for address, register and data writes */
 
 #undef ESP_ERROR_CHECK
 #define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
 
+#define I2C_TASK_STACK  CONFIG_DRIVERS_I2C_TASK_STACK
+#define I2C_TASK_PRIO   10
 /*==================[internal data definition]===============================*/
+static QueueHandle_t i2c_pending = NULL;	/*!< Queued transactions */
+static QueueHandle_t i2c_done = NULL;		/*!< Finished transactions */
+STATIC_QUEUE_DEFINE(i2c_pending, I2C_QUEUE_SIZE, sizeof(i2c_trans_t*));
+STATIC_QUEUE_DEFINE(i2c_done, I2C_QUEUE_SIZE, sizeof(i2c_trans_t*));
+STATIC_TASK_DEFINE(i2c_task, I2C_TASK_STACK);
+STATIC_SEMAPHORES_DEFINE(i2c_lock, I2C_BUS_NUM);
 
+/**
+ * @brief State of an I2C bus
+ */
+typedef struct{
+	gpio_t sda;					/*!< SDA pin */
+	gpio_t scl;					/*!< SCL pin */
+	uint32_t clk_hz;			/*!< Bus clock (for devices without their own clock) */
+	uint32_t current_hz;		/*!< Clock the bus is configured with */
+	SemaphoreHandle_t lock;		/*!< Clock change and transaction are atomic (NULL: bus not initialized) */
+} i2c_bus_t;
+
+/**
+ * @brief Device added with I2C_addDevice
+ */
+typedef struct{
+	uint8_t addr;				/*!< I2C slave device address */
+	uint8_t bus;				/*!< Bus the device is connected to */
+	uint32_t clk_hz;			/*!< Device clock (0: bus clock) */
+} i2c_device_t;
+
+/**
+ * @brief Range of registers of a device kept in the shadow
+ */
+typedef struct{
+	uint8_t addr;				/*!< I2C slave device address */
+	uint8_t first;				/*!< First register */
+	uint8_t count;				/*!< Number of registers */
+	uint16_t offset;			/*!< Position of the first register in the shadow values */
+} i2c_shadow_t;
+
+static i2c_bus_t i2c_bus[I2C_BUS_NUM];
+static i2c_device_t i2c_devices[I2C_MAX_DEVICES];
+static uint8_t i2c_devices_num = 0;
+static i2c_shadow_t i2c_shadows[I2C_SHADOW_RANGES];
+static uint8_t i2c_shadows_num = 0;
+static uint16_t i2c_shadow_used = 0;
+static uint8_t i2c_shadow_values[I2C_SHADOW_SIZE];
+static bool i2c_shadow_valid[I2C_SHADOW_SIZE];
+static portMUX_TYPE i2c_shadow_mux = portMUX_INITIALIZER_UNLOCKED;	/*!< The shadow is updated from the callers and the driver task */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Take the bus of a device, setting the device clock if it's different
+ * @return I2C port of the bus
+ */
+static i2c_port_t I2C_begin(uint8_t devAddr);
 
-/*==================[external functions definition]==========================*/
+/**
+ * @brief Release the bus taken by I2C_begin
+ */
+static void I2C_end(i2c_port_t port);
 
-/** Initialize I2C0
+/**
+ * @brief Configure pins and clock of a bus
  */
-bool I2C_initialize( uint32_t clockRateHz )
-{
-	int i2c_master_port = I2C_MASTER_NUM;
+static esp_err_t I2C_config(uint8_t bus, uint32_t clockRateHz);
+/**
+ * @brief Write bytes to consecutive registers of a device
+ */
+static esp_err_t I2C_writeRegisters(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+
+/**
+ * @brief Update the shadow with registers read or written (data = NULL: forget them,
+ * i.e. after a failed write)
+ */
+static void I2C_shadowStore(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data);
+
+/**
+ * @brief Value of a register from the shadow
+ * @return false if the register has no shadow or it's not loaded
+ */
+static bool I2C_shadowLoad(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
 
+/**
+ * @brief Task that executes the queued transactions
+ */
+static void I2C_task(void *param);
+/*==================[internal functions definition]==========================*/
+static esp_err_t I2C_config(uint8_t bus, uint32_t clockRateHz){
     i2c_config_t conf = {
         .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
+        .sda_io_num = i2c_bus[bus].sda,
+        .scl_io_num = i2c_bus[bus].scl,
         .sda_pullup_en = GPIO_PULLUP_ENABLE,
         .scl_pullup_en = GPIO_PULLUP_ENABLE,
         .master.clk_speed = clockRateHz,
     };
+	i2c_bus[bus].current_hz = clockRateHz;
+	return i2c_param_config(bus, &conf);
+}
+
+static i2c_port_t I2C_begin(uint8_t devAddr){
+	uint8_t bus = I2C_BUS_0;
+	uint32_t clk_hz = 0;
+	for(uint8_t i = 0; i < i2c_devices_num; i++){
+		if(i2c_devices[i].addr == devAddr){
+			bus = i2c_devices[i].bus;
+			clk_hz = i2c_devices[i].clk_hz;
+			break;
+		}
+	}
+	if(i2c_bus[bus].lock == NULL){
+		return bus;
+	}
+	xSemaphoreTake(i2c_bus[bus].lock, portMAX_DELAY);
+	if(clk_hz == 0){
+		clk_hz = i2c_bus[bus].clk_hz;
+	}
+	/* The bus is only reconfigured when the clock changes */
+	if(clk_hz != i2c_bus[bus].current_hz){
+		I2C_config(bus, clk_hz);
+	}
+	return bus;
+}
+
+static void I2C_end(i2c_port_t port){
+	if(i2c_bus[port].lock != NULL){
+		xSemaphoreGive(i2c_bus[port].lock);
+	}
+}
+
+static esp_err_t I2C_writeRegisters(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
+	/* The command link is built in the stack: no heap allocation per transaction */
+	uint8_t link[I2C_LINK_SIZE] = {0};
+	i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link, sizeof(link));
+	esp_err_t err;
+
+	ESP_ERROR_CHECK(i2c_master_start(cmd));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
+	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length, 1));
+	ESP_ERROR_CHECK(i2c_master_stop(cmd));
+	i2c_port_t port = I2C_begin(devAddr);
+	err = i2c_master_cmd_begin(port, cmd, I2C_TICKS);
+	I2C_end(port);
+	i2c_cmd_link_delete_static(cmd);
+	I2C_shadowStore(devAddr, regAddr, length, (err == ESP_OK) ? data : NULL);
+	return err;
+}
+
+static void I2C_shadowStore(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data){
+	taskENTER_CRITICAL(&i2c_shadow_mux);
+	for(uint8_t i = 0; i < i2c_shadows_num; i++){
+		i2c_shadow_t *shadow = &i2c_shadows[i];
+		if(shadow->addr != devAddr){
+			continue;
+		}
+		/* Registers of the transaction inside the range */
+		for(uint16_t reg = regAddr; reg < regAddr + length; reg++){
+			if(reg >= shadow->first && reg < shadow->first + shadow->count){
+				uint16_t pos = shadow->offset + reg - shadow->first;
+				if(data != NULL){
+					i2c_shadow_values[pos] = data[reg - regAddr];
+				}
+				i2c_shadow_valid[pos] = (data != NULL);
+			}
+		}
+	}
+	taskEXIT_CRITICAL(&i2c_shadow_mux);
+}
+
+static bool I2C_shadowLoad(uint8_t devAddr, uint8_t regAddr, uint8_t *data){
+	bool valid = false;
+	taskENTER_CRITICAL(&i2c_shadow_mux);
+	for(uint8_t i = 0; i < i2c_shadows_num; i++){
+		i2c_shadow_t *shadow = &i2c_shadows[i];
+		if(shadow->addr == devAddr && regAddr >= shadow->first && regAddr < shadow->first + shadow->count){
+			uint16_t pos = shadow->offset + regAddr - shadow->first;
+			valid = i2c_shadow_valid[pos];
+			*data = i2c_shadow_values[pos];
+			break;
+		}
+	}
+	taskEXIT_CRITICAL(&i2c_shadow_mux);
+	return valid;
+}
+
+static void I2C_task(void *param){
+	i2c_trans_t *trans;
+	while(true){
+		xQueueReceive(i2c_pending, &trans, portMAX_DELAY);
+		esp_err_t err;
+		if(trans->write){
+			err = I2C_writeRegisters(trans->devAddr, trans->regAddr, trans->length, trans->data);
+		} else{
+			i2c_port_t port = I2C_begin(trans->devAddr);
+			err = i2c_master_write_read_device(port, trans->devAddr, &trans->regAddr, 1, trans->data, trans->length, I2C_TICKS);
+			I2C_end(port);
+			if(err == ESP_OK){
+				I2C_shadowStore(trans->devAddr, trans->regAddr, trans->length, trans->data);
+			}
+		}
+		trans->ok = (err == ESP_OK);
+		if(trans->func_p != NULL){
+			trans->func_p(trans->param_p);
+		}
+		if(trans->task != NULL){
+			xTaskNotifyGive(trans->task);
+		}
+		/* If results are not read the queue fills up and they're discarded */
+		xQueueSend(i2c_done, &trans, 0);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+
+/** Initialize I2C0
+ */
+bool I2C_initialize( uint32_t clockRateHz )
+{
+	return I2C_initializeBus(I2C_BUS_0, I2C_MASTER_SDA_IO, I2C_MASTER_SCL_IO, clockRateHz);
+}
 
-    i2c_param_config(i2c_master_port, &conf);
+bool I2C_initializeBus(uint8_t bus, gpio_t sda, gpio_t scl, uint32_t clockRateHz){
+	if(bus >= I2C_BUS_NUM){
+		return false;
+	}
+	i2c_bus[bus].sda = sda;
+	i2c_bus[bus].scl = scl;
+	i2c_bus[bus].clk_hz = clockRateHz;
+	I2C_config(bus, clockRateHz);
+
+	/* Task and queues for asynchronous transactions */
+	if(i2c_pending == NULL){
+		i2c_pending = STATIC_QUEUE_CREATE(i2c_pending, I2C_QUEUE_SIZE, sizeof(i2c_trans_t*));
+		i2c_done = STATIC_QUEUE_CREATE(i2c_done, I2C_QUEUE_SIZE, sizeof(i2c_trans_t*));
+		STATIC_TASK_CREATE(i2c_task, I2C_task, "I2C", NULL, I2C_TASK_PRIO, NULL);
+	}
+	if(i2c_bus[bus].lock != NULL){
+		/* Already installed, only the new clock is applied */
+		return true;
+	}
+	if(i2c_driver_install(bus, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0) != ESP_OK){
+		return false;
+	}
+	i2c_bus[bus].lock = STATIC_MUTEX_CREATE_N(i2c_lock, bus);
+	return true;
+}
 
-    return i2c_driver_install(i2c_master_port, conf.mode, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
+bool I2C_addDevice(uint8_t devAddr, uint8_t bus, uint32_t clockRateHz){
+	if(bus >= I2C_BUS_NUM){
+		return false;
+	}
+	for(uint8_t i = 0; i < i2c_devices_num; i++){
+		if(i2c_devices[i].addr == devAddr){
+			i2c_devices[i].bus = bus;
+			i2c_devices[i].clk_hz = clockRateHz;
+			return true;
+		}
+	}
+	if(i2c_devices_num >= I2C_MAX_DEVICES){
+		return false;
+	}
+	i2c_devices[i2c_devices_num].addr = devAddr;
+	i2c_devices[i2c_devices_num].bus = bus;
+	i2c_devices[i2c_devices_num].clk_hz = clockRateHz;
+	i2c_devices_num++;
 	return true;
-};
+}
 
+bool I2C_addShadow(uint8_t devAddr, uint8_t regAddr, uint8_t count){
+	/* Drivers add their ranges on every initialization */
+	for(uint8_t i = 0; i < i2c_shadows_num; i++){
+		if(i2c_shadows[i].addr == devAddr && i2c_shadows[i].first == regAddr && i2c_shadows[i].count == count){
+			return true;
+		}
+	}
+	if(i2c_shadows_num >= I2C_SHADOW_RANGES || i2c_shadow_used + count > I2C_SHADOW_SIZE){
+		return false;
+	}
+	taskENTER_CRITICAL(&i2c_shadow_mux);
+	i2c_shadows[i2c_shadows_num].addr = devAddr;
+	i2c_shadows[i2c_shadows_num].first = regAddr;
+	i2c_shadows[i2c_shadows_num].count = count;
+	i2c_shadows[i2c_shadows_num].offset = i2c_shadow_used;
+	memset(&i2c_shadow_valid[i2c_shadow_used], 0, count * sizeof(bool));
+	i2c_shadow_used += count;
+	i2c_shadows_num++;
+	taskEXIT_CRITICAL(&i2c_shadow_mux);
+	return true;
+}
 
+void I2C_invalidateShadow(uint8_t devAddr){
+	taskENTER_CRITICAL(&i2c_shadow_mux);
+	for(uint8_t i = 0; i < i2c_shadows_num; i++){
+		if(i2c_shadows[i].addr == devAddr){
+			memset(&i2c_shadow_valid[i2c_shadows[i].offset], 0, i2c_shadows[i].count * sizeof(bool));
+		}
+	}
+	taskEXIT_CRITICAL(&i2c_shadow_mux);
+}
 
 /** Enable or disable I2C
  * @param isEnabled true = enable, false = disable
@@ -124,21 +401,14 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	/* Register address and data in one transaction, with a repeated start */
+	i2c_port_t port = I2C_begin(devAddr);
+	esp_err_t err = i2c_master_write_read_device(port, devAddr, &regAddr, 1, data, length, I2C_TICKS);
+	I2C_end(port);
+	ESP_ERROR_CHECK(err);
+	if(err == ESP_OK){
+		I2C_shadowStore(devAddr, regAddr, length, data);
+	}
 
 	return length;
 }
@@ -151,20 +421,9 @@ int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_requestBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	i2c_port_t port = I2C_begin(devAddr);
+	ESP_ERROR_CHECK(i2c_master_read_from_device(port, devAddr, data, length, I2C_TICKS));
+	I2C_end(port);
 
 	return length;
 }
@@ -177,15 +436,9 @@ bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 }
 
 void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, reg, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	i2c_port_t port = I2C_begin(devAddr);
+	ESP_ERROR_CHECK(i2c_master_write_to_device(port, devAddr, &reg, 1, I2C_TICKS));
+	I2C_end(port);
 }
 
 /** write a single bit in an 8-bit device register.
@@ -196,10 +449,7 @@ void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
  * @return Status of operation (true = success)
  */
 bool I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    I2C_readByte(devAddr, regAddr, &b, 0);
-    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return I2C_writeByte(devAddr, regAddr, b);
+    return I2C_updateBits(devAddr, regAddr, 1 << bitNum, (data != 0) ? 0xFF : 0x00);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -218,17 +468,19 @@ bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t l
     // 10101111 original value (sample)
     // 10100011 original & ~mask
     // 10101011 masked | value
-    uint8_t b = 0;
-    if (I2C_readByte(devAddr, regAddr, &b, 0) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        b &= ~(mask); // zero all important bits in existing byte
-        b |= data; // combine data with existing byte
-        return I2C_writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
-    }
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    data <<= (bitStart - length + 1); // shift data into correct position
+    return I2C_updateBits(devAddr, regAddr, mask, data);
+}
+
+bool I2C_updateBits(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data){
+	uint8_t b = 0;
+	/* Without a loaded shadow the register is read first */
+	if(!I2C_shadowLoad(devAddr, regAddr, &b) && I2C_readByte(devAddr, regAddr, &b, 0) == 0){
+		return false;
+	}
+	b = (b & ~mask) | (data & mask);
+	return I2C_writeByte(devAddr, regAddr, b);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -238,16 +490,12 @@ bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t l
  * @return Status of operation (true = success)
  */
 bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	uint8_t buffer[] = {regAddr, data};
+	i2c_port_t port = I2C_begin(devAddr);
+	esp_err_t err = i2c_master_write_to_device(port, devAddr, buffer, sizeof(buffer), I2C_TICKS);
+	I2C_end(port);
+	ESP_ERROR_CHECK(err);
+	I2C_shadowStore(devAddr, regAddr, 1, (err == ESP_OK) ? &data : NULL);
 
 	return true;
 }
@@ -260,30 +508,30 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  * @return Status of operation (true = success)
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
+	I2C_writeRegisters(devAddr, regAddr, length, data);
 	return true;
 }
 
-bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr){
-	i2c_cmd_handle_t cmd;
+bool I2C_queue(i2c_trans_t *trans){
+	if(i2c_pending == NULL){
+		return false;
+	}
+	return xQueueSend(i2c_pending, &trans, 0) == pdTRUE;
+}
 
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
+i2c_trans_t* I2C_getResult(uint32_t timeout_ms){
+	i2c_trans_t *trans = NULL;
+	TickType_t ticks = (timeout_ms == I2C_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+	if(i2c_done == NULL || xQueueReceive(i2c_done, &trans, ticks) != pdTRUE){
+		return NULL;
+	}
+	return trans;
+}
+
+bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr){
+	i2c_port_t port = I2C_begin(devAddr);
+	i2c_master_write_to_device(port, devAddr, &regAddr, 1, I2C_TICKS);
+	I2C_end(port);
 	return true;
 }
 
@@ -0,0 +1,124 @@
+/**
+ * @file jitter_buffer_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "jitter_buffer_mcu.h"
+#include <string.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Start a new adaptation window
+ */
+static IRAM_ATTR void JitterBufferNewWindow(jitter_buffer_t *jb){
+	jb->played = 0;
+	jb->min_level = UINT32_MAX;
+	jb->window_underrun = false;
+}
+
+/**
+ * @brief End of a window: decay the target and drop one sample if the level never went under it
+ */
+static IRAM_ATTR void JitterBufferAdapt(jitter_buffer_t *jb){
+	if(!jb->window_underrun){
+		jb->target -= (jb->target - jb->start_level) / 8;
+		if(jb->min_level > jb->target){
+			uint8_t dropped[JITTER_BUFFER_MAX_ELEM_SIZE];
+			RingBufferPop(&jb->ring, dropped);
+			jb->skipped++;
+		}
+	}
+	JitterBufferNewWindow(jb);
+}
+/*==================[external functions definition]==========================*/
+bool JitterBufferInit(jitter_buffer_t *jb, const jitter_buffer_config_t *config){
+	if(config->elem_size == 0 || config->elem_size > JITTER_BUFFER_MAX_ELEM_SIZE || config->window == 0){
+		return false;
+	}
+	if(!RingBufferInit(&jb->ring, config->storage, config->elem_size, config->elem_num)){
+		return false;
+	}
+	jb->start_level = config->start_level ? config->start_level : config->elem_num / 8;
+	jb->max_level = config->max_level ? config->max_level : config->elem_num * 3 / 4;
+	jb->step = config->step ? config->step : jb->start_level / 2;
+	if(jb->start_level == 0 || jb->start_level > jb->max_level || jb->max_level > config->elem_num){
+		return false;
+	}
+	jb->window = config->window;
+	jb->underruns = 0;
+	jb->skipped = 0;
+	memset(jb->last, 0, sizeof(jb->last));
+	JitterBufferFlush(jb);
+	return true;
+}
+
+uint32_t JitterBufferWrite(jitter_buffer_t *jb, const void *elems, uint32_t n){
+	return RingBufferWrite(&jb->ring, elems, n);
+}
+
+IRAM_ATTR bool JitterBufferRead(jitter_buffer_t *jb, void *elem){
+	uint32_t level = RingBufferCount(&jb->ring);
+	if(!jb->playing){
+		if(level < jb->target){
+			memcpy(elem, jb->last, jb->ring.elem_size);
+			return false;
+		}
+		jb->playing = true;
+	}
+	if(level == 0){
+		// underrun: hold the last sample and buffer more from now on
+		jb->playing = false;
+		jb->underruns++;
+		jb->window_underrun = true;
+		jb->target += jb->step;
+		if(jb->target > jb->max_level){
+			jb->target = jb->max_level;
+		}
+		memcpy(elem, jb->last, jb->ring.elem_size);
+		return false;
+	}
+	if(level < jb->min_level){
+		jb->min_level = level;
+	}
+	RingBufferPop(&jb->ring, jb->last);
+	memcpy(elem, jb->last, jb->ring.elem_size);
+	if(++jb->played == jb->window){
+		JitterBufferAdapt(jb);
+	}
+	return true;
+}
+
+void JitterBufferGetStats(jitter_buffer_t *jb, jitter_buffer_stats_t *stats){
+	stats->level = RingBufferCount(&jb->ring);
+	stats->target = jb->target;
+	stats->underruns = jb->underruns;
+	stats->overruns = jb->ring.overflows;
+	stats->skipped = jb->skipped;
+	stats->playing = jb->playing;
+}
+
+void JitterBufferFlush(jitter_buffer_t *jb){
+	RingBufferFlush(&jb->ring);
+	jb->target = jb->start_level;
+	jb->playing = false;
+	JitterBufferNewWindow(jb);
+}
+
+/*==================[end of file]============================================*/
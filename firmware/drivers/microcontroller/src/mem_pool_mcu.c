@@ -0,0 +1,103 @@
+/**
+ * @file mem_pool_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "mem_pool_mcu.h"
+#include <stddef.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+#define MEM_POOL_NONE		0xFFFF		/* End of the free list */
+#define MEM_POOL_INDEX(head)	((head) & 0xFFFF)
+/* new head pointing to block idx: the counter changes on every update, so a head read
+ * before another task took and returned the same block doesn't match any more (ABA) */
+#define MEM_POOL_HEAD(head, idx)	((((head) + 0x10000) & 0xFFFF0000) | (idx))
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Index of the next free block, stored at the beginning of a free block
+ */
+static inline volatile uint16_t *MemPoolNext(mem_pool_t *pool, uint32_t idx){
+	return (volatile uint16_t *)&pool->storage[idx * pool->block_size];
+}
+
+/*==================[external functions definition]==========================*/
+bool MemPoolInit(mem_pool_t *pool, void *storage, uint32_t elem_size, uint16_t block_num){
+	if(storage == NULL || elem_size == 0 || block_num == 0 || block_num > MEM_POOL_MAX_BLOCKS ||
+	   ((uintptr_t)storage % MEM_POOL_ALIGN) != 0){
+		return false;
+	}
+	pool->storage = storage;
+	pool->block_size = MEM_POOL_BLOCK_SIZE(elem_size);
+	pool->block_num = block_num;
+	for(uint32_t i = 0; i < block_num; i++){
+		*MemPoolNext(pool, i) = (i + 1 < block_num) ? i + 1 : MEM_POOL_NONE;
+	}
+	pool->in_use = 0;
+	pool->peak = 0;
+	pool->allocs = 0;
+	pool->failures = 0;
+	__atomic_store_n(&pool->head, 0, __ATOMIC_RELEASE);
+	return true;
+}
+
+IRAM_ATTR void *MemPoolAlloc(mem_pool_t *pool){
+	uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_ACQUIRE);
+	uint32_t idx;
+	do{
+		idx = MEM_POOL_INDEX(head);
+		if(idx == MEM_POOL_NONE){
+			__atomic_fetch_add(&pool->failures, 1, __ATOMIC_RELAXED);
+			return NULL;
+		}
+		// if another task took the block in between, the counter of the head changed and it's retried
+	}while(!__atomic_compare_exchange_n(&pool->head, &head, MEM_POOL_HEAD(head, *MemPoolNext(pool, idx)),
+		true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+	uint32_t in_use = __atomic_add_fetch(&pool->in_use, 1, __ATOMIC_RELAXED);
+	uint32_t peak = __atomic_load_n(&pool->peak, __ATOMIC_RELAXED);
+	while(in_use > peak && !__atomic_compare_exchange_n(&pool->peak, &peak, in_use,
+		true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	__atomic_fetch_add(&pool->allocs, 1, __ATOMIC_RELAXED);
+	return &pool->storage[idx * pool->block_size];
+}
+
+IRAM_ATTR bool MemPoolFree(mem_pool_t *pool, void *block){
+	uint32_t offset = (uint8_t *)block - pool->storage;
+	if((uint8_t *)block < pool->storage || offset >= pool->block_size * pool->block_num ||
+	   (offset % pool->block_size) != 0){
+		return false;
+	}
+	uint32_t idx = offset / pool->block_size;
+	uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+	do{
+		*MemPoolNext(pool, idx) = MEM_POOL_INDEX(head);
+	}while(!__atomic_compare_exchange_n(&pool->head, &head, MEM_POOL_HEAD(head, idx),
+		true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	__atomic_fetch_sub(&pool->in_use, 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+void MemPoolGetStats(const mem_pool_t *pool, mem_pool_stats_t *stats){
+	stats->block_size = pool->block_size;
+	stats->block_num = pool->block_num;
+	stats->in_use = pool->in_use;
+	stats->peak = pool->peak;
+	stats->allocs = pool->allocs;
+	stats->failures = pool->failures;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,179 @@
+/**
+ * @file metrics_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "metrics_mcu.h"
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "time_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define METRICS_HEADER_SIZE	9
+#define METRICS_LINE_SIZE	160
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static metric_t *metrics[METRICS_MAX];
+static volatile uint8_t metrics_num = 0;
+static portMUX_TYPE metrics_mux = portMUX_INITIALIZER_UNLOCKED;
+static const char *kind_name[] = {"counter", "gauge", "histogram"};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief CRC16-CCITT (polynomial 0x1021) of a block, continuing from crc
+ */
+static uint16_t MetricsCrc16(uint16_t crc, const uint8_t *data, uint32_t lenght){
+	for(uint32_t i = 0; i < lenght; i++){
+		crc ^= (uint16_t)data[i] << 8;
+		for(uint8_t bit = 0; bit < 8; bit++){
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+/**
+ * @brief Values of a metric in the snapshot
+ */
+static uint8_t MetricsValues(const metric_t *metric){
+	switch(metric->kind){
+	case METRIC_GAUGE:
+		return 2;
+	case METRIC_HISTOGRAM:
+		return metric->buckets + 2;
+	default:
+		return 1;
+	}
+}
+
+/**
+ * @brief Store a 32 bits value (little endian)
+ */
+static void MetricsPut32(uint8_t *buffer, uint32_t value){
+	buffer[0] = value & 0xFF;
+	buffer[1] = (value >> 8) & 0xFF;
+	buffer[2] = (value >> 16) & 0xFF;
+	buffer[3] = value >> 24;
+}
+
+/*==================[external functions definition]==========================*/
+bool MetricsRegister(metric_t *metric){
+	bool ok = metric->buckets <= METRICS_MAX_BUCKETS;
+	taskENTER_CRITICAL(&metrics_mux);
+	for(uint8_t i = 0; i < metrics_num && ok; i++){
+		ok = (metrics[i] != metric);
+	}
+	if(ok && metrics_num < METRICS_MAX){
+		metrics[metrics_num++] = metric;
+	} else {
+		ok = false;
+	}
+	taskEXIT_CRITICAL(&metrics_mux);
+	return ok;
+}
+
+void MetricsReset(void){
+	uint8_t n = metrics_num;
+	for(uint8_t i = 0; i < n; i++){
+		metric_t *metric = metrics[i];
+		if(metric->kind == METRIC_GAUGE){
+			__atomic_store_n(&metric->values[1], __atomic_load_n(&metric->values[0], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+			continue;
+		}
+		for(uint8_t k = 0; k < MetricsValues(metric); k++){
+			__atomic_store_n(&metric->values[k], 0, __ATOMIC_RELAXED);
+		}
+	}
+}
+
+uint32_t MetricsSnapshotSize(void){
+	uint8_t n = metrics_num;
+	uint32_t size = METRICS_HEADER_SIZE + 2;
+	for(uint8_t i = 0; i < n; i++){
+		size += 2 + 4 * MetricsValues(metrics[i]);
+	}
+	return size;
+}
+
+uint32_t MetricsSnapshot(uint8_t *buffer, uint32_t size){
+	uint8_t n = metrics_num;
+	uint32_t pos = METRICS_HEADER_SIZE;
+	if(size < MetricsSnapshotSize()){
+		return 0;
+	}
+	buffer[0] = 'M';
+	buffer[1] = 'E';
+	buffer[2] = 'T';
+	buffer[3] = METRICS_VERSION;
+	MetricsPut32(&buffer[4], TimeNowMs());
+	buffer[8] = n;
+	for(uint8_t i = 0; i < n; i++){
+		const metric_t *metric = metrics[i];
+		uint8_t k = MetricsValues(metric);
+		buffer[pos++] = metric->kind;
+		buffer[pos++] = k;
+		for(uint8_t j = 0; j < k; j++){
+			MetricsPut32(&buffer[pos], __atomic_load_n(&metric->values[j], __ATOMIC_RELAXED));
+			pos += 4;
+		}
+	}
+	uint16_t crc = MetricsCrc16(0xFFFF, buffer, pos);
+	buffer[pos++] = crc & 0xFF;
+	buffer[pos++] = crc >> 8;
+	return pos;
+}
+
+void MetricsDump(metrics_write_t write_p){
+	// one metric at a time: no buffer for the whole snapshot
+	uint8_t n = metrics_num;
+	uint8_t part[2 + 4 * (METRICS_MAX_BUCKETS + 2)];
+	if(write_p == NULL){
+		return;
+	}
+	uint8_t header[METRICS_HEADER_SIZE] = {'M', 'E', 'T', METRICS_VERSION};
+	MetricsPut32(&header[4], TimeNowMs());
+	header[8] = n;
+	uint16_t crc = MetricsCrc16(0xFFFF, header, sizeof(header));
+	write_p(header, sizeof(header));
+	for(uint8_t i = 0; i < n; i++){
+		const metric_t *metric = metrics[i];
+		uint8_t k = MetricsValues(metric);
+		part[0] = metric->kind;
+		part[1] = k;
+		for(uint8_t j = 0; j < k; j++){
+			MetricsPut32(&part[2 + 4 * j], __atomic_load_n(&metric->values[j], __ATOMIC_RELAXED));
+		}
+		crc = MetricsCrc16(crc, part, 2 + 4 * k);
+		write_p(part, 2 + 4 * k);
+	}
+	uint8_t tail[2] = {crc & 0xFF, crc >> 8};
+	write_p(tail, sizeof(tail));
+}
+
+void MetricsDescribe(metrics_print_t print_p){
+	char line[METRICS_LINE_SIZE];
+	uint8_t n = metrics_num;
+	for(uint8_t i = 0; i < n; i++){
+		const metric_t *metric = metrics[i];
+		int len = snprintf(line, sizeof(line), "%u %s %s", i, kind_name[metric->kind], metric->name);
+		for(uint8_t b = 0; b < metric->buckets && len < (int)sizeof(line); b++){
+			len += snprintf(&line[len], sizeof(line) - len, "%c%lu", (b == 0) ? ' ' : ',', (unsigned long)metric->bounds[b]);
+		}
+		if(len < (int)sizeof(line) - 2){
+			snprintf(&line[len], sizeof(line) - len, "\r\n");
+		}
+		print_p(line);
+	}
+}
+
+/*==================[end of file]============================================*/
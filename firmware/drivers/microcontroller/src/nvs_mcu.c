@@ -0,0 +1,72 @@
+/**
+ * @file nvs_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "nvs_mcu.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static nvs_handle_t nvs_ns_handle = 0;	/*!< Handle of NVS_NAMESPACE (0: not open) */
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool NvsInit(void){
+	if(nvs_ns_handle != 0){
+		return true;
+	}
+	esp_err_t ret = nvs_flash_init();
+	if(ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND){
+		nvs_flash_erase();
+		ret = nvs_flash_init();
+	}
+	if(ret != ESP_OK){
+		return false;
+	}
+	return nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_ns_handle) == ESP_OK;
+}
+
+bool NvsRead(const char *key, void *data, uint32_t *lenght){
+	size_t size = *lenght;
+	if(nvs_ns_handle == 0 || nvs_get_blob(nvs_ns_handle, key, data, &size) != ESP_OK){
+		return false;
+	}
+	*lenght = size;
+	return true;
+}
+
+bool NvsWrite(const char *key, const void *data, uint32_t lenght){
+	if(nvs_ns_handle == 0 || nvs_set_blob(nvs_ns_handle, key, data, lenght) != ESP_OK){
+		return false;
+	}
+	return nvs_commit(nvs_ns_handle) == ESP_OK;
+}
+
+bool NvsErase(const char *key){
+	if(nvs_ns_handle == 0){
+		return false;
+	}
+	esp_err_t ret = nvs_erase_key(nvs_ns_handle, key);
+	if(ret != ESP_OK && ret != ESP_ERR_NVS_NOT_FOUND){
+		return false;
+	}
+	return nvs_commit(nvs_ns_handle) == ESP_OK;
+}
+
+/*==================[end of file]============================================*/
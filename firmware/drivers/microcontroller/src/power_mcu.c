@@ -0,0 +1,156 @@
+/**
+ * @file power_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "power_mcu.h"
+#include <stddef.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+/*==================[macros and definitions]=================================*/
+#define XTAL_FREQ_MHZ		40
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Lock and the time it was held
+ */
+typedef struct {
+	esp_pm_lock_handle_t freq;		// frequency lock
+	esp_pm_lock_handle_t awake;		// light sleep lock (NULL: not needed)
+	uint32_t count;					// times acquired and not released
+	int64_t since;					// time of the first acquire
+	uint64_t held_us;
+} power_lock_state_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static power_lock_state_t locks[POWER_LOCKS];
+static uint32_t active_count = 0;
+static int64_t active_since;
+static uint64_t active_us;
+static int64_t init_time;
+static bool locks_created = false;
+static bool sleep_wakeup = false;
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Create the esp_pm locks (once)
+ */
+static bool PowerCreateLocks(void){
+	if(locks_created){
+		return true;
+	}
+	if(esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "bus", &locks[POWER_LOCK_BUS].freq) != ESP_OK ||
+	   esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "bus_awake", &locks[POWER_LOCK_BUS].awake) != ESP_OK ||
+	   esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "dsp", &locks[POWER_LOCK_DSP].freq) != ESP_OK){
+		return false;
+	}
+	// a running task keeps the chip awake: DSP bursts only need the frequency
+	locks[POWER_LOCK_DSP].awake = NULL;
+	locks_created = true;
+	return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool PowerInit(const power_config_t *config){
+	esp_pm_config_t pm_config = {
+		.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+		.min_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+		.light_sleep_enable = false
+	};
+	if(config != NULL){
+		if(config->max_freq_mhz > 0){
+			pm_config.max_freq_mhz = config->max_freq_mhz;
+		}
+		pm_config.min_freq_mhz = (config->min_freq_mhz > 0) ? config->min_freq_mhz : XTAL_FREQ_MHZ;
+		pm_config.light_sleep_enable = config->light_sleep;
+	}
+	if(!PowerCreateLocks() || esp_pm_configure(&pm_config) != ESP_OK){
+		return false;
+	}
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&power_mux);
+	init_time = now;
+	active_since = now;
+	active_us = 0;
+	for(uint8_t i = 0; i < POWER_LOCKS; i++){
+		locks[i].since = now;
+		locks[i].held_us = 0;
+	}
+	taskEXIT_CRITICAL(&power_mux);
+	return true;
+}
+
+void PowerAcquire(power_lock_t lock){
+	if(!locks_created || lock >= POWER_LOCKS){
+		return;
+	}
+	esp_pm_lock_acquire(locks[lock].freq);
+	if(locks[lock].awake != NULL){
+		esp_pm_lock_acquire(locks[lock].awake);
+	}
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&power_mux);
+	if(locks[lock].count++ == 0){
+		locks[lock].since = now;
+	}
+	if(active_count++ == 0){
+		active_since = now;
+	}
+	taskEXIT_CRITICAL(&power_mux);
+}
+
+void PowerRelease(power_lock_t lock){
+	if(!locks_created || lock >= POWER_LOCKS || locks[lock].count == 0){
+		return;
+	}
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&power_mux);
+	if(--locks[lock].count == 0){
+		locks[lock].held_us += now - locks[lock].since;
+	}
+	if(--active_count == 0){
+		active_us += now - active_since;
+	}
+	taskEXIT_CRITICAL(&power_mux);
+	if(locks[lock].awake != NULL){
+		esp_pm_lock_release(locks[lock].awake);
+	}
+	esp_pm_lock_release(locks[lock].freq);
+}
+
+bool PowerWakeOnGpio(gpio_t pin, bool level){
+	if(gpio_wakeup_enable((gpio_num_t)pin, level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL) != ESP_OK){
+		return false;
+	}
+	if(!sleep_wakeup){
+		sleep_wakeup = (esp_sleep_enable_gpio_wakeup() == ESP_OK);
+	}
+	return sleep_wakeup;
+}
+
+void PowerGetStats(power_stats_t *stats){
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&power_mux);
+	stats->time_us = now - init_time;
+	// locks held now count up to this moment
+	stats->active_us = active_us + ((active_count > 0) ? now - active_since : 0);
+	for(uint8_t i = 0; i < POWER_LOCKS; i++){
+		stats->lock_us[i] = locks[i].held_us + ((locks[i].count > 0) ? now - locks[i].since : 0);
+	}
+	taskEXIT_CRITICAL(&power_mux);
+}
+
+/*==================[end of file]============================================*/
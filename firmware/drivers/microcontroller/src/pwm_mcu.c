@@ -12,13 +12,25 @@
 /*==================[inclusions]=============================================*/
 #include "pwm_mcu.h"
 #include "driver/ledc.h"
+#include "freertos/FreeRTOS.h"
 /*==================[macros and definitions]=================================*/
-#define DC_MAX  1023
-#define DC_100  100
+#define DC_100          100
+#define PWM_QTY         4
+#define PWM_RES_DEFAULT 10          /*!< Resolution of PWMInit (bits) */
+#define PWM_RES_MAX     20          /*!< LEDC timers counter width (bits) */
+#define PWM_SRC_CLK_HZ  80000000UL   /*!< LEDC_AUTO_CLK source (PLL 80 MHz) */
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief PWM output: each one has its own LEDC timer and channel
+ */
+typedef struct {
+    ledc_timer_t timer;
+    ledc_channel_t channel;
+    uint32_t duty_max;              /*!< Duty of 100% (2^resolution - 1) */
+} pwm_data_t;
 static ledc_timer_config_t pwm_timer_cfg = {
     .speed_mode       = LEDC_LOW_SPEED_MODE,
-    .duty_resolution  = LEDC_TIMER_10_BIT,
+    .duty_resolution  = PWM_RES_DEFAULT,
     .clk_cfg          = LEDC_AUTO_CLK
 };
 static ledc_channel_config_t ledc_channel_cfg = {
@@ -30,147 +42,126 @@ static ledc_channel_config_t ledc_channel_cfg = {
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static pwm_data_t pwm[PWM_QTY] = {
+    {LEDC_TIMER_0, LEDC_CHANNEL_0, (1 << PWM_RES_DEFAULT) - 1},
+    {LEDC_TIMER_1, LEDC_CHANNEL_1, (1 << PWM_RES_DEFAULT) - 1},
+    {LEDC_TIMER_2, LEDC_CHANNEL_2, (1 << PWM_RES_DEFAULT) - 1},
+    {LEDC_TIMER_3, LEDC_CHANNEL_3, (1 << PWM_RES_DEFAULT) - 1},
+};
+static portMUX_TYPE pwm_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool fade_installed = false;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
 uint8_t PWMInit(pwm_out_t out, gpio_t gpio, uint16_t freq){
-    switch(out){
-        case PWM_0:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_0;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_0;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_0;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_1:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_1;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_1;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_1;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_2:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_2;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_2;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_2;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_3:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_3;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_3;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_3;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
+    return PWMInitResolution(out, gpio, freq, PWM_RES_DEFAULT);
+}
+
+uint8_t PWMInitResolution(pwm_out_t out, gpio_t gpio, uint32_t freq, uint8_t resolution){
+    if(out >= PWM_QTY || freq == 0){
+        return 1;
+    }
+    if(resolution == 0 || resolution > PWM_RES_MAX){
+        /* highest resolution for the frequency */
+        resolution = PWM_RES_MAX;
+        while(resolution > 1 && (PWM_SRC_CLK_HZ >> resolution) < freq){
+            resolution--;
+        }
+    }
+    pwm_timer_cfg.freq_hz = freq;
+    pwm_timer_cfg.timer_num = pwm[out].timer;
+    pwm_timer_cfg.duty_resolution = resolution;
+    if(ledc_timer_config(&pwm_timer_cfg) != ESP_OK){
+        return 1;
     }
+    ledc_channel_cfg.channel = pwm[out].channel;
+    ledc_channel_cfg.timer_sel = pwm[out].timer;
+    ledc_channel_cfg.gpio_num = gpio;
+    ledc_channel_config(&ledc_channel_cfg);
+    pwm[out].duty_max = (1UL << resolution) - 1;
     return 0;
 }
 
 void PWMOn(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
-    }
+    ledc_timer_resume(LEDC_LOW_SPEED_MODE, pwm[out].timer);
 }
 
 void PWMOff(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
-    }
+    ledc_timer_pause(LEDC_LOW_SPEED_MODE, pwm[out].timer);
 }
 
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
     if(duty_cycle > DC_100){
         duty_cycle = DC_100;
     }
-    uint32_t dc = ((uint32_t)duty_cycle * DC_MAX) / DC_100;
-    switch(out){
-        case PWM_0:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
+    PWMSetDuty(out, ((uint64_t)duty_cycle * pwm[out].duty_max) / DC_100);
+}
+
+void PWMSetDuty(pwm_out_t out, uint32_t duty){
+    if(duty > pwm[out].duty_max){
+        duty = pwm[out].duty_max;
     }
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, pwm[out].channel, duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm[out].channel);
 }
 
-uint8_t PWMSetFreq(pwm_out_t out, uint32_t freq){
-    switch(out){
-        case PWM_0:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, freq);
-            break;
-        case PWM_1:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1, freq);
-            break;
-        case PWM_2:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2, freq);
-            break;
-        case PWM_3:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3, freq);
-            break;
+uint32_t PWMGetDutyMax(pwm_out_t out){
+    return pwm[out].duty_max;
+}
+
+void PWMSetDutyMulti(const pwm_out_t *outs, const uint32_t *duties, uint8_t lenght){
+    for(uint8_t i = 0; i < lenght; i++){
+        uint32_t duty = (duties[i] > pwm[outs[i]].duty_max) ? pwm[outs[i]].duty_max : duties[i];
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, pwm[outs[i]].channel, duty);
+    }
+    /* the new duties are latched together, each one at the end of its current period */
+    taskENTER_CRITICAL(&pwm_mux);
+    for(uint8_t i = 0; i < lenght; i++){
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm[outs[i]].channel);
     }
+    taskEXIT_CRITICAL(&pwm_mux);
+}
+
+void PWMSync(const pwm_out_t *outs, uint8_t lenght){
+    taskENTER_CRITICAL(&pwm_mux);
+    for(uint8_t i = 0; i < lenght; i++){
+        ledc_timer_rst(LEDC_LOW_SPEED_MODE, pwm[outs[i]].timer);
+    }
+    taskEXIT_CRITICAL(&pwm_mux);
+}
+
+bool PWMFade(pwm_out_t out, uint32_t duty, uint32_t time_ms, bool wait){
+    if(!fade_installed){
+        if(ledc_fade_func_install(0) != ESP_OK){
+            return false;
+        }
+        fade_installed = true;
+    }
+    if(duty > pwm[out].duty_max){
+        duty = pwm[out].duty_max;
+    }
+    if(ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, pwm[out].channel, duty, time_ms) != ESP_OK){
+        return false;
+    }
+    return ledc_fade_start(LEDC_LOW_SPEED_MODE, pwm[out].channel, wait ? LEDC_FADE_WAIT_DONE : LEDC_FADE_NO_WAIT) == ESP_OK;
+}
+
+void PWMFadeStop(pwm_out_t out){
+    if(fade_installed){
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm[out].channel);
+    }
+}
+
+uint8_t PWMSetFreq(pwm_out_t out, uint32_t freq){
+    ledc_set_freq(LEDC_LOW_SPEED_MODE, pwm[out].timer, freq);
     return 0;
 }
 
 uint8_t PWMDeinit(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0, 0);
-            break;
-        case PWM_1:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_1, 0);
-            break;
-        case PWM_2:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_2, 0);
-            break;
-        case PWM_3:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_3, 0);
-            break;
-    }
+    ledc_stop(LEDC_LOW_SPEED_MODE, pwm[out].channel, 0);
     return 0;
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
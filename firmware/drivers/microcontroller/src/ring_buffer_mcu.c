@@ -0,0 +1,159 @@
+/**
+ * @file ring_buffer_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ring_buffer_mcu.h"
+#include <string.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Copy n elements to the storage starting at head (wrapping around the end)
+ */
+static IRAM_ATTR void RingBufferCopyIn(ring_buffer_t *rb, uint32_t head, const uint8_t *src, uint32_t n){
+	uint32_t idx = head & rb->mask;
+	uint32_t first = rb->mask + 1 - idx;
+	if(first > n){
+		first = n;
+	}
+	memcpy(&rb->storage[idx * rb->elem_size], src, first * rb->elem_size);
+	memcpy(rb->storage, &src[first * rb->elem_size], (n - first) * rb->elem_size);
+}
+
+/**
+ * @brief Copy n elements from the storage starting at tail (wrapping around the end)
+ */
+static IRAM_ATTR void RingBufferCopyOut(ring_buffer_t *rb, uint32_t tail, uint8_t *dst, uint32_t n){
+	uint32_t idx = tail & rb->mask;
+	uint32_t first = rb->mask + 1 - idx;
+	if(first > n){
+		first = n;
+	}
+	memcpy(dst, &rb->storage[idx * rb->elem_size], first * rb->elem_size);
+	memcpy(&dst[first * rb->elem_size], rb->storage, (n - first) * rb->elem_size);
+}
+
+/**
+ * @brief Notify the consumer if the stored elements just crossed the watermark
+ */
+static IRAM_ATTR void RingBufferCheckWatermark(ring_buffer_t *rb, uint32_t count_before, uint32_t count_after, BaseType_t *task_woken){
+	if(rb->watermark == 0 || rb->consumer == NULL){
+		return;
+	}
+	if(count_before < rb->watermark && count_after >= rb->watermark){
+		vTaskNotifyGiveFromISR(rb->consumer, task_woken);
+	}
+}
+/*==================[external functions definition]==========================*/
+bool RingBufferInit(ring_buffer_t *rb, void *storage, uint32_t elem_size, uint32_t elem_num){
+	if(elem_num == 0 || (elem_num & (elem_num - 1)) != 0){
+		return false;
+	}
+	rb->storage = storage;
+	rb->elem_size = elem_size;
+	rb->mask = elem_num - 1;
+	rb->head = 0;
+	rb->tail = 0;
+	rb->watermark = 0;
+	rb->consumer = NULL;
+	rb->overflows = 0;
+	return true;
+}
+
+void RingBufferSetWatermark(ring_buffer_t *rb, TaskHandle_t consumer, uint32_t watermark){
+	rb->consumer = consumer;
+	rb->watermark = watermark;
+}
+
+IRAM_ATTR uint32_t RingBufferWrite(ring_buffer_t *rb, const void *elems, uint32_t n){
+	uint32_t head = rb->head;
+	uint32_t tail = __atomic_load_n(&rb->tail, __ATOMIC_ACQUIRE);
+	uint32_t room = rb->mask + 1 - (head - tail);
+	if(n > room){
+		rb->overflows += n - room;
+		n = room;
+	}
+	if(n > 0){
+		RingBufferCopyIn(rb, head, elems, n);
+		// publish the elements after they are copied
+		__atomic_store_n(&rb->head, head + n, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+IRAM_ATTR uint32_t RingBufferWriteFromISR(ring_buffer_t *rb, const void *elems, uint32_t n, BaseType_t *task_woken){
+	uint32_t count = rb->head - __atomic_load_n(&rb->tail, __ATOMIC_ACQUIRE);
+	uint32_t written = RingBufferWrite(rb, elems, n);
+	RingBufferCheckWatermark(rb, count, count + written, task_woken);
+	return written;
+}
+
+IRAM_ATTR bool RingBufferPush(ring_buffer_t *rb, const void *elem){
+	return (RingBufferWrite(rb, elem, 1) == 1);
+}
+
+IRAM_ATTR bool RingBufferPushFromISR(ring_buffer_t *rb, const void *elem, BaseType_t *task_woken){
+	return (RingBufferWriteFromISR(rb, elem, 1, task_woken) == 1);
+}
+
+IRAM_ATTR uint32_t RingBufferRead(ring_buffer_t *rb, void *elems, uint32_t n){
+	uint32_t tail = rb->tail;
+	uint32_t head = __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE);
+	uint32_t count = head - tail;
+	if(n > count){
+		n = count;
+	}
+	if(n > 0){
+		RingBufferCopyOut(rb, tail, elems, n);
+		// release the slots after they are copied
+		__atomic_store_n(&rb->tail, tail + n, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+IRAM_ATTR uint32_t RingBufferPeek(ring_buffer_t *rb, void *elems, uint32_t n){
+	uint32_t tail = rb->tail;
+	uint32_t count = __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE) - tail;
+	if(n > count){
+		n = count;
+	}
+	if(n > 0){
+		RingBufferCopyOut(rb, tail, elems, n);
+	}
+	return n;
+}
+
+IRAM_ATTR bool RingBufferPop(ring_buffer_t *rb, void *elem){
+	return (RingBufferRead(rb, elem, 1) == 1);
+}
+
+IRAM_ATTR uint32_t RingBufferCount(ring_buffer_t *rb){
+	return __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE) - rb->tail;
+}
+
+IRAM_ATTR uint32_t RingBufferFree(ring_buffer_t *rb){
+	return rb->mask + 1 - RingBufferCount(rb);
+}
+
+void RingBufferFlush(ring_buffer_t *rb){
+	__atomic_store_n(&rb->tail, __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+/*==================[end of file]============================================*/
@@ -13,6 +13,7 @@
 #include "rtc_mcu.h"
 #include <stdint.h>
 #include "sys/time.h"
+#include "time_mcu.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
@@ -20,10 +21,24 @@
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static time_t rtc_anchor_s = 0;         /*!< Calendar time (s) at rtc_anchor_us */
+static uint64_t rtc_anchor_us = 0;      /*!< Monotonic time (us) of the last RtcConfig */
+static bool rtc_anchored = false;
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void RtcFromTime(time_t t, rtc_t * rtc){
+    struct tm timeinfo;
+    localtime_r(&t, &timeinfo);
+    rtc->year = timeinfo.tm_year;
+    rtc->month = timeinfo.tm_mon;
+    rtc->mday = timeinfo.tm_mday;
+    rtc->wday = timeinfo.tm_wday;
+    rtc->hour = timeinfo.tm_hour;
+    rtc->min = timeinfo.tm_min;
+    rtc->sec = timeinfo.tm_sec;
+}
 
 /*==================[external functions definition]==========================*/
 bool RtcConfig(rtc_t * rtc){
@@ -41,24 +56,36 @@ bool RtcConfig(rtc_t * rtc){
     tm.tm_hour = rtc->hour;
     tm.tm_min = rtc->min;
     tm.tm_sec = rtc->sec;
+    tm.tm_isdst = 0;
     time_t t = mktime(&tm);
     struct timeval now = { .tv_sec = t };
     settimeofday(&now, NULL);
+    // calendar time follows the monotonic clock from now on
+    rtc_anchor_us = TimeNowUs();
+    rtc_anchor_s = t;
+    rtc_anchored = true;
 
     return true;
 }
 
 void RtcRead(rtc_t * rtc){
-    time_t now;
-    struct tm timeinfo;
-    time(&now);
-    localtime_r(&now, &timeinfo);
-    rtc->year = timeinfo.tm_year;
-    rtc->month = timeinfo.tm_mon;
-    rtc->mday = timeinfo.tm_mday;
-    rtc->wday = timeinfo.tm_wday;
-    rtc->hour = timeinfo.tm_hour;
-    rtc->min = timeinfo.tm_min;
-    rtc->sec = timeinfo.tm_sec;
+    RtcFromTimestamp(TimeNowUs(), rtc);
+}
+
+void RtcFromTimestamp(uint64_t time_us, rtc_t * rtc){
+    time_t t;
+    if(rtc_anchored){
+        t = rtc_anchor_s + (time_t)(((int64_t)time_us - (int64_t)rtc_anchor_us) / (int64_t)TIME_US_PER_S);
+    }
+    else{
+        // not configured: calendar time counts from boot
+        time(&t);
+        t -= (time_t)((TimeNowUs() - time_us) / TIME_US_PER_S);
+    }
+    RtcFromTime(t, rtc);
+}
+
+int64_t RtcTimestampToEpochUs(uint64_t time_us){
+    return (int64_t)rtc_anchor_s * (int64_t)TIME_US_PER_S + ((int64_t)time_us - (int64_t)rtc_anchor_us);
 }
 /*==================[end of file]============================================*/
@@ -0,0 +1,247 @@
+/**
+ * @file sensor_hub_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sensor_hub_mcu.h"
+#include <stddef.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "static_alloc_mcu.h"
+#include "trace_mcu.h"
+#include "power_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define SENSOR_HUB_TASK_STACK	CONFIG_DRIVERS_SENSOR_HUB_TASK_STACK
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Sensor and its scheduling state
+ */
+typedef struct {
+	sensor_hub_sensor_t sensor;
+	int64_t release;				// time of the next release (us)
+	sensor_hub_stats_t stats;
+} hub_entry_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static hub_entry_t entries[SENSOR_HUB_MAX_SENSORS];
+static uint8_t entries_qty = 0;
+static sensor_hub_lock_t bus_lock[SENSOR_HUB_BUSES];
+static uint64_t bus_busy[SENSOR_HUB_BUSES];		// time used by each bus since the start (us)
+static int64_t start_time;
+static uint32_t coalesce;
+static volatile bool running = false;
+static TaskHandle_t hub_task = NULL;
+STATIC_TASK_DEFINE(hub_task, SENSOR_HUB_TASK_STACK);
+static esp_timer_handle_t hub_timer = NULL;
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Release timer: wakes up the hub task
+ */
+static void SensorHubTimer(void *param){
+	xTaskNotifyGive(hub_task);
+}
+
+/**
+ * @brief Released sensor (release before limit) with the earliest deadline, optionally on a given bus
+ *
+ * @return Index of the sensor, or -1 if none
+ */
+static int8_t SensorHubEarliest(int64_t limit, int8_t bus){
+	int8_t earliest = -1;
+	int64_t deadline = INT64_MAX;
+	for(uint8_t i = 0; i < entries_qty; i++){
+		hub_entry_t *e = &entries[i];
+		if(e->release > limit || (bus >= 0 && (int8_t)e->sensor.bus != bus)){
+			continue;
+		}
+		// the deadline of a release is the next one
+		int64_t d = e->release + e->sensor.period_us;
+		if(d < deadline){
+			deadline = d;
+			earliest = i;
+		}
+	}
+	return earliest;
+}
+
+/**
+ * @brief Call the read function of a sensor and schedule its next release
+ */
+static void SensorHubRead(uint8_t id){
+	hub_entry_t *e = &entries[id];
+	int64_t begin = esp_timer_get_time();
+	TRACE_BEGIN(TRACE_SENSOR_READ, id);
+	e->sensor.read_p(e->sensor.param);
+	TRACE_END(TRACE_SENSOR_READ, id);
+	int64_t end = esp_timer_get_time();
+
+	uint32_t misses = 0;
+	int64_t late = begin - e->release;
+	e->release += e->sensor.period_us;
+	if(end > e->release){
+		// read finished after the next release: skip the releases already lost
+		misses++;
+		while(e->release + e->sensor.period_us <= end){
+			e->release += e->sensor.period_us;
+			misses++;
+		}
+	}
+	taskENTER_CRITICAL(&stats_mux);
+	e->stats.reads++;
+	e->stats.misses += misses;
+	if(late > e->stats.max_late_us){
+		e->stats.max_late_us = (uint32_t)late;
+	}
+	if(end - begin > e->stats.max_read_us){
+		e->stats.max_read_us = (uint32_t)(end - begin);
+	}
+	bus_busy[e->sensor.bus] += end - begin;
+	taskEXIT_CRITICAL(&stats_mux);
+}
+
+/**
+ * @brief Hub task: reads the released sensors grouped by bus, in deadline order
+ */
+static void SensorHubTask(void *param){
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!running){
+			continue;
+		}
+		int64_t limit = esp_timer_get_time() + coalesce;
+		int8_t first;
+		while((first = SensorHubEarliest(limit, -1)) >= 0){
+			// the bus of the earliest deadline is locked once for all its released sensors
+			sensor_hub_bus_t bus = entries[first].sensor.bus;
+			PowerAcquire(POWER_LOCK_BUS);
+			if(bus_lock[bus] != NULL){
+				bus_lock[bus](true);
+			}
+			int8_t id = first;
+			do{
+				SensorHubRead(id);
+			}while(running && (id = SensorHubEarliest(limit, bus)) >= 0);
+			if(bus_lock[bus] != NULL){
+				bus_lock[bus](false);
+			}
+			PowerRelease(POWER_LOCK_BUS);
+			if(!running){
+				break;
+			}
+			limit = esp_timer_get_time() + coalesce;
+		}
+		if(running){
+			int64_t next = INT64_MAX;
+			for(uint8_t i = 0; i < entries_qty; i++){
+				if(entries[i].release < next){
+					next = entries[i].release;
+				}
+			}
+			int64_t wait = next - esp_timer_get_time();
+			esp_timer_start_once(hub_timer, (wait > 0) ? wait : 1);
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool SensorHubInit(uint8_t priority, uint32_t coalesce_us){
+	if(hub_task != NULL){
+		return true;
+	}
+	coalesce = (coalesce_us > 0) ? coalesce_us : SENSOR_HUB_COALESCE_US;
+	esp_timer_create_args_t timer_args = {
+		.callback = SensorHubTimer,
+		.name = "sensor_hub"
+	};
+	if(esp_timer_create(&timer_args, &hub_timer) != ESP_OK){
+		hub_timer = NULL;
+		return false;
+	}
+	if(STATIC_TASK_CREATE(hub_task, SensorHubTask, "sensor_hub", NULL,
+						  (priority > 0) ? priority : SENSOR_HUB_TASK_PRIO, &hub_task) != pdPASS){
+		esp_timer_delete(hub_timer);
+		hub_timer = NULL;
+		hub_task = NULL;
+		return false;
+	}
+	return true;
+}
+
+int8_t SensorHubAdd(const sensor_hub_sensor_t *sensor){
+	if(running || entries_qty >= SENSOR_HUB_MAX_SENSORS || sensor->read_p == NULL ||
+	   sensor->period_us == 0 || sensor->bus >= SENSOR_HUB_BUSES){
+		return -1;
+	}
+	entries[entries_qty].sensor = *sensor;
+	return entries_qty++;
+}
+
+void SensorHubSetBusLock(sensor_hub_bus_t bus, sensor_hub_lock_t lock_p){
+	if(bus < SENSOR_HUB_BUSES){
+		bus_lock[bus] = lock_p;
+	}
+}
+
+bool SensorHubStart(void){
+	if(hub_task == NULL || entries_qty == 0){
+		return false;
+	}
+	if(running){
+		return true;
+	}
+	start_time = esp_timer_get_time();
+	taskENTER_CRITICAL(&stats_mux);
+	for(uint8_t i = 0; i < entries_qty; i++){
+		entries[i].release = start_time;
+		memset(&entries[i].stats, 0, sizeof(sensor_hub_stats_t));
+	}
+	memset(bus_busy, 0, sizeof(bus_busy));
+	taskEXIT_CRITICAL(&stats_mux);
+	running = true;
+	xTaskNotifyGive(hub_task);
+	return true;
+}
+
+void SensorHubStop(void){
+	running = false;
+	if(hub_timer != NULL){
+		esp_timer_stop(hub_timer);
+	}
+}
+
+bool SensorHubGetStats(int8_t id, sensor_hub_stats_t *stats){
+	if(id < 0 || id >= entries_qty){
+		return false;
+	}
+	taskENTER_CRITICAL(&stats_mux);
+	*stats = entries[id].stats;
+	taskEXIT_CRITICAL(&stats_mux);
+	return true;
+}
+
+uint16_t SensorHubBusLoad(sensor_hub_bus_t bus){
+	if(bus >= SENSOR_HUB_BUSES){
+		return 0;
+	}
+	int64_t elapsed = esp_timer_get_time() - start_time;
+	taskENTER_CRITICAL(&stats_mux);
+	uint64_t busy = bus_busy[bus];
+	taskEXIT_CRITICAL(&stats_mux);
+	return (elapsed > 0) ? (uint16_t)((busy * 1000 + elapsed / 2) / elapsed) : 0;
+}
+
+/*==================[end of file]============================================*/
@@ -22,6 +22,9 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+/** @brief ESP-IDF transaction stored in the driver data of a spi_trans_t */
+#define SPI_TRANS(trans)	((spi_transaction_t *)(trans)->priv)
+_Static_assert(sizeof(spi_transaction_t) <= sizeof(((spi_trans_t *)0)->priv), "spi_trans_t.priv too small");
 /*==================[internal data declaration]==============================*/
 spi_device_handle_t spi_1, spi_2, spi_3;
 const spi_bus_config_t bus_cfg = {
@@ -30,7 +33,7 @@ const spi_bus_config_t bus_cfg = {
     .sclk_io_num = PIN_NUM_CLK,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 4092
+    .max_transfer_sz = SPI_MAX_BURST
 };
 transfer_mode_t transfer_mode_1, transfer_mode_2, transfer_mode_3;
 void (*spi_1_isr_p)(void*);	/*!<  */
@@ -39,22 +42,76 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+static spi_mcu_config_t spi_cfg[SPI_3 + 1];	/*!< Configuration of each device added to the bus */
+static bool spi_added[SPI_3 + 1];			/*!< Device added to the bus */
+static bool spi_held[SPI_3 + 1];			/*!< Bus held by the device (SpiAcquire) */
 /*==================[internal functions declaration]=========================*/
+/* Start of a transaction: queued transactions call their own pre-transfer callback (i.e. to set a D/C pin) */
+static void IRAM_ATTR spi_pre(spi_transaction_t *t){
+	spi_trans_t *trans = t->user;
+	if(trans != NULL && trans->pre_func_p != NULL){
+		trans->pre_func_p(trans->param_p);
+	}
+}
+/* End of a transaction: queued transactions call their own callback (or the device one),
+ * blocking transactions call the device callback in SPI_INTERRUPT mode */
+static void IRAM_ATTR spi_end(spi_transaction_t *t, transfer_mode_t mode, void (*isr_p)(void*), void *user_data){
+	spi_trans_t *trans = t->user;
+	if(trans != NULL){
+		if(trans->func_p != NULL){
+			trans->func_p(trans->param_p);
+		}else if(isr_p != NULL){
+			isr_p(user_data);
+		}
+	}else if(mode == SPI_INTERRUPT && isr_p != NULL){
+		isr_p(user_data);
+	}
+}
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
-	spi_1_isr_p(spi_1_user_data);
+	spi_end(t, transfer_mode_1, spi_1_isr_p, spi_1_user_data);
 }
 static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
-	spi_2_isr_p(spi_2_user_data);
+	spi_end(t, transfer_mode_2, spi_2_isr_p, spi_2_user_data);
 }
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
-	spi_3_isr_p(spi_3_user_data);
+	spi_end(t, transfer_mode_3, spi_3_isr_p, spi_3_user_data);
 }
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-
+static spi_device_handle_t spi_handle(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return spi_1;
+        case SPI_2:
+            return spi_2;
+        case SPI_3:
+            return spi_3;
+    }
+    return NULL;
+}
+/* A device yields the bus if another device added has higher priority */
+static bool spi_yields(spi_dev_t device){
+    for(uint8_t i = SPI_1; i <= SPI_3; i++){
+        if(i != device && spi_added[i] && spi_cfg[i].priority > spi_cfg[device].priority){
+            return true;
+        }
+    }
+    return false;
+}
+/* Fill the ESP-IDF transaction of a spi_trans_t */
+static spi_transaction_t * spi_trans(spi_trans_t * trans){
+    spi_transaction_t *t = SPI_TRANS(trans);
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = trans->lenght * 8;  // lenght is in bytes, transaction length is in bits.
+    t->rxlength = (trans->rx_buffer != NULL) ? trans->lenght * 8 : 0;
+    t->tx_buffer = trans->tx_buffer;
+    t->rx_buffer = trans->rx_buffer;
+    t->user = trans;
+    return t;
+}
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
     static bool spi_initialized = false;
@@ -62,43 +119,54 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	    spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
         spi_initialized = true;
     }
+    /* the device is added once, and again only if its configuration changes */
+    spi_mcu_config_t *cfg = &spi_cfg[spi->device];
+    if(spi_added[spi->device]){
+        if(cfg->clk_mode == spi->clk_mode && cfg->bitrate == spi->bitrate && cfg->transfer_mode == spi->transfer_mode &&
+            cfg->func_p == spi->func_p && cfg->param_p == spi->param_p){
+            /* priority and burst don't need the device added again */
+            cfg->priority = spi->priority;
+            cfg->max_burst = spi->max_burst;
+            return 0;
+        }
+        spi_bus_remove_device(spi_handle(spi->device));
+        spi_added[spi->device] = false;
+    }
+    *cfg = *spi;
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .queue_size = SPI_QUEUE_SIZE,
+        .pre_cb = spi_pre,
     };
+    /* the end of transaction callback is always installed: queued transactions need it */
     switch(spi->device){
         case SPI_1:
             dev_cfg.spics_io_num = PIN_NUM_CS1;
             transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
+            dev_cfg.post_cb = spi_1_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
             spi_1_isr_p = spi->func_p;
             spi_1_user_data = spi->param_p;
             break;
         case SPI_2:
             dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_2 = spi->transfer_mode;
+            dev_cfg.post_cb = spi_2_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
             spi_2_isr_p = spi->func_p;
             spi_2_user_data = spi->param_p;
             break;
         case SPI_3:
             dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_3 = spi->transfer_mode;
+            dev_cfg.post_cb = spi_3_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
             spi_3_isr_p = spi->func_p;
             spi_3_user_data = spi->param_p;
             break;
     }
+    spi_added[spi->device] = true;
     return 0;
 }
 
@@ -222,6 +290,44 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     }
 }
 
+void SpiTransmit(spi_dev_t device, spi_trans_t * trans){
+    spi_device_polling_transmit(spi_handle(device), spi_trans(trans));
+}
+
+bool SpiQueue(spi_dev_t device, spi_trans_t * trans){
+    return spi_device_queue_trans(spi_handle(device), spi_trans(trans), 0) == ESP_OK;
+}
+
+spi_trans_t * SpiGetResult(spi_dev_t device, uint32_t timeout_ms){
+    spi_transaction_t *t;
+    TickType_t ticks = (timeout_ms == SPI_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if(spi_device_get_trans_result(spi_handle(device), &t, ticks) != ESP_OK){
+        return NULL;
+    }
+    return t->user;
+}
+
+void SpiAcquire(spi_dev_t device){
+    /* a device of lower priority doesn't lock the bus: each of its transactions takes it
+     * (the driver lets a device that is waiting go after the current transaction) */
+    spi_held[device] = !spi_yields(device);
+    if(spi_held[device]){
+        spi_device_acquire_bus(spi_handle(device), portMAX_DELAY);
+    }
+}
+
+void SpiRelease(spi_dev_t device){
+    if(spi_held[device]){
+        spi_device_release_bus(spi_handle(device));
+        spi_held[device] = false;
+    }
+}
+
+uint32_t SpiGetMaxBurst(spi_dev_t device){
+    uint32_t burst = spi_cfg[device].max_burst & ~3;
+    return (burst == 0 || burst > SPI_MAX_BURST) ? SPI_MAX_BURST : burst;
+}
+
 uint8_t SpiDeInit(spi_dev_t device){
     return 0;
 }
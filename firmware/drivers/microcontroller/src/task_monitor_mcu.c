@@ -0,0 +1,155 @@
+/**
+ * @file task_monitor_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "task_monitor_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_MS		1000
+#define LINE_LENGHT		64
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Run time counter of a task in the previous sample
+ */
+typedef struct {
+	UBaseType_t number;				// task number (unique for each task created)
+	uint32_t run_time;				// run time counter
+} task_sample_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static esp_timer_handle_t monitor_timer = NULL;
+static TaskStatus_t status[TASK_MONITOR_MAX_TASKS];
+static task_sample_t prev[TASK_MONITOR_MAX_TASKS];
+static uint8_t prev_n = 0;
+static uint32_t prev_total = 0;
+static bool sampled = false;
+static task_monitor_t usage[TASK_MONITOR_MAX_TASKS];
+static uint8_t usage_n = 0;
+static uint32_t usage_period_ms = 0;
+static portMUX_TYPE usage_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Run time counter of a task in the previous sample (0 if it was created after it)
+ */
+static uint32_t TaskMonitorPrevRunTime(UBaseType_t number){
+	for(uint8_t i = 0; i < prev_n; i++){
+		if(prev[i].number == number){
+			return prev[i].run_time;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Sampling timer: CPU load of each task since the previous sample
+ */
+static void TaskMonitorSample(void *param){
+	static task_monitor_t sample[TASK_MONITOR_MAX_TASKS];
+	configRUN_TIME_COUNTER_TYPE total_time;
+	uint8_t n = uxTaskGetSystemState(status, TASK_MONITOR_MAX_TASKS, &total_time);
+	// counters are unsigned: the differences are right after an overflow
+	uint32_t total = (uint32_t)total_time;
+	uint32_t elapsed = total - prev_total;
+	for(uint8_t i = 0; i < n; i++){
+		uint32_t run = (uint32_t)status[i].ulRunTimeCounter - TaskMonitorPrevRunTime(status[i].xTaskNumber);
+		strncpy(sample[i].name, status[i].pcTaskName, TASK_MONITOR_NAME_LENGHT - 1);
+		sample[i].name[TASK_MONITOR_NAME_LENGHT - 1] = '\0';
+		sample[i].priority = status[i].uxCurrentPriority;
+		sample[i].cpu_load = (elapsed > 0) ? (uint16_t)(((uint64_t)run * 1000 + elapsed / 2) / elapsed) : 0;
+		sample[i].stack_free = status[i].usStackHighWaterMark * sizeof(StackType_t);
+	}
+	for(uint8_t i = 0; i < n; i++){
+		prev[i].number = status[i].xTaskNumber;
+		prev[i].run_time = (uint32_t)status[i].ulRunTimeCounter;
+	}
+	prev_n = n;
+	prev_total = total;
+	if(!sampled){
+		// the first sample is only the reference of the next one
+		sampled = true;
+		return;
+	}
+	taskENTER_CRITICAL(&usage_mux);
+	memcpy(usage, sample, n * sizeof(task_monitor_t));
+	usage_n = n;
+	usage_period_ms = elapsed / US_PER_MS;
+	taskEXIT_CRITICAL(&usage_mux);
+}
+
+/*==================[external functions definition]==========================*/
+bool TaskMonitorInit(uint32_t period_ms){
+	if(monitor_timer != NULL){
+		return true;
+	}
+	if(period_ms == 0){
+		period_ms = TASK_MONITOR_PERIOD_MS;
+	}
+	esp_timer_create_args_t timer_args = {
+		.callback = TaskMonitorSample,
+		.name = "task_monitor"
+	};
+	if(esp_timer_create(&timer_args, &monitor_timer) != ESP_OK){
+		monitor_timer = NULL;
+		return false;
+	}
+	sampled = false;
+	prev_n = 0;
+	TaskMonitorSample(NULL);
+	return esp_timer_start_periodic(monitor_timer, period_ms * US_PER_MS) == ESP_OK;
+}
+
+void TaskMonitorDeinit(void){
+	if(monitor_timer == NULL){
+		return;
+	}
+	esp_timer_stop(monitor_timer);
+	esp_timer_delete(monitor_timer);
+	monitor_timer = NULL;
+}
+
+uint8_t TaskMonitorGet(task_monitor_t *tasks, uint8_t max){
+	taskENTER_CRITICAL(&usage_mux);
+	uint8_t n = (usage_n < max) ? usage_n : max;
+	memcpy(tasks, usage, n * sizeof(task_monitor_t));
+	taskEXIT_CRITICAL(&usage_mux);
+	return n;
+}
+
+void TaskMonitorReport(task_monitor_print_t print_p){
+	// copy: the timer keeps sampling while the report is sent
+	static task_monitor_t snapshot[TASK_MONITOR_MAX_TASKS];
+	char line[LINE_LENGHT];
+	if(print_p == NULL){
+		return;
+	}
+	uint8_t n = TaskMonitorGet(snapshot, TASK_MONITOR_MAX_TASKS);
+	if(n == 0){
+		print_p("Task monitor: no samples yet\r\n");
+		return;
+	}
+	snprintf(line, sizeof(line), "Tasks: %u, last %lu ms\r\n", n, (unsigned long)usage_period_ms);
+	print_p(line);
+	print_p("task              prio    cpu %  stack free\r\n");
+	for(uint8_t i = 0; i < n; i++){
+		snprintf(line, sizeof(line), "%-16s  %4u  %5u.%u  %10lu\r\n", snapshot[i].name, snapshot[i].priority,
+				 snapshot[i].cpu_load / 10, snapshot[i].cpu_load % 10, (unsigned long)snapshot[i].stack_free);
+		print_p(line);
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -12,180 +12,376 @@
 /*==================[inclusions]=============================================*/
 #include "timer_mcu.h"
 #include "driver/gptimer.h"
+#include "driver/gptimer_etm.h"
+#include "driver/gpio_etm.h"
+#include "esp_etm.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "time_mcu.h"
+#include "iram_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
 #define RESET_COUNT_VALUE	0		/*!< Reset timer count to 0 */
+#define LEGACY_TIMERS		(TIMER_C + 1)	/*!< Timers selected by timer_mcu_t */
 /*==================[internal data declaration]==============================*/
-gptimer_handle_t timer_a = NULL;	/*!< Handle for timer A */	
-gptimer_handle_t timer_b = NULL;	/*!< Handle for timer B */			
-gptimer_handle_t timer_c = NULL;	/*!< Handle for timer C */	
+/**
+ * @brief Jitter measurement of a timer
+ */
+typedef struct {
+	bool enabled;				/*!< Measurement running */
+	uint64_t last_time;			/*!< Timestamp of the previous alarm (us) */
+	uint64_t latency_sum;		/*!< Sum of the latencies (us) */
+	timer_stats_t stats;		/*!< Statistics */
+} timer_stats_data_t;
+
+/**
+ * @brief Timer of the table
+ */
+struct timer_data {
+	bool used;							/*!< Entry in use */
+	gptimer_handle_t gptimer;			/*!< Hardware timer */
+	gptimer_alarm_config_t alarm;		/*!< Alarm configuration */
+	timer_mode_t mode;					/*!< Periodic or one-shot */
+	void (*isr_p)(void*);				/*!< Callback */
+	bool (*yield_isr_p)(void*);			/*!< Callback that returns if a yield is needed */
+	void *user_data;					/*!< Callback parameter */
+	TaskHandle_t task;					/*!< Task notified on alarm */
+	volatile uint64_t alarm_time;		/*!< Timestamp of the last alarm */
+	timer_stats_data_t stats;			/*!< Jitter measurement */
+	esp_etm_channel_handle_t etm_chan;	/*!< ETM channel from the alarm to the GPIO task */
+	esp_etm_event_handle_t etm_event;	/*!< Alarm ETM event */
+	esp_etm_task_handle_t etm_task;		/*!< GPIO ETM task */
+	timer_etm_action_t etm_action;		/*!< Action of the GPIO ETM task */
+};
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
 /**
  * @brief Configuration for the timer
  * 
  * @details The configuration for the timer specifies the clock source,
  *          count direction, and resolution in Hz.
  */
-const gptimer_config_t timer_config = {
+static const gptimer_config_t timer_config = {
     .clk_src = GPTIMER_CLK_SRC_DEFAULT,	/*!< Default clock source */
     .direction = GPTIMER_COUNT_UP,		/*!< Count up */
     .resolution_hz = US_RESOLUTION_HZ,	/*!< Resolution in Hz */
 };
-void (*timer_a_isr_p)(void*);	        /*!< Pointer to the ISR function for timer A */	
-void (*timer_b_isr_p)(void*);	        /*!< Pointer to the ISR function for timer B */	
-void (*timer_c_isr_p)(void*);	        /*!< Pointer to the ISR function for timer C */	
+static struct timer_data timer_table[TIMER_MAX_QTY];			/*!< Timers */
+static timer_handle_t legacy_timers[LEGACY_TIMERS];				/*!< Timers created by TimerInit */
+static portMUX_TYPE timer_mux = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
 
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Update the jitter measurement with an alarm
+ * 
+ * @param data Measurement of the timer
+ * @param count Timer count when the ISR runs (us since the alarm auto reload)
+ * @param now Timestamp of the ISR (us)
+ * @param period Alarm period (us)
+ */
+static void IRAM_ATTR timer_stats_update(timer_stats_data_t *data, uint64_t count, uint64_t now, uint32_t period){
+	timer_stats_t *stats = &data->stats;
+	uint32_t latency = (count > UINT32_MAX) ? UINT32_MAX : (uint32_t)count;
+	bool missed = (latency >= period);
+	taskENTER_CRITICAL_ISR(&timer_mux);
+	if(latency < stats->latency_min){
+		stats->latency_min = latency;
+	}
+	if(latency > stats->latency_max){
+		stats->latency_max = latency;
+	}
+	data->latency_sum += latency;
+	if(data->last_time != 0){
+		int32_t jitter = (int32_t)(now - data->last_time) - (int32_t)period;
+		if(jitter < stats->jitter_min){
+			stats->jitter_min = jitter;
+		}
+		if(jitter > stats->jitter_max){
+			stats->jitter_max = jitter;
+		}
+		// an alarm serviced a period late or skipped
+		if(jitter >= (int32_t)period){
+			missed = true;
+		}
+	}
+	data->last_time = now;
+	stats->alarms++;
+	if(missed){
+		stats->missed++;
+	}
+	taskEXIT_CRITICAL_ISR(&timer_mux);
+}
 
-void *timer_a_user_data;	            /*!< User data for timer A */	
-void *timer_b_user_data;	            /*!< User data for timer B */	
-void *timer_c_user_data;	            /*!< User data for timer C */	
+/**
+ * @brief Alarm ISR of every timer: notify the task and call the user callback
+ * 
+ * @return true if a higher priority task was woken (the ISR must yield)
+ */
+static bool IRAM_ATTR timer_isr(gptimer_handle_t gptimer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	timer_handle_t timer = user_data;
+	BaseType_t woken = pdFALSE;
+	TRACE_BEGIN(TRACE_TIMER_ISR, timer - timer_table);
+	timer->alarm_time = TimeNowUs();
+	if(timer->mode == TIMER_ONE_SHOT){
+		gptimer_stop(gptimer);
+	}
+	else if(timer->stats.enabled){
+		// the auto reload sets the count to 0 on the alarm: count is the latency
+		timer_stats_update(&timer->stats, edata->count_value, timer->alarm_time, timer->alarm.alarm_count);
+	}
+	if(timer->task != NULL){
+		vTaskNotifyGiveFromISR(timer->task, &woken);
+	}
+	if(timer->yield_isr_p != NULL){
+		if(timer->yield_isr_p(timer->user_data)){
+			woken = pdTRUE;
+		}
+	}
+	else if(timer->isr_p != NULL){
+		timer->isr_p(timer->user_data);
+		// the callback may have woken a task without reporting it
+		woken = pdTRUE;
+	}
+	TRACE_END(TRACE_TIMER_ISR, timer - timer_table);
+	return woken == pdTRUE;
+}
 
-gptimer_alarm_config_t alarm_config_a;  /*!< Configuration for alarm A */
-gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
-gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
-/*==================[internal functions declaration]=========================*/
-static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_a_isr_p(timer_a_user_data);
-	return true;
+/*==================[external functions definition]==========================*/
+timer_handle_t TimerCreate(const timer_handle_config_t *config){
+	timer_handle_t timer = NULL;
+	taskENTER_CRITICAL(&timer_mux);
+	for(uint8_t i = 0; i < TIMER_MAX_QTY; i++){
+		if(!timer_table[i].used){
+			timer = &timer_table[i];
+			timer->used = true;
+			break;
+		}
+	}
+	taskEXIT_CRITICAL(&timer_mux);
+	if(timer == NULL){
+		return NULL;
+	}
+	timer->mode = config->mode;
+	timer->isr_p = config->func_p;
+	timer->yield_isr_p = config->yield_func_p;
+	timer->user_data = config->param_p;
+	timer->task = NULL;
+	timer->alarm_time = 0;
+	timer->stats.enabled = false;
+	timer->etm_chan = NULL;
+	timer->etm_event = NULL;
+	timer->etm_task = NULL;
+	if(gptimer_new_timer(&timer_config, &timer->gptimer) != ESP_OK){
+		// no free hardware timer
+		timer->used = false;
+		return NULL;
+	}
+	timer->alarm.alarm_count = config->period;
+	timer->alarm.reload_count = RESET_COUNT_VALUE;
+	timer->alarm.flags.auto_reload_on_alarm = (config->mode == TIMER_PERIODIC);
+	gptimer_set_alarm_action(timer->gptimer, &timer->alarm);
+	gptimer_event_callbacks_t callbacks = {
+		.on_alarm = timer_isr,
+	};
+	gptimer_register_event_callbacks(timer->gptimer, &callbacks, timer);
+	gptimer_enable(timer->gptimer);
+	return timer;
 }
-static bool IRAM_ATTR timer_b_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_b_isr_p(timer_b_user_data);
-	return true;
+
+void TimerDelete(timer_handle_t timer){
+	gptimer_stop(timer->gptimer);
+	if(timer->etm_chan != NULL){
+		esp_etm_channel_disable(timer->etm_chan);
+		esp_etm_del_channel(timer->etm_chan);
+		esp_etm_del_event(timer->etm_event);
+		esp_etm_del_task(timer->etm_task);
+		timer->etm_chan = NULL;
+	}
+	gptimer_disable(timer->gptimer);
+	gptimer_del_timer(timer->gptimer);
+	timer->used = false;
 }
-static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_c_isr_p(timer_c_user_data);
-	return true;
+
+void SAMPLE_PATH_ATTR TimerHandleStart(timer_handle_t timer){
+	if(timer->mode == TIMER_ONE_SHOT){
+		// the alarm is counted from now, and it's disabled by the hardware after each alarm
+		gptimer_set_raw_count(timer->gptimer, RESET_COUNT_VALUE);
+		gptimer_set_alarm_action(timer->gptimer, &timer->alarm);
+	}
+	gptimer_start(timer->gptimer);
 }
-/*==================[internal data definition]===============================*/
 
-/*==================[external data definition]===============================*/
+void SAMPLE_PATH_ATTR TimerHandleStop(timer_handle_t timer){
+	gptimer_stop(timer->gptimer);
+}
 
-/*==================[internal functions definition]==========================*/
+void SAMPLE_PATH_ATTR TimerHandleReset(timer_handle_t timer){
+	gptimer_set_raw_count(timer->gptimer, RESET_COUNT_VALUE);
+}
 
-/*==================[external functions definition]==========================*/
-void TimerInit(timer_config_t *timer_ini){
-	switch(timer_ini->timer){
-	 	case TIMER_A:
-			timer_a_isr_p = timer_ini->func_p;
-			timer_a_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_a);
-			alarm_config_a.alarm_count = timer_ini->period; 
-			alarm_config_a.reload_count = RESET_COUNT_VALUE;
-			alarm_config_a.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_a, &alarm_config_a);
-			gptimer_event_callbacks_t alarm_a = {
-				.on_alarm = timer_a_isr,
-			};
-			gptimer_register_event_callbacks(timer_a, &alarm_a, NULL);
-			gptimer_enable(timer_a);
-	 	break;
-
-	 	case TIMER_B:
-			timer_b_isr_p = timer_ini->func_p;
-			timer_b_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_b);
-			alarm_config_b.alarm_count = timer_ini->period; 
-			alarm_config_b.reload_count = RESET_COUNT_VALUE;
-			alarm_config_b.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_b, &alarm_config_b);
-			gptimer_event_callbacks_t alarm_b = {
-				.on_alarm = timer_b_isr,
-			};
-			gptimer_register_event_callbacks(timer_b, &alarm_b, NULL);
-			gptimer_enable(timer_b);
-	 	break;
-
-	 	case TIMER_C:
-			timer_c_isr_p = timer_ini->func_p;
-			timer_c_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_c);
-			alarm_config_c.alarm_count = timer_ini->period; 
-			alarm_config_c.reload_count = RESET_COUNT_VALUE;
-			alarm_config_c.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_c, &alarm_config_c);
-			gptimer_event_callbacks_t alarm_c = {
-				.on_alarm = timer_c_isr,
-			};
-			gptimer_register_event_callbacks(timer_c, &alarm_c, NULL);
-			gptimer_enable(timer_c);
-	 	break;
-	}
-}
-
-void TimerStart(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_start(timer_a);
-		break;
-	 	case TIMER_B:
-	 		gptimer_start(timer_b);
-		break;
-	 	case TIMER_C:
-	 		gptimer_start(timer_c);
-		break;
-	}
-}
-
-uint32_t TimerRead(timer_mcu_t timer){
+uint32_t SAMPLE_PATH_ATTR TimerHandleRead(timer_handle_t timer){
 	uint64_t raw_count = 0;
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_get_raw_count(timer_a, &raw_count);
-	 	break;
-	 	case TIMER_B:
-	 		gptimer_get_raw_count(timer_b, &raw_count);
-	 	break;
-	 	case TIMER_C:
-	 		gptimer_get_raw_count(timer_c, &raw_count);
-	 	break;
-	}
+	gptimer_get_raw_count(timer->gptimer, &raw_count);
 	return raw_count;
 }
 
-void TimerStop(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_stop(timer_a);
-	 	break;
-	 	case TIMER_B:
-	 		gptimer_stop(timer_b);
-	 	break;
-	 	case TIMER_C:
-	 		gptimer_stop(timer_c);
-	 	break;
-	}
-}
-
-void TimerReset(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-			gptimer_set_raw_count(timer_a, RESET_COUNT_VALUE);
-	 	break;
-	 	case TIMER_B:
-			gptimer_set_raw_count(timer_b, RESET_COUNT_VALUE);
-	 	break;
-	 	case TIMER_C:
-			gptimer_set_raw_count(timer_c, RESET_COUNT_VALUE);
-	 	break;
-	}
-}
-
-void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
-	switch(timer){
-	 	case TIMER_A:
-			alarm_config_a.alarm_count = period;
-			gptimer_set_alarm_action(timer_a, &alarm_config_a);
-	 	break;
-	 	case TIMER_B:
-			alarm_config_b.alarm_count = period;
-			gptimer_set_alarm_action(timer_b, &alarm_config_b);
-	 	break;
-	 	case TIMER_C:
-			alarm_config_c.alarm_count = period;
-			gptimer_set_alarm_action(timer_c, &alarm_config_c);
-	 	break;
+uint64_t SAMPLE_PATH_ATTR TimerHandleGetAlarmTime(timer_handle_t timer){
+	uint64_t time;
+	// 64 bits reads are not atomic, read again if an alarm updated it meanwhile
+	do{
+		time = timer->alarm_time;
+	}while(time != timer->alarm_time);
+	return time;
+}
+
+void SAMPLE_PATH_ATTR TimerHandleUpdatePeriod(timer_handle_t timer, uint32_t period){
+	timer->alarm.alarm_count = period;
+	gptimer_set_alarm_action(timer->gptimer, &timer->alarm);
+}
+
+void TimerHandleNotifyTask(timer_handle_t timer, TaskHandle_t task){
+	timer->task = task;
+}
+
+void TimerHandleStatsEnable(timer_handle_t timer, bool enable){
+	timer_stats_data_t *data = &timer->stats;
+	taskENTER_CRITICAL(&timer_mux);
+	if(enable){
+		data->last_time = 0;
+		data->latency_sum = 0;
+		data->stats.alarms = 0;
+		data->stats.missed = 0;
+		data->stats.latency_min = UINT32_MAX;
+		data->stats.latency_max = 0;
+		data->stats.latency_mean = 0;
+		data->stats.jitter_min = INT32_MAX;
+		data->stats.jitter_max = INT32_MIN;
+	}
+	data->enabled = enable;
+	taskEXIT_CRITICAL(&timer_mux);
+}
+
+void TimerHandleGetStats(timer_handle_t timer, timer_stats_t *stats){
+	timer_stats_data_t *data = &timer->stats;
+	taskENTER_CRITICAL(&timer_mux);
+	*stats = data->stats;
+	stats->latency_mean = (stats->alarms > 0) ? (uint32_t)(data->latency_sum / stats->alarms) : 0;
+	taskEXIT_CRITICAL(&timer_mux);
+	if(stats->alarms == 0){
+		stats->latency_min = 0;
+	}
+	if(stats->alarms < 2){
+		stats->jitter_min = stats->jitter_max = 0;
 	}
 }
 
+bool TimerHandleEtmGpio(timer_handle_t timer, gpio_t pin, timer_etm_action_t action){
+	static const gpio_etm_task_action_t gpio_actions[] = {
+		[TIMER_ETM_GPIO_SET] = GPIO_ETM_TASK_ACTION_SET,
+		[TIMER_ETM_GPIO_CLEAR] = GPIO_ETM_TASK_ACTION_CLR,
+		[TIMER_ETM_GPIO_TOGGLE] = GPIO_ETM_TASK_ACTION_TOG,
+	};
+	GPIOInit(pin, GPIO_OUTPUT);
+	if(timer->etm_chan != NULL){
+		// more pins for the same task
+		if(action != timer->etm_action){
+			return false;
+		}
+		return gpio_etm_task_add_gpio(timer->etm_task, pin) == ESP_OK;
+	}
+	gptimer_etm_event_config_t event_config = {
+		.event_type = GPTIMER_ETM_EVENT_ALARM_MATCH,
+	};
+	gpio_etm_task_config_t task_config = {
+		.action = gpio_actions[action],
+	};
+	esp_etm_channel_config_t chan_config = {};
+	if(gptimer_new_etm_event(timer->gptimer, &event_config, &timer->etm_event) != ESP_OK){
+		return false;
+	}
+	if(gpio_new_etm_task(&task_config, &timer->etm_task) != ESP_OK){
+		esp_etm_del_event(timer->etm_event);
+		return false;
+	}
+	if(esp_etm_new_channel(&chan_config, &timer->etm_chan) != ESP_OK){
+		esp_etm_del_task(timer->etm_task);
+		esp_etm_del_event(timer->etm_event);
+		timer->etm_chan = NULL;
+		return false;
+	}
+	gpio_etm_task_add_gpio(timer->etm_task, pin);
+	esp_etm_channel_connect(timer->etm_chan, timer->etm_event, timer->etm_task);
+	esp_etm_channel_enable(timer->etm_chan);
+	timer->etm_action = action;
+	// nothing to do on the alarm: remove the ISR (the timer must be stopped)
+	if(timer->mode == TIMER_PERIODIC && timer->isr_p == NULL && timer->yield_isr_p == NULL && timer->task == NULL){
+		gptimer_event_callbacks_t callbacks = {
+			.on_alarm = NULL,
+		};
+		gptimer_disable(timer->gptimer);
+		gptimer_register_event_callbacks(timer->gptimer, &callbacks, NULL);
+		gptimer_enable(timer->gptimer);
+	}
+	return true;
+}
+
+void TimerInit(timer_config_t *timer_ini){
+	timer_handle_config_t config = {
+		.period = timer_ini->period,
+		.mode = TIMER_PERIODIC,
+		.func_p = timer_ini->func_p,
+		.param_p = timer_ini->param_p,
+		.yield_func_p = timer_ini->yield_func_p,
+	};
+	legacy_timers[timer_ini->timer] = TimerCreate(&config);
+}
+
+timer_handle_t TimerGetHandle(timer_mcu_t timer){
+	return legacy_timers[timer];
+}
+
+void TimerStatsEnable(timer_mcu_t timer, bool enable){
+	TimerHandleStatsEnable(legacy_timers[timer], enable);
+}
+
+void TimerGetStats(timer_mcu_t timer, timer_stats_t *stats){
+	TimerHandleGetStats(legacy_timers[timer], stats);
+}
+
+bool TimerEtmGpio(timer_mcu_t timer, gpio_t pin, timer_etm_action_t action){
+	return TimerHandleEtmGpio(legacy_timers[timer], pin, action);
+}
+
+void TimerNotifyTask(timer_mcu_t timer, TaskHandle_t task){
+	TimerHandleNotifyTask(legacy_timers[timer], task);
+}
+
+void SAMPLE_PATH_ATTR TimerStart(timer_mcu_t timer){
+	TimerHandleStart(legacy_timers[timer]);
+}
+
+uint32_t SAMPLE_PATH_ATTR TimerRead(timer_mcu_t timer){
+	return TimerHandleRead(legacy_timers[timer]);
+}
+
+uint64_t SAMPLE_PATH_ATTR TimerGetAlarmTime(timer_mcu_t timer){
+	return TimerHandleGetAlarmTime(legacy_timers[timer]);
+}
+
+void SAMPLE_PATH_ATTR TimerStop(timer_mcu_t timer){
+	TimerHandleStop(legacy_timers[timer]);
+}
+
+void SAMPLE_PATH_ATTR TimerReset(timer_mcu_t timer){
+	TimerHandleReset(legacy_timers[timer]);
+}
+
+void SAMPLE_PATH_ATTR TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
+	TimerHandleUpdatePeriod(legacy_timers[timer], period);
+}
+
 /*==================[end of file]============================================*/
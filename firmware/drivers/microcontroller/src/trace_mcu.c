@@ -0,0 +1,104 @@
+/**
+ * @file trace_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "trace_mcu.h"
+#include <stddef.h>
+#include <stdatomic.h>
+#include "esp_attr.h"
+#include "time_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TRACE_RECORDS		CONFIG_DRIVERS_TRACE_RECORDS
+#define TRACE_MASK			(TRACE_RECORDS - 1)
+#define TRACE_HEADER_SIZE	10
+_Static_assert((TRACE_RECORDS & TRACE_MASK) == 0, "CONFIG_DRIVERS_TRACE_RECORDS must be a power of two");
+_Static_assert(sizeof(trace_record_t) == 8, "trace_record_t must be packed in 8 bytes");
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static DRAM_ATTR trace_record_t trace_ring[TRACE_RECORDS];
+static DRAM_ATTR atomic_uint_fast32_t trace_head = 0;    /*!< Events recorded since TraceStart */
+static DRAM_ATTR volatile bool trace_on = false;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief CRC16-CCITT (polynomial 0x1021) of a block, continuing from crc
+ */
+static uint16_t TraceCrc16(uint16_t crc, const uint8_t *data, uint32_t lenght){
+	for(uint32_t i = 0; i < lenght; i++){
+		crc ^= (uint16_t)data[i] << 8;
+		for(uint8_t bit = 0; bit < 8; bit++){
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+/*==================[external functions definition]==========================*/
+void TraceStart(void){
+	trace_on = false;
+	atomic_store(&trace_head, 0);
+	trace_on = true;
+}
+
+void TraceStop(void){
+	trace_on = false;
+}
+
+void IRAM_ATTR TraceRecord(uint8_t id, trace_kind_t kind, uint16_t arg){
+	if(!trace_on){
+		return;
+	}
+	// the slot is reserved before it's written: an ISR interrupting a task
+	// between both steps uses the next slot
+	uint32_t slot = atomic_fetch_add_explicit(&trace_head, 1, memory_order_relaxed) & TRACE_MASK;
+	trace_ring[slot].timestamp = (uint32_t)TimeNowUs();
+	trace_ring[slot].id = id;
+	trace_ring[slot].kind = kind;
+	trace_ring[slot].arg = arg;
+}
+
+void TraceDump(trace_write_t write_p){
+	if(write_p == NULL){
+		return;
+	}
+	bool was_on = trace_on;
+	trace_on = false;
+	uint32_t head = atomic_load(&trace_head);
+	uint32_t count = (head < TRACE_RECORDS) ? head : TRACE_RECORDS;
+	uint32_t lost = head - count;
+	uint32_t first = (head - count) & TRACE_MASK;
+	uint8_t header[TRACE_HEADER_SIZE] = {
+		'T', 'R', 'C', TRACE_VERSION,
+		count & 0xFF, count >> 8,
+		lost & 0xFF, (lost >> 8) & 0xFF, (lost >> 16) & 0xFF, lost >> 24
+	};
+	uint16_t crc = TraceCrc16(0xFFFF, header, sizeof(header));
+	write_p(header, sizeof(header));
+	// oldest records first: the ring is sent in one or two contiguous parts
+	uint32_t part = (first + count > TRACE_RECORDS) ? TRACE_RECORDS - first : count;
+	crc = TraceCrc16(crc, (const uint8_t *)&trace_ring[first], part * sizeof(trace_record_t));
+	write_p(&trace_ring[first], part * sizeof(trace_record_t));
+	if(part < count){
+		crc = TraceCrc16(crc, (const uint8_t *)trace_ring, (count - part) * sizeof(trace_record_t));
+		write_p(trace_ring, (count - part) * sizeof(trace_record_t));
+	}
+	uint8_t tail[2] = {crc & 0xFF, crc >> 8};
+	write_p(tail, sizeof(tail));
+	if(was_on){
+		TraceStart();
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -10,19 +10,39 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
 #include "uart_mcu.h"
 #include "gpio_mcu.h"
+#include "static_alloc_mcu.h"
 #include "driver/uart.h"
+#include "driver/usb_serial_jtag.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/stream_buffer.h"
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define UART_CONN_TX        GPIO_18         /*!<  */
 #define UART_CONN_RX        GPIO_19         /*!<  */
-#define TX_BUFFER_SIZE      256             /*!<  */
-#define RX_BUFFER_SIZE      256             /*!<  */
-#define EVENT_QUEUE_SIZE    16              /*!<  */
+#define TX_BUFFER_SIZE      256             /*!< Default TX ring size */
+#define RX_BUFFER_SIZE      256             /*!< Default RX ring size */
+#define BUFFER_MIN          (UART_HW_FIFO_LEN(0) + 1)    /*!< The driver requires rings larger than the hardware FIFO */
+#define EVENT_QUEUE_SIZE    16              /*!< Default event queue size */
 #define READ_TIMEOUT        100             /*!<  */
+#define PATTERN_CHR_TOUT    9               /*!< Max bit times between pattern characters (single character patterns) */
+#define TX_TASK_STACK       CONFIG_DRIVERS_UART_TX_TASK_STACK       /*!< Stack of the UartWriteAsync tasks */
+#define EVENT_TASK_STACK    CONFIG_DRIVERS_UART_EVENT_TASK_STACK    /*!< Stack of the event tasks */
+#define EVENT_TASK_PRIORITY 12              /*!< Priority of the event tasks */
+#define TX_TASK_PRIORITY    3               /*!< Priority of the UartWriteAsync tasks */
+#define UART_PORTS          3               /*!< UART_PC, UART_CONNECTOR and UART_USB */
+#define USB_PACKET_SIZE     64              /*!< Bytes of a USB full speed packet (read at a time by the UART_USB task) */
+/*==================[typedef]================================================*/
+/** Pending transmission of UartWriteAsync */
+typedef struct {
+    const void *data;
+    uint32_t nbytes;
+    TaskHandle_t notify;
+} uart_tx_request_t;
 /*==================[internal data declaration]==============================*/
 void (*uart_pc_isr_p)(void*);	            /*!<  */
 void (*uart_conn_isr_p)(void*);	            /*!<  */
@@ -30,6 +50,35 @@ void *uart_pc_user_data;	                /*!<  */
 void *uart_conn_user_data;	                /*!<  */
 static QueueHandle_t uart_pc_queue;         /*!<  */
 static QueueHandle_t uart_conn_queue;       /*!<  */
+/** Driver buffers of a port */
+typedef struct {
+    uint32_t tx_buffer_size;
+    uint32_t rx_buffer_size;
+    uint32_t event_queue_size;
+} uart_buffers_t;
+static uart_buffers_t uart_buffers[UART_PORTS] = {  /*!< Driver buffers of each port */
+    {TX_BUFFER_SIZE, RX_BUFFER_SIZE, EVENT_QUEUE_SIZE},
+    {TX_BUFFER_SIZE, RX_BUFFER_SIZE, EVENT_QUEUE_SIZE},
+    {TX_BUFFER_SIZE, RX_BUFFER_SIZE, EVENT_QUEUE_SIZE},
+};
+static QueueHandle_t uart_tx_queue[UART_PORTS];     /*!< Pending transmissions of each port */
+static TaskHandle_t uart_event_task[UART_PORTS];    /*!< Event task of each port (created once) */
+STATIC_QUEUES_DEFINE(uart_tx_queue, UART_PORTS, UART_TX_QUEUE_SIZE, sizeof(uart_tx_request_t));
+STATIC_TASKS_DEFINE(uart_tx_task, UART_PORTS, TX_TASK_STACK);
+STATIC_TASKS_DEFINE(uart_event_task, UART_PORTS, EVENT_TASK_STACK);
+/* UART_USB: the USB Serial/JTAG driver has no events, its task reads the data for the callbacks */
+static bool usb_installed = false;          /*!< USB Serial/JTAG driver installed */
+static StreamBufferHandle_t usb_rx_stream;  /*!< Data read by the task for UartReadByte/UartReadBuffer (with func_p) */
+void (*uart_usb_isr_p)(void*);              /*!<  */
+void *uart_usb_user_data;                   /*!<  */
+/** Buffered reception of a port */
+typedef struct {
+    uart_rx_func_t func_p;
+    void *param_p;
+    uint8_t pattern;
+    uint8_t *frame;                         /*!< Received data handed to func_p (rx_buffer_size + 1 bytes) */
+} uart_rx_t;
+static uart_rx_t uart_rx[UART_PORTS];       /*!< Buffered reception of each port */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -37,21 +86,102 @@ static QueueHandle_t uart_conn_queue;       /*!<  */
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uart_port_t uart_num_of(uart_mcu_port_t port){
+    return (port == UART_CONNECTOR) ? UART_NUM_1 : UART_NUM_0;
+}
+
+/* Writes data in the TX ring of a port (blocks while it is full) */
+static int uart_write(uart_mcu_port_t port, const void *data, uint32_t nbytes){
+    if(port == UART_USB){
+        return usb_serial_jtag_write_bytes(data, nbytes, portMAX_DELAY);
+    }
+    return uart_write_bytes(uart_num_of(port), data, nbytes);
+}
+
+/* Reads data from the RX ring of a port (waits up to READ_TIMEOUT) */
+static int uart_read(uart_mcu_port_t port, void *data, uint32_t nbytes){
+    if(port == UART_USB){
+        if(usb_rx_stream != NULL){
+            return xStreamBufferReceive(usb_rx_stream, data, nbytes, READ_TIMEOUT);
+        }
+        return usb_serial_jtag_read_bytes(data, nbytes, READ_TIMEOUT);
+    }
+    return uart_read_bytes(uart_num_of(port), data, nbytes, READ_TIMEOUT);
+}
+
+/* UART_DATA event: without pattern the received bytes are handed to the buffer callback */
+static void uart_rx_data(uart_mcu_port_t port, const uart_event_t *event){
+    uart_rx_t *rx = &uart_rx[port];
+    if(rx->func_p == NULL || rx->pattern != 0){
+        return;
+    }
+    uint32_t size = uart_buffers[port].rx_buffer_size;
+    int len = uart_read_bytes(uart_num_of(port), rx->frame, (event->size < size) ? event->size : size, 0);
+    if(len > 0){
+        rx->frame[len] = '\0';
+        rx->func_p(rx->frame, len, rx->param_p);
+    }
+}
+
+/* UART_PATTERN_DET event: the frame up to the pattern is handed to the buffer callback (without the pattern) */
+static void uart_rx_pattern(uart_mcu_port_t port){
+    uart_rx_t *rx = &uart_rx[port];
+    uart_port_t uart_num = uart_num_of(port);
+    if(rx->func_p == NULL){
+        return;
+    }
+    int pos = uart_pattern_pop_pos(uart_num);
+    if(pos < 0){
+        // pattern positions queue overflowed: frames boundaries are lost
+        uart_flush_input(uart_num);
+        return;
+    }
+    int len = uart_read_bytes(uart_num, rx->frame, pos + 1, 0);
+    if(len > 0){
+        rx->frame[len - 1] = '\0';
+        rx->func_p(rx->frame, len - 1, rx->param_p);
+    }
+}
+
+/* UART_FIFO_OVF and UART_BUFFER_FULL events: buffered reception discards the data (partial frames) */
+static void uart_rx_overflow(uart_mcu_port_t port, QueueHandle_t queue){
+    if(uart_rx[port].func_p != NULL){
+        uart_flush_input(uart_num_of(port));
+        xQueueReset(queue);
+    }
+}
+
+/* Enables the pattern detection of buffered reception (after the driver is installed) */
+static void uart_rx_start(uart_mcu_port_t port){
+    uart_rx_t *rx = &uart_rx[port];
+    if(rx->func_p != NULL && rx->pattern != 0){
+        uart_enable_pattern_det_baud(uart_num_of(port), rx->pattern, 1, PATTERN_CHR_TOUT, 0, 0);
+        uart_pattern_queue_reset(uart_num_of(port), uart_buffers[port].event_queue_size);
+    }
+}
+
 static void uart_pc_event_task(void *pvParameters){
     uart_event_t event;
-    uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 16, &uart_pc_queue, 0);
+    uart_buffers_t *buffers = &uart_buffers[UART_PC];
+    uart_driver_install(UART_NUM_0, buffers->rx_buffer_size, buffers->tx_buffer_size, buffers->event_queue_size, &uart_pc_queue, 0);
+    uart_rx_start(UART_PC);
     while(1){
         //Waiting for UART event.
         if (xQueueReceive(uart_pc_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
-                    uart_pc_isr_p(uart_pc_user_data);
+                    if(uart_pc_isr_p != NULL){
+                        uart_pc_isr_p(uart_pc_user_data);
+                    }
+                    uart_rx_data(UART_PC, &event);
                     break;
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
+                    uart_rx_overflow(UART_PC, uart_pc_queue);
                     break;
                 case UART_FIFO_OVF:
+                    uart_rx_overflow(UART_PC, uart_pc_queue);
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -60,6 +190,7 @@ static void uart_pc_event_task(void *pvParameters){
                 case UART_DATA_BREAK:
                     break;
                 case UART_PATTERN_DET:
+                    uart_rx_pattern(UART_PC);
                     break;
                 case UART_WAKEUP:
                     break;
@@ -72,19 +203,26 @@ static void uart_pc_event_task(void *pvParameters){
 
 static void uart_conn_event_task(void *pvParameters){
     uart_event_t event;
-    uart_driver_install(UART_NUM_1, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 16, &uart_conn_queue, 0);
+    uart_buffers_t *buffers = &uart_buffers[UART_CONNECTOR];
+    uart_driver_install(UART_NUM_1, buffers->rx_buffer_size, buffers->tx_buffer_size, buffers->event_queue_size, &uart_conn_queue, 0);
+    uart_rx_start(UART_CONNECTOR);
     while(1){
         //Waiting for UART event.
         if(xQueueReceive(uart_conn_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
-                    uart_conn_isr_p(uart_conn_user_data);
+                    if(uart_conn_isr_p != NULL){
+                        uart_conn_isr_p(uart_conn_user_data);
+                    }
+                    uart_rx_data(UART_CONNECTOR, &event);
                     break;
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
+                    uart_rx_overflow(UART_CONNECTOR, uart_conn_queue);
                     break;
                 case UART_FIFO_OVF:
+                    uart_rx_overflow(UART_CONNECTOR, uart_conn_queue);
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -93,6 +231,7 @@ static void uart_conn_event_task(void *pvParameters){
                 case UART_DATA_BREAK:
                     break;
                 case UART_PATTERN_DET:
+                    uart_rx_pattern(UART_CONNECTOR);
                     break;
                 case UART_WAKEUP:
                     break;
@@ -102,6 +241,59 @@ static void uart_conn_event_task(void *pvParameters){
         }
     }
 }
+/* Reception of UART_USB: the data of each USB packet is handed to the callbacks (frames split at the pattern) */
+static void uart_usb_task(void *pvParameters){
+    uart_rx_t *rx = &uart_rx[UART_USB];
+    uint32_t size = uart_buffers[UART_USB].rx_buffer_size;
+    uint8_t packet[USB_PACKET_SIZE];
+    uint32_t n = 0;                         /* bytes of the current frame */
+    while(1){
+        int len = usb_serial_jtag_read_bytes(packet, USB_PACKET_SIZE, portMAX_DELAY);
+        if(len <= 0){
+            continue;
+        }
+        if(usb_rx_stream != NULL){
+            // bytes that do not fit are lost, as with a full RX ring
+            xStreamBufferSend(usb_rx_stream, packet, len, 0);
+            if(uart_usb_isr_p != NULL){
+                uart_usb_isr_p(uart_usb_user_data);
+            }
+        }
+        if(rx->func_p == NULL){
+            continue;
+        }
+        if(rx->pattern == UART_NO_PATTERN){
+            memcpy(rx->frame, packet, len);
+            rx->frame[len] = '\0';
+            rx->func_p(rx->frame, len, rx->param_p);
+            continue;
+        }
+        for(int i = 0; i < len; i++){
+            if(packet[i] == rx->pattern){
+                rx->frame[n] = '\0';
+                rx->func_p(rx->frame, n, rx->param_p);
+                n = 0;
+            }else if(n < size){
+                // longer frames are cut at rx_buffer_size bytes
+                rx->frame[n++] = packet[i];
+            }
+        }
+    }
+}
+
+/* Copies the data of UartWriteAsync to the TX ring (pvParameters: port) */
+static void uart_tx_task(void *pvParameters){
+    uart_mcu_port_t port = (uart_mcu_port_t)(uintptr_t)pvParameters;
+    uart_tx_request_t request;
+    while(1){
+        if(xQueueReceive(uart_tx_queue[port], &request, portMAX_DELAY)){
+            uart_write(port, request.data, request.nbytes);
+            if(request.notify != NULL){
+                xTaskNotifyGive(request.notify);
+            }
+        }
+    }
+}
 /*==================[external functions definition]==========================*/
 
 void UartInit(serial_config_t *port_config){
@@ -113,110 +305,107 @@ void UartInit(serial_config_t *port_config){
         .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
         .source_clk = UART_SCLK_DEFAULT,
     };
+    uart_buffers_t *buffers = &uart_buffers[port_config->port];
+    if(port_config->tx_buffer_size > 0){
+        buffers->tx_buffer_size = (port_config->tx_buffer_size < BUFFER_MIN) ? BUFFER_MIN : port_config->tx_buffer_size;
+    }
+    if(port_config->rx_buffer_size > 0){
+        buffers->rx_buffer_size = (port_config->rx_buffer_size < BUFFER_MIN) ? BUFFER_MIN : port_config->rx_buffer_size;
+    }
+    if(port_config->event_queue_size > 0){
+        buffers->event_queue_size = port_config->event_queue_size;
+    }
+    if(uart_tx_queue[port_config->port] == NULL){
+        uart_tx_queue[port_config->port] = STATIC_QUEUE_CREATE_N(uart_tx_queue, port_config->port, UART_TX_QUEUE_SIZE, sizeof(uart_tx_request_t));
+        STATIC_TASK_CREATE_N(uart_tx_task, port_config->port, uart_tx_task, "uart_tx_task", (void *)(uintptr_t)port_config->port, TX_TASK_PRIORITY, NULL);
+    }
+    uart_rx_t *rx = &uart_rx[port_config->port];
+    if(port_config->rx_func_p != NULL && rx->frame == NULL){
+        rx->frame = malloc(buffers->rx_buffer_size + 1);
+    }
+    rx->func_p = (rx->frame != NULL) ? port_config->rx_func_p : NULL;
+    rx->param_p = port_config->param_p;
+    rx->pattern = port_config->rx_pattern;
+    bool events = (port_config->func_p != UART_NO_INT) || (rx->func_p != NULL);
     switch(port_config->port){
         case UART_PC:
             uart_param_config(UART_NUM_0, &uart_config);
             uart_set_pin(UART_NUM_0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
+            if(events){
                 uart_pc_isr_p = port_config->func_p;
-                uart_pc_queue = port_config->param_p;
-                xTaskCreate(uart_pc_event_task, "uart_pc_event_task", 2048, NULL, 12, 0);
+                uart_pc_user_data = port_config->param_p;
+                if(uart_event_task[UART_PC] == NULL){
+                    STATIC_TASK_CREATE_N(uart_event_task, UART_PC, uart_pc_event_task, "uart_pc_event_task", NULL, EVENT_TASK_PRIORITY, &uart_event_task[UART_PC]);
+                }
             }else{
-                uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
+                uart_driver_install(UART_NUM_0, buffers->rx_buffer_size, buffers->tx_buffer_size, 0, NULL, 0);
             }
             break;
         case UART_CONNECTOR:
             uart_param_config(UART_NUM_1, &uart_config);
             uart_set_pin(UART_NUM_1, UART_CONN_TX, UART_CONN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
+            if(events){
                 uart_conn_isr_p = port_config->func_p;
-                uart_conn_queue = port_config->param_p;
-                xTaskCreate(uart_conn_event_task, "uart_conn_event_task", 2048, NULL, 12, NULL);
+                uart_conn_user_data = port_config->param_p;
+                if(uart_event_task[UART_CONNECTOR] == NULL){
+                    STATIC_TASK_CREATE_N(uart_event_task, UART_CONNECTOR, uart_conn_event_task, "uart_conn_event_task", NULL, EVENT_TASK_PRIORITY, &uart_event_task[UART_CONNECTOR]);
+                }
             }else{
-                uart_driver_install(UART_NUM_1, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
+                uart_driver_install(UART_NUM_1, buffers->rx_buffer_size, buffers->tx_buffer_size, 0, NULL, 0);
+            }
+            break;
+        case UART_USB:
+            if(!usb_installed){
+                usb_serial_jtag_driver_config_t usb_config = {
+                    .tx_buffer_size = buffers->tx_buffer_size,
+                    .rx_buffer_size = buffers->rx_buffer_size,
+                };
+                usb_installed = (usb_serial_jtag_driver_install(&usb_config) == ESP_OK);
+            }
+            if(port_config->func_p != UART_NO_INT && usb_rx_stream == NULL){
+                usb_rx_stream = xStreamBufferCreate(buffers->rx_buffer_size, 1);
+            }
+            uart_usb_isr_p = port_config->func_p;
+            uart_usb_user_data = port_config->param_p;
+            if(events && usb_installed && uart_event_task[UART_USB] == NULL){
+                STATIC_TASK_CREATE_N(uart_event_task, UART_USB, uart_usb_task, "uart_usb_task", NULL, EVENT_TASK_PRIORITY, &uart_event_task[UART_USB]);
             }
             break;
     }
 }
 
 uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
-    uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    length = uart_read_bytes(uart_num, data, 1, READ_TIMEOUT);
-    if(length > 0){
-        return true;
-    } else{
-        return false;
-    }
+    return (uart_read(port, data, 1) > 0);
 }
 
 uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
-    uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    length = uart_read_bytes(uart_num, data, nbytes, READ_TIMEOUT);
-    if(length > 0){
-        return true;
-    } else{
-        return false;
-    }
+    return (uart_read(port, data, nbytes) > 0);
 }
 
 void UartSendByte(uart_mcu_port_t port, const char *data){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    uart_tx_chars(uart_num, data, 1);
+    uart_write(port, data, 1);
 }
 
 void UartSendString(uart_mcu_port_t port, const char *msg){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-	while(*msg != 0){
-        uart_tx_chars(uart_num, msg, 1);
-		msg++;
-	}
+    uart_write(port, msg, strlen(msg));
 }
 
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    uart_tx_chars(uart_num, data, nbytes);
+    uart_write(port, data, nbytes);
+}
+
+uint32_t UartWrite(uart_mcu_port_t port, const void *data, uint32_t nbytes){
+    int sent = uart_write(port, data, nbytes);
+    return (sent > 0) ? (uint32_t)sent : 0;
+}
+
+bool UartWriteAsync(uart_mcu_port_t port, const void *data, uint32_t nbytes, TaskHandle_t notify){
+    uart_tx_request_t request = {
+        .data = data,
+        .nbytes = nbytes,
+        .notify = notify,
+    };
+    return (xQueueSend(uart_tx_queue[port], &request, 0) == pdTRUE);
 }
 
 uint8_t* UartItoa(uint32_t val, uint8_t base){
@@ -0,0 +1,315 @@
+/**
+ * @file wifi_udp_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "wifi_udp_mcu.h"
+#include <string.h>
+#include <errno.h>
+#include "esp_log.h"
+#include "esp_wifi.h"
+#include "esp_event.h"
+#include "esp_netif.h"
+#include "lwip/sockets.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "nvs_mcu.h"
+#include "time_mcu.h"
+#include "static_alloc_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "wifi_udp_mcu"
+#define TX_TASK_PRIORITY	4		/*!< Priority of the transmission task */
+#define SEND_RETRIES		5		/*!< Attempts while the stack has no free buffers (ENOMEM) */
+#define POLL_MS				10		/*!< Period of WifiUdpWaitConnected checks */
+#define NO_DATAGRAM			0xFF	/*!< No datagram being filled */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Datagram buffer
+ */
+typedef struct {
+	uint16_t lenght;							/*!< Bytes used (header and frames) */
+	uint16_t frames;							/*!< Frames of the datagram */
+	uint8_t data[WIFI_UDP_MAX_DATAGRAM];		/*!< Header and frames */
+} datagram_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static wifi_udp_config_t udp_config;
+static volatile wifi_udp_state_t udp_state = WIFI_UDP_DISCONNECTED;
+static uint8_t retries = 0;
+static int udp_socket = -1;
+static struct sockaddr_in udp_host;
+static datagram_t datagrams[WIFI_UDP_BUFFERS];
+static uint8_t current = NO_DATAGRAM;			/* Datagram being filled */
+static uint64_t current_time = 0;				/* Time of its first frame (us) */
+static uint32_t seq = 0;
+static wifi_udp_stats_t udp_stats;
+static QueueHandle_t free_queue = NULL;			/* Indexes of the free datagrams */
+static QueueHandle_t send_queue = NULL;			/* Indexes of the datagrams to send */
+static SemaphoreHandle_t udp_mutex = NULL;		/* Current datagram and statistics */
+
+/* Tasks, queues and semaphores (static buffers with CONFIG_DRIVERS_STATIC_ALLOCATION) */
+STATIC_QUEUE_DEFINE(free_queue, WIFI_UDP_BUFFERS, sizeof(uint8_t));
+STATIC_QUEUE_DEFINE(send_queue, WIFI_UDP_BUFFERS, sizeof(uint8_t));
+STATIC_SEMAPHORE_DEFINE(udp_mutex);
+STATIC_TASK_DEFINE(udp_task, CONFIG_DRIVERS_WIFI_UDP_TASK_STACK);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Write a 32 bits field (little endian)
+ */
+static void WifiUdpPut32(uint8_t *p, uint32_t value){
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+/**
+ * @brief Close the current datagram and queue it (with udp_mutex taken)
+ */
+static void WifiUdpClose(void){
+	datagram_t *datagram = &datagrams[current];
+	WifiUdpPut32(&datagram->data[0], seq++);
+	WifiUdpPut32(&datagram->data[4], (uint32_t)current_time);
+	// there are as many places in the queue as datagrams: it never fails
+	xQueueSend(send_queue, &current, 0);
+	current = NO_DATAGRAM;
+}
+
+/**
+ * @brief Send a datagram (false if the stack could not send it)
+ */
+static bool WifiUdpSendDatagram(const datagram_t *datagram){
+	for(uint8_t i = 0; i < SEND_RETRIES; i++){
+		int n = sendto(udp_socket, datagram->data, datagram->lenght, 0, (struct sockaddr *)&udp_host, sizeof(udp_host));
+		if(n == datagram->lenght){
+			return true;
+		}
+		if(errno != ENOMEM){
+			return false;
+		}
+		// the lwIP/Wi-Fi TX buffers are full: wait for the air
+		vTaskDelay(1);
+	}
+	return false;
+}
+
+/**
+ * @brief Transmission task: sends the queued datagrams, and closes the current one after flush_ms
+ */
+static void WifiUdpTask(void *param){
+	uint8_t index;
+	TickType_t wait = pdMS_TO_TICKS(udp_config.flush_ms);
+	while(true){
+		if(xQueueReceive(send_queue, &index, (wait > 0) ? wait : 1) == pdTRUE){
+			datagram_t *datagram = &datagrams[index];
+			bool ok = (udp_state == WIFI_UDP_CONNECTED) && WifiUdpSendDatagram(datagram);
+			xSemaphoreTake(udp_mutex, portMAX_DELAY);
+			if(ok){
+				udp_stats.datagrams++;
+				udp_stats.bytes += datagram->lenght;
+				udp_stats.frames += datagram->frames;
+			}else{
+				udp_stats.send_errors++;
+				udp_stats.dropped += datagram->frames;
+			}
+			xSemaphoreGive(udp_mutex);
+			xQueueSend(free_queue, &index, 0);
+		}
+		// time left to flush the current datagram
+		xSemaphoreTake(udp_mutex, portMAX_DELAY);
+		wait = pdMS_TO_TICKS(udp_config.flush_ms);
+		if(current != NO_DATAGRAM){
+			uint64_t elapsed_ms = TimeElapsedUs(current_time) / TIME_US_PER_MS;
+			if(elapsed_ms >= udp_config.flush_ms){
+				WifiUdpClose();
+			}else{
+				wait = pdMS_TO_TICKS(udp_config.flush_ms - elapsed_ms);
+			}
+		}
+		xSemaphoreGive(udp_mutex);
+	}
+}
+
+/**
+ * @brief Wi-Fi and IP events: connection and reconnections
+ */
+static void WifiUdpEvent(void *arg, esp_event_base_t base, int32_t id, void *data){
+	if(base == WIFI_EVENT && id == WIFI_EVENT_STA_START){
+		udp_state = WIFI_UDP_CONNECTING;
+		esp_wifi_connect();
+	}else if(base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED){
+		if(udp_state == WIFI_UDP_CONNECTED){
+			udp_stats.reconnections++;
+			retries = 0;
+		}
+		if(udp_config.max_retry == 0 || retries < udp_config.max_retry){
+			retries++;
+			udp_state = WIFI_UDP_CONNECTING;
+			esp_wifi_connect();
+		}else{
+			udp_state = WIFI_UDP_DISCONNECTED;
+			ESP_LOGW(TAG, "Connection to %s failed", udp_config.ssid);
+		}
+	}else if(base == IP_EVENT && id == IP_EVENT_STA_GOT_IP){
+		ip_event_got_ip_t *event = data;
+		ESP_LOGI(TAG, "IP " IPSTR ", sending to %s:%d", IP2STR(&event->ip_info.ip), udp_config.host, udp_config.port);
+		retries = 0;
+		udp_state = WIFI_UDP_CONNECTED;
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool WifiUdpInit(const wifi_udp_config_t *config){
+	if(udp_mutex != NULL){
+		return false;
+	}
+	udp_config = *config;
+	if(udp_config.datagram_size == 0){
+		udp_config.datagram_size = WIFI_UDP_DEFAULT_DATAGRAM;
+	}
+	if(udp_config.datagram_size > WIFI_UDP_MAX_DATAGRAM){
+		udp_config.datagram_size = WIFI_UDP_MAX_DATAGRAM;
+	}
+	if(udp_config.flush_ms == 0){
+		udp_config.flush_ms = WIFI_UDP_DEFAULT_FLUSH_MS;
+	}
+	memset(&udp_host, 0, sizeof(udp_host));
+	udp_host.sin_family = AF_INET;
+	udp_host.sin_port = htons(udp_config.port);
+	if(udp_config.datagram_size <= WIFI_UDP_HEADER || inet_pton(AF_INET, udp_config.host, &udp_host.sin_addr) != 1){
+		return false;
+	}
+	// the Wi-Fi driver keeps its calibration data in the NVS
+	if(!NvsInit()){
+		return false;
+	}
+	free_queue = STATIC_QUEUE_CREATE(free_queue, WIFI_UDP_BUFFERS, sizeof(uint8_t));
+	send_queue = STATIC_QUEUE_CREATE(send_queue, WIFI_UDP_BUFFERS, sizeof(uint8_t));
+	udp_mutex = STATIC_MUTEX_CREATE(udp_mutex);
+	if(free_queue == NULL || send_queue == NULL || udp_mutex == NULL){
+		return false;
+	}
+	for(uint8_t i = 0; i < WIFI_UDP_BUFFERS; i++){
+		xQueueSend(free_queue, &i, 0);
+	}
+
+	if(esp_netif_init() != ESP_OK){
+		return false;
+	}
+	esp_err_t ret = esp_event_loop_create_default();
+	if(ret != ESP_OK && ret != ESP_ERR_INVALID_STATE){
+		return false;
+	}
+	esp_netif_create_default_wifi_sta();
+	wifi_init_config_t init_config = WIFI_INIT_CONFIG_DEFAULT();
+	ret = esp_wifi_init(&init_config);
+	if(ret != ESP_OK){
+		ESP_LOGE(TAG, "Wi-Fi init failed: %s", esp_err_to_name(ret));
+		return false;
+	}
+	esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, WifiUdpEvent, NULL, NULL);
+	esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, WifiUdpEvent, NULL, NULL);
+	wifi_config_t wifi_config = {0};
+	strncpy((char *)wifi_config.sta.ssid, udp_config.ssid, sizeof(wifi_config.sta.ssid));
+	strncpy((char *)wifi_config.sta.password, udp_config.password, sizeof(wifi_config.sta.password));
+	wifi_config.sta.threshold.authmode = (udp_config.password[0] != '\0') ? WIFI_AUTH_WPA2_PSK : WIFI_AUTH_OPEN;
+	if(esp_wifi_set_mode(WIFI_MODE_STA) != ESP_OK || esp_wifi_set_config(WIFI_IF_STA, &wifi_config) != ESP_OK ||
+	   esp_wifi_start() != ESP_OK){
+		return false;
+	}
+	// with modem sleep the datagrams would wait for the next beacon
+	esp_wifi_set_ps(WIFI_PS_NONE);
+
+	udp_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+	if(udp_socket < 0){
+		ESP_LOGE(TAG, "Socket error %d", errno);
+		return false;
+	}
+	return STATIC_TASK_CREATE(udp_task, WifiUdpTask, "wifi_udp_task", NULL, TX_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+bool WifiUdpWaitConnected(uint32_t timeout_ms){
+	for(uint32_t t = 0; udp_state != WIFI_UDP_CONNECTED; t += POLL_MS){
+		if(t >= timeout_ms){
+			return false;
+		}
+		vTaskDelay(pdMS_TO_TICKS(POLL_MS));
+	}
+	return true;
+}
+
+wifi_udp_state_t WifiUdpGetState(void){
+	return udp_state;
+}
+
+bool WifiUdpSend(const uint8_t *data, uint16_t lenght){
+	if(udp_mutex == NULL){
+		return false;
+	}
+	xSemaphoreTake(udp_mutex, portMAX_DELAY);
+	if(udp_state != WIFI_UDP_CONNECTED || lenght > udp_config.datagram_size - WIFI_UDP_HEADER){
+		udp_stats.dropped++;
+		xSemaphoreGive(udp_mutex);
+		return false;
+	}
+	if(current != NO_DATAGRAM && datagrams[current].lenght + lenght > udp_config.datagram_size){
+		WifiUdpClose();
+	}
+	if(current == NO_DATAGRAM){
+		if(xQueueReceive(free_queue, &current, 0) != pdTRUE){
+			current = NO_DATAGRAM;
+			udp_stats.dropped++;
+			xSemaphoreGive(udp_mutex);
+			return false;
+		}
+		datagrams[current].lenght = WIFI_UDP_HEADER;
+		datagrams[current].frames = 0;
+		current_time = TimeNowUs();
+	}
+	datagram_t *datagram = &datagrams[current];
+	memcpy(&datagram->data[datagram->lenght], data, lenght);
+	datagram->lenght += lenght;
+	datagram->frames++;
+	if(datagram->lenght == udp_config.datagram_size){
+		WifiUdpClose();
+	}
+	xSemaphoreGive(udp_mutex);
+	return true;
+}
+
+void WifiUdpFlush(void){
+	if(udp_mutex == NULL){
+		return;
+	}
+	xSemaphoreTake(udp_mutex, portMAX_DELAY);
+	if(current != NO_DATAGRAM){
+		WifiUdpClose();
+	}
+	xSemaphoreGive(udp_mutex);
+}
+
+void WifiUdpGetStats(wifi_udp_stats_t *stats){
+	wifi_ap_record_t ap;
+	if(udp_mutex == NULL){
+		memset(stats, 0, sizeof(wifi_udp_stats_t));
+		return;
+	}
+	xSemaphoreTake(udp_mutex, portMAX_DELAY);
+	*stats = udp_stats;
+	xSemaphoreGive(udp_mutex);
+	stats->rssi = (udp_state == WIFI_UDP_CONNECTED && esp_wifi_sta_get_ap_info(&ap) == ESP_OK) ? ap.rssi : 0;
+}
+
+/*==================[end of file]============================================*/
@@ -5,13 +5,20 @@
  * Este proyecto ejemplifica el uso del módulo de comunicación 
  * Bluetooth Low Energy (BLE), junto con el de cálculo de la FFT 
  * de una señal.
- * Permite graficar en una aplicación móvil la FFT de una señal. 
+ * La magnitud del espectro de la señal y de la señal filtrada se publica
+ * en el stream "FFT" del servicio de sensores como tramas de ble_plot_mcu.h
+ * (dos canales cuantizados a int16, tantos bins como entran en el MTU), y
+ * sólo se envía si el cliente está suscripto. El bin i corresponde a la
+ * frecuencia i * SAMPLE_FREQ / BUFFER_SIZE.
  *
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Messages batched in MTU sized notifications    |
+ * | 14/10/2026 | Binary FFT stream in the sensor service        |
+ * | 15/10/2026 | Espectros como tramas int16 (ble_plot_mcu)     |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -28,6 +35,7 @@
 #include "led.h"
 #include "neopixel_stripe.h"
 #include "ble_mcu.h"
+#include "ble_plot_mcu.h"
 #include "delay_mcu.h"
 
 #include "fft.h"
@@ -37,6 +45,7 @@
 #define LED_BT	            LED_1
 #define BUFFER_SIZE         256
 #define SAMPLE_FREQ	        220
+#define STREAM_FFT          0
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -63,8 +72,9 @@ float ecg[] = {
 static float ecg_filt[BUFFER_SIZE];
 static float ecg_fft[BUFFER_SIZE/2];
 static float ecg_filt_fft[BUFFER_SIZE/2];
-static float f[BUFFER_SIZE/2];
 TaskHandle_t fft_task_handle = NULL;
+static const char * const streams[] = {"FFT"};
+static ble_plot_t plot;
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función a ejecutarse ante un interrupción de recepción 
@@ -85,26 +95,24 @@ void read_data(uint8_t * data, uint8_t length){
  * 
  */
 static void FftTask(void *pvParameter){
-    char msg[48];
+    const float *spectra[] = {ecg_fft, ecg_filt_fft};
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
         FFTMagnitude(ecg, ecg_fft, BUFFER_SIZE);
-        HiPassFilter(ecg, ecg_filt, BUFFER_SIZE);
-        LowPassFilter(ecg_filt, ecg_filt, BUFFER_SIZE);
-        FFTFrequency(SAMPLE_FREQ, BUFFER_SIZE, f);
+        BandPassFilter(ecg, ecg_filt, BUFFER_SIZE);
         FFTMagnitude(ecg_filt, ecg_filt_fft, BUFFER_SIZE);
-        for(int16_t i=0; i<BUFFER_SIZE/2; i++){
-            /* Formato de datos para que sean graficados en la aplicación móvil */
-            sprintf(msg, "*HX%2.2fY%2.2f,X%2.2fY%2.2f*\n", f[i], ecg_fft[i], f[i], ecg_filt_fft[i]);
-            BleSendString(msg);
-        }
+        /* Cada espectro es un bloque: la última trama lleva la marca de fin */
+        BlePlotWrite(&plot, spectra, BUFFER_SIZE/2);
+        BlePlotFlush(&plot);
     }
 }
 /*==================[external functions definition]==========================*/
 void app_main(void){
     ble_config_t ble_configuration = {
-        "ESP_EDU_1",
-        read_data
+        .device_name = "ESP_EDU_1",
+        .func_p = read_data,
+        .streams = streams,
+        .stream_num = sizeof(streams) / sizeof(streams[0])
     };
 
     LedsInit();  
@@ -112,6 +120,7 @@ void app_main(void){
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
     BleInit(&ble_configuration);
+    BlePlotInit(&plot, STREAM_FFT, 2, 0);
 
     xTaskCreate(&FftTask, "FFT", 2048, NULL, 5, &fft_task_handle);
 
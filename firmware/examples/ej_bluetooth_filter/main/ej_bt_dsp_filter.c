@@ -18,6 +18,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 14/10/2026 | Timer notifies FftTask directly                |
+ * | 15/10/2026 | Filtrado y envío como pipeline (sin copias)    |
+ * | 15/10/2026 | Envío como tramas int16 (ble_plot_mcu)         |
+ * | 15/10/2026 | Comandos por tabla de despacho (ble_mcu)       |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -34,9 +38,11 @@
 #include "led.h"
 #include "neopixel_stripe.h"
 #include "ble_mcu.h"
+#include "ble_plot_mcu.h"
 #include "timer_mcu.h"
 
 #include "iir_filter.h"
+#include "pipeline.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
 #define LED_BT	            LED_1
@@ -44,6 +50,9 @@
 #define SAMPLE_FREQ	        200
 #define T_SENIAL            4000 
 #define CHUNK               4 
+#define POOL_BLOCKS         2
+#define STREAM_ECG          0
+#define PLOT_SAMPLES        50      /* Muestras por trama: 4 tramas por segundo */
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -67,45 +76,52 @@ float ecg[] = {
      69,  75,  79,  75,  68,  68,  76,  76,  69,  67,  74,  81,  77,
      71,  72,  82,  82,  76,  77,  76,  76,  75
 };
-static float ecg_filt[CHUNK];
+static float pool_buffer[PIPELINE_POOL_BUFFER_LENGHT(CHUNK, POOL_BLOCKS)];
+static pipeline_pool_t pool;
+static pipeline_stage_t source, filter_stage, ble_sink;
+static const char * const streams[] = {"ECG"};
+static ble_plot_t plot;
 TaskHandle_t fft_task_handle = NULL;
 bool filter = false;
 /*==================[internal functions declaration]=========================*/
-void read_data(uint8_t * data, uint8_t length){
-    switch(data[0]){
-        case 'A':
-            filter = true;
-            break;
-        case 'a':
-            filter = false;
-            break;
+/* Comandos 'A' (activa el filtro) y 'a' (lo desactiva): el parámetro es el nuevo estado */
+static void FilterSet(uint8_t * args, uint8_t length, void * param){
+    filter = (bool)(uintptr_t)param;
+}
+
+static const ble_cmd_t commands[] = {
+    {'A', 0, FilterSet, (void *)true},
+    {'a', 0, FilterSet, (void *)false},
+};
+
+/* Etapa del pipeline: filtra el bloque en el lugar, si el filtro está activado */
+static bool FilterStage(void *ctx, pipeline_block_t *in, pipeline_block_t *out){
+    if(filter){
+        BandPassFilter(in->data, in->data, in->lenght);
     }
+    return true;
 }
 
-void FuncTimerSenial(void* param){
-    xTaskNotifyGive(fft_task_handle);
+/* Etapa final del pipeline: agrega el bloque a la trama de BLE (se envía al completarse) */
+static bool BleStage(void *ctx, pipeline_block_t *in, pipeline_block_t *out){
+    const float *channels[] = {in->data};
+    BlePlotWrite(&plot, channels, in->lenght);
+    return true;
 }
 
 static void FftTask(void *pvParameter){
-    char msg[128];
-    char msg_chunk[24];
     static uint8_t indice = 0;
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        if(filter){
-            HiPassFilter(&ecg[indice], ecg_filt, CHUNK);
-            LowPassFilter(ecg_filt, ecg_filt, CHUNK);
-        } else{
-            memcpy(ecg_filt, &ecg[indice], CHUNK*sizeof(float));
-        }
-        strcpy(msg, "");
-        for(uint8_t i=0; i<CHUNK; i++){
-            sprintf(msg_chunk, "*G%.2f*", ecg_filt[i]);
-            strcat(msg, msg_chunk);
+        pipeline_block_t *block = PipelineAlloc(&pool);
+        if(block == NULL){
+            continue;
         }
+        /* la señal se copia una sola vez, al bloque: las etapas trabajan sobre él */
+        memcpy(block->data, &ecg[indice], CHUNK*sizeof(float));
+        block->lenght = CHUNK;
         indice += CHUNK;
-
-        BleSendString(msg);
+        PipelinePush(&source, block);
     }
 }
 /*==================[external functions definition]==========================*/
@@ -113,13 +129,18 @@ void app_main(void){
     uint8_t blink = 0;
     static neopixel_color_t color;
     ble_config_t ble_configuration = {
-        "ESP_EDU_1",
-        read_data
+        .device_name = "ESP_EDU_1",
+        .func_p = BLE_NO_INT,
+        .streams = streams,
+        .stream_num = sizeof(streams) / sizeof(streams[0]),
+        .commands = commands,
+        .command_num = sizeof(commands) / sizeof(commands[0]),
+        .command_format = BLE_CMD_TEXT
     };
     timer_config_t timer_senial = {
         .timer = TIMER_B,
         .period = T_SENIAL*CHUNK,
-        .func_p = FuncTimerSenial,
+        .func_p = NULL,
         .param_p = NULL
     };
 
@@ -130,8 +151,17 @@ void app_main(void){
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
     BleInit(&ble_configuration);
+    BlePlotInit(&plot, STREAM_ECG, 1, PLOT_SAMPLES);
+    PipelinePoolInit(&pool, CHUNK, POOL_BLOCKS, pool_buffer);
+    PipelineStageInit(&source, PIPELINE_IN_PLACE, NULL, NULL, NULL);
+    PipelineStageInit(&filter_stage, PIPELINE_IN_PLACE, FilterStage, NULL, &pool);
+    PipelineStageInit(&ble_sink, PIPELINE_SINK, BleStage, NULL, NULL);
+    PipelineConnect(&source, &filter_stage);
+    PipelineConnect(&filter_stage, &ble_sink);
 
     xTaskCreate(&FftTask, "FFT", 4096, NULL, 5, &fft_task_handle);
+    /* El timer notifica a la tarea directamente desde su interrupción */
+    TimerNotifyTask(timer_senial.timer, fft_task_handle);
     TimerStart(timer_senial.timer);
 
     while(1){
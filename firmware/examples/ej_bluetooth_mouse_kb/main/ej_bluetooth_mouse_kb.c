@@ -6,6 +6,8 @@
  * A partir de las señales generadas por el joystick analógico, emula un mouse (movimiento y 
  * click izquierdo). Además emula las teclas "barra espaciadora" y "flecha abajo" a partir 
  * de las teclas de la ESP-EDU (teclas "TECLA_1 y "TECLA_2" respectivamente).
+ * El joystick se lee cada 10 ms y el movimiento se acumula en el driver, que
+ * lo envía una vez por intervalo de conexión (modo de alta tasa, 7.5 ms).
  *
  * @section hardConn Hardware Connection
  *
@@ -22,6 +24,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Mouse motion accumulated at 100 Hz             |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -42,7 +45,7 @@
 #include "analog_io_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
-#define DELAY_MEASURE       50
+#define DELAY_MEASURE       10
 #define LED_BT	            LED_1
 /*==================[internal data definition]===============================*/
 TaskHandle_t joystick_task_handle = NULL;
@@ -76,19 +79,19 @@ void FuncTecJoy(void){
  * @brief 
  * 
  * @param analog_data 
- * @return int8_t 
+ * @return int16_t 
  */
-void UpdateMouse(int8_t * pos, uint16_t analog_data){
+void UpdateMouse(int16_t * pos, uint16_t analog_data){
     if(analog_data < 50){
-        *pos = - 30;
+        *pos = - 6;
     }else if(analog_data < 1000){
-        *pos = - 10;
+        *pos = - 2;
     }else if(analog_data < 2300){
         *pos = 0;
     }else if(analog_data < 3250){
-        *pos = 10;
+        *pos = 2;
     }else{
-        *pos = 30;
+        *pos = 6;
     }
 }
 /**
@@ -97,7 +100,7 @@ void UpdateMouse(int8_t * pos, uint16_t analog_data){
  * @param pvParameter 
  */
 void JoystickTask(void *pvParameter){
-    static int8_t mouse_x = 0, mouse_y = 0;
+    static int16_t mouse_x = 0, mouse_y = 0;
     uint16_t joystick_x, joystick_y;
     while(true){
         if(BleHidStatus() == BLE_CONNECTED){
@@ -106,10 +109,10 @@ void JoystickTask(void *pvParameter){
             UpdateMouse(&mouse_x, joystick_x);
             UpdateMouse(&mouse_y, joystick_y);
             if(click){
-                BleHidSendMouse(HID_MOUSE_LEFT, mouse_x, mouse_y);
+                BleHidMoveMouse(HID_MOUSE_LEFT, mouse_x, mouse_y);
                 click = false;
             }else{
-                BleHidSendMouse(0, mouse_x, mouse_y);
+                BleHidMoveMouse(0, mouse_x, mouse_y);
             }
         }
 		vTaskDelay(DELAY_MEASURE / portTICK_PERIOD_MS);
@@ -124,6 +127,7 @@ void app_main(void){
     SwitchActivInt(SWITCH_1, FuncTecla1, 0);
     SwitchActivInt(SWITCH_2, FuncTecla2, 0);
     BleHidInit("EP_HID");
+    BleHidHighRate(true);
     adc_x.input = CH1;
     adc_x.mode = ADC_SINGLE;
     AnalogInputInit(&adc_x);
@@ -0,0 +1,238 @@
+/*! @mainpage Ejemplo DSP - Benchmark
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto mide el tiempo de ejecución de las funcionalidades para
+ * Procesamiento Digital de Señales (DSP) que se utilizan en los proyectos:
+ * FFTMagnitude, LowPassFilter (todos los órdenes), dsps_conv_f32, dsps_fir_f32
+ * y la DCT, para distintos tamaños de señal, y la fusión de IMU
+ * (ImuFusionProcess) con cada uno de sus filtros.
+ *
+ * Con CONFIG_DRIVERS_POWER_MANAGEMENT se mide además el consumo de una
+ * adquisición por lotes (un lote de DSP cada POWER_PERIOD_MS) en tres modos:
+ * sin gestión de energía, con escalado de frecuencia (DFS) y con DFS y light
+ * sleep automático. Se informa la fracción del tiempo con la CPU activa y la
+ * corriente estimada con los consumos típicos POWER_I_*, que conviene
+ * reemplazar por los medidos en la placa con un amperímetro en serie.
+ *
+ * Se utiliza el contador de ciclos de la CPU. Cada medición se repite
+ * BENCH_REPS veces y se informa el menor valor (el menos afectado por
+ * interrupciones). Los resultados se imprimen por UART en forma de tabla, para
+ * poder compararlos entre versiones y detectar pérdidas de rendimiento.
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 14/10/2026 | Document creation		                         |
+ * | 14/10/2026 | Fusión de IMU (Mahony, Madgwick y EKF)          |
+ * | 15/10/2026 | Consumo por modo de gestión de energía          |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sdkconfig.h"
+#include "esp_cpu.h"
+#include "esp_dsp.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "power_mcu.h"
+#include <iir_filter.h>
+#include <fft.h>
+#include <imu_fusion.h>
+/*==================[macros and definitions]=================================*/
+#define BENCH_REPS          5           /* Repeticiones de cada medición */
+#define MAX_LENGHT          2048        /* Tamaño máximo de señal */
+#define FILTER_LENGHT       1024        /* Muestras filtradas por medición */
+#define FIR_MAX_TAPS        64          /* Coeficientes máximos del FIR */
+#define SAMPLE_FREQ         1000
+#define IMU_FRAMES          100         /* Tramas de IMU procesadas por medición */
+#define POWER_PERIOD_MS     100         /* Período de los lotes de la medición de consumo */
+#define POWER_TIME_MS       5000        /* Duración de la medición de cada modo */
+#define POWER_I_ACTIVE      30.0f       /* Corriente típica con la CPU activa a 160 MHz (mA) */
+#define POWER_I_IDLE_MAX    20.0f       /* Corriente típica en reposo a 160 MHz (mA) */
+#define POWER_I_IDLE_MIN    12.0f       /* Corriente típica en reposo a 40 MHz (mA) */
+#define POWER_I_SLEEP       0.2f        /* Corriente típica en light sleep (mA) */
+/* Mide BENCH_REPS veces la sentencia 'code' y guarda el menor número de ciclos en 'best' */
+#define BENCH_RUN(best, code)                                       \
+    do {                                                            \
+        best = UINT32_MAX;                                          \
+        for(uint8_t rep=0; rep<BENCH_REPS; rep++){                  \
+            uint32_t start = esp_cpu_get_cycle_count();             \
+            code;                                                   \
+            uint32_t cycles = esp_cpu_get_cycle_count() - start;    \
+            if(cycles < best){                                      \
+                best = cycles;                                      \
+            }                                                       \
+        }                                                           \
+    } while(0)
+/*==================[internal data definition]===============================*/
+static float signal[2 * MAX_LENGHT];
+static float output[2 * MAX_LENGHT];
+static float kernel[FIR_MAX_TAPS];
+static float fir_delay[FIR_MAX_TAPS + 4];  /* dsps_fir_init_f32 borra N + 4 muestras */
+static uint16_t signal_adc[MAX_LENGHT];
+static uint16_t output_adc[MAX_LENGHT / 2];
+static int32_t output_q31[FILTER_LENGHT];
+static imu_frame_t imu_frames[IMU_FRAMES];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Carga la señal de prueba (suma de senoidales y ruido).
+ */
+static void BenchSignal(void){
+    for(uint16_t i=0; i<2*MAX_LENGHT; i++){
+        signal[i] = sinf(0.05f * i) + 0.3f * sinf(0.71f * i) + (rand() % 100) / 1000.0f;
+    }
+    for(uint16_t i=0; i<MAX_LENGHT; i++){
+        signal_adc[i] = 2048 + (int16_t)(1000 * signal[i]);
+    }
+    /* IMU casi horizontal, girando lentamente */
+    for(uint16_t i=0; i<IMU_FRAMES; i++){
+        imu_frames[i].accel[0] = (int16_t)(1000 * signal[i]);
+        imu_frames[i].accel[1] = (int16_t)(1000 * signal[i + IMU_FRAMES]);
+        imu_frames[i].accel[2] = 16384;
+        imu_frames[i].gyro[0] = (int16_t)(100 * signal[i]);
+        imu_frames[i].gyro[1] = (int16_t)(100 * signal[i + IMU_FRAMES]);
+        imu_frames[i].gyro[2] = 131;
+    }
+}
+
+/**
+ * @brief Imprime una fila de la tabla de resultados.
+ *
+ * @param name Nombre de la función medida
+ * @param n Tamaño de la señal
+ * @param param Parámetro adicional (orden, coeficientes, etc.)
+ * @param cycles Ciclos de CPU de la mejor repetición
+ */
+static void BenchPrint(const char *name, uint16_t n, uint16_t param, uint32_t cycles){
+    printf("| %-18s | %5u | %5u | %10lu | %8lu | %9.1f |\n", name, n, param, (unsigned long)cycles,
+           (unsigned long)(cycles / n), (float)cycles / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+#if CONFIG_DRIVERS_POWER_MANAGEMENT
+/**
+ * @brief Mide el consumo de una adquisición por lotes en cada modo de gestión de energía.
+ *
+ * Cada POWER_PERIOD_MS se procesa un lote (FFT de 512 puntos y filtrado de
+ * 256 muestras) con el lock POWER_LOCK_DSP tomado. La CPU está activa
+ * mientras se tiene el lock y en reposo (o dormida) el resto del tiempo.
+ */
+static void BenchPower(void){
+    static const power_config_t modes[] = {
+        {CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, false},
+        {CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, 40, false},
+        {CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, 40, true},
+    };
+    static const char *names[] = {"Sin PM", "DFS", "DFS + light sleep"};
+    static const float idle_current[] = {POWER_I_IDLE_MAX, POWER_I_IDLE_MIN, POWER_I_SLEEP};
+    power_stats_t stats;
+
+    printf("****Consumo por modo (lote cada %d ms)****\n", POWER_PERIOD_MS);
+    printf("| %-18s | %8s | %10s | %9s |\n", "Modo", "Activo %", "Lote us", "mA (est)");
+    printf("|:-------------------|---------:|-----------:|----------:|\n");
+    for(uint8_t mode=0; mode<sizeof(modes)/sizeof(modes[0]); mode++){
+        if(!PowerInit(&modes[mode])){
+            printf("| %-18s | %8s | %10s | %9s |\n", names[mode], "-", "-", "-");
+            continue;
+        }
+        uint16_t batches = POWER_TIME_MS / POWER_PERIOD_MS;
+        TickType_t wake = xTaskGetTickCount();
+        for(uint16_t i=0; i<batches; i++){
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(POWER_PERIOD_MS));
+            PowerAcquire(POWER_LOCK_DSP);
+            FFTMagnitude(signal, output, 512);
+            LowPassFilter(signal, output, 256);
+            PowerRelease(POWER_LOCK_DSP);
+        }
+        PowerGetStats(&stats);
+        float active = (float)stats.active_us / stats.time_us;
+        float current = active * POWER_I_ACTIVE + (1.0f - active) * idle_current[mode];
+        printf("| %-18s | %8.2f | %10lu | %9.2f |\n", names[mode], 100.0f * active,
+               (unsigned long)(stats.lock_us[POWER_LOCK_DSP] / batches), current);
+    }
+    /* se deja el modo sin gestión de energía */
+    PowerInit(NULL);
+}
+#endif
+
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    uint32_t best;
+    static iir_filter_t iir;
+    static iir_filter_q31_t iir_q31;
+    fir_f32_t fir;
+
+    BenchSignal();
+    FFTInit();
+    FFTQ15Init();
+    for(uint8_t i=0; i<FIR_MAX_TAPS; i++){
+        kernel[i] = 1.0f / FIR_MAX_TAPS;
+    }
+
+    printf("****Benchmark DSP (%d MHz)****\n", CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+    printf("| %-18s | %5s | %5s | %10s | %8s | %9s |\n", "Funcion", "N", "Param", "Ciclos", "Cic/Mues", "Tiempo us");
+    printf("|:-------------------|------:|------:|-----------:|---------:|----------:|\n");
+
+    /* FFT */
+    for(uint16_t n=64; n<=MAX_LENGHT; n*=2){
+        BENCH_RUN(best, FFTMagnitude(signal, output, n));
+        BenchPrint("FFTMagnitude", n, 0, best);
+    }
+    for(uint16_t n=64; n<=MAX_LENGHT; n*=2){
+        BENCH_RUN(best, FFTMagnitudeQ15(signal_adc, 2048, output_adc, n));
+        BenchPrint("FFTMagnitudeQ15", n, 0, best);
+    }
+    /* Filtros IIR */
+    for(uint8_t order=ORDER_2; order<=ORDER_8; order+=2){
+        LowPassInit(SAMPLE_FREQ, 40, order);
+        BENCH_RUN(best, LowPassFilter(signal, output, FILTER_LENGHT));
+        BenchPrint("LowPassFilter", FILTER_LENGHT, order, best);
+    }
+    for(uint8_t order=ORDER_2; order<=ORDER_8; order+=2){
+        IIRFilterLowPassInit(&iir, SAMPLE_FREQ, 40, order);
+        IIRFilterQ31Init(&iir_q31, &iir);
+        BENCH_RUN(best, IIRFilterQ31ProcessU16(&iir_q31, signal_adc, output_q31, FILTER_LENGHT));
+        BenchPrint("IIRFilterQ31", FILTER_LENGHT, order, best);
+    }
+    /* Convolución */
+    for(uint16_t taps=16; taps<=FIR_MAX_TAPS; taps*=2){
+        BENCH_RUN(best, dsps_conv_f32(signal, FILTER_LENGHT, kernel, taps, output));
+        BenchPrint("dsps_conv_f32", FILTER_LENGHT, taps, best);
+    }
+    /* FIR */
+    for(uint16_t taps=16; taps<=FIR_MAX_TAPS; taps*=2){
+        dsps_fir_init_f32(&fir, kernel, fir_delay, taps);
+        BENCH_RUN(best, dsps_fir_f32(&fir, signal, output, FILTER_LENGHT));
+        BenchPrint("dsps_fir_f32", FILTER_LENGHT, taps, best);
+    }
+    /* DCT (opera sobre el mismo array, de tamaño 2N; lee la tabla de twiddles,
+     * de CONFIG_DSP_MAX_FFT_SIZE floats, hasta 4N) */
+    for(uint16_t n=64; n<=CONFIG_DSP_MAX_FFT_SIZE/4 && n<=MAX_LENGHT; n*=2){
+        memcpy(output, signal, 2 * n * sizeof(float));
+        BENCH_RUN(best, dsps_dct_f32(output, n));
+        BenchPrint("dsps_dct_f32", n, 0, best);
+    }
+    /* Fusión de IMU (Param = filtro: 0 Mahony, 1 Madgwick, 2 EKF) */
+    for(uint8_t mode=IMU_FUSION_MAHONY; mode<=IMU_FUSION_EKF; mode++){
+        imu_fusion_config_t config = {mode, 100, 10, 16384, 131, 0};
+        imu_fusion_t fusion;
+        if(ImuFusionInit(&fusion, &config)){
+            BENCH_RUN(best, ImuFusionProcess(&fusion, imu_frames, IMU_FRAMES, NULL, 0));
+            BenchPrint("ImuFusionProcess", IMU_FRAMES, mode, best);
+            ImuFusionDeinit(&fusion);
+        }
+    }
+#if CONFIG_DRIVERS_POWER_MANAGEMENT
+    BenchPower();
+#endif
+    printf("****Fin****\n");
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,97 @@
+/*! @mainpage Ejemplo Fusión de IMU
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto estima la orientación del dispositivo MPU6050 a partir del
+ * acelerómetro y el giróscopo. La interrupción de dato listo del sensor
+ * despierta al driver, que lee las tramas en lotes de la FIFO, y se procesan
+ * con el filtro seleccionado en FUSION_MODE (Mahony, Madgwick o el EKF de
+ * esp-dsp). La orientación se imprime a PUBLISH_FREQ.
+ *
+ * \section hardConn Hardware Connection
+ *
+ * |   	MPU6050		|   ESP-EDU		|
+ * |:--------------:|:--------------|
+ * | 	SDA     	|	SDA 		|
+ * | 	3V3		 	| 	3V3			|
+ * | 	SCL		 	| 	SCL 		|
+ * | 	GND		 	| 	GND			|
+ * | 	INT		 	| 	GPIO_22		|
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 14/10/2026 | Document creation		                         |
+ * | 14/10/2026 | Lectura por interrupción de dato listo         |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "i2c_mcu.h"
+#include "mpu6050.h"
+#include "ring_buffer_mcu.h"
+#include "imu_fusion.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_FREQ         100         /* Frecuencia de las tramas (Hz) */
+#define PUBLISH_FREQ        10          /* Frecuencia de la orientación (Hz) */
+#define FUSION_MODE         IMU_FUSION_MAHONY
+#define READ_FRAMES         10          /* Tramas por lectura de la FIFO (100 ms) */
+#define INT_PIN             GPIO_22     /* Pin INT del MPU6050 */
+#define RING_FRAMES         64          /* Tramas del buffer circular */
+#define RAD_TO_DEG          57.29578f
+/*==================[internal data definition]===============================*/
+static mpu6050_frame_t ring_storage[RING_FRAMES];
+static ring_buffer_t ring;
+static imu_frame_t frames[RING_FRAMES];
+static imu_orientation_t orientation[RING_FRAMES / (SAMPLE_FREQ / PUBLISH_FREQ)];
+static imu_fusion_t fusion;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    /* +/-2 g y +/-250 °/s (valores de MPU6050_initialize) */
+    imu_fusion_config_t config = {FUSION_MODE, SAMPLE_FREQ, PUBLISH_FREQ, 16384, 131, 0};
+
+    I2C_initialize(400000);
+    MPU6050_initialize();
+    if(!MPU6050_testConnection()){
+        printf("MPU6050 no encontrado\n");
+        return;
+    }
+    /* Filtro pasa bajos de 42 Hz: el giróscopo muestrea a 1 kHz, divisor 9 para 100 Hz */
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_42);
+    RingBufferInit(&ring, ring_storage, sizeof(mpu6050_frame_t), RING_FRAMES);
+    if(!ImuFusionInit(&fusion, &config)){
+        printf("Error al inicializar la fusión\n");
+        return;
+    }
+    MPU6050_startFIFOStream(1000 / SAMPLE_FREQ - 1);
+    /* El driver lee la FIFO cada READ_FRAMES interrupciones y notifica a esta tarea */
+    MPU6050_startInterrupt(INT_PIN, &ring, READ_FRAMES, xTaskGetCurrentTaskHandle());
+    printf("****Fusión de IMU****\n");
+
+    while(1){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        /* Se procesan juntas todas las tramas leídas */
+        uint16_t n = RingBufferRead(&ring, frames, RING_FRAMES);
+        uint8_t m = ImuFusionProcess(&fusion, frames, n, orientation, sizeof(orientation) / sizeof(orientation[0]));
+        for(uint8_t i = 0; i < m && i < sizeof(orientation) / sizeof(orientation[0]); i++){
+            printf("Roll: %6.1f  Pitch: %6.1f  Yaw: %6.1f\n", orientation[i].euler[0] * RAD_TO_DEG,
+                   orientation[i].euler[1] * RAD_TO_DEG, orientation[i].euler[2] * RAD_TO_DEG);
+        }
+        mpu6050_int_stats_t stats;
+        MPU6050_getInterruptStats(&stats);
+        if(stats.fifoOverflow > 0){
+            printf("Desbordes de FIFO: %lu\n", (unsigned long)stats.fifoOverflow);
+        }
+    }
+}
+/*==================[end of file]============================================*/
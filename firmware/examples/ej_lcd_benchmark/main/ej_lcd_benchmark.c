@@ -0,0 +1,187 @@
+/*! @mainpage Ejemplo Display LCD color - Benchmark
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto mide el rendimiento del display LCD color (ILI9341) con cada
+ * forma de dibujo disponible: relleno de pantalla completa, rectángulo
+ * relleno, líneas, texto con cada fuente (la primera vez, que expande los
+ * caracteres, y con los caracteres ya en la caché de glifos), imágenes
+ * (copiadas desde memoria, ventana por DMA desde RAM y canvas por franjas) y
+ * muestras por segundo del gráfico roll_plot con una y dos trazas.
+ *
+ * Cada medición se repite BENCH_REPS veces con esp_timer y se informa el
+ * tiempo medio, los cuadros por segundo (fps) y los bytes de píxeles por
+ * segundo. Los resultados se imprimen por UART como una tabla, para elegir
+ * la frecuencia del SPI (SPI_BR en ili9341.c) y el modo de dibujo de cada
+ * producto.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |   	Display		|   ESP-EDU		|
+ * |:--------------:|:--------------|
+ * | 	SDO/MISO 	|	GPIO_22		|
+ * | 	LED		 	| 	3V3			|
+ * | 	SCK		 	| 	GPIO_20		|
+ * | 	SDI/MOSI 	| 	GPIO_21		|
+ * | 	DC/RS	 	| 	GPIO_9		|
+ * | 	RESET	 	| 	GPIO_18		|
+ * | 	CS		 	| 	GPIO_19		|
+ * | 	GND		 	| 	GND			|
+ * | 	VCC		 	| 	3V3			|
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gpio_mcu.h"
+#include "ili9341.h"
+#include "ili9341_canvas.h"
+#include "roll_plot.h"
+/*==================[macros and definitions]=================================*/
+#define BENCH_REPS          10          /* Repeticiones de cada medición */
+#define STRIP_HEIGHT        40          /* Alto de las imágenes y del área del canvas */
+#define STRIP_PIXELS        (ILI9341_WIDTH * STRIP_HEIGHT)
+#define CANVAS_STRIP_PIXELS (ILI9341_WIDTH * 10)
+#define PLOT_SAMPLES        480         /* Muestras de roll_plot por medición */
+#define TEXT                "1234"      /* Texto dibujado con cada fuente */
+/* Mide BENCH_REPS veces la sentencia 'code' y guarda el tiempo medio (us) en 'mean' */
+#define BENCH_TIME(mean, code)                                      \
+    do {                                                            \
+        int64_t start = esp_timer_get_time();                       \
+        for(uint8_t rep=0; rep<BENCH_REPS; rep++){                  \
+            code;                                                   \
+        }                                                           \
+        mean = (uint32_t)((esp_timer_get_time() - start) / BENCH_REPS); \
+    } while(0)
+/*==================[internal data definition]===============================*/
+WORD_ALIGNED_ATTR DMA_ATTR static uint16_t picture[STRIP_PIXELS];
+WORD_ALIGNED_ATTR DMA_ATTR static uint16_t strip_buffer[2][CANVAS_STRIP_PIXELS];
+static ili9341_strips_t strips = {{strip_buffer[0], strip_buffer[1]}, CANVAS_STRIP_PIXELS};
+static Font_t * fonts[] = {&font_11, &font_19, &font_22, &font_30, &font_59, &font_89};
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Imprime una fila de la tabla de resultados.
+ *
+ * @param name Nombre de la prueba
+ * @param param Parámetro (fuente, trazas, etc.)
+ * @param pixels Píxeles escritos por operación
+ * @param time_us Tiempo medio de una operación
+ */
+static void BenchPrint(const char *name, uint16_t param, uint32_t pixels, uint32_t time_us){
+    float fps = (time_us > 0) ? 1e6f / time_us : 0;
+    printf("| %-18s | %5u | %7lu | %9lu | %8.1f | %8.1f |\n", name, param, (unsigned long)pixels,
+           (unsigned long)time_us, fps, fps * pixels * 2 / 1024);
+}
+
+/**
+ * @brief Dibuja en una franja del canvas un fondo y un texto.
+ */
+static void RenderStrip(ili9341_canvas_t * canvas, void * param){
+    ILI9341CanvasFill(canvas, ILI9341_NAVY);
+    ILI9341CanvasDrawString(canvas, 10, 8, TEXT, &font_22, ILI9341_WHITE, ILI9341_NAVY);
+}
+
+/**
+ * @brief Mide las muestras por segundo de roll_plot con n trazas.
+ */
+static void BenchPlot(uint8_t n){
+    plot_t plot = {
+        .x_pos = 0,
+        .y_pos = 100,
+        .width = ILI9341_WIDTH,
+        .height = 100,
+        .x_scale = 100,
+        .back_color = ILI9341_WHITE
+    };
+    signal_t traces[2] = {
+        {.y_scale = 100, .y_offset = 50, .color = ILI9341_RED},
+        {.y_scale = 100, .y_offset = 20, .color = ILI9341_BLUE},
+    };
+    signal_t * signals[2] = {&traces[0], &traces[1]};
+    int16_t data[2];
+    RTPlotInit(&plot);
+    RTSignalInit(&plot, &traces[0]);
+    RTSignalInit(&plot, &traces[1]);
+    int64_t start = esp_timer_get_time();
+    for(uint16_t i=0; i<PLOT_SAMPLES; i++){
+        /* diente de sierra: una columna distinta en cada muestra */
+        data[0] = (i * 7) % 40;
+        data[1] = (i * 3) % 20;
+        RTPlotDrawTraces(signals, data, n);
+    }
+    ILI9341DrawWindowWait();
+    uint32_t mean = (uint32_t)((esp_timer_get_time() - start) / PLOT_SAMPLES);
+    /* cada muestra escribe su columna y borra la siguiente */
+    BenchPrint("RTPlotDrawTraces", n, 2 * (plot.height + 1), mean);
+}
+
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    uint32_t mean, hits, misses;
+    uint16_t width, height;
+
+    ILI9341Init(SPI_1, GPIO_9, GPIO_18);
+    ILI9341Rotate(ILI9341_Portrait_1);
+    /* imagen de prueba: degradé en orden de bytes del LCD */
+    for(uint32_t i=0; i<STRIP_PIXELS; i++){
+        uint16_t color = (i % ILI9341_WIDTH) << 5;
+        picture[i] = (color >> 8) | (color << 8);
+    }
+
+    printf("****Benchmark LCD ILI9341****\n");
+    printf("| %-18s | %5s | %7s | %9s | %8s | %8s |\n", "Prueba", "Param", "Pixeles", "Tiempo us", "fps", "KB/s");
+    printf("|:-------------------|------:|--------:|----------:|---------:|---------:|\n");
+
+    /* Rellenos */
+    BENCH_TIME(mean, ILI9341Fill((rep & 1) ? ILI9341_BLACK : ILI9341_WHITE));
+    BenchPrint("ILI9341Fill", 0, ILI9341_PIXEL_MAX, mean);
+    BENCH_TIME(mean, ILI9341DrawFilledRectangle(20, 20, 119, 119, (rep & 1) ? ILI9341_RED : ILI9341_GREEN));
+    BenchPrint("FilledRectangle", 100, 100 * 100, mean);
+    /* Líneas: diagonal de la pantalla y horizontal */
+    BENCH_TIME(mean, ILI9341DrawLine(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1, ILI9341_BLUE));
+    BenchPrint("DrawLine diagonal", 0, ILI9341_HEIGHT, mean);
+    BENCH_TIME(mean, ILI9341DrawHLine(0, ILI9341_WIDTH - 1, 160, ILI9341_BLUE));
+    BenchPrint("DrawHLine", 0, ILI9341_WIDTH, mean);
+
+    /* Texto con cada fuente (Param = alto de la fuente): sin y con los glifos en caché */
+    for(uint8_t f=0; f<sizeof(fonts)/sizeof(fonts[0]); f++){
+        ILI9341GetStringSize(TEXT, fonts[f], &width, &height);
+        int64_t start = esp_timer_get_time();
+        ILI9341DrawString(0, 0, TEXT, fonts[f], ILI9341_BLACK, ILI9341_WHITE);
+        BenchPrint("DrawString (1ra)", fonts[f]->font_height, width * height, (uint32_t)(esp_timer_get_time() - start));
+        BENCH_TIME(mean, ILI9341DrawString(0, 0, TEXT, fonts[f], ILI9341_BLACK, ILI9341_WHITE));
+        BenchPrint("DrawString", fonts[f]->font_height, width * height, mean);
+    }
+    ILI9341GetGlyphCacheStats(&hits, &misses);
+
+    /* Imágenes de 240 x STRIP_HEIGHT */
+    BENCH_TIME(mean, ILI9341DrawPicture(0, 200, ILI9341_WIDTH, STRIP_HEIGHT, (const uint8_t *)picture));
+    BenchPrint("DrawPicture", STRIP_HEIGHT, STRIP_PIXELS, mean);
+    BENCH_TIME(mean, ILI9341DrawWindow(0, 200, ILI9341_WIDTH, STRIP_HEIGHT, picture));
+    BenchPrint("DrawWindow (DMA)", STRIP_HEIGHT, STRIP_PIXELS, mean);
+    BENCH_TIME(mean, ILI9341CanvasRender(&strips, 0, 200, ILI9341_WIDTH, STRIP_HEIGHT, RenderStrip, NULL));
+    BenchPrint("CanvasRender", STRIP_HEIGHT, STRIP_PIXELS, mean);
+
+    /* roll_plot (Param = trazas, fps = muestras por segundo) */
+    ILI9341Fill(ILI9341_WHITE);
+    BenchPlot(1);
+    BenchPlot(2);
+
+    printf("Cache de glifos: %lu aciertos, %lu fallos\n", (unsigned long)hits, (unsigned long)misses);
+    printf("****Fin****\n");
+}
+/*==================[end of file]============================================*/
@@ -24,11 +24,25 @@
  * | 	GND		 	| 	GND			|
  * | 	VCC		 	| 	3V3			|
  *
+ * Los LEDs (el NeoPixel de la placa, o una tira cambiando LED_PIN y
+ * LED_COUNT) reaccionan al audio: cada LED_HOP muestras reproducidas se
+ * calcula el espectro de las últimas LED_FRAME (STFT) y la energía de cada
+ * banda define el brillo de su color (audio_reactive.h).
+ *
+ * Con la TECLA_2 se reproduce, en lugar de la canción grabada en la flash,
+ * el audio recibido por UART_PC (PCM de 8 bits sin signo a 8 kSPS, enviado
+ * por stream_to_edu.py). Las muestras recibidas pasan por un jitter buffer
+ * (jitter_buffer_mcu.h) y el Timer sigue marcando el ritmo de reproducción:
+ * las ráfagas del enlace no se escuchan. La barra de progreso muestra el
+ * nivel del buffer y, debajo del título, los underruns y overruns.
+ *
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 15/10/2026 | LEDs reactivos al audio (STFT por bandas)      |
+ * | 15/10/2026 | Reproducción de audio recibido por UART        |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -44,17 +58,22 @@
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
 #include "analog_io_mcu.h"
+#include "uart_mcu.h"
+#include "jitter_buffer_mcu.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "switch.h"
 #include "ili9341.h"
+#include "neopixel_stripe.h"
 
 #include "vumeter.h"
 #include "song.h"
 
 #include "fft.h"
+#include "stft.h"
+#include "audio_reactive.h"
 /*==================[macros and definitions]=================================*/
 #define SAMPLE_FREQ	        8000        /* 8 kSPS */
 #define T_SENIAL            125         /* 0.125 ms */
@@ -66,12 +85,39 @@
 #define COLOR_MAIN_3        0x6ab8
 #define COLOR_MAIN_4        0x71b9
 #define COLOR_BG_1          0x0884
+#define LED_PIN             BUILT_IN_RGB_LED_PIN
+#define LED_COUNT           BUILT_IN_RGB_LED_LENGTH
+#define LED_FRAME           512         /* Muestras de cada espectro de los LEDs (64 ms) */
+#define LED_HOP             256         /* Muestras entre espectros (32 ms por cuadro) */
+#define LED_BANDS           6
+#define PLAYED_LENGHT       (2 * CHUNK) /* Historial de muestras reproducidas (para el vúmetro y los LEDs) */
+#define STREAM_PORT         UART_PC
+#define STREAM_BAUD         921600
+#define STREAM_LENGHT       8192        /* Jitter buffer: 1 s de audio */
+#define STREAM_NAME         "UART stream"
 /*==================[internal data definition]===============================*/
 TaskHandle_t plot_task_handle = NULL;
+TaskHandle_t led_task_handle = NULL;
+static float led_samples[LED_HOP];
+static float stft_buffer[STFT_BUFFER_LENGHT(LED_FRAME)];
+static stft_t stft;
+static audio_reactive_t leds;
+static neopixel_color_t led_colors[LED_COUNT];
+/* Graves en rojo, agudos en violeta */
+static const uint32_t led_palette[LED_BANDS] = {
+    NEOPIXEL_COLOR_RED, NEOPIXEL_COLOR_ORANGE, NEOPIXEL_COLOR_YELLOW,
+    NEOPIXEL_COLOR_GREEN, NEOPIXEL_COLOR_CYAN, NEOPIXEL_COLOR_VIOLET
+};
 static float fft[CHUNK/2];
 static float chunk[CHUNK];
 static uint32_t song_index = 0;
 static bool reset = false;
+/* Fin de la canción: la tarea de graficación detiene el timer */
+static volatile bool song_end = false;
+static uint8_t played[PLAYED_LENGHT];
+static uint8_t stream_storage[STREAM_LENGHT];
+static jitter_buffer_t stream;
+static bool streaming = false;
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función ejecutada en la interrupción de la tecla 1.
@@ -79,29 +125,85 @@ static bool reset = false;
  * 
  */
 void FuncSwitchStart(void *param){
+    if(streaming || song_end){
+        return;
+    }
     reset = false;
     TimerStart(TIMER_B);
 }
 
+/**
+ * @brief Función ejecutada en la interrupción de la tecla 2.
+ * Inicia o detiene la reproducción del audio recibido por UART.
+ * 
+ */
+void FuncSwitchStream(void *param){
+    if(!streaming){
+        if(song_index != 0 || song_end){
+            /* Se está reproduciendo la canción */
+            return;
+        }
+        JitterBufferFlush(&stream);
+        reset = false;
+        streaming = true;
+        TimerStart(TIMER_B);
+    }else{
+        TimerStop(TIMER_B);
+        streaming = false;
+        song_index = 0;
+        reset = true;
+        xTaskNotifyGive(plot_task_handle);
+    }
+}
+
+/**
+ * @brief Función llamada por el driver de la UART con los datos recibidos.
+ * Guarda las muestras en el jitter buffer.
+ * 
+ */
+static void StreamRx(uint8_t *data, uint16_t lenght, void *param){
+    if(streaming){
+        JitterBufferWrite(&stream, data, lenght);
+    }
+}
+
 /**
  * @brief Función ejecutada en la interrupción del Timer. 
  * Reproduce la señal de audio mediante el DAC.
  * 
+ * @return true si despertó una tarea de mayor prioridad (el timer cede el CPU al salir)
  */
-void FuncTimerSenial(void* param){
-    AnalogOutputWrite(song[song_index]);
+static bool FuncTimerSenial(void* param){
+    uint8_t sample;
+    BaseType_t woken = pdFALSE;
+    if(song_end){
+        /* El timer sigue hasta que lo detiene la tarea de graficación */
+        return false;
+    }
+    if(streaming){
+        JitterBufferRead(&stream, &sample);
+    }else{
+        sample = song[song_index];
+    }
+    AnalogOutputWrite(sample);
+    played[song_index % PLAYED_LENGHT] = sample;
     song_index++;
+    if(song_index%LED_HOP == 0){
+        /* Índice del primer sample del bloque para los LEDs */
+        xTaskNotifyFromISR(led_task_handle, song_index - LED_HOP, eSetValueWithOverwrite, &woken);
+    }
     if(song_index%CHUNK == 0){
         /* Graficar cada 1024 (CHUNK) muestras reproducidas */
-        xTaskNotifyGive(plot_task_handle);
+        vTaskNotifyGiveFromISR(plot_task_handle, &woken);
     }
-    if(song_index == N_SONG){
+    if(!streaming && song_index == N_SONG){
         song_index = 0;
-        TimerStop(TIMER_B);
+        song_end = true;
         reset = true;
-        /* Resetear pantalla */
-        xTaskNotifyGive(plot_task_handle);
+        /* Resetear pantalla y detener el timer */
+        vTaskNotifyGiveFromISR(plot_task_handle, &woken);
     }
+    return woken == pdTRUE;
 }
 
 /**
@@ -138,6 +240,32 @@ void Song2Bars(const uint8_t* song, uint8_t* bars){
     }
 }
 
+/**
+ * @brief Función llamada con cada espectro de la STFT: actualiza los niveles
+ * de las bandas y, si la transmisión anterior terminó, los colores de los LEDs.
+ */
+static void LedFrame(const float * magnitude, uint16_t bins, void * param){
+    AudioReactiveProcess(&leds, magnitude, bins);
+    if(!NeoPixelBusy()){
+        AudioReactiveRender(&leds, NeoPixelGetArray(), NeoPixelGetLength());
+        NeoPixelShow();
+    }
+}
+
+/**
+ * @brief Tarea de los LEDs: un espectro (y una pasada por las bandas) cada LED_HOP muestras.
+ */
+static void LedTask(void *pvParameter){
+    uint32_t first;
+    while(true){
+        xTaskNotifyWait(0, 0, &first, portMAX_DELAY);
+        for(uint16_t i = 0; i < LED_HOP; i++){
+            led_samples[i] = (played[(first + i) % PLAYED_LENGHT] - (MAX_DAC/2)) / (float)(MAX_DAC/2);
+        }
+        STFTProcess(&stft, led_samples, LED_HOP);
+    }
+}
+
 /**
  * @brief Tarea encargada de la graficación en el display LCD.
  * 
@@ -147,29 +275,54 @@ static void PlotTask(void *pvParameter){
     vumeter_t* vum = (vumeter_t*)pvParameter; 
     static uint16_t progress_bar, progress_bar_index = 0;
     static uint8_t bars[VUM_BARS];
+    static char stream_info[32];
+    uint16_t width, height;
     progress_bar = N_SONG / CHUNK;
     
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
         if(!reset){
-            if(song_index-CHUNK == 0){
+            /* Fin del último bloque reproducido */
+            uint32_t end = song_index - song_index % CHUNK;
+            if(end == CHUNK){
                 /* Título canción */
-                uint16_t width, height;
-                ILI9341GetStringSize(SONG_NAME, &font_22, &width, &height);
-                ILI9341DrawString(120-width/2, 45, SONG_NAME, &font_22, COLOR_MAIN_1, COLOR_BG_1);
-                ILI9341GetStringSize(SONG_ARTIST, &font_19, &width, &height);
-                ILI9341DrawString(120-width/2, 75, SONG_ARTIST, &font_19, COLOR_MAIN_2, COLOR_BG_1);
+                char * name = streaming ? STREAM_NAME : SONG_NAME;
+                ILI9341GetStringSize(name, &font_22, &width, &height);
+                ILI9341DrawString(120-width/2, 45, name, &font_22, COLOR_MAIN_1, COLOR_BG_1);
+                if(!streaming){
+                    ILI9341GetStringSize(SONG_ARTIST, &font_19, &width, &height);
+                    ILI9341DrawString(120-width/2, 75, SONG_ARTIST, &font_19, COLOR_MAIN_2, COLOR_BG_1);
+                }
                 ILI9341DrawIcon(105, 255, ICON_PAUSE, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
             }
             /* Vúmetro */
-            Song2Bars(&song[song_index-CHUNK], bars);
+            Song2Bars(&played[(end - CHUNK) % PLAYED_LENGHT], bars);
             VumeterUpdate(vum, bars);
             /* Progress bar */
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
-            progress_bar_index++;
+            if(!streaming){
+                progress_bar_index++;
+            }else{
+                /* Nivel del jitter buffer y errores del enlace */
+                jitter_buffer_stats_t stats;
+                JitterBufferGetStats(&stream, &stats);
+                ILI9341DrawFilledRectangle(20, 220, 220, 226, COLOR_BG_1);
+                ILI9341DrawRectangle(20, 220, 220, 226, COLOR_MAIN_1);
+                progress_bar_index = (uint32_t)stats.level * progress_bar / STREAM_LENGHT;
+                snprintf(stream_info, sizeof(stream_info), "Under: %lu  Over: %lu",
+                    (unsigned long)stats.underruns, (unsigned long)stats.overruns);
+                ILI9341DrawFilledRectangle(0, 75, 240, 100, COLOR_BG_1);
+                ILI9341GetStringSize(stream_info, &font_19, &width, &height);
+                ILI9341DrawString(120-width/2, 75, stream_info, &font_19, COLOR_MAIN_2, COLOR_BG_1);
+            }
             ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_MAIN_2);
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_MAIN_3);
         }else{
+            if(song_end){
+                /* TimerStop no puede llamarse desde la interrupción del timer */
+                TimerStop(TIMER_B);
+                song_end = false;
+            }
             /* Resetear pantalla */
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
             ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_BG_1);
@@ -187,14 +340,33 @@ void app_main(void){
     timer_config_t timer_senial = {
         .timer = TIMER_B,
         .period = T_SENIAL,
-        .func_p = FuncTimerSenial,
-        .param_p = NULL
+        .func_p = NULL,
+        .param_p = NULL,
+        .yield_func_p = FuncTimerSenial
     };
     TimerInit(&timer_senial);
     /* DAC */
     AnalogOutputInit();
     /* FFT */
     FFTInit();
+    /* LEDs reactivos al audio */
+    audio_reactive_config_t led_config = {
+        .sample_frec = SAMPLE_FREQ,
+        .frame_lenght = LED_FRAME,
+        .hop_lenght = LED_HOP,
+        .n_bands = LED_BANDS,
+        .min_frec = 60,
+        .max_frec = SAMPLE_FREQ / 2,
+        .attack_ms = 0,
+        .release_ms = 150,
+        .range_db = 30,
+        .min_peak = 1e-3f,
+        .palette = led_palette,
+    };
+    NeoPixelInit(LED_PIN, LED_COUNT, led_colors);
+    NeoPixelAllOff();
+    AudioReactiveInit(&leds, &led_config);
+    STFTInit(&stft, LED_FRAME, LED_HOP, FFT_WINDOW_HANN, stft_buffer, LedFrame, NULL);
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
@@ -238,12 +410,34 @@ void app_main(void){
     ILI9341DrawCircle(215, 270, 19, COLOR_MAIN_2);
     ILI9341DrawCircle(215, 270, 18, COLOR_MAIN_2);
 
+    /* Audio recibido por UART */
+    jitter_buffer_config_t stream_config = {
+        .storage = stream_storage,
+        .elem_size = sizeof(uint8_t),
+        .elem_num = STREAM_LENGHT,
+        .start_level = STREAM_LENGHT / 8,
+        .window = SAMPLE_FREQ,
+    };
+    JitterBufferInit(&stream, &stream_config);
+    serial_config_t stream_port = {
+        .port = STREAM_PORT,
+        .baud_rate = STREAM_BAUD,
+        .func_p = UART_NO_INT,
+        .param_p = NULL,
+        .rx_buffer_size = 4096,
+        .rx_func_p = StreamRx,
+        .rx_pattern = UART_NO_PATTERN,
+    };
+    UartInit(&stream_port);
+
     /* Teclas */
     SwitchesInit();
     SwitchActivInt(SWITCH_1, FuncSwitchStart, NULL);
+    SwitchActivInt(SWITCH_2, FuncSwitchStream, NULL);
     
     /* Tarea para actualizar pantalla */
     xTaskCreate(&PlotTask, "Plot", 32768, &v, 5, &plot_task_handle);
+    xTaskCreate(&LedTask, "LEDs", 4096, NULL, 4, &led_task_handle);
 }
 
 /*==================[end of file]============================================*/
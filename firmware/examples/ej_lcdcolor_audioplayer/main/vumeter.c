@@ -27,12 +27,38 @@
 /*==================[internal data declaration]==============================*/
 static uint16_t bars_width, bars_dist, bars_gap;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Color of a step of a bar
+ */
+static uint16_t VumeterStepColor(vumeter_t * vum, uint8_t step);
+
+/**
+ * @brief Fill the steps from first to last of a bar with a color (gaps included)
+ */
+static void VumeterSteps(vumeter_t * vum, uint8_t bar, uint8_t first, uint8_t last, uint16_t color);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint16_t VumeterStepColor(vumeter_t * vum, uint8_t step){
+    if(STEP_DIST*step < vum->height*COLOR_TH_1/100){
+        return vum->step_color_1;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_2/100){
+        return vum->step_color_2;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_3/100){
+        return vum->step_color_3;
+    }
+    return vum->step_color_4;
+}
+
+static void VumeterSteps(vumeter_t * vum, uint8_t bar, uint8_t first, uint8_t last, uint16_t color){
+    uint16_t bar_start = vum->x_pos+bar*bars_dist + bars_gap/2;
+    ILI9341DrawFilledRectangle(bar_start, vum->y_pos+vum->height-STEP_DIST*first,
+        bar_start + bars_width, vum->y_pos+vum->height-STEP_DIST*last-STEP_HEIGHT,
+        color);
+}
 
 /*==================[external functions definition]==========================*/
 void VumeterInit(vumeter_t * vum){
@@ -42,32 +68,45 @@ void VumeterInit(vumeter_t * vum){
     bars_width = (vum->width / vum->n_bars) * BAR_WIDTH_PERC / 100;
     bars_dist = (vum->width / vum->n_bars);
     bars_gap = bars_dist - bars_width;
+    for (uint8_t i=0; i<VUMETER_MAX_BARS; i++){
+        vum->steps[i] = 0;
+        vum->peak[i] = 0;
+        vum->hold[i] = 0;
+    }
 }
 
 void VumeterUpdate(vumeter_t * vum, uint8_t * values){
-    uint16_t n_steps, color, step_start, bar_start;
-    for (uint8_t i=0; i<vum->n_bars; i++){
-        /* Delete previous bar */
-        bar_start = vum->x_pos+i*bars_dist + bars_gap/2;
-        ILI9341DrawFilledRectangle(bar_start, vum->y_pos,
-			bar_start + bars_width, vum->y_pos + vum->height,
-			vum->back_color);
-        /* Draw bar's steps */
+    uint8_t n_steps, old_steps, old_peak;
+    for (uint8_t i=0; i<vum->n_bars && i<VUMETER_MAX_BARS; i++){
         n_steps = ((values[i] * vum->height) / BAR_MAX) / STEP_DIST;
-        for(uint8_t j=0; j<n_steps; j++){
-            step_start = vum->y_pos+vum->height-(STEP_DIST)*j;
-            if(STEP_DIST*j < vum->height*COLOR_TH_1/100){
-                color = vum->step_color_1;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_2/100){
-                color = vum->step_color_2;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_3/100){
-                color = vum->step_color_3;
-            }else{
-                color = vum->step_color_4;
+        old_steps = vum->steps[i];
+        /* Peak dot: step above the bar (0: no dot) */
+        old_peak = (vum->peak[i] > old_steps) ? vum->peak[i] : 0;
+        if(n_steps >= vum->peak[i]){
+            vum->peak[i] = n_steps;
+            vum->hold[i] = VUMETER_PEAK_HOLD;
+        } else if(vum->hold[i] > 0){
+            vum->hold[i]--;
+        } else{
+            vum->peak[i]--;
+        }
+        /* Only the steps that change are drawn: a falling bar is erased with one span */
+        if(n_steps < old_steps){
+            VumeterSteps(vum, i, n_steps, old_steps - 1, vum->back_color);
+        }
+        for(uint8_t j=old_steps; j<n_steps; j++){
+            VumeterSteps(vum, i, j, j, VumeterStepColor(vum, j));
+        }
+        vum->steps[i] = n_steps;
+        /* Peak dot moves through the same delta drawing */
+        uint8_t new_peak = (vum->peak[i] > n_steps) ? vum->peak[i] : 0;
+        if(old_peak != new_peak){
+            if(old_peak > 0 && old_peak > n_steps){
+                VumeterSteps(vum, i, old_peak - 1, old_peak - 1, vum->back_color);
+            }
+            if(new_peak > 0){
+                VumeterSteps(vum, i, new_peak - 1, new_peak - 1, VumeterStepColor(vum, new_peak - 1));
             }
-            ILI9341DrawFilledRectangle(bar_start, step_start,
-                bar_start + bars_width, step_start - STEP_HEIGHT,
-                color);
         }
     }
 }
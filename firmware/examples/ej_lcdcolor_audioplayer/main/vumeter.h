@@ -16,12 +16,16 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 12/04/2024 | Document creation		                         						|
+ * | 14/10/2026 | Bars rendered by double buffered strips        						|
+ * | 14/10/2026 | Incremental bars and peak hold dots            						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define VUMETER_MAX_BARS    16      /*!< maximum number of bars */
+#define VUMETER_PEAK_HOLD   8       /*!< updates a peak is held before it falls one step */
 
 /*==================[typedef]================================================*/
 /**
@@ -39,6 +43,9 @@ typedef struct{
     uint16_t step_color_3;		/*!< number of bars */
     uint16_t step_color_4;		/*!< number of bars */
     uint16_t back_color;		/*!< plot background color */
+    uint8_t steps[VUMETER_MAX_BARS];	/*!< steps drawn on each bar */
+    uint8_t peak[VUMETER_MAX_BARS];		/*!< peak of each bar (in steps) */
+    uint8_t hold[VUMETER_MAX_BARS];		/*!< updates left to hold each peak */
 } vumeter_t;
 
 /*==================[external data declaration]==============================*/
@@ -52,7 +59,8 @@ typedef struct{
 void VumeterInit(vumeter_t * vum);
 
 /**
- * @brief 
+ * @brief Update the bars: only the steps that change are drawn or erased, and
+ * each bar's peak is shown as a dot that falls after VUMETER_PEAK_HOLD updates
  * 
  * @param vum       Structure with the plot configuration
  * @param values    height of each vumeter bar (from 0 to 256)
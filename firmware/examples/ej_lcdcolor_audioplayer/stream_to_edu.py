@@ -0,0 +1,47 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 10:00:00 2026
+
+@author: Albano Peñalva
+
+Envía un archivo de audio a la ESP-EDU por UART_PC, como PCM de 8 bits sin
+signo a 8 kSPS, para reproducirlo con la TECLA_2 del ejemplo.
+Uso: python stream_to_edu.py archivo.wav puerto (i.e. COM5 o /dev/ttyUSB0)
+"""
+
+# Librerías
+import sys
+import time
+from scipy import signal
+from scipy.io import wavfile
+import numpy as np
+import serial
+
+# %% Lectura del archivo de audio
+filename = sys.argv[1]                  # nombre de archivo
+port = sys.argv[2]                      # puerto serie
+fs, data = wavfile.read(filename)       # frecuencia de muestreo y datos de la señal
+if data.ndim > 1:
+    data = data[:, 0]                   # se extrae un canal de la pista de audio (si el audio es estereo)
+
+# Submuestreo
+F_SUB = 8000
+senial_submuest = signal.resample(data, int(len(data) * F_SUB / fs))
+
+# Escalado (para DAC de 8 bits)
+senial_esc = senial_submuest / np.max(np.abs(senial_submuest))
+senial_esc = (senial_esc * 127 + 128).astype(np.uint8)
+
+# %% Envío
+# Bloques de 50 ms, al ritmo de reproducción: el jitter buffer de la placa
+# absorbe las demoras del envío y de la USB
+BAUD = 921600
+BLOCK = F_SUB // 20
+with serial.Serial(port, BAUD) as uart:
+    start = time.monotonic()
+    for i in range(0, len(senial_esc), BLOCK):
+        uart.write(senial_esc[i:i + BLOCK].tobytes())
+        # esperar hasta el momento del próximo bloque
+        delay = start + (i + BLOCK) / F_SUB - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
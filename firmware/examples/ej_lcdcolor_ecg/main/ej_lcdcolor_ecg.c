@@ -7,6 +7,10 @@
  * graficar una señal temporal. Emula la interfaz del Monito de 
  * ECG Portable BeC: [bececg.com](https://bececg.com/).
  * También se ejemplifica el uso del reloj de tiempo real (RTC).
+ * El encabezado se dibuja en canvas (buffers en RAM) que se envían al
+ * display por DMA. Se usan dos buffers de franjas: mientras se dibuja una
+ * franja se transfiere la anterior. La hora y la frecuencia cardíaca son
+ * widgets de texto: solo se redibujan los caracteres que cambian.
  * 
  * @section hardConn Hardware Connection
  *
@@ -27,6 +31,12 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 05/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Header and bpm drawn on RAM canvases           |
+ * | 14/10/2026 | Double buffered strips for header and bpm      |
+ * | 14/10/2026 | Heart picture RLE compressed                   |
+ * | 14/10/2026 | Timer notifies PlotTask directly               |
+ * | 15/10/2026 | Heart rate from the QRS detector               |
+ * | 15/10/2026 | Clock and bpm as change detecting text widgets |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -36,9 +46,11 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
 #include "sys/time.h"
 
 #include "iir_filter.h"
+#include "qrs_detector.h"
 #include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
@@ -48,6 +60,8 @@
 
 #include "switch.h"
 #include "ili9341.h"
+#include "ili9341_canvas.h"
+#include "ili9341_text.h"
 #include "roll_plot.h"
 #include "heart_pic.h"
 /*==================[macros and definitions]=================================*/
@@ -56,6 +70,11 @@
 #define T_SENIAL            4000 
 #define CHUNK               16 
 #define LIGHT_BLUE_COLOR    0x0B2F
+#define HEADER_HEIGHT       41
+#define BPM_X               20
+#define BPM_Y               60
+#define TEXT_PERIOD         250
+#define STRIP_PIXELS        (ILI9341_WIDTH * 14)
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -81,14 +100,35 @@ float ecg[] = {
 };
 static float ecg_filt[CHUNK];
 TaskHandle_t plot_task_handle = NULL;
-uint8_t frecuencia_cardiaca = 71;
+uint8_t frecuencia_cardiaca = 0;
+static qrs_detector_t qrs;
+static uint16_t strip_buffer[2][STRIP_PIXELS];
+static ili9341_strips_t strips = {{strip_buffer[0], strip_buffer[1]}, STRIP_PIXELS};
+static ili9341_text_t clock_text = {
+    .x = 10, .y = 8, .font = &font_30,
+    .foreground = ILI9341_WHITE, .background = LIGHT_BLUE_COLOR, .period = TEXT_PERIOD
+};
+static ili9341_text_t bpm_text = {
+    .x = BPM_X, .y = BPM_Y, .font = &font_89,
+    .foreground = LIGHT_BLUE_COLOR, .background = ILI9341_WHITE, .period = TEXT_PERIOD
+};
 /*==================[internal functions declaration]=========================*/
 /**
- * @brief Función ejecutada en la interrupción del Timer
+ * @brief Dibuja el fondo del encabezado (íconos) en una franja
  * 
  */
-void FuncTimerSenial(void* param){
-    xTaskNotifyGive(plot_task_handle);
+static void RenderHeader(ili9341_canvas_t * canvas, void * param){
+    ILI9341CanvasFill(canvas, LIGHT_BLUE_COLOR);
+    ILI9341CanvasDrawIcon(canvas, 170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    ILI9341CanvasDrawIcon(canvas, 200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+}
+
+/**
+ * @brief Dibuja el fondo del encabezado por franjas
+ * 
+ */
+static void DrawHeader(void){
+    ILI9341CanvasRender(&strips, 0, 0, ILI9341_WIDTH, HEADER_HEIGHT, RenderHeader, NULL);
 }
 
 /**
@@ -100,7 +140,7 @@ static void PlotTask(void *pvParameter){
     static uint8_t indice = 0;
     static char freq[] = "000";
     static char hour_min[] = "00:00";
-    static bool beat = true;
+    static bool beat = false;
     rtc_t actual_time;
 
     /* Configuración de área de gráfica */
@@ -130,6 +170,12 @@ static void PlotTask(void *pvParameter){
         HiPassFilter(&ecg[indice], ecg_filt, CHUNK);
         LowPassFilter(ecg_filt, ecg_filt, CHUNK);
 
+        /* Detección de latidos */
+        if(QRSDetectorProcess(&qrs, ecg_filt, CHUNK, NULL, 0) > 0){
+            beat = true;
+            frecuencia_cardiaca = (uint8_t)lrintf(QRSDetectorHeartRate(&qrs));
+        }
+
         /* Graficación de señal */
         for(uint8_t i=0; i<CHUNK; i++){
             RTPlotDraw(&ecg1, ecg_filt[i]);
@@ -138,19 +184,17 @@ static void PlotTask(void *pvParameter){
 
         if(indice == 0){
             /* Actualización de datos en display */
-            ILI9341DrawString(20, 60, freq, &font_89, ILI9341_WHITE, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, LIGHT_BLUE_COLOR, LIGHT_BLUE_COLOR);
             sprintf(freq, "%03i", frecuencia_cardiaca);
             RtcRead(&actual_time);
             sprintf(hour_min, "%02i:%02i", actual_time.hour%MAX_HOUR, actual_time.min%MAX_MIN);
-            ILI9341DrawString(20, 60, freq, &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+            ILI9341TextSet(&bpm_text, freq);
+            ILI9341TextSet(&clock_text, hour_min);
             if(beat){
-                ILI9341DrawPicture(170, 65, HEART_WIDTH, HEART_HEIGHT, heart);
+                ILI9341DrawPictureRLE(170, 65, HEART_WIDTH, HEART_HEIGHT, heart_rle);
             }else{
                 ILI9341DrawFilledRectangle(170, 65, 170+HEART_WIDTH, 65+HEART_HEIGHT, ILI9341_WHITE);
             }
-            beat = !beat;
+            beat = false;
         }
     }
 }
@@ -160,7 +204,7 @@ void app_main(void){
     timer_config_t timer_senial = {
         .timer = TIMER_B,
         .period = T_SENIAL*CHUNK,
-        .func_p = FuncTimerSenial,
+        .func_p = NULL,
         .param_p = NULL
     };
     TimerInit(&timer_senial);
@@ -169,21 +213,34 @@ void app_main(void){
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
 	ILI9341Rotate(ILI9341_Portrait_2);
 	ILI9341Fill(ILI9341_WHITE);
-    ILI9341DrawFilledRectangle(0, 0, 240, 40, LIGHT_BLUE_COLOR);
     ILI9341DrawFilledRectangle(0, 280, 240, 320, LIGHT_BLUE_COLOR);
     ILI9341DrawString(10, 290, "TIME10S", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
     ILI9341DrawString(178, 290, "00:04", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
     ILI9341DrawString(178, 120, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawString(20, 60, "000", &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawIcon(170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawIcon(200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    /* Encabezado por franjas, hora y frecuencia cardíaca como widgets de texto */
+    DrawHeader();
+    ILI9341TextInit(&clock_text);
+    ILI9341TextInit(&bpm_text);
+    ILI9341TextSet(&clock_text, "00:00");
+    ILI9341TextSet(&bpm_text, "000");
 
     /* Filtros */
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
 
+    /* Detector de QRS */
+    qrs_detector_config_t qrs_config = {
+        .sample_frec = SAMPLE_FREQ,
+        .window_time = 150,
+        .refractory_time = 200,
+        .learn_time = 2000
+    };
+    QRSDetectorInit(&qrs, &qrs_config);
+
     /* Tarea para actualizar pantalla */
     xTaskCreate(&PlotTask, "Plot", 4096, NULL, 5, &plot_task_handle);
+    /* El timer notifica a la tarea directamente desde su interrupción */
+    TimerNotifyTask(timer_senial.timer, plot_task_handle);
 
     /* Configuración inicial de RTC */
     // rtc_t config_time = {
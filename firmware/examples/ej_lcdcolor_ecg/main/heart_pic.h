@@ -3,6 +3,7 @@
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  * @brief Picture of a heart
  * @note Created with http://www.digole.com/tools/PicturetoC_Hex_converter.php: "65K Color (2 bytes/pixel)"
+ * and compressed with picture_to_rle.py (4680 to 731 bytes), draw it with ILI9341DrawPictureRLE
  * @version 0.1
  * @date 2024-04-07
  * 
@@ -14,50 +15,51 @@
 #define HEART_WIDTH     52
 #define HEART_HEIGHT    45
 
-const uint8_t heart[] = {
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xed,0x55,0xe3,0x6d,0xda,0x28,0xd9,0x66,0xd1,0x65,0xd9,0xc7,0xda,0xcb,0xe4,0x71,0xf6,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x1c,0xec,0xb2,0xdb,0x0c,0xd9,0xe7,0xd1,0x65,0xd1,0x65,0xda,0x08,0xe3,0x2c,0xed,0x14,0xff,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x1c,0xe3,0x4d,0xd0,0x61,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xf6,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xfb,0xda,0xcb,0xd0,0x20,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xda,0xcb,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xb2,0xd0,0x61,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x21,0xe4,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x14,0xd0,0x62,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xe3,0xcf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xdb,0x0c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x0c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x10,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x4d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x51,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xd3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0xb2,0xff,0xff,0xff,0xff,0xed,0xb6,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xce,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0x3c,0xd0,0x82,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0xba,0xff,0x5d,0xd0,0xa3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xf6,0x79,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xe3,0xaf,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x8a,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xdf,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xff,0x3c,0xff,0xff
-    ,0xff,0xff,0xee,0x18,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xec,0xf3,0xff,0xff
-    ,0xff,0xff,0xe4,0x51,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x2c,0xff,0xff
-    ,0xff,0xff,0xe3,0x4d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xff,0xff
-    ,0xff,0xff,0xda,0xcb,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xa7,0xff,0xff
-    ,0xff,0xff,0xda,0xcb,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xc7,0xff,0xff
-    ,0xff,0xff,0xe3,0x8e,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x69,0xff,0xff
-    ,0xff,0xff,0xec,0xb2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x8e,0xff,0xff
-    ,0xff,0xff,0xf6,0x79,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x55,0xff,0xff
-    ,0xff,0xff,0xff,0xdf,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xff,0x5d,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xe3,0x6d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xf6,0x99,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x75,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0x49,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0x45,0xff,0xdf,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x79,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x75,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x76,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x71,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x4d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xd1,0xa6,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0xe3,0xff,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xfc,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x38,0xd0,0x41,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x75,0xd0,0x20,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x71,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xf3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x92,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x92,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xd3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x55,0xd0,0x41,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x51,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0xf7,0xd0,0x82,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xed,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x9a,0xd1,0x24,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0xa2,0xf6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xda,0x28,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0x85,0xf6,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xe3,0xae,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0xeb,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x96,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x61,0xec,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xda,0x69,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xc7,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x14,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x61,0xe4,0x51,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xe3,0x8e,0xda,0xeb,0xf7,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-};
\ No newline at end of file
+const uint8_t heart_rle[] = {
+    0xbc,0xff,0xff,0x09,0xff,0x9d,0xed,0x55,0xe3,0x6d,0xda,0x28,0xd9,0x66,0xd1,0x65,
+    0xd9,0xc7,0xda,0xcb,0xe4,0x71,0xf6,0xdb,0x8d,0xff,0xff,0x09,0xf7,0x1c,0xec,0xb2,
+    0xdb,0x0c,0xd9,0xe7,0xd1,0x65,0xd1,0x65,0xda,0x08,0xe3,0x2c,0xed,0x14,0xff,0x5d,
+    0x8f,0xff,0xff,0x02,0xf7,0x1c,0xe3,0x4d,0xd0,0x61,0x88,0xd0,0x00,0x01,0xda,0x49,
+    0xf6,0x99,0x89,0xff,0xff,0x02,0xf6,0xfb,0xda,0xcb,0xd0,0x20,0x87,0xd0,0x00,0x02,
+    0xd0,0x41,0xda,0xcb,0xf6,0xba,0x8c,0xff,0xff,0x01,0xec,0xb2,0xd0,0x61,0x8b,0xd0,
+    0x00,0x01,0xd0,0x21,0xe4,0x31,0x87,0xff,0xff,0x01,0xed,0x14,0xd0,0x62,0x8b,0xd0,
+    0x00,0x02,0xd0,0x20,0xe3,0xcf,0xff,0xdf,0x88,0xff,0xff,0x01,0xff,0xdf,0xdb,0x0c,
+    0x8f,0xd0,0x00,0x01,0xdb,0x0c,0xff,0xdf,0x84,0xff,0xff,0x00,0xe4,0x10,0x8f,0xd0,
+    0x00,0x01,0xda,0x49,0xff,0x9e,0x87,0xff,0xff,0x00,0xdb,0x2c,0x91,0xd0,0x00,0x00,
+    0xdb,0x4d,0x83,0xff,0xff,0x00,0xe4,0x51,0x91,0xd0,0x00,0x01,0xda,0x28,0xff,0xde,
+    0x85,0xff,0xff,0x00,0xec,0xd3,0x93,0xd0,0x00,0x03,0xe4,0xb2,0xff,0xff,0xff,0xff,
+    0xed,0xb6,0x93,0xd0,0x00,0x00,0xe3,0xce,0x84,0xff,0xff,0x01,0xff,0x3c,0xd0,0x82,
+    0x93,0xd0,0x00,0x03,0xd0,0x41,0xf6,0xba,0xff,0x5d,0xd0,0xa3,0x93,0xd0,0x00,0x01,
+    0xd0,0x20,0xf6,0x79,0x83,0xff,0xff,0x00,0xe3,0xaf,0x95,0xd0,0x00,0x01,0xda,0x28,
+    0xdb,0x2c,0x95,0xd0,0x00,0x00,0xda,0x8a,0x82,0xff,0xff,0x01,0xff,0xdf,0xd0,0xa2,
+    0xad,0xd0,0x00,0x04,0xd0,0x20,0xff,0x3c,0xff,0xff,0xff,0xff,0xee,0x18,0xaf,0xd0,
+    0x00,0x03,0xec,0xf3,0xff,0xff,0xff,0xff,0xe4,0x51,0xaf,0xd0,0x00,0x03,0xe3,0x2c,
+    0xff,0xff,0xff,0xff,0xe3,0x4d,0xaf,0xd0,0x00,0x03,0xda,0x28,0xff,0xff,0xff,0xff,
+    0xda,0xcb,0xaf,0xd0,0x00,0x03,0xd1,0xa7,0xff,0xff,0xff,0xff,0xda,0xcb,0xaf,0xd0,
+    0x00,0x03,0xd1,0xc7,0xff,0xff,0xff,0xff,0xe3,0x8e,0xaf,0xd0,0x00,0x03,0xda,0x69,
+    0xff,0xff,0xff,0xff,0xec,0xb2,0xaf,0xd0,0x00,0x03,0xe3,0x8e,0xff,0xff,0xff,0xff,
+    0xf6,0x79,0xaf,0xd0,0x00,0x04,0xed,0x55,0xff,0xff,0xff,0xff,0xff,0xdf,0xd0,0xc3,
+    0xad,0xd0,0x00,0x01,0xd0,0x20,0xff,0x5d,0x82,0xff,0xff,0x00,0xe3,0x6d,0xad,0xd0,
+    0x00,0x00,0xda,0x49,0x83,0xff,0xff,0x00,0xf6,0x99,0xad,0xd0,0x00,0x00,0xed,0x75,
+    0x84,0xff,0xff,0x00,0xda,0x49,0xab,0xd0,0x00,0x01,0xd1,0x45,0xff,0xdf,0x84,0xff,
+    0xff,0x00,0xf6,0x79,0xab,0xd0,0x00,0x00,0xed,0x75,0x86,0xff,0xff,0x00,0xdb,0x2c,
+    0xa9,0xd0,0x00,0x00,0xda,0x08,0x87,0xff,0xff,0x01,0xff,0x5d,0xd0,0xc3,0xa7,0xd0,
+    0x00,0x01,0xd0,0x41,0xf6,0xba,0x88,0xff,0xff,0x00,0xed,0x76,0xa7,0xd0,0x00,0x00,
+    0xe4,0x71,0x8a,0xff,0xff,0x00,0xdb,0x4d,0xa5,0xd0,0x00,0x01,0xda,0x49,0xff,0xdf,
+    0x8a,0xff,0xff,0x01,0xff,0xbe,0xd1,0xa6,0xa3,0xd0,0x00,0x01,0xd0,0xe3,0xff,0x5c,
+    0x8c,0xff,0xff,0x01,0xf6,0xfc,0xd0,0xc3,0xa1,0xd0,0x00,0x01,0xd0,0x41,0xf6,0x59,
+    0x8e,0xff,0xff,0x01,0xf6,0x38,0xd0,0x41,0xa0,0xd0,0x00,0x00,0xed,0x55,0x90,0xff,
+    0xff,0x01,0xed,0x75,0xd0,0x20,0x9e,0xd0,0x00,0x00,0xe4,0x71,0x92,0xff,0xff,0x00,
+    0xec,0xf3,0x9d,0xd0,0x00,0x00,0xe3,0xcf,0x94,0xff,0xff,0x00,0xe4,0x92,0x9b,0xd0,
+    0x00,0x00,0xdb,0x8e,0x96,0xff,0xff,0x00,0xe4,0x92,0x99,0xd0,0x00,0x00,0xe3,0x8e,
+    0x98,0xff,0xff,0x00,0xec,0xd3,0x97,0xd0,0x00,0x00,0xe3,0xcf,0x9a,0xff,0xff,0x01,
+    0xed,0x55,0xd0,0x41,0x94,0xd0,0x00,0x00,0xe4,0x51,0x9c,0xff,0xff,0x01,0xed,0xf7,
+    0xd0,0x82,0x91,0xd0,0x00,0x01,0xd0,0x41,0xed,0x14,0x9e,0xff,0xff,0x01,0xf6,0x9a,
+    0xd1,0x24,0x8f,0xd0,0x00,0x01,0xd0,0xa2,0xf6,0x17,0xa0,0xff,0xff,0x01,0xff,0x5d,
+    0xda,0x28,0x8d,0xd0,0x00,0x01,0xd1,0x85,0xf6,0xfb,0xa2,0xff,0xff,0x01,0xff,0xdf,
+    0xe3,0xae,0x8b,0xd0,0x00,0x01,0xda,0xeb,0xff,0x9e,0xa5,0xff,0xff,0x01,0xed,0x96,
+    0xd0,0xa2,0x87,0xd0,0x00,0x01,0xd0,0x61,0xec,0xd3,0xa8,0xff,0xff,0x01,0xff,0x3c,
+    0xda,0x69,0x85,0xd0,0x00,0x01,0xd1,0xc7,0xf6,0xba,0xab,0xff,0xff,0x06,0xed,0x14,
+    0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x61,0xe4,0x51,0xff,0xdf,0xad,0xff,0xff,0x03,
+    0xff,0x7d,0xe3,0x8e,0xda,0xeb,0xf7,0x1b,0xcb,0xff,0xff,
+};
@@ -12,17 +12,58 @@
 /*==================[inclusions]=============================================*/
 #include "roll_plot.h"
 #include "ili9341.h"
+#include "ili9341_canvas.h"
 /*==================[macros and definitions]=================================*/
+#define COLUMN_PIXELS   (2 * ILI9341_HEIGHT)    /* column drawn and blank column ahead of it */
 
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Write a column of the plot with the trace of each signal between its y_min and y_max
+ */
+static void RTPlotColumn(signal_t ** signals, uint8_t n, uint16_t column);
+
+/**
+ * @brief Position in the plot of a data value of a signal (clipped to the plot limits)
+ */
+static int16_t RTPlotY(signal_t * signal, int16_t data);
 
 /*==================[internal data definition]===============================*/
+/* Two buffers: a column is drawn while the previous one is written by DMA */
+static uint16_t column_buffer[2][COLUMN_PIXELS];
+static uint8_t column_index = 0;
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void RTPlotColumn(signal_t ** signals, uint8_t n, uint16_t column){
+    ili9341_canvas_t canvas;
+    plot_t * plot = signals[0]->plot;
+    /* the column ahead is cleared, except at the right limit */
+    uint16_t width = (column + 1 < plot->x_pos + plot->width) ? 2 : 1;
+    ILI9341CanvasInit(&canvas, column, plot->y_pos, width, plot->height + 1, column_buffer[column_index]);
+    ILI9341CanvasFill(&canvas, plot->back_color);
+    /* every trace in the same buffer: one window per column whatever the number of traces */
+    for (uint8_t i = 0; i < n; i++){
+        ILI9341CanvasDrawFilledRectangle(&canvas, column, signals[i]->y_min, column, signals[i]->y_max, signals[i]->color);
+    }
+    ILI9341DrawWindowStart(column, plot->y_pos, width, plot->height + 1, canvas.buffer);
+    column_index ^= 1;
+}
+
+static int16_t RTPlotY(signal_t * signal, int16_t data){
+    plot_t * plot = signal->plot;
+    int16_t y = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
+    /* it can exceed plot limits */
+    if (y < plot->y_pos){
+        y = plot->y_pos;
+    }
+    if (y > (plot->y_pos + plot->height)){
+        y = plot->y_pos + plot->height;
+    }
+    return y;
+}
 
 /*==================[external functions definition]==========================*/
 void RTPlotInit(plot_t * plot){
@@ -35,44 +76,72 @@ void RTPlotInit(plot_t * plot){
 void RTSignalInit(plot_t * plot, signal_t * signal){
 	signal->x_prev = plot->x_pos * 100;
 	signal->y_prev = plot->y_pos + plot->height - signal->y_offset;
+	signal->y_min = signal->y_prev;
+	signal->y_max = signal->y_prev;
 	signal->plot = plot;
 }
 
 void RTPlotDraw(signal_t * signal, int16_t data){
-    int16_t x_act, y_act, blanck_act;
-    plot_t * plot = signal->plot;
-    /* next point to draw */
-    y_act = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
-    /* it can exceed plot limits */
-    if (y_act < plot->y_pos){
-        y_act = plot->y_pos;
+    RTPlotDrawTraces(&signal, &data, 1);
+}
+
+void RTPlotDrawTraces(signal_t ** signals, const int16_t * data, uint8_t n){
+    int16_t x_act, col_prev, col_act, y_col;
+    int16_t y_act[RTPLOT_MAX_TRACES], y_from[RTPLOT_MAX_TRACES];
+    plot_t * plot = signals[0]->plot;
+    bool grow = false;
+    if (n > RTPLOT_MAX_TRACES){
+        n = RTPLOT_MAX_TRACES;
     }
-    if (y_act > (plot->y_pos + plot->height)){
-        y_act = plot->y_pos + plot->height;
+    /* next point of each trace, all of them advance together */
+    for (uint8_t i = 0; i < n; i++){
+        y_act[i] = RTPlotY(signals[i], data[i]);
     }
-    /* when reach right limit it start again from left */
-    x_act = signal->x_prev + plot->x_scale;
-    if ((x_act / 100) < (plot->x_pos + plot->width)){
-        ILI9341DrawLine(signal->x_prev / 100, signal->y_prev, x_act / 100, y_act, signal->color);
-    } else{
+    x_act = signals[0]->x_prev + plot->x_scale;
+    col_prev = signals[0]->x_prev / 100;
+    col_act = x_act / 100;
+    if (col_act >= (plot->x_pos + plot->width)){
+        /* when reach right limit it start again from left */
         x_act = plot->x_pos * 100;
-    }
-    /* to erase previous plot*/
-    if (plot->x_scale >= 100){
-        blanck_act = x_act + plot->x_scale;
-    } else {
-        blanck_act = x_act + 100;
-    }
-    if ((blanck_act / 100) < (plot->x_pos + plot->width)){
-        ILI9341DrawFilledRectangle((x_act / 100) + 1, plot->y_pos, blanck_act / 100,
-        plot->y_pos + plot->height, plot->back_color);
+        for (uint8_t i = 0; i < n; i++){
+            signals[i]->y_min = y_act[i];
+            signals[i]->y_max = y_act[i];
+        }
+        RTPlotColumn(signals, n, plot->x_pos);
+    } else if (col_act == col_prev){
+        /* same column: it's written again only if a trace grows */
+        for (uint8_t i = 0; i < n; i++){
+            if (y_act[i] < signals[i]->y_min){
+                signals[i]->y_min = y_act[i];
+                grow = true;
+            } else if (y_act[i] > signals[i]->y_max){
+                signals[i]->y_max = y_act[i];
+                grow = true;
+            }
+        }
+        if (grow){
+            RTPlotColumn(signals, n, col_act);
+        }
     } else{
-        ILI9341DrawFilledRectangle(plot->x_pos, plot->y_pos, plot->x_pos,
-        plot->y_pos + plot->height, plot->back_color);
+        /* the segments from the previous points are split in one vertical span per column */
+        for (uint8_t i = 0; i < n; i++){
+            y_from[i] = signals[i]->y_prev;
+        }
+        for (int16_t col = col_prev + 1; col <= col_act; col++){
+            for (uint8_t i = 0; i < n; i++){
+                y_col = signals[i]->y_prev + (y_act[i] - signals[i]->y_prev) * (col - col_prev) / (col_act - col_prev);
+                signals[i]->y_min = (y_from[i] < y_col) ? y_from[i] : y_col;
+                signals[i]->y_max = (y_from[i] < y_col) ? y_col : y_from[i];
+                y_from[i] = y_col;
+            }
+            RTPlotColumn(signals, n, col);
+        }
+    }
+    /* Update previously drawn points */
+    for (uint8_t i = 0; i < n; i++){
+        signals[i]->x_prev = x_act;
+        signals[i]->y_prev = y_act[i];
     }
-    /* Update previously drawn point */
-    signal->x_prev = x_act;
-    signal->y_prev = y_act;
 }
 
 /*==================[end of file]============================================*/
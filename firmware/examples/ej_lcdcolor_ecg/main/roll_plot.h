@@ -10,6 +10,13 @@
 
 /** \brief Contains functions to create plots in a color LCD display.
  *
+ * The trace is swept from left to right: each sample rewrites its column (and
+ * clears the next one) with a single narrow window transfer.
+ * 
+ * Several signals of the same plot (i.e. red and IR PPG, or raw and filtered ECG)
+ * are drawn together with RTPlotDrawTraces: the spans of every trace are rendered
+ * in the same column buffer and written in one transfer, so the SPI traffic per
+ * sample doesn't depend on the number of traces.
  * 
  * @author Albano Peñalva
  *
@@ -18,12 +25,16 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 04/04/2024 | Document creation		                         						|
+ * | 14/10/2026 | One column window per sample instead of line and erase writes		|
+ * | 15/10/2026 | Several traces rendered in the same column window					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define RTPLOT_MAX_TRACES   4   /*!< Max signals drawn together by RTPlotDrawTraces */
 
 /*==================[typedef]================================================*/
 /**
@@ -49,6 +60,8 @@ typedef struct{
 	uint16_t color;		/*!< plot color */
 	uint16_t x_prev;	/*!< x position of last point drawn */
 	uint16_t y_prev;	/*!< y position of last point drawn */
+	uint16_t y_min;		/*!< top of the trace in the current column */
+	uint16_t y_max;		/*!< bottom of the trace in the current column */
 	plot_t * plot;		/*!< plot in which the signal'll be drawn */
 } signal_t;
 
@@ -81,6 +94,16 @@ void RTSignalInit(plot_t * plot, signal_t * signal);
  */
 void RTPlotDraw(signal_t * signal, int16_t data);
 
+/**
+ * @brief		Draw the next sample of several signals of the same plot in one column pass
+ * @param[in]  	signals: Signals (initialized with RTSignalInit on the same plot, drawn
+ * 				always together; later ones are drawn over the previous ones)
+ * @param[in]	data: Data value of each signal
+ * @param[in]	n: Number of signals (up to RTPLOT_MAX_TRACES)
+ * @return  	None
+ */
+void RTPlotDrawTraces(signal_t ** signals, const int16_t * data, uint8_t n);
+
 #endif /* ROLL_PLOT_H_ */
 
 /*==================[end of file]============================================*/
@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+"""
+Compresión RLE de imágenes RGB565 para ILI9341DrawPictureRLE.
+
+Lee un header C con un arreglo de bytes RGB565 (2 bytes/pixel, byte alto
+primero, como los generados con el conversor de digole para
+ILI9341DrawPicture) y escribe el arreglo comprimido en otro header.
+
+Formato: secuencia de paquetes. Byte de cabecera con bit 7 en 1: repetición
+de (cabecera & 0x7F) + 1 pixels del color que sigue (2 bytes). Bit 7 en 0:
+siguen cabecera + 1 pixels literales (2 bytes cada uno).
+
+Uso: python picture_to_rle.py entrada.h salida.h nombre
+
+@author: Albano Peñalva
+"""
+
+# Librerías
+import re
+import sys
+
+MAX_PACKET = 128    # pixels por paquete (7 bits + 1)
+
+
+def rle_encode(pixels):
+    """Codifica una lista de pixels (enteros de 16 bits) en paquetes RLE."""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend([p >> 8, p & 0xFF])
+
+    i = 0
+    while i < len(pixels):
+        # largo de la repetición que empieza en i
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == pixels[i] and n < MAX_PACKET:
+            n += 1
+        # repeticiones de 2 pixels no ahorran bytes frente a literales
+        if n >= 3:
+            flush_literal()
+            out.append(0x80 | (n - 1))
+            out += bytes([pixels[i] >> 8, pixels[i] & 0xFF])
+        else:
+            literal.extend(pixels[i:i + n])
+        i += n
+    flush_literal()
+    return out
+
+
+def rle_decode(data, n_pixels):
+    """Decodifica paquetes RLE (para verificar la compresión)."""
+    pixels = []
+    i = 0
+    while len(pixels) < n_pixels:
+        head = data[i]
+        i += 1
+        count = (head & 0x7F) + 1
+        if head & 0x80:
+            pixels += [(data[i] << 8) | data[i + 1]] * count
+            i += 2
+        else:
+            for _ in range(count):
+                pixels.append((data[i] << 8) | data[i + 1])
+                i += 2
+    return pixels
+
+
+def main():
+    entrada, salida, nombre = sys.argv[1:4]
+    texto = open(entrada, encoding='utf-8').read()
+    # bytes del arreglo (entre llaves)
+    cuerpo = texto[texto.index('{') + 1:texto.rindex('}')]
+    raw = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]{2}', cuerpo)]
+    pixels = [(raw[k] << 8) | raw[k + 1] for k in range(0, len(raw), 2)]
+
+    rle = rle_encode(pixels)
+    assert rle_decode(rle, len(pixels)) == pixels
+
+    with open(salida, 'w', encoding='utf-8') as f:
+        f.write('const uint8_t %s[] = {\n' % nombre)
+        for k in range(0, len(rle), 16):
+            f.write('    ' + ','.join('0x%02x' % b for b in rle[k:k + 16]) + ',\n')
+        f.write('};\n')
+    print('%d bytes -> %d bytes (%.1f %%)' % (len(raw), len(rle), 100 * len(rle) / len(raw)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+Host side of the link benchmark (ej_link_benchmark).
+
+Measures, over BLE (SPP service, requires bleak) or a serial port (UART_PC
+or UART_USB, requires pyserial):
+
+  * sustained throughput: the board sends frames as fast as the link accepts
+    them (--rate 0) or at a fixed rate, for each frame size, connection
+    profile (BLE) or baud rate (UART_PC);
+  * frames lost on the way (gaps in the sequence numbers) and bytes dropped
+    by the TX ring of the board (reported by the board);
+  * round trip latency of short echo messages.
+
+Prints one markdown table row per test:
+
+    python3 link_benchmark.py ble ESP_EDU_BENCH --sizes 20,100,244 --profiles 0,1,2
+    python3 link_benchmark.py serial /dev/ttyUSB0 --bauds 115200,460800,921600
+    python3 link_benchmark.py serial /dev/ttyACM0 --usb
+"""
+
+import argparse
+import asyncio
+import statistics
+import struct
+import sys
+import time
+
+SYNC = b"\xa5\x5a"
+FRAME_HEADER = 4
+SPP_UUID = "0000ffe1-0000-1000-8000-00805f9b34fb"
+PROFILES = ["default", "throughput", "low latency", "low power"]
+
+
+class FrameCounter:
+    """Splits the received bytes in frames of a known size and '#' report lines"""
+
+    def __init__(self, size):
+        self.size = size
+        self.buffer = bytearray()
+        self.frames = 0
+        self.lost = 0
+        self.expected = None
+        self.reports = []
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            if self.buffer[:2] == SYNC:
+                if len(self.buffer) < self.size:
+                    return
+                seq = struct.unpack_from("<H", self.buffer, 2)[0]
+                if self.expected is not None and seq != self.expected:
+                    self.lost += (seq - self.expected) & 0xFFFF
+                self.expected = (seq + 1) & 0xFFFF
+                self.frames += 1
+                del self.buffer[:self.size]
+            elif self.buffer[:1] == b"#":
+                end = self.buffer.find(b"\n")
+                if end < 0:
+                    return
+                self.reports.append(self.buffer[:end].decode(errors="replace"))
+                del self.buffer[:end + 1]
+            else:
+                # Logs of the board or a broken frame: skip to the next frame or report
+                start = [i for i in (self.buffer.find(SYNC, 1), self.buffer.find(b"#", 1)) if i > 0]
+                if not start:
+                    del self.buffer[:max(len(self.buffer) - 1, 0)]
+                    return
+                del self.buffer[:min(start)]
+
+    def report(self, name):
+        """Fields of the last report line starting with name (i.e. '#T')"""
+        for line in reversed(self.reports):
+            if line.startswith(name):
+                return dict(field.split("=") for field in line.split()[1:] if "=" in field)
+        return None
+
+
+def print_header():
+    print("| Enlace | Config | Trama | tramas/s | KB/s | perdidas | descartados | RTT ms (media / p95) |")
+    print("|:-------|:-------|------:|---------:|-----:|---------:|------------:|---------------------:|")
+
+
+def print_row(link, config, size, counter, rtt):
+    report = counter.report("#T") or {}
+    seconds = int(report.get("us", 0)) / 1e6
+    rate = counter.frames / seconds if seconds else 0
+    rtt_text = "%.1f / %.1f" % (statistics.mean(rtt), sorted(rtt)[int(0.95 * (len(rtt) - 1))]) if rtt else "-"
+    print("| %s | %s | %d | %.0f | %.1f | %d | %s | %s |" % (
+        link, config, size, rate, rate * size / 1024, counter.lost, report.get("descartados", "?"), rtt_text))
+
+
+async def ble_run(args):
+    from bleak import BleakClient, BleakScanner
+
+    device = await BleakScanner.find_device_by_name(args.name)
+    if device is None:
+        sys.exit("device %s not found" % args.name)
+    async with BleakClient(device) as client:
+        counter = FrameCounter(FRAME_HEADER)
+        await client.start_notify(SPP_UUID, lambda _, data: counter.feed(bytes(data)))
+
+        async def command(text, reply, timeout=5.0):
+            counter.reports.clear()
+            await client.write_gatt_char(SPP_UUID, text.encode(), response=False)
+            end = time.perf_counter() + timeout
+            while time.perf_counter() < end:
+                if any(line.startswith(reply) for line in counter.reports):
+                    return time.perf_counter()
+                await asyncio.sleep(0.001)
+            return None
+
+        # The board limits the frames to one notification (MTU - 3)
+        await command("S", "#S")
+        payload = int((counter.report("#S") or {}).get("carga", 20))
+        print_header()
+        for profile in args.profiles:
+            await command("P%d" % profile, "#P")
+            # The central answers the new parameters after a few connection events
+            await asyncio.sleep(1.0)
+            rtt = []
+            for i in range(args.pings):
+                start = time.perf_counter()
+                end = await command("E%d" % i, "#E%d" % i)
+                if end is not None:
+                    rtt.append((end - start) * 1000)
+            for size in args.sizes:
+                size = min(max(size, FRAME_HEADER), payload)
+                counter.size = size
+                counter.frames = counter.lost = 0
+                counter.expected = None
+                await command("T%d,%d,%d" % (size, args.time, args.rate), "#T", args.time / 1000 + 10)
+                print_row("BLE", "%s, MTU %d" % (PROFILES[profile], payload + 3), size, counter, rtt)
+
+
+def serial_command(port, counter, text, reply, timeout=5.0):
+    counter.reports.clear()
+    port.write((text + "\n").encode())
+    end = time.perf_counter() + timeout
+    while time.perf_counter() < end:
+        counter.feed(port.read(port.in_waiting or 1))
+        if any(line.startswith(reply) for line in counter.reports):
+            return time.perf_counter()
+    return None
+
+
+def serial_run(args):
+    import serial
+
+    port = serial.Serial(args.port, args.bauds[0], timeout=0.01)
+    link = "UART_USB" if args.usb else "UART_PC"
+    counter = FrameCounter(FRAME_HEADER)
+    print_header()
+    for baud in ([0] if args.usb else args.bauds):
+        if baud:
+            serial_command(port, counter, "B%d" % baud, "#B")
+            port.baudrate = baud
+            time.sleep(0.2)
+            port.reset_input_buffer()
+        rtt = []
+        for i in range(args.pings):
+            start = time.perf_counter()
+            end = serial_command(port, counter, "E%d" % i, "#E%d" % i, 1.0)
+            if end is not None:
+                rtt.append((end - start) * 1000)
+        for size in args.sizes:
+            counter.size = max(size, FRAME_HEADER)
+            counter.frames = counter.lost = 0
+            counter.expected = None
+            serial_command(port, counter, "T%d,%d,%d" % (size, args.time, args.rate), "#T", args.time / 1000 + 10)
+            print_row(link, "%d baud" % baud if baud else "USB", size, counter, rtt)
+    if not args.usb:
+        # Back to the default baud rate for the next run
+        serial_command(port, counter, "B%d" % args.bauds[0], "#B")
+    port.close()
+
+
+def int_list(text):
+    return [int(v) for v in text.split(",")]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="BLE and UART link benchmark")
+    parser.add_argument("--sizes", type=int_list, default=[20, 64, 128, 244], help="frame sizes (bytes)")
+    parser.add_argument("--time", type=int, default=5000, help="duration of each throughput test (ms)")
+    parser.add_argument("--rate", type=int, default=0, help="frames per second (0: as fast as the link accepts)")
+    parser.add_argument("--pings", type=int, default=50, help="echo messages for the latency")
+    links = parser.add_subparsers(dest="link", required=True)
+    ble = links.add_parser("ble", help="BLE notifications (SPP service)")
+    ble.add_argument("name", help="device name (ble_config_t.device_name)")
+    ble.add_argument("--profiles", type=int_list, default=[0, 1, 2], help="ble_profile_t values")
+    uart = links.add_parser("serial", help="UART_PC or UART_USB")
+    uart.add_argument("port", help="serial port (i.e. /dev/ttyUSB0, COM3)")
+    uart.add_argument("--bauds", type=int_list, default=[115200, 230400, 460800, 921600],
+                      help="UART_PC baud rates (the first one is the default of the board)")
+    uart.add_argument("--usb", action="store_true", help="UART_USB port (no baud rate)")
+    args = parser.parse_args()
+    try:
+        if args.link == "ble":
+            asyncio.run(ble_run(args))
+        else:
+            serial_run(args)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
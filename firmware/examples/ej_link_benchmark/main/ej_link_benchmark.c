@@ -0,0 +1,314 @@
+/*! @mainpage Ejemplo Benchmark de enlaces BLE y UART
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto mide la capacidad de los enlaces de comunicación de la placa:
+ * notificaciones BLE (servicio SPP), UART_PC (puente USB-UART) y UART_USB
+ * (USB Serial/JTAG del ESP32-C6). Las pruebas las dirige el script
+ * link_benchmark.py desde la PC, enviando comandos de texto por el mismo
+ * enlace que se mide:
+ *
+ * | Comando                | Acción                                                        |
+ * |:-----------------------|:--------------------------------------------------------------|
+ * | T<tam>,<ms>,<tramas/s> | Envía tramas de <tam> bytes durante <ms> ms (0 tramas/s: tan rápido como el enlace acepta) |
+ * | E<texto>               | Eco: responde "#E<texto>" (latencia de ida y vuelta)          |
+ * | P<perfil>              | Perfil de conexión BLE (ble_profile_t)                        |
+ * | B<baudios>             | Baudrate de UART_PC                                           |
+ * | S                      | Contadores de la cola de transmisión BLE                      |
+ *
+ * Cada trama comienza con 0xA5 0x5A y un número de secuencia de 16 bits
+ * (little endian), seguidos de bytes de relleno. Al terminar la prueba, con la
+ * cola de transmisión vacía, se envía el informe:
+ *
+ * 		#T tramas=<n> bytes=<n> descartados=<n> us=<n> carga=<n>
+ *
+ * donde descartados son los bytes rechazados por la cola de transmisión
+ * (BleWrite o UartWriteAsync llenos) y carga el máximo de bytes por
+ * notificación BLE (MTU - 3). Con tramas/s = 0 la aplicación espera lugar en
+ * la cola antes de cada trama (capacidad del enlace); con una tasa fija mide
+ * si el enlace soporta un formato de telemetría y cuánto se pierde.
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "ble_mcu.h"
+#include "uart_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define CMD_MAX             40          /* Largo máximo de un comando */
+#define CMD_QUEUE_SIZE      4           /* Comandos pendientes */
+#define FRAME_HEADER        4           /* Sincronismo (2 bytes) y secuencia (2 bytes) */
+#define FRAME_MAX           512         /* Tamaño máximo de trama */
+#define BLE_MSG_HEADER      4           /* Bytes que ocupa en la cola BLE la cabecera de cada mensaje */
+#define FRAME_POOL          (2 * UART_TX_QUEUE_SIZE)    /* Tramas en vuelo con UartWriteAsync */
+#define UART_RING_SIZE      4096        /* Colas de transmisión y recepción de las UART */
+#define UART_BAUD_DEFAULT   115200
+#define REPORT_MAX          96
+/*==================[internal data definition]===============================*/
+/**
+ * @brief Enlaces medidos
+ */
+typedef enum {
+    LINK_BLE,
+    LINK_UART_PC,
+    LINK_UART_USB,
+} link_t;
+
+/**
+ * @brief Comando recibido por un enlace
+ */
+typedef struct {
+    link_t link;
+    char text[CMD_MAX + 1];
+} command_t;
+
+static QueueHandle_t command_queue;
+static TaskHandle_t bench_task_handle = NULL;
+/* Cada trama de UartWriteAsync debe seguir válida hasta que el driver la copia */
+static uint8_t frames[FRAME_POOL][FRAME_MAX];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Encola un comando recibido por un enlace (sin '\n' ni '\r' finales).
+ */
+static void CommandPost(link_t link, const uint8_t *data, uint16_t length){
+    command_t command = {.link = link};
+    while(length > 0 && (data[length - 1] == '\n' || data[length - 1] == '\r')){
+        length--;
+    }
+    if(length == 0){
+        return;
+    }
+    if(length > CMD_MAX){
+        length = CMD_MAX;
+    }
+    memcpy(command.text, data, length);
+    command.text[length] = '\0';
+    xQueueSend(command_queue, &command, 0);
+}
+
+static void BleRead(uint8_t *data, uint8_t length){
+    CommandPost(LINK_BLE, data, length);
+}
+
+static void UartRead(uint8_t *data, uint16_t lenght, void *param){
+    CommandPost((link_t)(uintptr_t)param, data, lenght);
+}
+
+static uart_mcu_port_t LinkPort(link_t link){
+    return (link == LINK_UART_USB) ? UART_USB : UART_PC;
+}
+
+/**
+ * @brief Envía un mensaje por un enlace, esperando lugar en su cola de transmisión.
+ */
+static void LinkSend(link_t link, const char *msg, uint16_t nbytes){
+    if(link == LINK_BLE){
+        BleSendBuffer(msg, nbytes);
+    }else{
+        UartWrite(LinkPort(link), msg, nbytes);
+    }
+}
+
+/**
+ * @brief Bytes descartados por la cola de transmisión BLE desde el inicio.
+ */
+static uint32_t BleDropped(void){
+    ble_tx_stats_t stats;
+    BleTxStats(&stats);
+    return stats.dropped;
+}
+
+/**
+ * @brief Prueba de rendimiento: tramas de size bytes durante time_ms, a rate
+ * tramas por segundo (0: tan rápido como el enlace las acepta).
+ */
+static void Stream(link_t link, uint16_t size, uint32_t time_ms, uint32_t rate){
+    uint32_t count = 0, dropped = 0, attempts = 0;
+    uint32_t dropped_start = (link == LINK_BLE) ? BleDropped() : 0;
+    uint16_t payload = BleMaxPayload();
+    uart_mcu_port_t port = LinkPort(link);
+
+    if(size < FRAME_HEADER){
+        size = FRAME_HEADER;
+    }
+    if(size > FRAME_MAX){
+        size = FRAME_MAX;
+    }
+    if(link == LINK_BLE && size > payload){
+        size = payload;
+    }
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + (int64_t)time_ms * 1000;
+    while(esp_timer_get_time() < end){
+        if(link == LINK_BLE && BleStatus() != BLE_CONNECTED){
+            break;
+        }
+        if(rate > 0){
+            /* Instante de la trama: las atrasadas salen juntas (tick de 10 ms) */
+            int64_t next = start + (int64_t)attempts * 1000000 / rate;
+            while(esp_timer_get_time() < next){
+                vTaskDelay(1);
+            }
+        }
+        uint8_t *frame = frames[count % FRAME_POOL];
+        memset(&frame[FRAME_HEADER], count & 0xFF, size - FRAME_HEADER);
+        frame[0] = 0xA5;
+        frame[1] = 0x5A;
+        frame[2] = count & 0xFF;
+        frame[3] = (count >> 8) & 0xFF;
+        attempts++;
+        bool sent;
+        if(link == LINK_BLE){
+            if(rate == 0){
+                while(BleTxFree() < size + BLE_MSG_HEADER && BleStatus() == BLE_CONNECTED){
+                    vTaskDelay(1);
+                }
+            }
+            sent = BleWrite(frame, size);
+        }else if(rate == 0){
+            sent = (UartWrite(port, frame, size) == size);
+        }else{
+            sent = UartWriteAsync(port, frame, size, NULL);
+            if(!sent){
+                dropped += size;
+            }
+        }
+        if(sent){
+            count++;
+        }
+    }
+    uint32_t time_us = (uint32_t)(esp_timer_get_time() - start);
+
+    /* Cola vacía antes del informe, para que no se mezcle con las tramas */
+    if(link == LINK_BLE){
+        ble_tx_stats_t stats;
+        do{
+            vTaskDelay(1);
+            BleTxStats(&stats);
+        }while(stats.queued > 0 && BleStatus() == BLE_CONNECTED);
+        dropped = stats.dropped - dropped_start;
+    }else if(rate > 0){
+        /* Las escrituras asíncronas se copian en orden: al notificar la última, están todas */
+        while(!UartWriteAsync(port, frames[count % FRAME_POOL], 0, bench_task_handle)){
+            vTaskDelay(1);
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    char report[REPORT_MAX];
+    int n = snprintf(report, sizeof(report), "#T tramas=%lu bytes=%lu descartados=%lu us=%lu carga=%u\n",
+                     (unsigned long)count, (unsigned long)count * size, (unsigned long)dropped,
+                     (unsigned long)time_us, payload);
+    LinkSend(link, report, n);
+}
+
+/**
+ * @brief Ejecuta los comandos en orden: las pruebas no bloquean la recepción.
+ */
+static void BenchTask(void *pvParameter){
+    command_t command;
+    char reply[REPORT_MAX];
+    unsigned int size, time_ms, rate, value;
+    unsigned long baud;
+    int n;
+
+    while(true){
+        xQueueReceive(command_queue, &command, portMAX_DELAY);
+        switch(command.text[0]){
+            case 'T':
+                if(sscanf(&command.text[1], "%u,%u,%u", &size, &time_ms, &rate) == 3){
+                    Stream(command.link, size, time_ms, rate);
+                }
+                break;
+            case 'E':
+                n = snprintf(reply, sizeof(reply), "#%s\n", command.text);
+                LinkSend(command.link, reply, n);
+                break;
+            case 'P':
+                if(sscanf(&command.text[1], "%u", &value) == 1 && value <= BLE_PROFILE_LOW_POWER){
+                    BleSetProfile((ble_profile_t)value);
+                    n = snprintf(reply, sizeof(reply), "#P %u\n", value);
+                    LinkSend(command.link, reply, n);
+                }
+                break;
+            case 'B':
+                if(command.link == LINK_UART_PC && sscanf(&command.text[1], "%lu", &baud) == 1){
+                    n = snprintf(reply, sizeof(reply), "#B %lu\n", baud);
+                    UartWrite(UART_PC, reply, n);
+                    /* Respuesta enviada con el baudrate anterior */
+                    vTaskDelay(pdMS_TO_TICKS(100));
+                    serial_config_t uart_pc = {
+                        .port = UART_PC,
+                        .baud_rate = baud,
+                        .param_p = (void *)LINK_UART_PC,
+                        .tx_buffer_size = UART_RING_SIZE,
+                        .rx_buffer_size = UART_RING_SIZE,
+                        .rx_func_p = UartRead,
+                        .rx_pattern = '\n'
+                    };
+                    UartInit(&uart_pc);
+                }
+                break;
+            case 'S':
+                {
+                    ble_tx_stats_t stats;
+                    BleTxStats(&stats);
+                    n = snprintf(reply, sizeof(reply), "#S encolados=%lu enviados=%lu descartados=%lu carga=%u\n",
+                                 (unsigned long)stats.queued, (unsigned long)stats.sent,
+                                 (unsigned long)stats.dropped, BleMaxPayload());
+                    LinkSend(command.link, reply, n);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    ble_config_t ble_configuration = {
+        "ESP_EDU_BENCH",
+        BleRead,
+        BLE_SERVICE_SPP,
+        BLE_PROFILE_THROUGHPUT
+    };
+    serial_config_t uart_pc = {
+        .port = UART_PC,
+        .baud_rate = UART_BAUD_DEFAULT,
+        .param_p = (void *)LINK_UART_PC,
+        .tx_buffer_size = UART_RING_SIZE,
+        .rx_buffer_size = UART_RING_SIZE,
+        .rx_func_p = UartRead,
+        .rx_pattern = '\n'
+    };
+    serial_config_t uart_usb = {
+        .port = UART_USB,
+        .param_p = (void *)LINK_UART_USB,
+        .tx_buffer_size = UART_RING_SIZE,
+        .rx_buffer_size = UART_RING_SIZE,
+        .rx_func_p = UartRead,
+        .rx_pattern = '\n'
+    };
+
+    command_queue = xQueueCreate(CMD_QUEUE_SIZE, sizeof(command_t));
+    xTaskCreate(&BenchTask, "Bench", 4096, NULL, 5, &bench_task_handle);
+    UartInit(&uart_pc);
+    UartInit(&uart_usb);
+    BleInit(&ble_configuration);
+    printf("****Benchmark de enlaces: ejecutar link_benchmark.py****\n");
+}
+/*==================[end of file]============================================*/
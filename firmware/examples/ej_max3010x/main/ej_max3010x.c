@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/05/2024 | Document creation		                         |
+ * | 14/10/2026 | Lectura por lotes y estimación incremental     |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -41,13 +42,9 @@
 float dato_filt;
 float dato;
 
-uint32_t irBuffer[100]; //infrared LED sensor data
-uint32_t redBuffer[100];  //red LED sensor data
-int32_t bufferLength=100; //data length
-int32_t spo2; //SPO2 value
-int8_t validSPO2; //indicator to show if the SPO2 calculation is valid
-int32_t heartRate; //heart rate value
-int8_t validHeartRate; //indicator to show if the heart rate calculation is valid
+uint32_t irBuffer[MAX3010X_FIFO_DEPTH]; //infrared LED sensor data
+uint32_t redBuffer[MAX3010X_FIFO_DEPTH];  //red LED sensor data
+maxim_hr_spo2_t hr_spo2; //heart rate and SPO2 estimator
 /*==================[internal functions declaration]=========================*/
 
 /*==================[external functions definition]==========================*/
@@ -57,40 +54,26 @@ void app_main(void){
     LedsInit();
     MAX3010X_begin();
 	MAX3010X_setup( 30, 1 , 2, SAMPLE_FREQ, 69, 4096);
+    maxim_hr_spo2_init(&hr_spo2, SAMPLE_FREQ);
     /* Se imprimen por consola los valores de frequencia y magnitud correspondiente */
     printf("****MAX30102 Test****\n");
 
     while(1){
-        uint8_t i;
-	    for (i = 25; i < 100; i++)
-	    {
-		    redBuffer[i - 25] = redBuffer[i];
-		    irBuffer[i - 25] = irBuffer[i];
-	    }
+        /* Se vacía la FIFO del sensor en una sola lectura (hasta 32 muestras, 320 ms a 100 Hz) */
+        vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
+        uint8_t n = MAX3010X_readBatch(redBuffer, irBuffer, MAX3010X_FIFO_DEPTH);
 
-	    //take 25 sets of samples before calculating the heart rate.
-	    for ( i = 75; i < 100; i++)
-	    {
-		    while (MAX3010X_available() == false) //do we have new data?
-			    MAX3010X_check(); //Check the sensor for new data
-            
-		    redBuffer[i] = MAX3010X_getRed();
-		    irBuffer[i] = MAX3010X_getIR();
-		    MAX3010X_nextSample(); //We're finished with this sample so move to next sample
-		            
-            //send samples and calculation result to terminal program through UART
+        for(uint8_t i = 0; i < n; i++){
+            //high pass filtered red LED signal
 	     	dato = (float)redBuffer[i];
 			HiPassFilter(&dato, &dato_filt, 1);
-	        //printf("%ld,%2.2f,%ld\n", redBuffer[i], dato_filt, heartRate);
-             
-	}
+        }
 
-	//After gathering 25 new samples recalculate HR and SP02
-	maxim_heart_rate_and_oxygen_saturation(irBuffer, bufferLength, redBuffer, &spo2, &validSPO2, &heartRate, &validHeartRate);
-    printf("HR= %ld, HRvalid= %d \n", heartRate, validHeartRate);
-    printf("SPO2= %ld, SPO2Valid= %d \n", spo2, validSPO2);
-	LedToggle(LED_1);
-    //vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
+        /* HR y SPO2 se actualizan con cada lote, sin recalcular toda la ventana */
+        maxim_hr_spo2_update(&hr_spo2, irBuffer, redBuffer, n);
+        printf("HR= %ld, HRvalid= %d \n", hr_spo2.n_heart_rate, hr_spo2.ch_hr_valid);
+        printf("SPO2= %ld, SPO2Valid= %d \n", hr_spo2.n_spo2, hr_spo2.ch_spo2_valid);
+	    LedToggle(LED_1);
     }
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
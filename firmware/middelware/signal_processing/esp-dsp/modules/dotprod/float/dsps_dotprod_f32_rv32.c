@@ -0,0 +1,31 @@
+// RV32IMAC version of dsps_dotprod_f32 (targets without FPU and DSP extensions).
+// The loop is unrolled by four with pointer bumping. A single accumulator is
+// kept, so results are the same as dsps_dotprod_f32_ansi.
+
+#include "dsps_dotprod.h"
+#include "esp_attr.h"
+
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+
+IRAM_ATTR esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len)
+{
+    float acc = 0;
+    const float *a = src1;
+    const float *b = src2;
+    const float *end = src1 + (len & ~3);
+    while (a < end) {
+        acc += a[0] * b[0];
+        acc += a[1] * b[1];
+        acc += a[2] * b[2];
+        acc += a[3] * b[3];
+        a += 4;
+        b += 4;
+    }
+    for (int i = 0; i < (len & 3); i++) {
+        acc += a[i] * b[i];
+    }
+    *dest = acc;
+    return ESP_OK;
+}
+
+#endif // dsps_dotprod_f32_rv32_enabled
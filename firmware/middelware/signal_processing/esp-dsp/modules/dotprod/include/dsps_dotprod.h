@@ -65,6 +65,7 @@ esp_err_t dsps_dotprod_s16_ae32(const int16_t *src1, const int16_t *src2, int16_
 esp_err_t dsps_dotprod_f32_ansi(const float *src1, const float *src2, float *dest, int len);
 esp_err_t dsps_dotprod_f32_ae32(const float *src1, const float *src2, float *dest, int len);
 esp_err_t dsps_dotprod_f32_aes3(const float *src1, const float *src2, float *dest, int len);
+esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len);
 /**@}*/
 
 /**@{*/
@@ -117,4 +118,9 @@ esp_err_t dsps_dotprode_f32_ae32(const float *src1, const float *src2, float *de
 #define dsps_dotprode_f32 dsps_dotprode_f32_ansi
 #endif // CONFIG_DSP_OPTIMIZED
 
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+#undef dsps_dotprod_f32
+#define dsps_dotprod_f32 dsps_dotprod_f32_rv32
+#endif // dsps_dotprod_f32_rv32_enabled
+
 #endif // _DSPI_DOTPROD_H_
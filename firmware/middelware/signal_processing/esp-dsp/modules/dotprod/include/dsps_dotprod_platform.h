@@ -22,6 +22,10 @@
 #endif //
 #endif // __XTENSA__
 
+#if defined(__riscv)
+#define dsps_dotprod_f32_rv32_enabled 1
+#endif // __riscv
+
 
 #if CONFIG_IDF_TARGET_ESP32S3
 #define dsps_dotprod_s16_aes3_enabled 1
@@ -0,0 +1,51 @@
+// RV32IMAC version of dsps_fft2r_fc32 (targets without FPU and DSP extensions).
+// Same radix-2 butterflies as dsps_fft2r_fc32_ansi_, with pointer bumping for the
+// butterfly inputs and the twiddle factors kept in registers.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "esp_attr.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+IRAM_ATTR esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        float *pa = data;
+        const float *pw = w;
+        for (int j = 0; j < ie; j++) {
+            const float c = pw[0];
+            const float s = pw[1];
+            pw += 2;
+            float *pm = pa + 2 * N2;
+            const float *end = pm;
+            while (pa < end) {
+                float m_re = pm[0];
+                float m_im = pm[1];
+                float re_temp = c * m_re + s * m_im;
+                float im_temp = c * m_im - s * m_re;
+                float a_re = pa[0];
+                float a_im = pa[1];
+                pm[0] = a_re - re_temp;
+                pm[1] = a_im - im_temp;
+                pa[0] = a_re + re_temp;
+                pa[1] = a_im + im_temp;
+                pa += 2;
+                pm += 2;
+            }
+            pa += 2 * N2;
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
@@ -93,6 +93,7 @@ void dsps_fft2r_deinit_sc16(void);
  */
 esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_fc32_ae32_(float *data, int N, float *w);
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_fc32_aes3_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_sc16_ansi_(int16_t *data, int N, int16_t *w);
 esp_err_t dsps_fft2r_sc16_ae32_(int16_t *data, int N, int16_t *w);
@@ -105,6 +106,7 @@ esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
 #define dsps_fft2r_sc16_ae32(data, N) dsps_fft2r_sc16_ae32_(data, N, dsps_fft_w_table_sc16)
 #define dsps_fft2r_sc16_aes3(data, N) dsps_fft2r_sc16_aes3_(data, N, dsps_fft_w_table_sc16)
 #define dsps_fft2r_fc32_ansi(data, N) dsps_fft2r_fc32_ansi_(data, N, dsps_fft_w_table_fc32)
+#define dsps_fft2r_fc32_rv32(data, N) dsps_fft2r_fc32_rv32_(data, N, dsps_fft_w_table_fc32)
 #define dsps_fft2r_sc16_ansi(data, N) dsps_fft2r_sc16_ansi_(data, N, dsps_fft_w_table_sc16)
 
 
@@ -242,4 +244,9 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 
 #endif // CONFIG_DSP_OPTIMIZED
 
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+#undef dsps_fft2r_fc32
+#define dsps_fft2r_fc32 dsps_fft2r_fc32_rv32
+#endif // dsps_fft2r_fc32_rv32_enabled
+
 #endif // _dsps_fft2r_H_
@@ -0,0 +1,40 @@
+// RV32IMAC version of dsps_biquad_f32 (targets without FPU and DSP extensions).
+// Arithmetic is the same as dsps_biquad_f32_ansi: coefficients and state are kept
+// in registers, the loop is unrolled by two and the state rotation is folded in.
+
+#include "dsps_biquad.h"
+#include "esp_attr.h"
+
+#if (dsps_biquad_f32_rv32_enabled == 1)
+
+IRAM_ATTR esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w)
+{
+    const float b0 = coef[0], b1 = coef[1], b2 = coef[2];
+    const float a1 = coef[3], a2 = coef[4];
+    float w0 = w[0];
+    float w1 = w[1];
+    const float *in = input;
+    float *out = output;
+    const float *end = input + (len & ~1);
+    while (in < end) {
+        float d0 = in[0] - a1 * w0 - a2 * w1;
+        out[0] = b0 * d0 + b1 * w0 + b2 * w1;
+        float d1 = in[1] - a1 * d0 - a2 * w0;
+        out[1] = b0 * d1 + b1 * d0 + b2 * w0;
+        w1 = d0;
+        w0 = d1;
+        in += 2;
+        out += 2;
+    }
+    if (len & 1) {
+        float d0 = in[0] - a1 * w0 - a2 * w1;
+        out[0] = b0 * d0 + b1 * w0 + b2 * w1;
+        w1 = w0;
+        w0 = d0;
+    }
+    w[0] = w0;
+    w[1] = w1;
+    return ESP_OK;
+}
+
+#endif // dsps_biquad_f32_rv32_enabled
@@ -46,6 +46,7 @@ extern "C"
 esp_err_t dsps_biquad_f32_ansi(const float *input, float *output, int len, float *coef, float *w);
 esp_err_t dsps_biquad_f32_ae32(const float *input, float *output, int len, float *coef, float *w);
 esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float *coef, float *w);
+esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w);
 /**@}*/
 
 
@@ -69,5 +70,10 @@ esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float
 
 #endif // CONFIG_DSP_OPTIMIZED
 
+#if (dsps_biquad_f32_rv32_enabled == 1)
+#undef dsps_biquad_f32
+#define dsps_biquad_f32 dsps_biquad_f32_rv32
+#endif // dsps_biquad_f32_rv32_enabled
+
 
 #endif // _dsps_biquad_H_
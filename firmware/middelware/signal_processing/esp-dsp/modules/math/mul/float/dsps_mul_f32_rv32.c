@@ -0,0 +1,46 @@
+// RV32IMAC version of dsps_mul_f32 (targets without FPU and DSP extensions).
+// Pointers are bumped by the steps instead of computing i * step, and the unit
+// step case (the common one) is unrolled by four.
+
+#include "dsps_mul.h"
+#include "esp_attr.h"
+
+#if (dsps_mul_f32_rv32_enabled == 1)
+
+IRAM_ATTR esp_err_t dsps_mul_f32_rv32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out)
+{
+    if (NULL == input1) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == input2) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == output) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    const float *in1 = input1;
+    const float *in2 = input2;
+    float *out = output;
+    int i = 0;
+    if (step1 == 1 && step2 == 1 && step_out == 1) {
+        for (; i + 4 <= len; i += 4) {
+            out[0] = in1[0] * in2[0];
+            out[1] = in1[1] * in2[1];
+            out[2] = in1[2] * in2[2];
+            out[3] = in1[3] * in2[3];
+            in1 += 4;
+            in2 += 4;
+            out += 4;
+        }
+    }
+    for (; i < len; i++) {
+        *out = *in1 * *in2;
+        in1 += step1;
+        in2 += step2;
+        out += step_out;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_mul_f32_rv32_enabled
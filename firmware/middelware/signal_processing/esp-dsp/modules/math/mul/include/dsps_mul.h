@@ -46,6 +46,7 @@ extern "C"
  */
 esp_err_t dsps_mul_f32_ansi(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out);
 esp_err_t dsps_mul_f32_ae32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out);
+esp_err_t dsps_mul_f32_rv32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out);
 /**@}*/
 
 
@@ -108,4 +109,9 @@ esp_err_t dsps_mul_s8_aes3(const int8_t *input1, const int8_t *input2, int8_t *o
 #define dsps_mul_s8  dsps_mul_s8_ansi
 #endif // CONFIG_DSP_OPTIMIZED
 
+#if (dsps_mul_f32_rv32_enabled == 1)
+#undef dsps_mul_f32
+#define dsps_mul_f32 dsps_mul_f32_rv32
+#endif // dsps_mul_f32_rv32_enabled
+
 #endif // _dsps_mul_H_
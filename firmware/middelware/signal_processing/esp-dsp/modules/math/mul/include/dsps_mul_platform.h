@@ -27,4 +27,8 @@
 
 #endif // __XTENSA__
 
+#if defined(__riscv)
+#define dsps_mul_f32_rv32_enabled 1
+#endif // __riscv
+
 #endif // _dsps_mul_platform_H_
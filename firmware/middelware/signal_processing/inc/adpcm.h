@@ -0,0 +1,77 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup ADPCM ADPCM
+ */
+
+/** \brief IMA-ADPCM encoding and streaming decoding of 16 bits PCM samples
+ *
+ * Each sample is stored as a 4 bits code (low nibble first), so samples take
+ * 1/4 of the memory of 16 bits PCM. Streams have no headers: decoding starts with
+ * predictor = 0 and step index = 0, and must be done in order (the decoder state
+ * carries the predictor and step index between blocks).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+/** @brief Number of bytes of an ADPCM stream of n samples */
+#define ADPCM_BYTES(n)      (((n) + 1) / 2)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief ADPCM encoder / decoder state
+ */
+typedef struct {
+    int16_t predictor;          /*!< Last decoded sample */
+    uint8_t index;              /*!< Step size table index (0 to 88) */
+} adpcm_state_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an encoder / decoder state (start of a stream)
+ *
+ * @param state             ADPCM state
+ */
+void AdpcmInit(adpcm_state_t * state);
+
+/**
+ * @brief Encode 16 bits PCM samples
+ *
+ * @param state             ADPCM state (initialized with AdpcmInit at the start of the stream)
+ * @param input             PCM samples
+ * @param output            ADPCM stream (of ADPCM_BYTES(lenght) bytes)
+ * @param lenght            Number of samples (even, except for the last block of a stream)
+ */
+void AdpcmEncode(adpcm_state_t * state, const int16_t * input, uint8_t * output, uint32_t lenght);
+
+/**
+ * @brief Decode the next samples of an ADPCM stream
+ *
+ * @param state             ADPCM state (initialized with AdpcmInit at the start of the stream)
+ * @param data              ADPCM stream (from its first byte)
+ * @param pos               Index of the first sample to decode (samples decoded so far)
+ * @param output            PCM samples
+ * @param lenght            Number of samples
+ */
+void AdpcmDecode(adpcm_state_t * state, const uint8_t * data, uint32_t pos, int16_t * output, uint16_t lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ADPCM_H_ */
+
+/*==================[end of file]============================================*/
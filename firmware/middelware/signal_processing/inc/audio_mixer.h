@@ -0,0 +1,272 @@
+#ifndef AUDIO_MIXER_H_
+#define AUDIO_MIXER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Audio_Mixer Audio Mixer
+ */
+
+/** \brief Polyphonic mixer of PCM samples (i.e. drum hits)
+ *
+ * A pool of voices plays samples stored in memory. Every active voice is added
+ * to the output block with its gain and the sum is saturated to 16 bits, so
+ * simultaneous hits overlap and the CPU cost per output sample only depends on
+ * the number of active voices.
+ *
+ * Free voices are found in constant time (a mask of the active ones). When a
+ * new sample is played and all voices are in use, one is stolen according to
+ * the mixer policy (AudioMixerSetPolicy): the oldest one (the default) or the
+ * quietest one (gain scaled by the part of the sample left, as drum hits decay).
+ * The policy also limits the voices used, so the worst case cost of a block is
+ * fixed no matter how fast samples are played.
+ *
+ * Voices can be put in choke groups (AudioMixerSetChoke): a voice started in a
+ * group cuts the other voices of the group (i.e. the closed hi-hat cuts the
+ * open one), that fade out along the next block and are released.
+ *
+ * Every voice has a gain envelope: the gain of the hit, that can decay
+ * exponentially (AudioMixerSetDecay, i.e. to shorten a sample). The decay is
+ * computed once per block and the gain ramps linearly along it, so it still
+ * costs one multiply-add per sample; voices that decay to zero are released.
+ * The sum of the voices goes through the master bus (AudioMixerSetMaster): a
+ * gain and a limiter that keeps the peak of every block under a threshold,
+ * reducing the gain at once and recovering it along the release time, instead
+ * of clipping the output. It needs no lookahead (no added latency): the gain of
+ * a block is known before it is output. All of it is fixed point.
+ *
+ * Voices can also play IMA-ADPCM streams: they are decoded block by block while
+ * they are mixed, so only active voices spend time decoding.
+ *
+ * Every voice can be resampled (AudioMixerSetRatio): samples stored at their
+ * native rate (i.e. 22.05 or 44.1 kHz) play at the mixer rate, and the same ratio
+ * shifts the pitch. The resampler interpolates linearly between two source
+ * samples with a Q16.16 phase, so its cost per output sample is one
+ * multiplication plus the source samples decoded (up to AUDIO_MIXER_MAX_RATIO).
+ * Voices with ratio 1 (the default) skip it. Linear interpolation does not
+ * filter: samples played above the mixer rate should have no content above half
+ * the mixer rate (low pass them when building the bank).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 14/10/2026 | IMA-ADPCM voices		                         						|
+ * | 15/10/2026 | Per voice resampling (native rate samples and pitch shift)				|
+ * | 15/10/2026 | Attack of the samples played from a RAM copy					|
+ * | 15/10/2026 | Voice stealing policies and choke groups						|
+ * | 15/10/2026 | Gain envelopes and master bus limiter							|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adpcm.h"
+/*==================[macros]=================================================*/
+#define AUDIO_MIXER_VOICES      8       /*!< Voices of each mixer */
+#define AUDIO_MIXER_GAIN_SHIFT  12      /*!< Voices gain format: Q3.12 (4096 = 1.0) */
+#define AUDIO_MIXER_RATIO_SHIFT 16      /*!< Resampling ratio and phase format: Q16.16 */
+#define AUDIO_MIXER_MAX_RATIO   8       /*!< Max source samples per output sample */
+#define AUDIO_MIXER_NO_CHOKE    0       /*!< Choke group of the voices that are not cut by others */
+#define AUDIO_MIXER_RELEASE     1024    /*!< Default release of the limiter (samples) */
+#define AUDIO_MIXER_MAX_MASTER  8       /*!< Max master gain */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Voice stolen when all the voices are in use
+ */
+typedef enum {
+    AUDIO_MIXER_STEAL_OLDEST = 0,   /*!< The one started first */
+    AUDIO_MIXER_STEAL_QUIETEST,     /*!< The one with the lowest gain times the part of the sample left */
+} audio_mixer_steal_t;
+
+/**
+ * @brief Mixer voice
+ */
+typedef struct {
+    const int16_t * sample;     /*!< PCM sample being played (NULL if free or playing ADPCM) */
+    const uint8_t * adpcm;      /*!< ADPCM stream being played (NULL if free or playing PCM) */
+    adpcm_state_t state;        /*!< ADPCM decoder state */
+    uint32_t lenght;            /*!< Number of samples */
+    uint32_t pos;               /*!< Next sample to play */
+    int16_t offset;             /*!< Value subtracted from every sample (i.e. 512 for unsigned 10 bits samples) */
+    int16_t gain;               /*!< Gain (Q3.12) */
+    uint32_t ratio;             /*!< Source samples per output sample (Q16.16, 1 << AUDIO_MIXER_RATIO_SHIFT: no resampling) */
+    uint32_t phase;             /*!< Position between prev and next (Q16.16, >= 1.0: next sample needed) */
+    int16_t prev;               /*!< Source sample before the output position */
+    int16_t next;               /*!< Source sample after the output position */
+    bool tail;                  /*!< next is past the end of the sample */
+    const void * head;          /*!< Copy in RAM of the first head_lenght samples (or ADPCM bytes), NULL if none */
+    uint32_t head_lenght;       /*!< Samples played from head */
+    uint32_t start;             /*!< Order in which the voice was started */
+    uint8_t group;              /*!< Choke group (AUDIO_MIXER_NO_CHOKE: none) */
+    bool choked;                /*!< Cut by another voice of its group: fades out in the next block */
+    int32_t env;                /*!< Gain envelope (gain with 15 more fractional bits) */
+    uint32_t decay;             /*!< Envelope multiplier per sample (Q2.30, 0: no decay) */
+} audio_voice_t;
+
+/**
+ * @brief Mixer instance
+ */
+typedef struct {
+    audio_voice_t voices[AUDIO_MIXER_VOICES];   /*!< Voices pool */
+    uint32_t active;                            /*!< Mask of the active voices */
+    uint32_t starts;                            /*!< Voices started */
+    audio_mixer_steal_t steal;                  /*!< Stealing policy */
+    uint8_t max_voices;                         /*!< Voices used (up to AUDIO_MIXER_VOICES) */
+    int32_t master;                             /*!< Master gain (Q15.16) */
+    int32_t threshold;                          /*!< Limiter threshold (output peak) */
+    uint32_t release;                           /*!< Samples to recover the master gain after limiting */
+    int32_t limit;                              /*!< Master bus gain applied (Q15.16, under master while limiting) */
+} audio_mixer_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a mixer (all voices free, AUDIO_MIXER_VOICES voices stolen from the oldest,
+ * master gain 1 limited at full scale)
+ *
+ * @param mixer             Mixer instance
+ */
+void AudioMixerInit(audio_mixer_t * mixer);
+
+/**
+ * @brief Set the voice stealing policy and the voices used
+ *
+ * @param mixer             Mixer instance
+ * @param steal             Voice stolen when all are in use
+ * @param max_voices        Voices used, bounds the cost of a block (1 to AUDIO_MIXER_VOICES)
+ * @return true             Policy set
+ * @return false            Invalid number of voices
+ */
+bool AudioMixerSetPolicy(audio_mixer_t * mixer, audio_mixer_steal_t steal, uint8_t max_voices);
+
+/**
+ * @brief Set the master bus: gain and limiter applied to the sum of the voices
+ *
+ * @param mixer             Mixer instance
+ * @param gain              Master gain (from 0 to AUDIO_MIXER_MAX_MASTER)
+ * @param threshold         Max peak of the output (INT16_MAX: only avoids clipping)
+ * @param release           Samples to recover the gain after a peak (i.e. 100 ms)
+ */
+void AudioMixerSetMaster(audio_mixer_t * mixer, float gain, int16_t threshold, uint32_t release);
+
+/**
+ * @brief Start playing a sample in a free voice (or in a stolen one)
+ *
+ * @note The sample is not copied, it must remain valid while it is played.
+ *
+ * @param mixer             Mixer instance
+ * @param sample            Sample to play
+ * @param lenght            Number of samples
+ * @param offset            Value subtracted from every sample (0 for signed PCM)
+ * @param gain              Gain (from 0 to 7.99)
+ * @return Voice used
+ */
+uint8_t AudioMixerPlay(audio_mixer_t * mixer, const int16_t * sample, uint32_t lenght, int16_t offset, float gain);
+
+/**
+ * @brief Start playing an IMA-ADPCM stream in a free voice (or in a stolen one)
+ *
+ * @note The stream is not copied, it must remain valid while it is played.
+ *
+ * @param mixer             Mixer instance
+ * @param data              ADPCM stream (as encoded by AdpcmEncode)
+ * @param lenght            Number of samples
+ * @param gain              Gain (from 0 to 7.99)
+ * @return Voice used
+ */
+uint8_t AudioMixerPlayADPCM(audio_mixer_t * mixer, const uint8_t * data, uint32_t lenght, float gain);
+
+/**
+ * @brief Resample a voice: play it at a different rate than the mixer
+ *
+ * Can be called right after playing a sample or while it is playing (pitch bend).
+ *
+ * @param mixer             Mixer instance
+ * @param voice             Voice (returned by AudioMixerPlay or AudioMixerPlayADPCM)
+ * @param ratio             Source samples per output sample: sample rate / mixer rate * pitch
+ *                          (up to AUDIO_MIXER_MAX_RATIO)
+ * @return true             Ratio set
+ * @return false            Voice not playing or ratio out of range
+ */
+bool AudioMixerSetRatio(audio_mixer_t * mixer, uint8_t voice, float ratio);
+
+/**
+ * @brief Play the attack of a voice from a copy in RAM (i.e. sample_t.head of a sample cache)
+ *
+ * The first head_lenght samples are read from head and the rest from the sample
+ * (i.e. in flash), so the sound starts without waiting for flash reads. Must be
+ * called right after playing the sample.
+ *
+ * @param mixer             Mixer instance
+ * @param voice             Voice (returned by AudioMixerPlay or AudioMixerPlayADPCM)
+ * @param head              Copy of the first samples (int16_t for PCM, the first head_lenght / 2
+ *                          bytes for ADPCM)
+ * @param head_lenght       Samples of the copy (even for ADPCM)
+ * @return true             Attack set
+ * @return false            Voice not playing, already started or odd ADPCM lenght
+ */
+bool AudioMixerSetAttack(audio_mixer_t * mixer, uint8_t voice, const void * head, uint32_t head_lenght);
+
+/**
+ * @brief Make the gain of a voice decay exponentially
+ *
+ * @param mixer             Mixer instance
+ * @param voice             Voice (returned by AudioMixerPlay or AudioMixerPlayADPCM)
+ * @param decay             Samples (at the mixer rate) for the gain to fall to 1/e (0: no decay)
+ * @return true             Decay set
+ * @return false            Voice not playing or negative decay
+ */
+bool AudioMixerSetDecay(audio_mixer_t * mixer, uint8_t voice, float decay);
+
+/**
+ * @brief Put a voice in a choke group, cutting the other voices of the group
+ *
+ * The voices cut fade out along the next block and are released. Must be called
+ * right after playing the sample.
+ *
+ * @param mixer             Mixer instance
+ * @param voice             Voice (returned by AudioMixerPlay or AudioMixerPlayADPCM)
+ * @param group             Choke group (AUDIO_MIXER_NO_CHOKE: none)
+ * @return Voices cut
+ */
+uint8_t AudioMixerSetChoke(audio_mixer_t * mixer, uint8_t voice, uint8_t group);
+
+/**
+ * @brief Stop every voice
+ *
+ * @param mixer             Mixer instance
+ */
+void AudioMixerStop(audio_mixer_t * mixer);
+
+/**
+ * @brief Number of voices playing
+ *
+ * @param mixer             Mixer instance
+ * @return Active voices
+ */
+uint8_t AudioMixerActiveVoices(audio_mixer_t * mixer);
+
+/**
+ * @brief Mix the next block of samples of every active voice
+ *
+ * Voices that reach the end of their sample are released. Without active voices
+ * the block is filled with zeros.
+ *
+ * @param mixer             Mixer instance
+ * @param output            Mixed block (signed 16 bits)
+ * @param lenght            Samples of the block
+ */
+void AudioMixerProcess(audio_mixer_t * mixer, int16_t * output, uint16_t lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* AUDIO_MIXER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,145 @@
+#ifndef AUDIO_REACTIVE_H_
+#define AUDIO_REACTIVE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Audio_Reactive Audio Reactive
+ */
+
+/** \brief Band energies of the streaming spectrum mapped to LED colors
+ *
+ * Each spectrum frame (i.e. each hop of an STFT) is reduced to n_bands
+ * energies, in bands logarithmically spaced between min_frec and max_frec:
+ *
+ *     energy(b) = sum over the bins of band b of |X(k)|^2
+ *     level(b) = 1 + 10 * log10(energy(b) / peak) / range_db     (0 to 1)
+ *
+ * where peak is the highest energy of the recent frames (automatic gain, it
+ * decays in AUDIO_REACTIVE_PEAK_MS). The levels follow with an attack and a
+ * release time, so the LEDs jump with the hits and fade out smoothly. A frame
+ * costs one multiplication and one addition per bin (the band edges are
+ * computed by AudioReactiveInit) and one logarithm per band.
+ *
+ * AudioReactiveRender turns the levels into the colors of a stripe (the color
+ * of each band in the palette, scaled by its level): the stripe is split in
+ * n_bands segments, or each LED mixes several bands if there are fewer LEDs
+ * than bands. Colors are 0x00RRGGBB, as neopixel_color_t, so the back buffer
+ * of the stripe can be rendered and shown without blocking the audio:
+ *
+ * @code
+ * static void StftFrame(const float * magnitude, uint16_t bins, void * param){
+ *     AudioReactiveProcess(&leds, magnitude, bins);
+ *     if(!NeoPixelBusy()){
+ *         AudioReactiveRender(&leds, NeoPixelGetArray(), NeoPixelGetLength());
+ *         NeoPixelShow();
+ *     }
+ * }
+ * ...
+ * STFTInit(&stft, 512, 256, FFT_WINDOW_HANN, stft_buffer, StftFrame, NULL);
+ * AudioReactiveInit(&leds, &config);
+ * @endcode
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define AUDIO_REACTIVE_MAX_BANDS    16      /*!< Max bands */
+#define AUDIO_REACTIVE_PEAK_MS      2000    /*!< Decay time of the automatic gain (ms) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Audio reactive configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency (Hz) */
+    uint16_t frame_lenght;      /*!< Samples per frame (spectrum of frame_lenght / 2 bins) */
+    uint16_t hop_lenght;        /*!< New samples between frames (time between calls of AudioReactiveProcess) */
+    uint8_t n_bands;            /*!< Bands (1 to AUDIO_REACTIVE_MAX_BANDS) */
+    float min_frec;             /*!< Low edge of the first band (Hz) */
+    float max_frec;             /*!< High edge of the last band (Hz, up to sample_frec / 2) */
+    float attack_ms;            /*!< Rise time of the levels (ms, 0: immediate) */
+    float release_ms;           /*!< Fall time of the levels (ms, 0: immediate) */
+    float range_db;             /*!< Energies from peak - range_db (level 0) to peak (level 1), i.e. 40 */
+    float min_peak;             /*!< Lowest automatic gain reference (energy, so silence stays dark) */
+    const uint32_t * palette;   /*!< Color of each band at level 1 (0x00RRGGBB, n_bands values) */
+} audio_reactive_config_t;
+
+/**
+ * @brief Audio reactive instance
+ */
+typedef struct {
+    uint16_t edge[AUDIO_REACTIVE_MAX_BANDS + 1];    /*!< First bin of each band (and end of the last one) */
+    uint8_t n_bands;                                /*!< Bands */
+    float attack;                                   /*!< Weight of a new level on the rise */
+    float release;                                  /*!< Weight of a new level on the fall */
+    float peak_decay;                               /*!< Decay of peak per frame */
+    float range_db;                                 /*!< Range of the levels (dB) */
+    float min_peak;                                 /*!< Lowest peak */
+    float peak;                                     /*!< Automatic gain reference (energy) */
+    float energy[AUDIO_REACTIVE_MAX_BANDS];         /*!< Energy of each band in the last frame */
+    float level[AUDIO_REACTIVE_MAX_BANDS];          /*!< Level of each band (0 to 1) */
+    const uint32_t * palette;                       /*!< Color of each band */
+} audio_reactive_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an audio reactive instance (band edges and time constants)
+ *
+ * @param ar                Audio reactive instance
+ * @param config            Configuration
+ * @return true             Instance initialized
+ * @return false            Invalid parameters
+ */
+bool AudioReactiveInit(audio_reactive_t * ar, const audio_reactive_config_t * config);
+
+/**
+ * @brief Update the levels with a spectrum frame (i.e. from the STFT function)
+ *
+ * @param ar                Audio reactive instance
+ * @param magnitude         Magnitude of the frame (frame_lenght / 2 bins)
+ * @param bins              Number of bins
+ */
+void AudioReactiveProcess(audio_reactive_t * ar, const float * magnitude, uint16_t bins);
+
+/**
+ * @brief Colors of a stripe for the current levels
+ *
+ * @param ar                Audio reactive instance
+ * @param colors            Color of each LED (0x00RRGGBB, i.e. NeoPixelGetArray())
+ * @param leds              Number of LEDs
+ */
+void AudioReactiveRender(const audio_reactive_t * ar, uint32_t * colors, uint16_t leds);
+
+/**
+ * @brief Current levels
+ *
+ * @param ar                Audio reactive instance
+ * @return Level of each band (0 to 1, n_bands values)
+ */
+const float * AudioReactiveLevels(const audio_reactive_t * ar);
+
+/**
+ * @brief Levels back to 0 and automatic gain back to min_peak
+ *
+ * @param ar                Audio reactive instance
+ */
+void AudioReactiveReset(audio_reactive_t * ar);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* AUDIO_REACTIVE_H_ */
+
+/*==================[end of file]============================================*/
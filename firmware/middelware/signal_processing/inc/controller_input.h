@@ -0,0 +1,151 @@
+#ifndef CONTROLLER_INPUT_H_
+#define CONTROLLER_INPUT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Controller_Input Controller Input
+ */
+
+/** \brief Continuous controller inputs (i.e. a hi-hat pedal) with change only events
+ *
+ * A pedal is a position, not a trigger: its channel can be sampled at a low
+ * rate (i.e. a slow channel of the ADC scan) and is only worth a message when
+ * the position changes. Each sample goes through:
+ *
+ *     position = (x - open_level) / (closed_level - open_level)    (0 to 1, clipped)
+ *     y = y + alpha * (position - y)                               (time constant time_ms)
+ *     value = round(y * (steps - 1))   if |y * (steps - 1) - value| > 0.5 + hysteresis
+ *
+ * so the noise of the sensor and of the foot resting on the pedal do not
+ * produce events: a value is reported once per step crossed while the pedal
+ * moves, and never while it stands still. With 128 steps the value is the one
+ * of a MIDI foot controller (MidiControlChange() with MIDI_CC_FOOT: 0 open,
+ * 127 closed).
+ *
+ * The crossings of close_position are reported too, with the same hysteresis:
+ * a CONTROLLER_CLOSED event is the "chick" of the hi-hat (the open hi-hat
+ * voices of the mixer are choked), and ControllerInputOpenAmount() gives the
+ * decay of the next hi-hat hit.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define CONTROLLER_MAX_STEPS    1024    /*!< Max steps of the reported value */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Controller events
+ */
+typedef enum {
+    CONTROLLER_VALUE,           /*!< New value (0 to steps - 1) */
+    CONTROLLER_CLOSED,          /*!< Position went over close_position (i.e. hi-hat closed) */
+    CONTROLLER_OPENED,          /*!< Position went back under close_position */
+} controller_event_type_t;
+
+/**
+ * @brief Controller input configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency of the channel (Hz) */
+    float open_level;           /*!< Level of the released pedal (signal units, i.e. mV) */
+    float closed_level;         /*!< Level of the pressed pedal (signal units, above or below open_level) */
+    float time_ms;              /*!< Time constant of the smoothing (ms, 0: none) */
+    uint16_t steps;             /*!< Steps of the value (2 to CONTROLLER_MAX_STEPS, i.e. 128 for MIDI) */
+    float hysteresis;           /*!< Extra steps the position has to move to change the value (i.e. 0.5) */
+    float close_position;       /*!< Position of the CONTROLLER_CLOSED event (0 to 1, i.e. 0.9) */
+} controller_input_config_t;
+
+/**
+ * @brief Controller event
+ */
+typedef struct {
+    uint16_t pos;                   /*!< Sample of the block where the event happened */
+    controller_event_type_t type;   /*!< Event */
+    uint16_t value;                 /*!< Value after the event (0 to steps - 1) */
+} controller_event_t;
+
+/**
+ * @brief Controller input instance (one per pedal)
+ */
+typedef struct {
+    float offset;               /*!< open_level */
+    float gain;                 /*!< 1 / (closed_level - open_level) */
+    float alpha;                /*!< Weight of each sample */
+    float max_value;            /*!< steps - 1 */
+    float threshold;            /*!< 0.5 + hysteresis (steps) */
+    float close_value;          /*!< close_position in steps */
+    float position;             /*!< Smoothed position (0 to 1) */
+    uint16_t value;             /*!< Value reported */
+    bool closed;                /*!< Over close_position */
+    bool started;               /*!< First sample processed */
+} controller_input_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a controller input (the first sample sets the position without smoothing)
+ *
+ * @param ci                Controller input instance
+ * @param config            Configuration
+ * @return true             Controller input initialized
+ * @return false            Invalid parameters
+ */
+bool ControllerInputInit(controller_input_t * ci, const controller_input_config_t * config);
+
+/**
+ * @brief Process a block of samples
+ *
+ * The first sample after ControllerInputInit() or ControllerInputReset()
+ * reports the value (and CONTROLLER_CLOSED if the pedal is pressed).
+ *
+ * @param ci                Controller input instance
+ * @param signal            Samples of the channel (signal units)
+ * @param signal_lenght     Lenght of signal array
+ * @param events            Array to store the events (can be NULL)
+ * @param max_events        Lenght of events array (extra events are counted but not stored)
+ * @return Number of events in the block
+ */
+uint16_t ControllerInputProcess(controller_input_t * ci, const float * signal, uint16_t signal_lenght,
+    controller_event_t * events, uint16_t max_events);
+
+/**
+ * @brief Value reported last
+ *
+ * @param ci                Controller input instance
+ * @return Value (0 to steps - 1)
+ */
+uint16_t ControllerInputValue(const controller_input_t * ci);
+
+/**
+ * @brief Opening of the pedal, from the value reported last
+ *
+ * @param ci                Controller input instance
+ * @return 1 released to 0 pressed (i.e. scales the decay of a hi-hat sample)
+ */
+float ControllerInputOpenAmount(const controller_input_t * ci);
+
+/**
+ * @brief Forget the position (the next sample is reported again)
+ *
+ * @param ci                Controller input instance
+ */
+void ControllerInputReset(controller_input_t * ci);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CONTROLLER_INPUT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,142 @@
+#ifndef FAST_CONV_H_
+#define FAST_CONV_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Fast_Conv Fast Convolution
+ */
+
+/** \brief FFT based convolution and cross-correlation
+ *
+ * Direct convolution (dsps_conv_f32, dsps_ccorr_f32) costs N * M multiplications.
+ * These functions use the real FFT of the fft module, so the cost grows as
+ * N log N: they are faster for kernels longer than a few tens of samples.
+ *
+ * - FastConvolve() / FastCorrelate(): one shot, same output as dsps_conv_f32 and
+ *   dsps_ccorr_f32, with a transform of the next power of two of the result lenght.
+ * - fast_conv_t: streaming overlap-add convolution with a fixed kernel (i.e. a long
+ *   FIR filter or a matched filter for pad onset templates). Samples are pushed in
+ *   blocks of any size; every block_lenght = fft_lenght - kernel_lenght + 1 samples
+ *   one block is convolved, so the output is delayed block_lenght samples.
+ *
+ * @note FFTInit() must be called before using these functions.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+/** @brief Number of floats of the buffer needed by a streaming convolution with a transform of lenght n */
+#define FAST_CONV_BUFFER_LENGHT(n)  (4 * (n))
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Streaming (overlap-add) convolution instance
+ */
+typedef struct {
+    uint16_t fft_lenght;        /*!< Transform lenght (power of two, up to MAX_SIGNAL_LENGHT) */
+    uint16_t kernel_lenght;     /*!< Kernel lenght */
+    uint16_t block_lenght;      /*!< Samples convolved on each transform (fft_lenght - kernel_lenght + 1) */
+    uint16_t fill;              /*!< Samples of the current block */
+    float * kernel;             /*!< Kernel spectrum (fft_lenght values, packed) */
+    float * work;               /*!< Work buffer (fft_lenght values) */
+    float * input;              /*!< Samples of the current block (block_lenght values) */
+    float * output;             /*!< Output of the previous block (block_lenght values) */
+    float * tail;               /*!< Tail of the previous block (kernel_lenght - 1 values) */
+    bool allocated;             /*!< Buffer allocated by FastConvInit */
+} fast_conv_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a streaming convolution
+ *
+ * @param conv              Convolution instance
+ * @param kernel            Kernel (copied, as its spectrum)
+ * @param kernel_lenght     Kernel lenght (up to fft_lenght / 2 + 1)
+ * @param fft_lenght        Transform lenght (power of two, up to MAX_SIGNAL_LENGHT; 2 to 4 times
+ *                          the kernel lenght is usually the fastest)
+ * @param buffer            Buffer of FAST_CONV_BUFFER_LENGHT(fft_lenght) floats, or NULL to allocate it from the heap
+ * @return true             Convolution initialized
+ * @return false            Invalid lenghts or not enough memory
+ */
+bool FastConvInit(fast_conv_t * conv, const float * kernel, uint16_t kernel_lenght, uint16_t fft_lenght, float * buffer);
+
+/**
+ * @brief Release a streaming convolution (frees the buffer if it was allocated by FastConvInit)
+ *
+ * @param conv              Convolution instance
+ */
+void FastConvDeinit(fast_conv_t * conv);
+
+/**
+ * @brief Clear the samples and the tail of a streaming convolution
+ *
+ * @param conv              Convolution instance
+ */
+void FastConvReset(fast_conv_t * conv);
+
+/**
+ * @brief Push samples to a streaming convolution
+ *
+ * Output sample i is the convolution output of the input sample pushed
+ * block_lenght samples before (zeros at the start).
+ *
+ * @param conv              Convolution instance
+ * @param input_signal      Input samples
+ * @param output_signal     Output samples (can be the same as input)
+ * @param signal_lenght     Number of samples of both signals (any lenght)
+ */
+void FastConvProcess(fast_conv_t * conv, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Convolution of two signals (same result as dsps_conv_f32)
+ *
+ * @param signal            First signal
+ * @param signal_lenght     Lenght of signal
+ * @param kernel            Second signal
+ * @param kernel_lenght     Lenght of kernel
+ * @param output            Result (of lenght = signal_lenght + kernel_lenght - 1)
+ * @param work              Work buffer of 2 * N floats, N = power of two >= signal_lenght + kernel_lenght - 1
+ * @return true             Done
+ * @return false            Result longer than MAX_SIGNAL_LENGHT
+ */
+bool FastConvolve(const float * signal, uint16_t signal_lenght, const float * kernel, uint16_t kernel_lenght,
+    float * output, float * work);
+
+/**
+ * @brief Cross-correlation of two signals (same result as dsps_ccorr_f32 if signal_lenght >= pattern_lenght)
+ *
+ * Output n is the sum of signal[k + n - (pattern_lenght - 1)] * pattern[k], so the
+ * maximum is at n = pattern_lenght - 1 + d when signal is pattern delayed d samples
+ * (i.e. the delay between the red and IR channels of a PPG).
+ *
+ * @param signal            First signal
+ * @param signal_lenght     Lenght of signal
+ * @param pattern           Second signal
+ * @param pattern_lenght    Lenght of pattern
+ * @param output            Result (of lenght = signal_lenght + pattern_lenght - 1)
+ * @param work              Work buffer of 2 * N floats, N = power of two >= signal_lenght + pattern_lenght - 1
+ * @return true             Done
+ * @return false            Result longer than MAX_SIGNAL_LENGHT
+ */
+bool FastCorrelate(const float * signal, uint16_t signal_lenght, const float * pattern, uint16_t pattern_lenght,
+    float * output, float * work);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FAST_CONV_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,158 @@
+#ifndef FAST_MATH_H_
+#define FAST_MATH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Fast_Math Fast Math
+ */
+
+/** \brief Table based approximations of sin, cos, exp, log and sqrt
+ *
+ * The ESP32-C6 has no FPU: libm functions (and any double constant in an
+ * expression) run as soft float routines, often in double precision. These
+ * functions reduce the argument with integer operations on the float bits or
+ * on a fixed point phase, and interpolate linearly between two entries of a
+ * constant table (stored in flash, generated by tools/fast_math_tables.py):
+ *
+ * | Function               | Table                           | Max error                             |
+ * |:-----------------------|:--------------------------------|:--------------------------------------|
+ * | FastSinf, FastCosf     | 257 values of a quarter turn    | 5e-6 + 6e-8 * abs(x) (absolute)       |
+ * | FastSinQ15, FastCosQ15 | 257 values in Q15               | 1.1 LSB                               |
+ * | FastExp2f              | 257 values of 2^f, f in [0, 1)  | 1.1e-6 (relative)                     |
+ * | FastExpf               | FastExp2f(x * log2(e))          | 1.2e-6 + 6e-8 * abs(x) (relative)     |
+ * | FastLog2f              | 257 values of log2(1 + m)       | 3e-6 + 6e-8 * abs(y) (absolute)       |
+ * | FastLogf, FastLog10f   | FastLog2f scaled                | 2e-6, 1e-6 + 1e-7 * abs(y) (absolute) |
+ * | FastSqrtf              | 257 values of sqrt in [1, 4)    | 2e-6 (relative)                       |
+ * | FastPowf               | FastExp2f(y * FastLog2f(x))     | 1.2e-6 + 2.1e-6 * abs(y) + 1e-7 * abs(y * log2(x)) (relative) |
+ *
+ * where y is the result of the logarithms. The linear interpolation error of
+ * a segment of width h is h^2 / 8 times the max of |f''| in it, the terms
+ * proportional to the argument or to the result come from the float rounding
+ * of the argument reduction and of the result. The bounds are checked by the
+ * golden tests.
+ *
+ * @note Arguments out of range are not checked beyond the cases of each
+ * function (i.e. no NaN handling): they are meant for signal processing hot
+ * paths and table generation, not as a libm replacement.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define FAST_MATH_SIN_TABLE     256     /*!< Segments of a quarter turn */
+#define FAST_MATH_EXP_TABLE     256     /*!< Segments of 2^f, f in [0, 1) */
+#define FAST_MATH_LOG_TABLE     256     /*!< Segments of log2(m), m in [1, 2) */
+#define FAST_MATH_SQRT_TABLE    128     /*!< Segments of sqrt(m) in [1, 2) and in [2, 4) */
+
+#define FAST_MATH_Q15_TURN      65536   /*!< Phase of a turn of FastSinQ15 and FastCosQ15 */
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Sine
+ *
+ * @param x             Angle (rad, abs(x) < 2e6)
+ * @return sin(x)
+ */
+float FastSinf(float x);
+
+/**
+ * @brief Cosine
+ *
+ * @param x             Angle (rad, abs(x) < 2e6)
+ * @return cos(x)
+ */
+float FastCosf(float x);
+
+/**
+ * @brief Sine of a phase in Q15
+ *
+ * @param phase         Phase (FAST_MATH_Q15_TURN per turn, wraps around)
+ * @return sin(2 * pi * phase / FAST_MATH_Q15_TURN) in Q15 (-32767 to 32767)
+ */
+int16_t FastSinQ15(uint16_t phase);
+
+/**
+ * @brief Cosine of a phase in Q15
+ *
+ * @param phase         Phase (FAST_MATH_Q15_TURN per turn, wraps around)
+ * @return cos(2 * pi * phase / FAST_MATH_Q15_TURN) in Q15 (-32767 to 32767)
+ */
+int16_t FastCosQ15(uint16_t phase);
+
+/**
+ * @brief Power of two
+ *
+ * @param x             Exponent
+ * @return 2^x (0 under 2^-126, infinity over 2^128)
+ */
+float FastExp2f(float x);
+
+/**
+ * @brief Exponential
+ *
+ * @param x             Exponent
+ * @return e^x
+ */
+float FastExpf(float x);
+
+/**
+ * @brief Base 2 logarithm
+ *
+ * @param x             Value
+ * @return log2(x) (-infinity for x <= 0 or denormals)
+ */
+float FastLog2f(float x);
+
+/**
+ * @brief Natural logarithm
+ *
+ * @param x             Value
+ * @return ln(x) (-infinity for x <= 0)
+ */
+float FastLogf(float x);
+
+/**
+ * @brief Base 10 logarithm
+ *
+ * @param x             Value
+ * @return log10(x) (-infinity for x <= 0)
+ */
+float FastLog10f(float x);
+
+/**
+ * @brief Square root
+ *
+ * @param x             Value
+ * @return sqrt(x) (0 for x <= 0 or denormals)
+ */
+float FastSqrtf(float x);
+
+/**
+ * @brief Power
+ *
+ * @param x             Base
+ * @param y             Exponent
+ * @return x^y (0 for x <= 0)
+ */
+float FastPowf(float x, float y);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FAST_MATH_H_ */
+
+/*==================[end of file]============================================*/
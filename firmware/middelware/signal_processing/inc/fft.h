@@ -16,6 +16,13 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Real input FFT (N/2 points complex FFT + split)  						|
+ * | 14/10/2026 | FFT plans with cached window (fft_plan_t)       						|
+ * | 14/10/2026 | Magnitude modes (squared, approx, dB) and bands  						|
+ * | 14/10/2026 | Fixed point (Q15) FFT on raw ADC samples        						|
+ * | 14/10/2026 | Plans own their work buffer (concurrent plans)  						|
+ * | 15/10/2026 | Public real FFT and inverse real FFT (packed spectrum)				|
+ * | 15/10/2026 | Windows, dB and magnitude with the fast math tables					|
  * 
  **/
 
@@ -24,7 +31,44 @@
 #include <stdbool.h>
 /*==================[macros]=================================================*/
 #define MAX_SIGNAL_LENGHT   2048
+#define FFT_Q15_INPUT_SHIFT 3       /*!< Left shift of 12 bits ADC samples to Q15 (one bit of headroom) */
+/** @brief Number of floats of the buffer needed by an FFT plan of lenght n (window + work buffer) */
+#define FFT_PLAN_BUFFER_LENGHT(n)   (2 * (n))
 /*==================[typedef]================================================*/
+/**
+ * @brief Analysis window types
+ */
+typedef enum fft_window {
+    FFT_WINDOW_HANN = 0,    /*!< Hann window (default) */
+    FFT_WINDOW_BLACKMAN,    /*!< Blackman window (lower side lobes) */
+    FFT_WINDOW_FLAT_TOP,    /*!< Flat-top window (accurate amplitude) */
+} fft_window_t;
+
+/**
+ * @brief Magnitude output modes
+ */
+typedef enum fft_magnitude {
+    FFT_MAG_LINEAR = 0,     /*!< Magnitude (one sqrtf per bin) */
+    FFT_MAG_SQUARED,        /*!< Squared magnitude (power, no sqrt) */
+    FFT_MAG_APPROX,         /*!< Approximated magnitude (alpha max plus beta min, error < 4%) */
+    FFT_MAG_DB,             /*!< Magnitude in dB (20*log10, fast approximation, error < 0.05 dB) */
+} fft_magnitude_t;
+
+/**
+ * @brief FFT plan: window coefficients computed once and reused on every transform
+ * 
+ * @note Each plan has its own work buffer, so different plans can be used at the
+ * same time from different tasks (twiddle tables are shared and read only).
+ */
+typedef struct {
+    uint16_t signal_lenght;     /*!< Lenght of the signal (power of two, up to MAX_SIGNAL_LENGHT) */
+    fft_window_t window;        /*!< Window type */
+    float scale;                /*!< Magnitude scale factor (includes window coherent gain) */
+    fft_magnitude_t magnitude;  /*!< Magnitude output mode */
+    float * wind;               /*!< Window coefficients (of lenght = signal_lenght) */
+    float * work;               /*!< Work buffer (of lenght = signal_lenght) */
+    bool allocated;             /*!< Buffer allocated by FFTPlanInit */
+} fft_plan_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -32,6 +76,8 @@
 /**
  * @brief Initialize the FFT calculation module
  * 
+ * @note Must be called once (before using FFT plans from any task).
+ * 
  * @return true     FFT initialized
  * @return false    Not possible to initialize FFT
  */
@@ -42,12 +88,116 @@ bool FFTInit(void);
  * 
  * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
  * 
+ * @note  A Hann window is used. It is only computed again when signal_lenght changes.
+ * 
+ * @note  An internal plan is used: this function must not be called from different
+ * tasks at the same time (use one plan per task instead).
+ * 
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
  * @param signal_lenght     Lenght of signal arrays
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Initialize the fixed point (Q15) FFT calculation
+ * 
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTQ15Init(void);
+
+/**
+ * @brief Calculates the FFT magnitude of raw ADC samples in fixed point (Q15)
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT).
+ * A Hann window is used. Output has the same scale as FFTMagnitude() applied to
+ * (signal - offset), in ADC counts.
+ * 
+ * @param signal            Array with raw 12 bits ADC samples (of lenght = signal_lenght)
+ * @param offset            Value subtracted from every sample (i.e. 2048 for mid scale)
+ * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal array
+ */
+void FFTMagnitudeQ15(const uint16_t * signal, uint16_t offset, uint16_t * fft, uint16_t signal_lenght);
+
+/**
+ * @brief Initialize an FFT plan (computes the window coefficients)
+ * 
+ * @param plan              FFT plan
+ * @param signal_lenght     Lenght of signal arrays (power of two, with maximun value = MAX_SIGNAL_LENGHT)
+ * @param window            Window type
+ * @param buffer            Buffer for window and work data (of lenght = FFT_PLAN_BUFFER_LENGHT(signal_lenght)),
+ *                          or NULL to allocate it from the heap
+ * @return true             Plan initialized
+ * @return false            Invalid lenght or not enough memory
+ */
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght, fft_window_t window, float * buffer);
+
+/**
+ * @brief Release an FFT plan (frees the buffer if it was allocated by FFTPlanInit)
+ * 
+ * @param plan              FFT plan
+ */
+void FFTPlanDeinit(fft_plan_t * plan);
+
+/**
+ * @brief Calculates the Fast Fourier Transform magnitude of a given signal using a plan
+ * 
+ * @param plan              FFT plan
+ * @param signal            Array with signal values (of lenght = plan->signal_lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = plan->signal_lenght / 2)
+ */
+void FFTPlanMagnitude(fft_plan_t * plan, const float * signal, float * fft);
+
+/**
+ * @brief Select the magnitude output mode of a plan (FFT_MAG_LINEAR after FFTPlanInit)
+ * 
+ * @param plan              FFT plan
+ * @param magnitude         Magnitude output mode
+ */
+void FFTPlanSetMagnitude(fft_plan_t * plan, fft_magnitude_t magnitude);
+
+/**
+ * @brief Real FFT in place (no window, no scaling)
+ * 
+ * @note On return data holds X[k] for k = 0 .. N/2 - 1 as complex pairs (re, im),
+ * except data[1], that holds the real X[N/2] (X[0] and X[N/2] are real).
+ * 
+ * @param data              Signal (of lenght = signal_lenght), replaced by its packed spectrum
+ * @param signal_lenght     Lenght of signal array (power of two, from 4 up to MAX_SIGNAL_LENGHT)
+ */
+void FFTRealForward(float * data, uint16_t signal_lenght);
+
+/**
+ * @brief Inverse real FFT in place (scaled by 1 / signal_lenght, so it undoes FFTRealForward)
+ * 
+ * @param data              Packed spectrum (format of FFTRealForward), replaced by the signal
+ * @param signal_lenght     Lenght of signal array (power of two, from 4 up to MAX_SIGNAL_LENGHT)
+ */
+void FFTRealInverse(float * data, uint16_t signal_lenght);
+
+/**
+ * @brief Generate logarithmically spaced band edges (i.e. for vumeter bars)
+ * 
+ * @note Every band has at least one bin. DC (bin 0) is not included.
+ * 
+ * @param edges             Array to store band edges (of lenght = n_bands + 1)
+ * @param bins              Number of FFT bins (signal_lenght / 2)
+ * @param n_bands           Number of bands
+ */
+void FFTLogBandsInit(uint16_t * edges, uint16_t bins, uint8_t n_bands);
+
+/**
+ * @brief Average FFT bins in bands
+ * 
+ * @param fft               Array with FFT magnitude values
+ * @param edges             Band edges (band i goes from bin edges[i] to edges[i + 1] - 1)
+ * @param n_bands           Number of bands
+ * @param bands             Array to store bands values (of lenght = n_bands)
+ */
+void FFTBands(const float * fft, const uint16_t * edges, uint8_t n_bands, float * bands);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
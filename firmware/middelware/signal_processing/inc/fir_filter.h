@@ -0,0 +1,253 @@
+#ifndef FIR_FILTER_H_
+#define FIR_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FIR_Filter FIR Filter
+ */
+
+/** \brief FIR filters: float instances, windowed-sinc design, decimators and
+ * fixed point (Q15) filters working on raw ADC samples
+ * 
+ * Float instances (fir_filter_t) run esp-dsp dsps_fir_f32, with the coefficients
+ * in esp-dsp order (coeffs[0] applies to the oldest sample). The designed filters
+ * are symmetric (linear phase, delay of (n_taps - 1) / 2 samples), so the order
+ * does not matter for them.
+ * 
+ * Decimators (fir_decimator_t) store every input sample but only compute one
+ * output every factor samples: n_taps / factor multiplications per input sample
+ * (the cost of a polyphase decimator), with any block lenght and the phase kept
+ * between blocks. I.e. 20 kHz piezo captures down to 1 kHz for analysis.
+ * 
+ * Fixed point filters (fir_filter_q15_t) store the coefficients in Q15 and
+ * accumulate the products in 32 bits, so no float conversion is needed (ESP32-C6
+ * has no FPU).
+ * 
+ * The delay lines of decimators and fixed point filters are stored twice
+ * (2 * n_taps samples), so the taps needed for each output are always contiguous
+ * in memory and the inner loop has no wrap around.
+ * 
+ * @note With 12 bits samples the Q15 accumulator can not overflow while the sum of
+ * the absolute values of the coefficients is less than 16.
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Float instances, windowed-sinc design and decimators					|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define FIR_Q15_SHIFT       15  /*!< Coefficients format: Q1.15 */
+#define FIR_DELAY_LENGHT(n_taps)            ((n_taps) + 4)  /*!< Delay line of a float filter (esp-dsp needs 4 extra samples) */
+#define FIR_DECIMATOR_DELAY_LENGHT(n_taps)  (2 * (n_taps))  /*!< Delay line of a decimator */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Float FIR filter instance
+ */
+typedef struct {
+    float *coeffs;          /*!< Coefficients (n_taps values, esp-dsp order) */
+    float *delay;           /*!< Delay line (FIR_DELAY_LENGHT(n_taps) samples, provided by the user) */
+    uint16_t n_taps;        /*!< Number of coefficients */
+    uint16_t pos;           /*!< Position of the next sample in the delay line */
+} fir_filter_t;
+
+/**
+ * @brief Float FIR decimator instance
+ */
+typedef struct {
+    const float *coeffs;    /*!< Coefficients (n_taps values, coeffs[0] applies to the newest sample) */
+    float *delay;           /*!< Delay line (FIR_DECIMATOR_DELAY_LENGHT(n_taps) samples, provided by the user) */
+    uint16_t n_taps;        /*!< Number of coefficients */
+    uint16_t pos;           /*!< Position of the newest sample in the delay line */
+    uint8_t factor;         /*!< Decimation factor */
+    uint8_t phase;          /*!< Samples stored since the last output */
+} fir_decimator_t;
+
+/**
+ * @brief Fixed point FIR filter instance
+ */
+typedef struct {
+    const int16_t *coeffs;  /*!< Coefficients in Q15 (n_taps values) */
+    int16_t *delay;         /*!< Delay line (2 * n_taps samples, provided by the user) */
+    uint16_t n_taps;        /*!< Number of coefficients */
+    uint16_t pos;           /*!< Position of the newest sample in the delay line */
+} fir_filter_q15_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design a low pass filter (Blackman windowed sinc, unity gain at DC)
+ * 
+ * @param coeffs        Coefficients array (n_taps values)
+ * @param n_taps        Number of coefficients (odd gives an integer delay)
+ * @param sample_frec   Sample frequency (Hz)
+ * @param cut_frec      Cut frequency, -6 dB (Hz)
+ * @return true         Filter designed
+ * @return false        Invalid parameters
+ */
+bool FIRFilterLowPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float cut_frec);
+
+/**
+ * @brief Design a high pass filter (spectral inversion of the low pass)
+ * 
+ * @param coeffs        Coefficients array (n_taps values)
+ * @param n_taps        Number of coefficients (must be odd)
+ * @param sample_frec   Sample frequency (Hz)
+ * @param cut_frec      Cut frequency, -6 dB (Hz)
+ * @return true         Filter designed
+ * @return false        Invalid parameters
+ */
+bool FIRFilterHiPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float cut_frec);
+
+/**
+ * @brief Design a band pass filter (difference of two low pass filters)
+ * 
+ * @param coeffs        Coefficients array (n_taps values)
+ * @param n_taps        Number of coefficients (odd gives an integer delay)
+ * @param sample_frec   Sample frequency (Hz)
+ * @param low_frec      Low cut frequency, -6 dB (Hz)
+ * @param high_frec     High cut frequency, -6 dB (Hz)
+ * @return true         Filter designed
+ * @return false        Invalid parameters
+ */
+bool FIRFilterBandPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float low_frec, float high_frec);
+
+/**
+ * @brief Initialize a float FIR filter instance
+ * 
+ * @param filter        Filter instance
+ * @param coeffs        Coefficients (must remain valid while the filter is used)
+ * @param delay         Delay line array of FIR_DELAY_LENGHT(n_taps) samples
+ * @param n_taps        Number of coefficients
+ * @return true         Filter initialized
+ * @return false        Invalid parameters
+ */
+bool FIRFilterInit(fir_filter_t * filter, float * coeffs, float * delay, uint16_t n_taps);
+
+/**
+ * @brief Clear the delay line of a float filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void FIRFilterReset(fir_filter_t * filter);
+
+/**
+ * @brief Apply a float FIR filter to a signal array
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FIRFilterProcess(fir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Initialize a decimator instance
+ * 
+ * @param decimator     Decimator instance
+ * @param coeffs        Anti-alias filter coefficients, i.e. low pass at sample_frec / (2 * factor) 
+ *                      (must remain valid while the decimator is used)
+ * @param delay         Delay line array of FIR_DECIMATOR_DELAY_LENGHT(n_taps) samples
+ * @param n_taps        Number of coefficients
+ * @param factor        Decimation factor (1 to 255)
+ * @return true         Decimator initialized
+ * @return false        Invalid parameters
+ */
+bool FIRDecimatorInit(fir_decimator_t * decimator, const float * coeffs, float * delay, uint16_t n_taps, uint8_t factor);
+
+/**
+ * @brief Clear the delay line and the phase of a decimator instance
+ * 
+ * @param decimator     Decimator instance
+ */
+void FIRDecimatorReset(fir_decimator_t * decimator);
+
+/**
+ * @brief Filter and decimate a block of samples
+ * 
+ * @param decimator         Decimator instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Decimated signal array (can be the same as input)
+ * @param signal_lenght     Number of input samples (any lenght, the phase is kept between blocks)
+ * @return Number of output samples
+ */
+uint16_t FIRDecimatorProcess(fir_decimator_t * decimator, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Filter and decimate a block of raw ADC samples
+ * 
+ * @param decimator         Decimator instance
+ * @param input_signal      Raw ADC samples
+ * @param output_signal     Decimated signal array (same scale as ADC samples, minus offset)
+ * @param signal_lenght     Number of input samples (any lenght, the phase is kept between blocks)
+ * @param offset            Value subtracted from every sample (i.e. 2048 for mid scale)
+ * @return Number of output samples
+ */
+uint16_t FIRDecimatorProcessU16(fir_decimator_t * decimator, const uint16_t * input_signal, float * output_signal, 
+    uint16_t signal_lenght, uint16_t offset);
+
+/**
+ * @brief Convert float coefficients to Q15 (saturated to +-1)
+ * 
+ * @param coeffs        Float coefficients
+ * @param coeffs_q15    Q15 coefficients
+ * @param n_taps        Number of coefficients
+ */
+void FIRFilterCoeffsToQ15(const float * coeffs, int16_t * coeffs_q15, uint16_t n_taps);
+
+/**
+ * @brief Initialize a fixed point FIR filter instance
+ * 
+ * @param filter        Filter instance
+ * @param coeffs_q15    Coefficients in Q15 (must remain valid while the filter is used)
+ * @param delay         Delay line array of 2 * n_taps samples
+ * @param n_taps        Number of coefficients
+ * @return true         Filter initialized
+ * @return false        Invalid parameters
+ */
+bool FIRFilterQ15Init(fir_filter_q15_t * filter, const int16_t * coeffs_q15, int16_t * delay, uint16_t n_taps);
+
+/**
+ * @brief Clear the delay line of a filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void FIRFilterQ15Reset(fir_filter_q15_t * filter);
+
+/**
+ * @brief Apply a fixed point FIR filter to a signal array
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FIRFilterQ15Process(fir_filter_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply a fixed point FIR filter directly to raw ADC samples
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Raw ADC samples
+ * @param output_signal     Filtered signal array (same scale as ADC samples, minus offset)
+ * @param signal_lenght     Number of samples of both signals
+ * @param offset            Value subtracted from every sample (i.e. 2048 for mid scale)
+ */
+void FIRFilterQ15ProcessU16(fir_filter_q15_t * filter, const uint16_t * input_signal, int16_t * output_signal, int16_t signal_lenght, uint16_t offset);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FIR_FILTER_H_ */
+
+/*==================[end of file]============================================*/
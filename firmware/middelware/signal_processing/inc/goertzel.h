@@ -0,0 +1,107 @@
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Goertzel Goertzel
+ */
+
+/** \brief Energy detection at a few frequencies (multi-bin Goertzel algorithm)
+ * 
+ * Each bin needs one multiplication and two additions per sample, so monitoring
+ * a handful of frequencies (mains hum, tones) is much cheaper than a full FFT.
+ * 
+ * Results are given as power normalized to the squared amplitude of a sine wave
+ * (a sine of amplitude A at a bin frequency gives A^2).
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define GOERTZEL_MAX_BINS   8   /*!< Max frequencies per detector */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Goertzel detector instance
+ */
+typedef struct {
+    float coeff[GOERTZEL_MAX_BINS];     /*!< 2*cos(2*pi*f/fs) of each bin */
+    float s1[GOERTZEL_MAX_BINS];        /*!< State s[n-1] of each bin */
+    float s2[GOERTZEL_MAX_BINS];        /*!< State s[n-2] of each bin */
+    float power[GOERTZEL_MAX_BINS];     /*!< Power of each bin in the last complete block */
+    uint8_t n_bins;                     /*!< Number of bins */
+    uint16_t block_lenght;              /*!< Samples per block (streaming API) */
+    uint16_t count;                     /*!< Samples accumulated in the current block */
+} goertzel_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Goertzel detector
+ * 
+ * @note Frequency resolution is about sample_frec / block_lenght.
+ * 
+ * @param goertzel          Detector instance
+ * @param sample_frec       Sample frequency
+ * @param freqs             Array of frequencies to detect (of lenght = n_bins)
+ * @param n_bins            Number of frequencies (up to GOERTZEL_MAX_BINS)
+ * @param block_lenght      Samples per result (streaming API)
+ * @return true             Detector initialized
+ * @return false            Invalid parameters
+ */
+bool GoertzelInit(goertzel_t * goertzel, float sample_frec, const float * freqs, uint8_t n_bins, uint16_t block_lenght);
+
+/**
+ * @brief Clear the detector state (discards the current block)
+ * 
+ * @param goertzel          Detector instance
+ */
+void GoertzelReset(goertzel_t * goertzel);
+
+/**
+ * @brief Calculate the power of every bin in a signal array (block API)
+ * 
+ * @note The current streaming block is discarded.
+ * 
+ * @param goertzel          Detector instance
+ * @param signal            Array with signal values
+ * @param signal_lenght     Lenght of signal array
+ * @param power             Array to store the power of each bin (of lenght = n_bins, can be NULL)
+ */
+void GoertzelBlock(goertzel_t * goertzel, const float * signal, uint16_t signal_lenght, float * power);
+
+/**
+ * @brief Add one sample (streaming API)
+ * 
+ * @param goertzel          Detector instance
+ * @param x                 New sample
+ * @return true             A block was completed (new power values available)
+ * @return false            Block not complete
+ */
+bool GoertzelStep(goertzel_t * goertzel, float x);
+
+/**
+ * @brief Power of every bin in the last complete block
+ * 
+ * @param goertzel          Detector instance
+ * @return Array of n_bins power values
+ */
+const float * GoertzelGetPower(goertzel_t * goertzel);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GOERTZEL_H_ */
+
+/*==================[end of file]============================================*/
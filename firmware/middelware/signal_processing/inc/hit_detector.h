@@ -0,0 +1,204 @@
+#ifndef HIT_DETECTOR_H_
+#define HIT_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Hit_Detector Hit Detector
+ */
+
+/** \brief Velocity sensitive hit detection for piezo pads
+ * 
+ * Each pad runs a state machine over the samples of its (DC free) signal:
+ * 
+ * - IDLE: the rectified signal is compared with the trigger threshold.
+ * - SCAN: once a hit starts, the peak is tracked during the scan window. At
+ *   the end of the window the hit is reported with a velocity (1 to 127, the
+ *   MIDI range) proportional to the peak.
+ * - MASK: new hits are ignored during the retrigger mask (the pad rings after
+ *   every hit).
+ * 
+ * After the mask the threshold starts at the level of the last peak and decays
+ * exponentially to the trigger threshold, so the tail of a strong hit does not
+ * trigger again but a new hit, stronger than the remaining vibration, does.
+ * 
+ * Samples are processed in blocks (i.e. one frame of the ADC in continuous
+ * mode) and the state is kept between blocks.
+ * 
+ * Mechanical coupling between pads makes a hit also trigger its neighbours. The
+ * cross-talk stage compares the hits of all pads found in the same block pass
+ * (and the last hits of the previous blocks): a hit whose peak is below ratio
+ * times the peak of a hit of another pad within the window is dropped.
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 14/10/2026 | Cross-talk suppression between pads	         						|
+ * | 14/10/2026 | Onset sample of the hits (latency measurement)         				|
+ * | 15/10/2026 | Cross-talk stage for up to 16 pads (external SPI ADCs)				|
+ * | 15/10/2026 | Adaptive trigger threshold (noise_floor.h)							|
+ * | 15/10/2026 | Cross-talk ratio of each pad											|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define HIT_MAX_VELOCITY    127     /*!< Velocity of hits with peak >= max_level */
+#define HIT_MAX_PADS        16      /*!< Max pads of the cross-talk stage (i.e. two 8 channels SPI ADCs) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Detector states
+ */
+typedef enum {
+    HIT_IDLE,                   /*!< Waiting for a hit */
+    HIT_SCAN,                   /*!< Tracking the peak of a hit */
+    HIT_MASK,                   /*!< Ignoring retriggers */
+} hit_state_t;
+
+/**
+ * @brief Hit detector configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency (Hz) */
+    float threshold;            /*!< Trigger threshold (signal units, i.e. mV) */
+    float max_level;            /*!< Peak that gives HIT_MAX_VELOCITY (signal units) */
+    float scan_time;            /*!< Scan window for the peak (ms) */
+    float mask_time;            /*!< Retrigger mask after the scan window (ms) */
+    float decay_time;           /*!< Time constant of the re-arm threshold decay (ms) */
+} hit_detector_config_t;
+
+/**
+ * @brief Hit detected
+ */
+typedef struct {
+    uint16_t pos;               /*!< Sample of the block where the hit was reported (end of the scan window) */
+    int32_t onset;              /*!< Sample of the block where the signal crossed the threshold (negative: previous blocks) */
+    uint8_t velocity;           /*!< Velocity (1 to HIT_MAX_VELOCITY) */
+    float peak;                 /*!< Peak of the rectified signal (signal units) */
+} hit_event_t;
+
+/**
+ * @brief Hit detector instance (one per pad)
+ */
+typedef struct {
+    float threshold;            /*!< Trigger threshold */
+    float max_level;            /*!< Peak that gives HIT_MAX_VELOCITY */
+    float velocity_gain;        /*!< (HIT_MAX_VELOCITY - 1) / (max_level - threshold) */
+    float decay;                /*!< Re-arm threshold decay per sample */
+    uint16_t scan_lenght;       /*!< Scan window (samples) */
+    uint16_t mask_lenght;       /*!< Retrigger mask (samples) */
+    hit_state_t state;          /*!< Current state */
+    uint16_t count;             /*!< Samples in the current state */
+    float peak;                 /*!< Peak of the current hit */
+    float rearm;                /*!< Re-arm threshold (decays to threshold) */
+} hit_detector_t;
+
+/**
+ * @brief Cross-talk suppression instance (shared by all the pads)
+ */
+typedef struct {
+    uint8_t pads;                       /*!< Number of pads */
+    uint16_t window;                    /*!< Max distance between coupled hits (samples) */
+    float ratio[HIT_MAX_PADS];          /*!< Hits of a pad below its ratio * peak of the other pad are dropped */
+    uint32_t time;                      /*!< Samples processed (start of the current block) */
+    uint32_t last_time[HIT_MAX_PADS];   /*!< Time of the last hit kept of each pad */
+    float last_peak[HIT_MAX_PADS];      /*!< Peak of the last hit kept of each pad (0: none) */
+} hit_crosstalk_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a hit detector
+ * 
+ * @param detector          Detector instance
+ * @param config            Configuration
+ * @return true             Detector initialized
+ * @return false            Invalid parameters
+ */
+bool HitDetectorInit(hit_detector_t * detector, const hit_detector_config_t * config);
+
+/**
+ * @brief Change the trigger threshold (i.e. once per block, from NoiseFloorProcess())
+ * 
+ * The velocity keeps going from 1 at the new threshold to HIT_MAX_VELOCITY at
+ * max_level. A hit in progress is not affected.
+ * 
+ * @param detector          Detector instance
+ * @param threshold         Trigger threshold (signal units)
+ * @return true             Threshold changed
+ * @return false            Invalid threshold (not between 0 and max_level)
+ */
+bool HitDetectorSetThreshold(hit_detector_t * detector, float threshold);
+
+/**
+ * @brief Go back to the IDLE state (discards the hit in progress)
+ * 
+ * @param detector          Detector instance
+ */
+void HitDetectorReset(hit_detector_t * detector);
+
+/**
+ * @brief Process a block of samples
+ * 
+ * @param detector          Detector instance
+ * @param signal            Signal samples (DC free, i.e. high pass filtered)
+ * @param signal_lenght     Lenght of signal array
+ * @param hits              Array to store the hits detected (can be NULL)
+ * @param max_hits          Lenght of hits array (extra hits are counted but not stored)
+ * @return Number of hits detected in the block
+ */
+uint8_t HitDetectorProcess(hit_detector_t * detector, const float * signal, uint16_t signal_lenght, 
+    hit_event_t * hits, uint8_t max_hits);
+
+/**
+ * @brief Initialize the cross-talk suppression stage
+ * 
+ * @param crosstalk         Cross-talk instance
+ * @param sample_frec       Sample frequency (Hz)
+ * @param pads              Number of pads (up to HIT_MAX_PADS)
+ * @param window_time       Max distance between coupled hits (ms)
+ * @param ratio             Peak ratio (0 to 1) below which the weaker hit is dropped (all the pads)
+ * @return true             Stage initialized
+ * @return false            Invalid parameters
+ */
+bool HitCrosstalkInit(hit_crosstalk_t * crosstalk, float sample_frec, uint8_t pads, float window_time, float ratio);
+
+/**
+ * @brief Change the cross-talk ratio of a pad (i.e. a pad mounted on the same stand as others)
+ * 
+ * @param crosstalk         Cross-talk instance
+ * @param pad               Pad whose hits are judged with the ratio
+ * @param ratio             Peak ratio (0 to 1) below which its hits are dropped
+ * @return true             Ratio changed
+ * @return false            Invalid parameters
+ */
+bool HitCrosstalkSetRatio(hit_crosstalk_t * crosstalk, uint8_t pad, float ratio);
+
+/**
+ * @brief Drop the cross-talk hits of a block
+ * 
+ * Call it once per block, after HitDetectorProcess() of every pad. The hits
+ * dropped are removed from the arrays.
+ * 
+ * @param crosstalk         Cross-talk instance
+ * @param hits              Hits array of each pad (of lenght = pads)
+ * @param n_hits            Number of hits stored in each array, updated (of lenght = pads)
+ * @param block_lenght      Samples of the block
+ * @return Number of hits dropped
+ */
+uint8_t HitCrosstalkProcess(hit_crosstalk_t * crosstalk, hit_event_t * const * hits, uint8_t * n_hits, 
+    uint16_t block_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HIT_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,12 +16,40 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Multi-instance filters (iir_filter_t)           						|
+ * | 14/10/2026 | Single pass cascaded kernel and band pass       						|
+ * | 14/10/2026 | Per sample streaming filter (IIRFilterStep)     						|
+ * | 14/10/2026 | Fixed point (Q31) filter instances              						|
+ * | 15/10/2026 | Compile time coefficient tables (tools/iir_design.py) 				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define IIR_MAX_SECTIONS    8   /*!< Max 2nd order sections per filter (up to 16th order) */
+#define IIR_SOS_COEFFS      5   /*!< Coefficients per section: b0, b1, b2, a1, a2 */
+#define IIR_Q_SHIFT         29  /*!< Fixed point coefficients format: Q2.29 (range +-4) */
+#define IIR_Q_GUARD         8   /*!< Fractional bits added to the samples inside the fixed point filter */
+
+/**
+ * @brief One 2nd order section on sample x (direct form II transposed), x = output
+ * 
+ * @note Used by IIRFilterStep() and by the headers of tools/iir_design.py, that
+ * unroll the cascade of a fixed filter over a const coefficient table.
+ * 
+ * @param c             Section coefficients: b0, b1, b2, a1, a2
+ * @param s             Section delay line (2 floats)
+ * @param x             Sample (float lvalue)
+ */
+#define IIR_SECTION_STEP(c, s, x)                           \
+    do {                                                    \
+        float y_ = (c)[0] * (x) + (s)[0];                   \
+        (s)[0] = (c)[1] * (x) - (c)[3] * y_ + (s)[1];       \
+        (s)[1] = (c)[2] * (x) - (c)[4] * y_;                \
+        (x) = y_;                                           \
+    } while(0)
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,8 +58,74 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+/**
+ * @brief IIR filter instance: cascade of 2nd order sections with its own state
+ * 
+ * @note Coefficients and delays of all sections are stored contiguously, so an array
+ * of filters (one per channel) keeps all the state of a multichannel pass together.
+ */
+typedef struct {
+    float coeffs[IIR_MAX_SECTIONS][IIR_SOS_COEFFS];    /*!< Sections coefficients (esp-dsp biquad format) */
+    float delay[IIR_MAX_SECTIONS][2];                  /*!< Sections delay lines */
+    uint8_t n_sections;                                /*!< Number of sections in use */
+} iir_filter_t;
+
+/**
+ * @brief Fixed point IIR filter instance (Q2.29 coefficients, 64 bits accumulator)
+ * 
+ * @note Sections are computed in direct form I with IIR_Q_GUARD extra fractional
+ * bits in the state, so the rounding noise stays low even with poles close to 1.
+ */
+typedef struct {
+    int32_t coeffs[IIR_MAX_SECTIONS][IIR_SOS_COEFFS];  /*!< Sections coefficients in Q2.29: b0, b1, b2, a1, a2 */
+    int32_t delay[IIR_MAX_SECTIONS][4];                /*!< Sections state: x[n-1], x[n-2], y[n-1], y[n-2] */
+    uint8_t n_sections;                                /*!< Number of sections in use */
+} iir_filter_q31_t;
 /*==================[external data declaration]==============================*/
 
+/*==================[inline functions definition]============================*/
+/**
+ * @brief Filter one sample with a filter instance (streaming, no block latency)
+ * 
+ * All sections are applied to the sample (direct form II transposed). Being inline,
+ * each section coefficients stay in registers for the whole step.
+ * 
+ * @param filter        Filter instance
+ * @param x             Input sample
+ * @return Filtered sample
+ */
+static inline float IIRFilterStep(iir_filter_t * filter, float x){
+    for(uint8_t k = 0; k < filter->n_sections; k++){
+        IIR_SECTION_STEP(filter->coeffs[k], filter->delay[k], x);
+    }
+    return x;
+}
+
+/**
+ * @brief Filter one sample with a fixed point filter instance (streaming)
+ * 
+ * @param filter        Fixed point filter instance
+ * @param x             Input sample (any integer scale, up to +-2^22)
+ * @return Filtered sample (same scale as input)
+ */
+static inline int32_t IIRFilterQ31Step(iir_filter_q31_t * filter, int32_t x){
+    x = (int32_t)((uint32_t)x << IIR_Q_GUARD);
+    for(uint8_t k = 0; k < filter->n_sections; k++){
+        const int32_t *c = filter->coeffs[k];
+        int32_t *s = filter->delay[k];
+        int64_t acc = (int64_t)c[0] * x + (int64_t)c[1] * s[0] + (int64_t)c[2] * s[1]
+                    - (int64_t)c[3] * s[2] - (int64_t)c[4] * s[3];
+        int32_t y = (int32_t)((acc + (1 << (IIR_Q_SHIFT - 1))) >> IIR_Q_SHIFT);
+        s[1] = s[0];
+        s[0] = x;
+        s[3] = s[2];
+        s[2] = y;
+        x = y;
+    }
+    return (x + (1 << (IIR_Q_GUARD - 1))) >> IIR_Q_GUARD;
+}
+
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Initialize a 2nd order Butterwotrh Low Pass Filter
@@ -69,6 +163,138 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
  */
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
 
+/**
+ * @brief Apply the hi pass and then the low pass filter to a signal array in a single pass
+ * 
+ * Same result as HiPassFilter() followed by LowPassFilter(), but all the sections
+ * of both filters are applied to each sample, so the signal is read only once.
+ * 
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void BandPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Initialize an empty filter instance (no sections, output = input)
+ * 
+ * @param filter        Filter instance
+ */
+void IIRFilterInit(iir_filter_t * filter);
+
+/**
+ * @brief Append a 2nd order section to a filter instance
+ * 
+ * @param filter        Filter instance
+ * @param coeffs        Section coefficients: b0, b1, b2, a1, a2 (a0 = 1)
+ * @return true         Section added
+ * @return false        Filter already has IIR_MAX_SECTIONS sections
+ */
+bool IIRFilterAddSection(iir_filter_t * filter, const float * coeffs);
+
+/**
+ * @brief Design a Butterworth Low Pass Filter instance
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (even, from 2 to 2 * IIR_MAX_SECTIONS)
+ */
+void IIRFilterLowPassInit(iir_filter_t * filter, float sample_frec, float cut_frec, uint8_t order);
+
+/**
+ * @brief Design a Butterworth Hi Pass Filter instance
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (even, from 2 to 2 * IIR_MAX_SECTIONS)
+ */
+void IIRFilterHiPassInit(iir_filter_t * filter, float sample_frec, float cut_frec, uint8_t order);
+
+/**
+ * @brief Design a Butterworth Band Pass Filter instance (hi pass and low pass cascade)
+ * 
+ * @note The filter uses 2 * order / 2 sections, limited to IIR_MAX_SECTIONS.
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param low_frec      Lower cut-off frequency (hi pass)
+ * @param high_frec     Upper cut-off frequency (low pass)
+ * @param order         Order of each of the hi pass and low pass filters
+ */
+void IIRFilterBandPassInit(iir_filter_t * filter, float sample_frec, float low_frec, float high_frec, uint8_t order);
+
+/**
+ * @brief Clear the delay lines of a filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void IIRFilterReset(iir_filter_t * filter);
+
+/**
+ * @brief Apply a filter instance to a signal array
+ * 
+ * All sections are applied to each sample in a single pass (direct form II transposed).
+ * 
+ * @note Input and output arrays can be the same (in place filtering)
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IIRFilterProcess(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply an array of filter instances, one per channel, to multiple signals
+ * 
+ * @param filters           Array of filter instances (of lenght = channels)
+ * @param channels          Number of channels
+ * @param input_signals     Array of input signal arrays
+ * @param output_signals    Array of filtered signal arrays
+ * @param signal_lenght     Number of samples of every signal
+ */
+void IIRFilterProcessChannels(iir_filter_t * filters, uint8_t channels, float * const * input_signals, 
+                              float * const * output_signals, int16_t signal_lenght);
+
+/**
+ * @brief Initialize a fixed point filter instance from a designed float instance
+ * 
+ * @note Design the filter with any of the IIRFilter...Init() functions, then convert it.
+ * 
+ * @param filter_q31    Fixed point filter instance
+ * @param filter        Float filter instance
+ */
+void IIRFilterQ31Init(iir_filter_q31_t * filter_q31, const iir_filter_t * filter);
+
+/**
+ * @brief Clear the state of a fixed point filter instance
+ * 
+ * @param filter        Fixed point filter instance
+ */
+void IIRFilterQ31Reset(iir_filter_q31_t * filter);
+
+/**
+ * @brief Apply a fixed point filter instance to a signal array
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IIRFilterQ31Process(iir_filter_q31_t * filter, const int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply a fixed point filter instance directly to raw ADC samples
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Raw ADC samples
+ * @param output_signal     Filtered signal array (same scale as ADC samples, signed)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IIRFilterQ31ProcessU16(iir_filter_q31_t * filter, const uint16_t * input_signal, int32_t * output_signal, int16_t signal_lenght);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,148 @@
+#ifndef IMU_FUSION_H_
+#define IMU_FUSION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup IMU_Fusion IMU Fusion
+ */
+
+/** \brief Orientation estimation from accelerometer and gyroscope frames
+ *
+ * Frames are processed in blocks (i.e. the frames read from the MPU6050 FIFO
+ * with MPU6050_readFIFOStream) and the orientation is published at a fixed
+ * rate, a divisor of the sample rate. Three filters can be selected at init:
+ *
+ * - IMU_FUSION_MAHONY: complementary filter with a PI correction of the gyro
+ *   rate towards the gravity measured by the accelerometer. Cheapest.
+ * - IMU_FUSION_MADGWICK: gradient descent correction of the quaternion with
+ *   gain beta. Similar cost and accuracy.
+ * - IMU_FUSION_EKF: esp-dsp ekf_imu13states (13 states: quaternion, gyro bias
+ *   and magnetometer model). Estimates the gyro bias, but each frame costs a
+ *   13x13 covariance prediction and a measurement update. Without a
+ *   magnetometer the magnetic measurements get a huge variance, so they don't
+ *   correct the state.
+ *
+ * Yaw is not observable without a magnetometer: it's the integral of the
+ * (bias corrected) z rotation in every mode.
+ *
+ * The cost per frame of each mode on the ESP32-C6 is measured by the
+ * ej_dsp_benchmark example (ImuFusionProcess rows, Param = mode).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Fusion filters
+ */
+typedef enum {
+    IMU_FUSION_MAHONY,          /*!< Mahony complementary filter */
+    IMU_FUSION_MADGWICK,        /*!< Madgwick gradient descent filter */
+    IMU_FUSION_EKF,             /*!< esp-dsp 13 states extended Kalman filter */
+} imu_fusion_mode_t;
+
+/**
+ * @brief Raw accel and gyro frame (same layout as mpu6050_frame_t)
+ */
+typedef struct {
+    int16_t accel[3];           /*!< X, Y, Z acceleration (LSB) */
+    int16_t gyro[3];            /*!< X, Y, Z rotation (LSB) */
+} imu_frame_t;
+
+/**
+ * @brief Fusion configuration
+ */
+typedef struct {
+    imu_fusion_mode_t mode;     /*!< Filter */
+    float sample_frec;          /*!< Frame rate (Hz) */
+    float publish_frec;         /*!< Orientation output rate (Hz, rounded to a divisor of sample_frec) */
+    float accel_lsb;            /*!< Accelerometer sensitivity (LSB/g, i.e. 16384 for +/-2 g) */
+    float gyro_lsb;             /*!< Gyroscope sensitivity (LSB/(deg/s), i.e. 131 for +/-250 deg/s) */
+    float gain;                 /*!< Mahony Kp or Madgwick beta (0: default), not used by the EKF */
+} imu_fusion_config_t;
+
+/**
+ * @brief Orientation published
+ */
+typedef struct {
+    uint16_t pos;               /*!< Frame of the block where it was computed */
+    float q[4];                 /*!< Unit quaternion (w, x, y, z), sensor to earth frame */
+    float euler[3];             /*!< Roll, pitch and yaw (rad) */
+} imu_orientation_t;
+
+/**
+ * @brief Fusion instance
+ */
+typedef struct {
+    imu_fusion_mode_t mode;     /*!< Filter */
+    float dt;                   /*!< Frame period (s) */
+    float accel_scale;          /*!< g per LSB */
+    float gyro_scale;           /*!< rad/s per LSB */
+    float gain;                 /*!< Mahony Kp or Madgwick beta */
+    float ki;                   /*!< Mahony integral gain */
+    float integral[3];          /*!< Mahony integral of the error (rad/s) */
+    float q[4];                 /*!< Current quaternion (w, x, y, z) */
+    void * ekf;                 /*!< EKF instance (IMU_FUSION_EKF) */
+    uint16_t decimation;        /*!< Frames per published orientation */
+    uint16_t count;             /*!< Frames since the last published orientation */
+} imu_fusion_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a fusion instance (orientation starts at identity)
+ *
+ * @param fusion            Fusion instance
+ * @param config            Configuration
+ * @return true             Fusion initialized
+ * @return false            Invalid parameters or no memory for the EKF
+ */
+bool ImuFusionInit(imu_fusion_t * fusion, const imu_fusion_config_t * config);
+
+/**
+ * @brief Release a fusion instance (the EKF is allocated on the heap)
+ *
+ * @param fusion            Fusion instance
+ */
+void ImuFusionDeinit(imu_fusion_t * fusion);
+
+/**
+ * @brief Process a block of frames
+ *
+ * @param fusion            Fusion instance
+ * @param frames            Frames (i.e. read from the sensor FIFO)
+ * @param frames_lenght     Lenght of frames array
+ * @param out               Array to store the orientations published (can be NULL)
+ * @param max_out           Lenght of out array (extra orientations are counted but not stored)
+ * @return Number of orientations published in the block
+ */
+uint8_t ImuFusionProcess(imu_fusion_t * fusion, const imu_frame_t * frames, uint16_t frames_lenght,
+    imu_orientation_t * out, uint8_t max_out);
+
+/**
+ * @brief Roll, pitch and yaw of a quaternion
+ *
+ * @param q                 Unit quaternion (w, x, y, z)
+ * @param euler             Roll, pitch and yaw (rad)
+ */
+void ImuFusionEuler(const float * q, float * euler);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IMU_FUSION_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,144 @@
+#ifndef MEDIAN_FILTER_H_
+#define MEDIAN_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Median_Filter Median Filter
+ */
+
+/** \brief Running median of the last N samples (baseline wander and impulse noise)
+ *
+ * The median of a window rejects spikes shorter than half the window and
+ * follows steps without smearing them, so it is used to remove impulse noise
+ * (i.e. a window of 3 to 9 samples) and, with a window longer than the
+ * waves of the signal (i.e. 200 ms and 600 ms in cascade for an ECG), to
+ * estimate the baseline that is subtracted.
+ *
+ * Sorting the window on every sample costs N log N. Here the window is kept
+ * as two heaps around the median: a max-heap with the lower half and a
+ * min-heap with the upper half, both in a single array of N indexes
+ * centered on the median (negative positions are the max-heap, positive
+ * ones the min-heap). The new sample replaces the oldest one in its place
+ * of the heaps and is moved up or down, so each sample costs O(log N)
+ * comparisons and no memory is moved. Indexes are int16_t: the state of a
+ * window is 2 * N indexes plus the N samples, provided by the user.
+ *
+ * While the window is filling, the output is the median of the samples
+ * received. For an even window it is the mean of the two central samples.
+ *
+ * @note Float samples are compared as integers (with their bits reordered), so
+ * no soft float comparisons are done on the ESP32-C6. NaN are not handled.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MEDIAN_FILTER_MAX_WINDOW            INT16_MAX           /*!< Max samples of the window */
+#define MEDIAN_FILTER_INDEX_LENGHT(window)  (2 * (window))      /*!< Indexes of a window (heap and position of each sample) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Heaps of a window (shared by the float and int16 filters)
+ */
+typedef struct {
+    int16_t *heap;          /*!< Sample of each heap position (centered on the median) */
+    int16_t *pos;           /*!< Heap position of each sample */
+    uint16_t window;        /*!< Samples of the window */
+    uint16_t oldest;        /*!< Sample replaced next */
+    uint16_t count;         /*!< Samples in the window (less than window while filling) */
+} median_heap_t;
+
+/**
+ * @brief Float median filter instance
+ */
+typedef struct {
+    float *samples;         /*!< Samples of the window (window samples, provided by the user) */
+    median_heap_t heap;     /*!< Heaps */
+} median_filter_t;
+
+/**
+ * @brief int16 median filter instance (i.e. raw ADC samples)
+ */
+typedef struct {
+    int16_t *samples;       /*!< Samples of the window (window samples, provided by the user) */
+    median_heap_t heap;     /*!< Heaps */
+} median_filter_i16_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a float median filter
+ *
+ * @param filter        Filter instance
+ * @param samples       Array of window samples
+ * @param index         Array of MEDIAN_FILTER_INDEX_LENGHT(window) indexes
+ * @param window        Samples of the window (1 to MEDIAN_FILTER_MAX_WINDOW)
+ * @return true         Filter initialized
+ * @return false        Invalid window
+ */
+bool MedianFilterInit(median_filter_t * filter, float * samples, int16_t * index, uint16_t window);
+
+/**
+ * @brief Filter a block of samples
+ *
+ * @param filter        Filter instance
+ * @param input         Input samples
+ * @param output        Median of the window at each sample (can be the input array)
+ * @param lenght        Lenght of the arrays
+ */
+void MedianFilterProcess(median_filter_t * filter, const float * input, float * output, uint16_t lenght);
+
+/**
+ * @brief Empty the window of a float filter
+ *
+ * @param filter        Filter instance
+ */
+void MedianFilterReset(median_filter_t * filter);
+
+/**
+ * @brief Initialize an int16 median filter
+ *
+ * @param filter        Filter instance
+ * @param samples       Array of window samples
+ * @param index         Array of MEDIAN_FILTER_INDEX_LENGHT(window) indexes
+ * @param window        Samples of the window (1 to MEDIAN_FILTER_MAX_WINDOW)
+ * @return true         Filter initialized
+ * @return false        Invalid window
+ */
+bool MedianFilterI16Init(median_filter_i16_t * filter, int16_t * samples, int16_t * index, uint16_t window);
+
+/**
+ * @brief Filter a block of int16 samples
+ *
+ * @param filter        Filter instance
+ * @param input         Input samples
+ * @param output        Median of the window at each sample (can be the input array, the mean
+ *                      of two samples is rounded down)
+ * @param lenght        Lenght of the arrays
+ */
+void MedianFilterI16Process(median_filter_i16_t * filter, const int16_t * input, int16_t * output, uint16_t lenght);
+
+/**
+ * @brief Empty the window of an int16 filter
+ *
+ * @param filter        Filter instance
+ */
+void MedianFilterI16Reset(median_filter_i16_t * filter);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MEDIAN_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,135 @@
+#ifndef MFCC_H_
+#define MFCC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup MFCC MFCC
+ */
+
+/** \brief Mel frequency cepstral coefficients of spectrum frames (i.e. of each STFT frame)
+ *
+ * The features to tell apart the hits of a pad (rim or head), or simple audio
+ * events, with a small classifier:
+ *
+ *     mel(f) = 2595 * log10(1 + f / 700)
+ *     band(m) = sum over bins of w(m, k) * |X(k)|^2   (triangles, equally spaced in mel)
+ *     c(i) = sum over m of log(band(m)) * cos(pi * i * (m + 0.5) / n_mels)
+ *
+ * Adjacent triangles cross at half height, so each bin between two centers
+ * belongs to the rising side of one band and the falling side of the
+ * previous one, with weights w and 1 - w. MfccInit precomputes one weight per
+ * bin and the first bin of each center: a frame costs one multiplication and
+ * two additions per bin (no dense n_mels x bins matrix), n_mels logarithms and
+ * a DCT of n_mels points (dsps_dct_f32 of esp-dsp).
+ *
+ * c(0) is the loudness of the frame: to classify the timbre regardless of the
+ * velocity, leave it out (i.e. MfccClassify(&coeffs[1], ...)).
+ *
+ * Per STFT frame, with the squared magnitude of the STFT plan:
+ *
+ * @code
+ * static void StftFrame(const float * power, uint16_t bins, void * param){
+ *     MfccProcess(&mfcc, power, coeffs);
+ *     hit_type = MfccClassify(&coeffs[1], MFCC_COEFFS - 1, &centroids[0][0], 2);
+ * }
+ * ...
+ * STFTInit(&stft, 256, 64, FFT_WINDOW_HANN, stft_buffer, StftFrame, NULL);
+ * FFTPlanSetMagnitude(&stft.plan, FFT_MAG_SQUARED);
+ * MfccInit(&mfcc, &config, mfcc_buffer);
+ * @endcode
+ *
+ * @note FFTInit must be called before MfccProcess (the DCT uses the FFT tables).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MFCC_MAX_MELS   32      /*!< Max mel bands */
+#define MFCC_FLOOR      1e-10f  /*!< Added to the bands before the logarithm (silence) */
+
+/** @brief Number of floats of the weights buffer needed by frames of lenght n */
+#define MFCC_BUFFER_LENGHT(n)   ((n) / 2)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief MFCC configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency (Hz) */
+    uint16_t frame_lenght;      /*!< Samples per frame (spectrum of frame_lenght / 2 bins) */
+    uint8_t n_mels;             /*!< Mel bands (power of two, 4 to MFCC_MAX_MELS) */
+    uint8_t n_coeffs;           /*!< Coefficients (1 to n_mels) */
+    float min_frec;             /*!< Low edge of the first band (Hz) */
+    float max_frec;             /*!< High edge of the last band (Hz, up to sample_frec / 2) */
+} mfcc_config_t;
+
+/**
+ * @brief MFCC instance
+ */
+typedef struct {
+    float * weight;                         /*!< Weight of each bin in the rising side of its band */
+    uint16_t edge[MFCC_MAX_MELS + 2];       /*!< First bin of each center (and of the low and high edges) */
+    uint8_t n_mels;                         /*!< Mel bands */
+    uint8_t n_coeffs;                       /*!< Coefficients */
+    float work[2 * MFCC_MAX_MELS];          /*!< Bands and DCT work data */
+} mfcc_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an MFCC instance (filterbank weights)
+ *
+ * @param mfcc              MFCC instance
+ * @param config            Configuration
+ * @param buffer            Weights buffer (of lenght = MFCC_BUFFER_LENGHT(frame_lenght))
+ * @return true             MFCC initialized
+ * @return false            Invalid parameters
+ */
+bool MfccInit(mfcc_t * mfcc, const mfcc_config_t * config, float * buffer);
+
+/**
+ * @brief Mel bands (log) of a spectrum frame
+ *
+ * @param mfcc              MFCC instance
+ * @param power             Squared magnitude of the frame (frame_lenght / 2 bins, i.e. FFT_MAG_SQUARED)
+ * @param bands             Natural logarithm of each band (n_mels values)
+ */
+void MfccBands(mfcc_t * mfcc, const float * power, float * bands);
+
+/**
+ * @brief Coefficients of a spectrum frame
+ *
+ * @param mfcc              MFCC instance
+ * @param power             Squared magnitude of the frame (frame_lenght / 2 bins, i.e. FFT_MAG_SQUARED)
+ * @param coeffs            Coefficients (n_coeffs values)
+ */
+void MfccProcess(mfcc_t * mfcc, const float * power, float * coeffs);
+
+/**
+ * @brief Nearest centroid (squared euclidean distance) of a features vector
+ *
+ * @param features          Features (i.e. coefficients)
+ * @param n_features        Number of features
+ * @param centroids         Centroids of the classes (n_classes rows of n_features values, i.e. means of training hits)
+ * @param n_classes         Number of classes
+ * @return Index of the nearest class
+ */
+uint8_t MfccClassify(const float * features, uint8_t n_features, const float * centroids, uint8_t n_classes);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MFCC_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,134 @@
+#ifndef MIDI_H_
+#define MIDI_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup MIDI MIDI
+ */
+
+/** \brief MIDI messages for serial ports and BLE-MIDI packets
+ *
+ * Serial MIDI (i.e. 31250 bps) uses running status: a message with the same
+ * status byte as the previous one is sent without it, so consecutive note-on
+ * messages take 2 bytes instead of 3.
+ *
+ * BLE-MIDI packets (MIDI over Bluetooth LE specification) start with a header
+ * byte with the 6 high bits of a 13 bits millisecond timestamp, and each
+ * message is preceded by a timestamp byte with its 7 low bits. All the messages
+ * produced during a connection interval can be sent in one packet without
+ * losing their timing. The receiver detects the overflow of the low bits, so
+ * the messages of a packet must not be more than 127 ms apart.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Control change messages                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MIDI_NOTE_OFF           0x80    /*!< Note off status (+ channel) */
+#define MIDI_NOTE_ON            0x90    /*!< Note on status (+ channel) */
+#define MIDI_CONTROL_CHANGE     0xB0    /*!< Control change status (+ channel) */
+#define MIDI_CC_FOOT            4       /*!< Foot controller (hi-hat pedal: 0 open, 127 closed) */
+#define MIDI_DRUMS_CHANNEL      9       /*!< General MIDI percussion channel (channel 10) */
+#define MIDI_MSG_MAX_LENGHT     3       /*!< Bytes of a channel message (status + 2 data bytes) */
+
+#define BLE_MIDI_PACKET_SIZE    20      /*!< Max bytes of a BLE-MIDI packet (default ATT MTU - 3) */
+#define BLE_MIDI_TIME_MASK      0x1FFF  /*!< BLE-MIDI timestamps: 13 bits (ms) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Serial MIDI encoder (running status)
+ */
+typedef struct {
+    uint8_t status;             /*!< Status byte of the last message (0: none) */
+} midi_serial_t;
+
+/**
+ * @brief BLE-MIDI packet
+ */
+typedef struct {
+    uint8_t data[BLE_MIDI_PACKET_SIZE]; /*!< Packet bytes */
+    uint8_t lenght;                     /*!< Packet bytes used (0: empty) */
+    uint16_t time;                      /*!< Timestamp of the last message (ms, 13 bits) */
+} ble_midi_packet_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Build a note on message
+ *
+ * @param channel           Channel (0 to 15)
+ * @param note              Note number (0 to 127)
+ * @param velocity          Velocity (1 to 127, 0 is a note off)
+ * @param msg               Message (MIDI_MSG_MAX_LENGHT bytes)
+ * @return Message bytes
+ */
+uint8_t MidiNoteOn(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t * msg);
+
+/**
+ * @brief Build a control change message
+ *
+ * @param channel           Channel (0 to 15)
+ * @param controller        Controller number (0 to 119, i.e. MIDI_CC_FOOT)
+ * @param value             Value (0 to 127)
+ * @param msg               Message (MIDI_MSG_MAX_LENGHT bytes)
+ * @return Message bytes
+ */
+uint8_t MidiControlChange(uint8_t channel, uint8_t controller, uint8_t value, uint8_t * msg);
+
+/**
+ * @brief Initialize a serial encoder (the next message is sent with its status byte)
+ *
+ * @param midi              Serial encoder
+ */
+void MidiSerialInit(midi_serial_t * midi);
+
+/**
+ * @brief Encode a message for a serial port, omitting its status byte if it is the same as the previous one
+ *
+ * @param midi              Serial encoder
+ * @param msg               Message (i.e. from MidiNoteOn)
+ * @param lenght            Message bytes
+ * @param output            Bytes to send (up to lenght)
+ * @return Bytes to send
+ */
+uint8_t MidiSerialEncode(midi_serial_t * midi, const uint8_t * msg, uint8_t lenght, uint8_t * output);
+
+/**
+ * @brief Empty a BLE-MIDI packet
+ *
+ * @param packet            BLE-MIDI packet
+ */
+void BleMidiPacketInit(ble_midi_packet_t * packet);
+
+/**
+ * @brief Add a timestamped message to a BLE-MIDI packet
+ *
+ * A message older than the previous one of the packet takes its timestamp
+ * (timestamps of a packet can not go back).
+ *
+ * @param packet            BLE-MIDI packet
+ * @param time              Timestamp (ms, only the 13 low bits are used)
+ * @param msg               Message with its status byte
+ * @param lenght            Message bytes
+ * @return true             Message added
+ * @return false            The packet is full or the message is 128 ms or more after the previous one (send the packet and add it to a new one)
+ */
+bool BleMidiPacketAdd(ble_midi_packet_t * packet, uint16_t time, const uint8_t * msg, uint8_t lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MIDI_H_ */
+
+/*==================[end of file]============================================*/
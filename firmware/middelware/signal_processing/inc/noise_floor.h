@@ -0,0 +1,114 @@
+#ifndef NOISE_FLOOR_H_
+#define NOISE_FLOOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Noise_Floor Noise Floor
+ */
+
+/** \brief Running noise floor estimator for adaptive trigger thresholds
+ *
+ * Tracks the level of the background of a (DC free) signal, i.e. the stage
+ * vibration picked up by a piezo pad or the residual noise of a PPG, and
+ * places the trigger threshold k standard deviations above it:
+ *
+ *     r = |x| (skipped if over the threshold)
+ *     d = r - mean
+ *     mean = mean + alpha * d
+ *     var = (1 - alpha) * (var + alpha * d^2)
+ *     threshold = max(min_threshold, mean + k * sqrt(var))
+ *
+ * mean and var are exponentially weighted (time constant time_ms), with a
+ * constant cost per sample. The samples over the threshold (the hits) are
+ * left out, so only the tails of the hits raise the floor a little. A higher
+ * background still raises the threshold until it fits: the part of it below
+ * the threshold has a mean and a deviation proportional to the threshold, so
+ * for k over ~2 each update moves it up. The threshold is updated once per
+ * block (a single square root), so the detector fed with it (i.e.
+ * HitDetectorSetThreshold()) keeps a fixed threshold inside each block.
+ *
+ * One instance per channel (pad, PPG led).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Noise floor estimator instance (one per channel)
+ */
+typedef struct {
+    float alpha;                /*!< Weight of each sample (1 / time constant in samples) */
+    float k;                    /*!< Standard deviations of the threshold above the mean */
+    float min_threshold;        /*!< Lowest threshold (signal units) */
+    float mean;                 /*!< Mean of the rectified signal */
+    float var;                  /*!< Variance of the rectified signal */
+    float threshold;            /*!< Current threshold */
+} noise_floor_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a noise floor estimator (the threshold starts at min_threshold)
+ *
+ * @param nf                Estimator instance
+ * @param sample_frec       Sample frequency (Hz)
+ * @param time_ms           Time constant of the estimation (ms, i.e. 500 for pads)
+ * @param k                 Standard deviations of the threshold above the mean (i.e. 4)
+ * @param min_threshold     Lowest threshold (signal units, i.e. mV)
+ * @return true             Estimator initialized
+ * @return false            Invalid parameters
+ */
+bool NoiseFloorInit(noise_floor_t * nf, float sample_frec, float time_ms, float k, float min_threshold);
+
+/**
+ * @brief Forget the estimation (the threshold goes back to min_threshold)
+ *
+ * @param nf                Estimator instance
+ */
+void NoiseFloorReset(noise_floor_t * nf);
+
+/**
+ * @brief Change the lowest threshold, keeping the estimation (i.e. when a pad is tuned)
+ *
+ * @param nf                Estimator instance
+ * @param min_threshold     Lowest threshold (signal units)
+ */
+void NoiseFloorSetMinimum(noise_floor_t * nf, float min_threshold);
+
+/**
+ * @brief Update the estimation with a block of samples
+ *
+ * @param nf                Estimator instance
+ * @param signal            Signal samples (DC free, i.e. high pass filtered)
+ * @param signal_lenght     Lenght of signal array
+ * @return Threshold for the next block
+ */
+float NoiseFloorProcess(noise_floor_t * nf, const float * signal, uint16_t signal_lenght);
+
+/**
+ * @brief Current threshold
+ *
+ * @param nf                Estimator instance
+ * @return Threshold (signal units)
+ */
+float NoiseFloorThreshold(const noise_floor_t * nf);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* NOISE_FLOOR_H_ */
+
+/*==================[end of file]============================================*/
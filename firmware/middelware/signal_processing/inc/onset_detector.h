@@ -0,0 +1,131 @@
+#ifndef ONSET_DETECTOR_H_
+#define ONSET_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Onset_Detector Onset Detector
+ */
+
+/** \brief Spectral flux onset detector over the streaming STFT (stft.h)
+ *
+ * Each hop, the spectral flux is the sum of the increases of the magnitude
+ * of every bin from the previous frame:
+ *
+ *     flux(t) = sum over bins of max(0, |X(t, k)| - |X(t - 1, k)|)
+ *
+ * A hit raises many bins at once; the ringing of a pad only decays (the
+ * decreases are not counted), so it does not retrigger. A frame is an onset if
+ * its flux is a local maximum (one frame of latency) over the adaptive
+ * threshold
+ *
+ *     threshold + multiplier * mean of the flux of the last ONSET_HISTORY frames
+ *
+ * and at least min_gap after the previous onset. The flux of the hits is left
+ * out of the mean, so soft notes after (or between) loud ones are not masked
+ * by them.
+ *
+ * The cost is one FFT of frame_lenght samples per hop (approximated
+ * magnitudes, no square roots), not per sample. As a second stage of the hit
+ * detector it runs on the signal of the pad decimated (i.e. to 2 kHz, frames
+ * of 64 samples and hops of 16, 8 ms): the onset sample resolution is one hop.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "stft.h"
+/*==================[macros]=================================================*/
+#define ONSET_HISTORY   16      /*!< Frames of the mean of the adaptive threshold */
+
+/** @brief Number of floats of the work buffer needed by an onset detector of frame lenght n */
+#define ONSET_BUFFER_LENGHT(n)  (STFT_BUFFER_LENGHT(n) + (n) / 2)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Onset detector configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency (Hz) */
+    uint16_t frame_lenght;      /*!< Samples per frame (power of two) */
+    uint16_t hop_lenght;        /*!< New samples between frames (onset resolution) */
+    float threshold;            /*!< Fixed part of the threshold (flux units: signal units times bins) */
+    float multiplier;           /*!< Gain of the mean flux in the threshold (i.e. 1.5) */
+    float min_gap;              /*!< Min time between onsets (ms) */
+} onset_detector_config_t;
+
+/**
+ * @brief Onset detector instance (one per channel)
+ */
+typedef struct {
+    stft_t stft;                        /*!< Streaming spectrum */
+    float * previous;                   /*!< Magnitude of the previous frame */
+    float history[ONSET_HISTORY];       /*!< Flux of the last frames (without the onsets) */
+    float mean;                         /*!< Mean of history */
+    uint8_t head;                       /*!< Position of the next flux in history */
+    float flux[2];                      /*!< Flux of the last frame and the one before */
+    float threshold;                    /*!< Fixed part of the threshold */
+    float multiplier;                   /*!< Gain of the mean flux */
+    uint32_t min_gap;                   /*!< Min frames between onsets */
+    uint32_t last_onset;                /*!< Frame of the last onset */
+    uint16_t onsets;                    /*!< Onsets found by the current OnsetDetectorProcess */
+    void (*func_p)(uint32_t sample, float flux, void * param);  /*!< Function called on each onset */
+    void * param_p;                     /*!< Parameter passed to func_p */
+} onset_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an onset detector
+ *
+ * @param od                Onset detector instance
+ * @param config            Configuration
+ * @param buffer            Work buffer (of lenght = ONSET_BUFFER_LENGHT(frame_lenght))
+ * @param func_p            Function called with the sample of each onset (since the last reset) and its flux
+ * @param param_p           Parameter passed to func_p
+ * @return true             Onset detector initialized
+ * @return false            Invalid parameters
+ */
+bool OnsetDetectorInit(onset_detector_t * od, const onset_detector_config_t * config, float * buffer,
+                       void (*func_p)(uint32_t sample, float flux, void * param), void * param_p);
+
+/**
+ * @brief Push a block of samples (of any size)
+ *
+ * @param od                Onset detector instance
+ * @param samples           New samples
+ * @param lenght            Number of new samples
+ * @return Number of onsets found
+ */
+uint16_t OnsetDetectorProcess(onset_detector_t * od, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Flux of the last frame (i.e. to plot it and tune the threshold)
+ *
+ * @param od                Onset detector instance
+ * @return Spectral flux
+ */
+float OnsetDetectorGetFlux(const onset_detector_t * od);
+
+/**
+ * @brief Discard the stored samples and the flux history (the sample count starts again)
+ *
+ * @param od                Onset detector instance
+ */
+void OnsetDetectorReset(onset_detector_t * od);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ONSET_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,128 @@
+#ifndef PAD_SETTINGS_H_
+#define PAD_SETTINGS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Pad_Settings Pad Settings
+ */
+
+/** \brief Tuning of the pads: compact versioned blob and text commands
+ *
+ * The settings of every pad (threshold, max level, sensitivity, cross-talk
+ * ratio and velocity curve) are packed in a blob to be stored in NVS
+ * (nvs_mcu.h) and loaded at boot, so tuning a pad needs no rebuild:
+ *
+ * | Bytes      | Content                                                |
+ * |:----------:|:-------------------------------------------------------|
+ * | 2          | PAD_SETTINGS_MAGIC                                     |
+ * | 1          | PAD_SETTINGS_VERSION                                   |
+ * | 1          | Number of pads                                         |
+ * | 18 per pad | Threshold and max level (mV, uint16), sensitivity      |
+ * |            | (Q8.8, uint16), cross-talk ratio (/255), curve (/32),  |
+ * |            | flags (PAD_SETTINGS_CALIBRATED), number of points of   |
+ * |            | the custom curve and PAD_SETTINGS_MAX_POINTS points    |
+ * | 2          | CRC16-CCITT of the previous bytes (TelemetryCRC16())   |
+ *
+ * Multi-byte fields are little endian. A blob with another magic, version or
+ * number of pads, or a wrong CRC, is rejected and the defaults are kept.
+ *
+ * Text commands (one per line, from UART or BLE) change the settings live:
+ *
+ * - "set <pad> <field> <value>", field: threshold, max, sens, xtalk or curve
+ * - "points <pad> <v0> ... <vn>": custom velocity curve, velocities (1 to 127)
+ *   at evenly spaced peaks from threshold to max (2 to PAD_SETTINGS_MAX_POINTS),
+ *   used instead of curve; with no velocities, back to curve
+ * - "save": store the settings
+ * - "defaults": go back to the defaults
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Custom velocity curves (layout 2)                 					|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define PAD_SETTINGS_MAGIC      0x5350  /*!< "PS" */
+#define PAD_SETTINGS_VERSION    2       /*!< Layout of the blob */
+#define PAD_SETTINGS_HEADER     4       /*!< Bytes before the pads */
+#define PAD_SETTINGS_PAD_SIZE   18      /*!< Bytes of each pad */
+#define PAD_SETTINGS_MAX_POINTS 8       /*!< Max points of a custom velocity curve */
+#define PAD_SETTINGS_CALIBRATED 0x01    /*!< Flag: threshold measured at boot or set by a command (no boot calibration) */
+
+/** Bytes of the blob of n pads */
+#define PAD_SETTINGS_SIZE(n)    (PAD_SETTINGS_HEADER + (n) * PAD_SETTINGS_PAD_SIZE + 2)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Settings of a pad
+ */
+typedef struct {
+    float threshold;            /*!< Trigger threshold (mV, the minimum if it is adaptive) */
+    float max_level;            /*!< Peak that gives the max velocity (mV) */
+    float sensitivity;          /*!< Gain of the signal of the pad (1: none, up to 255) */
+    float crosstalk;            /*!< Hits below this ratio of a hit of another pad are dropped (0 to 1) */
+    float curve;                /*!< Velocity curve: velocity = (peak velocity) ^ curve (1: linear, up to 7.9) */
+    uint8_t flags;              /*!< PAD_SETTINGS_CALIBRATED */
+    uint8_t points;             /*!< Points of the custom velocity curve (0: curve, or 2 to PAD_SETTINGS_MAX_POINTS) */
+    uint8_t point[PAD_SETTINGS_MAX_POINTS]; /*!< Velocities of the custom curve (velocity_curve.h) */
+} pad_settings_t;
+
+/**
+ * @brief Result of a text command
+ */
+typedef enum {
+    PAD_COMMAND_ERROR,          /*!< Unknown command or invalid value (nothing changed) */
+    PAD_COMMAND_SET,            /*!< A setting changed */
+    PAD_COMMAND_SAVE,           /*!< Store the settings */
+    PAD_COMMAND_DEFAULTS,       /*!< Go back to the defaults */
+} pad_command_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Pack the settings of the pads in a blob
+ *
+ * @param settings          Settings of each pad (of lenght = pads)
+ * @param pads              Number of pads
+ * @param blob              Blob (of PAD_SETTINGS_SIZE(pads) bytes)
+ * @return Bytes of the blob
+ */
+uint16_t PadSettingsEncode(const pad_settings_t * settings, uint8_t pads, uint8_t * blob);
+
+/**
+ * @brief Unpack the settings of the pads from a blob
+ *
+ * @param settings          Settings of each pad (of lenght = pads), unchanged if the blob is rejected
+ * @param pads              Number of pads
+ * @param blob              Blob
+ * @param lenght            Bytes of the blob
+ * @return true             Settings loaded
+ * @return false            Other layout, number of pads or lenght, or wrong CRC
+ */
+bool PadSettingsDecode(pad_settings_t * settings, uint8_t pads, const uint8_t * blob, uint16_t lenght);
+
+/**
+ * @brief Execute a text command
+ *
+ * @param settings          Settings of each pad (of lenght = pads)
+ * @param pads              Number of pads
+ * @param line              Command (without line terminator)
+ * @return Command executed (SAVE and DEFAULTS are done by the caller)
+ */
+pad_command_t PadSettingsCommand(pad_settings_t * settings, uint8_t pads, const char * line);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* PAD_SETTINGS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,235 @@
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Pipeline Pipeline
+ */
+
+/** \brief Zero-copy processing pipelines (acquisition -> DSP -> sinks)
+ *
+ * Samples travel in blocks taken from a pool (pipeline_pool_t) and passed by
+ * reference from stage to stage. A stage is one of:
+ *
+ * - PIPELINE_IN_PLACE: modifies the block samples (i.e. an IIR or FIR filter).
+ * - PIPELINE_TRANSFORM: writes its result to a new block of its pool (i.e. the
+ *   FFT magnitude), the input block is released.
+ * - PIPELINE_SINK: only reads the block (i.e. send it by BLE or UART, draw it).
+ *
+ * A stage can feed up to PIPELINE_MAX_OUTPUTS stages: the same block is given
+ * to all of them with a reference count, with no copies. The block returns to
+ * its pool when the last stage releases it. An in place stage only copies the
+ * block (to a block of its pool) if another stage still holds it: blocks are
+ * given to the outputs in the order they were connected, so connecting the
+ * sinks first and the in place stage last avoids the copy.
+ *
+ * @code
+ * PipelinePoolInit(&pool, 64, 4, NULL);
+ * PipelineStageInit(&raw, PIPELINE_SINK, SendRaw, NULL, NULL);
+ * PipelineStageInit(&filter, PIPELINE_IN_PLACE, PipelineIIRStage, &iir, &pool);
+ * PipelineStageInit(&send, PIPELINE_SINK, SendFiltered, NULL, NULL);
+ * PipelineStageInit(&source, PIPELINE_IN_PLACE, NULL, NULL, NULL);
+ * PipelineConnect(&source, &raw);          // raw samples to the PC
+ * PipelineConnect(&source, &filter);       // and filtered, without copies
+ * PipelineConnect(&filter, &send);
+ * ...
+ * pipeline_block_t * block = PipelineAlloc(&pool);
+ * AnalogBlockToFloat(adc_block, CH1, block->data);
+ * block->lenght = 64;
+ * PipelinePush(&source, block);
+ * @endcode
+ *
+ * Stages run in the task that calls PipelinePush. Blocks can be allocated and
+ * released from any task or ISR (lock free pool), so a sink can queue the
+ * block to another task and release it there.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+/*==================[macros]=================================================*/
+#define PIPELINE_MAX_BLOCKS     32      /*!< Max blocks of a pool */
+#define PIPELINE_MAX_OUTPUTS    4       /*!< Max outputs of a stage */
+
+/** @brief Number of floats of the buffer of a pool of n_blocks blocks of block_lenght samples */
+#define PIPELINE_POOL_BUFFER_LENGHT(block_lenght, n_blocks)     ((block_lenght) * (n_blocks))
+
+/*==================[typedef]================================================*/
+typedef struct pipeline_pool_s pipeline_pool_t;
+
+/**
+ * @brief Block of samples
+ */
+typedef struct {
+    float * data;               /*!< Samples */
+    uint16_t lenght;            /*!< Valid samples */
+    uint16_t capacity;          /*!< Max samples (block lenght of the pool) */
+    uint32_t time;              /*!< Time or sample number of the first sample (set by the source) */
+    uint8_t channel;            /*!< Channel (set by the source) */
+    atomic_uint_fast8_t refs;   /*!< Stages holding the block */
+    pipeline_pool_t * pool;     /*!< Pool of the block */
+} pipeline_block_t;
+
+/**
+ * @brief Pool of blocks
+ */
+struct pipeline_pool_s {
+    pipeline_block_t blocks[PIPELINE_MAX_BLOCKS];   /*!< Blocks */
+    uint16_t block_lenght;                          /*!< Samples of each block */
+    uint8_t n_blocks;                               /*!< Number of blocks */
+    atomic_uint_fast32_t free;                      /*!< Free blocks (bit i: block i) */
+    float * buffer;                                 /*!< Samples of all the blocks */
+    bool allocated;                                 /*!< Buffer allocated by PipelinePoolInit */
+};
+
+/**
+ * @brief Stage type
+ */
+typedef enum {
+    PIPELINE_IN_PLACE,          /*!< Modifies the block samples */
+    PIPELINE_TRANSFORM,         /*!< Writes its result to a new block */
+    PIPELINE_SINK,              /*!< Only reads the block */
+} pipeline_stage_type_t;
+
+/**
+ * @brief Stage function
+ *
+ * @param ctx               Stage context (i.e. the filter instance)
+ * @param in                Input block (the block to modify for in place stages)
+ * @param out               Output block of transform stages (capacity samples, the function sets
+ *                          its lenght), NULL for the other stages
+ * @return true             Forward the result to the outputs of the stage
+ * @return false            Drop it (i.e. a decimator that has not completed a block yet)
+ */
+typedef bool (*pipeline_func_t)(void * ctx, pipeline_block_t * in, pipeline_block_t * out);
+
+/**
+ * @brief Stage
+ */
+typedef struct pipeline_stage_s {
+    pipeline_stage_type_t type;                             /*!< Stage type */
+    pipeline_func_t func;                                   /*!< Stage function (NULL: forward the blocks) */
+    void * ctx;                                             /*!< Stage context */
+    pipeline_pool_t * pool;                                 /*!< Pool of the new blocks (transform and in place stages) */
+    struct pipeline_stage_s * outputs[PIPELINE_MAX_OUTPUTS];/*!< Next stages */
+    uint8_t n_outputs;                                      /*!< Number of next stages */
+    uint32_t blocks;                                        /*!< Blocks processed */
+    uint32_t copies;                                        /*!< Blocks copied (in place stage on a shared block) */
+    uint32_t dropped;                                       /*!< Blocks lost because the pool was empty */
+} pipeline_stage_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a pool of blocks
+ *
+ * @param pool              Pool
+ * @param block_lenght      Samples of each block
+ * @param n_blocks          Number of blocks (up to PIPELINE_MAX_BLOCKS)
+ * @param buffer            Buffer of PIPELINE_POOL_BUFFER_LENGHT(block_lenght, n_blocks) floats, or NULL to allocate it from the heap
+ * @return true             Pool initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool PipelinePoolInit(pipeline_pool_t * pool, uint16_t block_lenght, uint8_t n_blocks, float * buffer);
+
+/**
+ * @brief Release a pool (frees the buffer if it was allocated by PipelinePoolInit)
+ *
+ * @param pool              Pool
+ */
+void PipelinePoolDeinit(pipeline_pool_t * pool);
+
+/**
+ * @brief Free blocks of a pool
+ *
+ * @param pool              Pool
+ * @return Number of free blocks
+ */
+uint8_t PipelinePoolFree(pipeline_pool_t * pool);
+
+/**
+ * @brief Take a block from a pool (from any task or ISR)
+ *
+ * @param pool              Pool
+ * @return Block (lenght 0, one reference), or NULL if the pool is empty
+ */
+pipeline_block_t * PipelineAlloc(pipeline_pool_t * pool);
+
+/**
+ * @brief Add a reference to a block (i.e. before queuing it to another task)
+ *
+ * @param block             Block
+ */
+void PipelineRetain(pipeline_block_t * block);
+
+/**
+ * @brief Remove a reference to a block (it returns to its pool with the last one)
+ *
+ * @param block             Block
+ */
+void PipelineRelease(pipeline_block_t * block);
+
+/**
+ * @brief Initialize a stage (with no outputs)
+ *
+ * @param stage             Stage
+ * @param type              Stage type
+ * @param func              Stage function (NULL: the stage only forwards the blocks, i.e. a source)
+ * @param ctx               Context of the function
+ * @param pool              Pool of the new blocks (needed by transform stages, and by in place
+ *                          stages to copy shared blocks; NULL for sinks)
+ */
+void PipelineStageInit(pipeline_stage_t * stage, pipeline_stage_type_t type, pipeline_func_t func, void * ctx,
+    pipeline_pool_t * pool);
+
+/**
+ * @brief Connect the output of a stage to the input of another
+ *
+ * @param from              Stage
+ * @param to                Next stage
+ * @return true             Connected
+ * @return false            from has PIPELINE_MAX_OUTPUTS outputs or is a sink
+ */
+bool PipelineConnect(pipeline_stage_t * from, pipeline_stage_t * to);
+
+/**
+ * @brief Process a block by a stage and all the stages after it
+ *
+ * @param stage             Stage
+ * @param block             Block (the caller's reference is given to the stage)
+ */
+void PipelinePush(pipeline_stage_t * stage, pipeline_block_t * block);
+
+/**
+ * @brief In place stage function for an IIR filter (ctx: iir_filter_t)
+ */
+bool PipelineIIRStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out);
+
+/**
+ * @brief In place stage function for a FIR filter (ctx: fir_filter_t)
+ */
+bool PipelineFIRStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out);
+
+/**
+ * @brief Transform stage function for the FFT magnitude (ctx: fft_plan_t, blocks of plan->signal_lenght
+ * samples give plan->signal_lenght / 2 magnitudes)
+ */
+bool PipelineFFTStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* PIPELINE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,151 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS Detector
+ */
+
+/** \brief Streaming QRS detector for ECG signals (Pan-Tompkins)
+ *
+ * Works on the band limited ECG (i.e. the output of HiPassFilter() and
+ * LowPassFilter(), 1 to 30 Hz). Every sample goes through:
+ *
+ * - Derivative: 5 points, (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8.
+ * - Squaring.
+ * - Moving window integration: running sum over window_time (~ the width of
+ *   the QRS complex), one add and one subtract per sample.
+ *
+ * Every local maximum of the integrated signal is a peak. During the first
+ * learn_time the peaks are only used to set the thresholds; after that a peak
+ * above THRESHOLD1 = NPKI + (SPKI - NPKI) / 4 is a QRS complex, otherwise it
+ * is noise. SPKI and NPKI (signal and noise peak levels) are updated with
+ * every peak. Peaks within the refractory time of a QRS are ignored.
+ *
+ * If no QRS is found in 1.66 times the average RR interval, the highest noise
+ * peak since the last QRS is taken as a QRS if it is above THRESHOLD1 / 2
+ * (search back). Only that peak is kept, so the cost per sample is O(1).
+ *
+ * The R peak is the maximum of the absolute value of the input while the
+ * integrated signal rises, so its time does not depend on the window delay.
+ * Beats are reported when the integrated signal peak is found (about
+ * window_time after the R peak), or later if found by the search back.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define QRS_MAX_WINDOW      64      /*!< Max samples of the integration window (150 ms up to 420 Hz) */
+#define QRS_RR_AVERAGE      8       /*!< RR intervals averaged for the heart rate and the search back */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief QRS detector configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency (Hz) */
+    float window_time;          /*!< Integration window (ms, typ. 150) */
+    float refractory_time;      /*!< Peaks ignored after a QRS (ms, typ. 200) */
+    float learn_time;           /*!< Initial thresholds learning (ms, typ. 2000) */
+} qrs_detector_config_t;
+
+/**
+ * @brief Beat detected
+ */
+typedef struct {
+    uint32_t time;              /*!< Sample of the R peak, counted from QRSDetectorInit() or QRSDetectorReset() */
+    int32_t pos;                /*!< Sample of the block of the R peak (negative: previous blocks) */
+    float amplitude;            /*!< Absolute value of the signal at the R peak (signal units) */
+    float rr;                   /*!< RR interval (ms, 0 for the first beat) */
+    float heart_rate;           /*!< Instantaneous heart rate, 60000 / rr (bpm, 0 for the first beat) */
+} qrs_beat_t;
+
+/**
+ * @brief QRS detector instance
+ */
+typedef struct {
+    float sample_frec;                  /*!< Sample frequency (Hz) */
+    uint16_t window;                    /*!< Integration window (samples) */
+    uint16_t refractory;                /*!< Refractory time (samples) */
+    uint32_t learn;                     /*!< Learning time (samples) */
+    uint32_t time;                      /*!< Samples processed */
+    float x[4];                         /*!< Last input samples (derivative) */
+    float squared[QRS_MAX_WINDOW];      /*!< Squared derivative in the window */
+    uint16_t index;                     /*!< Oldest sample of the window */
+    float sum;                          /*!< Integrated signal */
+    float last_sum;                     /*!< Integrated signal of the previous sample */
+    bool rising;                        /*!< Integrated signal rising */
+    float r_amplitude;                  /*!< Max abs input since the integrated signal started to rise */
+    uint32_t r_time;                    /*!< Time of r_amplitude */
+    float spki;                         /*!< Signal peak level */
+    float npki;                         /*!< Noise peak level */
+    float learn_max;                    /*!< Max peak of the learning phase */
+    float learn_sum;                    /*!< Sum of the integrated signal during the learning phase */
+    bool beat_found;                    /*!< A QRS was found after the learning phase */
+    uint32_t last_beat;                 /*!< Time of the R peak of the last QRS */
+    float back_peak;                    /*!< Highest noise peak since the last QRS (search back) */
+    float back_amplitude;               /*!< R amplitude of back_peak */
+    uint32_t back_time;                 /*!< R time of back_peak */
+    uint32_t rr[QRS_RR_AVERAGE];        /*!< Last RR intervals (samples) */
+    uint32_t rr_sum;                    /*!< Sum of rr */
+    uint8_t rr_count;                   /*!< RR intervals stored (up to QRS_RR_AVERAGE) */
+    uint8_t rr_index;                   /*!< Oldest RR interval */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ *
+ * @param detector          Detector instance
+ * @param config            Configuration
+ * @return true             Detector initialized
+ * @return false            Invalid parameters (i.e. window longer than QRS_MAX_WINDOW samples)
+ */
+bool QRSDetectorInit(qrs_detector_t * detector, const qrs_detector_config_t * config);
+
+/**
+ * @brief Restart the detector (time, thresholds and RR intervals), i.e. after a leads off
+ *
+ * @param detector          Detector instance
+ */
+void QRSDetectorReset(qrs_detector_t * detector);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param detector          Detector instance
+ * @param signal            ECG samples (band pass filtered)
+ * @param signal_lenght     Lenght of signal array
+ * @param beats             Array to store the beats detected (can be NULL)
+ * @param max_beats         Lenght of beats array (extra beats are counted but not stored)
+ * @return Number of beats detected in the block
+ */
+uint8_t QRSDetectorProcess(qrs_detector_t * detector, const float * signal, uint16_t signal_lenght,
+    qrs_beat_t * beats, uint8_t max_beats);
+
+/**
+ * @brief Heart rate averaged over the last QRS_RR_AVERAGE RR intervals
+ *
+ * @param detector          Detector instance
+ * @return Heart rate (bpm, 0 until two beats are found)
+ */
+float QRSDetectorHeartRate(const qrs_detector_t * detector);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
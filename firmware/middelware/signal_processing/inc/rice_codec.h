@@ -0,0 +1,90 @@
+#ifndef RICE_CODEC_H_
+#define RICE_CODEC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Rice_Codec Rice Codec
+ */
+
+/** \brief Lossless compression of blocks of int16 samples (delta + zigzag + Rice codes)
+ *
+ * Biosignals (ECG, PPG, respiration) change slowly between samples: the
+ * differences of consecutive samples are small and centered on zero. Each
+ * difference is mapped to an unsigned value (zigzag: 0, -1, 1, -2, 2 ... to
+ * 0, 1, 2, 3, 4 ...) and written as a Rice code of parameter k: the value
+ * >> k in unary (ones and a zero) and its k low bits. The k of the block is
+ * the one of the fewest bits (searched over every k), so the code follows the
+ * noise of the signal block by block. A block:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 1          | k (RICE_RAW: the samples as they are)                  |
+ * | 2          | First sample (little endian)                           |
+ * | ...        | Rice codes of the next differences (bits MSB first)    |
+ *
+ * A difference with a quotient of RICE_ESCAPE or more (a spike or a step) is
+ * written as RICE_ESCAPE ones and its 17 bits zigzag value, and a block that
+ * would not be smaller than the samples is sent as they are (RICE_RAW), so
+ * the worst case is only one byte over the samples.
+ *
+ * Blocks are independent (a lost frame does not break the next ones). The
+ * bits per sample grow with the slope of the signal in LSB per sample: the
+ * ECG capture of test_sim (8 bits at 200 Hz) takes about 5.4 bits per sample,
+ * 3 times fewer bytes than int16 (and 6 times fewer than text); each bit
+ * more of resolution adds about one bit per sample. Telemetry records of
+ * type TELEMETRY_I16_RICE are compressed with this codec (see telemetry.h).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define RICE_RAW        0xFF    /*!< k of a block of samples not compressed */
+#define RICE_MAX_K      14      /*!< Max Rice parameter */
+#define RICE_ESCAPE     16      /*!< Quotient of the escape code (followed by the 17 bits zigzag value) */
+
+/** @brief Max bytes of a block of n samples */
+#define RICE_MAX_LENGHT(n)      (1 + 2 * (n))
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Compress a block of samples
+ *
+ * @param samples           Samples
+ * @param count             Number of samples (1 or more)
+ * @param output            Block (up to RICE_MAX_LENGHT(count) bytes)
+ * @param max_lenght        Bytes available in output
+ * @return Bytes of the block (0 if it does not fit in max_lenght)
+ */
+uint16_t RiceEncode(const int16_t * samples, uint16_t count, uint8_t * output, uint16_t max_lenght);
+
+/**
+ * @brief Decompress a block of samples
+ *
+ * @param input             Block
+ * @param lenght            Bytes of the block
+ * @param samples           Samples
+ * @param count             Number of samples of the block
+ * @return Bytes of the block read (0 if the block is not valid or is truncated)
+ */
+uint16_t RiceDecode(const uint8_t * input, uint16_t lenght, int16_t * samples, uint16_t count);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RICE_CODEC_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,246 @@
+#ifndef SAMPLE_BANK_H_
+#define SAMPLE_BANK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sample_Bank Sample Bank
+ */
+
+/** \brief Bank of audio samples stored in a flash data partition
+ *
+ * The partition is memory mapped, so samples are read in place through the
+ * flash cache (zero-copy) and can be passed directly to the audio mixer. A new
+ * bank can be flashed as data, without rebuilding the firmware:
+ *
+ *   parttool.py write_partition --partition-name samples --input bank.bin
+ *
+ * Bank format (little endian):
+ *
+ * | Offset      | Content                                                          |
+ * |:-----------:|:-----------------------------------------------------------------|
+ * | 0           | Header (sample_bank_header_t)                                    |
+ * | 12          | One index entry (sample_bank_entry_t) per sample                 |
+ * | offset      | Sample data (2 bytes aligned), offsets from the start of the bank |
+ *
+ * The first hit of a sample after a while reads it through cold flash cache
+ * lines, and a flash write (i.e. NVS) stalls every read from flash. A sample
+ * cache (sample_cache_t) keeps a copy of the attack of each sample (its first
+ * milliseconds) in RAM: SampleCacheAdd points sample_t.head to it, and the
+ * audio mixer (AudioMixerSetAttack) plays the attack from RAM and only reads
+ * the tail from flash, once the sound has started.
+ *
+ * SampleBankWrite adds a sample to the bank of a partition on the device (i.e.
+ * one recorded with sample_capture.h), or replaces the one with its name. The
+ * data is appended after the bank through a buffer of one flash sector (each
+ * sector is erased and written once), then the index entry and last the
+ * header are rewritten. A new sample takes one of the free index entries
+ * between the index and the first sample data (SAMPLE_BANK_FREE_ENTRIES in a
+ * bank created on the device, see make_sample_bank.py); the data of a
+ * replaced sample is left unused until the bank is flashed again.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | RAM cache of the attack of the samples          						|
+ * | 15/10/2026 | Samples written to the partition on the device  						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define SAMPLE_BANK_MAGIC       0x4B4E4253      /*!< "SBNK" */
+#define SAMPLE_BANK_VERSION     1               /*!< Supported bank format version */
+#define SAMPLE_BANK_NAME_LENGHT 12              /*!< Characters of a sample name (including '\0') */
+#define SAMPLE_BANK_FREE_ENTRIES 16             /*!< Free index entries of a bank created by SampleBankWrite */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample data formats
+ */
+typedef enum {
+    SAMPLE_PCM16 = 0,           /*!< 16 bits signed PCM */
+    SAMPLE_ADPCM = 1,           /*!< IMA-ADPCM (see adpcm.h) */
+} sample_format_t;
+
+/**
+ * @brief Bank header
+ */
+typedef struct {
+    uint32_t magic;             /*!< SAMPLE_BANK_MAGIC */
+    uint16_t version;           /*!< SAMPLE_BANK_VERSION */
+    uint16_t count;             /*!< Number of samples */
+    uint32_t size;              /*!< Total size of the bank in bytes */
+} sample_bank_header_t;
+
+/**
+ * @brief Bank index entry
+ */
+typedef struct {
+    uint32_t offset;            /*!< Start of the sample data (bytes from the start of the bank) */
+    uint32_t lenght;            /*!< Number of samples */
+    uint16_t sample_rate;       /*!< Sample rate (Hz) */
+    uint8_t format;             /*!< Data format (sample_format_t) */
+    uint8_t reserved;           /*!< Reserved (0) */
+    char name[SAMPLE_BANK_NAME_LENGHT];    /*!< Sample name ('\0' terminated) */
+} sample_bank_entry_t;
+
+/**
+ * @brief Sample of a bank
+ */
+typedef struct {
+    const void * data;          /*!< Sample data (int16_t for SAMPLE_PCM16, uint8_t for SAMPLE_ADPCM) */
+    uint32_t lenght;            /*!< Number of samples */
+    uint16_t sample_rate;       /*!< Sample rate (Hz) */
+    sample_format_t format;     /*!< Data format */
+    const char * name;          /*!< Sample name */
+    const void * head;          /*!< Copy in RAM of the first head_lenght samples (NULL: not cached) */
+    uint32_t head_lenght;       /*!< Samples cached in RAM */
+} sample_t;
+
+/**
+ * @brief Sample bank instance
+ */
+typedef struct {
+    const uint8_t * base;                   /*!< Start of the bank */
+    const sample_bank_entry_t * entries;    /*!< Index */
+    uint16_t count;                         /*!< Number of samples */
+    uint32_t mmap_handle;                   /*!< Partition mapping (0 if not mapped) */
+} sample_bank_t;
+
+/**
+ * @brief RAM cache of the attack of the samples
+ */
+typedef struct {
+    uint8_t * buffer;           /*!< Cached attacks */
+    uint32_t size;              /*!< Bytes of the buffer */
+    uint32_t used;              /*!< Bytes used */
+    uint16_t attack_ms;         /*!< Milliseconds cached of each sample */
+    bool allocated;             /*!< Buffer allocated by SampleCacheInit */
+} sample_cache_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Map a flash data partition and open the bank stored in it
+ *
+ * @param bank              Sample bank instance
+ * @param label             Partition label (i.e. "samples")
+ * @return true: bank loaded, false: partition not found or invalid bank
+ */
+bool SampleBankLoad(sample_bank_t * bank, const char * label);
+
+/**
+ * @brief Open a bank that is already in memory (validates the header and the index)
+ *
+ * @param bank              Sample bank instance
+ * @param data              Start of the bank
+ * @param size              Bytes available
+ * @return true: valid bank, false: invalid bank
+ */
+bool SampleBankOpen(sample_bank_t * bank, const void * data, uint32_t size);
+
+/**
+ * @brief Close a bank (and unmap its partition)
+ *
+ * @param bank              Sample bank instance
+ */
+void SampleBankUnload(sample_bank_t * bank);
+
+/**
+ * @brief Number of samples of the bank
+ *
+ * @param bank              Sample bank instance
+ * @return Samples
+ */
+uint16_t SampleBankCount(const sample_bank_t * bank);
+
+/**
+ * @brief Get a sample of the bank (data is not copied)
+ *
+ * @param bank              Sample bank instance
+ * @param index             Sample index
+ * @param sample            Sample
+ * @return true: sample found, false: index out of range
+ */
+bool SampleBankGet(const sample_bank_t * bank, uint16_t index, sample_t * sample);
+
+/**
+ * @brief Find a sample by name
+ *
+ * @param bank              Sample bank instance
+ * @param name              Sample name
+ * @return Sample index, -1 if not found
+ */
+int16_t SampleBankFind(const sample_bank_t * bank, const char * name);
+
+/**
+ * @brief Write a sample to the bank of a flash data partition (a new bank is created if there is none)
+ *
+ * The sample replaces the one with the same name, or takes a free index entry.
+ *
+ * @note Flash writes stall every read from flash: call it from a low priority task, with the
+ * bank of the partition unloaded (SampleBankUnload) or with no sample of it being played. The
+ * header is rewritten last: a power loss while the first sector is rewritten loses the bank.
+ *
+ * @param label             Partition label (i.e. "samples")
+ * @param name              Sample name (up to SAMPLE_BANK_NAME_LENGHT - 1 characters)
+ * @param pcm               16 bits PCM samples
+ * @param lenght            Number of samples
+ * @param sample_rate       Sample rate (Hz)
+ * @param format            Format stored (SAMPLE_ADPCM: encoded while it is written)
+ * @return true: sample written, false: partition not found, no space left or flash error
+ */
+bool SampleBankWrite(const char * label, const char * name, const int16_t * pcm, uint32_t lenght,
+                     uint16_t sample_rate, sample_format_t format);
+
+/**
+ * @brief Initialize a cache of the attack of the samples (empty)
+ *
+ * @param cache             Sample cache
+ * @param attack_ms         Milliseconds cached of each sample
+ * @param buffer            Buffer (RAM), or NULL to allocate it from the heap
+ * @param size              Bytes of the buffer (see SampleCacheBytes)
+ * @return true: cache initialized, false: not enough memory
+ */
+bool SampleCacheInit(sample_cache_t * cache, uint16_t attack_ms, uint8_t * buffer, uint32_t size);
+
+/**
+ * @brief Release a cache (frees the buffer if it was allocated by SampleCacheInit)
+ *
+ * @note The samples added to the cache must not be played after it.
+ *
+ * @param cache             Sample cache
+ */
+void SampleCacheDeinit(sample_cache_t * cache);
+
+/**
+ * @brief Bytes that the attack of a sample takes in a cache
+ *
+ * @param sample            Sample
+ * @param attack_ms         Milliseconds cached
+ * @return Bytes
+ */
+uint32_t SampleCacheBytes(const sample_t * sample, uint16_t attack_ms);
+
+/**
+ * @brief Copy the attack of a sample to the cache and set its head
+ *
+ * @param cache             Sample cache
+ * @param sample            Sample (head and head_lenght are set)
+ * @return true: attack cached, false: no space left (the sample is not cached)
+ */
+bool SampleCacheAdd(sample_cache_t * cache, sample_t * sample);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SAMPLE_BANK_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,167 @@
+#ifndef SAMPLE_CAPTURE_H_
+#define SAMPLE_CAPTURE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sample_Capture Sample Capture
+ */
+
+/** \brief Recording of a hit as a new sample for the audio mixer
+ *
+ * The blocks of a (DC free) signal, i.e. a piezo pad or a line input sampled
+ * by the continuous ADC, are fed while the capture is armed:
+ *
+ * - WAITING: the last pre_ms of the signal are kept in a circular pre-roll,
+ *   until a sample crosses the threshold (the same onset of the hit
+ *   detector, i.e. NoiseFloorThreshold()).
+ * - RECORDING: the pre-roll is put in order at the start of the buffer and
+ *   the hit is recorded after it, until its level stays under end_level of
+ *   its peak for release_ms (or the buffer is full).
+ * - DONE: the last release_ms fade out to silence and the sample is
+ *   normalized to the peak of the configuration. SampleCaptureGet gives it
+ *   as a 16 bits PCM sample in RAM, ready for the mixer and for
+ *   SampleBankWrite.
+ *
+ * Samples are stored as int16_t (full_scale signal units map to INT16_MAX),
+ * optionally averaging decimation input samples into each one, so a 20 kHz
+ * pad can be recorded at 10 kHz (the mixer resamples it to its rate). The
+ * normalization is done with integer arithmetic in the block where the
+ * capture ends.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sample_bank.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Capture states
+ */
+typedef enum {
+    SAMPLE_CAPTURE_IDLE = 0,    /*!< Not armed (input is ignored) */
+    SAMPLE_CAPTURE_WAITING,     /*!< Armed, waiting for the onset */
+    SAMPLE_CAPTURE_RECORDING,   /*!< Recording the hit */
+    SAMPLE_CAPTURE_DONE,        /*!< Sample ready (input is ignored) */
+} sample_capture_state_t;
+
+/**
+ * @brief Capture configuration
+ */
+typedef struct {
+    float sample_frec;          /*!< Sample frequency of the input (Hz) */
+    uint8_t decimation;         /*!< Input samples averaged in each recorded sample (1: none) */
+    float threshold;            /*!< Onset level (signal units, i.e. mV) */
+    float full_scale;           /*!< Signal level recorded as INT16_MAX (higher levels clip) */
+    float pre_ms;               /*!< Time kept before the onset (ms) */
+    float release_ms;           /*!< Time under end_level that ends the hit, faded out (ms) */
+    float end_level;            /*!< End level, fraction of the peak (i.e. 0.02) */
+    float peak;                 /*!< Peak after normalization, fraction of INT16_MAX (0: not normalized) */
+} sample_capture_config_t;
+
+/**
+ * @brief Capture instance
+ */
+typedef struct {
+    int16_t * buffer;           /*!< Recorded samples */
+    uint32_t size;              /*!< Samples of the buffer */
+    float scale;                /*!< Signal units to int16_t (including the average) */
+    float threshold;            /*!< Onset level */
+    uint32_t pre;               /*!< Pre-roll samples */
+    uint32_t release;           /*!< Release (and fade out) samples */
+    int32_t end_level;          /*!< End level (Q15) */
+    int16_t target;             /*!< Peak after normalization (0: not normalized) */
+    uint16_t sample_rate;       /*!< Sample rate of the recording (Hz) */
+    uint8_t decimation;         /*!< Input samples per recorded sample */
+    uint8_t averaged;           /*!< Input samples in acc */
+    float acc;                  /*!< Sum of the input samples of the next recorded sample */
+    sample_capture_state_t state;   /*!< Capture state */
+    uint32_t pos;               /*!< Next sample of the pre-roll (WAITING) */
+    bool pre_full;              /*!< The pre-roll wrapped around */
+    uint32_t count;             /*!< Samples recorded (RECORDING, DONE) */
+    int16_t peak;               /*!< Peak of the hit so far */
+    uint32_t last_loud;         /*!< Samples recorded up to the last one over end_level of the peak */
+} sample_capture_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a capture (IDLE)
+ *
+ * @param sc                Capture instance
+ * @param config            Configuration
+ * @param buffer            Recorded samples
+ * @param size              Samples of the buffer (max lenght of the sample, pre-roll included)
+ * @return true             Capture initialized
+ * @return false            Invalid parameters
+ */
+bool SampleCaptureInit(sample_capture_t * sc, const sample_capture_config_t * config, int16_t * buffer, uint32_t size);
+
+/**
+ * @brief Arm the capture: the next hit will be recorded (discards the previous one)
+ *
+ * @param sc                Capture instance
+ */
+void SampleCaptureStart(sample_capture_t * sc);
+
+/**
+ * @brief Disarm the capture (IDLE)
+ *
+ * @param sc                Capture instance
+ */
+void SampleCaptureStop(sample_capture_t * sc);
+
+/**
+ * @brief Change the onset level (i.e. once per block, with the noise floor)
+ *
+ * @param sc                Capture instance
+ * @param threshold         Onset level (signal units)
+ */
+void SampleCaptureSetThreshold(sample_capture_t * sc, float threshold);
+
+/**
+ * @brief Feed a block of the signal
+ *
+ * @param sc                Capture instance
+ * @param input             Signal (DC free, signal units)
+ * @param lenght            Samples of the block
+ * @return State of the capture after the block
+ */
+sample_capture_state_t SampleCaptureProcess(sample_capture_t * sc, const float * input, uint16_t lenght);
+
+/**
+ * @brief State of the capture
+ *
+ * @param sc                Capture instance
+ * @return State
+ */
+sample_capture_state_t SampleCaptureState(const sample_capture_t * sc);
+
+/**
+ * @brief Get the recorded sample (16 bits PCM in the buffer of the capture, without name)
+ *
+ * @note The sample is valid until the capture is armed again.
+ *
+ * @param sc                Capture instance
+ * @param sample            Sample
+ * @return true: sample ready, false: the capture is not DONE
+ */
+bool SampleCaptureGet(const sample_capture_t * sc, sample_t * sample);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SAMPLE_CAPTURE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,125 @@
+#ifndef SCOPE_STREAM_H_
+#define SCOPE_STREAM_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Scope_Stream Scope Stream
+ */
+
+/** \brief Packing of raw ADC blocks for continuous streaming to a PC ("scope mode")
+ *
+ * Each block of 12 bits samples of one or more channels is packed in a frame:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 1          | Sequence number (detects lost frames)                  |
+ * | 1          | Packing (scope_pack_t)                                 |
+ * | 1          | Number of channels                                     |
+ * | 2          | Samples per channel                                    |
+ * | 4          | Time of the first sample (us)                          |
+ * | 4          | Blocks dropped so far by the sender (see below)        |
+ * | ...        | Samples of channel 0, then channel 1, ...              |
+ * | 2          | CRC16-CCITT of the previous bytes (as in telemetry.h)  |
+ *
+ * Multi-byte fields are little endian. As telemetry frames, the frame is COBS
+ * encoded and ends with a 0x00 delimiter.
+ *
+ * Packings:
+ * - SCOPE_PACK_12BIT: two samples in 3 bytes (s0 bits 0-7, s0 bits 8-11 | s1
+ *   bits 0-3 << 4, s1 bits 4-11). Fixed rate: 2 channels at 20 kHz take 60 KB/s
+ *   (80 KB/s as 16 bits), within the 92 KB/s of a 921600 baud UART.
+ * - SCOPE_PACK_DELTA: the first sample of each channel as 16 bits, then the
+ *   difference with the previous sample as int8 (SCOPE_DELTA_ESCAPE and the
+ *   sample as 16 bits if it does not fit). Near 1 byte per sample for slow or
+ *   quiet signals, up to 3 bytes per sample for noisy ones.
+ *
+ * The dropped counter is the total of blocks the sender could not queue because
+ * the link was behind (i.e. ring_buffer_t.overflows), so the receiver knows the
+ * size of each gap; lost frames are found with the sequence number. The host
+ * side decoder is tools/scope_decoder.py.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "telemetry.h"
+/*==================[macros]=================================================*/
+#define SCOPE_MAX_SAMPLES   512     /*!< Max samples of a frame (all channels) */
+#define SCOPE_HEADER        13      /*!< Bytes of the frame header */
+#define SCOPE_DELTA_ESCAPE  0x80    /*!< Delta packing: the next 2 bytes are a 16 bits sample */
+
+/** @brief Max payload bytes (header and samples) of a frame of n samples (all channels) */
+#define SCOPE_PAYLOAD_SIZE(n)   (SCOPE_HEADER + 3 * (n))
+
+/** @brief Max size of an encoded frame of n samples (all channels) */
+#define SCOPE_FRAME_SIZE(n)     TELEMETRY_FRAME_SIZE(SCOPE_PAYLOAD_SIZE(n))
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Samples packing
+ */
+typedef enum {
+    SCOPE_PACK_12BIT,           /*!< 12 bits packed: 3 bytes every 2 samples */
+    SCOPE_PACK_DELTA,           /*!< int8 deltas with escape: 1 to 3 bytes per sample */
+} scope_pack_t;
+
+/**
+ * @brief Scope stream encoder
+ */
+typedef struct {
+    uint8_t payload[SCOPE_PAYLOAD_SIZE(SCOPE_MAX_SAMPLES) + 2]; /*!< Frame being encoded (and its CRC) */
+    scope_pack_t pack;                                          /*!< Samples packing */
+    uint8_t channels;                                           /*!< Channels of each block */
+    uint8_t seq;                                                /*!< Sequence number of the next frame */
+} scope_stream_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a scope stream encoder (sequence number 0)
+ *
+ * @param scope             Scope stream encoder
+ * @param pack              Samples packing
+ * @param channels          Channels of each block
+ */
+void ScopeStreamInit(scope_stream_t * scope, scope_pack_t pack, uint8_t channels);
+
+/**
+ * @brief Pack a block of samples in a frame (CRC, COBS and delimiter)
+ *
+ * @param scope             Scope stream encoder
+ * @param data              Samples of each channel (12 bits)
+ * @param lenght            Samples per channel (channels * lenght up to SCOPE_MAX_SAMPLES)
+ * @param timestamp         Time of the first sample (us)
+ * @param dropped           Blocks dropped so far by the sender
+ * @param output            Encoded frame (SCOPE_FRAME_SIZE(channels * lenght) bytes)
+ * @return Bytes of the encoded frame (0 if the block does not fit in a frame)
+ */
+uint16_t ScopeStreamEncode(scope_stream_t * scope, const uint16_t * const * data, uint16_t lenght,
+                           uint32_t timestamp, uint32_t dropped, uint8_t * output);
+
+/**
+ * @brief Unpack the samples of a frame decoded with TelemetryDecode
+ *
+ * @param payload           Frame payload (header and samples)
+ * @param lenght            Payload bytes
+ * @param data              Samples of each channel (of the frame channels and samples per channel)
+ * @return Samples per channel (-1 if the payload is not valid)
+ */
+int16_t ScopeStreamUnpack(const uint8_t * payload, uint16_t lenght, uint16_t * const * data);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SCOPE_STREAM_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,128 @@
+#ifndef SMALL_MATRIX_H_
+#define SMALL_MATRIX_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Small_Matrix Small Matrix
+ */
+
+/** \brief Fixed size matrix kernels for the orientation filters (3x3, 4x4 and the 13 states EKF)
+ *
+ * dspm_mult_f32 and the dspm::Mat operators take the sizes at run time: for
+ * small matrices the loop control, the index computation and (for dspm::Mat)
+ * the allocation of each result take more time than the products. These
+ * kernels are static inline functions generated for each size by
+ * SMALL_MATRIX_DEFINE(n), with the size as a constant and the dot products
+ * unrolled by the compiler (even with -Os): no loop control or index
+ * multiplications in the inner loops, and the outer loops of 3x3 and 4x4 are
+ * unrolled too by the optimizer. Only the inner loops are unrolled, so a
+ * 13x13 kernel is not thousands of instructions of flash.
+ *
+ * Matrices are row major float arrays (as dspm::Mat.data). Defined sizes:
+ * SmallMatMul3 / SmallMatMulVec3 (rotation matrices), SmallMatMul4 /
+ * SmallMatMulVec4 (quaternion products) and SmallMatMul13 /
+ * SmallMatSymABAt13 / SmallMatSymAddGDGt13x18 (covariance prediction of
+ * ekf_imu13states, see imu_fusion_ekf.cpp).
+ *
+ * The symmetric kernels compute the upper triangle and copy it to the lower
+ * one: about half the products of the full multiplication, and the result
+ * is exactly symmetric (the covariance does not drift from symmetry).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+/** @brief Inner (dot product) loops unrolled by the compiler (up to the 18 columns of the EKF noise matrix) */
+#define SMALL_MATRIX_UNROLL     _Pragma("GCC unroll 18")
+
+/**
+ * @brief Define the kernels of n x n matrices:
+ *
+ * - SmallMatMul##n(a, b, c): c = a * b
+ * - SmallMatMulVec##n(a, x, y): y = a * x
+ * - SmallMatSymABAt##n(a, p, work, c): c = a * p * a' (p symmetric; work of n * n floats)
+ *
+ * c and y must not be any of the inputs.
+ */
+#define SMALL_MATRIX_DEFINE(n)                                                                  \
+static inline void SmallMatMul##n(const float * a, const float * b, float * c){                \
+    for(uint8_t i = 0; i < (n); i++){                                                           \
+        for(uint8_t j = 0; j < (n); j++){                                                       \
+            float acc = 0;                                                                      \
+            SMALL_MATRIX_UNROLL                                                                 \
+            for(uint8_t k = 0; k < (n); k++){                                                   \
+                acc += a[i * (n) + k] * b[k * (n) + j];                                         \
+            }                                                                                   \
+            c[i * (n) + j] = acc;                                                               \
+        }                                                                                       \
+    }                                                                                           \
+}                                                                                               \
+static inline void SmallMatMulVec##n(const float * a, const float * x, float * y){             \
+    for(uint8_t i = 0; i < (n); i++){                                                           \
+        float acc = 0;                                                                          \
+        SMALL_MATRIX_UNROLL                                                                     \
+        for(uint8_t k = 0; k < (n); k++){                                                       \
+            acc += a[i * (n) + k] * x[k];                                                       \
+        }                                                                                       \
+        y[i] = acc;                                                                             \
+    }                                                                                           \
+}                                                                                               \
+static inline void SmallMatSymABAt##n(const float * a, const float * p, float * work, float * c){ \
+    SmallMatMul##n(a, p, work);                                                                 \
+    /* (a * p) * a': rows of a * p by rows of a, upper triangle */                              \
+    for(uint8_t i = 0; i < (n); i++){                                                           \
+        for(uint8_t j = i; j < (n); j++){                                                       \
+            float acc = 0;                                                                      \
+            SMALL_MATRIX_UNROLL                                                                 \
+            for(uint8_t k = 0; k < (n); k++){                                                   \
+                acc += work[i * (n) + k] * a[j * (n) + k];                                      \
+            }                                                                                   \
+            c[i * (n) + j] = c[j * (n) + i] = acc;                                              \
+        }                                                                                       \
+    }                                                                                           \
+}
+
+/**
+ * @brief Define c = c + s * g * diag(d) * g' for g of n x m (c symmetric, n x n): SmallMatSymAddGDGt##n##x##m(g, d, s, c)
+ */
+#define SMALL_MATRIX_DEFINE_GDGT(n, m)                                                          \
+static inline void SmallMatSymAddGDGt##n##x##m(const float * g, const float * d, float s, float * c){ \
+    for(uint8_t i = 0; i < (n); i++){                                                           \
+        for(uint8_t j = i; j < (n); j++){                                                       \
+            float acc = 0;                                                                      \
+            SMALL_MATRIX_UNROLL                                                                 \
+            for(uint8_t k = 0; k < (m); k++){                                                   \
+                acc += g[i * (m) + k] * d[k] * g[j * (m) + k];                                  \
+            }                                                                                   \
+            c[i * (n) + j] += s * acc;                                                          \
+            c[j * (n) + i] = c[i * (n) + j];                                                    \
+        }                                                                                       \
+    }                                                                                           \
+}
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+SMALL_MATRIX_DEFINE(3)
+SMALL_MATRIX_DEFINE(4)
+SMALL_MATRIX_DEFINE(13)
+SMALL_MATRIX_DEFINE_GDGT(13, 18)
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SMALL_MATRIX_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,99 @@
+#ifndef STFT_H_
+#define STFT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup STFT Short Time Fourier Transform
+ */
+
+/** \brief Streaming (sliding window) spectrum engine
+ * 
+ * Samples are pushed in blocks of any size. Each time hop_lenght new samples are
+ * available, the magnitude spectrum of the last frame_lenght samples is computed
+ * (with the window of an FFT plan) and passed to a callback function. Overlapping
+ * samples are kept between frames, so only hop_lenght new samples are needed per
+ * spectrum.
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+/** @brief Number of floats of the work buffer needed by an STFT of frame lenght n */
+#define STFT_BUFFER_LENGHT(n)   (FFT_PLAN_BUFFER_LENGHT(n) + (n) + (n) / 2)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief STFT instance
+ */
+typedef struct {
+    fft_plan_t plan;            /*!< FFT plan (frame lenght and window) */
+    float * history;            /*!< Last frame_lenght samples */
+    float * magnitude;          /*!< Last magnitude frame (frame_lenght / 2 bins) */
+    uint16_t hop_lenght;        /*!< New samples between consecutive frames */
+    uint16_t fill;              /*!< Samples stored in history */
+    uint32_t frames;            /*!< Number of frames computed */
+    void (*func_p)(const float * magnitude, uint16_t bins, void * param);   /*!< Function called on each new frame */
+    void * param_p;             /*!< Parameter passed to func_p */
+} stft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an STFT instance
+ * 
+ * @param stft              STFT instance
+ * @param frame_lenght      Samples per frame (power of two, with maximun value = MAX_SIGNAL_LENGHT)
+ * @param hop_lenght        New samples between frames (1 to frame_lenght, frame_lenght / 2 for 50% overlap)
+ * @param window            Window type
+ * @param buffer            Work buffer (of lenght = STFT_BUFFER_LENGHT(frame_lenght))
+ * @param func_p            Function called with each new magnitude frame (can be NULL)
+ * @param param_p           Parameter passed to func_p
+ * @return true             STFT initialized
+ * @return false            Invalid parameters
+ */
+bool STFTInit(stft_t * stft, uint16_t frame_lenght, uint16_t hop_lenght, fft_window_t window, float * buffer,
+              void (*func_p)(const float * magnitude, uint16_t bins, void * param), void * param_p);
+
+/**
+ * @brief Push a block of samples, computing every frame completed by them
+ * 
+ * @param stft              STFT instance
+ * @param samples           New samples
+ * @param lenght            Number of new samples (any value)
+ * @return Number of frames computed
+ */
+uint16_t STFTProcess(stft_t * stft, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Last magnitude frame computed
+ * 
+ * @param stft              STFT instance
+ * @return Array of frame_lenght / 2 magnitude values
+ */
+const float * STFTGetMagnitude(stft_t * stft);
+
+/**
+ * @brief Discard stored samples (the next frame needs frame_lenght new samples)
+ * 
+ * @param stft              STFT instance
+ */
+void STFTReset(stft_t * stft);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STFT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,168 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Telemetry Telemetry
+ */
+
+/** \brief Framed and checksummed binary telemetry (COBS + CRC16)
+ *
+ * A frame batches many samples of one or more typed channels:
+ *
+ * | Bytes      | Field                                                  |
+ * |:----------:|:-------------------------------------------------------|
+ * | 1          | Sequence number (detects lost frames)                  |
+ * | 3 + n*size | Record: channel, type (telemetry_type_t), n, n values  |
+ * | ...        | More records                                           |
+ * | 2          | CRC16-CCITT (0x1021, init 0xFFFF) of the previous bytes|
+ *
+ * Records of type TELEMETRY_I16_RICE have one more byte after n, the bytes
+ * of the block of values compressed with RiceEncode (lossless, 2 to 4 times
+ * smaller for ECG or PPG samples; see rice_codec.h).
+ *
+ * Values are little endian. The frame is COBS encoded (it has no zero bytes)
+ * and ends with a 0x00 delimiter, so a receiver resynchronizes at the next zero
+ * after a lost byte. The byte stream can go through any transport: UART, or BLE
+ * notifications of any size (frames are split by the stack and rebuilt by the
+ * receiver at the delimiters).
+ *
+ * Sending the samples as binary values instead of text (i.e. "%2.2f") takes
+ * 3 to 5 times fewer bytes and no formatting time. The host side decoder is
+ * tools/telemetry_decoder.py.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TELEMETRY_MAX_PAYLOAD   250     /*!< Max bytes of sequence number and records of a frame */
+#define TELEMETRY_RECORD_HEADER 3       /*!< Bytes of a record before its values */
+
+/** @brief Max COBS encoded size of n bytes */
+#define COBS_MAX_LENGHT(n)      ((n) + (n) / 254 + 1)
+
+/** @brief Max size of an encoded frame (COBS + delimiter) of a payload of n bytes */
+#define TELEMETRY_FRAME_SIZE(n) (COBS_MAX_LENGHT((n) + 2) + 1)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Types of the channel values
+ */
+typedef enum {
+    TELEMETRY_U8,               /*!< uint8_t */
+    TELEMETRY_I8,               /*!< int8_t */
+    TELEMETRY_U16,              /*!< uint16_t */
+    TELEMETRY_I16,              /*!< int16_t */
+    TELEMETRY_U32,              /*!< uint32_t */
+    TELEMETRY_I32,              /*!< int32_t */
+    TELEMETRY_F32,              /*!< float */
+    TELEMETRY_I16_RICE,         /*!< int16_t, compressed (see rice_codec.h) */
+} telemetry_type_t;
+
+/**
+ * @brief Frame being built
+ */
+typedef struct {
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD + 2]; /*!< Sequence number, records (and the CRC while encoding) */
+    uint16_t lenght;                            /*!< Payload bytes used */
+    uint16_t max_lenght;                        /*!< Payload bytes of each frame */
+    uint8_t seq;                                /*!< Sequence number of the frame */
+} telemetry_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a telemetry encoder (empty frame, sequence number 0)
+ *
+ * @param telemetry         Telemetry encoder
+ * @param max_lenght        Max payload bytes of each frame (up to TELEMETRY_MAX_PAYLOAD, i.e. smaller for BLE)
+ */
+void TelemetryInit(telemetry_t * telemetry, uint16_t max_lenght);
+
+/**
+ * @brief Bytes of a channel record (the max ones for TELEMETRY_I16_RICE)
+ *
+ * @param type              Values type
+ * @param count             Number of values
+ * @return Record bytes (header and values)
+ */
+uint16_t TelemetryRecordSize(telemetry_type_t type, uint8_t count);
+
+/**
+ * @brief Add the values of a channel to the frame
+ *
+ * @param telemetry         Telemetry encoder
+ * @param channel           Channel number (meaning defined by the application)
+ * @param type              Values type
+ * @param values            Values (count values of the type, int16_t for TELEMETRY_I16_RICE)
+ * @param count             Number of values (1 to 255)
+ * @return true             Values added
+ * @return false            The frame is full (encode it and add them to the next one)
+ */
+bool TelemetryAdd(telemetry_t * telemetry, uint8_t channel, telemetry_type_t type, const void * values, uint8_t count);
+
+/**
+ * @brief Encode the frame (CRC, COBS and delimiter) and start the next one
+ *
+ * @param telemetry         Telemetry encoder
+ * @param output            Encoded frame (TELEMETRY_FRAME_SIZE(max_lenght) bytes)
+ * @return Bytes of the encoded frame (0 if the frame had no records)
+ */
+uint16_t TelemetryEncode(telemetry_t * telemetry, uint8_t * output);
+
+/**
+ * @brief Decode a frame received up to its delimiter and check its CRC
+ *
+ * @param frame             Encoded frame (without the 0x00 delimiter)
+ * @param lenght            Bytes of the encoded frame
+ * @param payload           Sequence number and records (lenght bytes)
+ * @return Payload bytes (-1 if the frame is corrupted)
+ */
+int16_t TelemetryDecode(const uint8_t * frame, uint16_t lenght, uint8_t * payload);
+
+/**
+ * @brief CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF)
+ *
+ * @param data              Data
+ * @param lenght            Bytes of data
+ * @return CRC
+ */
+uint16_t TelemetryCRC16(const uint8_t * data, uint16_t lenght);
+
+/**
+ * @brief COBS encoding (the output has no zero bytes)
+ *
+ * @param input             Data
+ * @param lenght            Bytes of data
+ * @param output            Encoded data (COBS_MAX_LENGHT(lenght) bytes)
+ * @return Bytes of encoded data
+ */
+uint16_t CobsEncode(const uint8_t * input, uint16_t lenght, uint8_t * output);
+
+/**
+ * @brief COBS decoding
+ *
+ * @param input             Encoded data (without the delimiter)
+ * @param lenght            Bytes of encoded data
+ * @param output            Data (lenght bytes)
+ * @return Bytes of data (-1 if the encoding is not valid)
+ */
+int16_t CobsDecode(const uint8_t * input, uint16_t lenght, uint8_t * output);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TELEMETRY_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,127 @@
+#ifndef TIME_SYNC_H_
+#define TIME_SYNC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Time_Sync Time Sync
+ */
+
+/** \brief Offset and skew of the local clock to the clock of a master board
+ *
+ * The master broadcasts beacons with its time (i.e. ESPNOW_MSG_SYNC, see
+ * espnow_mcu.h) and each board takes the local time at the reception. Every
+ * pair gives a sample of the offset (master - local), that drifts with the
+ * skew of the crystals (up to tens of ppm, several us per second):
+ *
+ *     offset(t) = offset0 + skew * (t - t0)
+ *
+ * The skew is the slope of a least squares line over the last
+ * TIME_SYNC_WINDOW beacons (16 s with a beacon every 500 ms), fitted again
+ * with the beacons less delayed than the mean. The radio delay only makes the
+ * beacons late (the offset samples smaller), so the line is moved up to the
+ * beacon with the least delay instead of passing through the mean of the
+ * delays. Beacons delayed more than max_delay_us from the model are left
+ * out. The master time
+ * of a local timestamp (and back) is then computed with integer arithmetic,
+ * without reading any clock: events of several boards are merged on the
+ * master time base.
+ *
+ * A constant part of the radio delay can't be measured with one way beacons
+ * (it is the same for every board of the same kind, and cancels out).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TIME_SYNC_WINDOW        32      /*!< Beacons of the estimation */
+#define TIME_SYNC_MIN_BEACONS   4       /*!< Beacons to lock */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Clock synchronization instance (one per master)
+ */
+typedef struct {
+    int64_t local[TIME_SYNC_WINDOW];    /*!< Local time of each beacon (us) */
+    int64_t offset[TIME_SYNC_WINDOW];   /*!< Master - local time of each beacon (us) */
+    uint8_t count;                      /*!< Beacons in the window */
+    uint8_t head;                       /*!< Position of the next beacon */
+    uint32_t max_delay_us;              /*!< Max delay of a beacon from the model (us) */
+    int64_t ref_local;                  /*!< Local time of the reference of the model (us) */
+    int64_t ref_offset;                 /*!< Offset at ref_local (us) */
+    int32_t skew_ppb;                   /*!< Skew of the master to the local clock (ppb) */
+    uint8_t rejected;                   /*!< Consecutive beacons left out */
+    bool locked;                        /*!< Model valid */
+} time_sync_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a clock synchronization (unlocked)
+ *
+ * @param sync              Synchronization instance
+ * @param max_delay_us      Max delay of a beacon from the model (us, i.e. 500); a longer run of them resets the model
+ */
+void TimeSyncInit(time_sync_t * sync, uint32_t max_delay_us);
+
+/**
+ * @brief Add a beacon
+ *
+ * @param sync              Synchronization instance
+ * @param local_us          Local time of the reception (us)
+ * @param master_us         Time of the master in the beacon (us)
+ * @return true             Beacon used
+ * @return false            Beacon left out (delayed)
+ */
+bool TimeSyncUpdate(time_sync_t * sync, uint64_t local_us, uint64_t master_us);
+
+/**
+ * @brief Check if the model is valid (TIME_SYNC_MIN_BEACONS received)
+ *
+ * @param sync              Synchronization instance
+ * @return true             Locked
+ */
+bool TimeSyncLocked(const time_sync_t * sync);
+
+/**
+ * @brief Master time of a local timestamp
+ *
+ * @param sync              Synchronization instance
+ * @param local_us          Local time (us, i.e. TimeNowUs())
+ * @return Master time (us), local_us if not locked
+ */
+uint64_t TimeSyncToMaster(const time_sync_t * sync, uint64_t local_us);
+
+/**
+ * @brief Local time of a master timestamp
+ *
+ * @param sync              Synchronization instance
+ * @param master_us         Master time (us)
+ * @return Local time (us), master_us if not locked
+ */
+uint64_t TimeSyncToLocal(const time_sync_t * sync, uint64_t master_us);
+
+/**
+ * @brief Skew of the master to the local clock
+ *
+ * @param sync              Synchronization instance
+ * @return Skew (ppb, positive if the master clock is faster)
+ */
+int32_t TimeSyncSkew(const time_sync_t * sync);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TIME_SYNC_H_ */
+
+/*==================[end of file]============================================*/
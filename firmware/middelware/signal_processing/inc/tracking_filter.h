@@ -0,0 +1,190 @@
+#ifndef TRACKING_FILTER_H_
+#define TRACKING_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Tracking_Filter Tracking Filter
+ */
+
+/** \brief Alpha-beta and scalar Kalman smoothing of slow sensors (one update per sample)
+ *
+ * Slow sensors (a load cell, a humidity sensor, an ultrasonic ranger) give one
+ * value at a time, often from the callback of an asynchronous driver: these
+ * filters keep a few floats per instance and smooth each new value, instead of
+ * averaging several blocking reads.
+ *
+ * Scalar Kalman filter of a value that wanders (random walk):
+ *
+ *     p = p + process_var                 (prediction)
+ *     k = p / (p + noise_var)
+ *     x = x + k * (z - x)
+ *     p = (1 - k) * p
+ *
+ * The first value sets x (and p = noise_var), so the gain starts at 1/2 and
+ * decreases: it averages all the values received until it reaches the steady
+ * gain, and settles faster than an exponential average with that gain.
+ *
+ * Alpha-beta filter of a value and its rate of change (i.e. a distance and a
+ * speed), for values that move along ramps:
+ *
+ *     x = x + v * dt + alpha * r      where r = z - (x + v * dt)
+ *     v = v + beta * r / dt
+ *
+ * It follows a ramp without lag. AlphaBetaInitNoise() takes the optimal
+ * gains for the given noises (the steady state of the Kalman filter of a
+ * value with random accelerations, from the tracking index of Kalata).
+ *
+ * @code
+ * static kalman_1d_t distance;
+ * static void Distance(uint8_t sensor, float cm, void *param){
+ *     if(cm > 0 && cm < 300){                  // echo in range
+ *         Kalman1DUpdate(&distance, cm);
+ *     }
+ * }
+ * ...
+ * Kalman1DInit(&distance, 0.1f, 4.0f);        // drift of 0.3 cm, noise of 2 cm per measurement
+ * HcSr04StartAsync(60, Distance, NULL);
+ * @endcode
+ *
+ * @note Outliers (i.e. a missed echo) are not rejected: they must be
+ * discarded before the update (a median_filter.h window can be used first).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Scalar Kalman filter instance (one per value)
+ */
+typedef struct {
+    float process_var;          /*!< Variance of the change of the value between samples */
+    float noise_var;            /*!< Variance of the measurement noise */
+    float x;                    /*!< Estimated value */
+    float p;                    /*!< Variance of the estimation */
+    bool started;               /*!< First value received */
+} kalman_1d_t;
+
+/**
+ * @brief Alpha-beta filter instance (one per value)
+ */
+typedef struct {
+    float alpha;                /*!< Gain of the value */
+    float beta;                 /*!< Gain of the rate */
+    float dt;                   /*!< Time between samples (s) */
+    float x;                    /*!< Estimated value */
+    float v;                    /*!< Estimated rate (units / s) */
+    bool started;               /*!< First value received */
+} alpha_beta_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a scalar Kalman filter
+ *
+ * @param kf                Filter instance
+ * @param process_var       Variance of the change of the value between samples (> 0, signal units^2)
+ * @param noise_var         Variance of the measurement noise (> 0, signal units^2)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters
+ */
+bool Kalman1DInit(kalman_1d_t * kf, float process_var, float noise_var);
+
+/**
+ * @brief Update with a new value
+ *
+ * @param kf                Filter instance
+ * @param z                 Measured value
+ * @return Estimated value
+ */
+float Kalman1DUpdate(kalman_1d_t * kf, float z);
+
+/**
+ * @brief Estimated value
+ *
+ * @param kf                Filter instance
+ * @return Estimated value (0 before the first update)
+ */
+float Kalman1DValue(const kalman_1d_t * kf);
+
+/**
+ * @brief Variance of the estimated value
+ *
+ * @param kf                Filter instance
+ * @return Variance (signal units^2)
+ */
+float Kalman1DVariance(const kalman_1d_t * kf);
+
+/**
+ * @brief Forget the value (the next update sets it)
+ *
+ * @param kf                Filter instance
+ */
+void Kalman1DReset(kalman_1d_t * kf);
+
+/**
+ * @brief Initialize an alpha-beta filter with its gains
+ *
+ * @param ab                Filter instance
+ * @param alpha             Gain of the value (0 to 1)
+ * @param beta              Gain of the rate (0 to 4 - 2 * alpha, stable)
+ * @param dt                Time between samples (s)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters
+ */
+bool AlphaBetaInit(alpha_beta_t * ab, float alpha, float beta, float dt);
+
+/**
+ * @brief Initialize an alpha-beta filter with the optimal gains for the noises
+ *
+ * @param ab                Filter instance
+ * @param accel_std         Standard deviation of the changes of the rate (signal units / s^2)
+ * @param noise_std         Standard deviation of the measurement noise (signal units)
+ * @param dt                Time between samples (s)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters
+ */
+bool AlphaBetaInitNoise(alpha_beta_t * ab, float accel_std, float noise_std, float dt);
+
+/**
+ * @brief Update with a new value
+ *
+ * @param ab                Filter instance
+ * @param z                 Measured value
+ * @return Estimated value
+ */
+float AlphaBetaUpdate(alpha_beta_t * ab, float z);
+
+/**
+ * @brief Estimated rate of change
+ *
+ * @param ab                Filter instance
+ * @return Rate (signal units / s)
+ */
+float AlphaBetaRate(const alpha_beta_t * ab);
+
+/**
+ * @brief Forget the value and the rate (the next update sets the value)
+ *
+ * @param ab                Filter instance
+ */
+void AlphaBetaReset(alpha_beta_t * ab);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TRACKING_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,126 @@
+#ifndef VELOCITY_CURVE_H_
+#define VELOCITY_CURVE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Velocity_Curve Velocity Curve
+ */
+
+/** \brief Precomputed velocity curves: peak of a hit to MIDI velocity and gain
+ *
+ * The peak of a hit (from threshold to max_level) is normalized to x (0 to 1)
+ * and mapped by the curve to y (0 to 1):
+ *
+ * | Type                  | y                                        |
+ * |:---------------------:|:-----------------------------------------|
+ * | VELOCITY_CURVE_LINEAR | x                                        |
+ * | VELOCITY_CURVE_LOG    | log(1 + shape * x) / log(1 + shape)      |
+ * | VELOCITY_CURVE_EXP    | (exp(shape * x) - 1) / (exp(shape) - 1)  |
+ * | VELOCITY_CURVE_POWER  | x ^ shape                                |
+ * | VELOCITY_CURVE_CUSTOM | Straight lines between velocity points   |
+ *
+ * The curve is evaluated once, at init, for VELOCITY_CURVE_SIZE peaks; each
+ * entry of the table holds the MIDI velocity (1 + 126 * y) and the gain of the
+ * sample (velocity / 127, not rounded to the velocity steps, in Q15). A hit
+ * then costs a multiplication and a read, with no log, exp or pow (software
+ * float on the ESP32-C6). 256 entries (1 KB) resolve every velocity step for
+ * the usual max_level / threshold ratios; define VELOCITY_CURVE_SIZE as 4096
+ * (16 KB) for smoother gains. The custom curves come from points stored with
+ * the settings of the pads (pad_settings.h).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Curves generated with the fast math tables      						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#ifndef VELOCITY_CURVE_SIZE
+#define VELOCITY_CURVE_SIZE         256     /*!< Entries of the tables (256 or 4096) */
+#endif
+#define VELOCITY_CURVE_MAX_POINTS   16      /*!< Max points of a custom curve */
+#define VELOCITY_CURVE_MAX_VELOCITY 127     /*!< Velocity of peaks >= max_level */
+#define VELOCITY_CURVE_GAIN_ONE     32767   /*!< Gain of VELOCITY_CURVE_MAX_VELOCITY (Q15) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Shape of a velocity curve
+ */
+typedef enum {
+    VELOCITY_CURVE_LINEAR,      /*!< Velocity proportional to the peak */
+    VELOCITY_CURVE_LOG,         /*!< Soft hits raised (shape: steepness, i.e. 10) */
+    VELOCITY_CURVE_EXP,         /*!< Soft hits lowered (shape: steepness, i.e. 3) */
+    VELOCITY_CURVE_POWER,       /*!< x ^ shape (below 1 raises soft hits, above 1 lowers them) */
+    VELOCITY_CURVE_CUSTOM,      /*!< Points (VelocityCurveInitCustom()) */
+} velocity_curve_type_t;
+
+/**
+ * @brief Entry of a velocity table
+ */
+typedef struct {
+    int16_t gain;               /*!< Gain of the sample (Q15, VELOCITY_CURVE_GAIN_ONE at max velocity) */
+    uint8_t velocity;           /*!< MIDI velocity (1 to VELOCITY_CURVE_MAX_VELOCITY) */
+} velocity_entry_t;
+
+/**
+ * @brief Velocity curve instance (one per pad)
+ */
+typedef struct {
+    float threshold;                            /*!< Peak of the first entry */
+    float scale;                                /*!< Entries per signal unit */
+    velocity_entry_t table[VELOCITY_CURVE_SIZE];/*!< Velocity and gain of each peak */
+} velocity_curve_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Compute the table of a velocity curve
+ *
+ * @param curve             Curve instance
+ * @param type              Shape (not VELOCITY_CURVE_CUSTOM)
+ * @param shape             Steepness (LOG, EXP) or exponent (POWER), ignored by LINEAR
+ * @param threshold         Peak of velocity 1 (signal units, the threshold of the detector)
+ * @param max_level         Peak of VELOCITY_CURVE_MAX_VELOCITY (signal units)
+ * @return true             Table computed
+ * @return false            Invalid parameters
+ */
+bool VelocityCurveInit(velocity_curve_t * curve, velocity_curve_type_t type, float shape, float threshold, float max_level);
+
+/**
+ * @brief Compute the table of a custom velocity curve
+ *
+ * @param curve             Curve instance
+ * @param points            Velocities (1 to VELOCITY_CURVE_MAX_VELOCITY) at evenly spaced peaks, the first one at
+ *                          threshold and the last one at max_level
+ * @param n_points          Number of points (2 to VELOCITY_CURVE_MAX_POINTS)
+ * @param threshold         Peak of the first point (signal units)
+ * @param max_level         Peak of the last point (signal units)
+ * @return true             Table computed
+ * @return false            Invalid parameters
+ */
+bool VelocityCurveInitCustom(velocity_curve_t * curve, const uint8_t * points, uint8_t n_points, float threshold, float max_level);
+
+/**
+ * @brief Velocity and gain of a hit
+ *
+ * @param curve             Curve instance
+ * @param peak              Peak of the hit (signal units, limited to threshold and max_level)
+ * @return Entry of the table
+ */
+velocity_entry_t VelocityCurveLookup(const velocity_curve_t * curve, float peak);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* VELOCITY_CURVE_H_ */
+
+/*==================[end of file]============================================*/
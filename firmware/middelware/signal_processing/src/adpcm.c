@@ -0,0 +1,128 @@
+/**
+ * @file adpcm.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "adpcm.h"
+/*==================[macros and definitions]=================================*/
+#define ADPCM_MAX_INDEX     88
+/*==================[internal data declaration]==============================*/
+/** @brief IMA step sizes */
+static const int16_t adpcm_step[ADPCM_MAX_INDEX + 1] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+/** @brief IMA step index change of each code magnitude */
+static const int8_t adpcm_index_step[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Decode one code and update the state
+ */
+static inline int16_t AdpcmStep(adpcm_state_t * state, uint8_t code){
+    int32_t step = adpcm_step[state->index];
+    // diff = (code + 0.5) * step / 4, computed with shifts as in the reference decoder
+    int32_t diff = step >> 3;
+    if(code & 4){
+        diff += step;
+    }
+    if(code & 2){
+        diff += step >> 1;
+    }
+    if(code & 1){
+        diff += step >> 2;
+    }
+    int32_t predictor = state->predictor + ((code & 8) ? -diff : diff);
+    if(predictor > INT16_MAX){
+        predictor = INT16_MAX;
+    }
+    else if(predictor < INT16_MIN){
+        predictor = INT16_MIN;
+    }
+    int32_t index = state->index + adpcm_index_step[code & 7];
+    if(index < 0){
+        index = 0;
+    }
+    else if(index > ADPCM_MAX_INDEX){
+        index = ADPCM_MAX_INDEX;
+    }
+    state->predictor = (int16_t)predictor;
+    state->index = (uint8_t)index;
+    return state->predictor;
+}
+
+/**
+ * @brief Choose the code that best approximates a sample (the state is updated by decoding it)
+ */
+static uint8_t AdpcmEncodeSample(adpcm_state_t * state, int16_t x){
+    int32_t step = adpcm_step[state->index];
+    int32_t diff = x - state->predictor;
+    uint8_t code = 0;
+    if(diff < 0){
+        code = 8;
+        diff = -diff;
+    }
+    if(diff >= step){
+        code |= 4;
+        diff -= step;
+    }
+    if(diff >= step >> 1){
+        code |= 2;
+        diff -= step >> 1;
+    }
+    if(diff >= step >> 2){
+        code |= 1;
+    }
+    AdpcmStep(state, code);
+    return code;
+}
+/*==================[external functions definition]==========================*/
+void AdpcmInit(adpcm_state_t * state){
+    state->predictor = 0;
+    state->index = 0;
+}
+
+void AdpcmEncode(adpcm_state_t * state, const int16_t * input, uint8_t * output, uint32_t lenght){
+    for(uint32_t i = 0; i < lenght; i += 2){
+        uint8_t low = AdpcmEncodeSample(state, input[i]);
+        uint8_t high = (i + 1 < lenght) ? AdpcmEncodeSample(state, input[i + 1]) : 0;
+        output[i / 2] = low | (high << 4);
+    }
+}
+
+void AdpcmDecode(adpcm_state_t * state, const uint8_t * data, uint32_t pos, int16_t * output, uint16_t lenght){
+    const uint8_t * d = &data[pos / 2];
+    uint16_t i = 0;
+    // odd start: the high nibble of the current byte goes first
+    if((pos & 1) && lenght > 0){
+        output[i++] = AdpcmStep(state, *d++ >> 4);
+    }
+    for(; i + 1 < lenght; i += 2){
+        uint8_t byte = *d++;
+        output[i] = AdpcmStep(state, byte & 0x0F);
+        output[i + 1] = AdpcmStep(state, byte >> 4);
+    }
+    if(i < lenght){
+        output[i] = AdpcmStep(state, *d & 0x0F);
+    }
+}
+
+/*==================[end of file]============================================*/
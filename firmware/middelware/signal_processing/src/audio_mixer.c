@@ -0,0 +1,410 @@
+/**
+ * @file audio_mixer.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "audio_mixer.h"
+/*==================[macros and definitions]=================================*/
+#define AUDIO_MIXER_BLOCK   64      /*!< Samples accumulated on each pass over the voices */
+#define RATIO_ONE           (1UL << AUDIO_MIXER_RATIO_SHIFT)   /*!< Ratio of a voice without resampling */
+#define ENV_SHIFT           15      /*!< Envelope format: gain (Q3.12) with 15 more fractional bits */
+#define DECAY_SHIFT         30      /*!< Decay per sample format: Q2.30 */
+#define LIMIT_SHIFT         16      /*!< Master bus gain format: Q15.16 */
+/** @brief True if the voice is playing a PCM sample or an ADPCM stream */
+#define AUDIO_VOICE_ACTIVE(v)   ((v)->sample != NULL || (v)->adpcm != NULL)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Next source samples of a voice (up to AUDIO_MIXER_BLOCK, in 'decoded' if ADPCM or partly cached)
+ */
+static const int16_t * AudioMixerFetch(audio_voice_t * voice, int16_t * decoded, uint16_t n){
+    uint32_t pos = voice->pos;
+    uint32_t cached = (pos < voice->head_lenght) ? voice->head_lenght - pos : 0;
+    uint16_t k = (cached < n) ? (uint16_t)cached : n;
+    if(voice->adpcm != NULL){
+        // the attack copy is the start of the same stream
+        AdpcmDecode(&voice->state, voice->head, pos, decoded, k);
+        AdpcmDecode(&voice->state, voice->adpcm, pos + k, &decoded[k], n - k);
+        return decoded;
+    }
+    if(k == 0){
+        return &voice->sample[pos];
+    }
+    const int16_t * head = voice->head;
+    if(k == n){
+        return &head[pos];
+    }
+    memcpy(decoded, &head[pos], k * sizeof(int16_t));
+    memcpy(&decoded[k], &voice->sample[pos + k], (n - k) * sizeof(int16_t));
+    return decoded;
+}
+
+/**
+ * @brief Envelope step per sample along a block: linear ramp to the gain decayed lenght samples
+ */
+static int32_t AudioMixerEnvelope(const audio_voice_t * voice, uint16_t lenght){
+    // decay ^ lenght by squaring (fixed point, no floats in the audio path)
+    uint64_t d = 1ULL << DECAY_SHIFT;
+    uint64_t b = voice->decay;
+    for(uint16_t e = lenght; e > 0; e >>= 1){
+        if(e & 1){
+            d = (d * b) >> DECAY_SHIFT;
+        }
+        b = (b * b) >> DECAY_SHIFT;
+    }
+    int32_t end = (int32_t)(((int64_t)voice->env * (int64_t)d) >> DECAY_SHIFT);
+    return (end - voice->env) / lenght;
+}
+
+/**
+ * @brief Add the next samples of a resampled voice to the accumulator, releasing it at the end
+ */
+static void AudioMixerVoiceResampled(audio_voice_t * voice, int32_t * acc, uint16_t lenght, int32_t step){
+    int16_t decoded[AUDIO_MIXER_BLOCK];
+    int32_t offset = voice->offset;
+    int32_t env = voice->env;
+    uint16_t done = 0;
+    while(done < lenght){
+        // outputs whose source samples fit in one fetch (phase < 1.0 + AUDIO_MIXER_MAX_RATIO between calls)
+        uint32_t m = ((((uint32_t)AUDIO_MIXER_BLOCK << AUDIO_MIXER_RATIO_SHIFT) | (RATIO_ONE - 1)) - voice->phase) / voice->ratio + 1;
+        if(m > (uint32_t)(lenght - done)){
+            m = lenght - done;
+        }
+        uint32_t needed = (voice->phase + (m - 1) * voice->ratio) >> AUDIO_MIXER_RATIO_SHIFT;
+        uint32_t remaining = voice->lenght - voice->pos;
+        uint16_t k = (remaining < needed) ? (uint16_t)remaining : (uint16_t)needed;
+        const int16_t * s = AudioMixerFetch(voice, decoded, k);
+        voice->pos += k;
+        uint16_t j = 0;
+        for(uint16_t i = 0; i < m; i++){
+            while(voice->phase >= RATIO_ONE){
+                voice->phase -= RATIO_ONE;
+                if(voice->tail){
+                    // the output position went past the last sample
+                    voice->sample = NULL;
+                    voice->adpcm = NULL;
+                    voice->env = env;
+                    return;
+                }
+                voice->prev = voice->next;
+                if(j < k){
+                    voice->next = s[j++];
+                }
+                else{
+                    // silence after the last sample
+                    voice->next = (int16_t)offset;
+                    voice->tail = true;
+                }
+            }
+            // phase in Q15 so the product fits in 32 bits
+            int32_t y = voice->prev + (((int32_t)(voice->next - voice->prev) * (int32_t)(voice->phase >> 1)) >> (AUDIO_MIXER_RATIO_SHIFT - 1));
+            acc[done + i] += ((y - offset) * (env >> ENV_SHIFT)) >> AUDIO_MIXER_GAIN_SHIFT;
+            env += step;
+            voice->phase += voice->ratio;
+        }
+        done += m;
+    }
+    voice->env = env;
+}
+
+/**
+ * @brief Add the next samples of a voice to the accumulator, releasing it at the end
+ */
+static void AudioMixerVoice(audio_voice_t * voice, int32_t * acc, uint16_t lenght){
+    int16_t decoded[AUDIO_MIXER_BLOCK];
+    if(voice->choked){
+        // linear fade out along the block, then released
+        int32_t faded[AUDIO_MIXER_BLOCK];
+        memset(faded, 0, lenght * sizeof(int32_t));
+        voice->choked = false;
+        AudioMixerVoice(voice, faded, lenght);
+        for(uint16_t i = 0; i < lenght; i++){
+            acc[i] += faded[i] * (lenght - i) / lenght;
+        }
+        voice->sample = NULL;
+        voice->adpcm = NULL;
+        return;
+    }
+    int32_t step = (voice->decay != 0) ? AudioMixerEnvelope(voice, lenght) : 0;
+    if(voice->ratio != RATIO_ONE){
+        AudioMixerVoiceResampled(voice, acc, lenght, step);
+    }
+    else{
+        uint32_t remaining = voice->lenght - voice->pos;
+        uint16_t n = (remaining < lenght) ? (uint16_t)remaining : lenght;
+        const int16_t * s = AudioMixerFetch(voice, decoded, n);
+        int32_t offset = voice->offset;
+        if(step == 0){
+            int32_t gain = voice->gain;
+            for(uint16_t i = 0; i < n; i++){
+                acc[i] += ((s[i] - offset) * gain) >> AUDIO_MIXER_GAIN_SHIFT;
+            }
+        }
+        else{
+            int32_t env = voice->env;
+            for(uint16_t i = 0; i < n; i++){
+                acc[i] += ((s[i] - offset) * (env >> ENV_SHIFT)) >> AUDIO_MIXER_GAIN_SHIFT;
+                env += step;
+            }
+            voice->env = env;
+        }
+        voice->pos += n;
+        if(voice->pos >= voice->lenght){
+            voice->sample = NULL;
+            voice->adpcm = NULL;
+        }
+    }
+    voice->gain = (int16_t)(voice->env >> ENV_SHIFT);
+    if(voice->gain == 0 && voice->decay != 0){
+        // decayed under the resolution of the gain
+        voice->sample = NULL;
+        voice->adpcm = NULL;
+    }
+}
+/**
+ * @brief Voice stolen by the mixer policy (all the voices in use)
+ */
+static uint8_t AudioMixerSteal(audio_mixer_t * mixer){
+    uint8_t v = 0;
+    uint64_t min = UINT64_MAX;
+    for(uint8_t k = 0; k < mixer->max_voices; k++){
+        const audio_voice_t * voice = &mixer->voices[k];
+        uint64_t key;
+        if(voice->choked){
+            // already fading out
+            return k;
+        }
+        if(mixer->steal == AUDIO_MIXER_STEAL_QUIETEST){
+            key = (uint64_t)voice->gain * (voice->lenght - voice->pos) / voice->lenght;
+        }
+        else{
+            // started before (wraps with the counter)
+            key = (uint32_t)(voice->start - mixer->starts);
+        }
+        if(key < min){
+            min = key;
+            v = k;
+        }
+    }
+    return v;
+}
+
+/**
+ * @brief Take a free voice (or a stolen one) and set its lenght and gain
+ */
+static audio_voice_t * AudioMixerAllocate(audio_mixer_t * mixer, uint32_t lenght, float gain){
+    uint32_t free = ~mixer->active & ((1UL << mixer->max_voices) - 1);
+    uint8_t v = (free != 0) ? __builtin_ctz(free) : AudioMixerSteal(mixer);
+    long g = lrintf(gain * (1 << AUDIO_MIXER_GAIN_SHIFT));
+    audio_voice_t * voice = &mixer->voices[v];
+    mixer->active &= ~(1UL << v);
+    voice->sample = NULL;
+    voice->adpcm = NULL;
+    voice->lenght = lenght;
+    voice->pos = 0;
+    voice->offset = 0;
+    voice->gain = (g > INT16_MAX) ? INT16_MAX : (g < 0) ? 0 : (int16_t)g;
+    voice->env = (int32_t)voice->gain << ENV_SHIFT;
+    voice->decay = 0;
+    voice->ratio = RATIO_ONE;
+    voice->head = NULL;
+    voice->head_lenght = 0;
+    voice->start = mixer->starts++;
+    voice->group = AUDIO_MIXER_NO_CHOKE;
+    voice->choked = false;
+    return voice;
+}
+/*==================[external functions definition]==========================*/
+void AudioMixerInit(audio_mixer_t * mixer){
+    memset(mixer, 0, sizeof(audio_mixer_t));
+    mixer->steal = AUDIO_MIXER_STEAL_OLDEST;
+    mixer->max_voices = AUDIO_MIXER_VOICES;
+    AudioMixerSetMaster(mixer, 1.0f, INT16_MAX, AUDIO_MIXER_RELEASE);
+    mixer->limit = mixer->master;
+}
+
+void AudioMixerSetMaster(audio_mixer_t * mixer, float gain, int16_t threshold, uint32_t release){
+    long g = lrintf(gain * (1L << LIMIT_SHIFT));
+    mixer->master = (g > (long)AUDIO_MIXER_MAX_MASTER << LIMIT_SHIFT) ? (int32_t)AUDIO_MIXER_MAX_MASTER << LIMIT_SHIFT :
+                    (g < 0) ? 0 : (int32_t)g;
+    mixer->threshold = (threshold > 0) ? threshold : 1;
+    mixer->release = (release > 0) ? release : 1;
+}
+
+bool AudioMixerSetDecay(audio_mixer_t * mixer, uint8_t voice, float decay){
+    if(voice >= AUDIO_MIXER_VOICES || !AUDIO_VOICE_ACTIVE(&mixer->voices[voice]) || decay < 0){
+        return false;
+    }
+    // gain multiplied by exp(-1 / decay) every sample
+    mixer->voices[voice].decay = (decay > 0) ? (uint32_t)lrintf(expf(-1.0f / decay) * (1UL << DECAY_SHIFT)) : 0;
+    return true;
+}
+
+bool AudioMixerSetPolicy(audio_mixer_t * mixer, audio_mixer_steal_t steal, uint8_t max_voices){
+    if(max_voices == 0 || max_voices > AUDIO_MIXER_VOICES){
+        return false;
+    }
+    // voices over the new limit are stopped
+    for(uint8_t k = max_voices; k < AUDIO_MIXER_VOICES; k++){
+        mixer->voices[k].sample = NULL;
+        mixer->voices[k].adpcm = NULL;
+    }
+    mixer->active &= (1UL << max_voices) - 1;
+    mixer->steal = steal;
+    mixer->max_voices = max_voices;
+    return true;
+}
+
+uint8_t AudioMixerPlay(audio_mixer_t * mixer, const int16_t * sample, uint32_t lenght, int16_t offset, float gain){
+    audio_voice_t * voice = AudioMixerAllocate(mixer, lenght, gain);
+    voice->offset = offset;
+    voice->sample = (lenght > 0) ? sample : NULL;
+    mixer->active |= (uint32_t)(lenght > 0) << (voice - mixer->voices);
+    return voice - mixer->voices;
+}
+
+uint8_t AudioMixerPlayADPCM(audio_mixer_t * mixer, const uint8_t * data, uint32_t lenght, float gain){
+    audio_voice_t * voice = AudioMixerAllocate(mixer, lenght, gain);
+    AdpcmInit(&voice->state);
+    voice->adpcm = (lenght > 0) ? data : NULL;
+    mixer->active |= (uint32_t)(lenght > 0) << (voice - mixer->voices);
+    return voice - mixer->voices;
+}
+
+bool AudioMixerSetRatio(audio_mixer_t * mixer, uint8_t voice, float ratio){
+    if(voice >= AUDIO_MIXER_VOICES || !AUDIO_VOICE_ACTIVE(&mixer->voices[voice]) ||
+       ratio <= 0 || ratio > AUDIO_MIXER_MAX_RATIO){
+        return false;
+    }
+    audio_voice_t * v = &mixer->voices[voice];
+    uint32_t r = (uint32_t)lrintf(ratio * RATIO_ONE);
+    if(v->ratio == RATIO_ONE && r != RATIO_ONE){
+        // phase 2.0: the first output loads the samples pos and pos + 1
+        v->phase = 2 * RATIO_ONE;
+        v->prev = v->offset;
+        v->next = v->offset;
+        v->tail = false;
+    }
+    v->ratio = (r > 0) ? r : 1;
+    return true;
+}
+
+bool AudioMixerSetAttack(audio_mixer_t * mixer, uint8_t voice, const void * head, uint32_t head_lenght){
+    if(voice >= AUDIO_MIXER_VOICES || !AUDIO_VOICE_ACTIVE(&mixer->voices[voice])){
+        return false;
+    }
+    audio_voice_t * v = &mixer->voices[voice];
+    if(v->pos > 0 || (v->adpcm != NULL && (head_lenght & 1) && head_lenght < v->lenght)){
+        // the tail must start at a byte boundary of the ADPCM stream
+        return false;
+    }
+    if(head == NULL){
+        head_lenght = 0;
+    }
+    v->head = head;
+    v->head_lenght = (head_lenght < v->lenght) ? head_lenght : v->lenght;
+    return true;
+}
+
+uint8_t AudioMixerSetChoke(audio_mixer_t * mixer, uint8_t voice, uint8_t group){
+    uint8_t cut = 0;
+    if(voice >= AUDIO_MIXER_VOICES || !AUDIO_VOICE_ACTIVE(&mixer->voices[voice])){
+        return 0;
+    }
+    mixer->voices[voice].group = group;
+    if(group == AUDIO_MIXER_NO_CHOKE){
+        return 0;
+    }
+    uint32_t mask = mixer->active & ~(1UL << voice);
+    while(mask != 0){
+        uint8_t k = __builtin_ctz(mask);
+        mask &= mask - 1;
+        if(mixer->voices[k].group == group && !mixer->voices[k].choked){
+            mixer->voices[k].choked = true;
+            cut++;
+        }
+    }
+    return cut;
+}
+
+void AudioMixerStop(audio_mixer_t * mixer){
+    for(uint8_t k = 0; k < AUDIO_MIXER_VOICES; k++){
+        mixer->voices[k].sample = NULL;
+        mixer->voices[k].adpcm = NULL;
+    }
+    mixer->active = 0;
+}
+
+uint8_t AudioMixerActiveVoices(audio_mixer_t * mixer){
+    return __builtin_popcount(mixer->active);
+}
+
+void AudioMixerProcess(audio_mixer_t * mixer, int16_t * output, uint16_t lenght){
+    int32_t acc[AUDIO_MIXER_BLOCK];
+    while(lenght > 0){
+        uint16_t n = (lenght > AUDIO_MIXER_BLOCK) ? AUDIO_MIXER_BLOCK : lenght;
+        memset(acc, 0, n * sizeof(int32_t));
+        uint32_t mask = mixer->active;
+        while(mask != 0){
+            uint8_t k = __builtin_ctz(mask);
+            mask &= mask - 1;
+            AudioMixerVoice(&mixer->voices[k], acc, n);
+            if(!AUDIO_VOICE_ACTIVE(&mixer->voices[k])){
+                mixer->active &= ~(1UL << k);
+            }
+        }
+        // master bus: gain that keeps the peak of the block under the threshold (instant attack, linear release)
+        int32_t peak = 0;
+        for(uint16_t i = 0; i < n; i++){
+            int32_t a = (acc[i] < 0) ? -acc[i] : acc[i];
+            peak = (a > peak) ? a : peak;
+        }
+        int32_t target = mixer->master;
+        if((int64_t)peak * target > ((int64_t)mixer->threshold << LIMIT_SHIFT)){
+            target = (int32_t)(((int64_t)mixer->threshold << LIMIT_SHIFT) / peak);
+        }
+        int32_t g = mixer->limit;
+        int32_t end = target;
+        int32_t step = 0;
+        if(target <= g){
+            g = target;
+        }
+        else{
+            if(mixer->release > n){
+                end = g + (int32_t)((int64_t)(target - g) * n / mixer->release);
+            }
+            if(end - g < n){
+                // less than one step per sample left
+                end = target;
+            }
+            step = (end - g) / n;
+        }
+        // gain and saturation of the sum
+        for(uint16_t i = 0; i < n; i++){
+            int32_t y = (int32_t)(((int64_t)acc[i] * g) >> LIMIT_SHIFT);
+            output[i] = (y > INT16_MAX) ? INT16_MAX : (y < INT16_MIN) ? INT16_MIN : (int16_t)y;
+            g += step;
+        }
+        mixer->limit = end;
+        output += n;
+        lenght -= n;
+    }
+}
+
+/*==================[end of file]============================================*/
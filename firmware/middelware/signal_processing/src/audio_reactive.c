@@ -0,0 +1,149 @@
+/**
+ * @file audio_reactive.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <string.h>
+#include "audio_reactive.h"
+/*==================[macros and definitions]=================================*/
+#define RED_OFFSET      16
+#define GREEN_OFFSET    8
+#define BLUE_OFFSET     0
+#define LEVEL_ONE       256     /* Level 1 in the scale of the colors */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Weight of a new value of a one pole smoother with time constant time_ms,
+ * updated every frame_ms (1: no smoothing)
+ */
+static float AudioReactiveWeight(float time_ms, float frame_ms){
+    return (time_ms > 0) ? 1.0f - expf(-frame_ms / time_ms) : 1.0f;
+}
+
+/**
+ * @brief Add a color scaled by a level (0 to LEVEL_ONE) to the channels of an LED
+ */
+static void AudioReactiveAdd(uint16_t rgb[3], uint32_t color, uint16_t level){
+    rgb[0] += (((color >> RED_OFFSET) & 0xFF) * level) >> 8;
+    rgb[1] += (((color >> GREEN_OFFSET) & 0xFF) * level) >> 8;
+    rgb[2] += (((color >> BLUE_OFFSET) & 0xFF) * level) >> 8;
+}
+
+/*==================[external functions definition]==========================*/
+bool AudioReactiveInit(audio_reactive_t * ar, const audio_reactive_config_t * config){
+    uint8_t n = config->n_bands;
+    uint16_t bins = config->frame_lenght / 2;
+    if(n == 0 || n > AUDIO_REACTIVE_MAX_BANDS || config->palette == NULL || config->hop_lenght == 0 ||
+       config->min_frec <= 0 || config->max_frec <= config->min_frec || config->max_frec > config->sample_frec / 2 ||
+       config->range_db <= 0){
+        return false;
+    }
+    // n + 1 edges equally spaced in log(f), at least one bin per band
+    float bin_frec = config->sample_frec / config->frame_lenght;
+    float ratio = config->max_frec / config->min_frec;
+    for(uint8_t b = 0; b <= n; b++){
+        uint16_t k = (uint16_t)lrintf(config->min_frec * powf(ratio, (float)b / n) / bin_frec);
+        if(b > 0 && k <= ar->edge[b - 1]){
+            k = ar->edge[b - 1] + 1;
+        }
+        if(k > bins){
+            return false;
+        }
+        ar->edge[b] = k;
+    }
+    float frame_ms = 1000.0f * config->hop_lenght / config->sample_frec;
+    ar->n_bands = n;
+    ar->attack = AudioReactiveWeight(config->attack_ms, frame_ms);
+    ar->release = AudioReactiveWeight(config->release_ms, frame_ms);
+    ar->peak_decay = 1.0f - AudioReactiveWeight(AUDIO_REACTIVE_PEAK_MS, frame_ms);
+    ar->range_db = config->range_db;
+    ar->min_peak = (config->min_peak > 0) ? config->min_peak : 1e-12f;
+    ar->palette = config->palette;
+    AudioReactiveReset(ar);
+    return true;
+}
+
+void AudioReactiveProcess(audio_reactive_t * ar, const float * magnitude, uint16_t bins){
+    uint8_t n = ar->n_bands;
+    float frame_peak = 0;
+    // one pass over the bins of the bands
+    for(uint8_t b = 0; b < n; b++){
+        float energy = 0;
+        uint16_t end = (ar->edge[b + 1] < bins) ? ar->edge[b + 1] : bins;
+        for(uint16_t k = ar->edge[b]; k < end; k++){
+            energy += magnitude[k] * magnitude[k];
+        }
+        ar->energy[b] = energy;
+        if(energy > frame_peak){
+            frame_peak = energy;
+        }
+    }
+    ar->peak *= ar->peak_decay;
+    if(ar->peak < frame_peak){
+        ar->peak = frame_peak;
+    }
+    if(ar->peak < ar->min_peak){
+        ar->peak = ar->min_peak;
+    }
+    float inv_peak = 1.0f / ar->peak;
+    for(uint8_t b = 0; b < n; b++){
+        float target = 0;
+        if(ar->energy[b] > 0){
+            target = 1.0f + 10.0f * log10f(ar->energy[b] * inv_peak) / ar->range_db;
+            target = (target < 0) ? 0 : (target > 1) ? 1 : target;
+        }
+        float weight = (target > ar->level[b]) ? ar->attack : ar->release;
+        ar->level[b] += weight * (target - ar->level[b]);
+    }
+}
+
+void AudioReactiveRender(const audio_reactive_t * ar, uint32_t * colors, uint16_t leds){
+    uint8_t n = ar->n_bands;
+    uint16_t level[AUDIO_REACTIVE_MAX_BANDS];
+    for(uint8_t b = 0; b < n; b++){
+        level[b] = (uint16_t)(ar->level[b] * LEVEL_ONE);
+    }
+    for(uint16_t i = 0; i < leds; i++){
+        // bands of the LED: one segment of the stripe, or several bands mixed
+        uint8_t first = (uint32_t)i * n / leds;
+        uint8_t last = (uint32_t)(i + 1) * n / leds;
+        if(last <= first){
+            last = first + 1;
+        }
+        uint16_t rgb[3] = {0, 0, 0};
+        for(uint8_t b = first; b < last; b++){
+            AudioReactiveAdd(rgb, ar->palette[b], level[b]);
+        }
+        for(uint8_t c = 0; c < 3; c++){
+            rgb[c] = (rgb[c] > 0xFF) ? 0xFF : rgb[c];
+        }
+        colors[i] = ((uint32_t)rgb[0] << RED_OFFSET) | ((uint32_t)rgb[1] << GREEN_OFFSET) | ((uint32_t)rgb[2] << BLUE_OFFSET);
+    }
+}
+
+const float * AudioReactiveLevels(const audio_reactive_t * ar){
+    return ar->level;
+}
+
+void AudioReactiveReset(audio_reactive_t * ar){
+    memset(ar->energy, 0, sizeof(ar->energy));
+    memset(ar->level, 0, sizeof(ar->level));
+    ar->peak = ar->min_peak;
+}
+
+/*==================[end of file]============================================*/
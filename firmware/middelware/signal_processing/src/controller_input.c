@@ -0,0 +1,100 @@
+/**
+ * @file controller_input.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <stddef.h>
+#include "controller_input.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Store an event (if there is room)
+ */
+static uint16_t ControllerInputEvent(controller_event_t * events, uint16_t n, uint16_t max_events,
+    uint16_t pos, controller_event_type_t type, uint16_t value){
+    if(events != NULL && n < max_events){
+        events[n].pos = pos;
+        events[n].type = type;
+        events[n].value = value;
+    }
+    return n + 1;
+}
+
+/*==================[external functions definition]==========================*/
+bool ControllerInputInit(controller_input_t * ci, const controller_input_config_t * config){
+    if(config->sample_frec <= 0 || config->closed_level == config->open_level || config->time_ms < 0 ||
+       config->steps < 2 || config->steps > CONTROLLER_MAX_STEPS || config->hysteresis < 0 ||
+       config->close_position <= 0 || config->close_position >= 1){
+        return false;
+    }
+    ci->offset = config->open_level;
+    ci->gain = 1.0f / (config->closed_level - config->open_level);
+    ci->alpha = (config->time_ms > 0) ? 1.0f - expf(-1000.0f / (config->sample_frec * config->time_ms)) : 1.0f;
+    ci->max_value = config->steps - 1;
+    ci->threshold = 0.5f + config->hysteresis;
+    ci->close_value = config->close_position * ci->max_value;
+    ControllerInputReset(ci);
+    return true;
+}
+
+uint16_t ControllerInputProcess(controller_input_t * ci, const float * signal, uint16_t signal_lenght,
+    controller_event_t * events, uint16_t max_events){
+    uint16_t n = 0;
+    float half_band = ci->threshold - 0.5f;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        float position = (signal[i] - ci->offset) * ci->gain;
+        position = (position < 0) ? 0 : (position > 1) ? 1 : position;
+        if(!ci->started){
+            ci->position = position;
+        }else{
+            ci->position += ci->alpha * (position - ci->position);
+        }
+        float steps = ci->position * ci->max_value;
+        // the value only follows moves beyond the hysteresis band
+        if(!ci->started || fabsf(steps - ci->value) > ci->threshold){
+            ci->value = (uint16_t)lrintf(steps);
+            n = ControllerInputEvent(events, n, max_events, i, CONTROLLER_VALUE, ci->value);
+        }
+        bool closed = ci->closed ? (steps > ci->close_value - half_band) : (steps >= ci->close_value + half_band);
+        if(closed != ci->closed || (!ci->started && closed)){
+            ci->closed = closed;
+            n = ControllerInputEvent(events, n, max_events, i, closed ? CONTROLLER_CLOSED : CONTROLLER_OPENED, ci->value);
+        }
+        ci->started = true;
+    }
+    return n;
+}
+
+uint16_t ControllerInputValue(const controller_input_t * ci){
+    return ci->value;
+}
+
+float ControllerInputOpenAmount(const controller_input_t * ci){
+    return 1.0f - ci->value / ci->max_value;
+}
+
+void ControllerInputReset(controller_input_t * ci){
+    ci->position = 0;
+    ci->value = 0;
+    ci->closed = false;
+    ci->started = false;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,178 @@
+/**
+ * @file fast_conv.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include "fast_conv.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Transform lenght for a result of lenght n (power of two >= n, 0 if too long)
+ */
+static uint16_t FastConvLenght(uint32_t n){
+    uint32_t fft_lenght = 4;
+    while(fft_lenght < n){
+        fft_lenght *= 2;
+    }
+    return (fft_lenght <= MAX_SIGNAL_LENGHT) ? (uint16_t)fft_lenght : 0;
+}
+
+/**
+ * @brief Product of two packed spectra (a = a * b, or a = a * conj(b))
+ */
+static void FastConvMultiply(float * a, const float * b, uint16_t fft_lenght, bool conjugate){
+    // X[0] and X[N/2] are real
+    a[0] *= b[0];
+    a[1] *= b[1];
+    float sign = conjugate ? -1.0f : 1.0f;
+    for(uint16_t k = 2; k < fft_lenght; k += 2){
+        float a_re = a[k], a_im = a[k + 1];
+        float b_re = b[k], b_im = sign * b[k + 1];
+        a[k] = a_re * b_re - a_im * b_im;
+        a[k + 1] = a_re * b_im + a_im * b_re;
+    }
+}
+
+/**
+ * @brief Copy a signal to the start of a buffer and fill the rest with zeros
+ */
+static void FastConvPad(float * dest, const float * src, uint16_t lenght, uint16_t fft_lenght){
+    memcpy(dest, src, lenght * sizeof(float));
+    memset(&dest[lenght], 0, (fft_lenght - lenght) * sizeof(float));
+}
+
+/**
+ * @brief Convolve a full block: output = first block_lenght samples plus the previous tail
+ */
+static void FastConvBlock(fast_conv_t * conv){
+    uint16_t n = conv->fft_lenght;
+    uint16_t l = conv->block_lenght;
+    uint16_t t = conv->kernel_lenght - 1;
+    FastConvPad(conv->work, conv->input, l, n);
+    FFTRealForward(conv->work, n);
+    FastConvMultiply(conv->work, conv->kernel, n, false);
+    FFTRealInverse(conv->work, n);
+    // block_lenght >= kernel_lenght - 1: the previous tail ends in this block
+    for(uint16_t j = 0; j < t; j++){
+        conv->output[j] = conv->work[j] + conv->tail[j];
+        conv->tail[j] = conv->work[l + j];
+    }
+    memcpy(&conv->output[t], &conv->work[t], (l - t) * sizeof(float));
+}
+/*==================[external functions definition]==========================*/
+bool FastConvInit(fast_conv_t * conv, const float * kernel, uint16_t kernel_lenght, uint16_t fft_lenght, float * buffer){
+    if(kernel_lenght == 0 || FastConvLenght(fft_lenght) != fft_lenght || kernel_lenght > fft_lenght / 2 + 1){
+        return false;
+    }
+    conv->allocated = false;
+    if(buffer == NULL){
+        buffer = malloc(FAST_CONV_BUFFER_LENGHT(fft_lenght) * sizeof(float));
+        if(buffer == NULL){
+            return false;
+        }
+        conv->allocated = true;
+    }
+    conv->fft_lenght = fft_lenght;
+    conv->kernel_lenght = kernel_lenght;
+    conv->block_lenght = fft_lenght - kernel_lenght + 1;
+    conv->kernel = buffer;
+    conv->work = &buffer[fft_lenght];
+    conv->input = &buffer[2 * fft_lenght];
+    conv->output = &conv->input[conv->block_lenght];
+    conv->tail = &conv->output[conv->block_lenght];
+    // the kernel spectrum is computed once
+    FastConvPad(conv->kernel, kernel, kernel_lenght, fft_lenght);
+    FFTRealForward(conv->kernel, fft_lenght);
+    FastConvReset(conv);
+    return true;
+}
+
+void FastConvDeinit(fast_conv_t * conv){
+    if(conv->allocated){
+        free(conv->kernel);
+        conv->allocated = false;
+    }
+    conv->kernel = NULL;
+}
+
+void FastConvReset(fast_conv_t * conv){
+    memset(conv->input, 0, (2 * conv->block_lenght + conv->kernel_lenght - 1) * sizeof(float));
+    conv->fill = 0;
+}
+
+void FastConvProcess(fast_conv_t * conv, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    while(signal_lenght > 0){
+        uint16_t n = conv->block_lenght - conv->fill;
+        if(n > signal_lenght){
+            n = signal_lenght;
+        }
+        // input first, so the output can overwrite it
+        memcpy(&conv->input[conv->fill], input_signal, n * sizeof(float));
+        memcpy(output_signal, &conv->output[conv->fill], n * sizeof(float));
+        conv->fill += n;
+        if(conv->fill == conv->block_lenght){
+            FastConvBlock(conv);
+            conv->fill = 0;
+        }
+        input_signal += n;
+        output_signal += n;
+        signal_lenght -= n;
+    }
+}
+
+bool FastConvolve(const float * signal, uint16_t signal_lenght, const float * kernel, uint16_t kernel_lenght,
+    float * output, float * work){
+    uint32_t lenght = (uint32_t)signal_lenght + kernel_lenght - 1;
+    uint16_t n = FastConvLenght(lenght);
+    if(n == 0 || signal_lenght == 0 || kernel_lenght == 0){
+        return false;
+    }
+    FastConvPad(work, signal, signal_lenght, n);
+    FastConvPad(&work[n], kernel, kernel_lenght, n);
+    FFTRealForward(work, n);
+    FFTRealForward(&work[n], n);
+    FastConvMultiply(work, &work[n], n, false);
+    FFTRealInverse(work, n);
+    memcpy(output, work, lenght * sizeof(float));
+    return true;
+}
+
+bool FastCorrelate(const float * signal, uint16_t signal_lenght, const float * pattern, uint16_t pattern_lenght,
+    float * output, float * work){
+    uint32_t lenght = (uint32_t)signal_lenght + pattern_lenght - 1;
+    uint16_t n = FastConvLenght(lenght);
+    if(n == 0 || signal_lenght == 0 || pattern_lenght == 0){
+        return false;
+    }
+    FastConvPad(work, signal, signal_lenght, n);
+    FastConvPad(&work[n], pattern, pattern_lenght, n);
+    FFTRealForward(work, n);
+    FFTRealForward(&work[n], n);
+    FastConvMultiply(work, &work[n], n, true);
+    FFTRealInverse(work, n);
+    // circular lags: negative lags are at the end of the transform
+    uint16_t negative = pattern_lenght - 1;
+    memcpy(output, &work[n - negative], negative * sizeof(float));
+    memcpy(&output[negative], work, signal_lenght * sizeof(float));
+    return true;
+}
+
+/*==================[end of file]============================================*/
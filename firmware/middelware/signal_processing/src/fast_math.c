@@ -0,0 +1,182 @@
+/**
+ * @file fast_math.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "fast_math.h"
+#include "fast_math_tables.h"
+/*==================[macros and definitions]=================================*/
+#define SIN_TURN        (4 * FAST_MATH_SIN_TABLE)   /* Segments of a turn */
+#define SIN_SCALE       162.974661726f              /* SIN_TURN / (2 * pi) */
+#define Q15_FRAC_BITS   6                           /* Phase bits inside a segment (65536 / SIN_TURN) */
+#define LOG2_E          1.44269504089f
+#define LN_2            0.69314718056f
+#define LOG10_2         0.30102999566f
+#define MANT_BITS       23
+#define MANT_MASK       0x007FFFFF
+#define EXP_BIAS        127
+/*==================[internal data declaration]==============================*/
+typedef union {
+    float f;
+    uint32_t i;
+} float_bits_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Sine at segment + frac (SIN_TURN segments per turn, frac from 0 to 1).
+ * The quadrant picks the direction and the sign of the quarter turn table.
+ */
+static float FastSinSegment(int32_t segment, float frac){
+    uint16_t idx = segment & (SIN_TURN - 1);
+    uint16_t k = idx & (FAST_MATH_SIN_TABLE - 1);
+    float s;
+    if(idx & FAST_MATH_SIN_TABLE){
+        s = sin_table[FAST_MATH_SIN_TABLE - k] + frac * (sin_table[FAST_MATH_SIN_TABLE - k - 1] - sin_table[FAST_MATH_SIN_TABLE - k]);
+    }else{
+        s = sin_table[k] + frac * (sin_table[k + 1] - sin_table[k]);
+    }
+    return (idx & (2 * FAST_MATH_SIN_TABLE)) ? -s : s;
+}
+
+/**
+ * @brief Sine of a phase in Q15 (same as FastSinSegment, frac in Q15_FRAC_BITS)
+ */
+static int16_t FastSinPhase(uint16_t phase){
+    uint16_t idx = phase >> Q15_FRAC_BITS;
+    uint16_t k = idx & (FAST_MATH_SIN_TABLE - 1);
+    int32_t frac = phase & ((1 << Q15_FRAC_BITS) - 1);
+    int32_t a, b;
+    if(idx & FAST_MATH_SIN_TABLE){
+        a = sin_table_q15[FAST_MATH_SIN_TABLE - k];
+        b = sin_table_q15[FAST_MATH_SIN_TABLE - k - 1];
+    }else{
+        a = sin_table_q15[k];
+        b = sin_table_q15[k + 1];
+    }
+    int32_t s = a + (((b - a) * frac + (1 << (Q15_FRAC_BITS - 1))) >> Q15_FRAC_BITS);
+    return (int16_t)((idx & (2 * FAST_MATH_SIN_TABLE)) ? -s : s);
+}
+
+/**
+ * @brief Segment of x (rad) and position inside it
+ */
+static int32_t FastSinReduce(float x, float * frac){
+    float p = x * SIN_SCALE;
+    int32_t i = (int32_t)p;
+    if(p < i){
+        i--;
+    }
+    *frac = p - i;
+    return i;
+}
+
+/*==================[external functions definition]==========================*/
+float FastSinf(float x){
+    float frac;
+    int32_t i = FastSinReduce(x, &frac);
+    return FastSinSegment(i, frac);
+}
+
+float FastCosf(float x){
+    float frac;
+    int32_t i = FastSinReduce(x, &frac);
+    return FastSinSegment(i + FAST_MATH_SIN_TABLE, frac);
+}
+
+int16_t FastSinQ15(uint16_t phase){
+    return FastSinPhase(phase);
+}
+
+int16_t FastCosQ15(uint16_t phase){
+    return FastSinPhase(phase + FAST_MATH_Q15_TURN / 4);
+}
+
+float FastExp2f(float x){
+    if(x >= 128.0f){
+        return INFINITY;
+    }
+    if(!(x >= -126.0f)){
+        return 0;
+    }
+    int32_t i = (int32_t)x;
+    if(x < i){
+        i--;
+    }
+    // 2^x = 2^i * 2^f, the table gives 2^f (1 to 2), i goes to the exponent
+    float j = (x - i) * FAST_MATH_EXP_TABLE;
+    uint16_t k = (uint16_t)j;
+    if(k >= FAST_MATH_EXP_TABLE){
+        k = FAST_MATH_EXP_TABLE - 1;
+    }
+    float_bits_t u = { .f = exp2_table[k] + (j - k) * (exp2_table[k + 1] - exp2_table[k]) };
+    u.i += (uint32_t)i << MANT_BITS;
+    return u.f;
+}
+
+float FastExpf(float x){
+    return FastExp2f(x * LOG2_E);
+}
+
+float FastLog2f(float x){
+    float_bits_t u = { .f = x };
+    int32_t e = (int32_t)((u.i >> MANT_BITS) & 0xFF);
+    if(!(x > 0) || e == 0){
+        return -INFINITY;
+    }
+    // log2(2^e * m) = e + log2(m), m from 1 to 2 in FAST_MATH_LOG_TABLE segments
+    uint32_t mant = u.i & MANT_MASK;
+    uint16_t k = mant >> (MANT_BITS - 8);
+    float frac = (mant & ((1 << (MANT_BITS - 8)) - 1)) * (1.0f / (1 << (MANT_BITS - 8)));
+    return (e - EXP_BIAS) + (log2_table[k] + frac * (log2_table[k + 1] - log2_table[k]));
+}
+
+float FastLogf(float x){
+    return FastLog2f(x) * LN_2;
+}
+
+float FastLog10f(float x){
+    return FastLog2f(x) * LOG10_2;
+}
+
+float FastSqrtf(float x){
+    float_bits_t u = { .f = x };
+    int32_t e = (int32_t)((u.i >> MANT_BITS) & 0xFF);
+    if(!(x > 0) || e == 0){
+        return 0;
+    }
+    // sqrt(2^e * m) = 2^(e / 2) * sqrt(m), odd e: 2^((e - 1) / 2) * sqrt(2 * m)
+    e -= EXP_BIAS;
+    uint16_t base = 0;
+    if(e & 1){
+        base = FAST_MATH_SQRT_TABLE;
+        e--;
+    }
+    uint32_t mant = u.i & MANT_MASK;
+    uint16_t k = base + (mant >> (MANT_BITS - 7));
+    float frac = (mant & ((1 << (MANT_BITS - 7)) - 1)) * (1.0f / (1 << (MANT_BITS - 7)));
+    u.f = sqrt_table[k] + frac * (sqrt_table[k + 1] - sqrt_table[k]);
+    u.i += (uint32_t)(e / 2) << MANT_BITS;
+    return u.f;
+}
+
+float FastPowf(float x, float y){
+    if(!(x > 0)){
+        return 0;
+    }
+    return FastExp2f(y * FastLog2f(x));
+}
+
+/*==================[end of file]============================================*/
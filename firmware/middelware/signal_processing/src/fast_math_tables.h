@@ -0,0 +1,326 @@
+/**
+ * @file fast_math_tables.h
+ * @brief Lookup tables of fast_math.c
+ *
+ * Generated by fast_math_tables.py (signal_processing/tools), do not edit.
+ */
+
+#ifndef FAST_MATH_TABLES_H_
+#define FAST_MATH_TABLES_H_
+
+#include <stdint.h>
+
+/** sin(k * pi / 2 / 256), quarter turn */
+static const float sin_table[257] = {
+    0.000000000e+00f, 6.135884649e-03f, 1.227153829e-02f, 1.840672991e-02f,
+    2.454122852e-02f, 3.067480318e-02f, 3.680722294e-02f, 4.293825693e-02f,
+    4.906767433e-02f, 5.519524435e-02f, 6.132073630e-02f, 6.744391956e-02f,
+    7.356456360e-02f, 7.968243797e-02f, 8.579731234e-02f, 9.190895650e-02f,
+    9.801714033e-02f, 1.041216339e-01f, 1.102222073e-01f, 1.163186309e-01f,
+    1.224106752e-01f, 1.284981108e-01f, 1.345807085e-01f, 1.406582393e-01f,
+    1.467304745e-01f, 1.527971853e-01f, 1.588581433e-01f, 1.649131205e-01f,
+    1.709618888e-01f, 1.770042204e-01f, 1.830398880e-01f, 1.890686641e-01f,
+    1.950903220e-01f, 2.011046348e-01f, 2.071113762e-01f, 2.131103199e-01f,
+    2.191012402e-01f, 2.250839114e-01f, 2.310581083e-01f, 2.370236060e-01f,
+    2.429801799e-01f, 2.489276057e-01f, 2.548656596e-01f, 2.607941179e-01f,
+    2.667127575e-01f, 2.726213554e-01f, 2.785196894e-01f, 2.844075372e-01f,
+    2.902846773e-01f, 2.961508882e-01f, 3.020059493e-01f, 3.078496400e-01f,
+    3.136817404e-01f, 3.195020308e-01f, 3.253102922e-01f, 3.311063058e-01f,
+    3.368898534e-01f, 3.426607173e-01f, 3.484186802e-01f, 3.541635254e-01f,
+    3.598950365e-01f, 3.656129978e-01f, 3.713171940e-01f, 3.770074102e-01f,
+    3.826834324e-01f, 3.883450467e-01f, 3.939920401e-01f, 3.996241998e-01f,
+    4.052413140e-01f, 4.108431711e-01f, 4.164295601e-01f, 4.220002708e-01f,
+    4.275550934e-01f, 4.330938189e-01f, 4.386162385e-01f, 4.441221446e-01f,
+    4.496113297e-01f, 4.550835871e-01f, 4.605387110e-01f, 4.659764958e-01f,
+    4.713967368e-01f, 4.767992301e-01f, 4.821837721e-01f, 4.875501601e-01f,
+    4.928981922e-01f, 4.982276670e-01f, 5.035383837e-01f, 5.088301425e-01f,
+    5.141027442e-01f, 5.193559902e-01f, 5.245896827e-01f, 5.298036247e-01f,
+    5.349976199e-01f, 5.401714727e-01f, 5.453249884e-01f, 5.504579729e-01f,
+    5.555702330e-01f, 5.606615762e-01f, 5.657318108e-01f, 5.707807459e-01f,
+    5.758081914e-01f, 5.808139581e-01f, 5.857978575e-01f, 5.907597019e-01f,
+    5.956993045e-01f, 6.006164794e-01f, 6.055110414e-01f, 6.103828063e-01f,
+    6.152315906e-01f, 6.200572118e-01f, 6.248594881e-01f, 6.296382389e-01f,
+    6.343932842e-01f, 6.391244449e-01f, 6.438315429e-01f, 6.485144010e-01f,
+    6.531728430e-01f, 6.578066933e-01f, 6.624157776e-01f, 6.669999223e-01f,
+    6.715589548e-01f, 6.760927036e-01f, 6.806009978e-01f, 6.850836678e-01f,
+    6.895405447e-01f, 6.939714609e-01f, 6.983762494e-01f, 7.027547445e-01f,
+    7.071067812e-01f, 7.114321957e-01f, 7.157308253e-01f, 7.200025080e-01f,
+    7.242470830e-01f, 7.284643904e-01f, 7.326542717e-01f, 7.368165689e-01f,
+    7.409511254e-01f, 7.450577854e-01f, 7.491363945e-01f, 7.531867990e-01f,
+    7.572088465e-01f, 7.612023855e-01f, 7.651672656e-01f, 7.691033376e-01f,
+    7.730104534e-01f, 7.768884657e-01f, 7.807372286e-01f, 7.845565972e-01f,
+    7.883464276e-01f, 7.921065773e-01f, 7.958369046e-01f, 7.995372691e-01f,
+    8.032075315e-01f, 8.068475535e-01f, 8.104571983e-01f, 8.140363297e-01f,
+    8.175848132e-01f, 8.211025150e-01f, 8.245893028e-01f, 8.280450453e-01f,
+    8.314696123e-01f, 8.348628750e-01f, 8.382247056e-01f, 8.415549774e-01f,
+    8.448535652e-01f, 8.481203448e-01f, 8.513551931e-01f, 8.545579884e-01f,
+    8.577286100e-01f, 8.608669386e-01f, 8.639728561e-01f, 8.670462455e-01f,
+    8.700869911e-01f, 8.730949784e-01f, 8.760700942e-01f, 8.790122264e-01f,
+    8.819212643e-01f, 8.847970984e-01f, 8.876396204e-01f, 8.904487232e-01f,
+    8.932243012e-01f, 8.959662498e-01f, 8.986744657e-01f, 9.013488470e-01f,
+    9.039892931e-01f, 9.065957045e-01f, 9.091679831e-01f, 9.117060320e-01f,
+    9.142097557e-01f, 9.166790599e-01f, 9.191138517e-01f, 9.215140393e-01f,
+    9.238795325e-01f, 9.262102421e-01f, 9.285060805e-01f, 9.307669611e-01f,
+    9.329927988e-01f, 9.351835099e-01f, 9.373390119e-01f, 9.394592236e-01f,
+    9.415440652e-01f, 9.435934582e-01f, 9.456073254e-01f, 9.475855910e-01f,
+    9.495281806e-01f, 9.514350210e-01f, 9.533060404e-01f, 9.551411683e-01f,
+    9.569403357e-01f, 9.587034749e-01f, 9.604305194e-01f, 9.621214043e-01f,
+    9.637760658e-01f, 9.653944417e-01f, 9.669764710e-01f, 9.685220943e-01f,
+    9.700312532e-01f, 9.715038910e-01f, 9.729399522e-01f, 9.743393828e-01f,
+    9.757021300e-01f, 9.770281427e-01f, 9.783173707e-01f, 9.795697657e-01f,
+    9.807852804e-01f, 9.819638691e-01f, 9.831054874e-01f, 9.842100924e-01f,
+    9.852776424e-01f, 9.863080972e-01f, 9.873014182e-01f, 9.882575677e-01f,
+    9.891765100e-01f, 9.900582103e-01f, 9.909026354e-01f, 9.917097537e-01f,
+    9.924795346e-01f, 9.932119492e-01f, 9.939069700e-01f, 9.945645707e-01f,
+    9.951847267e-01f, 9.957674145e-01f, 9.963126122e-01f, 9.968202993e-01f,
+    9.972904567e-01f, 9.977230666e-01f, 9.981181129e-01f, 9.984755806e-01f,
+    9.987954562e-01f, 9.990777278e-01f, 9.993223846e-01f, 9.995294175e-01f,
+    9.996988187e-01f, 9.998305818e-01f, 9.999247018e-01f, 9.999811753e-01f,
+    1.000000000e+00f,
+};
+
+/** sin(k * pi / 2 / 256) in Q15 (32767 at k = 256) */
+static const int16_t sin_table_q15[257] = {
+         0,    201,    402,    603,    804,   1005,   1206,   1407,
+      1608,   1809,   2009,   2210,   2411,   2611,   2811,   3012,
+      3212,   3412,   3612,   3812,   4011,   4211,   4410,   4609,
+      4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,
+      6393,   6590,   6787,   6983,   7180,   7376,   7571,   7767,
+      7962,   8157,   8351,   8546,   8740,   8933,   9127,   9319,
+      9512,   9704,   9896,  10088,  10279,  10469,  10660,  10850,
+     11039,  11228,  11417,  11605,  11793,  11980,  12167,  12354,
+     12540,  12725,  12910,  13095,  13279,  13463,  13646,  13828,
+     14010,  14192,  14373,  14553,  14733,  14912,  15091,  15269,
+     15447,  15624,  15800,  15976,  16151,  16326,  16500,  16673,
+     16846,  17018,  17190,  17361,  17531,  17700,  17869,  18037,
+     18205,  18372,  18538,  18703,  18868,  19032,  19195,  19358,
+     19520,  19681,  19841,  20001,  20160,  20318,  20475,  20632,
+     20788,  20943,  21097,  21251,  21403,  21555,  21706,  21856,
+     22006,  22154,  22302,  22449,  22595,  22740,  22884,  23028,
+     23170,  23312,  23453,  23593,  23732,  23870,  24008,  24144,
+     24279,  24414,  24548,  24680,  24812,  24943,  25073,  25202,
+     25330,  25457,  25583,  25708,  25833,  25956,  26078,  26199,
+     26320,  26439,  26557,  26674,  26791,  26906,  27020,  27133,
+     27246,  27357,  27467,  27576,  27684,  27791,  27897,  28002,
+     28106,  28209,  28311,  28411,  28511,  28610,  28707,  28803,
+     28899,  28993,  29086,  29178,  29269,  29359,  29448,  29535,
+     29622,  29707,  29792,  29875,  29957,  30038,  30118,  30196,
+     30274,  30350,  30425,  30499,  30572,  30644,  30715,  30784,
+     30853,  30920,  30986,  31050,  31114,  31177,  31238,  31298,
+     31357,  31415,  31471,  31527,  31581,  31634,  31686,  31737,
+     31786,  31834,  31881,  31927,  31972,  32015,  32058,  32099,
+     32138,  32177,  32214,  32251,  32286,  32319,  32352,  32383,
+     32413,  32442,  32470,  32496,  32522,  32546,  32568,  32590,
+     32610,  32629,  32647,  32664,  32679,  32693,  32706,  32718,
+     32729,  32738,  32746,  32753,  32758,  32762,  32766,  32767,
+     32767,
+};
+
+/** 2^(k / 256) */
+static const float exp2_table[257] = {
+    1.000000000e+00f, 1.002711275e+00f, 1.005429901e+00f, 1.008155898e+00f,
+    1.010889286e+00f, 1.013630085e+00f, 1.016378315e+00f, 1.019133996e+00f,
+    1.021897149e+00f, 1.024667793e+00f, 1.027445949e+00f, 1.030231638e+00f,
+    1.033024879e+00f, 1.035825694e+00f, 1.038634102e+00f, 1.041450125e+00f,
+    1.044273782e+00f, 1.047105096e+00f, 1.049944086e+00f, 1.052790773e+00f,
+    1.055645178e+00f, 1.058507323e+00f, 1.061377227e+00f, 1.064254913e+00f,
+    1.067140401e+00f, 1.070033712e+00f, 1.072934868e+00f, 1.075843889e+00f,
+    1.078760798e+00f, 1.081685615e+00f, 1.084618362e+00f, 1.087559061e+00f,
+    1.090507733e+00f, 1.093464399e+00f, 1.096429082e+00f, 1.099401803e+00f,
+    1.102382583e+00f, 1.105371446e+00f, 1.108368412e+00f, 1.111373503e+00f,
+    1.114386743e+00f, 1.117408152e+00f, 1.120437752e+00f, 1.123475567e+00f,
+    1.126521619e+00f, 1.129575929e+00f, 1.132638520e+00f, 1.135709414e+00f,
+    1.138788635e+00f, 1.141876204e+00f, 1.144972144e+00f, 1.148076479e+00f,
+    1.151189230e+00f, 1.154310421e+00f, 1.157440074e+00f, 1.160578212e+00f,
+    1.163724859e+00f, 1.166880037e+00f, 1.170043770e+00f, 1.173216080e+00f,
+    1.176396992e+00f, 1.179586527e+00f, 1.182784711e+00f, 1.185991566e+00f,
+    1.189207115e+00f, 1.192431383e+00f, 1.195664392e+00f, 1.198906167e+00f,
+    1.202156731e+00f, 1.205416109e+00f, 1.208684324e+00f, 1.211961399e+00f,
+    1.215247360e+00f, 1.218542230e+00f, 1.221846033e+00f, 1.225158794e+00f,
+    1.228480536e+00f, 1.231811285e+00f, 1.235151064e+00f, 1.238499898e+00f,
+    1.241857812e+00f, 1.245224830e+00f, 1.248600977e+00f, 1.251986278e+00f,
+    1.255380757e+00f, 1.258784440e+00f, 1.262197350e+00f, 1.265619515e+00f,
+    1.269050957e+00f, 1.272491703e+00f, 1.275941778e+00f, 1.279401208e+00f,
+    1.282870016e+00f, 1.286348230e+00f, 1.289835873e+00f, 1.293332973e+00f,
+    1.296839555e+00f, 1.300355643e+00f, 1.303881265e+00f, 1.307416446e+00f,
+    1.310961212e+00f, 1.314515588e+00f, 1.318079601e+00f, 1.321653278e+00f,
+    1.325236643e+00f, 1.328829724e+00f, 1.332432547e+00f, 1.336045138e+00f,
+    1.339667524e+00f, 1.343299731e+00f, 1.346941786e+00f, 1.350593716e+00f,
+    1.354255547e+00f, 1.357927306e+00f, 1.361609021e+00f, 1.365300717e+00f,
+    1.369002423e+00f, 1.372714165e+00f, 1.376435971e+00f, 1.380167867e+00f,
+    1.383909882e+00f, 1.387662042e+00f, 1.391424376e+00f, 1.395196910e+00f,
+    1.398979673e+00f, 1.402772691e+00f, 1.406575994e+00f, 1.410389608e+00f,
+    1.414213562e+00f, 1.418047884e+00f, 1.421892602e+00f, 1.425747744e+00f,
+    1.429613338e+00f, 1.433489413e+00f, 1.437375997e+00f, 1.441273119e+00f,
+    1.445180807e+00f, 1.449099090e+00f, 1.453027996e+00f, 1.456967554e+00f,
+    1.460917794e+00f, 1.464878744e+00f, 1.468850433e+00f, 1.472832891e+00f,
+    1.476826146e+00f, 1.480830228e+00f, 1.484845166e+00f, 1.488870990e+00f,
+    1.492907728e+00f, 1.496955412e+00f, 1.501014070e+00f, 1.505083732e+00f,
+    1.509164428e+00f, 1.513256187e+00f, 1.517359041e+00f, 1.521473019e+00f,
+    1.525598151e+00f, 1.529734467e+00f, 1.533881998e+00f, 1.538040774e+00f,
+    1.542210825e+00f, 1.546392183e+00f, 1.550584878e+00f, 1.554788940e+00f,
+    1.559004400e+00f, 1.563231290e+00f, 1.567469640e+00f, 1.571719481e+00f,
+    1.575980845e+00f, 1.580253763e+00f, 1.584538265e+00f, 1.588834384e+00f,
+    1.593142151e+00f, 1.597461598e+00f, 1.601792756e+00f, 1.606135656e+00f,
+    1.610490332e+00f, 1.614856814e+00f, 1.619235135e+00f, 1.623625327e+00f,
+    1.628027422e+00f, 1.632441452e+00f, 1.636867450e+00f, 1.641305448e+00f,
+    1.645755478e+00f, 1.650217574e+00f, 1.654691768e+00f, 1.659178092e+00f,
+    1.663676580e+00f, 1.668187265e+00f, 1.672710180e+00f, 1.677245357e+00f,
+    1.681792831e+00f, 1.686352633e+00f, 1.690924799e+00f, 1.695509361e+00f,
+    1.700106354e+00f, 1.704715810e+00f, 1.709337763e+00f, 1.713972248e+00f,
+    1.718619298e+00f, 1.723278948e+00f, 1.727951231e+00f, 1.732636182e+00f,
+    1.737333835e+00f, 1.742044225e+00f, 1.746767386e+00f, 1.751503353e+00f,
+    1.756252160e+00f, 1.761013843e+00f, 1.765788436e+00f, 1.770575974e+00f,
+    1.775376493e+00f, 1.780190027e+00f, 1.785016611e+00f, 1.789856282e+00f,
+    1.794709075e+00f, 1.799575025e+00f, 1.804454168e+00f, 1.809346539e+00f,
+    1.814252176e+00f, 1.819171112e+00f, 1.824103385e+00f, 1.829049031e+00f,
+    1.834008086e+00f, 1.838980587e+00f, 1.843966569e+00f, 1.848966070e+00f,
+    1.853979125e+00f, 1.859005772e+00f, 1.864046048e+00f, 1.869099990e+00f,
+    1.874167634e+00f, 1.879249018e+00f, 1.884344179e+00f, 1.889453154e+00f,
+    1.894575982e+00f, 1.899712698e+00f, 1.904863342e+00f, 1.910027950e+00f,
+    1.915206561e+00f, 1.920399213e+00f, 1.925605944e+00f, 1.930826791e+00f,
+    1.936061793e+00f, 1.941310990e+00f, 1.946574418e+00f, 1.951852116e+00f,
+    1.957144124e+00f, 1.962450480e+00f, 1.967771223e+00f, 1.973106392e+00f,
+    1.978456026e+00f, 1.983820165e+00f, 1.989198847e+00f, 1.994592112e+00f,
+    2.000000000e+00f,
+};
+
+/** log2(1 + k / 256) */
+static const float log2_table[257] = {
+    0.000000000e+00f, 5.624549194e-03f, 1.122725542e-02f, 1.680828769e-02f,
+    2.236781303e-02f, 2.790599657e-02f, 3.342300154e-02f, 3.891898929e-02f,
+    4.439411936e-02f, 4.984854945e-02f, 5.528243550e-02f, 6.069593169e-02f,
+    6.608919046e-02f, 7.146236256e-02f, 7.681559705e-02f, 8.214904135e-02f,
+    8.746284125e-02f, 9.275714092e-02f, 9.803208296e-02f, 1.032878084e-01f,
+    1.085244568e-01f, 1.137421660e-01f, 1.189410727e-01f, 1.241213118e-01f,
+    1.292830169e-01f, 1.344263202e-01f, 1.395513524e-01f, 1.446582428e-01f,
+    1.497471195e-01f, 1.548181091e-01f, 1.598713368e-01f, 1.649069267e-01f,
+    1.699250014e-01f, 1.749256825e-01f, 1.799090900e-01f, 1.848753429e-01f,
+    1.898245589e-01f, 1.947568544e-01f, 1.996723448e-01f, 2.045711442e-01f,
+    2.094533656e-01f, 2.143191208e-01f, 2.191685205e-01f, 2.240016742e-01f,
+    2.288186905e-01f, 2.336196768e-01f, 2.384047393e-01f, 2.431739835e-01f,
+    2.479275134e-01f, 2.526654325e-01f, 2.573878427e-01f, 2.620948454e-01f,
+    2.667865407e-01f, 2.714630279e-01f, 2.761244053e-01f, 2.807707701e-01f,
+    2.854022189e-01f, 2.900188469e-01f, 2.946207489e-01f, 2.992080184e-01f,
+    3.037807482e-01f, 3.083390301e-01f, 3.128829553e-01f, 3.174126138e-01f,
+    3.219280949e-01f, 3.264294871e-01f, 3.309168781e-01f, 3.353903547e-01f,
+    3.398500029e-01f, 3.442959079e-01f, 3.487281542e-01f, 3.531468255e-01f,
+    3.575520046e-01f, 3.619437737e-01f, 3.663222142e-01f, 3.706874068e-01f,
+    3.750394313e-01f, 3.793783671e-01f, 3.837042925e-01f, 3.880172853e-01f,
+    3.923174228e-01f, 3.966047812e-01f, 4.008794363e-01f, 4.051414631e-01f,
+    4.093909361e-01f, 4.136279290e-01f, 4.178525149e-01f, 4.220647662e-01f,
+    4.262647547e-01f, 4.304525517e-01f, 4.346282276e-01f, 4.387918526e-01f,
+    4.429434958e-01f, 4.470832262e-01f, 4.512111118e-01f, 4.553272203e-01f,
+    4.594316186e-01f, 4.635243733e-01f, 4.676055501e-01f, 4.716752144e-01f,
+    4.757334310e-01f, 4.797802640e-01f, 4.838157773e-01f, 4.878400338e-01f,
+    4.918530963e-01f, 4.958550269e-01f, 4.998458871e-01f, 5.038257380e-01f,
+    5.077946402e-01f, 5.117526538e-01f, 5.156998383e-01f, 5.196362528e-01f,
+    5.235619561e-01f, 5.274770061e-01f, 5.313814605e-01f, 5.352753766e-01f,
+    5.391588111e-01f, 5.430318203e-01f, 5.468944599e-01f, 5.507467854e-01f,
+    5.545888517e-01f, 5.584207133e-01f, 5.622424242e-01f, 5.660540382e-01f,
+    5.698556083e-01f, 5.736471875e-01f, 5.774288280e-01f, 5.812005819e-01f,
+    5.849625007e-01f, 5.887146356e-01f, 5.924570373e-01f, 5.961897561e-01f,
+    5.999128422e-01f, 6.036263450e-01f, 6.073303137e-01f, 6.110247973e-01f,
+    6.147098441e-01f, 6.183855023e-01f, 6.220518195e-01f, 6.257088431e-01f,
+    6.293566201e-01f, 6.329951971e-01f, 6.366246205e-01f, 6.402449362e-01f,
+    6.438561898e-01f, 6.474584265e-01f, 6.510516912e-01f, 6.546360285e-01f,
+    6.582114828e-01f, 6.617780978e-01f, 6.653359172e-01f, 6.688849843e-01f,
+    6.724253420e-01f, 6.759570329e-01f, 6.794800995e-01f, 6.829945837e-01f,
+    6.865005272e-01f, 6.899979714e-01f, 6.934869575e-01f, 6.969675262e-01f,
+    7.004397181e-01f, 7.039035734e-01f, 7.073591321e-01f, 7.108064337e-01f,
+    7.142455177e-01f, 7.176764231e-01f, 7.210991887e-01f, 7.245138531e-01f,
+    7.279204546e-01f, 7.313190310e-01f, 7.347096202e-01f, 7.380922596e-01f,
+    7.414669864e-01f, 7.448338375e-01f, 7.481928496e-01f, 7.515440591e-01f,
+    7.548875022e-01f, 7.582232147e-01f, 7.615512324e-01f, 7.648715907e-01f,
+    7.681843248e-01f, 7.714894695e-01f, 7.747870596e-01f, 7.780771295e-01f,
+    7.813597135e-01f, 7.846348456e-01f, 7.879025594e-01f, 7.911628886e-01f,
+    7.944158664e-01f, 7.976615259e-01f, 8.008998999e-01f, 8.041310212e-01f,
+    8.073549221e-01f, 8.105716347e-01f, 8.137811912e-01f, 8.169836233e-01f,
+    8.201789624e-01f, 8.233672400e-01f, 8.265484873e-01f, 8.297227351e-01f,
+    8.328900142e-01f, 8.360503551e-01f, 8.392037881e-01f, 8.423503434e-01f,
+    8.454900509e-01f, 8.486229404e-01f, 8.517490414e-01f, 8.548683833e-01f,
+    8.579809951e-01f, 8.610869060e-01f, 8.641861447e-01f, 8.672787397e-01f,
+    8.703647196e-01f, 8.734441125e-01f, 8.765169466e-01f, 8.795832496e-01f,
+    8.826430494e-01f, 8.856963733e-01f, 8.887432489e-01f, 8.917837032e-01f,
+    8.948177633e-01f, 8.978454560e-01f, 9.008668080e-01f, 9.038818457e-01f,
+    9.068905956e-01f, 9.098930838e-01f, 9.128893362e-01f, 9.158793788e-01f,
+    9.188632373e-01f, 9.218409371e-01f, 9.248125036e-01f, 9.277779621e-01f,
+    9.307373376e-01f, 9.336906550e-01f, 9.366379390e-01f, 9.395792143e-01f,
+    9.425145053e-01f, 9.454438364e-01f, 9.483672316e-01f, 9.512847150e-01f,
+    9.541963104e-01f, 9.571020416e-01f, 9.600019321e-01f, 9.628960053e-01f,
+    9.657842847e-01f, 9.686667932e-01f, 9.715435540e-01f, 9.744145898e-01f,
+    9.772799235e-01f, 9.801395776e-01f, 9.829935747e-01f, 9.858419370e-01f,
+    9.886846868e-01f, 9.915218461e-01f, 9.943534369e-01f, 9.971794809e-01f,
+    1.000000000e+00f,
+};
+
+/** sqrt(1 + k / 128) for k < 128, then sqrt(2 + 2 * k / 128) */
+static const float sqrt_table[257] = {
+    1.000000000e+00f, 1.003898650e+00f, 1.007782219e+00f, 1.011650879e+00f,
+    1.015504801e+00f, 1.019344152e+00f, 1.023169096e+00f, 1.026979795e+00f,
+    1.030776406e+00f, 1.034559085e+00f, 1.038327983e+00f, 1.042083250e+00f,
+    1.045825033e+00f, 1.049553476e+00f, 1.053268722e+00f, 1.056970908e+00f,
+    1.060660172e+00f, 1.064336648e+00f, 1.068000468e+00f, 1.071651762e+00f,
+    1.075290658e+00f, 1.078917281e+00f, 1.082531755e+00f, 1.086134200e+00f,
+    1.089724736e+00f, 1.093303480e+00f, 1.096870548e+00f, 1.100426054e+00f,
+    1.103970108e+00f, 1.107502822e+00f, 1.111024302e+00f, 1.114534656e+00f,
+    1.118033989e+00f, 1.121522403e+00f, 1.125000000e+00f, 1.128466880e+00f,
+    1.131923142e+00f, 1.135368883e+00f, 1.138804197e+00f, 1.142229180e+00f,
+    1.145643924e+00f, 1.149048519e+00f, 1.152443057e+00f, 1.155827626e+00f,
+    1.159202312e+00f, 1.162567202e+00f, 1.165922382e+00f, 1.169267933e+00f,
+    1.172603940e+00f, 1.175930483e+00f, 1.179247642e+00f, 1.182555496e+00f,
+    1.185854123e+00f, 1.189143599e+00f, 1.192424002e+00f, 1.195695404e+00f,
+    1.198957881e+00f, 1.202211504e+00f, 1.205456345e+00f, 1.208692475e+00f,
+    1.211919964e+00f, 1.215138881e+00f, 1.218349293e+00f, 1.221551268e+00f,
+    1.224744871e+00f, 1.227930169e+00f, 1.231107225e+00f, 1.234276104e+00f,
+    1.237436867e+00f, 1.240589578e+00f, 1.243734296e+00f, 1.246871084e+00f,
+    1.250000000e+00f, 1.253121103e+00f, 1.256234453e+00f, 1.259340105e+00f,
+    1.262438117e+00f, 1.265528546e+00f, 1.268611446e+00f, 1.271686872e+00f,
+    1.274754878e+00f, 1.277815519e+00f, 1.280868846e+00f, 1.283914912e+00f,
+    1.286953768e+00f, 1.289985465e+00f, 1.293010054e+00f, 1.296027585e+00f,
+    1.299038106e+00f, 1.302041666e+00f, 1.305038314e+00f, 1.308028096e+00f,
+    1.311011060e+00f, 1.313987253e+00f, 1.316956719e+00f, 1.319919505e+00f,
+    1.322875656e+00f, 1.325825215e+00f, 1.328768227e+00f, 1.331704735e+00f,
+    1.334634782e+00f, 1.337558410e+00f, 1.340475662e+00f, 1.343386579e+00f,
+    1.346291202e+00f, 1.349189572e+00f, 1.352081728e+00f, 1.354967712e+00f,
+    1.357847561e+00f, 1.360721316e+00f, 1.363589014e+00f, 1.366450694e+00f,
+    1.369306394e+00f, 1.372156150e+00f, 1.375000000e+00f, 1.377837980e+00f,
+    1.380670127e+00f, 1.383496476e+00f, 1.386317063e+00f, 1.389131923e+00f,
+    1.391941091e+00f, 1.394744600e+00f, 1.397542486e+00f, 1.400334781e+00f,
+    1.403121520e+00f, 1.405902735e+00f, 1.408678459e+00f, 1.411448724e+00f,
+    1.414213562e+00f, 1.419727086e+00f, 1.425219281e+00f, 1.430690393e+00f,
+    1.436140662e+00f, 1.441570324e+00f, 1.446979613e+00f, 1.452368755e+00f,
+    1.457737974e+00f, 1.463087489e+00f, 1.468417516e+00f, 1.473728265e+00f,
+    1.479019946e+00f, 1.484292761e+00f, 1.489546911e+00f, 1.494782593e+00f,
+    1.500000000e+00f, 1.505199322e+00f, 1.510380747e+00f, 1.515544457e+00f,
+    1.520690633e+00f, 1.525819452e+00f, 1.530931089e+00f, 1.536025716e+00f,
+    1.541103501e+00f, 1.546164610e+00f, 1.551209206e+00f, 1.556237450e+00f,
+    1.561249500e+00f, 1.566245511e+00f, 1.571225636e+00f, 1.576190027e+00f,
+    1.581138830e+00f, 1.586072193e+00f, 1.590990258e+00f, 1.595893167e+00f,
+    1.600781059e+00f, 1.605654072e+00f, 1.610512341e+00f, 1.615355998e+00f,
+    1.620185175e+00f, 1.625000000e+00f, 1.629800601e+00f, 1.634587104e+00f,
+    1.639359631e+00f, 1.644118305e+00f, 1.648863245e+00f, 1.653594569e+00f,
+    1.658312395e+00f, 1.663016837e+00f, 1.667708008e+00f, 1.672386020e+00f,
+    1.677050983e+00f, 1.681703006e+00f, 1.686342195e+00f, 1.690968657e+00f,
+    1.695582496e+00f, 1.700183814e+00f, 1.704772712e+00f, 1.709349291e+00f,
+    1.713913650e+00f, 1.718465886e+00f, 1.723006094e+00f, 1.727534370e+00f,
+    1.732050808e+00f, 1.736555499e+00f, 1.741048535e+00f, 1.745530005e+00f,
+    1.750000000e+00f, 1.754458606e+00f, 1.758905910e+00f, 1.763341997e+00f,
+    1.767766953e+00f, 1.772180860e+00f, 1.776583800e+00f, 1.780975856e+00f,
+    1.785357107e+00f, 1.789727633e+00f, 1.794087512e+00f, 1.798436821e+00f,
+    1.802775638e+00f, 1.807104037e+00f, 1.811422093e+00f, 1.815729881e+00f,
+    1.820027472e+00f, 1.824314940e+00f, 1.828592355e+00f, 1.832859787e+00f,
+    1.837117307e+00f, 1.841364983e+00f, 1.845602883e+00f, 1.849831073e+00f,
+    1.854049622e+00f, 1.858258593e+00f, 1.862458053e+00f, 1.866648065e+00f,
+    1.870828693e+00f, 1.875000000e+00f, 1.879162047e+00f, 1.883314897e+00f,
+    1.887458609e+00f, 1.891593244e+00f, 1.895718861e+00f, 1.899835519e+00f,
+    1.903943276e+00f, 1.908042190e+00f, 1.912132318e+00f, 1.916213715e+00f,
+    1.920286437e+00f, 1.924350540e+00f, 1.928406078e+00f, 1.932453104e+00f,
+    1.936491673e+00f, 1.940521837e+00f, 1.944543648e+00f, 1.948557159e+00f,
+    1.952562419e+00f, 1.956559480e+00f, 1.960548393e+00f, 1.964529206e+00f,
+    1.968501969e+00f, 1.972466730e+00f, 1.976423538e+00f, 1.980372440e+00f,
+    1.984313483e+00f, 1.988246715e+00f, 1.992172181e+00f, 1.996089928e+00f,
+    2.000000000e+00f,
+};
+
+#endif /* FAST_MATH_TABLES_H_ */
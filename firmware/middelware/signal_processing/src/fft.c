@@ -11,15 +11,22 @@
 
 /*==================[inclusions]=============================================*/
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include "fft.h"
+#include "fast_math.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
-static float wind[MAX_SIGNAL_LENGHT];
+static float default_buffer[FFT_PLAN_BUFFER_LENGHT(MAX_SIGNAL_LENGHT)];   /*!< Window and work buffer of default_plan */
+static fft_plan_t default_plan;                                     /*!< Plan used by FFTMagnitude (Hann window) */
+static float rfft_twiddle[2 * (MAX_SIGNAL_LENGHT / 4 + 1)];         /*!< cos, sin of 2*pi*k/MAX_SIGNAL_LENGHT (k <= N/4) */
+static int16_t fft_q15[MAX_SIGNAL_LENGHT];                          /*!< N real samples packed as N/2 sc16 points */
+static int16_t wind_q15[MAX_SIGNAL_LENGHT];                         /*!< Hann window in Q15 */
+static uint16_t wind_q15_lenght;                                    /*!< Lenght of wind_q15 (0: not generated) */
+static int16_t rfft_twiddle_q15[2 * (MAX_SIGNAL_LENGHT / 4 + 1)];   /*!< rfft_twiddle in Q15 */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,36 +34,370 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Real FFT of N samples stored as N/2 complex points (even samples in the
+ * real part, odd samples in the imaginary part)
+ * 
+ * After the N/2 points complex FFT, the spectra of the even and odd samples are
+ * split and combined with a twiddle factor (X[k] = E[k] + W^k O[k]). On return,
+ * data holds X[k] for k = 0 .. N/2 - 1 (the imaginary part of X[0] holds X[N/2]).
+ */
+static void FFTReal(float * data, uint16_t signal_lenght){
+    uint16_t n2 = signal_lenght / 2;
+    uint16_t step = MAX_SIGNAL_LENGHT / signal_lenght;
+    dsps_fft2r_fc32(data, n2);
+    dsps_bit_rev_fc32(data, n2);
+    float re0 = data[0];
+    data[0] = re0 + data[1];
+    data[1] = re0 - data[1];
+    for(uint16_t k = 1; k <= n2 / 2; k++){
+        uint16_t m = n2 - k;
+        float zk_re = data[2 * k], zk_im = data[2 * k + 1];
+        float zm_re = data[2 * m], zm_im = data[2 * m + 1];
+        // E = (Z[k] + conj(Z[m])) / 2, O = (Z[k] - conj(Z[m])) / 2j
+        float e_re = 0.5f * (zk_re + zm_re);
+        float e_im = 0.5f * (zk_im - zm_im);
+        float o_re = 0.5f * (zk_im + zm_im);
+        float o_im = -0.5f * (zk_re - zm_re);
+        // W^k O, with W = exp(-j*2*pi/N)
+        float c = rfft_twiddle[2 * k * step];
+        float s = rfft_twiddle[2 * k * step + 1];
+        float t_re = c * o_re + s * o_im;
+        float t_im = c * o_im - s * o_re;
+        // X[k] = E + W^k O, X[N/2 - k] = conj(E - W^k O)
+        data[2 * k] = e_re + t_re;
+        data[2 * k + 1] = e_im + t_im;
+        data[2 * m] = e_re - t_re;
+        data[2 * m + 1] = t_im - e_im;
+    }
+}
 
+
+/**
+ * @brief Inverse of FFTReal: the even and odd spectra are rebuilt from X[k] and
+ * X[N/2 - k], packed as Z[k] = E[k] + j O[k] and transformed back with an N/2
+ * points complex FFT (conjugated input and output).
+ */
+static void FFTRealInv(float * data, uint16_t signal_lenght){
+    uint16_t n2 = signal_lenght / 2;
+    uint16_t step = MAX_SIGNAL_LENGHT / signal_lenght;
+    float x0 = data[0], xn2 = data[1];
+    // Z[0] = E[0] + j O[0], conjugated for the inverse
+    data[0] = 0.5f * (x0 + xn2);
+    data[1] = -0.5f * (x0 - xn2);
+    for(uint16_t k = 1; k <= n2 / 2; k++){
+        uint16_t m = n2 - k;
+        float xk_re = data[2 * k], xk_im = data[2 * k + 1];
+        float xm_re = data[2 * m], xm_im = data[2 * m + 1];
+        // E = (X[k] + conj(X[N/2 - k])) / 2, D = W^k O = (X[k] - conj(X[N/2 - k])) / 2
+        float e_re = 0.5f * (xk_re + xm_re);
+        float e_im = 0.5f * (xk_im - xm_im);
+        float d_re = 0.5f * (xk_re - xm_re);
+        float d_im = 0.5f * (xk_im + xm_im);
+        // O = W^-k D
+        float c = rfft_twiddle[2 * k * step];
+        float s = rfft_twiddle[2 * k * step + 1];
+        float o_re = c * d_re - s * d_im;
+        float o_im = s * d_re + c * d_im;
+        // Z[k] = E + j O, Z[N/2 - k] = conj(E) + j conj(O), both conjugated
+        data[2 * k] = e_re - o_im;
+        data[2 * k + 1] = -(e_im + o_re);
+        data[2 * m] = e_re + o_im;
+        data[2 * m + 1] = -(o_re - e_im);
+    }
+    dsps_fft2r_fc32(data, n2);
+    dsps_bit_rev_fc32(data, n2);
+    // conjugate and scale: z[n] = x[2n] + j x[2n+1]
+    float scale = 1.0f / n2;
+    for(uint16_t i = 0; i < n2; i++){
+        data[2 * i] *= scale;
+        data[2 * i + 1] *= -scale;
+    }
+}
+
+/**
+ * @brief Integer square root (rounded down)
+ */
+static uint16_t FFTSqrtU32(uint32_t x){
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while(bit > x){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(x >= res + bit){
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else{
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)res;
+}
+
+/**
+ * @brief Fixed point version of FFTReal(): each FFT stage scales by 1/2, and the
+ * split is done with 32 bits intermediate values. On return, data holds
+ * X[k] / (N/2) for k = 0 .. N/2 - 1 (the imaginary part of X[0] is cleared).
+ */
+static void FFTRealQ15(int16_t * data, uint16_t signal_lenght){
+    uint16_t n2 = signal_lenght / 2;
+    uint16_t step = MAX_SIGNAL_LENGHT / signal_lenght;
+    // generic sc16 macros are only defined for some DSP configurations
+    dsps_fft2r_sc16_ansi(data, n2);
+    dsps_bit_rev_sc16_ansi(data, n2);
+    for(uint16_t k = 1; k <= n2 / 2; k++){
+        uint16_t m = n2 - k;
+        int32_t zk_re = data[2 * k], zk_im = data[2 * k + 1];
+        int32_t zm_re = data[2 * m], zm_im = data[2 * m + 1];
+        // 2E = Z[k] + conj(Z[m]), 2O = (Z[k] - conj(Z[m])) / j
+        int32_t e_re = zk_re + zm_re;
+        int32_t e_im = zk_im - zm_im;
+        int32_t o_re = zk_im + zm_im;
+        int32_t o_im = zm_re - zk_re;
+        int32_t c = rfft_twiddle_q15[2 * k * step];
+        int32_t s = rfft_twiddle_q15[2 * k * step + 1];
+        int32_t t_re = (c * o_re + s * o_im) >> 15;
+        int32_t t_im = (c * o_im - s * o_re) >> 15;
+        // 2X[k] = 2E + W^k 2O, 2X[N/2 - k] = conj(2E - W^k 2O), stored halved
+        data[2 * k] = (int16_t)((e_re + t_re) >> 1);
+        data[2 * k + 1] = (int16_t)((e_im + t_im) >> 1);
+        data[2 * m] = (int16_t)((e_re - t_re) >> 1);
+        data[2 * m + 1] = (int16_t)((t_im - e_im) >> 1);
+    }
+    data[0] = data[0] + data[1];
+    data[1] = 0;
+}
+
+/**
+ * @brief Coefficients of the cosine sum of a window: w(i) = a0 - a1 cos(x) + a2 cos(2x) - ...
+ * (a0 is the nominal coherent gain)
+ */
+static const float * FFTWindowCoeffs(fft_window_t window, uint8_t * n_coeffs){
+    static const float hann[] = {0.5f, 0.5f};
+    static const float blackman[] = {0.42f, 0.5f, 0.08f};
+    static const float flat_top[] = {0.21557895f, 0.41663158f, 0.277263158f, 0.083578947f, 0.006947368f};
+    switch(window){
+        case FFT_WINDOW_BLACKMAN:
+            *n_coeffs = 3;
+            return blackman;
+        case FFT_WINDOW_FLAT_TOP:
+            *n_coeffs = 5;
+            return flat_top;
+        case FFT_WINDOW_HANN:
+        default:
+            *n_coeffs = 2;
+            return hann;
+    }
+}
+
+/**
+ * @brief Symmetric window of signal_lenght points (same as dsps_wind_*_f32, with the cosines from the tables)
+ */
+static void FFTWindowGenerate(float * wind, uint16_t signal_lenght, fft_window_t window){
+    uint8_t n_coeffs;
+    const float * a = FFTWindowCoeffs(window, &n_coeffs);
+    float step = 2 * (float)M_PI / (signal_lenght - 1);
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        float w = a[0];
+        for(uint8_t c = 1; c < n_coeffs; c++){
+            float term = a[c] * FastCosf(step * (float)(c * i));
+            w += (c & 1) ? -term : term;
+        }
+        wind[i] = w;
+    }
+}
+
+/**
+ * @brief Nominal coherent gain of a window (a0 coefficient of the cosine sum)
+ */
+static float FFTWindowGain(fft_window_t window){
+    uint8_t n_coeffs;
+    return FFTWindowCoeffs(window, &n_coeffs)[0];
+}
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
     esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
     if (ret != ESP_OK){
         return false;
     }
+    // Twiddle factors for the real FFT split (only the first quarter turn is needed)
+    for(uint16_t k = 0; k <= MAX_SIGNAL_LENGHT / 4; k++){
+        float angle = 2 * M_PI * k / MAX_SIGNAL_LENGHT;
+        rfft_twiddle[2 * k] = cosf(angle);
+        rfft_twiddle[2 * k + 1] = sinf(angle);
+    }
+    return true;
+}
+
+bool FFTQ15Init(void){
+    esp_err_t ret = dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (ret != ESP_OK){
+        return false;
+    }
+    for(uint16_t k = 0; k <= MAX_SIGNAL_LENGHT / 4; k++){
+        float angle = 2 * M_PI * k / MAX_SIGNAL_LENGHT;
+        rfft_twiddle_q15[2 * k] = (int16_t)lrintf(INT16_MAX * cosf(angle));
+        rfft_twiddle_q15[2 * k + 1] = (int16_t)lrintf(INT16_MAX * sinf(angle));
+    }
     return true;
 }
 
+void FFTMagnitudeQ15(const uint16_t * signal, uint16_t offset, uint16_t * fft, uint16_t signal_lenght){
+    // Hann window is only generated again when the lenght changes
+    if(wind_q15_lenght != signal_lenght){
+        for(uint16_t i = 0; i < signal_lenght; i++){
+            // Hann: 0.5 - 0.5 cos(2 pi i / (N - 1)), the phase of the cosine in Q15 turns
+            uint16_t phase = (uint16_t)(((uint32_t)i * FAST_MATH_Q15_TURN + (signal_lenght - 1) / 2) / (signal_lenght - 1));
+            wind_q15[i] = (int16_t)((INT16_MAX - FastCosQ15(phase) + 1) >> 1);
+        }
+        wind_q15_lenght = signal_lenght;
+    }
+    // Remove offset, scale to Q15 and multiply with window, packed as N/2 complex points
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        int32_t x = ((int32_t)signal[i] - offset) * (1 << FFT_Q15_INPUT_SHIFT);
+        fft_q15[i] = (int16_t)((x * wind_q15[i]) >> 15);
+    }
+    FFTRealQ15(fft_q15, signal_lenght);
+    // Magnitude: with the FFT scaling, |data| / 2 has the scale of FFTMagnitude
+    for(uint16_t j = 0; j < signal_lenght / 2; j++){
+        int32_t re = fft_q15[2 * j];
+        int32_t im = fft_q15[2 * j + 1];
+        fft[j] = FFTSqrtU32((uint32_t)(re * re + im * im)) >> 1;
+    }
+    // DC is scaled by 1/4 of the other bins
+    fft[0] = fft[0] / 4;
+}
+
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght, fft_window_t window, float * buffer){
+    if(signal_lenght < 4 || signal_lenght > MAX_SIGNAL_LENGHT || (signal_lenght & (signal_lenght - 1)) != 0){
+        return false;
+    }
+    plan->allocated = false;
+    if(buffer == NULL){
+        buffer = malloc(FFT_PLAN_BUFFER_LENGHT(signal_lenght) * sizeof(float));
+        if(buffer == NULL){
+            ESP_LOGE(TAG, "Not enough memory for a %d points plan", signal_lenght);
+            return false;
+        }
+        plan->allocated = true;
+    }
+    float * wind = buffer;
+    FFTWindowGenerate(wind, signal_lenght, window);
+    plan->signal_lenght = signal_lenght;
+    plan->window = window;
+    plan->wind = wind;
+    plan->work = &buffer[signal_lenght];
+    plan->scale = 4.0f / (signal_lenght * FFTWindowGain(window));
+    plan->magnitude = FFT_MAG_LINEAR;
+    return true;
+}
+
+void FFTPlanDeinit(fft_plan_t * plan){
+    if(plan->allocated){
+        free(plan->wind);
+    }
+    plan->wind = NULL;
+    plan->work = NULL;
+    plan->allocated = false;
+    plan->signal_lenght = 0;
+}
+
+void FFTPlanSetMagnitude(fft_plan_t * plan, fft_magnitude_t magnitude){
+    plan->magnitude = magnitude;
+}
+
+void FFTPlanMagnitude(fft_plan_t * plan, const float * signal, float * fft){
+    uint16_t signal_lenght = plan->signal_lenght;
+    // Multiply input array with window, packed as N/2 complex points
+    float * fft_complex = plan->work;
+    dsps_mul_f32(signal, plan->wind, fft_complex, signal_lenght, 1, 1, 1);
+    // Calculate real FFT
+    FFTReal(fft_complex, signal_lenght);
+    fft_complex[1] = 0;
+    // DC is scaled by 1/4 of the other bins
+    fft_complex[0] = fft_complex[0] / 4;
+    // Calculate FFT magnitude (scale is applied once per bin, no divisions)
+    float scale = plan->scale;
+    float scale_sq = scale * scale;
+    float db_offset = 20.0f * FastLog10f(scale);
+    uint16_t bins = signal_lenght / 2;
+    switch(plan->magnitude){
+        case FFT_MAG_SQUARED:
+            for(uint16_t j = 0; j < bins; j++){
+                float re = fft_complex[j*2+0], im = fft_complex[j*2+1];
+                fft[j] = scale_sq * (re * re + im * im);
+            }
+            break;
+        case FFT_MAG_APPROX:
+            for(uint16_t j = 0; j < bins; j++){
+                float re = fabsf(fft_complex[j*2+0]), im = fabsf(fft_complex[j*2+1]);
+                float max = (re > im) ? re : im;
+                float min = (re > im) ? im : re;
+                fft[j] = scale * (0.96043387f * max + 0.39782473f * min);
+            }
+            break;
+        case FFT_MAG_DB:
+            for(uint16_t j = 0; j < bins; j++){
+                float re = fft_complex[j*2+0], im = fft_complex[j*2+1];
+                float pow = re * re + im * im + 1e-20f;
+                // 10*log10(x) = 10*log10(2)*log2(x)
+                fft[j] = 3.01029996f * FastLog2f(pow) + db_offset;
+            }
+            break;
+        case FFT_MAG_LINEAR:
+        default:
+            for(uint16_t j = 0; j < bins; j++){
+                float re = fft_complex[j*2+0], im = fft_complex[j*2+1];
+                fft[j] = scale * FastSqrtf(re * re + im * im);
+            }
+            break;
+    }
+}
+
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
-    // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
-    // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
-    }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    // Hann window is only generated again when the lenght changes
+    if(default_plan.signal_lenght != signal_lenght){
+        FFTPlanInit(&default_plan, signal_lenght, FFT_WINDOW_HANN, default_buffer);
+    }
+    FFTPlanMagnitude(&default_plan, signal, fft);
+}
+
+void FFTRealForward(float * data, uint16_t signal_lenght){
+    FFTReal(data, signal_lenght);
+}
+
+void FFTRealInverse(float * data, uint16_t signal_lenght){
+    FFTRealInv(data, signal_lenght);
+}
+
+void FFTLogBandsInit(uint16_t * edges, uint16_t bins, uint8_t n_bands){
+    edges[0] = 1;
+    for(uint8_t i = 1; i <= n_bands; i++){
+        uint16_t edge = (uint16_t)lrintf(powf((float)bins, (float)i / n_bands));
+        // at least one bin per band, without exceeding the available bins
+        uint16_t min_edge = edges[i - 1] + 1;
+        uint16_t max_edge = bins - (n_bands - i);
+        if(edge < min_edge){
+            edge = min_edge;
+        }
+        if(edge > max_edge){
+            edge = max_edge;
+        }
+        edges[i] = edge;
+    }
+}
+
+void FFTBands(const float * fft, const uint16_t * edges, uint8_t n_bands, float * bands){
+    for(uint8_t i = 0; i < n_bands; i++){
+        float acc = 0;
+        for(uint16_t j = edges[i]; j < edges[i + 1]; j++){
+            acc += fft[j];
+        }
+        bands[i] = acc / (edges[i + 1] - edges[i]);
+    }
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
@@ -0,0 +1,249 @@
+/**
+ * @file fir_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "fir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Blackman windowed sinc tap of a low pass filter (not normalized)
+ * 
+ * @param fc        Cut frequency normalized to the sample frequency
+ */
+static float FIRLowPassTap(uint16_t i, uint16_t n_taps, float fc){
+    float t = i - (n_taps - 1) / 2.0f;
+    float h = (t == 0) ? 2 * fc : sinf(2 * (float)M_PI * fc * t) / ((float)M_PI * t);
+    float w = 0.42f - 0.5f * cosf(2 * (float)M_PI * i / (n_taps - 1)) + 0.08f * cosf(4 * (float)M_PI * i / (n_taps - 1));
+    return h * w;
+}
+
+/**
+ * @brief DC gain of a windowed sinc low pass filter
+ */
+static float FIRLowPassGain(uint16_t n_taps, float fc){
+    float gain = 0;
+    for(uint16_t i = 0; i < n_taps; i++){
+        gain += FIRLowPassTap(i, n_taps, fc);
+    }
+    return gain;
+}
+
+/**
+ * @brief Store a new sample and compute one output
+ */
+static inline int16_t FIRFilterQ15Step(fir_filter_q15_t * filter, int16_t x){
+    uint16_t n = filter->n_taps;
+    uint16_t pos = (filter->pos == 0) ? (n - 1) : (filter->pos - 1);
+    // the sample is stored twice, so delay[pos .. pos + n - 1] are the last n samples
+    filter->delay[pos] = x;
+    filter->delay[pos + n] = x;
+    filter->pos = pos;
+    const int16_t *d = &filter->delay[pos];
+    const int16_t *c = filter->coeffs;
+    int32_t acc = 1 << (FIR_Q15_SHIFT - 1);
+    for(uint16_t k = 0; k < n; k++){
+        acc += (int32_t)c[k] * d[k];
+    }
+    acc >>= FIR_Q15_SHIFT;
+    if(acc > INT16_MAX){
+        acc = INT16_MAX;
+    }
+    else if(acc < INT16_MIN){
+        acc = INT16_MIN;
+    }
+    return (int16_t)acc;
+}
+
+/**
+ * @brief Store a new sample in a decimator and compute an output every factor samples
+ * 
+ * @return true if an output was computed
+ */
+static inline bool FIRDecimatorStep(fir_decimator_t * decimator, float x, float * output){
+    uint16_t n = decimator->n_taps;
+    uint16_t pos = (decimator->pos == 0) ? (n - 1) : (decimator->pos - 1);
+    // the sample is stored twice, so delay[pos .. pos + n - 1] are the last n samples (newest first)
+    decimator->delay[pos] = x;
+    decimator->delay[pos + n] = x;
+    decimator->pos = pos;
+    if(++decimator->phase < decimator->factor){
+        return false;
+    }
+    decimator->phase = 0;
+    dsps_dotprod_f32(decimator->coeffs, &decimator->delay[pos], output, n);
+    return true;
+}
+/*==================[external functions definition]==========================*/
+bool FIRFilterLowPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float cut_frec){
+    if(n_taps < 3 || cut_frec <= 0 || 2 * cut_frec >= sample_frec){
+        return false;
+    }
+    float fc = cut_frec / sample_frec;
+    float gain = FIRLowPassGain(n_taps, fc);
+    for(uint16_t i = 0; i < n_taps; i++){
+        coeffs[i] = FIRLowPassTap(i, n_taps, fc) / gain;
+    }
+    return true;
+}
+
+bool FIRFilterHiPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float cut_frec){
+    if(n_taps % 2 == 0 || !FIRFilterLowPassDesign(coeffs, n_taps, sample_frec, cut_frec)){
+        return false;
+    }
+    for(uint16_t i = 0; i < n_taps; i++){
+        coeffs[i] = -coeffs[i];
+    }
+    coeffs[n_taps / 2] += 1;
+    return true;
+}
+
+bool FIRFilterBandPassDesign(float * coeffs, uint16_t n_taps, float sample_frec, float low_frec, float high_frec){
+    if(n_taps < 3 || low_frec <= 0 || high_frec <= low_frec || 2 * high_frec >= sample_frec){
+        return false;
+    }
+    float fl = low_frec / sample_frec, fh = high_frec / sample_frec;
+    float gain_l = FIRLowPassGain(n_taps, fl), gain_h = FIRLowPassGain(n_taps, fh);
+    for(uint16_t i = 0; i < n_taps; i++){
+        coeffs[i] = FIRLowPassTap(i, n_taps, fh) / gain_h - FIRLowPassTap(i, n_taps, fl) / gain_l;
+    }
+    return true;
+}
+
+bool FIRFilterInit(fir_filter_t * filter, float * coeffs, float * delay, uint16_t n_taps){
+    fir_f32_t fir;
+    if(coeffs == NULL || delay == NULL || n_taps == 0){
+        return false;
+    }
+    // also checks the alignment needed by the esp-dsp kernel of the target
+    if(dsps_fir_init_f32(&fir, coeffs, delay, n_taps) != ESP_OK){
+        return false;
+    }
+    filter->coeffs = coeffs;
+    filter->delay = delay;
+    filter->n_taps = n_taps;
+    FIRFilterReset(filter);
+    return true;
+}
+
+void FIRFilterReset(fir_filter_t * filter){
+    memset(filter->delay, 0, FIR_DELAY_LENGHT(filter->n_taps) * sizeof(float));
+    filter->pos = 0;
+}
+
+void FIRFilterProcess(fir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    fir_f32_t fir = {
+        .coeffs = filter->coeffs,
+        .delay = filter->delay,
+        .N = filter->n_taps,
+        .pos = filter->pos,
+        .decim = 1,
+        .use_delay = 0,
+    };
+    if(signal_lenght <= 0){
+        return;
+    }
+    dsps_fir_f32(&fir, input_signal, output_signal, signal_lenght);
+    filter->pos = (uint16_t)fir.pos;
+}
+
+bool FIRDecimatorInit(fir_decimator_t * decimator, const float * coeffs, float * delay, uint16_t n_taps, uint8_t factor){
+    if(coeffs == NULL || delay == NULL || n_taps == 0 || factor == 0){
+        return false;
+    }
+    decimator->coeffs = coeffs;
+    decimator->delay = delay;
+    decimator->n_taps = n_taps;
+    decimator->factor = factor;
+    FIRDecimatorReset(decimator);
+    return true;
+}
+
+void FIRDecimatorReset(fir_decimator_t * decimator){
+    memset(decimator->delay, 0, FIR_DECIMATOR_DELAY_LENGHT(decimator->n_taps) * sizeof(float));
+    decimator->pos = 0;
+    decimator->phase = 0;
+}
+
+uint16_t FIRDecimatorProcess(fir_decimator_t * decimator, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    uint16_t n_out = 0;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        if(FIRDecimatorStep(decimator, input_signal[i], &output_signal[n_out])){
+            n_out++;
+        }
+    }
+    return n_out;
+}
+
+uint16_t FIRDecimatorProcessU16(fir_decimator_t * decimator, const uint16_t * input_signal, float * output_signal, 
+    uint16_t signal_lenght, uint16_t offset){
+    uint16_t n_out = 0;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        if(FIRDecimatorStep(decimator, (float)((int32_t)input_signal[i] - offset), &output_signal[n_out])){
+            n_out++;
+        }
+    }
+    return n_out;
+}
+
+void FIRFilterCoeffsToQ15(const float * coeffs, int16_t * coeffs_q15, uint16_t n_taps){
+    for(uint16_t i = 0; i < n_taps; i++){
+        long q = lrintf(coeffs[i] * (1 << FIR_Q15_SHIFT));
+        if(q > INT16_MAX){
+            q = INT16_MAX;
+        }
+        else if(q < INT16_MIN){
+            q = INT16_MIN;
+        }
+        coeffs_q15[i] = (int16_t)q;
+    }
+}
+
+bool FIRFilterQ15Init(fir_filter_q15_t * filter, const int16_t * coeffs_q15, int16_t * delay, uint16_t n_taps){
+    if(coeffs_q15 == NULL || delay == NULL || n_taps == 0){
+        return false;
+    }
+    filter->coeffs = coeffs_q15;
+    filter->delay = delay;
+    filter->n_taps = n_taps;
+    FIRFilterQ15Reset(filter);
+    return true;
+}
+
+void FIRFilterQ15Reset(fir_filter_q15_t * filter){
+    memset(filter->delay, 0, 2 * filter->n_taps * sizeof(int16_t));
+    filter->pos = 0;
+}
+
+void FIRFilterQ15Process(fir_filter_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = FIRFilterQ15Step(filter, input_signal[i]);
+    }
+}
+
+void FIRFilterQ15ProcessU16(fir_filter_q15_t * filter, const uint16_t * input_signal, int16_t * output_signal, int16_t signal_lenght, uint16_t offset){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = FIRFilterQ15Step(filter, (int16_t)((int32_t)input_signal[i] - offset));
+    }
+}
+
+/*==================[end of file]============================================*/
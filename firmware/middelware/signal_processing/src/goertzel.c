@@ -0,0 +1,99 @@
+/**
+ * @file goertzel.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "goertzel.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Compute the normalized power of every bin and clear the state
+ */
+static void GoertzelFinish(goertzel_t * goertzel, uint16_t lenght, float * power){
+    float norm = 4.0f / ((float)lenght * lenght);
+    for(uint8_t k = 0; k < goertzel->n_bins; k++){
+        float s1 = goertzel->s1[k];
+        float s2 = goertzel->s2[k];
+        power[k] = norm * (s1 * s1 + s2 * s2 - goertzel->coeff[k] * s1 * s2);
+        goertzel->s1[k] = 0;
+        goertzel->s2[k] = 0;
+    }
+}
+/*==================[external functions definition]==========================*/
+bool GoertzelInit(goertzel_t * goertzel, float sample_frec, const float * freqs, uint8_t n_bins, uint16_t block_lenght){
+    if(n_bins == 0 || n_bins > GOERTZEL_MAX_BINS || block_lenght == 0){
+        return false;
+    }
+    memset(goertzel, 0, sizeof(goertzel_t));
+    for(uint8_t k = 0; k < n_bins; k++){
+        goertzel->coeff[k] = 2.0f * cosf(2.0f * M_PI * freqs[k] / sample_frec);
+    }
+    goertzel->n_bins = n_bins;
+    goertzel->block_lenght = block_lenght;
+    return true;
+}
+
+void GoertzelReset(goertzel_t * goertzel){
+    memset(goertzel->s1, 0, sizeof(goertzel->s1));
+    memset(goertzel->s2, 0, sizeof(goertzel->s2));
+    goertzel->count = 0;
+}
+
+void GoertzelBlock(goertzel_t * goertzel, const float * signal, uint16_t signal_lenght, float * power){
+    GoertzelReset(goertzel);
+    // bins in the outer loop, so each state stays in registers
+    for(uint8_t k = 0; k < goertzel->n_bins; k++){
+        float coeff = goertzel->coeff[k];
+        float s1 = 0, s2 = 0;
+        for(uint16_t i = 0; i < signal_lenght; i++){
+            float s0 = signal[i] + coeff * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        goertzel->s1[k] = s1;
+        goertzel->s2[k] = s2;
+    }
+    GoertzelFinish(goertzel, signal_lenght, goertzel->power);
+    if(power != NULL){
+        memcpy(power, goertzel->power, goertzel->n_bins * sizeof(float));
+    }
+}
+
+bool GoertzelStep(goertzel_t * goertzel, float x){
+    for(uint8_t k = 0; k < goertzel->n_bins; k++){
+        float s0 = x + goertzel->coeff[k] * goertzel->s1[k] - goertzel->s2[k];
+        goertzel->s2[k] = goertzel->s1[k];
+        goertzel->s1[k] = s0;
+    }
+    goertzel->count++;
+    if(goertzel->count < goertzel->block_lenght){
+        return false;
+    }
+    GoertzelFinish(goertzel, goertzel->count, goertzel->power);
+    goertzel->count = 0;
+    return true;
+}
+
+const float * GoertzelGetPower(goertzel_t * goertzel){
+    return goertzel->power;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,201 @@
+/**
+ * @file hit_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <math.h>
+#include "hit_detector.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Velocity of a peak (linear from threshold to max_level)
+ */
+static uint8_t HitVelocity(const hit_detector_t * detector, float peak){
+    float v = 1.0f + (peak - detector->threshold) * detector->velocity_gain;
+    if(v >= HIT_MAX_VELOCITY){
+        return HIT_MAX_VELOCITY;
+    }
+    if(v <= 1.0f){
+        return 1;
+    }
+    return (uint8_t)lrintf(v);
+}
+
+/**
+ * @brief True if a hit is weaker than ratio times a hit of another pad within the window
+ */
+static bool HitIsCrosstalk(const hit_crosstalk_t * crosstalk, hit_event_t * const * hits, const uint8_t * n_hits, 
+    uint8_t pad, const hit_event_t * hit){
+    uint32_t t = crosstalk->time + hit->pos;
+    float limit = hit->peak / crosstalk->ratio[pad];
+    for(uint8_t q = 0; q < crosstalk->pads; q++){
+        if(q == pad){
+            continue;
+        }
+        // last hit of the previous blocks
+        if(crosstalk->last_peak[q] > limit && t - crosstalk->last_time[q] <= crosstalk->window){
+            return true;
+        }
+        // hits of the same block
+        for(uint8_t j = 0; j < n_hits[q]; j++){
+            uint32_t d = (hits[q][j].pos > hit->pos) ? hits[q][j].pos - hit->pos : hit->pos - hits[q][j].pos;
+            if(hits[q][j].peak > limit && d <= crosstalk->window){
+                return true;
+            }
+        }
+    }
+    return false;
+}
+/*==================[external functions definition]==========================*/
+bool HitDetectorInit(hit_detector_t * detector, const hit_detector_config_t * config){
+    if(config->sample_frec <= 0 || config->threshold <= 0 || config->max_level <= config->threshold){
+        return false;
+    }
+    float samples_ms = config->sample_frec / 1000.0f;
+    detector->threshold = config->threshold;
+    detector->max_level = config->max_level;
+    detector->velocity_gain = (HIT_MAX_VELOCITY - 1) / (config->max_level - config->threshold);
+    detector->scan_lenght = (uint16_t)lrintf(config->scan_time * samples_ms);
+    detector->mask_lenght = (uint16_t)lrintf(config->mask_time * samples_ms);
+    detector->decay = (config->decay_time > 0) ? expf(-1.0f / (config->decay_time * samples_ms)) : 0;
+    if(detector->scan_lenght == 0){
+        detector->scan_lenght = 1;
+    }
+    HitDetectorReset(detector);
+    return true;
+}
+
+bool HitDetectorSetThreshold(hit_detector_t * detector, float threshold){
+    if(threshold <= 0 || threshold >= detector->max_level){
+        return false;
+    }
+    // the re-arm threshold keeps decaying, now towards the new threshold
+    if(detector->rearm < threshold){
+        detector->rearm = threshold;
+    }
+    detector->threshold = threshold;
+    detector->velocity_gain = (HIT_MAX_VELOCITY - 1) / (detector->max_level - threshold);
+    return true;
+}
+
+void HitDetectorReset(hit_detector_t * detector){
+    detector->state = HIT_IDLE;
+    detector->count = 0;
+    detector->peak = 0;
+    detector->rearm = detector->threshold;
+}
+
+uint8_t HitDetectorProcess(hit_detector_t * detector, const float * signal, uint16_t signal_lenght, 
+    hit_event_t * hits, uint8_t max_hits){
+    uint8_t n_hits = 0;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        float x = fabsf(signal[i]);
+        switch(detector->state){
+        case HIT_IDLE:
+            // re-arm threshold decays towards the trigger threshold
+            detector->rearm = detector->threshold + (detector->rearm - detector->threshold) * detector->decay;
+            if(x > detector->rearm){
+                detector->state = HIT_SCAN;
+                detector->count = 0;
+                detector->peak = x;
+            }
+            break;
+        case HIT_SCAN:
+            if(x > detector->peak){
+                detector->peak = x;
+            }
+            if(++detector->count >= detector->scan_lenght){
+                if(n_hits < max_hits && hits != NULL){
+                    hits[n_hits].pos = i;
+                    hits[n_hits].onset = (int32_t)i - detector->scan_lenght;
+                    hits[n_hits].velocity = HitVelocity(detector, detector->peak);
+                    hits[n_hits].peak = detector->peak;
+                }
+                if(n_hits < UINT8_MAX){
+                    n_hits++;
+                }
+                detector->state = HIT_MASK;
+                detector->count = 0;
+            }
+            break;
+        case HIT_MASK:
+            if(++detector->count >= detector->mask_lenght){
+                detector->state = HIT_IDLE;
+                detector->rearm = detector->peak;
+            }
+            break;
+        }
+    }
+    return n_hits;
+}
+
+bool HitCrosstalkInit(hit_crosstalk_t * crosstalk, float sample_frec, uint8_t pads, float window_time, float ratio){
+    if(pads > HIT_MAX_PADS || ratio <= 0 || ratio > 1){
+        return false;
+    }
+    crosstalk->pads = pads;
+    crosstalk->window = (uint16_t)lrintf(window_time * sample_frec / 1000.0f);
+    crosstalk->time = 0;
+    for(uint8_t p = 0; p < HIT_MAX_PADS; p++){
+        crosstalk->ratio[p] = ratio;
+        crosstalk->last_time[p] = 0;
+        crosstalk->last_peak[p] = 0;
+    }
+    return true;
+}
+
+bool HitCrosstalkSetRatio(hit_crosstalk_t * crosstalk, uint8_t pad, float ratio){
+    if(pad >= crosstalk->pads || ratio <= 0 || ratio > 1){
+        return false;
+    }
+    crosstalk->ratio[pad] = ratio;
+    return true;
+}
+
+uint8_t HitCrosstalkProcess(hit_crosstalk_t * crosstalk, hit_event_t * const * hits, uint8_t * n_hits, 
+    uint16_t block_lenght){
+    uint32_t drop[HIT_MAX_PADS] = {0};      // one bit per hit (only the first 32 hits of a pad are judged)
+    uint8_t dropped = 0;
+    // judge every hit against the original hits of the block, then remove
+    for(uint8_t p = 0; p < crosstalk->pads; p++){
+        for(uint8_t j = 0; j < n_hits[p] && j < 32; j++){
+            if(HitIsCrosstalk(crosstalk, hits, n_hits, p, &hits[p][j])){
+                drop[p] |= (1UL << j);
+            }
+        }
+    }
+    for(uint8_t p = 0; p < crosstalk->pads; p++){
+        uint8_t kept = 0;
+        for(uint8_t j = 0; j < n_hits[p]; j++){
+            if(j < 32 && (drop[p] & (1UL << j))){
+                dropped++;
+                continue;
+            }
+            hits[p][kept++] = hits[p][j];
+            crosstalk->last_time[p] = crosstalk->time + hits[p][j].pos;
+            crosstalk->last_peak[p] = hits[p][j].peak;
+        }
+        n_hits[p] = kept;
+    }
+    crosstalk->time += block_lenght;
+    return dropped;
+}
+
+/*==================[end of file]============================================*/
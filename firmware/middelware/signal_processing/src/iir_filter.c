@@ -10,43 +10,14 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
 #include "iir_filter.h"
 #include "esp_dsp.h"
 /*==================[macros and definitions]=================================*/
-#define N_SOS       5
-#define N_DELAY     2
-// 2nd order Butterworth 
-#define ORDER2_Q    (1 / 1.414)
-// 4th order Butterworth 
-#define ORDER4_Q1   (1 / 0.765)
-#define ORDER4_Q2   (1 / 1.848)
-// 6th order Butterworth 
-#define ORDER6_Q1   (1 / 0.518)
-#define ORDER6_Q2   (1 / 1.414)
-#define ORDER6_Q3   (1 / 1.932)
-// 8th order Butterworth 
-#define ORDER8_Q1   (1 / 0.390)
-#define ORDER8_Q2   (1 / 1.111)
-#define ORDER8_Q3   (1 / 1.663)
-#define ORDER8_Q4   (1 / 1.962)
 /*==================[internal data declaration]==============================*/
-static uint8_t lp_order, hp_order;
-float hp2_delay[N_DELAY] = {0, 0};  // delay
-float hp4_delay[N_DELAY] = {0, 0};  // delay
-float hp6_delay[N_DELAY] = {0, 0};  // delay
-float hp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_delay[N_DELAY] = {0, 0};  // delay
-float lp4_delay[N_DELAY] = {0, 0};  // delay
-float lp6_delay[N_DELAY] = {0, 0};  // delay
-float lp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_sos_coeff[N_SOS]; 
-float lp4_sos_coeff[N_SOS]; 
-float lp6_sos_coeff[N_SOS]; 
-float lp8_sos_coeff[N_SOS]; 
-float hp2_sos_coeff[N_SOS]; 
-float hp4_sos_coeff[N_SOS]; 
-float hp6_sos_coeff[N_SOS]; 
-float hp8_sos_coeff[N_SOS]; 
+static iir_filter_t lp_filter;      /*!< Filter used by LowPassInit / LowPassFilter */
+static iir_filter_t hp_filter;      /*!< Filter used by HiPassInit / HiPassFilter */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -54,103 +25,139 @@ float hp8_sos_coeff[N_SOS];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Single pass cascaded SOS kernel: every section is applied to each sample
+ * before reading the next one, so the signal goes through memory only once.
+ */
+static void IIRCascade(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = IIRFilterStep(filter, input_signal[i]);
+    }
+}
+/**
+ * @brief Q factor of the k-th section (from 0) of an order N Butterworth filter
+ */
+static float ButterworthQ(uint8_t k, uint8_t order){
+    return 1.0f / (2.0f * sinf((2 * k + 1) * M_PI / (2.0f * order)));
+}
 
+/**
+ * @brief Number of sections of a Butterworth design (order is rounded up to even)
+ */
+static uint8_t ButterworthSections(uint8_t order){
+    uint8_t n_sections = (order + 1) / 2;
+    if(n_sections > IIR_MAX_SECTIONS){
+        n_sections = IIR_MAX_SECTIONS;
+    }
+    return n_sections;
+}
 /*==================[external functions definition]==========================*/
 
-void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+void IIRFilterInit(iir_filter_t * filter){
+    memset(filter, 0, sizeof(iir_filter_t));
+}
+
+bool IIRFilterAddSection(iir_filter_t * filter, const float * coeffs){
+    if(filter->n_sections >= IIR_MAX_SECTIONS){
+        return false;
+    }
+    memcpy(filter->coeffs[filter->n_sections], coeffs, IIR_SOS_COEFFS * sizeof(float));
+    filter->delay[filter->n_sections][0] = 0;
+    filter->delay[filter->n_sections][1] = 0;
+    filter->n_sections++;
+    return true;
+}
+
+void IIRFilterLowPassInit(iir_filter_t * filter, float sample_frec, float cut_frec, uint8_t order){
     float f = cut_frec / sample_frec;
-    lp_order = order;
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
-        break;
+    uint8_t n_sections = ButterworthSections(order);
+    IIRFilterInit(filter);
+    for(uint8_t k = 0; k < n_sections; k++){
+        dsps_biquad_gen_lpf_f32(filter->coeffs[k], f, ButterworthQ(k, 2 * n_sections));
     }
+    filter->n_sections = n_sections;
 }
 
-void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+void IIRFilterHiPassInit(iir_filter_t * filter, float sample_frec, float cut_frec, uint8_t order){
     float f = cut_frec / sample_frec;
-    hp_order = order;
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
-        break;
+    uint8_t n_sections = ButterworthSections(order);
+    IIRFilterInit(filter);
+    for(uint8_t k = 0; k < n_sections; k++){
+        dsps_biquad_gen_hpf_f32(filter->coeffs[k], f, ButterworthQ(k, 2 * n_sections));
     }
+    filter->n_sections = n_sections;
 }
 
-void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
-        break;
+void IIRFilterReset(iir_filter_t * filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IIRFilterBandPassInit(iir_filter_t * filter, float sample_frec, float low_frec, float high_frec, uint8_t order){
+    iir_filter_t lp;
+    IIRFilterHiPassInit(filter, sample_frec, low_frec, order);
+    IIRFilterLowPassInit(&lp, sample_frec, high_frec, order);
+    for(uint8_t k = 0; k < lp.n_sections; k++){
+        IIRFilterAddSection(filter, lp.coeffs[k]);
+    }
+}
+
+void IIRFilterProcess(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    IIRCascade(filter, input_signal, output_signal, signal_lenght);
+}
+
+void IIRFilterProcessChannels(iir_filter_t * filters, uint8_t channels, float * const * input_signals,
+                              float * const * output_signals, int16_t signal_lenght){
+    for(uint8_t ch = 0; ch < channels; ch++){
+        IIRFilterProcess(&filters[ch], input_signals[ch], output_signals[ch], signal_lenght);
+    }
+}
+
+void IIRFilterQ31Init(iir_filter_q31_t * filter_q31, const iir_filter_t * filter){
+    memset(filter_q31, 0, sizeof(iir_filter_q31_t));
+    for(uint8_t k = 0; k < filter->n_sections; k++){
+        for(uint8_t i = 0; i < IIR_SOS_COEFFS; i++){
+            filter_q31->coeffs[k][i] = (int32_t)lrint(filter->coeffs[k][i] * (double)(1UL << IIR_Q_SHIFT));
+        }
+    }
+    filter_q31->n_sections = filter->n_sections;
+}
+
+void IIRFilterQ31Reset(iir_filter_q31_t * filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IIRFilterQ31Process(iir_filter_q31_t * filter, const int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = IIRFilterQ31Step(filter, input_signal[i]);
+    }
+}
+
+void IIRFilterQ31ProcessU16(iir_filter_q31_t * filter, const uint16_t * input_signal, int32_t * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = IIRFilterQ31Step(filter, input_signal[i]);
     }
 }
 
+void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IIRFilterLowPassInit(&lp_filter, sample_frec, cut_frec, order);
+}
+
+void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IIRFilterHiPassInit(&hp_filter, sample_frec, cut_frec, order);
+}
+
+void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IIRFilterProcess(&lp_filter, input_signal, output_signal, signal_lenght);
+}
+
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
-        break;
+    IIRFilterProcess(&hp_filter, input_signal, output_signal, signal_lenght);
+}
+
+void BandPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = IIRFilterStep(&lp_filter, IIRFilterStep(&hp_filter, input_signal[i]));
     }
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
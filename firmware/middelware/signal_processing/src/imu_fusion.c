@@ -0,0 +1,225 @@
+/**
+ * @file imu_fusion.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "imu_fusion.h"
+#include <math.h>
+#include <stddef.h>
+/*==================[macros and definitions]=================================*/
+#define DEG_TO_RAD          0.017453292f
+#define MAHONY_KP_DEFAULT   1.0f        /*!< Mahony proportional gain (2 * 0.5) */
+#define MAHONY_KI_DEFAULT   0.0f        /*!< Mahony integral gain */
+#define MADGWICK_BETA_DEFAULT   0.1f    /*!< Madgwick gradient descent gain */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/* esp-dsp ekf_imu13states interface (imu_fusion_ekf.cpp) */
+void * ImuFusionEkfCreate(void);
+void ImuFusionEkfDelete(void * ekf);
+void ImuFusionEkfUpdate(void * ekf, const float * accel, const float * gyro, float dt, float * q);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Normalize a quaternion
+ */
+static inline void QuatNormalize(float * q){
+    float norm = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if(norm > 0.0f){
+        norm = 1.0f / norm;
+        q[0] *= norm;
+        q[1] *= norm;
+        q[2] *= norm;
+        q[3] *= norm;
+    }
+}
+
+/**
+ * @brief Mahony update: gyro rate corrected by the cross product between the
+ * measured and the estimated gravity directions, then integrated
+ */
+static void MahonyUpdate(imu_fusion_t * fusion, float ax, float ay, float az, float gx, float gy, float gz){
+    float * q = fusion->q;
+    float norm = ax * ax + ay * ay + az * az;
+    if(norm > 0.0f){
+        norm = 1.0f / sqrtf(norm);
+        ax *= norm;
+        ay *= norm;
+        az *= norm;
+        // estimated direction of gravity in the sensor frame
+        float vx = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+        float vy = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+        float vz = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+        float ex = ay * vz - az * vy;
+        float ey = az * vx - ax * vz;
+        float ez = ax * vy - ay * vx;
+        if(fusion->ki > 0.0f){
+            fusion->integral[0] += fusion->ki * ex * fusion->dt;
+            fusion->integral[1] += fusion->ki * ey * fusion->dt;
+            fusion->integral[2] += fusion->ki * ez * fusion->dt;
+            gx += fusion->integral[0];
+            gy += fusion->integral[1];
+            gz += fusion->integral[2];
+        }
+        gx += fusion->gain * ex;
+        gy += fusion->gain * ey;
+        gz += fusion->gain * ez;
+    }
+    float half_dt = 0.5f * fusion->dt;
+    float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    q[0] += (-q1 * gx - q2 * gy - q3 * gz) * half_dt;
+    q[1] += (q0 * gx + q2 * gz - q3 * gy) * half_dt;
+    q[2] += (q0 * gy - q1 * gz + q3 * gx) * half_dt;
+    q[3] += (q0 * gz + q1 * gy - q2 * gx) * half_dt;
+    QuatNormalize(q);
+}
+
+/**
+ * @brief Madgwick update: quaternion rate from the gyro minus a gradient
+ * descent step of the gravity direction error
+ */
+static void MadgwickUpdate(imu_fusion_t * fusion, float ax, float ay, float az, float gx, float gy, float gz){
+    float * q = fusion->q;
+    float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    float dq0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float dq1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    float dq2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    float dq3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+    float norm = ax * ax + ay * ay + az * az;
+    if(norm > 0.0f){
+        norm = 1.0f / sqrtf(norm);
+        ax *= norm;
+        ay *= norm;
+        az *= norm;
+        // gradient of the error between estimated and measured gravity
+        float f0 = 2.0f * (q1 * q3 - q0 * q2) - ax;
+        float f1 = 2.0f * (q0 * q1 + q2 * q3) - ay;
+        float f2 = 1.0f - 2.0f * (q1 * q1 + q2 * q2) - az;
+        float s0 = -2.0f * q2 * f0 + 2.0f * q1 * f1;
+        float s1 = 2.0f * q3 * f0 + 2.0f * q0 * f1 - 4.0f * q1 * f2;
+        float s2 = -2.0f * q0 * f0 + 2.0f * q3 * f1 - 4.0f * q2 * f2;
+        float s3 = 2.0f * q1 * f0 + 2.0f * q2 * f1;
+        norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+        if(norm > 0.0f){
+            norm = fusion->gain / sqrtf(norm);
+            dq0 -= norm * s0;
+            dq1 -= norm * s1;
+            dq2 -= norm * s2;
+            dq3 -= norm * s3;
+        }
+    }
+    q[0] += dq0 * fusion->dt;
+    q[1] += dq1 * fusion->dt;
+    q[2] += dq2 * fusion->dt;
+    q[3] += dq3 * fusion->dt;
+    QuatNormalize(q);
+}
+/*==================[external functions definition]==========================*/
+bool ImuFusionInit(imu_fusion_t * fusion, const imu_fusion_config_t * config){
+    if(config->sample_frec <= 0.0f || config->publish_frec <= 0.0f ||
+       config->accel_lsb <= 0.0f || config->gyro_lsb <= 0.0f){
+        return false;
+    }
+    fusion->mode = config->mode;
+    fusion->dt = 1.0f / config->sample_frec;
+    fusion->accel_scale = 1.0f / config->accel_lsb;
+    fusion->gyro_scale = DEG_TO_RAD / config->gyro_lsb;
+    fusion->ki = 0.0f;
+    switch(config->mode){
+        case IMU_FUSION_MAHONY:
+            fusion->gain = (config->gain > 0.0f) ? config->gain : MAHONY_KP_DEFAULT;
+            fusion->ki = MAHONY_KI_DEFAULT;
+        break;
+        case IMU_FUSION_MADGWICK:
+            fusion->gain = (config->gain > 0.0f) ? config->gain : MADGWICK_BETA_DEFAULT;
+        break;
+        case IMU_FUSION_EKF:
+            fusion->gain = 0.0f;
+        break;
+        default:
+            return false;
+    }
+    fusion->integral[0] = fusion->integral[1] = fusion->integral[2] = 0.0f;
+    fusion->q[0] = 1.0f;
+    fusion->q[1] = fusion->q[2] = fusion->q[3] = 0.0f;
+    fusion->ekf = NULL;
+    if(config->mode == IMU_FUSION_EKF){
+        fusion->ekf = ImuFusionEkfCreate();
+        if(fusion->ekf == NULL){
+            return false;
+        }
+    }
+    float decimation = roundf(config->sample_frec / config->publish_frec);
+    fusion->decimation = (decimation < 1.0f) ? 1 : (uint16_t)decimation;
+    fusion->count = 0;
+    return true;
+}
+
+void ImuFusionDeinit(imu_fusion_t * fusion){
+    if(fusion->ekf != NULL){
+        ImuFusionEkfDelete(fusion->ekf);
+        fusion->ekf = NULL;
+    }
+}
+
+uint8_t ImuFusionProcess(imu_fusion_t * fusion, const imu_frame_t * frames, uint16_t frames_lenght,
+    imu_orientation_t * out, uint8_t max_out){
+    uint8_t published = 0;
+    for(uint16_t i = 0; i < frames_lenght; i++){
+        float accel[3], gyro[3];
+        for(uint8_t j = 0; j < 3; j++){
+            accel[j] = frames[i].accel[j] * fusion->accel_scale;
+            gyro[j] = frames[i].gyro[j] * fusion->gyro_scale;
+        }
+        switch(fusion->mode){
+            case IMU_FUSION_MAHONY:
+                MahonyUpdate(fusion, accel[0], accel[1], accel[2], gyro[0], gyro[1], gyro[2]);
+            break;
+            case IMU_FUSION_MADGWICK:
+                MadgwickUpdate(fusion, accel[0], accel[1], accel[2], gyro[0], gyro[1], gyro[2]);
+            break;
+            case IMU_FUSION_EKF:
+                ImuFusionEkfUpdate(fusion->ekf, accel, gyro, fusion->dt, fusion->q);
+            break;
+        }
+        if(++fusion->count >= fusion->decimation){
+            fusion->count = 0;
+            if(out != NULL && published < max_out){
+                out[published].pos = i;
+                for(uint8_t j = 0; j < 4; j++){
+                    out[published].q[j] = fusion->q[j];
+                }
+                ImuFusionEuler(fusion->q, out[published].euler);
+            }
+            if(published < UINT8_MAX){
+                published++;
+            }
+        }
+    }
+    return published;
+}
+
+void ImuFusionEuler(const float * q, float * euler){
+    float sinp = 2.0f * (q[0] * q[2] - q[3] * q[1]);
+    if(sinp > 1.0f){
+        sinp = 1.0f;
+    }
+    else if(sinp < -1.0f){
+        sinp = -1.0f;
+    }
+    euler[0] = atan2f(2.0f * (q[0] * q[1] + q[2] * q[3]), 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2]));
+    euler[1] = asinf(sinp);
+    euler[2] = atan2f(2.0f * (q[0] * q[3] + q[1] * q[2]), 1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3]));
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,97 @@
+/**
+ * @file imu_fusion_ekf.cpp
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief C interface of the esp-dsp ekf_imu13states filter for imu_fusion.c
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <new>
+#include <math.h>
+#include <string.h>
+#include "ekf_imu13states.h"
+#include "small_matrix.h"
+/*==================[macros and definitions]=================================*/
+#define EKF_ACCEL_VARIANCE  0.01f       /*!< Accelerometer measurement variance (normalized g) */
+#define EKF_MAGN_VARIANCE   1e6f        /*!< Magnetometer variance (no magnetometer: no correction) */
+#define EKF_STATES          13          /*!< States of ekf_imu13states */
+#define EKF_NOISES          18          /*!< Process noise inputs of ekf_imu13states */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief ekf_imu13states with the covariance prediction on fixed size kernels (small_matrix.h)
+ *
+ * The base class computes (I + F * dt) * P * (I + F * dt)' + dt^2 * G * Q * G'
+ * with dspm::Mat operators: 7 allocations and 5 generic products per sample.
+ * Q is diagonal (Init), so G * Q * G' is a sum of the columns of G scaled by
+ * its diagonal.
+ *
+ * The base destructor releases HP and Km (new[] in ekf::ekf) with delete: they
+ * are released here with delete[], and the base one deletes NULL.
+ */
+class ekf_imu13states_fixed : public ekf_imu13states {
+public:
+    ~ekf_imu13states_fixed() override {
+        delete[] HP;
+        delete[] Km;
+        HP = NULL;
+        Km = NULL;
+    }
+
+    void CovariancePrediction(float dt) override {
+        float f[EKF_STATES * EKF_STATES], work[EKF_STATES * EKF_STATES], q[EKF_NOISES];
+        for(int i = 0; i < EKF_STATES * EKF_STATES; i++){
+            f[i] = F.data[i] * dt;
+        }
+        for(int i = 0; i < EKF_STATES; i++){
+            f[i * EKF_STATES + i] += 1.0f;
+        }
+        for(int i = 0; i < EKF_NOISES; i++){
+            q[i] = Q.data[i * EKF_NOISES + i];
+        }
+        // P is not an input of the second product: the result goes to P
+        float p[EKF_STATES * EKF_STATES];
+        memcpy(p, P.data, sizeof(p));
+        SmallMatSymABAt13(f, p, work, P.data);
+        SmallMatSymAddGDGt13x18(G.data, q, dt * dt, P.data);
+    }
+};
+/*==================[external functions definition]==========================*/
+extern "C" {
+
+void * ImuFusionEkfCreate(void){
+    ekf_imu13states * ekf = new (std::nothrow) ekf_imu13states_fixed();
+    if(ekf != NULL){
+        ekf->Init();
+    }
+    return ekf;
+}
+
+void ImuFusionEkfDelete(void * ekf){
+    delete static_cast<ekf_imu13states *>(ekf);
+}
+
+void ImuFusionEkfUpdate(void * ekf_p, const float * accel, const float * gyro, float dt, float * q){
+    ekf_imu13states * ekf = static_cast<ekf_imu13states *>(ekf_p);
+    float u[3] = {gyro[0], gyro[1], gyro[2]};
+    float norm = sqrtf(accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2]);
+    ekf->Process(u, dt);
+    if(norm > 0.0f){
+        float a[3] = {accel[0] / norm, accel[1] / norm, accel[2] / norm};
+        // magnetic measurement equal to the initial model, with a variance that cancels its gain
+        float magn[3] = {1.0f, 0.0f, 0.0f};
+        float R[6] = {EKF_MAGN_VARIANCE, EKF_MAGN_VARIANCE, EKF_MAGN_VARIANCE,
+                      EKF_ACCEL_VARIANCE, EKF_ACCEL_VARIANCE, EKF_ACCEL_VARIANCE};
+        ekf->UpdateRefMeasurement(a, magn, R);
+    }
+    for(int i = 0; i < 4; i++){
+        q[i] = ekf->X.data[i];
+    }
+}
+
+}
+
+/*==================[end of file]============================================*/
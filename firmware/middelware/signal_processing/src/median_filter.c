@@ -0,0 +1,229 @@
+/**
+ * @file median_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "median_filter.h"
+/*==================[macros and definitions]=================================*/
+#define MIN_COUNT(h)    (((h)->count - 1) / 2)  /*!< Samples in the min-heap (positions 1 to MIN_COUNT) */
+#define MAX_COUNT(h)    ((h)->count / 2)        /*!< Samples in the max-heap (positions -1 to -MAX_COUNT) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Integer with the order of a float (sign and magnitude to two's complement)
+ */
+static inline int32_t MedianFloatKey(float x){
+    int32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits ^ ((bits >> 31) & INT32_MAX);
+}
+
+/**
+ * @brief Sample at heap position i is less than the one at position j
+ */
+static inline bool MedianLess(const median_heap_t * h, const void * samples, bool is_float, int16_t i, int16_t j){
+    if(is_float){
+        const float * s = samples;
+        return MedianFloatKey(s[h->heap[i]]) < MedianFloatKey(s[h->heap[j]]);
+    }
+    const int16_t * s = samples;
+    return s[h->heap[i]] < s[h->heap[j]];
+}
+
+/**
+ * @brief Swap the samples at heap positions i and j if the one at i is less
+ */
+static bool MedianSwapIfLess(median_heap_t * h, const void * samples, bool is_float, int16_t i, int16_t j){
+    if(!MedianLess(h, samples, is_float, i, j)){
+        return false;
+    }
+    int16_t t = h->heap[i];
+    h->heap[i] = h->heap[j];
+    h->heap[j] = t;
+    h->pos[h->heap[i]] = i;
+    h->pos[h->heap[j]] = j;
+    return true;
+}
+
+/**
+ * @brief Move down the sample at min-heap position i / 2 (i is its first child)
+ */
+static void MedianMinDown(median_heap_t * h, const void * samples, bool is_float, int16_t i){
+    for(; i <= MIN_COUNT(h); i *= 2){
+        if(i > 1 && i < MIN_COUNT(h) && MedianLess(h, samples, is_float, i + 1, i)){
+            i++;
+        }
+        if(!MedianSwapIfLess(h, samples, is_float, i, i / 2)){
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Move down the sample at max-heap position i / 2 (i is its first child)
+ */
+static void MedianMaxDown(median_heap_t * h, const void * samples, bool is_float, int16_t i){
+    for(; i >= -MAX_COUNT(h); i *= 2){
+        if(i < -1 && i > -MAX_COUNT(h) && MedianLess(h, samples, is_float, i, i - 1)){
+            i--;
+        }
+        if(!MedianSwapIfLess(h, samples, is_float, i / 2, i)){
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Move up the sample at min-heap position i
+ * @return true if it became the median
+ */
+static bool MedianMinUp(median_heap_t * h, const void * samples, bool is_float, int16_t i){
+    while(i > 0 && MedianSwapIfLess(h, samples, is_float, i, i / 2)){
+        i /= 2;
+    }
+    return i == 0;
+}
+
+/**
+ * @brief Move up the sample at max-heap position i
+ * @return true if it became the median
+ */
+static bool MedianMaxUp(median_heap_t * h, const void * samples, bool is_float, int16_t i){
+    while(i < 0 && MedianSwapIfLess(h, samples, is_float, i / 2, i)){
+        i /= 2;
+    }
+    return i == 0;
+}
+
+/**
+ * @brief Place the sample just stored in the oldest slot
+ *
+ * @param replaced  The window was full (the sample took the place of another one)
+ * @param grew      The new sample is greater than the one it replaced
+ */
+static void MedianUpdate(median_heap_t * h, const void * samples, bool is_float, bool replaced, bool grew){
+    int16_t p = h->pos[h->oldest];
+    if(++h->oldest == h->window){
+        h->oldest = 0;
+    }
+    if(p > 0){
+        // min-heap: a greater sample goes down, a smaller one up (and through the median to the max-heap)
+        if(replaced && grew){
+            MedianMinDown(h, samples, is_float, 2 * p);
+        }else if(MedianMinUp(h, samples, is_float, p)){
+            MedianMaxDown(h, samples, is_float, -1);
+        }
+    }else if(p < 0){
+        if(replaced && !grew){
+            MedianMaxDown(h, samples, is_float, 2 * p);
+        }else if(MedianMaxUp(h, samples, is_float, p)){
+            MedianMinDown(h, samples, is_float, 1);
+        }
+    }else{
+        // the median: it can go to either heap
+        if(MAX_COUNT(h)){
+            MedianMaxDown(h, samples, is_float, -1);
+        }
+        if(MIN_COUNT(h)){
+            MedianMinDown(h, samples, is_float, 1);
+        }
+    }
+}
+
+/**
+ * @brief Empty the heaps (sample i takes positions 0, -1, 1, -2, 2...)
+ */
+static void MedianHeapReset(median_heap_t * h){
+    for(int16_t i = 0; i < h->window; i++){
+        int16_t p = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+        h->pos[i] = p;
+        h->heap[p] = i;
+    }
+    h->oldest = 0;
+    h->count = 0;
+}
+
+/**
+ * @brief Set the arrays of the heaps
+ */
+static bool MedianHeapInit(median_heap_t * h, int16_t * index, uint16_t window){
+    if(window == 0 || window > MEDIAN_FILTER_MAX_WINDOW){
+        return false;
+    }
+    h->window = window;
+    h->heap = index + window / 2;
+    h->pos = index + window;
+    MedianHeapReset(h);
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool MedianFilterInit(median_filter_t * filter, float * samples, int16_t * index, uint16_t window){
+    filter->samples = samples;
+    return MedianHeapInit(&filter->heap, index, window);
+}
+
+void MedianFilterProcess(median_filter_t * filter, const float * input, float * output, uint16_t lenght){
+    median_heap_t * h = &filter->heap;
+    for(uint16_t i = 0; i < lenght; i++){
+        float x = input[i];
+        bool replaced = (h->count == h->window);
+        bool grew = replaced && (MedianFloatKey(filter->samples[h->oldest]) < MedianFloatKey(x));
+        filter->samples[h->oldest] = x;
+        h->count += !replaced;
+        MedianUpdate(h, filter->samples, true, replaced, grew);
+        float median = filter->samples[h->heap[0]];
+        if((h->count & 1) == 0){
+            median = 0.5f * (median + filter->samples[h->heap[-1]]);
+        }
+        output[i] = median;
+    }
+}
+
+void MedianFilterReset(median_filter_t * filter){
+    MedianHeapReset(&filter->heap);
+}
+
+bool MedianFilterI16Init(median_filter_i16_t * filter, int16_t * samples, int16_t * index, uint16_t window){
+    filter->samples = samples;
+    return MedianHeapInit(&filter->heap, index, window);
+}
+
+void MedianFilterI16Process(median_filter_i16_t * filter, const int16_t * input, int16_t * output, uint16_t lenght){
+    median_heap_t * h = &filter->heap;
+    for(uint16_t i = 0; i < lenght; i++){
+        int16_t x = input[i];
+        bool replaced = (h->count == h->window);
+        bool grew = replaced && (filter->samples[h->oldest] < x);
+        filter->samples[h->oldest] = x;
+        h->count += !replaced;
+        MedianUpdate(h, filter->samples, false, replaced, grew);
+        int32_t median = filter->samples[h->heap[0]];
+        if((h->count & 1) == 0){
+            median = (median + filter->samples[h->heap[-1]]) >> 1;
+        }
+        output[i] = (int16_t)median;
+    }
+}
+
+void MedianFilterI16Reset(median_filter_i16_t * filter){
+    MedianHeapReset(&filter->heap);
+}
+
+/*==================[end of file]============================================*/
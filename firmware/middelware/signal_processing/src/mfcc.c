@@ -0,0 +1,113 @@
+/**
+ * @file mfcc.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <string.h>
+#include "mfcc.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Mel of a frequency (Hz)
+ */
+static float MfccMel(float f){
+    return 2595.0f * log10f(1.0f + f / 700.0f);
+}
+
+/*==================[external functions definition]==========================*/
+bool MfccInit(mfcc_t * mfcc, const mfcc_config_t * config, float * buffer){
+    uint8_t n = config->n_mels;
+    uint16_t bins = config->frame_lenght / 2;
+    if(n < 4 || n > MFCC_MAX_MELS || (n & (n - 1)) != 0 || config->n_coeffs == 0 || config->n_coeffs > n ||
+       config->min_frec < 0 || config->max_frec <= config->min_frec || config->max_frec > config->sample_frec / 2){
+        return false;
+    }
+    mfcc->weight = buffer;
+    mfcc->n_mels = n;
+    mfcc->n_coeffs = config->n_coeffs;
+    // n + 2 points equally spaced in mel: edges and centers of the triangles
+    float mel_min = MfccMel(config->min_frec);
+    float mel_step = (MfccMel(config->max_frec) - mel_min) / (n + 1);
+    float bin_frec = config->sample_frec / config->frame_lenght;
+    uint16_t k = 0;
+    for(uint8_t j = 0; j < n + 2; j++){
+        float point = mel_min + j * mel_step;
+        while(k < bins && MfccMel(k * bin_frec) < point){
+            if(j > 0){
+                // rising side of band j - 1 (falling side of band j - 2)
+                buffer[k] = (MfccMel(k * bin_frec) - (point - mel_step)) / mel_step;
+            }
+            k++;
+        }
+        mfcc->edge[j] = k;
+    }
+    return true;
+}
+
+void MfccBands(mfcc_t * mfcc, const float * power, float * bands){
+    uint8_t n = mfcc->n_mels;
+    const float * weight = mfcc->weight;
+    memset(bands, 0, n * sizeof(float));
+    // segment j: between the points j and j + 1, rising side of band j and falling side of band j - 1
+    for(uint8_t j = 0; j <= n; j++){
+        float rising = 0, falling = 0;
+        for(uint16_t k = mfcc->edge[j]; k < mfcc->edge[j + 1]; k++){
+            float r = weight[k] * power[k];
+            rising += r;
+            falling += power[k] - r;
+        }
+        if(j < n){
+            bands[j] += rising;
+        }
+        if(j > 0){
+            bands[j - 1] += falling;
+        }
+    }
+    for(uint8_t m = 0; m < n; m++){
+        bands[m] = logf(bands[m] + MFCC_FLOOR);
+    }
+}
+
+void MfccProcess(mfcc_t * mfcc, const float * power, float * coeffs){
+    MfccBands(mfcc, power, mfcc->work);
+    // DCT-II in place (work holds 2 * n_mels values)
+    dsps_dct_f32(mfcc->work, mfcc->n_mels);
+    memcpy(coeffs, mfcc->work, mfcc->n_coeffs * sizeof(float));
+}
+
+uint8_t MfccClassify(const float * features, uint8_t n_features, const float * centroids, uint8_t n_classes){
+    uint8_t best = 0;
+    float best_distance = INFINITY;
+    for(uint8_t c = 0; c < n_classes; c++){
+        float distance = 0;
+        for(uint8_t i = 0; i < n_features; i++){
+            float d = features[i] - centroids[c * n_features + i];
+            distance += d * d;
+        }
+        if(distance < best_distance){
+            best_distance = distance;
+            best = c;
+        }
+    }
+    return best;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,94 @@
+/**
+ * @file midi.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "midi.h"
+/*==================[macros and definitions]=================================*/
+#define MIDI_DATA_MASK          0x7F    /*!< Data bytes have the MSB cleared */
+#define BLE_MIDI_HEADER         0x80    /*!< Header byte: 1 0 + 6 high bits of the timestamp */
+#define BLE_MIDI_TIMESTAMP      0x80    /*!< Timestamp byte: 1 + 7 low bits of the timestamp */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+uint8_t MidiNoteOn(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t * msg){
+    msg[0] = MIDI_NOTE_ON | (channel & 0x0F);
+    msg[1] = note & MIDI_DATA_MASK;
+    msg[2] = velocity & MIDI_DATA_MASK;
+    return MIDI_MSG_MAX_LENGHT;
+}
+
+uint8_t MidiControlChange(uint8_t channel, uint8_t controller, uint8_t value, uint8_t * msg){
+    msg[0] = MIDI_CONTROL_CHANGE | (channel & 0x0F);
+    msg[1] = controller & MIDI_DATA_MASK;
+    msg[2] = value & MIDI_DATA_MASK;
+    return MIDI_MSG_MAX_LENGHT;
+}
+
+void MidiSerialInit(midi_serial_t * midi){
+    midi->status = 0;
+}
+
+uint8_t MidiSerialEncode(midi_serial_t * midi, const uint8_t * msg, uint8_t lenght, uint8_t * output){
+    if(lenght == 0){
+        return 0;
+    }
+    if(msg[0] == midi->status){
+        memcpy(output, &msg[1], lenght - 1);
+        return lenght - 1;
+    }
+    midi->status = msg[0];
+    memcpy(output, msg, lenght);
+    return lenght;
+}
+
+void BleMidiPacketInit(ble_midi_packet_t * packet){
+    packet->lenght = 0;
+    packet->time = 0;
+}
+
+bool BleMidiPacketAdd(ble_midi_packet_t * packet, uint16_t time, const uint8_t * msg, uint8_t lenght){
+    time &= BLE_MIDI_TIME_MASK;
+    if(packet->lenght == 0){
+        if(1 + 1 + lenght > BLE_MIDI_PACKET_SIZE){
+            return false;
+        }
+        packet->data[packet->lenght++] = BLE_MIDI_HEADER | (time >> 7);
+    }
+    else{
+        uint16_t elapsed = (time - packet->time) & BLE_MIDI_TIME_MASK;
+        if(elapsed > BLE_MIDI_TIME_MASK / 2){
+            // older than the previous message (wrapped difference)
+            time = packet->time;
+        }
+        else if(elapsed > MIDI_DATA_MASK){
+            return false;
+        }
+        if(packet->lenght + 1 + lenght > BLE_MIDI_PACKET_SIZE){
+            return false;
+        }
+    }
+    packet->data[packet->lenght++] = BLE_MIDI_TIMESTAMP | (time & MIDI_DATA_MASK);
+    memcpy(&packet->data[packet->lenght], msg, lenght);
+    packet->lenght += lenght;
+    packet->time = time;
+    return true;
+}
+
+/*==================[end of file]============================================*/
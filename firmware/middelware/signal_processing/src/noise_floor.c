@@ -0,0 +1,78 @@
+/**
+ * @file noise_floor.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "noise_floor.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool NoiseFloorInit(noise_floor_t * nf, float sample_frec, float time_ms, float k, float min_threshold){
+    float samples = time_ms * sample_frec / 1000.0f;
+    if(samples < 1 || k < 0 || min_threshold < 0){
+        return false;
+    }
+    nf->alpha = 1.0f / samples;
+    nf->k = k;
+    nf->min_threshold = min_threshold;
+    NoiseFloorReset(nf);
+    return true;
+}
+
+void NoiseFloorReset(noise_floor_t * nf){
+    nf->mean = 0;
+    nf->var = 0;
+    nf->threshold = nf->min_threshold;
+}
+
+void NoiseFloorSetMinimum(noise_floor_t * nf, float min_threshold){
+    nf->min_threshold = min_threshold;
+    float threshold = nf->mean + nf->k * sqrtf(nf->var);
+    nf->threshold = (threshold > min_threshold) ? threshold : min_threshold;
+}
+
+float NoiseFloorProcess(noise_floor_t * nf, const float * signal, uint16_t signal_lenght){
+    float mean = nf->mean;
+    float var = nf->var;
+    float alpha = nf->alpha;
+    float limit = nf->threshold;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        float r = fabsf(signal[i]);
+        // the samples of the hits are not noise
+        if(r > limit){
+            continue;
+        }
+        float d = r - mean;
+        mean += alpha * d;
+        var = (1.0f - alpha) * (var + alpha * d * d);
+    }
+    nf->mean = mean;
+    nf->var = var;
+    float threshold = mean + nf->k * sqrtf(var);
+    nf->threshold = (threshold > nf->min_threshold) ? threshold : nf->min_threshold;
+    return nf->threshold;
+}
+
+float NoiseFloorThreshold(const noise_floor_t * nf){
+    return nf->threshold;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,107 @@
+/**
+ * @file onset_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "onset_detector.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief New magnitude frame (STFT callback): flux and peak picking of the previous frame
+ */
+static void OnsetDetectorFrame(const float * magnitude, uint16_t bins, void * param){
+    onset_detector_t * od = param;
+    uint32_t frame = od->stft.frames;
+    float flux = 0;
+    for(uint16_t k = 0; k < bins; k++){
+        float d = magnitude[k] - od->previous[k];
+        flux += (d > 0) ? d : 0;
+    }
+    memcpy(od->previous, magnitude, bins * sizeof(float));
+    if(frame == 1){
+        // no previous frame: the first one is all increase
+        return;
+    }
+    // the previous frame is a peak if the flux rose to it and not above it now
+    float peak = od->flux[0];
+    bool onset = (frame > 3) && (peak > od->flux[1]) && (peak >= flux) &&
+                 (peak > od->threshold + od->multiplier * od->mean) &&
+                 (frame - 1 - od->last_onset >= od->min_gap);
+    if(onset){
+        od->last_onset = frame - 1;
+        od->onsets++;
+        if(od->func_p != NULL){
+            // the flux peaks with the attack in the last two hops of the frame: the first sample of them
+            uint16_t frame_lenght = od->stft.plan.signal_lenght;
+            od->func_p((frame - 2) * od->stft.hop_lenght + frame_lenght - 2 * od->stft.hop_lenght, peak, od->param_p);
+        }
+    }else{
+        // running mean of the frames without onsets
+        od->mean += (peak - od->history[od->head]) / ONSET_HISTORY;
+        od->history[od->head] = peak;
+        od->head = (od->head + 1) % ONSET_HISTORY;
+    }
+    od->flux[1] = peak;
+    od->flux[0] = flux;
+}
+
+/*==================[external functions definition]==========================*/
+bool OnsetDetectorInit(onset_detector_t * od, const onset_detector_config_t * config, float * buffer,
+                       void (*func_p)(uint32_t sample, float flux, void * param), void * param_p){
+    if(config->sample_frec <= 0 || config->threshold < 0 || config->multiplier < 0 || config->min_gap < 0){
+        return false;
+    }
+    // buffer: STFT | previous magnitude
+    if(!STFTInit(&od->stft, config->frame_lenght, config->hop_lenght, FFT_WINDOW_HANN, buffer, OnsetDetectorFrame, od)){
+        return false;
+    }
+    FFTPlanSetMagnitude(&od->stft.plan, FFT_MAG_APPROX);
+    od->previous = &buffer[STFT_BUFFER_LENGHT(config->frame_lenght)];
+    od->threshold = config->threshold;
+    od->multiplier = config->multiplier;
+    od->min_gap = (uint32_t)(config->min_gap * config->sample_frec / 1000.0f / config->hop_lenght);
+    od->func_p = func_p;
+    od->param_p = param_p;
+    OnsetDetectorReset(od);
+    return true;
+}
+
+uint16_t OnsetDetectorProcess(onset_detector_t * od, const float * samples, uint16_t lenght){
+    od->onsets = 0;
+    STFTProcess(&od->stft, samples, lenght);
+    return od->onsets;
+}
+
+float OnsetDetectorGetFlux(const onset_detector_t * od){
+    return od->flux[0];
+}
+
+void OnsetDetectorReset(onset_detector_t * od){
+    STFTReset(&od->stft);
+    memset(od->history, 0, sizeof(od->history));
+    od->mean = 0;
+    od->head = 0;
+    od->flux[0] = 0;
+    od->flux[1] = 0;
+    od->last_onset = 0;
+    od->onsets = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,164 @@
+/**
+ * @file pad_settings.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "pad_settings.h"
+#include "telemetry.h"
+/*==================[macros and definitions]=================================*/
+#define SENSITIVITY_ONE     256     /*!< Sensitivity 1 in Q8.8 */
+#define CROSSTALK_ONE       255     /*!< Cross-talk ratio 1 */
+#define CURVE_ONE           32      /*!< Linear curve */
+#define FIELD_LENGHT        12      /*!< Max characters of the field of a command */
+#define MAX_VELOCITY        127     /*!< Max velocity of the points of a custom curve */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Round a value to an unsigned integer field, limited to max
+ */
+static uint16_t PadSettingsQuantize(float value, float scale, uint16_t max){
+    float q = value * scale + 0.5f;
+    if(q <= 0){
+        return 0;
+    }
+    return (q >= max) ? max : (uint16_t)q;
+}
+
+/**
+ * @brief Store a 16 bits field (little endian)
+ */
+static void PadSettingsPut16(uint8_t * p, uint16_t value){
+    p[0] = value & 0xFF;
+    p[1] = value >> 8;
+}
+
+/**
+ * @brief Read a 16 bits field (little endian)
+ */
+static uint16_t PadSettingsGet16(const uint8_t * p){
+    return p[0] | (p[1] << 8);
+}
+
+/**
+ * @brief Execute a "points" command (the arguments after "points")
+ */
+static pad_command_t PadSettingsPoints(pad_settings_t * settings, uint8_t pads, const char * args){
+    unsigned int pad, value;
+    uint8_t point[PAD_SETTINGS_MAX_POINTS];
+    uint8_t n = 0;
+    int used;
+    char rest;
+    if(sscanf(args, "%u%n", &pad, &used) != 1 || pad >= pads){
+        return PAD_COMMAND_ERROR;
+    }
+    for(args += used; sscanf(args, "%u%n", &value, &used) == 1; args += used){
+        if(n == PAD_SETTINGS_MAX_POINTS || value < 1 || value > MAX_VELOCITY){
+            return PAD_COMMAND_ERROR;
+        }
+        point[n++] = value;
+    }
+    // something else than velocities, or a single point
+    if(sscanf(args, " %c", &rest) == 1 || n == 1){
+        return PAD_COMMAND_ERROR;
+    }
+    settings[pad].points = n;
+    memcpy(settings[pad].point, point, n);
+    return PAD_COMMAND_SET;
+}
+
+/*==================[external functions definition]==========================*/
+uint16_t PadSettingsEncode(const pad_settings_t * settings, uint8_t pads, uint8_t * blob){
+    PadSettingsPut16(blob, PAD_SETTINGS_MAGIC);
+    blob[2] = PAD_SETTINGS_VERSION;
+    blob[3] = pads;
+    uint8_t * p = &blob[PAD_SETTINGS_HEADER];
+    for(uint8_t i = 0; i < pads; i++, p += PAD_SETTINGS_PAD_SIZE){
+        PadSettingsPut16(&p[0], PadSettingsQuantize(settings[i].threshold, 1, UINT16_MAX));
+        PadSettingsPut16(&p[2], PadSettingsQuantize(settings[i].max_level, 1, UINT16_MAX));
+        PadSettingsPut16(&p[4], PadSettingsQuantize(settings[i].sensitivity, SENSITIVITY_ONE, UINT16_MAX));
+        p[6] = PadSettingsQuantize(settings[i].crosstalk, CROSSTALK_ONE, CROSSTALK_ONE);
+        p[7] = PadSettingsQuantize(settings[i].curve, CURVE_ONE, UINT8_MAX);
+        p[8] = settings[i].flags;
+        p[9] = settings[i].points;
+        memcpy(&p[10], settings[i].point, PAD_SETTINGS_MAX_POINTS);
+    }
+    uint16_t lenght = p - blob;
+    PadSettingsPut16(p, TelemetryCRC16(blob, lenght));
+    return lenght + 2;
+}
+
+bool PadSettingsDecode(pad_settings_t * settings, uint8_t pads, const uint8_t * blob, uint16_t lenght){
+    if(lenght != PAD_SETTINGS_SIZE(pads) || PadSettingsGet16(blob) != PAD_SETTINGS_MAGIC ||
+        blob[2] != PAD_SETTINGS_VERSION || blob[3] != pads ||
+        PadSettingsGet16(&blob[lenght - 2]) != TelemetryCRC16(blob, lenght - 2)){
+        return false;
+    }
+    const uint8_t * p = &blob[PAD_SETTINGS_HEADER];
+    for(uint8_t i = 0; i < pads; i++, p += PAD_SETTINGS_PAD_SIZE){
+        settings[i].threshold = PadSettingsGet16(&p[0]);
+        settings[i].max_level = PadSettingsGet16(&p[2]);
+        settings[i].sensitivity = (float)PadSettingsGet16(&p[4]) / SENSITIVITY_ONE;
+        settings[i].crosstalk = (float)p[6] / CROSSTALK_ONE;
+        settings[i].curve = (float)p[7] / CURVE_ONE;
+        settings[i].flags = p[8];
+        settings[i].points = (p[9] >= 2 && p[9] <= PAD_SETTINGS_MAX_POINTS) ? p[9] : 0;
+        memcpy(settings[i].point, &p[10], PAD_SETTINGS_MAX_POINTS);
+    }
+    return true;
+}
+
+pad_command_t PadSettingsCommand(pad_settings_t * settings, uint8_t pads, const char * line){
+    char field[FIELD_LENGHT];
+    unsigned int pad;
+    float value;
+    if(strcmp(line, "save") == 0){
+        return PAD_COMMAND_SAVE;
+    }
+    if(strcmp(line, "defaults") == 0){
+        return PAD_COMMAND_DEFAULTS;
+    }
+    if(strncmp(line, "points ", 7) == 0){
+        return PadSettingsPoints(settings, pads, &line[7]);
+    }
+    if(sscanf(line, "set %u %11s %f", &pad, field, &value) != 3 || pad >= pads || !isfinite(value)){
+        return PAD_COMMAND_ERROR;
+    }
+    pad_settings_t *s = &settings[pad];
+    // the limits are the ones of the blob
+    if(strcmp(field, "threshold") == 0 && value > 0 && value < s->max_level){
+        s->threshold = value;
+        // a threshold set by hand replaces the one of the boot calibration
+        s->flags |= PAD_SETTINGS_CALIBRATED;
+    }else if(strcmp(field, "max") == 0 && value > s->threshold && value <= UINT16_MAX){
+        s->max_level = value;
+    }else if(strcmp(field, "sens") == 0 && value > 0 && value < 256){
+        s->sensitivity = value;
+    }else if(strcmp(field, "xtalk") == 0 && value > 0 && value <= 1){
+        s->crosstalk = value;
+    }else if(strcmp(field, "curve") == 0 && value > 0 && value < 8){
+        s->curve = value;
+    }else{
+        return PAD_COMMAND_ERROR;
+    }
+    return PAD_COMMAND_SET;
+}
+
+/*==================[end of file]============================================*/
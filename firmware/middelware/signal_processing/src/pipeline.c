@@ -0,0 +1,224 @@
+/**
+ * @file pipeline.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include "pipeline.h"
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Give a block to all the outputs of a stage (the stage reference goes to the last one)
+ */
+static void PipelineForward(pipeline_stage_t * stage, pipeline_block_t * block){
+    uint8_t n = stage->n_outputs;
+    if(n == 0){
+        PipelineRelease(block);
+        return;
+    }
+    // one reference for each output, taken before any of them can release the block
+    atomic_fetch_add(&block->refs, n - 1);
+    for(uint8_t i = 0; i < n; i++){
+        PipelinePush(stage->outputs[i], block);
+    }
+}
+/*==================[external functions definition]==========================*/
+bool PipelinePoolInit(pipeline_pool_t * pool, uint16_t block_lenght, uint8_t n_blocks, float * buffer){
+    if(block_lenght == 0 || n_blocks == 0 || n_blocks > PIPELINE_MAX_BLOCKS){
+        return false;
+    }
+    pool->allocated = false;
+    if(buffer == NULL){
+        buffer = malloc(PIPELINE_POOL_BUFFER_LENGHT(block_lenght, n_blocks) * sizeof(float));
+        if(buffer == NULL){
+            return false;
+        }
+        pool->allocated = true;
+    }
+    pool->buffer = buffer;
+    pool->block_lenght = block_lenght;
+    pool->n_blocks = n_blocks;
+    for(uint8_t i = 0; i < n_blocks; i++){
+        pipeline_block_t * block = &pool->blocks[i];
+        block->data = &buffer[(uint32_t)i * block_lenght];
+        block->capacity = block_lenght;
+        block->lenght = 0;
+        block->pool = pool;
+        atomic_init(&block->refs, 0);
+    }
+    atomic_init(&pool->free, (n_blocks < 32) ? (1UL << n_blocks) - 1 : 0xFFFFFFFFUL);
+    return true;
+}
+
+void PipelinePoolDeinit(pipeline_pool_t * pool){
+    if(pool->allocated){
+        free(pool->buffer);
+        pool->allocated = false;
+    }
+    pool->buffer = NULL;
+    atomic_store(&pool->free, 0);
+}
+
+uint8_t PipelinePoolFree(pipeline_pool_t * pool){
+    uint32_t mask = atomic_load(&pool->free);
+    uint8_t n = 0;
+    while(mask){
+        mask &= mask - 1;
+        n++;
+    }
+    return n;
+}
+
+pipeline_block_t * PipelineAlloc(pipeline_pool_t * pool){
+    uint_fast32_t mask = atomic_load(&pool->free);
+    uint8_t i;
+    // lock free: retried if another task or ISR took a block in between
+    do{
+        if(mask == 0){
+            return NULL;
+        }
+        i = __builtin_ctz(mask);
+    }while(!atomic_compare_exchange_weak(&pool->free, &mask, mask & ~(1UL << i)));
+    pipeline_block_t * block = &pool->blocks[i];
+    block->lenght = 0;
+    block->time = 0;
+    block->channel = 0;
+    atomic_store(&block->refs, 1);
+    return block;
+}
+
+void PipelineRetain(pipeline_block_t * block){
+    atomic_fetch_add(&block->refs, 1);
+}
+
+void PipelineRelease(pipeline_block_t * block){
+    if(atomic_fetch_sub(&block->refs, 1) == 1){
+        pipeline_pool_t * pool = block->pool;
+        atomic_fetch_or(&pool->free, 1UL << (block - pool->blocks));
+    }
+}
+
+void PipelineStageInit(pipeline_stage_t * stage, pipeline_stage_type_t type, pipeline_func_t func, void * ctx,
+    pipeline_pool_t * pool){
+    stage->type = type;
+    stage->func = func;
+    stage->ctx = ctx;
+    stage->pool = pool;
+    stage->n_outputs = 0;
+    stage->blocks = 0;
+    stage->copies = 0;
+    stage->dropped = 0;
+}
+
+bool PipelineConnect(pipeline_stage_t * from, pipeline_stage_t * to){
+    if(from->type == PIPELINE_SINK || from->n_outputs >= PIPELINE_MAX_OUTPUTS){
+        return false;
+    }
+    from->outputs[from->n_outputs++] = to;
+    return true;
+}
+
+void PipelinePush(pipeline_stage_t * stage, pipeline_block_t * block){
+    stage->blocks++;
+    if(stage->func == NULL){
+        PipelineForward(stage, block);
+        return;
+    }
+    switch(stage->type){
+        case PIPELINE_SINK:
+            stage->func(stage->ctx, block, NULL);
+            PipelineRelease(block);
+            break;
+        case PIPELINE_IN_PLACE:
+            if(atomic_load(&block->refs) > 1){
+                // shared: the other stages must see the original samples
+                pipeline_block_t * copy = (stage->pool != NULL) ? PipelineAlloc(stage->pool) : NULL;
+                if(copy == NULL || copy->capacity < block->lenght){
+                    if(copy != NULL){
+                        PipelineRelease(copy);
+                    }
+                    stage->dropped++;
+                    PipelineRelease(block);
+                    return;
+                }
+                memcpy(copy->data, block->data, block->lenght * sizeof(float));
+                copy->lenght = block->lenght;
+                copy->time = block->time;
+                copy->channel = block->channel;
+                PipelineRelease(block);
+                block = copy;
+                stage->copies++;
+            }
+            if(stage->func(stage->ctx, block, block)){
+                PipelineForward(stage, block);
+            }
+            else{
+                PipelineRelease(block);
+            }
+            break;
+        case PIPELINE_TRANSFORM:{
+            pipeline_block_t * out = (stage->pool != NULL) ? PipelineAlloc(stage->pool) : NULL;
+            if(out == NULL){
+                stage->dropped++;
+                PipelineRelease(block);
+                return;
+            }
+            out->time = block->time;
+            out->channel = block->channel;
+            bool forward = stage->func(stage->ctx, block, out);
+            PipelineRelease(block);
+            if(forward){
+                PipelineForward(stage, out);
+            }
+            else{
+                PipelineRelease(out);
+            }
+            break;
+        }
+    }
+}
+
+bool PipelineIIRStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out){
+    (void)out;
+    IIRFilterProcess((iir_filter_t *)ctx, in->data, in->data, in->lenght);
+    return true;
+}
+
+bool PipelineFIRStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out){
+    (void)out;
+    FIRFilterProcess((fir_filter_t *)ctx, in->data, in->data, in->lenght);
+    return true;
+}
+
+bool PipelineFFTStage(void * ctx, pipeline_block_t * in, pipeline_block_t * out){
+    fft_plan_t * plan = (fft_plan_t *)ctx;
+    if(in->lenght != plan->signal_lenght || out->capacity < plan->signal_lenght / 2){
+        return false;
+    }
+    FFTPlanMagnitude(plan, in->data, out->data);
+    out->lenght = plan->signal_lenght / 2;
+    return true;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,212 @@
+/**
+ * @file qrs_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "qrs_detector.h"
+/*==================[macros and definitions]=================================*/
+#define SEARCH_BACK_RR      166     /*!< Search back after this percentage of the average RR interval */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Store a beat: update the RR intervals and fill the event
+ */
+static void QRSBeat(qrs_detector_t * detector, uint32_t r_time, float amplitude, uint16_t pos,
+    qrs_beat_t * beat){
+    uint32_t rr = 0;
+    if(detector->beat_found){
+        rr = r_time - detector->last_beat;
+        detector->rr_sum += rr - detector->rr[detector->rr_index];
+        detector->rr[detector->rr_index] = rr;
+        detector->rr_index = (detector->rr_index + 1) % QRS_RR_AVERAGE;
+        if(detector->rr_count < QRS_RR_AVERAGE){
+            detector->rr_count++;
+        }
+    }
+    detector->beat_found = true;
+    detector->last_beat = r_time;
+    detector->back_peak = 0;
+    if(beat != NULL){
+        beat->time = r_time;
+        beat->pos = (int32_t)pos - (int32_t)(detector->time - r_time);
+        beat->amplitude = amplitude;
+        beat->rr = rr * 1000.0f / detector->sample_frec;
+        beat->heart_rate = (rr > 0) ? 60.0f * detector->sample_frec / rr : 0;
+    }
+}
+
+/**
+ * @brief Classify a peak of the integrated signal
+ *
+ * @return true if the peak is a QRS complex
+ */
+static bool QRSPeak(qrs_detector_t * detector, float peak){
+    if(detector->time < detector->learn){
+        if(peak > detector->learn_max){
+            detector->learn_max = peak;
+        }
+        return false;
+    }
+    if(detector->beat_found && detector->r_time - detector->last_beat < detector->refractory){
+        return false;
+    }
+    float threshold = detector->npki + 0.25f * (detector->spki - detector->npki);
+    if(peak > threshold){
+        detector->spki = 0.125f * peak + 0.875f * detector->spki;
+        return true;
+    }
+    detector->npki = 0.125f * peak + 0.875f * detector->npki;
+    if(peak > detector->back_peak){
+        detector->back_peak = peak;
+        detector->back_amplitude = detector->r_amplitude;
+        detector->back_time = detector->r_time;
+    }
+    return false;
+}
+/*==================[external functions definition]==========================*/
+bool QRSDetectorInit(qrs_detector_t * detector, const qrs_detector_config_t * config){
+    if(config->sample_frec <= 0 || config->window_time <= 0){
+        return false;
+    }
+    float samples_ms = config->sample_frec / 1000.0f;
+    long window = lrintf(config->window_time * samples_ms);
+    if(window < 1 || window > QRS_MAX_WINDOW){
+        return false;
+    }
+    detector->sample_frec = config->sample_frec;
+    detector->window = (uint16_t)window;
+    detector->refractory = (uint16_t)lrintf(config->refractory_time * samples_ms);
+    detector->learn = (uint32_t)lrintf(config->learn_time * samples_ms);
+    if(detector->learn == 0){
+        detector->learn = 1;
+    }
+    QRSDetectorReset(detector);
+    return true;
+}
+
+void QRSDetectorReset(qrs_detector_t * detector){
+    detector->time = 0;
+    memset(detector->x, 0, sizeof(detector->x));
+    memset(detector->squared, 0, sizeof(detector->squared));
+    detector->index = 0;
+    detector->sum = 0;
+    detector->last_sum = 0;
+    detector->rising = false;
+    detector->r_amplitude = 0;
+    detector->r_time = 0;
+    detector->spki = 0;
+    detector->npki = 0;
+    detector->learn_max = 0;
+    detector->learn_sum = 0;
+    detector->beat_found = false;
+    detector->last_beat = 0;
+    detector->back_peak = 0;
+    detector->back_amplitude = 0;
+    detector->back_time = 0;
+    memset(detector->rr, 0, sizeof(detector->rr));
+    detector->rr_sum = 0;
+    detector->rr_count = 0;
+    detector->rr_index = 0;
+}
+
+uint8_t QRSDetectorProcess(qrs_detector_t * detector, const float * signal, uint16_t signal_lenght,
+    qrs_beat_t * beats, uint8_t max_beats){
+    uint8_t n_beats = 0;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        float x = signal[i];
+        // derivative, squaring and moving window integration
+        float d = (2 * x + detector->x[0] - detector->x[2] - 2 * detector->x[3]) * 0.125f;
+        detector->x[3] = detector->x[2];
+        detector->x[2] = detector->x[1];
+        detector->x[1] = detector->x[0];
+        detector->x[0] = x;
+        float sq = d * d;
+        detector->sum += sq - detector->squared[detector->index];
+        detector->squared[detector->index] = sq;
+        if(++detector->index >= detector->window){
+            detector->index = 0;
+        }
+        if(detector->sum < 0){
+            // rounding of the running sum
+            detector->sum = 0;
+        }
+
+        bool beat = false;
+        if(detector->sum > detector->last_sum){
+            if(!detector->rising){
+                detector->rising = true;
+                detector->r_amplitude = 0;
+            }
+            if(fabsf(x) > detector->r_amplitude){
+                detector->r_amplitude = fabsf(x);
+                detector->r_time = detector->time;
+            }
+        }
+        else if(detector->sum < detector->last_sum && detector->rising){
+            // local maximum of the integrated signal
+            detector->rising = false;
+            beat = QRSPeak(detector, detector->last_sum);
+        }
+        if(beat){
+            QRSBeat(detector, detector->r_time, detector->r_amplitude, i,
+                (n_beats < max_beats && beats != NULL) ? &beats[n_beats] : NULL);
+            if(n_beats < UINT8_MAX){
+                n_beats++;
+            }
+        }
+        else if(detector->rr_count > 0 && detector->back_peak > 0 &&
+                (detector->time - detector->last_beat) * detector->rr_count * 100 > detector->rr_sum * SEARCH_BACK_RR){
+            // search back: no QRS for too long, take the highest noise peak if it's above half the threshold
+            float threshold = detector->npki + 0.25f * (detector->spki - detector->npki);
+            if(detector->back_peak > 0.5f * threshold){
+                detector->spki = 0.25f * detector->back_peak + 0.75f * detector->spki;
+                QRSBeat(detector, detector->back_time, detector->back_amplitude, i,
+                    (n_beats < max_beats && beats != NULL) ? &beats[n_beats] : NULL);
+                if(n_beats < UINT8_MAX){
+                    n_beats++;
+                }
+            }
+            else{
+                detector->back_peak = 0;
+            }
+        }
+        detector->last_sum = detector->sum;
+
+        if(detector->time < detector->learn){
+            detector->learn_sum += detector->sum;
+        }
+        if(++detector->time == detector->learn){
+            // initial levels: a third of the max peak and half the mean of the integrated signal
+            detector->spki = detector->learn_max / 3;
+            detector->npki = detector->learn_sum / detector->learn / 2;
+        }
+    }
+    return n_beats;
+}
+
+float QRSDetectorHeartRate(const qrs_detector_t * detector){
+    if(detector->rr_count == 0 || detector->rr_sum == 0){
+        return 0;
+    }
+    return 60.0f * detector->sample_frec * detector->rr_count / detector->rr_sum;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,165 @@
+/**
+ * @file rice_codec.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "rice_codec.h"
+/*==================[macros and definitions]=================================*/
+#define RICE_HEADER         3       /*!< Bytes of k and the first sample */
+#define RICE_ESCAPE_BITS    17      /*!< Bits of the zigzag value of an escape code */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Bits stream (MSB first)
+ */
+typedef struct {
+    uint8_t * data;         /*!< Bytes (write) */
+    const uint8_t * input;  /*!< Bytes (read) */
+    uint16_t pos;           /*!< Next byte */
+    uint16_t lenght;        /*!< Bytes available */
+    uint32_t acc;           /*!< Bits not written yet (or not read yet) */
+    uint8_t bits;           /*!< Bits in acc */
+} rice_bits_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Zigzag value of the difference of two samples (0, -1, 1, -2 ... to 0, 1, 2, 3 ...)
+ */
+static uint32_t RiceZigzag(int16_t x, int16_t prev){
+    int32_t d = (int32_t)x - prev;
+    return (d >= 0) ? (uint32_t)d << 1 : ((uint32_t)(-d) << 1) - 1;
+}
+
+/**
+ * @brief Write up to 24 bits
+ */
+static void RiceWrite(rice_bits_t * s, uint32_t value, uint8_t bits){
+    s->acc = (s->acc << bits) | value;
+    s->bits += bits;
+    while(s->bits >= 8){
+        s->bits -= 8;
+        s->data[s->pos++] = (uint8_t)(s->acc >> s->bits);
+    }
+}
+
+/**
+ * @brief Read up to 24 bits (-1 at the end of the block)
+ */
+static int32_t RiceRead(rice_bits_t * s, uint8_t bits){
+    while(s->bits < bits){
+        if(s->pos == s->lenght){
+            return -1;
+        }
+        s->acc = (s->acc << 8) | s->input[s->pos++];
+        s->bits += 8;
+    }
+    s->bits -= bits;
+    return (s->acc >> s->bits) & ((1UL << bits) - 1);
+}
+
+/*==================[external functions definition]==========================*/
+uint16_t RiceEncode(const int16_t * samples, uint16_t count, uint8_t * output, uint16_t max_lenght){
+    uint32_t cost[RICE_MAX_K + 1] = {0};
+    // bits of every k in one pass over the differences
+    for(uint16_t i = 1; i < count; i++){
+        uint32_t z = RiceZigzag(samples[i], samples[i - 1]);
+        for(uint8_t k = 0; k <= RICE_MAX_K; k++){
+            uint32_t q = z >> k;
+            cost[k] += (q < RICE_ESCAPE) ? q + 1 + k : RICE_ESCAPE + RICE_ESCAPE_BITS;
+        }
+    }
+    uint8_t best = 0;
+    for(uint8_t k = 1; k <= RICE_MAX_K; k++){
+        best = (cost[k] < cost[best]) ? k : best;
+    }
+    uint16_t lenght = RICE_HEADER + (cost[best] + 7) / 8;
+    if(lenght >= RICE_MAX_LENGHT(count)){
+        // not compressible (noise): the samples as they are
+        if(RICE_MAX_LENGHT(count) > max_lenght){
+            return 0;
+        }
+        output[0] = RICE_RAW;
+        // little endian target: the samples are copied as they are in memory
+        memcpy(&output[1], samples, count * sizeof(int16_t));
+        return RICE_MAX_LENGHT(count);
+    }
+    if(lenght > max_lenght){
+        return 0;
+    }
+    output[0] = best;
+    output[1] = (uint16_t)samples[0] & 0xFF;
+    output[2] = (uint16_t)samples[0] >> 8;
+    rice_bits_t s = {.data = output, .pos = RICE_HEADER};
+    for(uint16_t i = 1; i < count; i++){
+        uint32_t z = RiceZigzag(samples[i], samples[i - 1]);
+        uint32_t q = z >> best;
+        if(q < RICE_ESCAPE){
+            // q ones and a zero, then the k low bits
+            RiceWrite(&s, ((1UL << q) - 1) << 1, q + 1);
+            RiceWrite(&s, z & ((1UL << best) - 1), best);
+        }else{
+            RiceWrite(&s, (1UL << RICE_ESCAPE) - 1, RICE_ESCAPE);
+            RiceWrite(&s, z, RICE_ESCAPE_BITS);
+        }
+    }
+    // last bits, padded with zeros
+    if(s.bits > 0){
+        RiceWrite(&s, 0, 8 - s.bits);
+    }
+    return s.pos;
+}
+
+uint16_t RiceDecode(const uint8_t * input, uint16_t lenght, int16_t * samples, uint16_t count){
+    if(lenght == 0 || count == 0){
+        return 0;
+    }
+    uint8_t k = input[0];
+    if(k == RICE_RAW){
+        if(lenght < RICE_MAX_LENGHT(count)){
+            return 0;
+        }
+        memcpy(samples, &input[1], count * sizeof(int16_t));
+        return RICE_MAX_LENGHT(count);
+    }
+    if(k > RICE_MAX_K || lenght < RICE_HEADER){
+        return 0;
+    }
+    samples[0] = (int16_t)(input[1] | (input[2] << 8));
+    rice_bits_t s = {.input = input, .pos = RICE_HEADER, .lenght = lenght};
+    for(uint16_t i = 1; i < count; i++){
+        uint32_t q = 0;
+        int32_t bit = 0;
+        while(q < RICE_ESCAPE && (bit = RiceRead(&s, 1)) == 1){
+            q++;
+        }
+        int32_t z;
+        if(q == RICE_ESCAPE){
+            z = RiceRead(&s, RICE_ESCAPE_BITS);
+        }else if(bit < 0){
+            return 0;
+        }else{
+            z = RiceRead(&s, k);
+            z = (z < 0) ? z : (int32_t)((q << k) | z);
+        }
+        if(z < 0){
+            return 0;
+        }
+        int32_t d = (z & 1) ? -((z + 1) >> 1) : (z >> 1);
+        samples[i] = (int16_t)(samples[i - 1] + d);
+    }
+    return s.pos;
+}
+
+/*==================[end of file]============================================*/
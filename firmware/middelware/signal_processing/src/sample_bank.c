@@ -0,0 +1,368 @@
+/**
+ * @file sample_bank.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include "sample_bank.h"
+#include "adpcm.h"
+#include "esp_partition.h"
+#include "esp_log.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_CACHE_ALIGN      4       /*!< Alignment of the attacks in the cache */
+#define SAMPLE_BANK_ALIGN       4       /*!< Alignment of the data written by SampleBankWrite */
+#define SAMPLE_BANK_CHUNK       256     /*!< Samples encoded at a time by SampleBankWrite (even) */
+
+/*==================[internal data declaration]==============================*/
+static const char *TAG = "SAMPLE_BANK";
+
+/**
+ * @brief Buffered writer of a partition, one erase sector at a time
+ */
+typedef struct {
+    const esp_partition_t * partition;  /*!< Partition written */
+    uint8_t * sector;                   /*!< Content of the sector being written */
+    uint32_t sector_size;               /*!< Bytes of an erase sector */
+    uint32_t base;                      /*!< Offset of the sector being written */
+    uint32_t pos;                       /*!< Offset of the next byte */
+    bool ok;                            /*!< No flash errors */
+} sample_bank_writer_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Samples of the attack of a sample (even, so ADPCM attacks end at a byte boundary)
+ */
+static uint32_t SampleCacheLenght(const sample_t * sample, uint16_t attack_ms){
+    uint32_t n = ((uint32_t)attack_ms * sample->sample_rate + 999) / 1000;
+    n = (n + 1) & ~1UL;
+    return (n < sample->lenght) ? n : sample->lenght;
+}
+
+/**
+ * @brief Check that an index entry describes data inside the bank
+ */
+static bool SampleBankCheckEntry(const sample_bank_entry_t * entry, uint32_t size){
+    uint64_t bytes;
+    switch(entry->format){
+    case SAMPLE_PCM16:
+        if(entry->offset & 1){
+            return false;
+        }
+        bytes = (uint64_t)entry->lenght * sizeof(int16_t);
+        break;
+    case SAMPLE_ADPCM:
+        bytes = ADPCM_BYTES((uint64_t)entry->lenght);
+        break;
+    default:
+        return false;
+    }
+    if(entry->name[SAMPLE_BANK_NAME_LENGHT - 1] != '\0'){
+        return false;
+    }
+    return (entry->offset + bytes <= size);
+}
+
+/**
+ * @brief Erase the sector of the writer and program its content
+ */
+static void SampleBankWriterFlush(sample_bank_writer_t * w){
+    w->ok = w->ok && esp_partition_erase_range(w->partition, w->base, w->sector_size) == ESP_OK &&
+            esp_partition_write(w->partition, w->base, w->sector, w->sector_size) == ESP_OK;
+}
+
+/**
+ * @brief Start writing at offset (the bytes of its sector before it are kept)
+ */
+static bool SampleBankWriterOpen(sample_bank_writer_t * w, const esp_partition_t * partition, uint32_t offset){
+    w->partition = partition;
+    w->sector_size = partition->erase_size;
+    w->sector = malloc(w->sector_size);
+    w->base = offset - offset % w->sector_size;
+    w->pos = offset;
+    w->ok = (w->sector != NULL) &&
+            (offset == w->base || esp_partition_read(partition, w->base, w->sector, offset - w->base) == ESP_OK);
+    if(w->sector != NULL){
+        memset(&w->sector[offset - w->base], 0xFF, w->sector_size - (offset - w->base));
+    }
+    return w->ok;
+}
+
+/**
+ * @brief Append bytes (each sector is erased and written when it is full)
+ */
+static void SampleBankWriterPut(sample_bank_writer_t * w, const void * data, uint32_t size){
+    const uint8_t * bytes = data;
+    while(size > 0 && w->ok){
+        uint32_t n = w->base + w->sector_size - w->pos;
+        if(n > size){
+            n = size;
+        }
+        memcpy(&w->sector[w->pos - w->base], bytes, n);
+        w->pos += n;
+        bytes += n;
+        size -= n;
+        if(w->pos == w->base + w->sector_size){
+            SampleBankWriterFlush(w);
+            w->base += w->sector_size;
+            memset(w->sector, 0xFF, w->sector_size);
+        }
+    }
+}
+
+/**
+ * @brief Rewrite bytes already written (read, modify, erase and write each sector)
+ */
+static void SampleBankWriterPatch(sample_bank_writer_t * w, uint32_t offset, const void * data, uint32_t size){
+    const uint8_t * bytes = data;
+    while(size > 0 && w->ok){
+        w->base = offset - offset % w->sector_size;
+        uint32_t n = w->base + w->sector_size - offset;
+        if(n > size){
+            n = size;
+        }
+        w->ok = esp_partition_read(w->partition, w->base, w->sector, w->sector_size) == ESP_OK;
+        memcpy(&w->sector[offset - w->base], bytes, n);
+        SampleBankWriterFlush(w);
+        offset += n;
+        bytes += n;
+        size -= n;
+    }
+}
+/*==================[external functions definition]==========================*/
+bool SampleBankOpen(sample_bank_t * bank, const void * data, uint32_t size){
+    const sample_bank_header_t * header = data;
+    memset(bank, 0, sizeof(sample_bank_t));
+    if(size < sizeof(sample_bank_header_t) || header->magic != SAMPLE_BANK_MAGIC){
+        ESP_LOGE(TAG, "Invalid bank header");
+        return false;
+    }
+    if(header->version != SAMPLE_BANK_VERSION || header->size > size){
+        ESP_LOGE(TAG, "Unsupported bank (version %u, %lu bytes)", header->version, (unsigned long)header->size);
+        return false;
+    }
+    const sample_bank_entry_t * entries = (const sample_bank_entry_t *)(header + 1);
+    if(sizeof(sample_bank_header_t) + (uint64_t)header->count * sizeof(sample_bank_entry_t) > header->size){
+        ESP_LOGE(TAG, "Bank index out of bounds");
+        return false;
+    }
+    for(uint16_t i = 0; i < header->count; i++){
+        if(!SampleBankCheckEntry(&entries[i], header->size)){
+            ESP_LOGE(TAG, "Invalid bank entry %u", i);
+            return false;
+        }
+    }
+    bank->base = data;
+    bank->entries = entries;
+    bank->count = header->count;
+    return true;
+}
+
+bool SampleBankLoad(sample_bank_t * bank, const char * label){
+    sample_bank_header_t header;
+    const void * data;
+    esp_partition_mmap_handle_t handle;
+    memset(bank, 0, sizeof(sample_bank_t));
+    const esp_partition_t * partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if(partition == NULL){
+        ESP_LOGE(TAG, "Partition %s not found", label);
+        return false;
+    }
+    // only the bytes used by the bank are mapped
+    if(esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != SAMPLE_BANK_MAGIC || header.size > partition->size){
+        ESP_LOGE(TAG, "No bank in partition %s", label);
+        return false;
+    }
+    if(esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &data, &handle) != ESP_OK){
+        ESP_LOGE(TAG, "Partition %s could not be mapped", label);
+        return false;
+    }
+    if(!SampleBankOpen(bank, data, header.size)){
+        esp_partition_munmap(handle);
+        return false;
+    }
+    bank->mmap_handle = handle;
+    ESP_LOGI(TAG, "%u samples loaded from partition %s", bank->count, label);
+    return true;
+}
+
+void SampleBankUnload(sample_bank_t * bank){
+    if(bank->mmap_handle != 0){
+        esp_partition_munmap(bank->mmap_handle);
+    }
+    memset(bank, 0, sizeof(sample_bank_t));
+}
+
+uint16_t SampleBankCount(const sample_bank_t * bank){
+    return bank->count;
+}
+
+bool SampleBankGet(const sample_bank_t * bank, uint16_t index, sample_t * sample){
+    if(index >= bank->count){
+        return false;
+    }
+    const sample_bank_entry_t * entry = &bank->entries[index];
+    sample->data = bank->base + entry->offset;
+    sample->lenght = entry->lenght;
+    sample->sample_rate = entry->sample_rate;
+    sample->format = entry->format;
+    sample->name = entry->name;
+    sample->head = NULL;
+    sample->head_lenght = 0;
+    return true;
+}
+
+int16_t SampleBankFind(const sample_bank_t * bank, const char * name){
+    for(uint16_t i = 0; i < bank->count; i++){
+        if(strncmp(bank->entries[i].name, name, SAMPLE_BANK_NAME_LENGHT) == 0){
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool SampleBankWrite(const char * label, const char * name, const int16_t * pcm, uint32_t lenght,
+                     uint16_t sample_rate, sample_format_t format){
+    sample_bank_header_t header;
+    sample_bank_entry_t entry;
+    sample_bank_writer_t w;
+    if(strlen(name) >= SAMPLE_BANK_NAME_LENGHT || (format != SAMPLE_PCM16 && format != SAMPLE_ADPCM)){
+        return false;
+    }
+    const esp_partition_t * partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if(partition == NULL){
+        ESP_LOGE(TAG, "Partition %s not found", label);
+        return false;
+    }
+    if(esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK){
+        return false;
+    }
+    if(header.magic != SAMPLE_BANK_MAGIC || header.version != SAMPLE_BANK_VERSION || header.size > partition->size ||
+        sizeof(header) + (uint64_t)header.count * sizeof(entry) > header.size){
+        // new bank, with room in the index for the next samples
+        header = (sample_bank_header_t){
+            .magic = SAMPLE_BANK_MAGIC, .version = SAMPLE_BANK_VERSION, .count = 0,
+            .size = sizeof(header) + SAMPLE_BANK_FREE_ENTRIES * sizeof(entry)
+        };
+    }
+    // the sample with the same name, or the entry after the last one if it is before the first data
+    uint16_t index = header.count;
+    uint32_t first_data = header.size;
+    for(uint16_t i = 0; i < header.count; i++){
+        if(esp_partition_read(partition, sizeof(header) + i * sizeof(entry), &entry, sizeof(entry)) != ESP_OK){
+            return false;
+        }
+        if(strncmp(entry.name, name, SAMPLE_BANK_NAME_LENGHT) == 0){
+            index = i;
+        }
+        if(entry.offset < first_data){
+            first_data = entry.offset;
+        }
+    }
+    if(index == header.count && sizeof(header) + (index + 1UL) * sizeof(entry) > first_data){
+        ESP_LOGE(TAG, "No free entry in the index of partition %s", label);
+        return false;
+    }
+    uint32_t offset = (header.size + SAMPLE_BANK_ALIGN - 1) & ~(SAMPLE_BANK_ALIGN - 1UL);
+    uint64_t bytes = (format == SAMPLE_ADPCM) ? ADPCM_BYTES((uint64_t)lenght) : (uint64_t)lenght * sizeof(int16_t);
+    if(offset + bytes > partition->size){
+        ESP_LOGE(TAG, "No space left in partition %s", label);
+        return false;
+    }
+    // data first: the bank stays valid until the header is rewritten
+    if(!SampleBankWriterOpen(&w, partition, offset)){
+        free(w.sector);
+        return false;
+    }
+    if(format == SAMPLE_ADPCM){
+        uint8_t adpcm[ADPCM_BYTES(SAMPLE_BANK_CHUNK)];
+        adpcm_state_t state;
+        AdpcmInit(&state);
+        for(uint32_t i = 0; i < lenght; i += SAMPLE_BANK_CHUNK){
+            uint32_t n = (lenght - i < SAMPLE_BANK_CHUNK) ? lenght - i : SAMPLE_BANK_CHUNK;
+            AdpcmEncode(&state, &pcm[i], adpcm, n);
+            SampleBankWriterPut(&w, adpcm, ADPCM_BYTES(n));
+        }
+    } else {
+        SampleBankWriterPut(&w, pcm, bytes);
+    }
+    if(w.pos > w.base){
+        SampleBankWriterFlush(&w);
+    }
+    memset(&entry, 0, sizeof(entry));
+    entry.offset = offset;
+    entry.lenght = lenght;
+    entry.sample_rate = sample_rate;
+    entry.format = format;
+    strncpy(entry.name, name, SAMPLE_BANK_NAME_LENGHT - 1);
+    SampleBankWriterPatch(&w, sizeof(header) + index * sizeof(entry), &entry, sizeof(entry));
+    if(index == header.count){
+        header.count++;
+    }
+    header.size = offset + bytes;
+    SampleBankWriterPatch(&w, 0, &header, sizeof(header));
+    free(w.sector);
+    if(!w.ok){
+        ESP_LOGE(TAG, "Flash error writing partition %s", label);
+        return false;
+    }
+    ESP_LOGI(TAG, "Sample %s written to partition %s (%lu bytes)", name, label, (unsigned long)bytes);
+    return true;
+}
+
+bool SampleCacheInit(sample_cache_t * cache, uint16_t attack_ms, uint8_t * buffer, uint32_t size){
+    cache->allocated = (buffer == NULL);
+    if(buffer == NULL){
+        buffer = malloc(size);
+    }
+    cache->buffer = buffer;
+    cache->size = (buffer != NULL) ? size : 0;
+    cache->used = 0;
+    cache->attack_ms = attack_ms;
+    return (buffer != NULL);
+}
+
+void SampleCacheDeinit(sample_cache_t * cache){
+    if(cache->allocated){
+        free(cache->buffer);
+        cache->allocated = false;
+    }
+    cache->buffer = NULL;
+    cache->size = 0;
+    cache->used = 0;
+}
+
+uint32_t SampleCacheBytes(const sample_t * sample, uint16_t attack_ms){
+    uint32_t n = SampleCacheLenght(sample, attack_ms);
+    uint32_t bytes = (sample->format == SAMPLE_ADPCM) ? ADPCM_BYTES(n) : n * sizeof(int16_t);
+    return (bytes + SAMPLE_CACHE_ALIGN - 1) & ~(SAMPLE_CACHE_ALIGN - 1UL);
+}
+
+bool SampleCacheAdd(sample_cache_t * cache, sample_t * sample){
+    uint32_t n = SampleCacheLenght(sample, cache->attack_ms);
+    uint32_t bytes = SampleCacheBytes(sample, cache->attack_ms);
+    if(cache->buffer == NULL || cache->used + bytes > cache->size){
+        return false;
+    }
+    uint8_t * head = &cache->buffer[cache->used];
+    memcpy(head, sample->data, (sample->format == SAMPLE_ADPCM) ? ADPCM_BYTES(n) : n * sizeof(int16_t));
+    cache->used += bytes;
+    sample->head = head;
+    sample->head_lenght = n;
+    return true;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,205 @@
+/**
+ * @file sample_capture.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "sample_capture.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Reverse the samples of buffer[first, last)
+ */
+static void SampleCaptureReverse(int16_t * buffer, uint32_t first, uint32_t last){
+    while(first + 1 < last){
+        int16_t tmp = buffer[first];
+        buffer[first++] = buffer[--last];
+        buffer[last] = tmp;
+    }
+}
+
+/**
+ * @brief Onset: the pre-roll goes in order to the start of the buffer
+ */
+static void SampleCaptureOnset(sample_capture_t * sc){
+    if(sc->pre_full){
+        // rotation in place: the oldest sample (at pos) goes first
+        SampleCaptureReverse(sc->buffer, 0, sc->pos);
+        SampleCaptureReverse(sc->buffer, sc->pos, sc->pre);
+        SampleCaptureReverse(sc->buffer, 0, sc->pre);
+        sc->count = sc->pre;
+    } else {
+        sc->count = sc->pos;
+    }
+    sc->peak = 0;
+    sc->last_loud = sc->count;
+    sc->state = SAMPLE_CAPTURE_RECORDING;
+}
+
+/**
+ * @brief End of the hit: fade out the last release samples and normalize
+ */
+static void SampleCaptureFinish(sample_capture_t * sc){
+    int32_t peak = 0;
+    uint32_t fade = (sc->release < sc->count) ? sc->release : sc->count;
+    for(uint32_t i = 0; i < sc->count; i++){
+        int32_t s = (sc->buffer[i] < 0) ? -sc->buffer[i] : sc->buffer[i];
+        if(s > peak){
+            peak = s;
+        }
+    }
+    int32_t target = (sc->target > 0 && peak > 0) ? sc->target : peak;
+    if(peak == 0){
+        peak = 1;
+    }
+    for(uint32_t i = 0; i < sc->count; i++){
+        // |s| <= peak, so s * target fits in 32 bits and the result in 16
+        int32_t s = sc->buffer[i] * target / peak;
+        uint32_t left = sc->count - i;
+        if(left <= fade){
+            s = s * (int32_t)left / (int32_t)(fade + 1);
+        }
+        sc->buffer[i] = s;
+    }
+    sc->state = SAMPLE_CAPTURE_DONE;
+}
+
+/**
+ * @brief Store a recorded sample (pre-roll or hit)
+ */
+static void SampleCaptureStore(sample_capture_t * sc, float x){
+    int32_t s = x * sc->scale;
+    if(s > INT16_MAX){
+        s = INT16_MAX;
+    } else if(s < -INT16_MAX){
+        s = -INT16_MAX;
+    }
+    if(sc->state == SAMPLE_CAPTURE_WAITING){
+        if(sc->pre == 0){
+            return;
+        }
+        sc->buffer[sc->pos++] = s;
+        if(sc->pos == sc->pre){
+            sc->pos = 0;
+            sc->pre_full = true;
+        }
+        return;
+    }
+    sc->buffer[sc->count++] = s;
+    if(s < 0){
+        s = -s;
+    }
+    if(s > sc->peak){
+        sc->peak = s;
+    }
+    // over end_level of the peak (Q15, both sides under 2^30)
+    if((s << 15) >= sc->peak * sc->end_level){
+        sc->last_loud = sc->count;
+    }
+    if(sc->count - sc->last_loud >= sc->release || sc->count == sc->size){
+        SampleCaptureFinish(sc);
+    }
+}
+/*==================[external functions definition]==========================*/
+bool SampleCaptureInit(sample_capture_t * sc, const sample_capture_config_t * config, int16_t * buffer, uint32_t size){
+    if(buffer == NULL || config->decimation == 0 || !(config->full_scale > 0) || config->pre_ms < 0 ||
+        config->release_ms < 0 || config->end_level < 0 || !(config->end_level < 1) ||
+        config->peak < 0 || config->peak > 1){
+        return false;
+    }
+    float sample_rate = config->sample_frec / config->decimation;
+    uint32_t pre = config->pre_ms * sample_rate / 1000.0f;
+    if(!(sample_rate >= 1) || sample_rate > UINT16_MAX || pre >= size){
+        return false;
+    }
+    sc->buffer = buffer;
+    sc->size = size;
+    sc->scale = INT16_MAX / (config->full_scale * config->decimation);
+    sc->threshold = config->threshold;
+    sc->pre = pre;
+    sc->release = config->release_ms * sample_rate / 1000.0f;
+    if(sc->release == 0){
+        sc->release = 1;
+    }
+    sc->end_level = config->end_level * 32768.0f;
+    sc->target = config->peak * INT16_MAX;
+    sc->sample_rate = sample_rate;
+    sc->decimation = config->decimation;
+    SampleCaptureStop(sc);
+    return true;
+}
+
+void SampleCaptureStart(sample_capture_t * sc){
+    sc->averaged = 0;
+    sc->acc = 0;
+    sc->pos = 0;
+    sc->pre_full = false;
+    sc->count = 0;
+    sc->peak = 0;
+    sc->last_loud = 0;
+    sc->state = SAMPLE_CAPTURE_WAITING;
+}
+
+void SampleCaptureStop(sample_capture_t * sc){
+    SampleCaptureStart(sc);
+    sc->state = SAMPLE_CAPTURE_IDLE;
+}
+
+void SampleCaptureSetThreshold(sample_capture_t * sc, float threshold){
+    sc->threshold = threshold;
+}
+
+sample_capture_state_t SampleCaptureProcess(sample_capture_t * sc, const float * input, uint16_t lenght){
+    for(uint16_t i = 0; i < lenght; i++){
+        if(sc->state != SAMPLE_CAPTURE_WAITING && sc->state != SAMPLE_CAPTURE_RECORDING){
+            break;
+        }
+        float x = input[i];
+        if(sc->state == SAMPLE_CAPTURE_WAITING && (x >= sc->threshold || -x >= sc->threshold)){
+            SampleCaptureOnset(sc);
+        }
+        sc->acc += x;
+        if(++sc->averaged == sc->decimation){
+            SampleCaptureStore(sc, sc->acc);
+            sc->acc = 0;
+            sc->averaged = 0;
+        }
+    }
+    return sc->state;
+}
+
+sample_capture_state_t SampleCaptureState(const sample_capture_t * sc){
+    return sc->state;
+}
+
+bool SampleCaptureGet(const sample_capture_t * sc, sample_t * sample){
+    if(sc->state != SAMPLE_CAPTURE_DONE){
+        return false;
+    }
+    sample->data = sc->buffer;
+    sample->lenght = sc->count;
+    sample->sample_rate = sc->sample_rate;
+    sample->format = SAMPLE_PCM16;
+    sample->name = NULL;
+    sample->head = NULL;
+    sample->head_lenght = 0;
+    return true;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,185 @@
+/**
+ * @file scope_stream.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "scope_stream.h"
+/*==================[macros and definitions]=================================*/
+#define SCOPE_SAMPLE_MASK   0x0FFF  /*!< Bits of a 12 bits sample */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Store a little endian value of n bytes
+ */
+static void ScopePut(uint8_t * p, uint32_t value, uint8_t n){
+    for(uint8_t i = 0; i < n; i++){
+        p[i] = value >> (8 * i);
+    }
+}
+
+/**
+ * @brief Read a little endian value of n bytes
+ */
+static uint32_t ScopeGet(const uint8_t * p, uint8_t n){
+    uint32_t value = 0;
+    for(uint8_t i = 0; i < n; i++){
+        value |= (uint32_t)p[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief 12 bits packing of the samples of every channel, in order (returns the bytes used)
+ */
+static uint16_t ScopePack12(const uint16_t * const * data, uint8_t channels, uint16_t lenght, uint8_t * out){
+    uint16_t n = 0;
+    uint16_t pending = 0;
+    bool odd = false;
+    for(uint8_t ch = 0; ch < channels; ch++){
+        for(uint16_t i = 0; i < lenght; i++){
+            uint16_t s = data[ch][i] & SCOPE_SAMPLE_MASK;
+            if(!odd){
+                pending = s;
+            }
+            else{
+                out[n++] = pending & 0xFF;
+                out[n++] = (pending >> 8) | ((s & 0x0F) << 4);
+                out[n++] = s >> 4;
+            }
+            odd = !odd;
+        }
+    }
+    // odd number of samples: the last one takes 2 bytes
+    if(odd){
+        out[n++] = pending & 0xFF;
+        out[n++] = pending >> 8;
+    }
+    return n;
+}
+
+/**
+ * @brief Delta packing of the samples of one channel (returns the bytes used)
+ */
+static uint16_t ScopePackDelta(const uint16_t * x, uint16_t lenght, uint8_t * out){
+    uint16_t n = 0;
+    for(uint16_t i = 0; i < lenght; i++){
+        int32_t delta = (i > 0) ? (int32_t)x[i] - x[i - 1] : INT32_MAX;
+        // -128 is SCOPE_DELTA_ESCAPE
+        if(delta >= -127 && delta <= 127){
+            out[n++] = (uint8_t)(int8_t)delta;
+        }
+        else{
+            if(i > 0){
+                out[n++] = SCOPE_DELTA_ESCAPE;
+            }
+            ScopePut(&out[n], x[i], 2);
+            n += 2;
+        }
+    }
+    return n;
+}
+/*==================[external functions definition]==========================*/
+void ScopeStreamInit(scope_stream_t * scope, scope_pack_t pack, uint8_t channels){
+    scope->pack = pack;
+    scope->channels = channels;
+    scope->seq = 0;
+}
+
+uint16_t ScopeStreamEncode(scope_stream_t * scope, const uint16_t * const * data, uint16_t lenght,
+                           uint32_t timestamp, uint32_t dropped, uint8_t * output){
+    uint8_t * p = scope->payload;
+    if(lenght == 0 || scope->channels * lenght > SCOPE_MAX_SAMPLES){
+        return 0;
+    }
+    p[0] = scope->seq;
+    p[1] = scope->pack;
+    p[2] = scope->channels;
+    ScopePut(&p[3], lenght, 2);
+    ScopePut(&p[5], timestamp, 4);
+    ScopePut(&p[9], dropped, 4);
+    uint16_t n = SCOPE_HEADER;
+    if(scope->pack == SCOPE_PACK_12BIT){
+        n += ScopePack12(data, scope->channels, lenght, &p[n]);
+    }
+    else{
+        for(uint8_t ch = 0; ch < scope->channels; ch++){
+            n += ScopePackDelta(data[ch], lenght, &p[n]);
+        }
+    }
+    uint16_t crc = TelemetryCRC16(p, n);
+    ScopePut(&p[n], crc, 2);
+    uint16_t frame_lenght = CobsEncode(p, n + 2, output);
+    output[frame_lenght++] = 0x00;
+    scope->seq++;
+    return frame_lenght;
+}
+
+int16_t ScopeStreamUnpack(const uint8_t * payload, uint16_t lenght, uint16_t * const * data){
+    if(lenght < SCOPE_HEADER){
+        return -1;
+    }
+    scope_pack_t pack = payload[1];
+    uint8_t channels = payload[2];
+    uint16_t samples = ScopeGet(&payload[3], 2);
+    uint32_t total = (uint32_t)channels * samples;
+    if(total == 0 || total > SCOPE_MAX_SAMPLES){
+        return -1;
+    }
+    const uint8_t * p = &payload[SCOPE_HEADER];
+    const uint8_t * end = &payload[lenght];
+    if(pack == SCOPE_PACK_12BIT){
+        if(end - p != (3 * total + 1) / 2){
+            return -1;
+        }
+        for(uint32_t k = 0; k < total; k++){
+            uint16_t s = (k & 1) ? ((p[1] >> 4) | (p[2] << 4)) : (p[0] | ((p[1] & 0x0F) << 8));
+            if(k & 1){
+                p += 3;
+            }
+            data[k / samples][k % samples] = s;
+        }
+    }
+    else if(pack == SCOPE_PACK_DELTA){
+        for(uint8_t ch = 0; ch < channels; ch++){
+            for(uint16_t i = 0; i < samples; i++){
+                if(p >= end){
+                    return -1;
+                }
+                if(i == 0 || *p == SCOPE_DELTA_ESCAPE){
+                    p += (i > 0);
+                    if(end - p < 2){
+                        return -1;
+                    }
+                    data[ch][i] = ScopeGet(p, 2);
+                    p += 2;
+                }
+                else{
+                    data[ch][i] = data[ch][i - 1] + (int8_t)*p++;
+                }
+            }
+        }
+        if(p != end){
+            return -1;
+        }
+    }
+    else{
+        return -1;
+    }
+    return samples;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,83 @@
+/**
+ * @file stft.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "stft.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool STFTInit(stft_t * stft, uint16_t frame_lenght, uint16_t hop_lenght, fft_window_t window, float * buffer,
+              void (*func_p)(const float * magnitude, uint16_t bins, void * param), void * param_p){
+    if(hop_lenght == 0 || hop_lenght > frame_lenght){
+        return false;
+    }
+    // buffer: plan (window and work) | history | magnitude
+    if(!FFTPlanInit(&stft->plan, frame_lenght, window, buffer)){
+        return false;
+    }
+    stft->history = &buffer[FFT_PLAN_BUFFER_LENGHT(frame_lenght)];
+    stft->magnitude = &stft->history[frame_lenght];
+    stft->hop_lenght = hop_lenght;
+    stft->func_p = func_p;
+    stft->param_p = param_p;
+    memset(stft->magnitude, 0, (frame_lenght / 2) * sizeof(float));
+    STFTReset(stft);
+    return true;
+}
+
+uint16_t STFTProcess(stft_t * stft, const float * samples, uint16_t lenght){
+    uint16_t frame_lenght = stft->plan.signal_lenght;
+    uint16_t frames = 0;
+    while(lenght > 0){
+        uint16_t n = frame_lenght - stft->fill;
+        if(n > lenght){
+            n = lenght;
+        }
+        memcpy(&stft->history[stft->fill], samples, n * sizeof(float));
+        stft->fill += n;
+        samples += n;
+        lenght -= n;
+        if(stft->fill == frame_lenght){
+            FFTPlanMagnitude(&stft->plan, stft->history, stft->magnitude);
+            stft->frames++;
+            frames++;
+            if(stft->func_p != NULL){
+                stft->func_p(stft->magnitude, frame_lenght / 2, stft->param_p);
+            }
+            // keep the overlapping samples for the next frame
+            memmove(stft->history, &stft->history[stft->hop_lenght], (frame_lenght - stft->hop_lenght) * sizeof(float));
+            stft->fill = frame_lenght - stft->hop_lenght;
+        }
+    }
+    return frames;
+}
+
+const float * STFTGetMagnitude(stft_t * stft){
+    return stft->magnitude;
+}
+
+void STFTReset(stft_t * stft){
+    stft->fill = 0;
+    stft->frames = 0;
+}
+
+/*==================[end of file]============================================*/
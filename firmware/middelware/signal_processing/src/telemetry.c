@@ -0,0 +1,167 @@
+/**
+ * @file telemetry.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "telemetry.h"
+#include "rice_codec.h"
+/*==================[macros and definitions]=================================*/
+#define TELEMETRY_CRC_SIZE      2       /*!< Bytes of the CRC */
+#define COBS_MAX_BLOCK          0xFF    /*!< Code of a block of 254 non zero bytes */
+/*==================[internal data declaration]==============================*/
+/** @brief Bytes of each value type */
+static const uint8_t telemetry_type_size[] = {
+    [TELEMETRY_U8] = 1, [TELEMETRY_I8] = 1, [TELEMETRY_U16] = 2, [TELEMETRY_I16] = 2,
+    [TELEMETRY_U32] = 4, [TELEMETRY_I32] = 4, [TELEMETRY_F32] = 4, [TELEMETRY_I16_RICE] = 2,
+};
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Add a record of compressed int16 values (the frame is full if the block does not fit)
+ */
+static bool TelemetryAddRice(telemetry_t * telemetry, uint8_t channel, const int16_t * values, uint8_t count){
+    uint16_t available = telemetry->max_lenght - telemetry->lenght;
+    if(count == 0 || available <= TELEMETRY_RECORD_HEADER + 1){
+        return false;
+    }
+    uint8_t * record = &telemetry->payload[telemetry->lenght];
+    uint16_t lenght = RiceEncode(values, count, &record[TELEMETRY_RECORD_HEADER + 1], available - TELEMETRY_RECORD_HEADER - 1);
+    if(lenght == 0){
+        return false;
+    }
+    record[0] = channel;
+    record[1] = TELEMETRY_I16_RICE;
+    record[2] = count;
+    record[3] = lenght;
+    telemetry->lenght += TELEMETRY_RECORD_HEADER + 1 + lenght;
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+void TelemetryInit(telemetry_t * telemetry, uint16_t max_lenght){
+    telemetry->max_lenght = (max_lenght > TELEMETRY_MAX_PAYLOAD) ? TELEMETRY_MAX_PAYLOAD : max_lenght;
+    telemetry->seq = 0;
+    telemetry->payload[0] = 0;
+    telemetry->lenght = 1;
+}
+
+uint16_t TelemetryRecordSize(telemetry_type_t type, uint8_t count){
+    if(type == TELEMETRY_I16_RICE){
+        // block bytes and the block (not compressible in the worst case)
+        return TELEMETRY_RECORD_HEADER + 1 + RICE_MAX_LENGHT(count);
+    }
+    return TELEMETRY_RECORD_HEADER + count * telemetry_type_size[type];
+}
+
+bool TelemetryAdd(telemetry_t * telemetry, uint8_t channel, telemetry_type_t type, const void * values, uint8_t count){
+    if(type == TELEMETRY_I16_RICE){
+        return TelemetryAddRice(telemetry, channel, values, count);
+    }
+    uint16_t size = TelemetryRecordSize(type, count);
+    if(count == 0 || telemetry->lenght + size > telemetry->max_lenght){
+        return false;
+    }
+    uint8_t * record = &telemetry->payload[telemetry->lenght];
+    record[0] = channel;
+    record[1] = type;
+    record[2] = count;
+    // little endian target: the values are copied as they are in memory
+    memcpy(&record[TELEMETRY_RECORD_HEADER], values, size - TELEMETRY_RECORD_HEADER);
+    telemetry->lenght += size;
+    return true;
+}
+
+uint16_t TelemetryEncode(telemetry_t * telemetry, uint8_t * output){
+    uint16_t n = telemetry->lenght;
+    if(n <= 1){
+        return 0;
+    }
+    uint16_t crc = TelemetryCRC16(telemetry->payload, n);
+    telemetry->payload[n] = crc & 0xFF;
+    telemetry->payload[n + 1] = crc >> 8;
+    uint16_t lenght = CobsEncode(telemetry->payload, n + TELEMETRY_CRC_SIZE, output);
+    output[lenght++] = 0x00;
+    // next frame
+    telemetry->seq++;
+    telemetry->payload[0] = telemetry->seq;
+    telemetry->lenght = 1;
+    return lenght;
+}
+
+int16_t TelemetryDecode(const uint8_t * frame, uint16_t lenght, uint8_t * payload){
+    int16_t n = CobsDecode(frame, lenght, payload);
+    if(n <= TELEMETRY_CRC_SIZE){
+        return -1;
+    }
+    n -= TELEMETRY_CRC_SIZE;
+    uint16_t crc = payload[n] | (payload[n + 1] << 8);
+    return (TelemetryCRC16(payload, n) == crc) ? n : -1;
+}
+
+uint16_t TelemetryCRC16(const uint8_t * data, uint16_t lenght){
+    uint16_t crc = 0xFFFF;
+    for(uint16_t i = 0; i < lenght; i++){
+        // byte-wise CRC-CCITT without table
+        uint8_t x = (crc >> 8) ^ data[i];
+        x ^= x >> 4;
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x;
+    }
+    return crc;
+}
+
+uint16_t CobsEncode(const uint8_t * input, uint16_t lenght, uint8_t * output){
+    uint16_t code_pos = 0;
+    uint16_t out = 1;
+    uint8_t code = 1;
+    for(uint16_t i = 0; i < lenght; i++){
+        if(input[i] == 0){
+            output[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        }
+        else{
+            output[out++] = input[i];
+            if(++code == COBS_MAX_BLOCK){
+                output[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+    output[code_pos] = code;
+    return out;
+}
+
+int16_t CobsDecode(const uint8_t * input, uint16_t lenght, uint8_t * output){
+    uint16_t i = 0;
+    int16_t out = 0;
+    while(i < lenght){
+        uint8_t code = input[i++];
+        if(code == 0 || i + code - 1 > lenght){
+            return -1;
+        }
+        for(uint8_t k = 1; k < code; k++){
+            output[out++] = input[i++];
+        }
+        // every block but the last one and the 254 bytes blocks ends with a zero
+        if(code < COBS_MAX_BLOCK && i < lenght){
+            output[out++] = 0;
+        }
+    }
+    return out;
+}
+
+/*==================[end of file]============================================*/
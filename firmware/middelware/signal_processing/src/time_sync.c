@@ -0,0 +1,156 @@
+/**
+ * @file time_sync.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "time_sync.h"
+/*==================[macros and definitions]=================================*/
+#define PPB     1000000000LL    /*!< Parts per billion */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Offset of the model at a local time (us)
+ */
+static int64_t TimeSyncModel(const time_sync_t * sync, int64_t local){
+    return sync->ref_offset + (local - sync->ref_local) * sync->skew_ppb / PPB;
+}
+
+/**
+ * @brief Forget the beacons
+ */
+static void TimeSyncReset(time_sync_t * sync){
+    sync->count = 0;
+    sync->head = 0;
+    sync->rejected = 0;
+    sync->locked = false;
+}
+
+/**
+ * @brief Least squares slope of the beacons of the window (only the ones over the line of slope/intercept if select)
+ */
+static double TimeSyncSlope(const time_sync_t * sync, bool select, double slope, double intercept, double * mean_x, double * mean_y){
+    uint8_t first = (sync->head + TIME_SYNC_WINDOW - sync->count) % TIME_SYNC_WINDOW;
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+    // relative to the oldest beacon: small values, exact in double
+    for(uint8_t i = 0; i < sync->count; i++){
+        uint8_t j = (first + i) % TIME_SYNC_WINDOW;
+        double x = sync->local[j] - sync->local[first];
+        double y = sync->offset[j] - sync->offset[first];
+        if(select && y < intercept + slope * x){
+            continue;
+        }
+        n++;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    double den = n * sxx - sx * sx;
+    *mean_x = sx / n;
+    *mean_y = sy / n;
+    return (den > 0) ? (n * sxy - sx * sy) / den : 0;
+}
+
+/**
+ * @brief Fit the model to the beacons of the window
+ */
+static void TimeSyncFit(time_sync_t * sync){
+    uint8_t first = (sync->head + TIME_SYNC_WINDOW - sync->count) % TIME_SYNC_WINDOW;
+    uint8_t last = (sync->head + TIME_SYNC_WINDOW - 1) % TIME_SYNC_WINDOW;
+    int64_t x0 = sync->local[first];
+    int64_t y0 = sync->offset[first];
+    double mean_x, mean_y;
+    double slope = TimeSyncSlope(sync, false, 0, 0, &mean_x, &mean_y);
+    // again with the beacons less delayed than the mean: the jitter of the delay is smaller
+    slope = TimeSyncSlope(sync, true, slope, mean_y - slope * mean_x, &mean_x, &mean_y);
+    // the line through the beacon with the least delay (the delays only lower the offset)
+    double top = -INFINITY;
+    for(uint8_t i = 0; i < sync->count; i++){
+        uint8_t j = (first + i) % TIME_SYNC_WINDOW;
+        double residual = (sync->offset[j] - y0) - slope * (sync->local[j] - x0);
+        if(residual > top){
+            top = residual;
+        }
+    }
+    sync->ref_local = sync->local[last];
+    sync->ref_offset = y0 + llround(top + slope * (sync->local[last] - x0));
+    sync->skew_ppb = lround(slope * PPB);
+}
+
+/*==================[external functions definition]==========================*/
+void TimeSyncInit(time_sync_t * sync, uint32_t max_delay_us){
+    sync->max_delay_us = max_delay_us;
+    sync->ref_local = 0;
+    sync->ref_offset = 0;
+    sync->skew_ppb = 0;
+    TimeSyncReset(sync);
+}
+
+bool TimeSyncUpdate(time_sync_t * sync, uint64_t local_us, uint64_t master_us){
+    int64_t local = local_us;
+    int64_t offset = (int64_t)(master_us - local_us);
+    if(sync->locked){
+        int64_t residual = offset - TimeSyncModel(sync, local);
+        if(residual < -(int64_t)sync->max_delay_us || residual > (int64_t)sync->max_delay_us){
+            if(++sync->rejected < TIME_SYNC_WINDOW / 2){
+                return false;
+            }
+            // too many in a row: the master restarted or its clock was set
+            TimeSyncReset(sync);
+        }
+    }
+    sync->rejected = 0;
+    sync->local[sync->head] = local;
+    sync->offset[sync->head] = offset;
+    sync->head = (sync->head + 1) % TIME_SYNC_WINDOW;
+    if(sync->count < TIME_SYNC_WINDOW){
+        sync->count++;
+    }
+    if(sync->count >= TIME_SYNC_MIN_BEACONS){
+        TimeSyncFit(sync);
+        sync->locked = true;
+    }
+    return true;
+}
+
+bool TimeSyncLocked(const time_sync_t * sync){
+    return sync->locked;
+}
+
+uint64_t TimeSyncToMaster(const time_sync_t * sync, uint64_t local_us){
+    if(!sync->locked){
+        return local_us;
+    }
+    return local_us + TimeSyncModel(sync, local_us);
+}
+
+uint64_t TimeSyncToLocal(const time_sync_t * sync, uint64_t master_us){
+    if(!sync->locked){
+        return master_us;
+    }
+    // local = master - offset(local): two iterations (the skew is a few ppm)
+    int64_t local = master_us - sync->ref_offset;
+    local = master_us - TimeSyncModel(sync, local);
+    return master_us - TimeSyncModel(sync, local);
+}
+
+int32_t TimeSyncSkew(const time_sync_t * sync){
+    return sync->skew_ppb;
+}
+
+/*==================[end of file]============================================*/
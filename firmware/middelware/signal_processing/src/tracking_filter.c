@@ -0,0 +1,113 @@
+/**
+ * @file tracking_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "tracking_filter.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool Kalman1DInit(kalman_1d_t * kf, float process_var, float noise_var){
+    if(!(process_var > 0) || !(noise_var > 0)){
+        return false;
+    }
+    kf->process_var = process_var;
+    kf->noise_var = noise_var;
+    Kalman1DReset(kf);
+    return true;
+}
+
+float Kalman1DUpdate(kalman_1d_t * kf, float z){
+    if(!kf->started){
+        kf->x = z;
+        kf->p = kf->noise_var;
+        kf->started = true;
+        return z;
+    }
+    float p = kf->p + kf->process_var;
+    float k = p / (p + kf->noise_var);
+    kf->x += k * (z - kf->x);
+    kf->p = (1.0f - k) * p;
+    return kf->x;
+}
+
+float Kalman1DValue(const kalman_1d_t * kf){
+    return kf->x;
+}
+
+float Kalman1DVariance(const kalman_1d_t * kf){
+    return kf->p;
+}
+
+void Kalman1DReset(kalman_1d_t * kf){
+    kf->x = 0;
+    kf->p = 0;
+    kf->started = false;
+}
+
+bool AlphaBetaInit(alpha_beta_t * ab, float alpha, float beta, float dt){
+    if(!(alpha > 0) || alpha > 1 || beta < 0 || !(beta < 4 - 2 * alpha) || !(dt > 0)){
+        return false;
+    }
+    ab->alpha = alpha;
+    ab->beta = beta;
+    ab->dt = dt;
+    AlphaBetaReset(ab);
+    return true;
+}
+
+bool AlphaBetaInitNoise(alpha_beta_t * ab, float accel_std, float noise_std, float dt){
+    if(!(accel_std > 0) || !(noise_std > 0) || !(dt > 0)){
+        return false;
+    }
+    // tracking index and the steady gains of the Kalman filter (Kalata)
+    float lambda = accel_std * dt * dt / noise_std;
+    float r = (4.0f + lambda - sqrtf(8.0f * lambda + lambda * lambda)) / 4.0f;
+    float alpha = 1.0f - r * r;
+    float beta = 2.0f * (2.0f - alpha) - 4.0f * sqrtf(1.0f - alpha);
+    return AlphaBetaInit(ab, alpha, beta, dt);
+}
+
+float AlphaBetaUpdate(alpha_beta_t * ab, float z){
+    if(!ab->started){
+        ab->x = z;
+        ab->v = 0;
+        ab->started = true;
+        return z;
+    }
+    float x = ab->x + ab->v * ab->dt;
+    float residual = z - x;
+    ab->x = x + ab->alpha * residual;
+    ab->v += ab->beta * residual / ab->dt;
+    return ab->x;
+}
+
+float AlphaBetaRate(const alpha_beta_t * ab){
+    return ab->v;
+}
+
+void AlphaBetaReset(alpha_beta_t * ab){
+    ab->x = 0;
+    ab->v = 0;
+    ab->started = false;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,115 @@
+/**
+ * @file velocity_curve.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "velocity_curve.h"
+#include "fast_math.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Entry of a velocity (not rounded, 1 to VELOCITY_CURVE_MAX_VELOCITY)
+ */
+static velocity_entry_t VelocityCurveEntry(float velocity){
+    if(velocity < 1){
+        velocity = 1;
+    }else if(velocity > VELOCITY_CURVE_MAX_VELOCITY){
+        velocity = VELOCITY_CURVE_MAX_VELOCITY;
+    }
+    velocity_entry_t entry = {
+        .gain = (int16_t)lrintf(velocity * VELOCITY_CURVE_GAIN_ONE / VELOCITY_CURVE_MAX_VELOCITY),
+        .velocity = (uint8_t)lrintf(velocity),
+    };
+    return entry;
+}
+
+/**
+ * @brief Range of peaks of the table
+ */
+static bool VelocityCurveRange(velocity_curve_t * curve, float threshold, float max_level){
+    if(threshold < 0 || max_level <= threshold){
+        return false;
+    }
+    curve->threshold = threshold;
+    curve->scale = (VELOCITY_CURVE_SIZE - 1) / (max_level - threshold);
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool VelocityCurveInit(velocity_curve_t * curve, velocity_curve_type_t type, float shape, float threshold, float max_level){
+    if(type == VELOCITY_CURVE_CUSTOM || (type != VELOCITY_CURVE_LINEAR && !(shape > 0)) ||
+        !VelocityCurveRange(curve, threshold, max_level)){
+        return false;
+    }
+    float log_norm = 1.0f / FastLog2f(1.0f + shape);
+    float exp_norm = 1.0f / (FastExpf(shape) - 1.0f);
+    for(uint16_t i = 0; i < VELOCITY_CURVE_SIZE; i++){
+        float x = (float)i / (VELOCITY_CURVE_SIZE - 1);
+        float y;
+        switch(type){
+        case VELOCITY_CURVE_LOG:
+            y = FastLog2f(1.0f + shape * x) * log_norm;
+            break;
+        case VELOCITY_CURVE_EXP:
+            y = (FastExpf(shape * x) - 1.0f) * exp_norm;
+            break;
+        case VELOCITY_CURVE_POWER:
+            y = FastPowf(x, shape);
+            break;
+        default:
+            y = x;
+            break;
+        }
+        curve->table[i] = VelocityCurveEntry(1.0f + (VELOCITY_CURVE_MAX_VELOCITY - 1) * y);
+    }
+    return true;
+}
+
+bool VelocityCurveInitCustom(velocity_curve_t * curve, const uint8_t * points, uint8_t n_points, float threshold, float max_level){
+    if(n_points < 2 || n_points > VELOCITY_CURVE_MAX_POINTS || !VelocityCurveRange(curve, threshold, max_level)){
+        return false;
+    }
+    for(uint8_t i = 0; i < n_points; i++){
+        if(points[i] < 1 || points[i] > VELOCITY_CURVE_MAX_VELOCITY){
+            return false;
+        }
+    }
+    for(uint16_t i = 0; i < VELOCITY_CURVE_SIZE; i++){
+        // position between the points
+        float pos = (float)i * (n_points - 1) / (VELOCITY_CURVE_SIZE - 1);
+        uint8_t seg = (uint8_t)pos;
+        if(seg >= n_points - 1){
+            seg = n_points - 2;
+        }
+        float frac = pos - seg;
+        curve->table[i] = VelocityCurveEntry(points[seg] + (points[seg + 1] - points[seg]) * frac);
+    }
+    return true;
+}
+
+velocity_entry_t VelocityCurveLookup(const velocity_curve_t * curve, float peak){
+    float pos = (peak - curve->threshold) * curve->scale + 0.5f;
+    if(!(pos > 0)){
+        return curve->table[0];
+    }
+    return curve->table[(pos >= VELOCITY_CURVE_SIZE - 1) ? VELOCITY_CURVE_SIZE - 1 : (uint16_t)pos];
+}
+
+/*==================[end of file]============================================*/
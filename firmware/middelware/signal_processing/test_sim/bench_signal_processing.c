@@ -0,0 +1,240 @@
+/**
+ * @file bench_signal_processing.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Host benchmarks of the signal_processing middleware
+ *
+ * Same measurements as examples/ej_dsp_benchmark, timed with the host clock
+ * (esp_cpu_get_cycle_count() of include_sim returns nanoseconds). Each
+ * measurement is the best of BENCH_REPS runs.
+ *
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "test_sim.h"
+#include "esp_cpu.h"
+#include "esp_dsp.h"
+#include "fft.h"
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "goertzel.h"
+#include "imu_fusion.h"
+#include "qrs_detector.h"
+#include "fast_conv.h"
+#include "pipeline.h"
+#include "small_matrix.h"
+/*==================[macros and definitions]=================================*/
+#define BENCH_REPS          5           /*!< Repetitions of each measurement */
+#define FILTER_LENGHT       1024        /*!< Samples filtered on each measurement */
+#define FIR_MAX_TAPS        64          /*!< Max taps of the FIR filters */
+#define SAMPLE_FREQ         1000
+#define IMU_FRAMES          100         /*!< IMU frames processed on each measurement */
+#define PIPE_BLOCK          64          /*!< Samples of each block of the pipeline */
+/** @brief Run 'code' BENCH_REPS times and store the best time (ns) in 'best' */
+#define BENCH_RUN(best, code)                                       \
+    do {                                                            \
+        best = UINT32_MAX;                                          \
+        for(uint8_t rep = 0; rep < BENCH_REPS; rep++){              \
+            uint32_t start = esp_cpu_get_cycle_count();             \
+            code;                                                   \
+            uint32_t ns = esp_cpu_get_cycle_count() - start;        \
+            if(ns < best){                                          \
+                best = ns;                                          \
+            }                                                       \
+        }                                                           \
+    } while(0)
+/*==================[internal data declaration]==============================*/
+static float signal[2 * MAX_SIGNAL_LENGHT];
+static float output[2 * MAX_SIGNAL_LENGHT];
+static float conv_work[2 * MAX_SIGNAL_LENGHT];
+static float kernel[FIR_MAX_TAPS];
+static float fir_delay[FIR_DELAY_LENGHT(FIR_MAX_TAPS)];
+static float fir_delay_dec[FIR_DECIMATOR_DELAY_LENGHT(FIR_MAX_TAPS)];
+static int16_t kernel_q15[FIR_MAX_TAPS];
+static int16_t fir_delay_q15[2 * FIR_MAX_TAPS];
+static uint16_t signal_adc[2 * MAX_SIGNAL_LENGHT];
+static uint16_t output_adc[MAX_SIGNAL_LENGHT];
+static int16_t output_q15[FILTER_LENGHT];
+static int32_t output_q31[FILTER_LENGHT];
+static imu_frame_t imu_frames[IMU_FRAMES];
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Print a row of the results table
+ */
+static void BenchPrint(const char * name, uint16_t n, uint16_t param, uint32_t ns){
+    printf("| %-18s | %5u | %5u | %10lu | %8.2f |\n", name, n, param, (unsigned long)ns, (float)ns / n);
+}
+/**
+ * @brief Pipeline sink that only reads the block
+ */
+static bool BenchSink(void * ctx, pipeline_block_t * in, pipeline_block_t * out){
+    (void)out;
+    *(float *)ctx += in->data[0];
+    return true;
+}
+
+/**
+ * @brief Push FILTER_LENGHT samples through a pipeline in blocks of PIPE_BLOCK
+ */
+static void BenchPipeline(pipeline_stage_t * source, pipeline_pool_t * pool){
+    for(uint16_t pos = 0; pos < FILTER_LENGHT; pos += PIPE_BLOCK){
+        pipeline_block_t * block = PipelineAlloc(pool);
+        memcpy(block->data, &signal[pos], PIPE_BLOCK * sizeof(float));
+        block->lenght = PIPE_BLOCK;
+        PipelinePush(source, block);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void BenchSignalProcessing(const float * capture, uint16_t lenght){
+    uint32_t best;
+    static iir_filter_t iir;
+    static iir_filter_q31_t iir_q31;
+    fir_f32_t fir;
+    fir_filter_q15_t fir_q15;
+    goertzel_t goertzel;
+    const float freqs[GOERTZEL_MAX_BINS] = {50, 100, 150, 200, 250, 300, 350, 400};
+    float power[GOERTZEL_MAX_BINS];
+
+    // the capture is repeated to fill the test signals
+    for(uint16_t i = 0; i < 2 * MAX_SIGNAL_LENGHT; i++){
+        signal[i] = capture[i % lenght];
+        signal_adc[i] = (uint16_t)capture[i % lenght];
+    }
+    for(uint8_t i = 0; i < FIR_MAX_TAPS; i++){
+        kernel[i] = 1.0f / FIR_MAX_TAPS;
+    }
+    FIRFilterCoeffsToQ15(kernel, kernel_q15, FIR_MAX_TAPS);
+    FFTInit();
+    FFTQ15Init();
+
+    printf("| %-18s | %5s | %5s | %10s | %8s |\n", "Function", "N", "Param", "Time ns", "ns/sample");
+    printf("|:-------------------|------:|------:|-----------:|---------:|\n");
+    for(uint16_t n = 64; n <= MAX_SIGNAL_LENGHT; n *= 2){
+        BENCH_RUN(best, FFTMagnitude(signal, output, n));
+        BenchPrint("FFTMagnitude", n, 0, best);
+    }
+    for(uint16_t n = 64; n <= MAX_SIGNAL_LENGHT; n *= 2){
+        BENCH_RUN(best, FFTMagnitudeQ15(signal_adc, 2048, output_adc, n));
+        BenchPrint("FFTMagnitudeQ15", n, 0, best);
+    }
+    for(uint8_t order = ORDER_2; order <= ORDER_8; order += 2){
+        LowPassInit(SAMPLE_FREQ, 40, order);
+        BENCH_RUN(best, LowPassFilter(signal, output, FILTER_LENGHT));
+        BenchPrint("LowPassFilter", FILTER_LENGHT, order, best);
+    }
+    for(uint8_t order = ORDER_2; order <= ORDER_8; order += 2){
+        IIRFilterLowPassInit(&iir, SAMPLE_FREQ, 40, order);
+        IIRFilterQ31Init(&iir_q31, &iir);
+        BENCH_RUN(best, IIRFilterQ31ProcessU16(&iir_q31, signal_adc, output_q31, FILTER_LENGHT));
+        BenchPrint("IIRFilterQ31", FILTER_LENGHT, order, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        dsps_fir_init_f32(&fir, kernel, fir_delay, taps);
+        BENCH_RUN(best, dsps_fir_f32(&fir, signal, output, FILTER_LENGHT));
+        BenchPrint("dsps_fir_f32", FILTER_LENGHT, taps, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        FIRFilterQ15Init(&fir_q15, kernel_q15, fir_delay_q15, taps);
+        BENCH_RUN(best, FIRFilterQ15ProcessU16(&fir_q15, signal_adc, output_q15, FILTER_LENGHT, 2048));
+        BenchPrint("FIRFilterQ15", FILTER_LENGHT, taps, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        fir_decimator_t decimator;
+        FIRDecimatorInit(&decimator, kernel, fir_delay_dec, taps, 4);
+        BENCH_RUN(best, FIRDecimatorProcess(&decimator, signal, output, FILTER_LENGHT));
+        BenchPrint("FIRDecimator (/4)", FILTER_LENGHT, taps, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        BENCH_RUN(best, dsps_conv_f32(signal, FILTER_LENGHT, kernel, taps, output));
+        BenchPrint("dsps_conv_f32", FILTER_LENGHT, taps, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        BENCH_RUN(best, FastConvolve(signal, FILTER_LENGHT, kernel, taps, output, conv_work));
+        BenchPrint("FastConvolve", FILTER_LENGHT, taps, best);
+    }
+    for(uint16_t taps = 16; taps <= FIR_MAX_TAPS; taps *= 2){
+        static float conv_buffer[FAST_CONV_BUFFER_LENGHT(4 * FIR_MAX_TAPS)];
+        fast_conv_t conv;
+        FastConvInit(&conv, kernel, taps, 4 * taps, conv_buffer);
+        BENCH_RUN(best, FastConvProcess(&conv, signal, output, FILTER_LENGHT));
+        BenchPrint("FastConvProcess", FILTER_LENGHT, taps, best);
+    }
+    GoertzelInit(&goertzel, SAMPLE_FREQ * 8, freqs, GOERTZEL_MAX_BINS, FILTER_LENGHT);
+    BENCH_RUN(best, GoertzelBlock(&goertzel, signal, FILTER_LENGHT, power));
+    BenchPrint("GoertzelBlock", FILTER_LENGHT, GOERTZEL_MAX_BINS, best);
+    // the DCT of n points reads the twiddle table (CONFIG_DSP_MAX_FFT_SIZE floats) up to 4 * n
+    for(uint16_t n = 64; n <= CONFIG_DSP_MAX_FFT_SIZE / 4; n *= 2){
+        memcpy(output, signal, 2 * n * sizeof(float));
+        BENCH_RUN(best, dsps_dct_f32(output, n));
+        BenchPrint("dsps_dct_f32", n, 0, best);
+    }
+    // fixed size kernels against the generic product (Param = matrix size)
+    {
+        float * a = signal, * b = &signal[13 * 13], * c = output;
+        BENCH_RUN(best, dspm_mult_f32(a, b, c, 3, 3, 3));
+        BenchPrint("dspm_mult_f32", 1, 3, best);
+        BENCH_RUN(best, SmallMatMul3(a, b, c));
+        BenchPrint("SmallMatMul3", 1, 3, best);
+        BENCH_RUN(best, dspm_mult_f32(a, b, c, 4, 4, 4));
+        BenchPrint("dspm_mult_f32", 1, 4, best);
+        BENCH_RUN(best, SmallMatMul4(a, b, c));
+        BenchPrint("SmallMatMul4", 1, 4, best);
+        BENCH_RUN(best, dspm_mult_f32(a, b, c, 13, 13, 13));
+        BenchPrint("dspm_mult_f32", 1, 13, best);
+        BENCH_RUN(best, SmallMatMul13(a, b, c));
+        BenchPrint("SmallMatMul13", 1, 13, best);
+        BENCH_RUN(best, SmallMatSymABAt13(a, b, conv_work, c));
+        BenchPrint("SmallMatSymABAt13", 1, 13, best);
+    }
+    // IMU almost horizontal, slowly rotating (Param = mode)
+    for(uint16_t i = 0; i < IMU_FRAMES; i++){
+        imu_frames[i].accel[0] = (int16_t)(signal_adc[i] - 2048);
+        imu_frames[i].accel[1] = (int16_t)(signal_adc[i + IMU_FRAMES] - 2048);
+        imu_frames[i].accel[2] = 16384;
+        imu_frames[i].gyro[0] = imu_frames[i].accel[0] / 10;
+        imu_frames[i].gyro[1] = imu_frames[i].accel[1] / 10;
+        imu_frames[i].gyro[2] = 131;
+    }
+    for(uint8_t mode = IMU_FUSION_MAHONY; mode <= IMU_FUSION_EKF; mode++){
+        imu_fusion_config_t config = {mode, 100, 10, 16384, 131, 0};
+        imu_fusion_t fusion;
+        if(ImuFusionInit(&fusion, &config)){
+            BENCH_RUN(best, ImuFusionProcess(&fusion, imu_frames, IMU_FRAMES, NULL, 0));
+            BenchPrint("ImuFusionProcess", IMU_FRAMES, mode, best);
+            ImuFusionDeinit(&fusion);
+        }
+    }
+    // ECG rate (the capture is an ECG at 200 Hz)
+    qrs_detector_config_t qrs_config = {.sample_frec = 200, .window_time = 150, .refractory_time = 200, .learn_time = 2000};
+    qrs_detector_t qrs;
+    QRSDetectorInit(&qrs, &qrs_config);
+    BENCH_RUN(best, QRSDetectorProcess(&qrs, signal, FILTER_LENGHT, NULL, 0));
+    BenchPrint("QRSDetectorProcess", FILTER_LENGHT, 0, best);
+    // pipeline: raw and low pass filtered blocks to two sinks (Param = block lenght)
+    static float pool_buffer[PIPELINE_POOL_BUFFER_LENGHT(PIPE_BLOCK, 4)];
+    static iir_filter_t pipe_iir;
+    float sink_sum = 0;
+    pipeline_pool_t pool;
+    pipeline_stage_t source, raw, filter, filtered;
+    IIRFilterLowPassInit(&pipe_iir, SAMPLE_FREQ, 40, 4);
+    PipelinePoolInit(&pool, PIPE_BLOCK, 4, pool_buffer);
+    PipelineStageInit(&source, PIPELINE_IN_PLACE, NULL, NULL, NULL);
+    PipelineStageInit(&raw, PIPELINE_SINK, BenchSink, &sink_sum, NULL);
+    PipelineStageInit(&filter, PIPELINE_IN_PLACE, PipelineIIRStage, &pipe_iir, &pool);
+    PipelineStageInit(&filtered, PIPELINE_SINK, BenchSink, &sink_sum, NULL);
+    PipelineConnect(&source, &raw);
+    PipelineConnect(&source, &filter);
+    PipelineConnect(&filter, &filtered);
+    BENCH_RUN(best, BenchPipeline(&source, &pool));
+    BenchPrint("Pipeline (IIR)", FILTER_LENGHT, PIPE_BLOCK, best);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,77 @@
+// Host simulation of the flash partitions (include_sim/esp_partition.h): one data
+// partition in RAM, erased at start
+
+#include <string.h>
+#include "esp_partition.h"
+
+static uint8_t flash[SIM_PARTITION_SIZE];
+static int erased = 0;
+
+static const esp_partition_t partition = {
+    .address = 0x110000,
+    .size = SIM_PARTITION_SIZE,
+    .erase_size = SIM_PARTITION_SECTOR,
+    .label = SIM_PARTITION_LABEL,
+};
+
+static int InRange(const esp_partition_t * p, size_t offset, size_t size){
+    return p == &partition && offset <= p->size && size <= p->size - offset;
+}
+
+void esp_partition_sim_erase(void){
+    memset(flash, 0xFF, sizeof(flash));
+    erased = 1;
+}
+
+const esp_partition_t * esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char * label){
+    (void)subtype;
+    if(type != ESP_PARTITION_TYPE_DATA || label == NULL || strcmp(label, SIM_PARTITION_LABEL) != 0){
+        return NULL;
+    }
+    if(!erased){
+        esp_partition_sim_erase();
+    }
+    return &partition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t * p, size_t src_offset, void * dst, size_t size){
+    if(!InRange(p, src_offset, size)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(dst, &flash[src_offset], size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t * p, size_t dst_offset, const void * src, size_t size){
+    const uint8_t * bytes = src;
+    if(!InRange(p, dst_offset, size)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    for(size_t i = 0; i < size; i++){
+        flash[dst_offset + i] &= bytes[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t * p, size_t offset, size_t size){
+    if(!InRange(p, offset, size) || offset % SIM_PARTITION_SECTOR || size % SIM_PARTITION_SECTOR){
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&flash[offset], 0xFF, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t * p, size_t offset, size_t size,
+    esp_partition_mmap_memory_t memory, const void ** out_ptr, esp_partition_mmap_handle_t * out_handle){
+    (void)memory;
+    if(!InRange(p, offset, size)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_ptr = &flash[offset];
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle){
+    (void)handle;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file iir_const_lp.h
+ * @brief Low pass Butterworth filter, order 4, 40 Hz at 200 Hz (2 sections)
+ *
+ * Generated by iir_design.py (signal_processing/tools), do not edit:
+ *     python3 iir_design.py iir_const_lp lowpass 200 40 --order 4 -o iir_const_lp.h
+ */
+
+#ifndef IIR_CONST_LP_H_
+#define IIR_CONST_LP_H_
+
+#include "iir_filter.h"
+
+#define IIR_CONST_LP_SECTIONS   2   /*!< 2nd order sections */
+
+/** Sections coefficients: b0, b1, b2, a1, a2 */
+static const float iir_const_lp_coeffs[IIR_CONST_LP_SECTIONS][IIR_SOS_COEFFS] = {
+    {2.533015125e-01f, 5.066030251e-01f, 2.533015125e-01f, -4.531195207e-01f, 4.663255708e-01f},
+    {1.839029944e-01f, 3.678059888e-01f, 1.839029944e-01f, -3.289756774e-01f, 6.458765492e-02f},
+};
+
+/**
+ * @brief Filter one sample (direct form II transposed, sections unrolled)
+ * 
+ * @param delay         Delay lines of the sections (zeroed: filter at rest)
+ * @param x             Input sample
+ * @return Filtered sample
+ */
+static inline float IirConstLpStep(float delay[IIR_CONST_LP_SECTIONS][2], float x){
+    IIR_SECTION_STEP(iir_const_lp_coeffs[0], delay[0], x);
+    IIR_SECTION_STEP(iir_const_lp_coeffs[1], delay[1], x);
+    return x;
+}
+
+/**
+ * @brief Apply the filter to a signal array
+ * 
+ * @param delay             Delay lines of the sections
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input)
+ * @param signal_lenght     Number of samples of both signals
+ */
+static inline void IirConstLpProcess(float delay[IIR_CONST_LP_SECTIONS][2], const float * input_signal, float * output_signal, int16_t signal_lenght){
+    for(int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = IirConstLpStep(delay, input_signal[i]);
+    }
+}
+
+#endif /* IIR_CONST_LP_H_ */
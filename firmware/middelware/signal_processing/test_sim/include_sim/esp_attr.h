@@ -0,0 +1,9 @@
+// Host simulation replacement of esp_attr.h: code and data placement attributes are ignored
+
+#ifndef _esp_attr_h_
+#define _esp_attr_h_
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif // _esp_attr_h_
@@ -0,0 +1,16 @@
+// Host simulation replacement of esp_cpu.h: the cycle counter is emulated with a nanoseconds clock
+
+#ifndef _esp_cpu_h_
+#define _esp_cpu_h_
+
+#include <stdint.h>
+#include <time.h>
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+#endif // _esp_cpu_h_
@@ -0,0 +1,14 @@
+// Host simulation replacement of esp_log.h: errors and warnings go to stderr, the rest is discarded
+
+#ifndef _esp_log_h_
+#define _esp_log_h_
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...)  fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)
+#define ESP_LOGD(tag, format, ...)
+#define ESP_LOGV(tag, format, ...)
+
+#endif // _esp_log_h_
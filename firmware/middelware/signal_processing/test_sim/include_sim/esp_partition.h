@@ -0,0 +1,55 @@
+// Host simulation replacement of esp_partition.h: a single data partition ("samples") in RAM,
+// erased at start, with the erase and write rules of a NOR flash (see esp_partition_sim.c)
+
+#ifndef _esp_partition_h_
+#define _esp_partition_h_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define SIM_PARTITION_LABEL     "samples"
+#define SIM_PARTITION_SIZE      0x10000
+#define SIM_PARTITION_SECTOR    0x1000
+
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef enum {
+    ESP_PARTITION_MMAP_DATA,
+    ESP_PARTITION_MMAP_INST,
+} esp_partition_mmap_memory_t;
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+    uint32_t erase_size;
+    char label[17];
+} esp_partition_t;
+
+const esp_partition_t * esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char * label);
+
+esp_err_t esp_partition_read(const esp_partition_t * partition, size_t src_offset, void * dst, size_t size);
+
+// Bits can only go from 1 to 0 (the result is the AND with the erased content)
+esp_err_t esp_partition_write(const esp_partition_t * partition, size_t dst_offset, const void * src, size_t size);
+
+esp_err_t esp_partition_erase_range(const esp_partition_t * partition, size_t offset, size_t size);
+
+esp_err_t esp_partition_mmap(const esp_partition_t * partition, size_t offset, size_t size,
+    esp_partition_mmap_memory_t memory, const void ** out_ptr, esp_partition_mmap_handle_t * out_handle);
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle);
+
+// Erase the whole partition (i.e. between tests)
+void esp_partition_sim_erase(void);
+
+#endif // _esp_partition_h_
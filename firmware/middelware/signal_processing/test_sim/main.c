@@ -0,0 +1,86 @@
+/**
+ * @file main.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Host simulation entry point
+ *
+ * Usage: test_signal_processing [test|bench|all] [capture.txt]
+ *
+ * The capture file holds one sample per line (ADC counts, i.e. the values
+ * printed by the ESP-IDF monitor); lines starting with '#' are ignored.
+ *
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "test_sim.h"
+/*==================[macros and definitions]=================================*/
+#define SYNTH_LENGHT    1024    /*!< Samples of the synthetic capture used without a file */
+/*==================[internal data declaration]==============================*/
+static float capture[CAPTURE_MAX_LENGHT];
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Read a capture file (one sample per line)
+ */
+static uint16_t CaptureLoad(const char * path){
+    FILE * file = fopen(path, "r");
+    char line[64];
+    uint16_t lenght = 0;
+    if(file == NULL){
+        return 0;
+    }
+    while(lenght < CAPTURE_MAX_LENGHT && fgets(line, sizeof(line), file) != NULL){
+        if(line[0] == '#'){
+            continue;
+        }
+        capture[lenght++] = strtof(line, NULL);
+    }
+    fclose(file);
+    return lenght;
+}
+
+/**
+ * @brief Synthetic 12 bits capture (two tones plus noise) when no file is given
+ */
+static uint16_t CaptureSynth(void){
+    srand(1);
+    for(uint16_t i = 0; i < SYNTH_LENGHT; i++){
+        capture[i] = 2048 + 1200 * sinf(0.05f * i) + 300 * sinf(0.71f * i) + (rand() % 64);
+    }
+    return SYNTH_LENGHT;
+}
+/*==================[external functions definition]==========================*/
+int main(int argc, char ** argv){
+    const char * mode = (argc > 1) ? argv[1] : "all";
+    uint16_t lenght;
+    int failed = 0;
+
+    if(argc > 2){
+        lenght = CaptureLoad(argv[2]);
+        if(lenght == 0){
+            fprintf(stderr, "Can't read capture %s\n", argv[2]);
+            return 1;
+        }
+        printf("Capture %s: %u samples\n", argv[2], lenght);
+    }
+    else{
+        lenght = CaptureSynth();
+        printf("Synthetic capture: %u samples\n", lenght);
+    }
+    if(strcmp(mode, "test") == 0 || strcmp(mode, "all") == 0){
+        failed = TestSignalProcessing(capture, lenght);
+    }
+    if(strcmp(mode, "bench") == 0 || strcmp(mode, "all") == 0){
+        BenchSignalProcessing(capture, lenght);
+    }
+    return (failed == 0) ? 0 : 1;
+}
+
+/*==================[end of file]============================================*/
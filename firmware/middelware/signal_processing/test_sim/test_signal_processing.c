@@ -0,0 +1,1969 @@
+/**
+ * @file test_signal_processing.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Golden output tests of the signal_processing middleware
+ *
+ * Every module is run on the capture and its output is compared with a double
+ * precision reference model (direct DFT, direct form I biquads, direct FIR
+ * convolution), or with the floating point version for the fixed point paths.
+ *
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "test_sim.h"
+#include "fft.h"
+#include "stft.h"
+#include "iir_filter.h"
+#include "iir_const_lp.h"
+#include "fir_filter.h"
+#include "goertzel.h"
+#include "audio_mixer.h"
+#include "adpcm.h"
+#include "sample_bank.h"
+#include "hit_detector.h"
+#include "midi.h"
+#include "telemetry.h"
+#include "scope_stream.h"
+#include "imu_fusion.h"
+#include "qrs_detector.h"
+#include "fast_conv.h"
+#include "pipeline.h"
+#include "noise_floor.h"
+#include "pad_settings.h"
+#include "velocity_curve.h"
+#include "time_sync.h"
+#include "rice_codec.h"
+#include "onset_detector.h"
+#include "mfcc.h"
+#include "small_matrix.h"
+#include "audio_reactive.h"
+#include "fast_math.h"
+#include "controller_input.h"
+#include "median_filter.h"
+#include "tracking_filter.h"
+#include "sample_capture.h"
+#include "esp_partition.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_FREQ     200     /*!< Sample frequency of the capture (Hz) */
+#define SAMPLE_CACHE_MS 250     /*!< Attack cached by the sample cache test (ms) */
+#define FIR_TAPS        16      /*!< Taps of the Q15 FIR test filter */
+#define FIR_DESIGN_TAPS 31      /*!< Taps of the designed FIR test filters */
+#define FIR_DECIMATION  4       /*!< Decimation factor of the FIR decimator test */
+#define STFT_HOP        64      /*!< Hop of the STFT test */
+#define ADPCM_CHUNK     37      /*!< Samples decoded on each call of the streaming ADPCM test (odd) */
+#define MIXER_TEST_LENGHT 64    /*!< Samples of the voice allocation tests (one mixer block) */
+#define MIXER_DECAY_LENGHT 1024  /*!< Samples of the mixer envelope and master bus tests */
+#define MIXER_DECAY_TAU 64      /*!< Decay of the mixer envelope test (samples) */
+#define MIXER_DECAY_BLOCK 8     /*!< Samples of each block of the mixer envelope test */
+#define CONV_KERNEL     100     /*!< Kernel lenght of the fast convolution tests */
+#define CONV_FFT        256     /*!< Transform lenght of the streaming fast convolution test */
+#define QRS_BLOCK       23      /*!< Samples of each block of the QRS detector test (odd) */
+#define PIPE_BLOCK      64      /*!< Samples of each block of the pipeline test */
+#define PIPE_BLOCKS     4       /*!< Blocks of the pool of the pipeline test */
+#define NOISE_BLOCK     64      /*!< Samples of each block of the noise floor test */
+#define SYNC_PERIOD_US  500000  /*!< Beacon period of the clock synchronization test (us) */
+#define RICE_BLOCK      100     /*!< Samples of each block of the Rice codec test */
+#define ONSET_FREQ      2000    /*!< Sample frequency of the onset detector test (decimated pad, Hz) */
+#define ONSET_FRAME     64      /*!< Frame of the onset detector test */
+#define ONSET_HOP       16      /*!< Hop of the onset detector test */
+#define MFCC_FREQ       8000    /*!< Sample frequency of the MFCC test (Hz) */
+#define MFCC_FRAME      256     /*!< Frame of the MFCC test */
+#define MFCC_MELS       16      /*!< Mel bands of the MFCC test */
+#define MFCC_COEFFS     8       /*!< Coefficients of the MFCC test */
+#define AR_HOP          64      /*!< Hop of the audio reactive test */
+#define AR_BANDS        8       /*!< Bands of the audio reactive test */
+#define AR_TONE         1000    /*!< Tone of the audio reactive test (Hz) */
+#define FAST_MATH_STEPS 100000  /*!< Points of each sweep of the fast math test */
+#define PEDAL_FREQ      1000    /*!< Sample frequency of the controller input test (slow ADC channel, Hz) */
+#define PEDAL_LENGHT    500     /*!< Samples of each part of the controller input test */
+#define MEDIAN_WINDOW   31      /*!< Longest window of the median filter test */
+#define HIT_CAPTURE_AT  1000    /*!< Start of the hit of the sample capture test (samples at 20 kHz) */
+#define HIT_CAPTURE_MAX 2000    /*!< Max lenght of the recorded sample (samples at 10 kHz) */
+/*==================[internal data declaration]==============================*/
+static float signal[CAPTURE_MAX_LENGHT];
+static float output[CAPTURE_MAX_LENGHT];
+static float output_b[CAPTURE_MAX_LENGHT];
+static double reference[CAPTURE_MAX_LENGHT];
+static uint16_t signal_adc[CAPTURE_MAX_LENGHT];
+static int32_t output_q31[CAPTURE_MAX_LENGHT];
+static int16_t output_q15[CAPTURE_MAX_LENGHT];
+static uint16_t output_u16[CAPTURE_MAX_LENGHT];
+static uint8_t adpcm_data[ADPCM_BYTES(CAPTURE_MAX_LENGHT)];
+static uint32_t bank_data[(sizeof(sample_bank_header_t) + 2 * sizeof(sample_bank_entry_t) + 3 * CAPTURE_MAX_LENGHT) / 4];
+static float stft_buffer[STFT_BUFFER_LENGHT(MAX_SIGNAL_LENGHT)];
+static int failed;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Report the result of a test: the max error must not exceed the tolerance
+ */
+static void TestCheck(const char * name, double max_error, double tolerance){
+    bool pass = (max_error <= tolerance);
+    printf("[%s] %-28s max error %.3e (tolerance %.3e)\n", pass ? "PASS" : "FAIL", name, max_error, tolerance);
+    if(!pass){
+        failed++;
+    }
+}
+
+/**
+ * @brief Hann windowed DFT magnitude with the scale of FFTMagnitude
+ */
+static void RefFFTMagnitude(const float * x, double * mag, uint16_t n){
+    for(uint16_t k = 0; k < n / 2; k++){
+        double re = 0, im = 0;
+        for(uint16_t i = 0; i < n; i++){
+            double w = 0.5 * (1 - cos(2 * M_PI * i / (n - 1)));
+            re += x[i] * w * cos(2 * M_PI * k * i / n);
+            im -= x[i] * w * sin(2 * M_PI * k * i / n);
+        }
+        mag[k] = 4.0 / (n * 0.5) * sqrt(re * re + im * im);
+    }
+    mag[0] /= 4;
+}
+
+/**
+ * @brief Cascade of direct form I biquads ([b0, b1, b2, a1, a2] per section)
+ */
+static void RefIIR(const iir_filter_t * filter, const float * x, double * y, uint16_t n){
+    double s[IIR_MAX_SECTIONS][4] = {{0}};
+    for(uint16_t i = 0; i < n; i++){
+        double v = x[i];
+        for(uint8_t k = 0; k < filter->n_sections; k++){
+            const float * c = filter->coeffs[k];
+            double out = c[0] * v + c[1] * s[k][0] + c[2] * s[k][1] - c[3] * s[k][2] - c[4] * s[k][3];
+            s[k][1] = s[k][0];
+            s[k][0] = v;
+            s[k][3] = s[k][2];
+            s[k][2] = out;
+            v = out;
+        }
+        y[i] = v;
+    }
+}
+
+/**
+ * @brief Max absolute difference between a float and a double array
+ */
+static double MaxError(const float * a, const double * b, uint16_t n){
+    double max = 0;
+    for(uint16_t i = 0; i < n; i++){
+        double e = fabs(a[i] - b[i]);
+        if(e > max){
+            max = e;
+        }
+    }
+    return max;
+}
+
+/**
+ * @brief Max absolute value of an array
+ */
+static double MaxAbs(const double * a, uint16_t n){
+    double max = 0;
+    for(uint16_t i = 0; i < n; i++){
+        if(fabs(a[i]) > max){
+            max = fabs(a[i]);
+        }
+    }
+    return max;
+}
+
+static void TestFFT(uint16_t n, float mean){
+    fft_plan_t plan;
+    double max = 0;
+    // float FFT against the direct DFT
+    FFTMagnitude(signal, output, n);
+    RefFFTMagnitude(signal, reference, n);
+    TestCheck("FFTMagnitude", MaxError(output, reference, n / 2), 1e-5 * MaxAbs(reference, n / 2));
+    // fixed point FFT from ADC counts against the float FFT of the same samples
+    uint16_t offset = (uint16_t)lrintf(mean);
+    for(uint16_t i = 0; i < n; i++){
+        output_b[i] = signal_adc[i] - offset;
+    }
+    FFTMagnitude(output_b, output, n);
+    FFTMagnitudeQ15(signal_adc, offset, output_u16, n);
+    for(uint16_t j = 0; j < n / 2; j++){
+        double e = fabs(output_u16[j] - output[j]);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("FFTMagnitudeQ15", max, 4.0);
+    // magnitude modes against FFT_MAG_LINEAR
+    FFTPlanInit(&plan, n, FFT_WINDOW_HANN, NULL);
+    FFTPlanMagnitude(&plan, signal, output);
+    FFTPlanSetMagnitude(&plan, FFT_MAG_SQUARED);
+    FFTPlanMagnitude(&plan, signal, output_b);
+    for(uint16_t j = 0; j < n / 2; j++){
+        reference[j] = (double)output[j] * output[j];
+    }
+    TestCheck("FFT_MAG_SQUARED", MaxError(output_b, reference, n / 2), 1e-5 * MaxAbs(reference, n / 2));
+    FFTPlanSetMagnitude(&plan, FFT_MAG_APPROX);
+    FFTPlanMagnitude(&plan, signal, output_b);
+    max = 0;
+    for(uint16_t j = 0; j < n / 2; j++){
+        double e = fabs(output_b[j] - output[j]) / (output[j] + 1e-20);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("FFT_MAG_APPROX (relative)", max, 0.04);
+    FFTPlanSetMagnitude(&plan, FFT_MAG_DB);
+    FFTPlanMagnitude(&plan, signal, output_b);
+    max = 0;
+    for(uint16_t j = 0; j < n / 2; j++){
+        double e = fabs(output_b[j] - 20 * log10(output[j] + 1e-20));
+        max = (e > max) ? e : max;
+    }
+    TestCheck("FFT_MAG_DB (dB)", max, 0.05);
+    FFTPlanDeinit(&plan);
+}
+
+static void TestSTFT(uint16_t n){
+    stft_t stft;
+    fft_plan_t plan;
+    double max = 0;
+    // the last frame must be the FFT of the last n samples pushed
+    STFTInit(&stft, n / 2, STFT_HOP, FFT_WINDOW_HANN, stft_buffer, NULL, NULL);
+    STFTProcess(&stft, signal, n);
+    FFTPlanInit(&plan, n / 2, FFT_WINDOW_HANN, NULL);
+    FFTPlanMagnitude(&plan, &signal[n / 2], output);
+    const float * magnitude = STFTGetMagnitude(&stft);
+    for(uint16_t j = 0; j < n / 4; j++){
+        double e = fabs(magnitude[j] - output[j]);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("STFTProcess", max, 0);
+    FFTPlanDeinit(&plan);
+}
+
+static void TestIIR(uint16_t n){
+    static iir_filter_t filter;
+    static iir_filter_q31_t filter_q31;
+    for(uint8_t order = ORDER_2; order <= ORDER_8; order += 2){
+        char name[32];
+        // float cascade against the double reference
+        IIRFilterLowPassInit(&filter, SAMPLE_FREQ, 40, order);
+        RefIIR(&filter, signal, reference, n);
+        IIRFilterProcess(&filter, signal, output, n);
+        snprintf(name, sizeof(name), "IIRFilterProcess order %u", order);
+        TestCheck(name, MaxError(output, reference, n), 1e-5 * MaxAbs(reference, n));
+        // Q31 cascade from ADC counts against the double reference
+        IIRFilterReset(&filter);
+        IIRFilterQ31Init(&filter_q31, &filter);
+        IIRFilterQ31ProcessU16(&filter_q31, signal_adc, output_q31, n);
+        for(uint16_t i = 0; i < n; i++){
+            output[i] = output_q31[i];
+        }
+        snprintf(name, sizeof(name), "IIRFilterQ31 order %u", order);
+        TestCheck(name, MaxError(output, reference, n), 1.0);
+    }
+    // legacy API must give the same output as the instance API
+    IIRFilterLowPassInit(&filter, SAMPLE_FREQ, 40, ORDER_4);
+    IIRFilterProcess(&filter, signal, output_b, n);
+    LowPassInit(SAMPLE_FREQ, 40, ORDER_4);
+    LowPassFilter(signal, output, n);
+    for(uint16_t i = 0; i < n; i++){
+        reference[i] = output_b[i];
+    }
+    TestCheck("LowPassFilter", MaxError(output, reference, n), 0);
+    // generated table (tools/iir_design.py, same design) against the runtime design
+    static float delay[IIR_CONST_LP_SECTIONS][2];
+    IirConstLpProcess(delay, signal, output, n);
+    TestCheck("IirConstLpProcess", MaxError(output, reference, n), 1e-5 * MaxAbs(reference, n));
+}
+
+static void TestFIR(uint16_t n, float mean){
+    static float coeffs[FIR_TAPS];
+    static int16_t coeffs_q15[FIR_TAPS];
+    static int16_t delay[2 * FIR_TAPS];
+    fir_filter_q15_t fir;
+    uint16_t offset = (uint16_t)lrintf(mean);
+    // windowed sinc low pass (fc = fs / 8)
+    for(uint16_t k = 0; k < FIR_TAPS; k++){
+        double t = k - (FIR_TAPS - 1) / 2.0;
+        double sinc = (t == 0) ? 0.25 : sin(M_PI * 0.25 * t) / (M_PI * t);
+        coeffs[k] = sinc * (0.54 - 0.46 * cos(2 * M_PI * k / (FIR_TAPS - 1)));
+    }
+    FIRFilterCoeffsToQ15(coeffs, coeffs_q15, FIR_TAPS);
+    FIRFilterQ15Init(&fir, coeffs_q15, delay, FIR_TAPS);
+    FIRFilterQ15ProcessU16(&fir, signal_adc, output_q15, n, offset);
+    for(uint16_t i = 0; i < n; i++){
+        double acc = 0;
+        for(uint16_t k = 0; k < FIR_TAPS && k <= i; k++){
+            acc += coeffs[k] * ((double)signal_adc[i - k] - offset);
+        }
+        reference[i] = acc;
+        output[i] = output_q15[i];
+    }
+    // Q15 coefficients rounding plus output rounding
+    TestCheck("FIRFilterQ15ProcessU16", MaxError(output, reference, n), 1.0 + FIR_TAPS * 2048.0 / 32768);
+}
+/**
+ * @brief Gain of a FIR filter at a frequency (normalized to the sample frequency)
+ */
+static double FIRGain(const float * coeffs, uint16_t n_taps, double f){
+    double re = 0, im = 0;
+    for(uint16_t k = 0; k < n_taps; k++){
+        re += coeffs[k] * cos(2 * M_PI * f * k);
+        im -= coeffs[k] * sin(2 * M_PI * f * k);
+    }
+    return sqrt(re * re + im * im);
+}
+/**
+ * @brief Windowed sinc design, float filter and decimator (blocks of odd size) against direct convolution
+ */
+static void TestFIRFloat(uint16_t n, float mean){
+    static float coeffs[FIR_DESIGN_TAPS];
+    static float delay[FIR_DECIMATOR_DELAY_LENGHT(FIR_DESIGN_TAPS)];
+    fir_filter_t fir;
+    fir_decimator_t decimator;
+    // band edges of the designed filters (Blackman: about -74 dB in the stop band)
+    FIRFilterLowPassDesign(coeffs, FIR_DESIGN_TAPS, SAMPLE_FREQ, SAMPLE_FREQ / 8.0f);
+    double error = fabs(FIRGain(coeffs, FIR_DESIGN_TAPS, 0) - 1) + FIRGain(coeffs, FIR_DESIGN_TAPS, 0.25) +
+                   fabs(FIRGain(coeffs, FIR_DESIGN_TAPS, 0.125) - 0.5);
+    FIRFilterHiPassDesign(coeffs, FIR_DESIGN_TAPS, SAMPLE_FREQ, SAMPLE_FREQ / 4.0f);
+    error += FIRGain(coeffs, FIR_DESIGN_TAPS, 0) + fabs(FIRGain(coeffs, FIR_DESIGN_TAPS, 0.5) - 1);
+    FIRFilterBandPassDesign(coeffs, FIR_DESIGN_TAPS, SAMPLE_FREQ, SAMPLE_FREQ / 20.0f, SAMPLE_FREQ / 5.0f);
+    error += FIRGain(coeffs, FIR_DESIGN_TAPS, 0) + fabs(FIRGain(coeffs, FIR_DESIGN_TAPS, 0.125) - 1) +
+             FIRGain(coeffs, FIR_DESIGN_TAPS, 0.5);
+    error += FIRFilterHiPassDesign(coeffs, FIR_DESIGN_TAPS + 1, SAMPLE_FREQ, SAMPLE_FREQ / 4.0f);
+    TestCheck("FIRFilterLowPassDesign", error, 0.02);
+
+    FIRFilterLowPassDesign(coeffs, FIR_DESIGN_TAPS, SAMPLE_FREQ, SAMPLE_FREQ / (2.0f * FIR_DECIMATION));
+    for(uint16_t i = 0; i < n; i++){
+        double acc = 0;
+        for(uint16_t k = 0; k < FIR_DESIGN_TAPS && k <= i; k++){
+            acc += coeffs[k] * ((double)signal[i - k] - mean);
+        }
+        reference[i] = acc;
+        output_b[i] = signal[i] - mean;
+    }
+    FIRFilterInit(&fir, coeffs, delay, FIR_DESIGN_TAPS);
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        FIRFilterProcess(&fir, &output_b[pos], &output[pos], len);
+    }
+    TestCheck("FIRFilterProcess", MaxError(output, reference, n), 1e-3);
+    // the output j of the decimator is the filter output of the input (j + 1) * factor - 1
+    uint16_t n_out = 0;
+    FIRDecimatorInit(&decimator, coeffs, delay, FIR_DESIGN_TAPS, FIR_DECIMATION);
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        n_out += FIRDecimatorProcess(&decimator, &output_b[pos], &output[n_out], len);
+    }
+    for(uint16_t j = 0; j < n_out; j++){
+        reference[j] = reference[(j + 1) * FIR_DECIMATION - 1];
+    }
+    TestCheck("FIRDecimatorProcess", MaxError(output, reference, n_out) + fabs(n_out - (double)n / FIR_DECIMATION), 1e-3);
+}
+
+static void TestGoertzel(uint16_t n, float mean){
+    goertzel_t goertzel;
+    const float freqs[] = {1.0f, 10.0f, 33.3f, 60.0f};
+    const uint8_t n_bins = sizeof(freqs) / sizeof(freqs[0]);
+    float power[GOERTZEL_MAX_BINS];
+    double max = 0, max_ref = 0;
+    // offset is removed and the tolerance is relaxed: the float recursion loses
+    // precision with a large DC level and with bins close to DC
+    for(uint16_t i = 0; i < n; i++){
+        output_b[i] = signal[i] - mean;
+    }
+    GoertzelInit(&goertzel, SAMPLE_FREQ, freqs, n_bins, n);
+    GoertzelBlock(&goertzel, output_b, n, power);
+    for(uint8_t b = 0; b < n_bins; b++){
+        double re = 0, im = 0;
+        for(uint16_t i = 0; i < n; i++){
+            re += output_b[i] * cos(2 * M_PI * freqs[b] * i / SAMPLE_FREQ);
+            im -= output_b[i] * sin(2 * M_PI * freqs[b] * i / SAMPLE_FREQ);
+        }
+        double ref = (re * re + im * im) * 4.0 / ((double)n * n);
+        max = (fabs(power[b] - ref) > max) ? fabs(power[b] - ref) : max;
+        max_ref = (ref > max_ref) ? ref : max_ref;
+    }
+    TestCheck("GoertzelBlock", max, 5e-3 * max_ref);
+}
+static void TestAudioMixer(uint16_t n, float mean){
+    audio_mixer_t mixer;
+    int16_t offset = (int16_t)lrintf(mean);
+    double max = 0;
+    // the capture is played twice, the second time delayed n / 4 samples and halved
+    for(uint16_t i = 0; i < n; i++){
+        output_q15[i] = (int16_t)signal_adc[i];
+    }
+    AudioMixerInit(&mixer);
+    AudioMixerPlay(&mixer, output_q15, n, offset, 1.0f);
+    AudioMixerProcess(&mixer, &output_q15[n], n / 4);
+    AudioMixerPlay(&mixer, output_q15, n, offset, 0.5f);
+    AudioMixerProcess(&mixer, &output_q15[n + n / 4], n - n / 4);
+    for(uint16_t i = 0; i < n; i++){
+        double ref = output_q15[i] - offset;
+        if(i >= n / 4){
+            ref += floor((output_q15[i - n / 4] - offset) * 0.5);
+        }
+        double e = fabs(output_q15[n + i] - ref);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("AudioMixerProcess", max, 0);
+    // only the second voice is still playing
+    TestCheck("AudioMixerActiveVoices", fabs(AudioMixerActiveVoices(&mixer) - 1.0), 0);
+}
+static void TestAudioMixerVoices(void){
+    static const int16_t loud[MIXER_TEST_LENGHT] = {[0 ... MIXER_TEST_LENGHT - 1] = 1000};
+    static const int16_t silence[MIXER_TEST_LENGHT];
+    audio_mixer_t mixer;
+    int16_t mix[MIXER_TEST_LENGHT / 2];
+    double max = 0;
+    // two voices: the third sample steals the oldest one or the quietest one
+    AudioMixerInit(&mixer);
+    AudioMixerSetPolicy(&mixer, AUDIO_MIXER_STEAL_OLDEST, 2);
+    uint8_t first = AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 0.25f);
+    AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f);
+    TestCheck("AudioMixerSetPolicy (oldest)", (AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f) != first) +
+              fabs(AudioMixerActiveVoices(&mixer) - 2.0), 0);
+    AudioMixerInit(&mixer);
+    AudioMixerSetPolicy(&mixer, AUDIO_MIXER_STEAL_QUIETEST, 2);
+    AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f);
+    uint8_t quiet = AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 0.25f);
+    TestCheck("AudioMixerSetPolicy (quietest)", AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f) != quiet, 0);
+    // choke group: the first voice fades out along the next block and is released
+    AudioMixerInit(&mixer);
+    AudioMixerSetChoke(&mixer, AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f), 1);
+    uint8_t other = AudioMixerPlay(&mixer, loud, MIXER_TEST_LENGHT, 0, 1.0f);
+    AudioMixerSetChoke(&mixer, other, 2);
+    TestCheck("AudioMixerSetChoke", AudioMixerSetChoke(&mixer, AudioMixerPlay(&mixer, silence, MIXER_TEST_LENGHT, 0, 1.0f), 1) - 1.0, 0);
+    AudioMixerProcess(&mixer, mix, MIXER_TEST_LENGHT / 2);
+    for(uint16_t i = 0; i < MIXER_TEST_LENGHT / 2; i++){
+        double e = abs(mix[i] - (1000 + 1000 * (MIXER_TEST_LENGHT / 2 - i) / (MIXER_TEST_LENGHT / 2)));
+        max = (e > max) ? e : max;
+    }
+    TestCheck("AudioMixerSetChoke (fade out)", max + (AudioMixerActiveVoices(&mixer) != 2), 0);
+}
+static void TestAudioMixerBus(void){
+    static int16_t level[MIXER_DECAY_LENGHT];
+    audio_mixer_t mixer;
+    int16_t mix[MIXER_DECAY_LENGHT];
+    double max = 0;
+    for(uint16_t i = 0; i < MIXER_DECAY_LENGHT; i++){
+        level[i] = 1000;
+    }
+    // exponential decay, ramped along blocks of MIXER_DECAY_BLOCK samples, until the voice is released
+    AudioMixerInit(&mixer);
+    AudioMixerSetDecay(&mixer, AudioMixerPlay(&mixer, level, MIXER_DECAY_LENGHT, 0, 1.0f), MIXER_DECAY_TAU);
+    for(uint16_t pos = 0; pos < MIXER_DECAY_LENGHT; pos += MIXER_DECAY_BLOCK){
+        AudioMixerProcess(&mixer, &mix[pos], MIXER_DECAY_BLOCK);
+    }
+    for(uint16_t i = 0; i < MIXER_DECAY_LENGHT; i++){
+        double e = fabs(mix[i] - 1000 * exp(-(double)i / MIXER_DECAY_TAU));
+        max = (e > max) ? e : max;
+    }
+    TestCheck("AudioMixerSetDecay", max, 4);
+    TestCheck("AudioMixerSetDecay (release)", AudioMixerActiveVoices(&mixer), 0);
+    // master gain under the threshold: exact
+    AudioMixerInit(&mixer);
+    AudioMixerSetMaster(&mixer, 0.5f, 10000, MIXER_DECAY_BLOCK);
+    AudioMixerPlay(&mixer, level, MIXER_DECAY_BLOCK, 0, 1.0f);
+    AudioMixerPlay(&mixer, level, MIXER_DECAY_BLOCK, 0, 1.0f);
+    AudioMixerProcess(&mixer, mix, MIXER_DECAY_BLOCK);
+    max = 0;
+    for(uint16_t i = 0; i < MIXER_DECAY_BLOCK; i++){
+        max = (fabs(mix[i] - 1000.0) > max) ? fabs(mix[i] - 1000.0) : max;
+    }
+    TestCheck("AudioMixerSetMaster", max, 0);
+    // sum of 15000 over the threshold: limited from the first sample
+    AudioMixerInit(&mixer);
+    AudioMixerSetMaster(&mixer, 1.0f, 10000, MIXER_DECAY_BLOCK);
+    AudioMixerPlay(&mixer, level, MIXER_DECAY_BLOCK, 0, 7.5f);
+    AudioMixerPlay(&mixer, level, MIXER_DECAY_BLOCK, 0, 7.5f);
+    AudioMixerProcess(&mixer, mix, MIXER_DECAY_BLOCK);
+    max = 0;
+    for(uint16_t i = 0; i < MIXER_DECAY_BLOCK; i++){
+        max = (fabs(mix[i] - 10000.0) > max) ? fabs(mix[i] - 10000.0) : max;
+    }
+    TestCheck("AudioMixerSetMaster (limiter)", max, 1);
+    // the gain recovers along the release
+    AudioMixerPlay(&mixer, level, 2 * MIXER_DECAY_BLOCK, 0, 1.0f);
+    AudioMixerProcess(&mixer, mix, MIXER_DECAY_BLOCK);
+    AudioMixerProcess(&mixer, &mix[MIXER_DECAY_BLOCK], MIXER_DECAY_BLOCK);
+    TestCheck("AudioMixerSetMaster (release)", fabs(mix[2 * MIXER_DECAY_BLOCK - 1] - 1000.0) + (mix[0] >= 1000) +
+              fabs((double)mixer.limit - mixer.master), 1);
+}
+static void TestADPCM(uint16_t n, float mean){
+    adpcm_state_t state;
+    double noise = 0, power = 0, max = 0;
+    // capture without its mean, scaled to use most of the 16 bits range
+    for(uint16_t i = 0; i < n; i++){
+        output_q15[i] = (int16_t)lrintf((signal[i] - mean) * 8);
+    }
+    AdpcmInit(&state);
+    AdpcmEncode(&state, output_q15, adpcm_data, n);
+    AdpcmInit(&state);
+    AdpcmDecode(&state, adpcm_data, 0, &output_q15[n], n);
+    for(uint16_t i = 0; i < n; i++){
+        double e = output_q15[n + i] - output_q15[i];
+        noise += e * e;
+        power += (double)output_q15[i] * output_q15[i];
+    }
+    // quantization noise below -20 dB
+    TestCheck("AdpcmDecode (noise / signal)", noise / power, 0.01);
+    // decoding in odd sized chunks must give the same samples
+    AdpcmInit(&state);
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        AdpcmDecode(&state, adpcm_data, pos, &output_q15[pos], len);
+    }
+    for(uint16_t i = 0; i < n; i++){
+        double e = abs(output_q15[i] - output_q15[n + i]);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("AdpcmDecode (streaming)", max, 0);
+    // the mixer decodes the same stream
+    audio_mixer_t mixer;
+    AudioMixerInit(&mixer);
+    AudioMixerPlayADPCM(&mixer, adpcm_data, n, 1.0f);
+    AudioMixerProcess(&mixer, output_q15, n);
+    max = 0;
+    for(uint16_t i = 0; i < n; i++){
+        double e = abs(output_q15[i] - output_q15[n + i]);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("AudioMixerPlayADPCM", max, 0);
+}
+static void TestSampleBank(uint16_t n){
+    sample_bank_t bank;
+    sample_t sample;
+    uint8_t * base = (uint8_t *)bank_data;
+    sample_bank_header_t * header = (sample_bank_header_t *)base;
+    sample_bank_entry_t * entries = (sample_bank_entry_t *)(header + 1);
+    double max = 0;
+    // bank with the capture as PCM (output_q15 from TestADPCM) and as ADPCM
+    uint32_t offset = sizeof(sample_bank_header_t) + 2 * sizeof(sample_bank_entry_t);
+    memset(bank_data, 0, sizeof(bank_data));
+    entries[0] = (sample_bank_entry_t){.offset = offset, .lenght = n, .sample_rate = SAMPLE_FREQ, .format = SAMPLE_PCM16, .name = "pcm"};
+    memcpy(&base[offset], output_q15, n * sizeof(int16_t));
+    offset += n * sizeof(int16_t);
+    entries[1] = (sample_bank_entry_t){.offset = offset, .lenght = n, .sample_rate = SAMPLE_FREQ, .format = SAMPLE_ADPCM, .name = "adpcm"};
+    memcpy(&base[offset], adpcm_data, ADPCM_BYTES(n));
+    offset += ADPCM_BYTES(n);
+    *header = (sample_bank_header_t){.magic = SAMPLE_BANK_MAGIC, .version = SAMPLE_BANK_VERSION, .count = 2, .size = offset};
+    TestCheck("SampleBankOpen", !SampleBankOpen(&bank, bank_data, offset), 0);
+    TestCheck("SampleBankFind", fabs(SampleBankFind(&bank, "adpcm") - 1.0), 0);
+    // samples are read in place
+    SampleBankGet(&bank, 0, &sample);
+    const int16_t * pcm = sample.data;
+    for(uint16_t i = 0; i < n; i++){
+        double e = abs(pcm[i] - output_q15[i]);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("SampleBankGet (PCM16)", max, 0);
+    SampleBankGet(&bank, 1, &sample);
+    TestCheck("SampleBankGet (ADPCM)", (sample.data != (const void *)&base[entries[1].offset]) + (sample.format != SAMPLE_ADPCM), 0);
+    // attacks cached in RAM: the mixer plays the same samples, crossing to the bank inside a block
+    sample_cache_t cache;
+    sample_t cached[2];
+    audio_mixer_t mixer;
+    SampleCacheInit(&cache, SAMPLE_CACHE_MS, NULL, 0);
+    SampleBankGet(&bank, 0, &cached[0]);
+    SampleBankGet(&bank, 1, &cached[1]);
+    TestCheck("SampleCacheAdd (full)", SampleCacheAdd(&cache, &cached[0]) + (cached[0].head != NULL), 0);
+    SampleCacheDeinit(&cache);
+    SampleCacheInit(&cache, SAMPLE_CACHE_MS, NULL, SampleCacheBytes(&cached[0], SAMPLE_CACHE_MS) + SampleCacheBytes(&cached[1], SAMPLE_CACHE_MS));
+    TestCheck("SampleCacheAdd", !SampleCacheAdd(&cache, &cached[0]) + !SampleCacheAdd(&cache, &cached[1]) +
+              (cached[0].head_lenght != SAMPLE_FREQ * SAMPLE_CACHE_MS / 1000) + (cache.used != cache.size), 0);
+    max = 0;
+    for(uint8_t k = 0; k < 2; k++){
+        AudioMixerInit(&mixer);
+        uint8_t voice = (k == 0) ? AudioMixerPlay(&mixer, cached[0].data, n, 0, 1.0f) :
+                                   AudioMixerPlayADPCM(&mixer, cached[1].data, n, 1.0f);
+        AudioMixerSetAttack(&mixer, voice, cached[k].head, cached[k].head_lenght);
+        for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+            uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+            AudioMixerProcess(&mixer, &output_q15[n + pos], len);
+        }
+        for(uint16_t i = 0; i < n; i++){
+            double e = abs(output_q15[n + i] - pcm[i]);
+            max = (e > max) ? e : max;
+        }
+    }
+    TestCheck("AudioMixerSetAttack", max, 0);
+    SampleCacheDeinit(&cache);
+    // a sample that does not fit in the bank must be rejected
+    entries[1].lenght = 2 * n + 1;
+    TestCheck("SampleBankOpen (invalid)", SampleBankOpen(&bank, bank_data, offset), 0);
+}
+static void TestHitDetector(void){
+    // synthetic piezo hits: start (samples), amplitude (mV), detected
+    const uint16_t start[] = {100, 700, 980, 2000, 3000};
+    const float amp[] = {1500, 1500, 600, 300, 900};
+    const bool detected[] = {true, true, false, false, true};
+    const hit_detector_config_t config = {
+        .sample_frec = 20000, .threshold = 400, .max_level = 2000,
+        .scan_time = 2, .mask_time = 10, .decay_time = 20,
+    };
+    const uint16_t n = 4096;
+    hit_detector_t detector;
+    hit_event_t hits[8], hits_b[8];
+    uint8_t n_hits = 0, n_ref = 0;
+    double max = 0;
+    memset(output, 0, n * sizeof(float));
+    for(uint8_t k = 0; k < 5; k++){
+        for(uint16_t i = start[k]; i < n; i++){
+            double t = (i - start[k]) / config.sample_frec;
+            output[i] += amp[k] * exp(-t / 5e-3) * sin(2 * M_PI * 500 * t);
+        }
+    }
+    HitDetectorInit(&detector, &config);
+    n_hits = HitDetectorProcess(&detector, output, n, hits, 8);
+    for(uint8_t k = 0; k < 5; k++){
+        if(detected[k] && n_ref < n_hits){
+            // peak of the first 3 ms of the hit and its velocity
+            double peak = 0;
+            for(uint16_t i = start[k]; i < start[k] + 60; i++){
+                peak = (fabs(output[i]) > peak) ? fabs(output[i]) : peak;
+            }
+            double velocity = 1 + (peak - config.threshold) * (HIT_MAX_VELOCITY - 1) / (config.max_level - config.threshold);
+            double e = fabs(hits[n_ref].velocity - velocity);
+            max = (e > max) ? e : max;
+            n_ref++;
+        }
+    }
+    TestCheck("HitDetectorProcess (hits)", fabs(n_hits - 3.0), 0);
+    // the first hit starts at the first sample over the threshold
+    uint16_t onset = start[0];
+    while(fabsf(output[onset]) <= config.threshold){
+        onset++;
+    }
+    TestCheck("HitDetectorProcess (onset)", fabs((double)hits[0].onset - onset), 0);
+    TestCheck("HitDetectorProcess (velocity)", max, 0.5);
+    // processing in odd sized blocks gives the same hits
+    uint8_t n_hits_b = 0;
+    max = 0;
+    HitDetectorReset(&detector);
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        hit_event_t block_hits[2];
+        uint8_t m = HitDetectorProcess(&detector, &output[pos], len, block_hits, 2);
+        for(uint8_t j = 0; j < m && n_hits_b < 8; j++){
+            hits_b[n_hits_b] = block_hits[j];
+            hits_b[n_hits_b].pos += pos;
+            n_hits_b++;
+        }
+    }
+    for(uint8_t j = 0; j < n_hits && j < n_hits_b; j++){
+        double e = abs(hits[j].pos - hits_b[j].pos) + abs(hits[j].velocity - hits_b[j].velocity);
+        max = (e > max) ? e : max;
+    }
+    TestCheck("HitDetectorProcess (blocks)", max + abs(n_hits - n_hits_b), 0);
+}
+static void TestHitCrosstalk(void){
+    // hits of two pads: pad, start (samples), amplitude (mV); the weak ones are coupled from the other pad
+    const uint8_t pad[] = {0, 1, 1, 0, 0, 1};
+    const uint16_t start[] = {100, 105, 2000, 2010, 3000, 3000};
+    const float amp[] = {1500, 450, 1200, 500, 1000, 1000};
+    const hit_detector_config_t config = {
+        .sample_frec = 20000, .threshold = 400, .max_level = 2000,
+        .scan_time = 2, .mask_time = 10, .decay_time = 20,
+    };
+    const uint16_t n = 4096;
+    float * signals[2] = {output, output_b};
+    hit_detector_t detector[2];
+    hit_crosstalk_t crosstalk;
+    hit_event_t hits[2][2];
+    hit_event_t * hits_p[2] = {hits[0], hits[1]};
+    uint8_t kept[2] = {0, 0}, dropped = 0;
+    memset(output, 0, n * sizeof(float));
+    memset(output_b, 0, n * sizeof(float));
+    for(uint8_t k = 0; k < 6; k++){
+        for(uint16_t i = start[k]; i < n; i++){
+            double t = (i - start[k]) / config.sample_frec;
+            signals[pad[k]][i] += amp[k] * exp(-t / 5e-3) * sin(2 * M_PI * 500 * t);
+        }
+    }
+    HitDetectorInit(&detector[0], &config);
+    HitDetectorInit(&detector[1], &config);
+    HitCrosstalkInit(&crosstalk, config.sample_frec, 2, 1, 0.5f);
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        uint8_t n_hits[2];
+        for(uint8_t p = 0; p < 2; p++){
+            n_hits[p] = HitDetectorProcess(&detector[p], &signals[p][pos], len, hits[p], 2);
+        }
+        dropped += HitCrosstalkProcess(&crosstalk, hits_p, n_hits, len);
+        kept[0] += n_hits[0];
+        kept[1] += n_hits[1];
+    }
+    // the two coupled hits are dropped, the two simultaneous hits of equal strength are kept
+    TestCheck("HitCrosstalkProcess (dropped)", fabs(dropped - 2.0), 0);
+    TestCheck("HitCrosstalkProcess (kept)", fabs(kept[0] - 2.0) + fabs(kept[1] - 2.0), 0);
+}
+/**
+ * @brief Noise floor: threshold over uniform noise and hits detected with it
+ */
+static void TestNoiseFloor(void){
+    // stage vibration over the fixed threshold of the pads: uniform noise of +-600 mV
+    const uint16_t start[] = {500, 1800, 3100};
+    const hit_detector_config_t config = {
+        .sample_frec = 20000, .threshold = 400, .max_level = 4000,
+        .scan_time = 2, .mask_time = 10, .decay_time = 20,
+    };
+    const uint16_t n = 4096;
+    const double noise = 600, k = 4;
+    // |x| is uniform from 0 to noise: mean noise / 2, deviation noise / sqrt(12)
+    const double expected = noise * (0.5 + k / sqrt(12));
+    noise_floor_t nf;
+    hit_detector_t fixed, adaptive;
+    uint16_t hits_fixed = 0, hits_adaptive = 0;
+    srand(7);
+    NoiseFloorInit(&nf, config.sample_frec, 200, k, config.threshold);
+    // learn: 5 time constants of noise
+    for(uint8_t pass = 0; pass < 5; pass++){
+        for(uint16_t i = 0; i < n; i++){
+            output[i] = (rand() % (2 * (int)noise + 1)) - noise;
+        }
+        for(uint16_t pos = 0; pos < n; pos += NOISE_BLOCK){
+            NoiseFloorProcess(&nf, &output[pos], NOISE_BLOCK);
+        }
+    }
+    TestCheck("NoiseFloorProcess (threshold)", fabs(NoiseFloorThreshold(&nf) - expected), 0.03 * expected);
+    // hits over the noise: a fixed threshold triggers on the noise, the adaptive one only on the hits
+    for(uint16_t i = 0; i < n; i++){
+        output[i] = (rand() % (2 * (int)noise + 1)) - noise;
+    }
+    for(uint8_t j = 0; j < 3; j++){
+        for(uint16_t i = start[j]; i < n; i++){
+            double t = (i - start[j]) / config.sample_frec;
+            output[i] += 2500 * exp(-t / 5e-3) * sin(2 * M_PI * 500 * t);
+        }
+    }
+    HitDetectorInit(&fixed, &config);
+    HitDetectorInit(&adaptive, &config);
+    for(uint16_t pos = 0; pos < n; pos += NOISE_BLOCK){
+        HitDetectorSetThreshold(&adaptive, NoiseFloorThreshold(&nf));
+        hits_fixed += HitDetectorProcess(&fixed, &output[pos], NOISE_BLOCK, NULL, 0);
+        hits_adaptive += HitDetectorProcess(&adaptive, &output[pos], NOISE_BLOCK, NULL, 0);
+        NoiseFloorProcess(&nf, &output[pos], NOISE_BLOCK);
+    }
+    TestCheck("HitDetectorSetThreshold (hits)", fabs(hits_adaptive - 3.0) + (hits_fixed <= 3), 0);
+    // only the tails of the hits (a roll of 15 hits/s) raise the floor
+    TestCheck("NoiseFloorProcess (hits)", fabs(NoiseFloorThreshold(&nf) - expected), 0.1 * expected);
+    TestCheck("HitDetectorSetThreshold (invalid)", HitDetectorSetThreshold(&adaptive, config.max_level), 0);
+}
+/**
+ * @brief Pad settings: blob round trip, rejected blobs and text commands
+ */
+static void TestPadSettings(void){
+    const pad_settings_t defaults[2] = {
+        {.threshold = 400, .max_level = 1200, .sensitivity = 1, .crosstalk = 0.5f, .curve = 1, .flags = 0},
+        {.threshold = 250, .max_level = 3000, .sensitivity = 2.5f, .crosstalk = 0.3f, .curve = 0.5f, .flags = 0},
+    };
+    pad_settings_t settings[2], loaded[2];
+    uint8_t blob[PAD_SETTINGS_SIZE(2)];
+    double error = 0;
+    memcpy(settings, defaults, sizeof(settings));
+    uint16_t lenght = PadSettingsEncode(settings, 2, blob);
+    bool ok = PadSettingsDecode(loaded, 2, blob, lenght);
+    for(uint8_t i = 0; i < 2; i++){
+        error += fabs(loaded[i].threshold - settings[i].threshold) + fabs(loaded[i].max_level - settings[i].max_level) +
+            fabs(loaded[i].sensitivity - settings[i].sensitivity) + fabs(loaded[i].crosstalk - settings[i].crosstalk) +
+            fabs(loaded[i].curve - settings[i].curve) + (loaded[i].flags != settings[i].flags);
+    }
+    // the fields are quantized to 1/255 (cross-talk ratio) at most
+    TestCheck("PadSettingsEncode / PadSettingsDecode", error + (lenght != sizeof(blob)) + !ok, 2.0 / 255);
+    // another number of pads, a corrupted byte or another version are rejected
+    uint16_t rejected = PadSettingsDecode(loaded, 1, blob, PAD_SETTINGS_SIZE(1));
+    blob[PAD_SETTINGS_HEADER + 1] ^= 0x10;
+    rejected += PadSettingsDecode(loaded, 2, blob, lenght);
+    blob[PAD_SETTINGS_HEADER + 1] ^= 0x10;
+    blob[2]++;
+    rejected += PadSettingsDecode(loaded, 2, blob, lenght);
+    TestCheck("PadSettingsDecode (rejected)", rejected, 0);
+    // commands: valid values change one field, invalid ones nothing
+    uint16_t errors = (PadSettingsCommand(settings, 2, "set 1 threshold 300") != PAD_COMMAND_SET) +
+        (PadSettingsCommand(settings, 2, "set 0 curve 2.5") != PAD_COMMAND_SET);
+    errors += (settings[1].threshold != 300) + (settings[0].curve != 2.5f) + !(settings[1].flags & PAD_SETTINGS_CALIBRATED);
+    const char * invalid[] = {"set 2 threshold 300", "set 0 threshold 5000", "set 0 xtalk 1.5", "set 0 gain 2", "reset"};
+    for(uint8_t i = 0; i < 5; i++){
+        errors += PadSettingsCommand(settings, 2, invalid[i]) != PAD_COMMAND_ERROR;
+    }
+    errors += (settings[0].threshold != defaults[0].threshold) + (settings[0].crosstalk != defaults[0].crosstalk);
+    errors += (PadSettingsCommand(settings, 2, "save") != PAD_COMMAND_SAVE) +
+        (PadSettingsCommand(settings, 2, "defaults") != PAD_COMMAND_DEFAULTS);
+    TestCheck("PadSettingsCommand", errors, 0);
+    // custom velocity curve: stored with the pad, removed with no velocities
+    errors = (PadSettingsCommand(settings, 2, "points 1 1 90 127") != PAD_COMMAND_SET) +
+        (settings[1].points != 3) + (settings[1].point[1] != 90);
+    const char * invalid_points[] = {"points 1 1 90 128", "points 1 20", "points 1 1 2 3 4 5 6 7 8 9", "points 1 1 x", "points 2 1 127"};
+    for(uint8_t i = 0; i < 5; i++){
+        errors += PadSettingsCommand(settings, 2, invalid_points[i]) != PAD_COMMAND_ERROR;
+    }
+    errors += (settings[1].points != 3);
+    lenght = PadSettingsEncode(settings, 2, blob);
+    errors += !PadSettingsDecode(loaded, 2, blob, lenght) + (loaded[1].points != 3) +
+        (memcmp(loaded[1].point, settings[1].point, 3) != 0) + (loaded[0].points != 0);
+    errors += (PadSettingsCommand(settings, 2, "points 1") != PAD_COMMAND_SET) + (settings[1].points != 0);
+    TestCheck("PadSettingsCommand (points)", errors, 0);
+}
+/**
+ * @brief Velocity curves: tables against the formulas of the curves, limits and custom points
+ */
+static void TestVelocityCurve(void){
+    static velocity_curve_t linear, power, log_curve, exp_curve, custom;
+    const float threshold = 100, max_level = 1100;
+    double error = 0;
+    uint16_t errors = 0;
+    VelocityCurveInit(&linear, VELOCITY_CURVE_LINEAR, 0, threshold, max_level);
+    VelocityCurveInit(&power, VELOCITY_CURVE_POWER, 0.5f, threshold, max_level);
+    VelocityCurveInit(&log_curve, VELOCITY_CURVE_LOG, 10, threshold, max_level);
+    VelocityCurveInit(&exp_curve, VELOCITY_CURVE_EXP, 3, threshold, max_level);
+    for(float peak = threshold; peak <= max_level; peak += 1){
+        float x = (peak - threshold) / (max_level - threshold);
+        velocity_entry_t l = VelocityCurveLookup(&linear, peak);
+        velocity_entry_t p = VelocityCurveLookup(&power, peak);
+        // same velocity as the detector, and the gain of that velocity
+        error = fmax(error, fabs(l.velocity - (1 + 126 * x)));
+        // sqrt() is too steep near 0 for the steps of the table
+        error = fmax(error, (x >= 0.1) ? fabs(p.velocity - (1 + 126 * sqrt(x))) : 0);
+        error = fmax(error, fabs(l.gain - l.velocity * 32767.0 / 127) / 258);
+        errors += (VelocityCurveLookup(&log_curve, peak).velocity < l.velocity) +
+            (VelocityCurveLookup(&exp_curve, peak).velocity > l.velocity);
+    }
+    // the steps of the table (1000 / 255 mV) are half a velocity step
+    TestCheck("VelocityCurveLookup (linear, power)", error, 1);
+    TestCheck("VelocityCurveLookup (log over linear, exp under it)", errors, 0);
+    velocity_entry_t low = VelocityCurveLookup(&log_curve, 0);
+    velocity_entry_t high = VelocityCurveLookup(&exp_curve, 5000);
+    errors = (low.velocity != 1) + (high.velocity != VELOCITY_CURVE_MAX_VELOCITY) + (high.gain != VELOCITY_CURVE_GAIN_ONE);
+    TestCheck("VelocityCurveLookup (limits)", errors, 0);
+    const uint8_t points[] = {1, 100, 127};
+    VelocityCurveInitCustom(&custom, points, 3, threshold, max_level);
+    error = fabs(VelocityCurveLookup(&custom, 350).velocity - 50.5) + abs(VelocityCurveLookup(&custom, 600).velocity - 100) +
+        fabs(VelocityCurveLookup(&custom, 850).velocity - 113.5);
+    TestCheck("VelocityCurveInitCustom", error, 1.5);
+    const uint8_t invalid[] = {0, 127};
+    errors = VelocityCurveInit(&custom, VELOCITY_CURVE_CUSTOM, 1, threshold, max_level) +
+        VelocityCurveInit(&custom, VELOCITY_CURVE_POWER, 0, threshold, max_level) +
+        VelocityCurveInit(&custom, VELOCITY_CURVE_LINEAR, 0, max_level, threshold) +
+        VelocityCurveInitCustom(&custom, points, 1, threshold, max_level) +
+        VelocityCurveInitCustom(&custom, invalid, 2, threshold, max_level);
+    TestCheck("VelocityCurveInit (invalid)", errors, 0);
+}
+/**
+ * @brief MIDI: running status on serial ports and BLE-MIDI packets timestamps
+ */
+static void TestMIDI(void){
+    uint8_t msg[MIDI_MSG_MAX_LENGHT], out[4 * MIDI_MSG_MAX_LENGHT];
+    midi_serial_t serial;
+    uint8_t n = 0;
+    MidiSerialInit(&serial);
+    // two notes on the same channel share the status byte, a new channel sends it again
+    n += MidiSerialEncode(&serial, msg, MidiNoteOn(MIDI_DRUMS_CHANNEL, 38, 100, msg), &out[n]);
+    n += MidiSerialEncode(&serial, msg, MidiNoteOn(MIDI_DRUMS_CHANNEL, 42, 64, msg), &out[n]);
+    n += MidiSerialEncode(&serial, msg, MidiNoteOn(0, 42, 64, msg), &out[n]);
+    const uint8_t serial_ref[] = {0x99, 38, 100, 42, 64, 0x90, 42, 64};
+    TestCheck("MidiSerialEncode", (n != sizeof(serial_ref)) || (memcmp(out, serial_ref, sizeof(serial_ref)) != 0), 0);
+
+    ble_midi_packet_t packet;
+    uint8_t added = 0;
+    BleMidiPacketInit(&packet);
+    MidiNoteOn(MIDI_DRUMS_CHANNEL, 38, 100, msg);
+    // 0x1FF8 + 10 ms overflows the 13 bits (and the 7 low bits), the third message is older than the second
+    const uint16_t time[] = {0x1FF8, 0x0002, 0x0001, 0x0003, 0x0004};
+    for(uint8_t k = 0; k < 5; k++){
+        added += BleMidiPacketAdd(&packet, time[k], msg, 3);
+    }
+    const uint8_t ble_ref[] = {0xBF, 0xF8, 0x99, 38, 100, 0x82, 0x99, 38, 100, 0x82, 0x99, 38, 100, 0x83, 0x99, 38, 100};
+    TestCheck("BleMidiPacketAdd (packet)", (added != 4) || (packet.lenght != sizeof(ble_ref)) ||
+              (memcmp(packet.data, ble_ref, sizeof(ble_ref)) != 0), 0);
+    // a message 128 ms after the previous one needs a new packet
+    BleMidiPacketInit(&packet);
+    added = BleMidiPacketAdd(&packet, 1000, msg, 3);
+    added += BleMidiPacketAdd(&packet, 1127, msg, 3);
+    added += BleMidiPacketAdd(&packet, 1255, msg, 3);
+    TestCheck("BleMidiPacketAdd (elapsed)", added != 2, 0);
+}
+/**
+ * @brief Telemetry: COBS round trip, CRC check value and frames of typed channels
+ */
+static void TestTelemetry(uint16_t n){
+    uint8_t * raw = adpcm_data;
+    uint8_t * encoded = (uint8_t *)bank_data;
+    uint8_t * decoded = &encoded[COBS_MAX_LENGHT(600)];
+    // zeros every 300 bytes: blocks longer than 254 bytes
+    for(uint16_t i = 0; i < 600; i++){
+        raw[i] = (i % 300 == 0) ? 0 : (uint8_t)(i * 7 + 1) | 1;
+    }
+    uint16_t lenght = CobsEncode(raw, 600, encoded);
+    int16_t d = CobsDecode(encoded, lenght, decoded);
+    TestCheck("CobsEncode (no zeros)", memchr(encoded, 0, lenght) != NULL, 0);
+    TestCheck("CobsDecode", fabs(d - 600.0) + (memcmp(raw, decoded, 600) != 0), 0);
+
+    // CRC-16/CCITT-FALSE check value
+    TestCheck("TelemetryCRC16", fabs(TelemetryCRC16((const uint8_t *)"123456789", 9) - (double)0x29B1), 0);
+
+    // frames of 2 channels (samples and a float value), as many samples as they fit
+    telemetry_t telemetry;
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD + 2];
+    uint16_t frames = 0, pos = 0, errors = 0;
+    float level = 1.5f;
+    TelemetryInit(&telemetry, 120);
+    while(pos < n){
+        uint8_t count = (n - pos < 40) ? n - pos : 40;
+        if(!TelemetryAdd(&telemetry, 1, TELEMETRY_U16, &signal_adc[pos], count) ||
+           !TelemetryAdd(&telemetry, 2, TELEMETRY_F32, &level, 1)){
+            // full frame: decode and check the samples
+            lenght = TelemetryEncode(&telemetry, encoded);
+            int16_t p = TelemetryDecode(encoded, lenght - 1, payload);
+            errors += (p < 0) || (payload[0] != (uint8_t)frames) || (encoded[lenght - 1] != 0);
+            frames++;
+            continue;
+        }
+        pos += count;
+    }
+    lenght = TelemetryEncode(&telemetry, encoded);
+    int16_t p = TelemetryDecode(encoded, lenght - 1, payload);
+    // last frame: first record has the last samples
+    uint8_t count = payload[3];
+    errors += (p < 0) || (payload[1] != 1) || (payload[2] != TELEMETRY_U16) ||
+              (memcmp(&payload[4], &signal_adc[n - count], count * sizeof(uint16_t)) != 0);
+    // corrupted byte
+    encoded[3] ^= 0x10;
+    errors += (TelemetryDecode(encoded, lenght - 1, payload) >= 0);
+    TestCheck("TelemetryEncode / TelemetryDecode", errors, 0);
+}
+/**
+ * @brief Scope stream: 12 bits and delta packed blocks of 2 channels round trip through the frames
+ */
+static void TestScopeStream(uint16_t n){
+    uint8_t * encoded = (uint8_t *)bank_data;
+    uint8_t * payload = adpcm_data;
+    uint16_t lenght = (n / 2 > 128) ? 128 : n / 2;
+    const uint16_t * data[2] = {&signal_adc[0], &signal_adc[lenght]};
+    uint16_t * unpacked[2] = {&output_u16[0], &output_u16[lenght]};
+    scope_stream_t scope;
+    uint16_t errors = 0;
+    for(uint16_t i = 0; i < 2 * lenght; i++){
+        signal_adc[i] &= 0x0FFF;
+    }
+    // 12 bits: 3 bytes every 2 samples
+    ScopeStreamInit(&scope, SCOPE_PACK_12BIT, 2);
+    uint16_t frame = ScopeStreamEncode(&scope, data, lenght, 1000, 3, encoded);
+    int16_t p = TelemetryDecode(encoded, frame - 1, payload);
+    errors += (p != SCOPE_HEADER + 3 * lenght) || (ScopeStreamUnpack(payload, p, unpacked) != lenght) ||
+              (memcmp(signal_adc, output_u16, 2 * lenght * sizeof(uint16_t)) != 0) || (payload[9] != 3);
+    // odd number of samples
+    ScopeStreamInit(&scope, SCOPE_PACK_12BIT, 1);
+    frame = ScopeStreamEncode(&scope, data, lenght - 1, 1000, 0, encoded);
+    p = TelemetryDecode(encoded, frame - 1, payload);
+    errors += (ScopeStreamUnpack(payload, p, unpacked) != lenght - 1) ||
+              (memcmp(signal_adc, output_u16, (lenght - 1) * sizeof(uint16_t)) != 0);
+    TestCheck("ScopeStreamEncode (12 bits)", errors, 0);
+
+    // delta: a full scale step in the second channel needs the escape
+    errors = 0;
+    signal_adc[lenght + lenght / 2] ^= 0x0800;
+    ScopeStreamInit(&scope, SCOPE_PACK_DELTA, 2);
+    for(uint8_t k = 0; k < 2; k++){
+        frame = ScopeStreamEncode(&scope, data, lenght, 1000, 0, encoded);
+        p = TelemetryDecode(encoded, frame - 1, payload);
+        errors += (p < 0) || (payload[0] != k) || (ScopeStreamUnpack(payload, p, unpacked) != lenght) ||
+                  (memcmp(signal_adc, output_u16, 2 * lenght * sizeof(uint16_t)) != 0);
+    }
+    // samples missing
+    errors += (ScopeStreamUnpack(payload, p - 1, unpacked) >= 0);
+    TestCheck("ScopeStreamEncode (delta)", errors, 0);
+    for(uint16_t i = 0; i < n; i++){
+        signal_adc[i] = (uint16_t)lrintf(signal[i]);
+    }
+}
+/**
+ * @brief IMU fusion: every mode converges to a static tilt and integrates a z rotation
+ */
+static void TestImuFusion(void){
+    const char * names[3] = {"ImuFusionProcess (Mahony)", "ImuFusionProcess (Madgwick)", "ImuFusionProcess (EKF)"};
+    imu_frame_t frames[100];
+    imu_orientation_t out[10];
+    // 20 deg of roll and -10 deg of pitch, +/-2 g and +/-250 deg/s
+    float roll = 20.0f * (float)M_PI / 180, pitch = -10.0f * (float)M_PI / 180;
+    int16_t accel[3] = {(int16_t)lrintf(-16384 * sinf(pitch)), (int16_t)lrintf(16384 * cosf(pitch) * sinf(roll)),
+                        (int16_t)lrintf(16384 * cosf(pitch) * cosf(roll))};
+    for(uint8_t mode = IMU_FUSION_MAHONY; mode <= IMU_FUSION_EKF; mode++){
+        imu_fusion_config_t config = {mode, 100, 10, 16384, 131, 0};
+        imu_fusion_t fusion;
+        double error = !ImuFusionInit(&fusion, &config);
+        uint16_t published = 0;
+        // 30 s static
+        for(uint16_t i = 0; i < 100; i++){
+            memcpy(frames[i].accel, accel, sizeof(accel));
+            frames[i].gyro[0] = frames[i].gyro[1] = frames[i].gyro[2] = 0;
+        }
+        for(uint16_t k = 0; k < 30; k++){
+            published += ImuFusionProcess(&fusion, frames, 100, out, 10);
+        }
+        error += fabs(out[9].euler[0] - roll) + fabs(out[9].euler[1] - pitch) +
+                 fabs(published - 300.0) + fabs(out[9].pos - 99.0);
+        // the yaw reached while converging is not observable, only its change is checked
+        float yaw = out[9].euler[2];
+        // 1 s at 45 deg/s around the earth vertical (the gravity doesn't change in the sensor frame)
+        float g[3] = {accel[0] / 16384.0f, accel[1] / 16384.0f, accel[2] / 16384.0f};
+        for(uint16_t i = 0; i < 100; i++){
+            for(uint8_t j = 0; j < 3; j++){
+                frames[i].gyro[j] = (int16_t)lrintf(45 * 131 * g[j]);
+            }
+        }
+        ImuFusionProcess(&fusion, frames, 100, out, 10);
+        error += fabs(out[9].euler[2] - yaw - 45 * M_PI / 180);
+        ImuFusionDeinit(&fusion);
+        TestCheck(names[mode], error, 0.02);
+    }
+}
+/**
+ * @brief QRS detector: synthetic ECG (75 then 100 bpm, one weak beat) with baseline wander and T waves
+ */
+static void TestQRSDetector(void){
+    const qrs_detector_config_t config = {.sample_frec = SAMPLE_FREQ, .window_time = 150, .refractory_time = 200, .learn_time = 2000};
+    const uint16_t n = 4096;
+    uint32_t r_time[40];
+    uint8_t n_ref = 0, found = 0, extra = 0;
+    qrs_detector_t detector;
+    qrs_beat_t beats[4];
+    iir_filter_t hp, lp;
+    double error = 0;
+    memset(output, 0, n * sizeof(float));
+    for(uint32_t t = 50; t < n - 80; t += (t < n / 2) ? 160 : 120){
+        double amp = (n_ref == 20) ? 0.4 : 1.0;
+        r_time[n_ref++] = t;
+        for(int16_t k = -40; k < 100; k++){
+            output[t + k] += amp * (1000 * exp(-k * k / 8.0) - 150 * exp(-(k + 5) * (k + 5) / 4.0) -
+                                    200 * exp(-(k - 5) * (k - 5) / 4.0)) + 250 * exp(-(k - 60) * (k - 60) / 128.0);
+        }
+    }
+    srand(2);
+    for(uint16_t i = 0; i < n; i++){
+        output[i] += 300 * sin(2 * M_PI * 0.3 * i / SAMPLE_FREQ) + (rand() % 41) - 20;
+    }
+    IIRFilterHiPassInit(&hp, SAMPLE_FREQ, 1, ORDER_2);
+    IIRFilterLowPassInit(&lp, SAMPLE_FREQ, 30, ORDER_2);
+    IIRFilterProcess(&hp, output, output_b, n);
+    IIRFilterProcess(&lp, output_b, output_b, n);
+    // blocks of odd size: the detector state goes across the blocks
+    QRSDetectorInit(&detector, &config);
+    uint8_t k = 0;
+    for(uint16_t pos = 0; pos < n; pos += QRS_BLOCK){
+        uint16_t len = (n - pos < QRS_BLOCK) ? n - pos : QRS_BLOCK;
+        uint8_t n_beats = QRSDetectorProcess(&detector, &output_b[pos], len, beats, 4);
+        for(uint8_t b = 0; b < n_beats; b++){
+            error += fabs((double)(beats[b].time - (pos + beats[b].pos)));
+            // skip the beats of the learning phase
+            while(k < n_ref && r_time[k] + 3 < beats[b].time){
+                k++;
+            }
+            if(k < n_ref && fabs((double)beats[b].time - r_time[k]) <= 3){
+                found++;
+                k++;
+            }
+            else{
+                extra++;
+            }
+        }
+    }
+    uint8_t expected = 0;
+    for(k = 0; k < n_ref; k++){
+        expected += (r_time[k] >= 2 * SAMPLE_FREQ);
+    }
+    TestCheck("QRSDetectorProcess (beats)", fabs((double)found - expected) + extra, 0);
+    TestCheck("QRSDetectorProcess (pos)", error, 0);
+    TestCheck("QRSDetectorHeartRate", fabs(QRSDetectorHeartRate(&detector) - 100.0), 0.5);
+}
+/**
+ * @brief Resampled voices (up and down, PCM and ADPCM) against linear interpolation in double precision
+ */
+static void TestAudioMixerResample(uint16_t n, float mean){
+    static int16_t pcm[CAPTURE_MAX_LENGHT];
+    static int16_t mixed[AUDIO_MIXER_MAX_RATIO * CAPTURE_MAX_LENGHT];
+    static int16_t mixed_adpcm[AUDIO_MIXER_MAX_RATIO * CAPTURE_MAX_LENGHT];
+    const float ratios[] = {0.3f, 1.37f, 5.5125f};
+    audio_mixer_t mixer;
+    adpcm_state_t state;
+    double max = 0, max_adpcm = 0;
+    uint8_t active = 0;
+    for(uint16_t i = 0; i < n; i++){
+        pcm[i] = (int16_t)lrintf((signal[i] - mean) * 8);
+    }
+    AdpcmInit(&state);
+    AdpcmEncode(&state, pcm, adpcm_data, n);
+    AdpcmInit(&state);
+    AdpcmDecode(&state, adpcm_data, 0, pcm, n);
+    for(uint8_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++){
+        double ratio = lrintf(ratios[r] * (1 << AUDIO_MIXER_RATIO_SHIFT)) / (double)(1 << AUDIO_MIXER_RATIO_SHIFT);
+        uint32_t lenght = (uint32_t)ceil(n / ratio) + 2;
+        // PCM voice and ADPCM voice of the same samples, mixed in blocks of odd size
+        AudioMixerInit(&mixer);
+        AudioMixerSetRatio(&mixer, AudioMixerPlay(&mixer, pcm, n, 0, 1.0f), ratios[r]);
+        for(uint32_t pos = 0; pos < lenght; pos += ADPCM_CHUNK){
+            AudioMixerProcess(&mixer, &mixed[pos], (lenght - pos < ADPCM_CHUNK) ? lenght - pos : ADPCM_CHUNK);
+        }
+        // released after the last sample
+        active += AudioMixerActiveVoices(&mixer);
+        AudioMixerInit(&mixer);
+        AudioMixerSetRatio(&mixer, AudioMixerPlayADPCM(&mixer, adpcm_data, n, 1.0f), ratios[r]);
+        AudioMixerProcess(&mixer, mixed_adpcm, lenght);
+        for(uint32_t j = 0; j < lenght; j++){
+            double t = j * ratio;
+            uint32_t i = (uint32_t)floor(t);
+            double a = (i < n) ? pcm[i] : 0, b = (i + 1 < n) ? pcm[i + 1] : 0;
+            double e = fabs(mixed[j] - (a + (b - a) * (t - i)));
+            max = (e > max) ? e : max;
+            e = abs(mixed_adpcm[j] - mixed[j]);
+            max_adpcm = (e > max_adpcm) ? e : max_adpcm;
+        }
+    }
+    // interpolation rounding (Q15 fraction)
+    TestCheck("AudioMixerSetRatio (PCM)", max, 1.5);
+    TestCheck("AudioMixerSetRatio (release)", active, 0);
+    TestCheck("AudioMixerSetRatio (ADPCM)", max_adpcm, 0);
+    TestCheck("AudioMixerSetRatio (invalid)", AudioMixerSetRatio(&mixer, 0, AUDIO_MIXER_MAX_RATIO + 1.0f), 0);
+}
+/**
+ * @brief Real FFT round trip, fast convolution (one shot and streaming) and correlation against direct sums
+ */
+static void TestFastConv(uint16_t n, float mean){
+    static float kernel[CONV_KERNEL];
+    static float work[2 * MAX_SIGNAL_LENGHT];
+    static float buffer[FAST_CONV_BUFFER_LENGHT(CONV_FFT)];
+    uint16_t m = (n / 2 < MAX_SIGNAL_LENGHT / 2 - CONV_KERNEL) ? n / 2 : MAX_SIGNAL_LENGHT / 2 - CONV_KERNEL;
+    double scale = 0;
+    for(uint16_t i = 0; i < n; i++){
+        output_b[i] = signal[i] - mean;
+        scale = (fabs(output_b[i]) > scale) ? fabs(output_b[i]) : scale;
+    }
+    // decaying kernel (i.e. a pad onset template)
+    for(uint16_t k = 0; k < CONV_KERNEL; k++){
+        kernel[k] = expf(-k / 20.0f) * cosf(0.3f * k) / 10;
+    }
+    memcpy(work, output_b, n * sizeof(float));
+    FFTRealForward(work, n);
+    FFTRealInverse(work, n);
+    for(uint16_t i = 0; i < n; i++){
+        reference[i] = output_b[i];
+    }
+    TestCheck("FFTRealInverse (round trip)", MaxError(work, reference, n) / scale, 1e-5);
+
+    for(uint16_t i = 0; i < m + CONV_KERNEL - 1; i++){
+        double acc = 0;
+        for(uint16_t k = 0; k < CONV_KERNEL; k++){
+            acc += (i >= k && i - k < m) ? kernel[k] * (double)output_b[i - k] : 0;
+        }
+        reference[i] = acc;
+    }
+    FastConvolve(output_b, m, kernel, CONV_KERNEL, output, work);
+    TestCheck("FastConvolve", MaxError(output, reference, m + CONV_KERNEL - 1) / scale, 1e-5);
+
+    // streaming: output delayed block_lenght samples, pushed in blocks of odd size
+    fast_conv_t conv;
+    double error = !FastConvInit(&conv, kernel, CONV_KERNEL, CONV_FFT, buffer);
+    uint16_t delay = CONV_FFT - CONV_KERNEL + 1;
+    for(uint16_t pos = 0; pos < n; pos += ADPCM_CHUNK){
+        uint16_t len = (n - pos < ADPCM_CHUNK) ? n - pos : ADPCM_CHUNK;
+        FastConvProcess(&conv, &output_b[pos], &output[pos], len);
+    }
+    for(uint16_t i = 0; i < n; i++){
+        double acc = 0;
+        for(uint16_t k = 0; k < CONV_KERNEL && k + delay <= i; k++){
+            acc += kernel[k] * (double)output_b[i - delay - k];
+        }
+        reference[i] = acc;
+    }
+    error += MaxError(output, reference, n) / scale;
+    TestCheck("FastConvProcess", error, 1e-5);
+
+    // the pattern is a piece of the signal: correlation max at its delay
+    uint16_t d = m / 3;
+    for(uint16_t i = 0; i < m + CONV_KERNEL - 1; i++){
+        double acc = 0;
+        for(uint16_t k = 0; k < CONV_KERNEL; k++){
+            int32_t j = (int32_t)i + k - (CONV_KERNEL - 1);
+            acc += (j >= 0 && j < m) ? (double)output_b[j] * output_b[d + k] : 0;
+        }
+        reference[i] = acc;
+    }
+    FastCorrelate(output_b, m, &output_b[d], CONV_KERNEL, output, work);
+    TestCheck("FastCorrelate", MaxError(output, reference, m + CONV_KERNEL - 1) / (scale * scale), 1e-4);
+}
+
+/**
+ * @brief Pipeline sink: stores the block samples at their position in the array ctx
+ */
+static bool PipelineStore(void * ctx, pipeline_block_t * in, pipeline_block_t * out){
+    (void)out;
+    memcpy(&((float *)ctx)[in->time], in->data, in->lenght * sizeof(float));
+    return true;
+}
+
+/**
+ * @brief Push the signal in blocks of PIPE_BLOCK samples to a pipeline
+ */
+static void PipelineRun(pipeline_stage_t * source, pipeline_pool_t * pool, uint16_t n){
+    for(uint16_t pos = 0; pos + PIPE_BLOCK <= n; pos += PIPE_BLOCK){
+        pipeline_block_t * block = PipelineAlloc(pool);
+        if(block == NULL){
+            return;
+        }
+        memcpy(block->data, &signal[pos], PIPE_BLOCK * sizeof(float));
+        block->lenght = PIPE_BLOCK;
+        block->time = pos;
+        PipelinePush(source, block);
+    }
+}
+
+static void TestPipeline(uint16_t n){
+    static float pool_buffer[PIPELINE_POOL_BUFFER_LENGHT(PIPE_BLOCK, PIPE_BLOCKS)];
+    static float fft_buffer[PIPELINE_POOL_BUFFER_LENGHT(PIPE_BLOCK / 2, 2)];
+    static float filtered[CAPTURE_MAX_LENGHT];
+    iir_filter_t iir, iir_ref;
+    pipeline_pool_t pool, fft_pool;
+    pipeline_stage_t source, raw, filter, send, fft, spectrum;
+    n -= n % PIPE_BLOCK;
+    IIRFilterLowPassInit(&iir_ref, SAMPLE_FREQ, 30, 4);
+    IIRFilterProcess(&iir_ref, signal, output_b, n);
+    for(uint16_t i = 0; i < n; i++){
+        reference[i] = output_b[i];
+    }
+
+    // fan out: raw samples and filtered samples, the in place filter connected last (no copies)
+    for(uint8_t filter_first = 0; filter_first < 2; filter_first++){
+        double error = !PipelinePoolInit(&pool, PIPE_BLOCK, PIPE_BLOCKS, pool_buffer);
+        IIRFilterLowPassInit(&iir, SAMPLE_FREQ, 30, 4);
+        PipelineStageInit(&source, PIPELINE_IN_PLACE, NULL, NULL, NULL);
+        PipelineStageInit(&raw, PIPELINE_SINK, PipelineStore, output, NULL);
+        PipelineStageInit(&filter, PIPELINE_IN_PLACE, PipelineIIRStage, &iir, &pool);
+        PipelineStageInit(&send, PIPELINE_SINK, PipelineStore, filtered, NULL);
+        PipelineConnect(&source, filter_first ? &filter : &raw);
+        PipelineConnect(&source, filter_first ? &raw : &filter);
+        PipelineConnect(&filter, &send);
+        PipelineRun(&source, &pool, n);
+        for(uint16_t i = 0; i < n; i++){
+            error += fabsf(output[i] - signal[i]);
+        }
+        error += MaxError(filtered, reference, n);
+        // every block back in the pool, copied only if the filter comes first
+        error += (PipelinePoolFree(&pool) != PIPE_BLOCKS) + (send.blocks != n / PIPE_BLOCK);
+        error += (filter.copies != (filter_first ? n / PIPE_BLOCK : 0)) + filter.dropped;
+        TestCheck(filter_first ? "Pipeline (shared block copied)" : "Pipeline (zero copy fan out)", error, 0);
+    }
+
+    // transform stage: FFT magnitude of each block in a new block
+    fft_plan_t plan;
+    double error = !FFTPlanInit(&plan, PIPE_BLOCK, FFT_WINDOW_HANN, NULL);
+    error += !PipelinePoolInit(&pool, PIPE_BLOCK, PIPE_BLOCKS, pool_buffer);
+    error += !PipelinePoolInit(&fft_pool, PIPE_BLOCK / 2, 2, fft_buffer);
+    PipelineStageInit(&source, PIPELINE_IN_PLACE, NULL, NULL, NULL);
+    PipelineStageInit(&fft, PIPELINE_TRANSFORM, PipelineFFTStage, &plan, &fft_pool);
+    PipelineStageInit(&spectrum, PIPELINE_SINK, PipelineStore, filtered, NULL);
+    PipelineConnect(&source, &fft);
+    PipelineConnect(&fft, &spectrum);
+    PipelineRun(&source, &pool, n);
+    for(uint16_t pos = 0; pos < n; pos += PIPE_BLOCK){
+        FFTPlanMagnitude(&plan, &signal[pos], &output[pos]);
+        for(uint16_t i = 0; i < PIPE_BLOCK / 2; i++){
+            reference[i] = output[pos + i];
+        }
+        error += MaxError(&filtered[pos], reference, PIPE_BLOCK / 2);
+    }
+    error += (PipelinePoolFree(&pool) != PIPE_BLOCKS) + (PipelinePoolFree(&fft_pool) != 2);
+    TestCheck("Pipeline (transform stage)", error, 0);
+    FFTPlanDeinit(&plan);
+}
+/**
+ * @brief Clock synchronization: skew and offset from beacons with random delays, and a master restart
+ */
+static void TestTimeSync(void){
+    // master 40 ppm faster, booted 123 s before; radio delay of 300 us plus exponential jitter, 10 % of the beacons 3 ms late
+    const double skew = 40e-6, boot = 123e6, delay = 300, jitter = 50;
+    time_sync_t sync;
+    double error = 0;
+    uint16_t used = 0;
+    srand(11);
+    TimeSyncInit(&sync, 500);
+    for(uint16_t i = 0; i < 200; i++){
+        double send = boot + i * (double)SYNC_PERIOD_US;
+        double late = delay - jitter * log(1.0 - (rand() + 0.5) / (RAND_MAX + 1.0)) + ((rand() % 10 == 0) ? 3000 : 0);
+        // local time of the reception (the local clock is the ideal one)
+        double local = (send - boot) / (1 + skew) + late;
+        used += TimeSyncUpdate(&sync, (uint64_t)llround(local), (uint64_t)llround(send));
+        if(i >= 2 * TIME_SYNC_WINDOW){
+            // an event half a period later, on the master time base (the constant delay can't be measured)
+            double event = local + SYNC_PERIOD_US / 2;
+            double master = boot + event * (1 + skew) - delay;
+            double e = fabs((double)TimeSyncToMaster(&sync, (uint64_t)llround(event)) - master);
+            error = (e > error) ? e : error;
+        }
+    }
+    TestCheck("TimeSyncToMaster", error, 50);
+    TestCheck("TimeSyncSkew (ppb)", fabs(TimeSyncSkew(&sync) - skew * 1e9), 5000);
+    TestCheck("TimeSyncUpdate (late beacons)", fabs(used - 180.0), 10);
+    uint64_t local = 150000000;
+    TestCheck("TimeSyncToLocal (round trip)", fabs((double)TimeSyncToLocal(&sync, TimeSyncToMaster(&sync, local)) - local), 1);
+    // the master restarts: the model follows it after half a window of rejected beacons
+    for(uint16_t i = 0; i < TIME_SYNC_WINDOW + TIME_SYNC_WINDOW / 2; i++){
+        TimeSyncUpdate(&sync, 200000000ULL + i * SYNC_PERIOD_US, 1000 + i * SYNC_PERIOD_US);
+    }
+    TestCheck("TimeSyncUpdate (master restart)", fabs((double)TimeSyncToMaster(&sync, 200000000ULL) - 1000) + !TimeSyncLocked(&sync), 1);
+}
+/**
+ * @brief Rice codec: lossless round trip of the ECG (with ADC noise), full scale steps, noise, and telemetry records
+ */
+static void TestRice(uint16_t n){
+    int16_t * samples = output_q15;
+    int16_t * decoded = (int16_t *)output_u16;
+    uint8_t * block = adpcm_data;
+    uint32_t bytes = 0, errors = 0;
+    srand(5);
+    for(uint16_t i = 0; i < n; i++){
+        samples[i] = (int16_t)(signal_adc[i] + rand() % 3 - 1);
+    }
+    for(uint16_t pos = 0; pos < n; pos += RICE_BLOCK){
+        uint16_t count = (n - pos < RICE_BLOCK) ? n - pos : RICE_BLOCK;
+        uint16_t lenght = RiceEncode(&samples[pos], count, block, RICE_MAX_LENGHT(count));
+        errors += (RiceDecode(block, lenght, &decoded[pos], count) != lenght);
+    }
+    errors += (memcmp(samples, decoded, n * sizeof(int16_t)) != 0);
+    TestCheck("RiceEncode / RiceDecode (ECG)", errors, 0);
+    // ratio on a signal known to compress (the capture can be any input): a slow
+    // full scale 12 bits sine with 1 LSB of noise, under 13 LSB per sample
+    for(uint16_t i = 0; i < 8 * RICE_BLOCK; i++){
+        samples[i] = (int16_t)lrint(2048 + 2000 * sin(2 * M_PI * i / 1000.0)) + rand() % 3 - 1;
+    }
+    for(uint16_t pos = 0; pos < 8 * RICE_BLOCK; pos += RICE_BLOCK){
+        bytes += RiceEncode(&samples[pos], RICE_BLOCK, block, RICE_MAX_LENGHT(RICE_BLOCK));
+    }
+    TestCheck("RiceEncode (ratio >= 2)", (2.0 * bytes > 8 * RICE_BLOCK * sizeof(int16_t)), 0);
+
+    // full scale steps (escape codes), noise (not compressible) and a truncated block
+    errors = 0;
+    for(uint16_t i = 0; i < RICE_BLOCK; i++){
+        samples[i] = (i % 16 < 8) ? INT16_MIN + i : INT16_MAX - i;
+        samples[RICE_BLOCK + i] = (int16_t)(rand() - RAND_MAX / 2);
+    }
+    uint16_t lenght = RiceEncode(samples, RICE_BLOCK, block, RICE_MAX_LENGHT(RICE_BLOCK));
+    errors += (RiceDecode(block, lenght, decoded, RICE_BLOCK) != lenght) || (memcmp(samples, decoded, RICE_BLOCK * sizeof(int16_t)) != 0);
+    // every truncation of a compressed block is rejected
+    for(uint16_t cut = 0; cut < lenght; cut++){
+        errors += (RiceDecode(block, cut, decoded, RICE_BLOCK) != 0);
+    }
+    lenght = RiceEncode(&samples[RICE_BLOCK], RICE_BLOCK, block, RICE_MAX_LENGHT(RICE_BLOCK));
+    errors += (lenght != RICE_MAX_LENGHT(RICE_BLOCK)) || (block[0] != RICE_RAW) ||
+              (RiceDecode(block, lenght, decoded, RICE_BLOCK) != lenght) ||
+              (memcmp(&samples[RICE_BLOCK], decoded, RICE_BLOCK * sizeof(int16_t)) != 0) ||
+              (RiceDecode(block, lenght - 1, decoded, RICE_BLOCK) != 0);
+    errors += (RiceEncode(&samples[RICE_BLOCK], RICE_BLOCK, block, 100) != 0);
+    TestCheck("RiceEncode / RiceDecode (steps, noise and truncated)", errors, 0);
+
+    // compressed telemetry record
+    telemetry_t telemetry;
+    uint8_t * encoded = (uint8_t *)bank_data;
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD + 2];
+    for(uint16_t i = 0; i < 200; i++){
+        samples[i] = (int16_t)signal_adc[i];
+    }
+    TelemetryInit(&telemetry, TELEMETRY_MAX_PAYLOAD);
+    errors = !TelemetryAdd(&telemetry, 3, TELEMETRY_I16_RICE, samples, 200);
+    lenght = TelemetryEncode(&telemetry, encoded);
+    int16_t p = TelemetryDecode(encoded, lenght - 1, payload);
+    errors += (p < 0) || (payload[2] != TELEMETRY_I16_RICE) || (payload[3] != 200) ||
+              (p != 1 + TELEMETRY_RECORD_HEADER + 1 + payload[4]) ||
+              (RiceDecode(&payload[5], payload[4], decoded, 200) != payload[4]) ||
+              (memcmp(samples, decoded, 200 * sizeof(int16_t)) != 0);
+    TestCheck("TelemetryAdd (TELEMETRY_I16_RICE)", errors, 0);
+}
+/**
+ * @brief Onsets found by the onset detector test
+ */
+typedef struct {
+    uint32_t sample[16];
+    uint16_t count;
+} onset_list_t;
+
+static void OnsetFound(uint32_t sample, float flux, void * param){
+    (void)flux;
+    onset_list_t * list = param;
+    if(list->count < 16){
+        list->sample[list->count++] = sample;
+    }
+}
+/**
+ * @brief Onset detector: loud hits with long ringing, ghost notes and a flam, pushed in blocks of any size
+ */
+static void TestOnsetDetector(void){
+    // hits of two decaying partials over a small noise (pad signal decimated to 2 kHz)
+    const uint32_t hits[] = {200, 600, 1000, 1120, 1600, 2400, 3000};
+    const float amplitude[] = {1.0f, 0.08f, 1.0f, 0.5f, 0.05f, 0.8f, 0.1f};
+    const uint16_t n_hits = sizeof(hits) / sizeof(hits[0]);
+    const uint16_t n = 3600;
+    float * x = output_b;
+    static float buffer[ONSET_BUFFER_LENGHT(ONSET_FRAME)];
+    srand(3);
+    for(uint16_t i = 0; i < n; i++){
+        x[i] = 0.002f * ((float)rand() / RAND_MAX - 0.5f);
+        for(uint16_t h = 0; h < n_hits; h++){
+            if(i >= hits[h]){
+                float t = (float)(i - hits[h]) / ONSET_FREQ;
+                x[i] += amplitude[h] * expf(-t / 0.08f) * (sinf(2 * M_PI * 180 * t) + 0.5f * sinf(2 * M_PI * 470 * t));
+            }
+        }
+    }
+    onset_detector_config_t config = {
+        .sample_frec = ONSET_FREQ,
+        .frame_lenght = ONSET_FRAME,
+        .hop_lenght = ONSET_HOP,
+        .threshold = 0.05f,
+        .multiplier = 2.0f,
+        .min_gap = 30,
+    };
+    onset_detector_t od;
+    onset_list_t list = {.count = 0};
+    OnsetDetectorInit(&od, &config, buffer, OnsetFound, &list);
+    uint16_t found = 0;
+    for(uint16_t pos = 0; pos < n; ){
+        uint16_t lenght = (pos % 7 + 1) * 13;
+        lenght = (n - pos < lenght) ? n - pos : lenght;
+        found += OnsetDetectorProcess(&od, &x[pos], lenght);
+        pos += lenght;
+    }
+    double error = 0;
+    for(uint16_t h = 0; h < n_hits && h < list.count; h++){
+        double e = fabs((double)list.sample[h] - hits[h]);
+        error = (e > error) ? e : error;
+    }
+    TestCheck("OnsetDetectorProcess (onsets)", fabs((double)list.count - n_hits) + fabs((double)found - list.count), 0);
+    TestCheck("OnsetDetectorProcess (onset sample)", error, ONSET_HOP);
+}
+/**
+ * @brief Frame of a synthetic hit for the MFCC test: head (low partials) or rim (high resonances and noise)
+ */
+static void MfccHit(float * x, bool rim, float amplitude){
+    for(uint16_t i = 0; i < MFCC_FRAME; i++){
+        float t = (float)i / MFCC_FREQ;
+        float noise = 0.01f * ((float)rand() / RAND_MAX - 0.5f);
+        if(rim){
+            x[i] = amplitude * expf(-t / 0.01f) * (sinf(2 * M_PI * 2300 * t) + 0.7f * sinf(2 * M_PI * 3400 * t) +
+                   0.5f * ((float)rand() / RAND_MAX - 0.5f)) + noise;
+        }else{
+            x[i] = amplitude * expf(-t / 0.03f) * (sinf(2 * M_PI * 140 * t) + 0.4f * sinf(2 * M_PI * 330 * t)) + noise;
+        }
+    }
+}
+/**
+ * @brief MFCC: coefficients against dense triangles and a direct DCT, and rim / head classification at other velocities
+ */
+static void TestMfcc(void){
+    static float weights[MFCC_BUFFER_LENGHT(MFCC_FRAME)];
+    float * x = output_b;
+    float * power = output;
+    float coeffs[MFCC_COEFFS], centroids[2][MFCC_COEFFS - 1];
+    double ref[MFCC_COEFFS], bands[MFCC_MELS];
+    const uint16_t bins = MFCC_FRAME / 2;
+    mfcc_config_t config = {
+        .sample_frec = MFCC_FREQ,
+        .frame_lenght = MFCC_FRAME,
+        .n_mels = MFCC_MELS,
+        .n_coeffs = MFCC_COEFFS,
+        .min_frec = 60,
+        .max_frec = 4000,
+    };
+    mfcc_t mfcc;
+    fft_plan_t plan;
+    srand(9);
+    double error = !MfccInit(&mfcc, &config, weights);
+    FFTPlanInit(&plan, MFCC_FRAME, FFT_WINDOW_HANN, NULL);
+    FFTPlanSetMagnitude(&plan, FFT_MAG_SQUARED);
+    MfccHit(x, false, 1.0f);
+    FFTPlanMagnitude(&plan, x, power);
+    MfccProcess(&mfcc, power, coeffs);
+    // reference: each triangle over every bin, and the DCT-II sum
+    double mel_min = 2595 * log10(1 + 60 / 700.0), mel_step = (2595 * log10(1 + 4000 / 700.0) - mel_min) / (MFCC_MELS + 1);
+    for(uint16_t m = 0; m < MFCC_MELS; m++){
+        double band = 0;
+        for(uint16_t k = 0; k < bins; k++){
+            double mel = 2595 * log10(1 + k * (double)MFCC_FREQ / MFCC_FRAME / 700.0);
+            double w = 1 - fabs(mel - (mel_min + (m + 1) * mel_step)) / mel_step;
+            band += (w > 0) ? w * power[k] : 0;
+        }
+        bands[m] = log(band + MFCC_FLOOR);
+    }
+    for(uint16_t i = 0; i < MFCC_COEFFS; i++){
+        ref[i] = 0;
+        for(uint16_t m = 0; m < MFCC_MELS; m++){
+            ref[i] += bands[m] * cos(M_PI * i * (m + 0.5) / MFCC_MELS);
+        }
+    }
+    error += MaxError(coeffs, ref, MFCC_COEFFS);
+    TestCheck("MfccProcess", error, 1e-4 * MaxAbs(ref, MFCC_COEFFS));
+
+    // centroids of a loud hit of each type (without c0, the loudness)
+    memcpy(centroids[0], &coeffs[1], sizeof(centroids[0]));
+    MfccHit(x, true, 1.0f);
+    FFTPlanMagnitude(&plan, x, power);
+    MfccProcess(&mfcc, power, coeffs);
+    memcpy(centroids[1], &coeffs[1], sizeof(centroids[1]));
+    uint16_t errors = 0;
+    const float velocities[] = {0.1f, 0.3f, 0.6f, 0.9f};
+    for(uint8_t v = 0; v < 4; v++){
+        for(uint8_t rim = 0; rim < 2; rim++){
+            MfccHit(x, rim, velocities[v]);
+            FFTPlanMagnitude(&plan, x, power);
+            MfccProcess(&mfcc, power, coeffs);
+            errors += (MfccClassify(&coeffs[1], MFCC_COEFFS - 1, &centroids[0][0], 2) != rim);
+        }
+    }
+    TestCheck("MfccClassify (rim / head)", errors, 0);
+    FFTPlanDeinit(&plan);
+}
+/**
+ * @brief STFT function of the audio reactive test
+ */
+static void TestAudioReactiveFrame(const float * magnitude, uint16_t bins, void * param){
+    AudioReactiveProcess((audio_reactive_t *)param, magnitude, bins);
+}
+
+/**
+ * @brief Audio reactive levels of a tone fed through an STFT: its band lit (and
+ * only it), the release after the tone, and the colors of the stripe
+ */
+static void TestAudioReactive(void){
+    static const uint32_t palette[AR_BANDS] = {
+        0xFF0000, 0xFF7D00, 0x7F7F00, 0x00FF00, 0x00FF7D, 0x00F7F7, 0x0000FF, 0x7D00FF
+    };
+    audio_reactive_config_t config = {
+        .sample_frec = MFCC_FREQ,
+        .frame_lenght = MFCC_FRAME,
+        .hop_lenght = AR_HOP,
+        .n_bands = AR_BANDS,
+        .min_frec = 60,
+        .max_frec = 4000,
+        .attack_ms = 0,
+        .release_ms = 100,
+        .range_db = 40,
+        .min_peak = 1e-6f,
+        .palette = palette,
+    };
+    audio_reactive_t ar;
+    stft_t stft;
+    uint32_t colors[AR_BANDS];
+    uint16_t errors = !AudioReactiveInit(&ar, &config);
+    STFTInit(&stft, MFCC_FRAME, AR_HOP, FFT_WINDOW_HANN, stft_buffer, TestAudioReactiveFrame, &ar);
+    // band of the tone: log spaced edges between 60 and 4000 Hz
+    uint8_t band = (uint8_t)(AR_BANDS * log(AR_TONE / 60.0) / log(4000 / 60.0));
+    for(uint16_t i = 0; i < 4 * MFCC_FRAME; i++){
+        output[i] = sinf(2 * M_PI * AR_TONE * i / MFCC_FREQ);
+    }
+    STFTProcess(&stft, output, 4 * MFCC_FRAME);
+    const float * level = AudioReactiveLevels(&ar);
+    for(uint8_t b = 0; b < AR_BANDS; b++){
+        errors += (b == band) ? (level[b] < 0.999f) : (level[b] > 0.5f);
+    }
+    AudioReactiveRender(&ar, colors, AR_BANDS);
+    errors += (colors[band] != palette[band]);
+    // one LED mixes all the bands (saturated)
+    AudioReactiveRender(&ar, colors, 1);
+    errors += ((colors[0] & 0xFF) < (palette[band] & 0xFF));
+    // silence (once the tone left the frame): the level falls with the release time (100 ms = 12.5 hops)
+    memset(output, 0, CAPTURE_MAX_LENGHT * sizeof(float));
+    STFTProcess(&stft, output, MFCC_FRAME);
+    float lit = level[band];
+    STFTProcess(&stft, output, AR_HOP);
+    errors += !(level[band] < lit && level[band] > 0.9f * lit);
+    STFTProcess(&stft, output, CAPTURE_MAX_LENGHT);
+    errors += (level[band] > 0.01f);
+    TestCheck("AudioReactive (tone band, release)", errors, 0);
+}
+/**
+ * @brief Table based math against libm in double, with the bounds documented in fast_math.h
+ */
+static void TestFastMath(void){
+    double error = 0, error_q15 = 0, error_exp = 0, error_log = 0, error_sqrt = 0, error_pow = 0;
+    for(uint32_t i = 0; i <= FAST_MATH_STEPS; i++){
+        // angles of +-100 rad, margin of the argument reduction included
+        float x = -100.0f + 200.0f * i / FAST_MATH_STEPS;
+        double bound = 5e-6 + 6e-8 * fabs(x);
+        error = fmax(error, fabs(FastSinf(x) - sin(x)) / bound);
+        error = fmax(error, fabs(FastCosf(x) - cos(x)) / bound);
+        // exponents of 2^-30 to 2^30 and e^-20 to e^20
+        x = -30.0f + 60.0f * i / FAST_MATH_STEPS;
+        error_exp = fmax(error_exp, fabs(FastExp2f(x) / exp2(x) - 1) / 1.1e-6);
+        x = -20.0f + 40.0f * i / FAST_MATH_STEPS;
+        error_exp = fmax(error_exp, fabs(FastExpf(x) / exp(x) - 1) / (1.2e-6 + 6e-8 * fabs(x)));
+        // values of 1e-6 to 1e6
+        x = powf(10, -6.0f + 12.0f * i / FAST_MATH_STEPS);
+        error_log = fmax(error_log, fabs(FastLog2f(x) - log2(x)) / (3e-6 + 6e-8 * fabs(log2(x))));
+        error_log = fmax(error_log, fabs(FastLogf(x) - log(x)) / (2e-6 + 1e-7 * fabs(log(x))));
+        error_log = fmax(error_log, fabs(FastLog10f(x) - log10(x)) / (1e-6 + 1e-7 * fabs(log10(x))));
+        error_sqrt = fmax(error_sqrt, fabs(FastSqrtf(x) / sqrt(x) - 1) / 2e-6);
+        float y = -3.0f + 6.0f * i / FAST_MATH_STEPS;
+        if(fabs(y * log2(x)) < 100){
+            error_pow = fmax(error_pow, fabs(FastPowf(x, y) / pow(x, y) - 1) / (1.2e-6 + 2.1e-6 * fabs(y) + 1e-7 * fabs(y * log2(x))));
+        }
+    }
+    for(uint32_t phase = 0; phase < FAST_MATH_Q15_TURN; phase++){
+        double angle = 2 * M_PI * phase / FAST_MATH_Q15_TURN;
+        error_q15 = fmax(error_q15, fabs(FastSinQ15(phase) - fmin(32767, 32768 * sin(angle))));
+        error_q15 = fmax(error_q15, fabs(FastCosQ15(phase) - fmin(32767, 32768 * cos(angle))));
+    }
+    TestCheck("FastSinf, FastCosf (error / bound)", error, 1);
+    TestCheck("FastSinQ15, FastCosQ15 (LSB)", error_q15, 1.1);
+    TestCheck("FastExp2f, FastExpf (error / bound)", error_exp, 1);
+    TestCheck("FastLog2f, FastLogf, FastLog10f (error / bound)", error_log, 1);
+    TestCheck("FastSqrtf (error / bound)", error_sqrt, 1);
+    TestCheck("FastPowf (error / bound)", error_pow, 1);
+    uint16_t errors = (FastLog2f(0) != -INFINITY) + (FastLog2f(-1) != -INFINITY) + (FastSqrtf(-1) != 0) +
+        (FastExp2f(200) != INFINITY) + (FastExp2f(-200) != 0) + (FastPowf(0, 2) != 0) +
+        (FastSqrtf(4) != 2) + (FastLog2f(8) != 3) + (FastExp2f(-3) != 0.125f) + (FastSinQ15(FAST_MATH_Q15_TURN / 4) != 32767);
+    TestCheck("FastMath (limits, exact points)", errors, 0);
+}
+/**
+ * @brief Hi-hat pedal with a noisy sensor: one value per step while it moves, none
+ * while it stands still, the close and open crossings, and the MIDI message of a value
+ */
+static void TestControllerInput(void){
+    controller_input_config_t config = {
+        .sample_frec = PEDAL_FREQ,
+        .open_level = 2500,
+        .closed_level = 500,
+        .time_ms = 10,
+        .steps = 128,
+        .hysteresis = 0.5f,
+        .close_position = 0.9f,
+    };
+    static controller_event_t events[PEDAL_LENGHT];
+    controller_input_t pedal;
+    uint16_t errors = !ControllerInputInit(&pedal, &config);
+    srand(140);
+    // released, pressed along PEDAL_LENGHT samples, held pressed, released at once
+    for(uint16_t i = 0; i < 4 * PEDAL_LENGHT; i++){
+        float level = (i < PEDAL_LENGHT) ? 2500 : (i < 2 * PEDAL_LENGHT) ? 2500 - 2000.0f * (i - PEDAL_LENGHT) / PEDAL_LENGHT :
+            (i < 3 * PEDAL_LENGHT) ? 500 : 2500;
+        output[i] = level + 20.0f * ((float)rand() / RAND_MAX - 0.5f);
+    }
+    uint16_t n = ControllerInputProcess(&pedal, output, PEDAL_LENGHT, events, PEDAL_LENGHT);
+    errors += (n != 1) || (events[0].type != CONTROLLER_VALUE) || (events[0].value != 0);
+    // the ramp: one value per step crossed, the close crossing once
+    n = ControllerInputProcess(&pedal, &output[PEDAL_LENGHT], PEDAL_LENGHT, events, PEDAL_LENGHT);
+    uint16_t values = 0, closed = 0;
+    for(uint16_t k = 0; k < n; k++){
+        values += (events[k].type == CONTROLLER_VALUE);
+        closed += (events[k].type == CONTROLLER_CLOSED);
+    }
+    errors += (values < 100) || (values > 128) || (closed != 1);
+    // held: the last steps of the smoothing, then nothing while it stands still
+    ControllerInputProcess(&pedal, &output[2 * PEDAL_LENGHT], PEDAL_LENGHT / 5, events, PEDAL_LENGHT);
+    n = ControllerInputProcess(&pedal, &output[2 * PEDAL_LENGHT + PEDAL_LENGHT / 5], PEDAL_LENGHT - PEDAL_LENGHT / 5, events, PEDAL_LENGHT);
+    errors += (n > 0) || (ControllerInputValue(&pedal) < 126) || (ControllerInputOpenAmount(&pedal) > 0.01f);
+    n = ControllerInputProcess(&pedal, &output[3 * PEDAL_LENGHT], PEDAL_LENGHT, events, PEDAL_LENGHT);
+    uint16_t opened = 0;
+    for(uint16_t k = 0; k < n; k++){
+        opened += (events[k].type == CONTROLLER_OPENED);
+    }
+    errors += (opened != 1) || (ControllerInputValue(&pedal) > 1);
+    uint8_t msg[MIDI_MSG_MAX_LENGHT];
+    MidiControlChange(MIDI_DRUMS_CHANNEL, MIDI_CC_FOOT, 127, msg);
+    errors += (msg[0] != 0xB9) || (msg[1] != 4) || (msg[2] != 127);
+    TestCheck("ControllerInputProcess (change only events)", errors, 0);
+}
+/**
+ * @brief qsort comparison of floats
+ */
+static int CompareFloat(const void * a, const void * b){
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+/**
+ * @brief Running median against the sorted window (float and int16, odd and even windows, filling and in blocks),
+ * and a baseline with spikes
+ */
+static void TestMedianFilter(void){
+    static float samples[MEDIAN_WINDOW], sorted[MEDIAN_WINDOW];
+    static int16_t samples_i16[MEDIAN_WINDOW], index[MEDIAN_FILTER_INDEX_LENGHT(MEDIAN_WINDOW)];
+    static int16_t input_i16[PEDAL_LENGHT], output_i16[PEDAL_LENGHT];
+    median_filter_t filter;
+    median_filter_i16_t filter_i16;
+    double error = 0;
+    uint16_t errors = MedianFilterInit(&filter, samples, index, 0);
+    srand(145);
+    for(uint16_t window = 1; window <= MEDIAN_WINDOW; window++){
+        // few levels: repeated samples
+        int16_t levels = (window & 2) ? 5 : 2000;
+        for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+            input_i16[i] = (int16_t)(rand() % levels - levels / 2);
+            output[i] = 0.1f * input_i16[i];
+        }
+        errors += !MedianFilterInit(&filter, samples, index, window);
+        MedianFilterProcess(&filter, output, output, PEDAL_LENGHT / 3);
+        MedianFilterProcess(&filter, &output[PEDAL_LENGHT / 3], &output[PEDAL_LENGHT / 3], PEDAL_LENGHT - PEDAL_LENGHT / 3);
+        for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+            uint16_t n = (i + 1 < window) ? i + 1 : window;
+            for(uint16_t k = 0; k < n; k++){
+                sorted[k] = 0.1f * input_i16[i + 1 - n + k];
+            }
+            qsort(sorted, n, sizeof(float), CompareFloat);
+            float median = (n & 1) ? sorted[n / 2] : 0.5f * (sorted[n / 2 - 1] + sorted[n / 2]);
+            error = fmax(error, fabsf(output[i] - median));
+        }
+        // the int16 filter gives the same median (the mean of two samples rounded down)
+        errors += !MedianFilterI16Init(&filter_i16, samples_i16, index, window);
+        MedianFilterI16Process(&filter_i16, input_i16, output_i16, PEDAL_LENGHT);
+        MedianFilterI16Reset(&filter_i16);
+        MedianFilterI16Process(&filter_i16, input_i16, output_i16, PEDAL_LENGHT);
+        for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+            errors += (output_i16[i] != (int16_t)floorf(10.0f * output[i] + 0.01f));
+        }
+    }
+    // baseline with spikes of up to 3 samples: a window of 7 removes them
+    errors += !MedianFilterInit(&filter, samples, index, 7);
+    for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+        output[i] = 1.5f + ((i % 50 >= 20 && i % 50 < 23) ? 100.0f * (i % 50 - 19) : 0.0f);
+    }
+    MedianFilterProcess(&filter, output, output, PEDAL_LENGHT);
+    for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+        errors += (output[i] != 1.5f);
+    }
+    TestCheck("MedianFilterProcess (sorted window, spikes)", error + errors, 1e-5);
+}
+/**
+ * @brief Scalar Kalman filter of a noisy constant (mean of the first values, steady variance) and alpha-beta filter
+ * of a ramp (no lag, rate)
+ */
+static void TestTrackingFilter(void){
+    const float process_var = 1e-4f, noise_var = 1.0f;
+    kalman_1d_t kf;
+    alpha_beta_t ab;
+    uint16_t errors = Kalman1DInit(&kf, 0, noise_var) + AlphaBetaInit(&ab, 0.5f, 3.5f, 0.1f);
+    errors += !Kalman1DInit(&kf, process_var, noise_var);
+    srand(146);
+    double error = 0, mean = 0;
+    for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+        // uniform noise of variance noise_var
+        float z = 10.0f + sqrtf(12.0f * noise_var) * ((float)rand() / RAND_MAX - 0.5f);
+        float x = Kalman1DUpdate(&kf, z);
+        mean += z;
+        if(i < 10){
+            error = fmax(error, fabs(x - mean / (i + 1)) / 0.05);
+        }
+    }
+    // steady variance of the estimation: p (p + q) = q r
+    double p = (-process_var + sqrt((double)process_var * process_var + 4.0 * process_var * noise_var)) / 2;
+    error = fmax(error, fabs(Kalman1DVariance(&kf) - p) / p / 1e-2);
+    error = fmax(error, fabs(Kalman1DValue(&kf) - 10.0f) / (3 * sqrt(p)));
+    errors += !AlphaBetaInitNoise(&ab, 0.1f, 0.5f, 0.1f);
+    for(uint16_t i = 0; i < PEDAL_LENGHT; i++){
+        float x = AlphaBetaUpdate(&ab, 2.0f + 0.5f * 0.1f * i);
+        if(i >= PEDAL_LENGHT - 10){
+            error = fmax(error, fabs(x - (2.0f + 0.5f * 0.1f * i)) / 1e-3);
+        }
+    }
+    error = fmax(error, fabs(AlphaBetaRate(&ab) - 0.5f) / 1e-3);
+    TestCheck("Kalman1DUpdate / AlphaBetaUpdate (relative)", error + errors, 1);
+}
+/**
+ * @brief Capture of a synthetic hit after a quiet tone (pre-roll in order, normalized, faded out) and its
+ * round trip through the flash bank (simulated partition, written sector by sector)
+ */
+static void TestSampleCapture(void){
+    const sample_capture_config_t config = {
+        .sample_frec = 20000, .decimation = 2, .threshold = 400, .full_scale = 2000,
+        .pre_ms = 2, .release_ms = 10, .end_level = 0.02f, .peak = 0.9f
+    };
+    sample_capture_t sc;
+    sample_t sample;
+    sample_bank_t bank;
+    uint16_t n = 2 * HIT_CAPTURE_AT;
+    int16_t * recorded = output_q15;
+    uint16_t errors = SampleCaptureInit(&sc, &config, recorded, config.pre_ms * 10);
+    errors += !SampleCaptureInit(&sc, &config, recorded, HIT_CAPTURE_MAX);
+    // a 50 mV tone under the threshold, then a decaying 500 Hz hit
+    for(uint16_t i = 0; i < n; i++){
+        float t = (i < HIT_CAPTURE_AT) ? 0 : (i - HIT_CAPTURE_AT) / 20000.0f;
+        output[i] = (i < HIT_CAPTURE_AT) ? 50.0f * sinf(2 * M_PI * 300 * i / 20000.0f) :
+                    1500.0f * expf(-t / 0.005f) * sinf(2 * M_PI * 500 * t);
+    }
+    errors += (SampleCaptureProcess(&sc, output, 64) != SAMPLE_CAPTURE_IDLE);
+    SampleCaptureStart(&sc);
+    for(uint16_t pos = 0; pos < n; pos += 64){
+        SampleCaptureProcess(&sc, &output[pos], 64);
+    }
+    errors += !SampleCaptureGet(&sc, &sample);
+    errors += (sample.data != recorded) + (sample.sample_rate != 10000) + (sample.format != SAMPLE_PCM16);
+    errors += (sample.lenght >= HIT_CAPTURE_MAX) + (sample.lenght < 100 + 20 + 100);
+    // averages of pairs from the pair of the onset (20 pre-roll samples before it), normalized
+    uint16_t onset = HIT_CAPTURE_AT;
+    while(fabsf(output[onset]) < config.threshold){
+        onset++;
+    }
+    onset &= ~1;
+    double peak = 0, max = 0;
+    for(uint16_t j = 0; j < sample.lenght; j++){
+        output_b[j] = (output[onset + 2 * (j - 20)] + output[onset + 2 * (j - 20) + 1]) / 2;
+        peak = fmax(peak, fabsf(output_b[j]));
+    }
+    int16_t top = 0;
+    for(uint16_t j = 0; j < sample.lenght; j++){
+        top = (abs(recorded[j]) > top) ? abs(recorded[j]) : top;
+        if(j + 10 * 10U < sample.lenght){
+            max = fmax(max, fabs(recorded[j] - output_b[j] / peak * 0.9f * INT16_MAX));
+        } else {
+            // release: under end_level of the peak and fading out
+            max = fmax(max, abs(recorded[j]) - (0.02 * 0.9 * INT16_MAX) * (sample.lenght - j) / 100.0);
+        }
+    }
+    errors += (top != (int16_t)(0.9f * INT16_MAX));
+    TestCheck("SampleCaptureProcess (LSB)", max + errors, 3);
+    // to the bank: PCM, ADPCM (encoded while written) and the ADPCM one replaced
+    errors = SampleBankWrite(SIM_PARTITION_LABEL, "pcm", recorded, SIM_PARTITION_SIZE, 10000, SAMPLE_PCM16);
+    errors += SampleBankWrite(SIM_PARTITION_LABEL, "long_name_12", recorded, sample.lenght, 10000, SAMPLE_PCM16);
+    errors += !SampleBankWrite(SIM_PARTITION_LABEL, "pcm", recorded, HIT_CAPTURE_MAX, 10000, SAMPLE_PCM16);
+    errors += !SampleBankWrite(SIM_PARTITION_LABEL, "hit", recorded, HIT_CAPTURE_MAX, 10000, SAMPLE_ADPCM);
+    errors += !SampleBankWrite(SIM_PARTITION_LABEL, "hit", recorded, sample.lenght, 10000, SAMPLE_ADPCM);
+    errors += !SampleBankLoad(&bank, SIM_PARTITION_LABEL);
+    errors += (SampleBankCount(&bank) != 2) + (SampleBankFind(&bank, "hit") != 1);
+    adpcm_state_t state;
+    AdpcmInit(&state);
+    AdpcmEncode(&state, recorded, adpcm_data, sample.lenght);
+    SampleBankGet(&bank, 0, &sample);
+    errors += (sample.lenght != HIT_CAPTURE_MAX) || memcmp(sample.data, recorded, HIT_CAPTURE_MAX * sizeof(int16_t));
+    SampleBankGet(&bank, 1, &sample);
+    errors += (sample.format != SAMPLE_ADPCM) || memcmp(sample.data, adpcm_data, ADPCM_BYTES(sample.lenght));
+    SampleBankUnload(&bank);
+    esp_partition_sim_erase();
+    TestCheck("SampleBankWrite", errors, 0);
+}
+/**
+ * @brief Fixed size matrix kernels against the double products (3x3, 4x4, 13x13 and the EKF covariance update)
+ */
+static void TestSmallMatrix(void){
+    float a[13 * 13], b[13 * 13], c[13 * 13], work[13 * 13], d[18], g[13 * 18];
+    double ref[13 * 13];
+    double error = 0;
+    srand(13);
+    for(uint16_t i = 0; i < 13 * 18; i++){
+        g[i] = (float)rand() / RAND_MAX - 0.5f;
+        if(i < 13 * 13){
+            a[i] = (float)rand() / RAND_MAX - 0.5f;
+        }
+        if(i < 18){
+            d[i] = (float)rand() / RAND_MAX;
+        }
+    }
+    // b symmetric (a covariance)
+    for(uint16_t i = 0; i < 13; i++){
+        for(uint16_t j = 0; j <= i; j++){
+            b[i * 13 + j] = b[j * 13 + i] = (float)rand() / RAND_MAX - 0.5f;
+        }
+    }
+    const uint8_t sizes[3] = {3, 4, 13};
+    for(uint8_t s = 0; s < 3; s++){
+        uint8_t n = sizes[s];
+        for(uint16_t i = 0; i < n; i++){
+            for(uint16_t j = 0; j < n; j++){
+                ref[i * n + j] = 0;
+                for(uint16_t k = 0; k < n; k++){
+                    ref[i * n + j] += (double)a[i * n + k] * b[k * n + j];
+                }
+            }
+        }
+        (n == 3) ? SmallMatMul3(a, b, c) : (n == 4) ? SmallMatMul4(a, b, c) : SmallMatMul13(a, b, c);
+        error += MaxError(c, ref, n * n);
+    }
+    SmallMatMulVec13(a, b, c);
+    for(uint16_t i = 0; i < 13; i++){
+        ref[i] = 0;
+        for(uint16_t k = 0; k < 13; k++){
+            ref[i] += (double)a[i * 13 + k] * b[k];
+        }
+    }
+    error += MaxError(c, ref, 13);
+    TestCheck("SmallMatMul (3, 4, 13)", error, 1e-5);
+
+    // a * b * a' + 0.5 * g * diag(d) * g'
+    for(uint16_t i = 0; i < 13; i++){
+        for(uint16_t j = 0; j < 13; j++){
+            double acc = 0;
+            for(uint16_t k = 0; k < 13; k++){
+                for(uint16_t l = 0; l < 13; l++){
+                    acc += (double)a[i * 13 + k] * b[k * 13 + l] * a[j * 13 + l];
+                }
+            }
+            for(uint16_t k = 0; k < 18; k++){
+                acc += 0.5 * g[i * 18 + k] * d[k] * g[j * 18 + k];
+            }
+            ref[i * 13 + j] = acc;
+        }
+    }
+    SmallMatSymABAt13(a, b, work, c);
+    SmallMatSymAddGDGt13x18(g, d, 0.5f, c);
+    error = MaxError(c, ref, 13 * 13);
+    for(uint16_t i = 0; i < 13; i++){
+        for(uint16_t j = 0; j < i; j++){
+            error += (c[i * 13 + j] != c[j * 13 + i]);
+        }
+    }
+    TestCheck("SmallMatSymABAt13 / SmallMatSymAddGDGt13x18", error, 1e-5);
+}
+/*==================[external functions definition]==========================*/
+int TestSignalProcessing(const float * capture, uint16_t lenght){
+    uint16_t n = 4;
+    float mean = 0;
+    failed = 0;
+    // largest power of two available in the capture
+    while(2 * n <= lenght && 2 * n <= MAX_SIGNAL_LENGHT){
+        n *= 2;
+    }
+    for(uint16_t i = 0; i < n; i++){
+        signal[i] = capture[i];
+        signal_adc[i] = (uint16_t)lrintf(capture[i]);
+        mean += capture[i] / n;
+    }
+    printf("Golden output tests (%u samples)\n", n);
+    FFTInit();
+    FFTQ15Init();
+    TestFFT(n, mean);
+    TestSTFT(n);
+    TestIIR(n);
+    TestFIR(n, mean);
+    TestFIRFloat(n, mean);
+    TestGoertzel(n, mean);
+    TestAudioMixer(n, mean);
+    TestAudioMixerVoices();
+    TestAudioMixerBus();
+    TestADPCM(n, mean);
+    TestSampleBank(n);
+    TestHitDetector();
+    TestHitCrosstalk();
+    TestNoiseFloor();
+    TestPadSettings();
+    TestVelocityCurve();
+    TestMIDI();
+    TestTelemetry(n);
+    TestScopeStream(n);
+    TestImuFusion();
+    TestQRSDetector();
+    TestAudioMixerResample(n, mean);
+    TestFastConv(n, mean);
+    TestPipeline(n);
+    TestTimeSync();
+    TestRice(n);
+    TestOnsetDetector();
+    TestMfcc();
+    TestSmallMatrix();
+    TestAudioReactive();
+    TestFastMath();
+    TestControllerInput();
+    TestMedianFilter();
+    TestTrackingFilter();
+    TestSampleCapture();
+    printf("%d tests failed\n", failed);
+    return failed;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,38 @@
+/**
+ * @file test_sim.h
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Host simulation tests and benchmarks of the signal_processing middleware
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef TEST_SIM_H_
+#define TEST_SIM_H_
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define CAPTURE_MAX_LENGHT  4096    /*!< Max number of samples of a capture file */
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Run the golden output tests against double precision reference models
+ *
+ * @param capture       Recorded signal (ADC counts)
+ * @param lenght        Number of samples of the capture
+ * @return int          Number of failed tests
+ */
+int TestSignalProcessing(const float * capture, uint16_t lenght);
+
+/**
+ * @brief Run the benchmarks and print a table with the time of every function
+ *
+ * @param capture       Recorded signal (ADC counts), repeated to fill the test signals
+ * @param lenght        Number of samples of the capture
+ */
+void BenchSignalProcessing(const float * capture, uint16_t lenght);
+
+#endif /* TEST_SIM_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""
+Host side decoder of the plot frames of ble_plot_mcu.h.
+
+Connects to the board (requires bleak), subscribes to one stream of the
+sensor service and prints one line per sample with the values of every
+channel:
+
+    index ch0 ch1 ...
+
+With --csv the lines are comma separated. Gaps in the index (frames lost or
+dropped by the board) are reported on stderr; an empty line separates the
+blocks (frames with the END flag, i.e. one spectrum).
+
+Usage:
+    python3 ble_plot_decoder.py ESP_EDU_1 --stream 0 --csv > ecg.csv
+"""
+
+import argparse
+import asyncio
+import struct
+import sys
+
+HEADER = "<HBBf"
+HEADER_SIZE = struct.calcsize(HEADER)
+FLAG_END = 0x01
+STREAM_UUID = "e5d5%04x-8b2f-4c3a-9d1e-6a7b8c9d0e1f"
+
+
+def decode_frame(frame):
+    """Returns (index, flags, [(ch0, ch1, ...), ...]) or None if the frame is not valid"""
+    if len(frame) < HEADER_SIZE:
+        return None
+    index, channels, flags, scale = struct.unpack_from(HEADER, frame)
+    data = frame[HEADER_SIZE:]
+    if channels == 0 or len(data) % (2 * channels):
+        return None
+    values = [v * scale for v in struct.unpack("<%dh" % (len(data) // 2), data)]
+    return index, flags, [tuple(values[i:i + channels]) for i in range(0, len(values), channels)]
+
+
+async def run(args):
+    from bleak import BleakClient, BleakScanner
+
+    separator = "," if args.csv else " "
+    expected = [0]
+
+    def notify(_, frame):
+        decoded = decode_frame(bytes(frame))
+        if decoded is None:
+            print("invalid frame (%d bytes)" % len(frame), file=sys.stderr)
+            return
+        index, flags, samples = decoded
+        if index != expected[0]:
+            print("lost samples: %d" % ((index - expected[0]) & 0xFFFF), file=sys.stderr)
+        for i, values in enumerate(samples):
+            print(separator.join(["%d" % ((index + i) & 0xFFFF)] + ["%g" % v for v in values]))
+        expected[0] = (index + len(samples)) & 0xFFFF
+        if flags & FLAG_END:
+            print()
+            expected[0] = 0
+
+    device = await BleakScanner.find_device_by_name(args.name)
+    if device is None:
+        sys.exit("device %s not found" % args.name)
+    async with BleakClient(device) as client:
+        await client.start_notify(STREAM_UUID % (args.stream + 1), notify)
+        while client.is_connected:
+            await asyncio.sleep(1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="BLE plot stream decoder")
+    parser.add_argument("name", help="device name (ble_config_t.device_name)")
+    parser.add_argument("--stream", type=int, default=0, help="stream of the sensor service")
+    parser.add_argument("--csv", action="store_true", help="comma separated output")
+    args = parser.parse_args()
+    try:
+        asyncio.run(run(args))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
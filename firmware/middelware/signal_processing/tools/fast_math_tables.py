@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Lookup tables of fast_math.c (signal_processing/src/fast_math_tables.h).
+
+Each table has the values of a function at equally spaced points of one
+segment (a quarter turn, an octave), plus the end point, so fast_math.c
+interpolates between two entries without checking the index:
+
+    python3 fast_math_tables.py -o ../src/fast_math_tables.h
+
+The sizes must match the FAST_MATH_*_TABLE macros of fast_math.h.
+"""
+
+import argparse
+import math
+import sys
+
+SIN_TABLE = 256     # segments of a quarter turn
+EXP_TABLE = 256     # segments of 2^f, f in [0, 1)
+LOG_TABLE = 256     # segments of log2(m), m in [1, 2)
+SQRT_TABLE = 128    # segments of sqrt(m) in each of [1, 2) and [2, 4)
+
+
+def float_table(name, values, comment):
+    lines = ["/** %s */" % comment, "static const float %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), 4):
+        lines.append("    " + " ".join("%.9ef," % v for v in values[i:i + 4]))
+    lines.append("};")
+    return lines
+
+
+def int_table(name, values, comment):
+    lines = ["/** %s */" % comment, "static const int16_t %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), 8):
+        lines.append("    " + " ".join("%6d," % v for v in values[i:i + 8]))
+    lines.append("};")
+    return lines
+
+
+def tables():
+    sin_f = [math.sin(k * math.pi / 2 / SIN_TABLE) for k in range(SIN_TABLE + 1)]
+    sin_q15 = [min(32767, round(32768 * v)) for v in sin_f]
+    exp2 = [2 ** (k / EXP_TABLE) for k in range(EXP_TABLE + 1)]
+    log2 = [math.log2(1 + k / LOG_TABLE) for k in range(LOG_TABLE + 1)]
+    sqrt = [math.sqrt(1 + k / SQRT_TABLE) for k in range(SQRT_TABLE)]
+    sqrt += [math.sqrt(2 + 2 * k / SQRT_TABLE) for k in range(SQRT_TABLE + 1)]
+    lines = [
+        "/**",
+        " * @file fast_math_tables.h",
+        " * @brief Lookup tables of fast_math.c",
+        " *",
+        " * Generated by fast_math_tables.py (signal_processing/tools), do not edit.",
+        " */",
+        "",
+        "#ifndef FAST_MATH_TABLES_H_",
+        "#define FAST_MATH_TABLES_H_",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    lines += float_table("sin_table", sin_f, "sin(k * pi / 2 / %d), quarter turn" % SIN_TABLE) + [""]
+    lines += int_table("sin_table_q15", sin_q15, "sin(k * pi / 2 / %d) in Q15 (32767 at k = %d)" % (SIN_TABLE, SIN_TABLE)) + [""]
+    lines += float_table("exp2_table", exp2, "2^(k / %d)" % EXP_TABLE) + [""]
+    lines += float_table("log2_table", log2, "log2(1 + k / %d)" % LOG_TABLE) + [""]
+    lines += float_table("sqrt_table", sqrt, "sqrt(1 + k / %d) for k < %d, then sqrt(2 + 2 * k / %d)"
+                         % (SQRT_TABLE, SQRT_TABLE, SQRT_TABLE)) + [""]
+    lines += ["#endif /* FAST_MATH_TABLES_H_ */", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Lookup tables of fast_math.c")
+    parser.add_argument("-o", "--output", help="header file (default: stdout)")
+    args = parser.parse_args()
+    text = tables()
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
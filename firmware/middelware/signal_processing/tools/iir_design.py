@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Compile time Butterworth filter design for iir_filter.h.
+
+Writes a C header with the coefficients of the 2nd order sections as a const
+table (stored in flash) and a step function with the cascade unrolled for the
+chosen order, so fixed filters need no IIRFilter...Init() at startup and the
+sample loop has no loop over the sections:
+
+    python3 iir_design.py ecg_lp lowpass 200 40 --order 4 -o main/ecg_lp.h
+    python3 iir_design.py ecg_bp bandpass 200 0.5,40 --order 2 -o main/ecg_bp.h
+
+The design is the one of IIRFilterLowPassInit(), IIRFilterHiPassInit() and
+IIRFilterBandPassInit() (esp-dsp biquad formulas, Butterworth Q per section),
+so the generated filter matches the runtime one. In the application:
+
+    #include "ecg_lp.h"
+    static float delay[ECG_LP_SECTIONS][2];     // zeroed: filter at rest
+    ...
+    EcgLpProcess(delay, input, output, lenght);
+"""
+
+import argparse
+import math
+import sys
+
+IIR_MAX_SECTIONS = 8
+TYPES = {"lowpass": "Low pass", "highpass": "Hi pass", "bandpass": "Band pass"}
+
+
+def butterworth_sections(order):
+    """Number of sections of a Butterworth design (as ButterworthSections())"""
+    return min((order + 1) // 2, IIR_MAX_SECTIONS)
+
+
+def butterworth_q(k, order):
+    """Q factor of the k-th section of an order N Butterworth filter"""
+    return 1.0 / (2.0 * math.sin((2 * k + 1) * math.pi / (2.0 * order)))
+
+
+def biquad(kind, f, q):
+    """b0, b1, b2, a1, a2 of dsps_biquad_gen_lpf_f32 / dsps_biquad_gen_hpf_f32"""
+    w0 = 2 * math.pi * f
+    c = math.cos(w0)
+    alpha = math.sin(w0) / (2 * max(q, 0.0001))
+    if kind == "lowpass":
+        b0, b1 = (1 - c) / 2, 1 - c
+    else:
+        b0, b1 = (1 + c) / 2, -(1 + c)
+    a0 = 1 + alpha
+    return [b0 / a0, b1 / a0, b0 / a0, -2 * c / a0, (1 - alpha) / a0]
+
+
+def design(kind, fs, fc, order):
+    """Sections of a low, hi or band pass (hi pass then low pass) filter"""
+    n = butterworth_sections(order)
+    if kind == "bandpass":
+        low, high = fc
+        return design("highpass", fs, [low], order) + design("lowpass", fs, [high], order)
+    return [biquad(kind, fc[0] / fs, butterworth_q(k, 2 * n)) for k in range(n)]
+
+
+def camel(name):
+    return "".join(word.capitalize() for word in name.split("_"))
+
+
+def header(args, sections):
+    guard = args.name.upper() + "_H_"
+    macro = args.name.upper() + "_SECTIONS"
+    table = args.name + "_coeffs"
+    func = camel(args.name)
+    fc = ", ".join("%g" % f for f in args.fc)
+    lines = [
+        "/**",
+        " * @file %s.h" % args.name,
+        " * @brief %s Butterworth filter, order %d, %s Hz at %g Hz (%d sections)"
+        % (TYPES[args.type], args.order, fc, args.fs, len(sections)),
+        " *",
+        " * Generated by iir_design.py (signal_processing/tools), do not edit:",
+        " *     python3 iir_design.py %s" % " ".join(sys.argv[1:]),
+        " */",
+        "",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        '#include "iir_filter.h"',
+        "",
+        "#define %-24s%d   /*!< 2nd order sections */" % (macro, len(sections)),
+        "",
+        "/** Sections coefficients: b0, b1, b2, a1, a2 */",
+        "static const float %s[%s][IIR_SOS_COEFFS] = {" % (table, macro),
+    ]
+    for c in sections:
+        lines.append("    {%s}," % ", ".join("%.9ef" % v for v in c))
+    lines += [
+        "};",
+        "",
+        "/**",
+        " * @brief Filter one sample (direct form II transposed, sections unrolled)",
+        " * ",
+        " * @param delay         Delay lines of the sections (zeroed: filter at rest)",
+        " * @param x             Input sample",
+        " * @return Filtered sample",
+        " */",
+        "static inline float %sStep(float delay[%s][2], float x){" % (func, macro),
+    ]
+    for k in range(len(sections)):
+        lines.append("    IIR_SECTION_STEP(%s[%d], delay[%d], x);" % (table, k, k))
+    lines += [
+        "    return x;",
+        "}",
+        "",
+        "/**",
+        " * @brief Apply the filter to a signal array",
+        " * ",
+        " * @param delay             Delay lines of the sections",
+        " * @param input_signal      Input signal array",
+        " * @param output_signal     Filtered signal array (can be the same as input)",
+        " * @param signal_lenght     Number of samples of both signals",
+        " */",
+        "static inline void %sProcess(float delay[%s][2], const float * input_signal, float * output_signal, "
+        "int16_t signal_lenght){" % (func, macro),
+        "    for(int16_t i = 0; i < signal_lenght; i++){",
+        "        output_signal[i] = %sStep(delay, input_signal[i]);" % func,
+        "    }",
+        "}",
+        "",
+        "#endif /* %s */" % guard,
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def freq_list(text):
+    return [float(v) for v in text.split(",")]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Butterworth filter header generator for iir_filter.h")
+    parser.add_argument("name", help="filter name (snake_case): header, table and function names")
+    parser.add_argument("type", choices=list(TYPES))
+    parser.add_argument("fs", type=float, help="sample frequency (Hz)")
+    parser.add_argument("fc", type=freq_list, help="cut-off frequency (Hz), 'low,high' for bandpass")
+    parser.add_argument("--order", type=int, default=2, help="order (even, up to 16; of each part for bandpass)")
+    parser.add_argument("-o", "--output", help="header file (default: stdout)")
+    args = parser.parse_args()
+    if len(args.fc) != (2 if args.type == "bandpass" else 1):
+        parser.error("bandpass needs 'low,high', the other types one frequency")
+    if any(f <= 0 or f >= args.fs / 2 for f in args.fc):
+        parser.error("cut-off frequencies must be between 0 and fs / 2")
+    if args.order < 1:
+        parser.error("order must be positive")
+    text = header(args, design(args.type, args.fs, args.fc, args.order))
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Host side decoder of the metrics snapshots of metrics_mcu.h (drivers).
+
+Reads the byte stream from a serial port (requires pyserial) or from a file
+('-' for stdin), skips everything until a snapshot header ("MET" + version)
+and prints the metrics of the snapshot, one line each:
+
+    name kind values
+
+Counters print their count, gauges their last and max values and histograms
+the count of each bucket, the total count and the mean. The names and the
+bucket bounds are not in the snapshot: they are taken from the lines sent by
+MetricsDescribe, saved to a file (--describe), or given with --names.
+
+Usage:
+    python3 metrics_decoder.py /dev/ttyUSB0 --baud 921600 --describe metrics.txt --follow
+    python3 metrics_decoder.py snapshot.bin --names 0=hits,1=latency_us
+"""
+
+import argparse
+import struct
+import sys
+
+from telemetry_decoder import crc16, read_stream
+
+MAGIC = b"MET"
+VERSION = 1
+HEADER = "<3sBIB"
+HEADER_SIZE = struct.calcsize(HEADER)
+KINDS = {0: "counter", 1: "gauge", 2: "histogram"}
+
+
+def parse_names(text):
+    """'0=hits,1=latency_us' -> {0: ('hits', []), 1: ('latency_us', [])}"""
+    names = {}
+    for item in filter(None, (text or "").split(",")):
+        index, name = item.split("=", 1)
+        names[int(index, 0)] = (name, [])
+    return names
+
+
+def parse_describe(path):
+    """Lines of MetricsDescribe ('index kind name [bounds]') -> {index: (name, bounds)}"""
+    names = {}
+    with open(path) as lines:
+        for line in lines:
+            fields = line.split()
+            if len(fields) < 3 or not fields[0].isdigit() or fields[1] not in KINDS.values():
+                continue
+            bounds = [int(b) for b in fields[3].split(",")] if len(fields) > 3 else []
+            names[int(fields[0])] = (fields[2], bounds)
+    return names
+
+
+def find_snapshot(buffer):
+    """Returns (time_ms, metrics, bytes used) of the first complete snapshot in buffer,
+    (None, None, bytes to skip) if there isn't one yet. metrics is a list of (kind, values)"""
+    start = buffer.find(MAGIC + bytes([VERSION]))
+    if start < 0:
+        # the magic could be split at the end of the buffer
+        return None, None, max(0, len(buffer) - len(MAGIC))
+    if len(buffer) < start + HEADER_SIZE:
+        return None, None, start
+    _, _, time_ms, count = struct.unpack_from(HEADER, buffer, start)
+    pos = start + HEADER_SIZE
+    metrics = []
+    for _ in range(count):
+        if len(buffer) < pos + 2:
+            return None, None, start
+        kind, k = buffer[pos], buffer[pos + 1]
+        if len(buffer) < pos + 2 + 4 * k:
+            return None, None, start
+        metrics.append((kind, struct.unpack_from("<%dI" % k, buffer, pos + 2)))
+        pos += 2 + 4 * k
+    if len(buffer) < pos + 2:
+        return None, None, start
+    crc = struct.unpack_from("<H", buffer, pos)[0]
+    if crc16(buffer[start:pos]) != crc:
+        print("corrupted snapshot (%d metrics)" % count, file=sys.stderr)
+        return None, None, start + 1
+    return time_ms, metrics, pos + 2
+
+
+def format_metric(kind, values, bounds):
+    """Text of the values of a metric"""
+    if kind == 0:
+        return "%d" % values[0]
+    if kind == 1:
+        return "%d (max %d)" % (values[0], values[1])
+    buckets, total = values[:-1], values[-1]
+    count = sum(buckets)
+    labels = ["<=%d" % b for b in bounds] if len(bounds) == len(buckets) - 1 else \
+             ["b%d" % i for i in range(len(buckets) - 1)]
+    labels.append(">%d" % bounds[-1] if labels and labels[0].startswith("<=") else "over")
+    text = " ".join("%s:%d" % (label, n) for label, n in zip(labels, buckets))
+    mean = total / count if count else 0
+    return "%s count %d mean %.1f" % (text, count, mean)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Metrics snapshot decoder")
+    parser.add_argument("source", help="serial port, file or '-' (stdin)")
+    parser.add_argument("--baud", type=int, default=921600, help="serial port baud rate")
+    parser.add_argument("--describe", metavar="FILE", help="lines sent by MetricsDescribe")
+    parser.add_argument("--names", help="names of the metrics (index=name,...)")
+    parser.add_argument("--follow", action="store_true", help="keep decoding snapshots after the first")
+    args = parser.parse_args()
+
+    names = parse_describe(args.describe) if args.describe else {}
+    names.update(parse_names(args.names))
+    buffer = bytearray()
+    for chunk in read_stream(args.source, args.baud):
+        buffer += chunk
+        while True:
+            time_ms, metrics, used = find_snapshot(buffer)
+            del buffer[:used]
+            if metrics is None:
+                break
+            print("snapshot: %d metrics at %d ms" % (len(metrics), time_ms))
+            for index, (kind, values) in enumerate(metrics):
+                name, bounds = names.get(index, ("metric%d" % index, []))
+                print("%-16s %-9s %s" % (name, KINDS.get(kind, "?"), format_metric(kind, values, bounds)))
+            if not args.follow:
+                return
+
+
+if __name__ == "__main__":
+    main()
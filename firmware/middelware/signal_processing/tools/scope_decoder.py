@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Host side decoder of the scope stream frames of scope_stream.h.
+
+Reads the byte stream from a serial port (requires pyserial) or from a file
+('-' for stdin) and prints one line per sample instant with the samples of
+every channel:
+
+    time_us ch0 ch1 ...
+
+With --csv the lines are comma separated. Corrupted frames, lost frames
+(sequence number) and blocks dropped by the sender (dropped counter) are
+reported on stderr; with --stats a summary is printed at the end.
+
+Usage:
+    python3 scope_decoder.py /dev/ttyUSB0 --baud 921600 --csv > scope.csv
+"""
+
+import argparse
+import struct
+import sys
+
+from telemetry_decoder import cobs_decode, crc16, read_stream
+
+PACK_12BIT = 0
+PACK_DELTA = 1
+DELTA_ESCAPE = 0x80
+HEADER = "<BBBHII"
+HEADER_SIZE = struct.calcsize(HEADER)
+
+
+def unpack_12bit(data, total):
+    samples = []
+    for k in range(total):
+        p = 3 * (k // 2)
+        if k & 1:
+            samples.append((data[p + 1] >> 4) | (data[p + 2] << 4))
+        else:
+            samples.append(data[p] | ((data[p + 1] & 0x0F) << 8))
+    return samples
+
+
+def unpack_delta(data, channels, count):
+    samples = []
+    pos = 0
+    for _ in range(channels):
+        for i in range(count):
+            if i == 0 or data[pos] == DELTA_ESCAPE:
+                pos += i > 0
+                samples.append(struct.unpack_from("<H", data, pos)[0])
+                pos += 2
+            else:
+                samples.append((samples[-1] + struct.unpack_from("<b", data, pos)[0]) & 0xFFFF)
+                pos += 1
+    if pos != len(data):
+        raise ValueError
+    return samples
+
+
+def decode_frame(frame):
+    """Returns (seq, timestamp, dropped, [channel samples, ...]) or None if the frame is corrupted"""
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) < HEADER_SIZE + 2:
+        return None
+    payload, crc = payload[:-2], struct.unpack("<H", payload[-2:])[0]
+    if crc16(payload) != crc:
+        return None
+    seq, pack, channels, count, timestamp, dropped = struct.unpack_from(HEADER, payload)
+    data = payload[HEADER_SIZE:]
+    try:
+        if pack == PACK_12BIT and len(data) == (3 * channels * count + 1) // 2:
+            samples = unpack_12bit(data, channels * count)
+        elif pack == PACK_DELTA:
+            samples = unpack_delta(data, channels, count)
+        else:
+            return None
+    except (IndexError, ValueError, struct.error):
+        return None
+    return seq, timestamp, dropped, [samples[c * count:(c + 1) * count] for c in range(channels)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Scope stream decoder")
+    parser.add_argument("source", help="serial port, file or '-' (stdin)")
+    parser.add_argument("--baud", type=int, default=921600, help="serial port baud rate")
+    parser.add_argument("--rate", type=float, default=20000, help="sample frequency per channel (Hz)")
+    parser.add_argument("--csv", action="store_true", help="comma separated output")
+    parser.add_argument("--stats", action="store_true", help="print frames, errors and drops at the end")
+    args = parser.parse_args()
+
+    separator = "," if args.csv else " "
+    buffer = bytearray()
+    last_seq = last_dropped = None
+    frames = corrupted = lost = dropped_blocks = 0
+    try:
+        for chunk in read_stream(args.source, args.baud):
+            buffer += chunk
+            while 0 in buffer:
+                end = buffer.index(0)
+                frame, buffer = bytes(buffer[:end]), buffer[end + 1:]
+                if not frame:
+                    continue
+                decoded = decode_frame(frame)
+                if decoded is None:
+                    corrupted += 1
+                    print("corrupted frame (%d bytes)" % len(frame), file=sys.stderr)
+                    continue
+                seq, timestamp, dropped, channels = decoded
+                frames += 1
+                if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+                    lost += (seq - last_seq - 1) & 0xFF
+                    print("lost frames: %d" % ((seq - last_seq - 1) & 0xFF), file=sys.stderr)
+                if last_dropped is not None and dropped != last_dropped:
+                    dropped_blocks += (dropped - last_dropped) & 0xFFFFFFFF
+                    print("blocks dropped by the sender: %d" % ((dropped - last_dropped) & 0xFFFFFFFF),
+                          file=sys.stderr)
+                last_seq, last_dropped = seq, dropped
+                for i, values in enumerate(zip(*channels)):
+                    t = timestamp + round(i * 1e6 / args.rate)
+                    print(separator.join(str(v) for v in (t,) + values))
+    except KeyboardInterrupt:
+        pass
+    if args.stats:
+        print("frames: %d, corrupted: %d, lost: %d, dropped blocks: %d" %
+              (frames, corrupted, lost, dropped_blocks), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
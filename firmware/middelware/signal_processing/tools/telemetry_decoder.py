@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Host side decoder of the telemetry frames of telemetry.h (COBS + CRC16).
+
+Reads the byte stream from a serial port (requires pyserial), from a file
+('-' for stdin, i.e. a capture of the port or a BLE notifications log) or from
+the UDP datagrams of wifi_udp_mcu.h ('udp:PORT') or from a dump of the
+flash log of flash_log_mcu.h ('flashlog:FILE', the output of FlashLogDump),
+and prints one line per record:
+
+    seq channel v1 v2 v3 ...
+
+With --csv the lines are comma separated. Corrupted frames are reported on
+stderr and skipped; lost frames are detected with the sequence number.
+
+Usage:
+    python3 telemetry_decoder.py /dev/ttyUSB0 --baud 921600
+    python3 telemetry_decoder.py capture.bin --csv > data.csv
+    python3 telemetry_decoder.py udp:5005
+    python3 telemetry_decoder.py flashlog:dump.bin --csv > data.csv
+"""
+
+import argparse
+import struct
+import sys
+
+# Types of telemetry_type_t: struct format of each value
+TYPES = {
+    0: "B",     # TELEMETRY_U8
+    1: "b",     # TELEMETRY_I8
+    2: "H",     # TELEMETRY_U16
+    3: "h",     # TELEMETRY_I16
+    4: "I",     # TELEMETRY_U32
+    5: "i",     # TELEMETRY_I32
+    6: "f",     # TELEMETRY_F32
+}
+TYPE_I16_RICE = 7   # TELEMETRY_I16_RICE: int16 values compressed (rice_codec.h)
+RICE_RAW = 0xFF
+RICE_ESCAPE = 16
+RECORD_HEADER = 3
+UDP_HEADER = 8      # WIFI_UDP_HEADER: sequence number and time of the datagram
+LOG_SECTOR = 4096   # FLASH_LOG_SECTOR
+LOG_HEADER = 16     # FLASH_LOG_HEADER: magic, sequence number and time of the sector
+LOG_MAGIC = 0x474F4C46
+
+
+def crc16(data):
+    """CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF)"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """COBS decoding of a frame without its delimiter (None if it is not valid)"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def rice_decode(block, count):
+    """Samples of a block of RiceEncode (None if it is not valid)"""
+    if not block:
+        return None
+    k = block[0]
+    if k == RICE_RAW:
+        if len(block) < 1 + 2 * count:
+            return None
+        return struct.unpack("<%dh" % count, block[1:1 + 2 * count])
+    if len(block) < 3:
+        return None
+    bits = "".join("{:08b}".format(b) for b in block[3:])
+    pos = 0
+    samples = [struct.unpack("<h", block[1:3])[0]]
+    for _ in range(count - 1):
+        q = 0
+        while q < RICE_ESCAPE and bits[pos:pos + 1] == "1":
+            q += 1
+            pos += 1
+        if q == RICE_ESCAPE:
+            size = 17
+        else:
+            pos += 1    # the zero of the unary code
+            size = k
+        if pos + size > len(bits):
+            return None
+        low = int(bits[pos:pos + size], 2) if size else 0
+        pos += size
+        z = low if q == RICE_ESCAPE else (q << k) | low
+        d = -((z + 1) >> 1) if z & 1 else z >> 1
+        samples.append((samples[-1] + d + 0x8000) % 0x10000 - 0x8000)
+    return tuple(samples)
+
+
+def decode_frame(frame):
+    """Returns (seq, [(channel, values), ...]) or None if the frame is corrupted"""
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) < 3:
+        return None
+    payload, crc = payload[:-2], struct.unpack("<H", payload[-2:])[0]
+    if crc16(payload) != crc:
+        return None
+    records = []
+    pos = 1
+    while pos + RECORD_HEADER <= len(payload):
+        channel, type_id, count = payload[pos:pos + RECORD_HEADER]
+        if type_id == TYPE_I16_RICE:
+            pos += RECORD_HEADER
+            if pos >= len(payload):
+                return None
+            size = payload[pos]
+            values = rice_decode(payload[pos + 1:pos + 1 + size], count)
+            if values is None:
+                return None
+            records.append((channel, values))
+            pos += 1 + size
+            continue
+        if type_id not in TYPES:
+            return None
+        fmt = "<%d%s" % (count, TYPES[type_id])
+        size = struct.calcsize(fmt)
+        pos += RECORD_HEADER
+        if pos + size > len(payload):
+            return None
+        records.append((channel, struct.unpack(fmt, payload[pos:pos + size])))
+        pos += size
+    return payload[0], records
+
+
+def read_udp(port):
+    """Generator of the frames of the wifi_udp_mcu.h datagrams (lost datagrams on stderr)"""
+    import socket
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", port))
+    last_seq = None
+    while True:
+        datagram = sock.recv(2048)
+        if len(datagram) < UDP_HEADER:
+            continue
+        seq = struct.unpack("<I", datagram[:4])[0]
+        if last_seq is not None and seq != (last_seq + 1) & 0xFFFFFFFF:
+            print("lost datagrams: %d" % ((seq - last_seq - 1) & 0xFFFFFFFF), file=sys.stderr)
+        last_seq = seq
+        yield datagram[UDP_HEADER:]
+
+
+def read_flash_log(path):
+    """Generator of the frames of the sectors of a flash_log_mcu.h dump (lost sectors on stderr)"""
+    last_seq = None
+    with open(path, "rb") as dump:
+        while True:
+            sector = dump.read(LOG_SECTOR)
+            if len(sector) < LOG_SECTOR:
+                return
+            magic, seq = struct.unpack("<II", sector[:8])
+            if magic != LOG_MAGIC:
+                print("invalid sector", file=sys.stderr)
+                continue
+            if last_seq is not None and seq != (last_seq + 1) & 0xFFFFFFFF:
+                print("lost sectors: %d" % ((seq - last_seq - 1) & 0xFFFFFFFF), file=sys.stderr)
+            last_seq = seq
+            pos = LOG_HEADER
+            while pos + 2 <= LOG_SECTOR:
+                size = struct.unpack("<H", sector[pos:pos + 2])[0]
+                if size == 0xFFFF:
+                    break
+                yield sector[pos + 2:pos + 2 + size]
+                pos += 2 + size
+
+
+def read_stream(source, baud):
+    """Generator of the bytes read from a serial port, a file, UDP datagrams or a flash log dump"""
+    if source.startswith("udp:"):
+        yield from read_udp(int(source[4:]))
+        return
+    if source.startswith("flashlog:"):
+        yield from read_flash_log(source[9:])
+        return
+    if source == "-":
+        stream = sys.stdin.buffer
+    else:
+        try:
+            import serial
+            stream = serial.Serial(source, baud, timeout=1)
+        except (ImportError, ValueError, OSError):
+            stream = open(source, "rb")
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if hasattr(stream, "is_open"):
+                continue
+            return
+        yield chunk
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Telemetry frames decoder (COBS + CRC16)")
+    parser.add_argument("source", help="serial port, file, '-' (stdin), udp:PORT or flashlog:FILE")
+    parser.add_argument("--baud", type=int, default=921600, help="serial port baud rate")
+    parser.add_argument("--csv", action="store_true", help="comma separated output")
+    args = parser.parse_args()
+
+    separator = "," if args.csv else " "
+    buffer = bytearray()
+    last_seq = None
+    for chunk in read_stream(args.source, args.baud):
+        buffer += chunk
+        # complete frames end at a 0x00 delimiter
+        while 0 in buffer:
+            end = buffer.index(0)
+            frame, buffer = bytes(buffer[:end]), buffer[end + 1:]
+            if not frame:
+                continue
+            decoded = decode_frame(frame)
+            if decoded is None:
+                print("corrupted frame (%d bytes)" % len(frame), file=sys.stderr)
+                continue
+            seq, records = decoded
+            if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+                print("lost frames: %d" % ((seq - last_seq - 1) & 0xFF), file=sys.stderr)
+            last_seq = seq
+            for channel, values in records:
+                print(separator.join(str(v) for v in (seq, channel) + values))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Host side decoder of the event trace dumps of trace_mcu.h (drivers).
+
+Reads the byte stream from a serial port (requires pyserial) or from a file
+('-' for stdin), skips everything until a dump header ("TRC" + version) and
+prints the timeline of the dump, one line per record:
+
+    time_us delta_us event kind arg [duration_us]
+
+Times are relative to the first record. END records show the duration of
+their interval (from the last BEGIN of the same event). With --stats a
+summary (count, min/avg/max duration) of each interval event is printed and
+with --chrome the timeline is also written as a Chrome trace (JSON), that
+chrome://tracing or https://ui.perfetto.dev show as a timeline.
+
+Application events (ids from TRACE_USER) are named with --names.
+
+Usage:
+    python3 trace_decoder.py /dev/ttyUSB0 --baud 921600 --names 16=AdcTask,17=PlaySoundTask
+    python3 trace_decoder.py dump.bin --stats --chrome trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+from telemetry_decoder import crc16, read_stream
+
+MAGIC = b"TRC"
+VERSION = 1
+HEADER = "<3sBHI"
+HEADER_SIZE = struct.calcsize(HEADER)
+RECORD = "<IBBH"
+RECORD_SIZE = struct.calcsize(RECORD)
+KINDS = {0: "point", 1: "begin", 2: "end"}
+# Events of the drivers (trace_mcu.h)
+EVENTS = {0: "TimerIsr", 1: "LcdWrite", 2: "BleSend", 3: "SensorRead"}
+
+
+def parse_names(text):
+    """'16=AdcTask,17=PlaySoundTask' -> {16: 'AdcTask', 17: 'PlaySoundTask'}"""
+    names = {}
+    for item in filter(None, (text or "").split(",")):
+        event_id, name = item.split("=", 1)
+        names[int(event_id, 0)] = name
+    return names
+
+
+def find_dump(buffer):
+    """Returns (records, lost, bytes used) of the first complete dump in buffer,
+    (None, 0, bytes to skip) if there isn't one yet"""
+    start = buffer.find(MAGIC + bytes([VERSION]))
+    if start < 0:
+        # the magic could be split at the end of the buffer
+        return None, 0, max(0, len(buffer) - len(MAGIC))
+    if len(buffer) < start + HEADER_SIZE:
+        return None, 0, start
+    _, _, count, lost = struct.unpack_from(HEADER, buffer, start)
+    end = start + HEADER_SIZE + count * RECORD_SIZE
+    if len(buffer) < end + 2:
+        return None, 0, start
+    crc = struct.unpack_from("<H", buffer, end)[0]
+    if crc16(buffer[start:end]) != crc:
+        print("corrupted dump (%d records)" % count, file=sys.stderr)
+        return None, 0, start + 1
+    records = [struct.unpack_from(RECORD, buffer, start + HEADER_SIZE + i * RECORD_SIZE)
+               for i in range(count)]
+    return records, lost, end + 2
+
+
+def unwrap(records):
+    """Timestamps (32 bits) to a time line in us relative to the first record"""
+    timeline = []
+    base = prev = None
+    offset = 0
+    for timestamp, event_id, kind, arg in records:
+        if prev is not None and timestamp < prev and prev - timestamp > 0x80000000:
+            offset += 1 << 32
+        prev = timestamp
+        t = timestamp + offset
+        if base is None:
+            base = t
+        timeline.append((t - base, event_id, kind, arg))
+    return timeline
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Event trace dump decoder")
+    parser.add_argument("source", help="serial port, file or '-' (stdin)")
+    parser.add_argument("--baud", type=int, default=921600, help="serial port baud rate")
+    parser.add_argument("--names", help="names of the application events (id=name,...)")
+    parser.add_argument("--stats", action="store_true", help="print the durations of each event")
+    parser.add_argument("--chrome", metavar="FILE", help="write the timeline as a Chrome trace")
+    parser.add_argument("--follow", action="store_true", help="keep decoding dumps after the first")
+    args = parser.parse_args()
+
+    names = dict(EVENTS)
+    names.update(parse_names(args.names))
+    buffer = bytearray()
+    for chunk in read_stream(args.source, args.baud):
+        buffer += chunk
+        while True:
+            records, lost, used = find_dump(buffer)
+            del buffer[:used]
+            if records is None:
+                break
+            print("dump: %d records, %d events overwritten" % (len(records), lost))
+            begins = {}
+            durations = {}
+            events = []
+            last = 0
+            for t, event_id, kind, arg in unwrap(records):
+                name = names.get(event_id, "event%d" % event_id)
+                line = "%10d %8d %-16s %-5s %6d" % (t, t - last, name, KINDS.get(kind, "?"), arg)
+                last = t
+                if kind == 1:
+                    begins[event_id] = t
+                elif kind == 2 and event_id in begins:
+                    duration = t - begins.pop(event_id)
+                    durations.setdefault(name, []).append(duration)
+                    line += " %8d" % duration
+                print(line)
+                phase = {0: "i", 1: "B", 2: "E"}.get(kind, "i")
+                events.append({"name": name, "ph": phase, "ts": t, "pid": 0, "tid": event_id,
+                               "s": "t", "args": {"arg": arg}})
+            if args.stats:
+                print("event               count      min      avg      max")
+                for name, values in sorted(durations.items()):
+                    print("%-16s %8d %8d %8d %8d" % (name, len(values), min(values),
+                                                     sum(values) // len(values), max(values)))
+            if args.chrome:
+                with open(args.chrome, "w") as out:
+                    json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, out)
+            if not args.follow:
+                return
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,57 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Wed Oct 14 10:00:00 2026
+
+@author: Albano Peñalva
+
+Codificador IMA-ADPCM (mismo formato que AdpcmEncode de la middleware
+signal_processing: 4 bits por muestra, nibble bajo primero, sin encabezado,
+comenzando con predictor = 0 e índice = 0). Lo usan wav_to_adpcm.py y
+make_sample_bank.py.
+"""
+
+# Tablas del codificador IMA-ADPCM
+STEP = [7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+        253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+        1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+        11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+        32767]
+INDEX_STEP = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def adpcm_encode(muestras):
+    predictor = 0
+    index = 0
+    codigos = []
+    for x in muestras:
+        step = STEP[index]
+        diff = int(x) - predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        if diff >= step:
+            code |= 4
+            diff -= step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            code |= 1
+        # se decodifica el código para seguir al decodificador
+        dq = step >> 3
+        if code & 4:
+            dq += step
+        if code & 2:
+            dq += step >> 1
+        if code & 1:
+            dq += step >> 2
+        predictor += -dq if code & 8 else dq
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_STEP[code & 7]))
+        codigos.append(code)
+    if len(codigos) % 2:
+        codigos.append(0)
+    return [codigos[i] | (codigos[i + 1] << 4) for i in range(0, len(codigos), 2)]
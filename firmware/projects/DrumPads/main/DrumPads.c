@@ -2,22 +2,227 @@
  *
  * @section genDesc Descripción General
  *
- * Esta aplicación adquiere la señal analógica de dos sensores piezoeléctricos
- * (PAD A y PAD B) conectados a los canales CH1 y CH0 del ADC. La señal se muestrea
- * periódicamente. Cuando un golpe supera un umbral, se reproduce un sonido
- * específico (Snare o Hi-Hat) por el DAC.
+ * Esta aplicación adquiere la señal analógica de sensores piezoeléctricos (PADs)
+ * conectados a los canales del ADC. La señal se muestrea en modo continuo. Cuando
+ * se detecta un golpe, se reproduce el sonido del PAD (Snare, Hi-Hat, ...) por el
+ * DAC con un volumen proporcional a su fuerza.
  *
  * Características principales:
- * - Sensores: 2 Piezoeléctricos (PAD A -> CH1, PAD B -> CH0).
- * - Muestreo: 20 kHz (50 μs) (Ver nota de rendimiento).
- * - Detección: Por umbral en la tarea de ADC.
- * - Salida de audio: DAC (Buzzer/Audio Out).
- * - Feedback visual: LED Neopixel.
+ * - Sensores: Piezoeléctricos, configurados en la tabla pads[] (canal, umbrales,
+ *   sonido y color del LED). Con dos PADs: PAD A -> CH1, PAD B -> CH0. Agregar un PAD
+ *   es agregar una fila a la tabla; el costo de procesamiento crece linealmente.
+ * - Muestreo: 20 kHz en modo continuo (DMA), procesado en bloques de ADC_FRAME_SIZE muestras.
+ * - Detección: hit_detector sobre la señal sin deriva de continua (pasa altos de 20 Hz):
+ *   ventana de búsqueda del pico, máscara de redisparo y umbral de re-armado que decae
+ *   desde el último pico. Cada golpe da una velocidad (1 a 127, rango MIDI) que fija
+ *   la ganancia de su voz en el mezclador. Los golpes simultáneos más débiles que
+ *   CROSSTALK_RATIO del golpe de otro PAD (vibración transmitida) se descartan.
+ *   El umbral de cada PAD sigue al ruido de fondo (noise_floor: media más
+ *   NOISE_FLOOR_K desvíos de la señal rectificada); el de la tabla es el mínimo.
+ * - Salida de audio: DAC (Buzzer/Audio Out, 8 bits) o, con AUDIO_OUTPUT, I2S a un DAC
+ *   externo o PDM (16 bits por DMA, ver audio_out_mcu.h).
+ * - Feedback visual: LED Neopixel (con el color del último PAD golpeado).
  * - Implementación: 
- * - Timer notifica a AdcTask.
- * - AdcTask lee ADCs, compara con umbral y envía datos por UART.
- * - Si hay golpe, AdcTask notifica a UmbralTask (LED) y a PlaySoundTask (Audio).
- * - PlaySoundTask es una tarea única que reproduce el sonido correspondiente.
+ * - El ADC notifica a AdcTask en cada bloque convertido.
+ * - AdcTask convierte a mV, filtra y detecta golpes. Cada golpe se guarda como un
+ *   registro binario (hit_record_t) en un anillo que TelemetryTask, de baja prioridad,
+ *   envía por UART en bloques; así la transmisión nunca demora el muestreo.
+ * - Si hay golpe, AdcTask dispara el destello del LED (neopixel_effects, sin tarea
+ *   propia) y notifica a PlaySoundTask (Audio).
+ * - PlaySoundTask es una tarea única que mezcla los sonidos activos (hasta 8 voces,
+ *   los golpes se superponen) y carga las muestras en la salida de audio (un timer
+ *   de hardware las envía al DAC a SAMPLE_RATE, o el DMA del I2S).
+ * - Los samples están comprimidos en IMA-ADPCM (1/4 de la memoria de PCM de 16 bits)
+ *   y se decodifican por bloques sólo mientras su voz está activa (ver wav_to_adpcm.py).
+ * - Si la partición "samples" tiene un banco de sonidos (make_sample_bank.py), los
+ *   sonidos de los PADs se leen de ella directamente desde la flash; así se
+ *   cambia el kit grabando sólo la partición. Sin banco se usan los de drum_samples.c.
+ *   Los sonidos del banco pueden estar a su frecuencia nativa (hasta
+ *   AUDIO_MIXER_MAX_RATIO * SAMPLE_RATE): su voz se remuestrea a SAMPLE_RATE.
+ * - Latencia: cada golpe se mide desde el cruce del umbral hasta su primera muestra
+ *   en el DAC, por etapas (ver latency_probe.h). Enviando 'l' por UART_PC se recibe
+ *   min/avg/max/p99 de cada etapa; con 'r' se borran las mediciones.
+ * - Carga de las tareas: con CONFIG_DRIVERS_TASK_MONITOR (menuconfig: ESP-EDU
+ *   drivers) enviando 't' por UART_PC se recibe el uso de CPU del último segundo
+ *   y la pila libre mínima de cada tarea (AdcTask, PlaySoundTask, tareas del BLE
+ *   y de la UART...), para dimensionar las pilas y ver qué tarea ocupa el núcleo
+ *   cuando se pierden muestras (ver task_monitor_mcu.h).
+ *
+ * @section metrics Métricas
+ *
+ * Los contadores de descartes y las distribuciones de tiempos se registran en
+ * metrics_mcu.h (cada actualización es una operación atómica, sin bloquear):
+ * golpes, registros de golpes y bloques del modo osciloscopio descartados
+ * (anillos llenos), paquetes BLE-MIDI rechazados, el histograma de la latencia
+ * total de cada golpe (us) y el del procesamiento de cada bloque en AdcTask (us).
+ * Enviando 'm' por UART_PC se recibe una instantánea binaria de todas y con 'M'
+ * su descripción (nombres e intervalos de los histogramas); tools/metrics_decoder.py
+ * del middleware las muestra:
+ *
+ *     python3 metrics_decoder.py /dev/ttyUSB0 --describe metrics.txt
+ *
+ * @section perfBudget Presupuesto de CPU
+ *
+ * Antes de agregar PADs conviene saber si el kit entra en el CPU. perf_budget.h
+ * estima los ciclos por segundo de cada etapa (adquisición, detección, mezcla,
+ * salida, LED y telemetría) con su costo por unidad y la configuración: PAD_NUM a
+ * ADC_SAMPLE_FREQ, MIXER_VOICES a SAMPLE_RATE, LED_FRAME_RATE y un golpe por
+ * HIT_MASK_MS de cada PAD.
+ *
+ * - En compilación: una configuración que necesita más que todo el CPU no compila.
+ * - Al arrancar: si necesita más de PERF_BUDGET_PERCENT del CPU (el resto es del
+ *   BLE, la UART, las interrupciones...) se envía un aviso con la tabla por UART_PC.
+ * - Enviando 'p' por UART_PC se recibe, de cada etapa, lo medido desde el reporte
+ *   anterior (ciclos del CPU de cada etapa en AdcTask, PlaySoundTask y
+ *   TelemetryTask, acumulados en las métricas) junto a lo estimado. La interrupción
+ *   del DAC y los cuadros del LED no se miden (corren en los drivers): el medido
+ *   de la salida sólo carga las muestras y el del LED sólo inicia los destellos.
+ *   La traza (ver @ref traceDump, trace_decoder.py --stats) da la duración de cada
+ *   pasada de las tareas.
+ *
+ * Ejemplo: 16 PADs con ADC_SAMPLE_FREQ de 20 kHz no compilan; de 8 kHz compilan
+ * con el aviso. Con el medido de 'p' se ajustan los PERF_CYCLES_* del modelo.
+ *
+ * @section hitStream Registro de golpes por UART
+ *
+ * Cada golpe se envía como un registro de 8 bytes (little endian):
+ *
+ * | Byte | Campo     | Descripción                                           |
+ * |:----:|:----------|:------------------------------------------------------|
+ * | 0    | sync      | HIT_RECORD_SYNC (0xA5)                                |
+ * | 1    | pad       | Índice del PAD en la tabla pads[]                     |
+ * | 2    | velocity  | Velocidad (1 a 127)                                   |
+ * | 3    | checksum  | XOR de los bytes 1, 2 y 4 a 7                         |
+ * | 4-7  | timestamp | Cruce del umbral (us desde el arranque, uint32)       |
+ *
+ * El receptor se sincroniza buscando un byte sync cuyo checksum sea válido (el
+ * reporte de latencia, en texto, sólo se envía a pedido).
+ *
+ * @section scopeMode Modo osciloscopio
+ *
+ * Enviando 's' por UART_PC se activa (o desactiva) el envío continuo de la señal
+ * cruda de todos los PADs (20 kHz, 12 bits) para analizarla en la PC. Cada bloque
+ * del ADC se empaqueta con scope_stream (SCOPE_PACK: 12 bits empaquetados, 60 KB/s
+ * con dos PADs, o diferencias) y TelemetryTask lo envía por la UART con buffer de
+ * transmisión. AdcTask nunca espera: si el enlace no da abasto los bloques que no
+ * entran en el anillo de SCOPE_RING_SIZE se descartan y se cuentan en cada trama.
+ * Mientras el modo está activo no se envían los registros de golpes (sí el MIDI por
+ * BLE); las tramas se leen con tools/scope_decoder.py del middleware.
+ *
+ * @section replay Reproducción de capturas
+ *
+ * Con ADC_SOURCE distinto de ADC_SOURCE_LIVE los bloques de los PADs no vienen
+ * del ADC sino de una captura grabada (adc_replay_mcu.h), con el mismo formato
+ * de bloque: un problema del escenario se repite sin baterista, siempre con las
+ * mismas muestras. La captura se arma con make_replay_capture.py a partir de la
+ * salida de scope_decoder.py (modo osciloscopio) y:
+ *
+ * - ADC_SOURCE_REPLAY_FLASH: se graba en la partición REPLAY_PARTITION (hay que
+ *   agregarla a partitions.csv, en 2 MB de flash en lugar de "samples"):
+ *
+ *       parttool.py write_partition --partition-name capture --input capture.bin
+ *
+ * - ADC_SOURCE_REPLAY_UART: se envía por UART_PC (no hay comandos por UART):
+ *
+ *       python3 make_replay_capture.py scope.txt --port /dev/ttyUSB0
+ *
+ * Con REPLAY_PACE = ADC_REPLAY_MAX_SPEED cada bloque entra apenas AdcTask libera
+ * el anterior, así al final de la captura se envía por UART_PC la capacidad del
+ * motor de detección en muestras por segundo (ADC_REPLAY_REAL_TIME reproduce a
+ * ADC_SAMPLE_FREQ, como el ADC).
+ *
+ * @section traceDump Traza de eventos
+ *
+ * Con CONFIG_DRIVERS_TRACE (menuconfig: ESP-EDU drivers) se registran, con su
+ * instante, las interrupciones de los timers (la salida de audio), el
+ * procesamiento de cada bloque en AdcTask, cada notificación atendida por
+ * PlaySoundTask y por TelemetryTask, los golpes y las notificaciones BLE, sin alterar los tiempos
+ * como lo haría un printf. Enviando 'd' por UART_PC se recibe el volcado binario
+ * de los últimos eventos (ver trace_mcu.h), que tools/trace_decoder.py del
+ * middleware convierte en una línea de tiempo:
+ *
+ *     python3 trace_decoder.py /dev/ttyUSB0 --baud 921600 --names 16=AdcTask,17=PlaySoundTask,18=Hit,19=TelemetryTask
+ *
+ * @section midiOut Salida MIDI
+ *
+ * Cada PAD tiene una nota MIDI (General MIDI, canal 10 de percusión) y cada golpe
+ * se envía como note on con su velocidad (los sonidos de batería no usan note off):
+ *
+ * - Con UART_OUTPUT = UART_OUTPUT_MIDI, UART_PC envía MIDI serie a MIDI_BAUD_RATE
+ *   (con running status) en lugar de los registros binarios. En este modo no se
+ *   debe pedir el reporte de latencia (el texto se mezclaría con los mensajes).
+ * - Si Bluetooth está habilitado en sdkconfig (CONFIG_BT_ENABLED), el dispositivo
+ *   expone el servicio BLE-MIDI como BLE_DEVICE_NAME. Los golpes de cada pasada de
+ *   TelemetryTask van en un mismo paquete, cada uno con el timestamp de su cruce
+ *   del umbral, así el DAW conserva su separación aunque lleguen en el mismo
+ *   evento de conexión. Se pide un intervalo de conexión de 7.5 ms y el PHY de 2M
+ *   (BLE_PROFILE_LOW_LATENCY) para que cada golpe llegue en menos de un intervalo.
+ *
+ * @section padSettings Ajustes de los PADs
+ *
+ * El umbral, el nivel máximo, la sensibilidad, la relación de cross-talk y la
+ * curva de velocidad de cada PAD se guardan en la NVS (pad_settings.h, clave
+ * SETTINGS_KEY) y se cargan al arrancar; la tabla pads[] da los valores por
+ * defecto. En el primer arranque (sin ajustes guardados) el umbral de cada PAD
+ * se calibra con CALIBRATION_MS de ruido de fondo y se guarda, así en los
+ * arranques siguientes no hace falta esperar la calibración. Los comandos de
+ * ajuste empiezan con COMMAND_START y terminan con '\n', por UART_PC o escritos
+ * por BLE (los paquetes BLE-MIDI del DAW se ignoran):
+ *
+ *     :set 0 threshold 350
+ *     :set 1 curve 0.6
+ *     :points 0 1 60 100 127
+ *     :save
+ *     :defaults
+ *
+ * La curva de velocidad (curve, o los puntos de points) se precalcula en una
+ * tabla por PAD (velocity_curve.h): el pico de cada golpe da la velocidad MIDI
+ * y la ganancia del sonido con una sola lectura, sin powf por golpe.
+ *
+ * Los cambios se aplican en el siguiente bloque del ADC; save los guarda y
+ * defaults vuelve a la tabla y borra los guardados (se calibra en el próximo
+ * arranque). Por UART se responde "ok" o "error" (salvo en UART_OUTPUT_MIDI).
+ *
+ * @section padMonitor Monitores de umbral
+ *
+ * Con PAD_MONITOR, cuando todos los PADs están en reposo (sin golpe en curso)
+ * AdcTask arma el monitor de umbral del ADC de cada PAD (analog_io_mcu.h) a
+ * PAD_MONITOR_MARGIN de su umbral, alrededor del nivel de reposo de la señal.
+ * Mientras ningún monitor dispare los bloques se descartan sin convertirlos ni
+ * filtrarlos: el ADC compara cada muestra por hardware y AdcTask sólo saca los
+ * bloques del driver. El primer cruce desarma los monitores y el bloque que lo
+ * contiene, con las muestras anteriores al cruce, se procesa completo; se vuelven
+ * a armar cuando el golpe termina (pasada la máscara de redisparo).
+ *
+ * - El ADC tiene ADC_MONITOR_NUM monitores: con más PADs no se descarta ningún bloque.
+ * - El ruido de fondo (umbral adaptivo) no se actualiza con los bloques descartados,
+ *   y el pasa altos sigue desde su último bloque (el cruce puede correrse una muestra).
+ * - No se descartan bloques durante la calibración, en modo osciloscopio ni con una
+ *   captura (ADC_SOURCE).
+ * - Tampoco mientras se graba un sonido (ver @ref sampleCapture).
+ *
+ * @section sampleCapture Grabación de sonidos en la placa
+ *
+ * Enviando 'g' por UART_PC se graba el próximo golpe del último PAD golpeado como
+ * su nuevo sonido, sin pasar por la PC (make_sample_bank.py). AdcTask entrega la
+ * señal filtrada del PAD a sample_capture.h: se guardan CAPTURE_PRE_MS antes del
+ * cruce del umbral del PAD (el del ruido de fondo) y el golpe hasta que su nivel
+ * queda CAPTURE_RELEASE_MS por debajo de CAPTURE_END_LEVEL de su pico (hasta
+ * CAPTURE_MS), a ADC_SAMPLE_FREQ / CAPTURE_DECIMATION. El final se desvanece y
+ * el sonido se normaliza a CAPTURE_PEAK.
+ *
+ * - El PAD suena con la grabación apenas termina (PCM en RAM, remuestreada por el
+ *   mezclador).
+ * - TelemetryTask la escribe en la partición SAMPLE_BANK_PARTITION con el nombre
+ *   del sonido del PAD (SampleBankWrite, en CAPTURE_FORMAT), así queda en los
+ *   arranques siguientes; responde "capture: ok" o "capture: error". Si la
+ *   partición no tiene banco se crea uno. Un banco de make_sample_bank.py necesita
+ *   entradas libres en el índice (LIBRES) para los sonidos que no tiene.
+ * - Escribir la flash demora décimas de segundo, como guardar los ajustes: puede
+ *   perderse algún bloque del ADC, y un sonido del banco que suene mientras se
+ *   reescribe el primer sector puede tener un ruido.
+ * - Al pedir otra grabación el PAD grabado antes vuelve al sonido de drum_samples.c
+ *   hasta el próximo arranque (el buffer de la grabación se reutiliza).
  *
  * @section hardConn Conexión de Hardware
  *
@@ -25,7 +230,9 @@
  * |:--------------:|:--------------|
  * | 	CH1 ADC (PAD A)| 	GPIO_1		|
  * | 	CH0 ADC (PAD B)| 	GPIO_0		| // Ver si usamos ese
- * | 	AUDIO_OUT 	 | 	GPIO_4		|
+ * | 	AUDIO_OUT 	 | 	GPIO_4		| (DAC, o datos I2S/PDM)
+ * | 	I2S BCLK 	 | 	GPIO_20		| (sólo AUDIO_OUTPUT_I2S, reloj en PDM)
+ * | 	I2S WS   	 | 	GPIO_21		| (sólo AUDIO_OUTPUT_I2S)
  * | 	UART_PC	 	 | 	USB			|
  * |    RGB LED      |   BUILT_IN_RGB_LED_PIN |
  *
@@ -34,77 +241,455 @@
  */
 
 /*==================[inclusions]=============================================*/
-#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "timer_mcu.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
 #include "uart_mcu.h"
+#include "ring_buffer_mcu.h"
 #include "analog_io_mcu.h"
+#include "adc_replay_mcu.h"
+#include "audio_out_mcu.h"
 #include "neopixel_stripe.h"
+#include "neopixel_effects.h"
 #include "gpio_mcu.h"
 #include "drum_samples.h" 
+#include "iir_filter.h"
+#include "audio_mixer.h"
+#include "hit_detector.h"
+#include "noise_floor.h"
+#include "pad_settings.h"
+#include "velocity_curve.h"
+#include "nvs_mcu.h"
+#include "sample_bank.h"
+#include "sample_capture.h"
+#include "midi.h"
+#include "scope_stream.h"
+#include "latency_probe.h"
+#include "perf_budget.h"
+#include "time_mcu.h"
+#include "static_alloc_mcu.h"
+#include "iram_mcu.h"
+#ifdef CONFIG_DRIVERS_TASK_MONITOR
+#include "task_monitor_mcu.h"
+#endif
+#include "trace_mcu.h"
+#include "metrics_mcu.h"
 #include "esp_mac.h"
+#ifdef CONFIG_BT_ENABLED
+#include "ble_mcu.h"
+#endif
 
 /*==================[macros and definitions]=================================*/
-/** Período del timer A para muestreo ADC: 20KHz = 50μs */
-#define TIMER_ADC_PERIOD_US     50
+/** Eventos de la traza (ver @ref traceDump) */
+#define TRACE_ADC_TASK          (TRACE_USER + 0)    /*!< AdcTask procesa un bloque (arg: golpes) */
+#define TRACE_PLAY_SOUND_TASK   (TRACE_USER + 1)    /*!< PlaySoundTask atiende una notificación (arg: eventos) */
+#define TRACE_HIT               (TRACE_USER + 2)    /*!< Golpe detectado (arg: PAD * 256 + velocidad) */
+#define TRACE_TELEMETRY_TASK    (TRACE_USER + 3)    /*!< TelemetryTask atiende una notificación */
 
-/** Canal ADC a usar para PAD A */
-#define ADC_CHANNEL_A            CH1
+/** Formatos de los golpes en UART_PC */
+#define UART_OUTPUT_RECORDS     0       /*!< Registros binarios (hit_record_t) */
+#define UART_OUTPUT_MIDI        1       /*!< MIDI serie (note on) */
 
-/** Canal ADC a usar para PAD B */
-#define ADC_CHANNEL_B            CH0
+/** Formato de los golpes en UART_PC */
+#define UART_OUTPUT             UART_OUTPUT_RECORDS
+
+/** Velocidad UART de MIDI serie */
+#define MIDI_BAUD_RATE          31250
 
 /** Velocidad UART para transmisión */
+#if UART_OUTPUT == UART_OUTPUT_MIDI
+#define UART_BAUD_RATE          MIDI_BAUD_RATE
+#else
 #define UART_BAUD_RATE          921600
+#endif
+
+/** Tamaño del buffer de transmisión de UART_PC (el reporte de latencia entra completo) */
+#define UART_TX_BUFFER_SIZE     1024
+
+/** Canal MIDI de los golpes (canal 10, percusión) */
+#define MIDI_CHANNEL            MIDI_DRUMS_CHANNEL
+
+/** Nombre del dispositivo BLE-MIDI */
+#define BLE_DEVICE_NAME         "DrumPads"
+
+/** Frecuencia de muestreo del ADC (Hz) */
+#define ADC_SAMPLE_FREQ         20000
+
+/** Muestras por canal de cada bloque del ADC (3.2 ms a 20 kHz) */
+#define ADC_FRAME_SIZE          64
+
+/** Fuentes de los bloques de los PADs (ver @ref replay) */
+#define ADC_SOURCE_LIVE         0       /*!< ADC continuo */
+#define ADC_SOURCE_REPLAY_FLASH 1       /*!< Captura grabada en la partición REPLAY_PARTITION */
+#define ADC_SOURCE_REPLAY_UART  2       /*!< Captura enviada por UART_PC */
+
+/** Fuente de los bloques de los PADs */
+#define ADC_SOURCE              ADC_SOURCE_LIVE
 
-/** Umbral para la detección del evento*/
-#define ADC_THRESHOLD_MV_MINIMUM        400
+/** Descartar los bloques sin golpes con los monitores de umbral del ADC (ver @ref padMonitor) */
+#define PAD_MONITOR             1
+
+/** Fracción del umbral de cada PAD a la que se arma su monitor (antes que el detector) */
+#define PAD_MONITOR_MARGIN      0.5f
+
+/** Máximo valor crudo del ADC (12 bits) */
+#define ADC_RAW_MAX             4095
+
+/** Partición de datos con la captura (ADC_SOURCE_REPLAY_FLASH) */
+#define REPLAY_PARTITION        "capture"
+
+/** Ritmo de la reproducción de capturas */
+#define REPLAY_PACE             ADC_REPLAY_MAX_SPEED
+
+/** Ventana de búsqueda del pico de un golpe (ms) */
+#define HIT_SCAN_MS             2
+
+/** Máscara de redisparo después de un golpe (ms) */
+#ifndef HIT_MASK_MS
+#define HIT_MASK_MS             30
+#endif
+
+/** Constante de tiempo del decaimiento del umbral de re-armado (ms) */
+#define HIT_DECAY_MS            50
+
+/** Constante de tiempo de la estimación del ruido de fondo de cada PAD (ms) */
+#define NOISE_FLOOR_MS          500
+
+/** Desvíos del ruido de fondo por encima de su media a los que se ubica el umbral */
+#define NOISE_FLOOR_K           4.0f
+
+/** Clave de los ajustes de los PADs en la NVS */
+#define SETTINGS_KEY            "pads"
+
+/** Calibración del umbral en el primer arranque (ms, cinco constantes de tiempo del ruido de fondo) */
+#define CALIBRATION_MS          (5 * NOISE_FLOOR_MS)
+
+/** Carácter con el que empieza un comando de ajuste (terminado en '\n') */
+#define COMMAND_START           ':'
+
+/** Largo máximo de un comando de ajuste */
+#define COMMAND_MAX_LENGHT      48
+
+/** Golpes de un PAD guardados por bloque */
+#define HITS_PER_BLOCK          2
+
+/** Ventana en la que un golpe puede ser eco (cross-talk) del golpe de otro PAD (ms) */
+#define CROSSTALK_WINDOW_MS     3
+
+/** Un golpe más débil que esta fracción del golpe simultáneo del otro PAD se descarta */
+#define CROSSTALK_RATIO         0.5f
+
+/** Frecuencia de corte del pasa altos que elimina la deriva de continua (Hz) */
+#define DC_FILTER_CUT_FREQ      20.0f
+
+/** Salidas de audio */
+#define AUDIO_OUTPUT_DAC        0       /*!< DAC sigma-delta de 8 bits (analog_io_mcu.h) */
+#define AUDIO_OUTPUT_I2S        1       /*!< I2S a un DAC externo, 16 bits (audio_out_mcu.h) */
+#define AUDIO_OUTPUT_PDM        2       /*!< PDM, 16 bits (audio_out_mcu.h) */
+
+/** Salida de audio */
+#define AUDIO_OUTPUT            AUDIO_OUTPUT_DAC
 
 /** Pin de salida para el buzzer/audio */
 #define GPIO_AUDIO_OUT          GPIO_4  
 
+/** Pines del I2S (reloj de bit y selección de canal; en PDM el reloj va en GPIO_I2S_BCLK) */
+#define GPIO_I2S_BCLK           GPIO_20
+#define GPIO_I2S_WS             GPIO_21
+
 /** Frecuencia de muestreo utilizada en la señal de audio (DAC) */
 #define SAMPLE_RATE             8000
 
-/** Cooldown para evitar múltiples disparos del mismo golpe (en milisegundos) */
-#define HIT_COOLDOWN_MS         100 
+/** Muestras de audio mezcladas por bloque (8 ms a 8 kHz) */
+#define AUDIO_BLOCK_SIZE        64
+
+/** Muestras que se mantienen cargadas en la salida de audio (latencia máxima de un golpe) */
+#define AUDIO_FILL_LEVEL        (2 * AUDIO_BLOCK_SIZE)
+
+/** Nivel del buffer de la salida de audio que dispara el pedido de más muestras */
+#define AUDIO_LOW_LEVEL         AUDIO_BLOCK_SIZE
+
+/** Ganancia de la salida de audio (1.0: PCM a escala completa del DAC) */
+#define AUDIO_GAIN              1.0f
+
+/** Partición de datos con el banco de sonidos (ver partitions.csv) */
+#define SAMPLE_BANK_PARTITION   "samples"
+
+/** Grabación de sonidos (ver @ref sampleCapture) */
+#define CAPTURE_DECIMATION      2       /*!< Muestras del ADC promediadas por muestra grabada (10 kHz) */
+#define CAPTURE_MS              1000    /*!< Duración máxima de un sonido grabado (ms) */
+#define CAPTURE_PRE_MS          2       /*!< Señal guardada antes del cruce del umbral (ms) */
+#define CAPTURE_RELEASE_MS      50      /*!< Tiempo bajo CAPTURE_END_LEVEL que termina el golpe, desvanecido (ms) */
+#define CAPTURE_END_LEVEL       0.01f   /*!< Nivel de fin del golpe, fracción de su pico */
+#define CAPTURE_PEAK            0.9f    /*!< Pico del sonido normalizado (fracción de la escala completa) */
+#define CAPTURE_FULL_SCALE      1650.0f /*!< Señal del PAD grabada a escala completa (mV) */
+#define CAPTURE_FORMAT          SAMPLE_ADPCM    /*!< Formato del sonido en la flash */
+#define CAPTURE_LENGHT          (ADC_SAMPLE_FREQ / CAPTURE_DECIMATION * CAPTURE_MS / 1000)
+
+/** Voces del mezclador: acota el costo de mezclar un bloque en redobles */
+#define MIXER_VOICES            6
+
+/** Voz que se roba cuando están todas ocupadas (la más baja: los golpes decaen) */
+#define MIXER_STEAL             AUDIO_MIXER_STEAL_QUIETEST
+
+/** Grupo de corte del hi-hat: un golpe nuevo corta el anterior */
+#define HIHAT_CHOKE_GROUP       1
+
+/** Decaimiento del hi-hat (ms hasta 1/e): suena como un hi-hat cerrado */
+#define HIHAT_DECAY_MS          60
+
+/** Ganancia del bus master (suma de las voces) */
+#define MASTER_GAIN             1.0f
+
+/** Pico máximo de la mezcla: el limitador baja la ganancia en lugar de recortar */
+#define MASTER_LIMIT            30000
+
+/** Tiempo de recuperación del limitador (ms) */
+#define MASTER_RELEASE_MS       100
+
+/** Milisegundos del ataque de cada sonido copiados a RAM (se reproducen sin leer la flash) */
+#define ATTACK_CACHE_MS         20
+
+/** Bytes de RAM para los ataques (los sonidos que no entran se leen enteros de la flash) */
+#define ATTACK_CACHE_SIZE       8192
+
+/** Byte de sincronización de los registros de golpes */
+#define HIT_RECORD_SYNC         0xA5
+
+/** Registros de golpes del anillo de TelemetryTask (potencia de 2, los que no entran se descartan) */
+#define HIT_RING_SIZE           32
+
+/** Máximo de registros enviados juntos por TelemetryTask */
+#define TELEMETRY_BATCH         8
+
+/** Empaquetado de las muestras del modo osciloscopio */
+#define SCOPE_PACK              SCOPE_PACK_12BIT
+
+/** Bloques del ADC del anillo del modo osciloscopio (potencia de 2, los que no entran se descartan) */
+#define SCOPE_RING_SIZE         8
+
+/** Duración del destello del LED al golpear un PAD (ms) */
+#define LED_FLASH_MS            125
+
+/** Tramas por segundo de los efectos del LED */
+#define LED_FRAME_RATE          50
+
+/** Cantidad de PADs (filas de la tabla pads[]) */
+#define PAD_NUM                 (sizeof(pads) / sizeof(pads[0]))
+
+// CAMBIO: Definimos valores para las notificaciones de sonido (bits, para no perder golpes simultáneos)
+/** Bit de notificación del golpe de un PAD */
+#define PLAY_PAD(pad)           (1UL << (pad))
+/** Bit de notificación del pedido de más muestras de la salida de audio */
+#define AUDIO_REFILL            (1UL << 31)
+/** Bit de notificación del cambio del sonido de un PAD (sound_update) */
+#define SOUND_UPDATE            (1UL << 30)
+
+/** Stack de las tareas (bytes, estáticos con CONFIG_DRIVERS_STATIC_ALLOCATION) */
+#define ADC_TASK_STACK          4096
+#define PLAY_SOUND_TASK_STACK   4096
+#define TELEMETRY_TASK_STACK    2048
+
+/** Presupuesto de CPU del kit (% del CPU, ver @ref perfBudget) */
+#define PERF_BUDGET_PERCENT     70
+
+/** Frecuencia del CPU (Hz) */
+#define PERF_CPU_HZ             (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000)
 
-// CAMBIO: Definimos valores para las notificaciones de sonido
-#define PLAY_SNARE              1
-#define PLAY_HIHAT              2
+/** Golpes por segundo del kit en el peor caso (uno por máscara de redisparo en cada PAD) */
+#define PERF_HIT_RATE           (PAD_NUM * 1000 / HIT_MASK_MS)
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Configuración de un PAD
+ */
+typedef struct {
+    const char *name;               /*!< Nombre del PAD */
+    adc_ch_t channel;               /*!< Canal del ADC */
+    float threshold;                /*!< Umbral mínimo de detección del golpe (mV) */
+    float max_level;                /*!< Nivel del pico que corresponde a la velocidad máxima (mV) */
+    const char *sound;              /*!< Nombre del sonido en el banco de la flash */
+    const uint8_t *adpcm;           /*!< Sonido por defecto, IMA-ADPCM (drum_samples.c) */
+    const int *size;                /*!< Muestras del sonido por defecto */
+    neopixel_color_t color;         /*!< Color del LED al golpear el PAD */
+    uint8_t note;                   /*!< Nota MIDI (General MIDI) */
+    uint8_t choke;                  /*!< Grupo de corte del sonido (AUDIO_MIXER_NO_CHOKE: ninguno) */
+    float decay_ms;                 /*!< Decaimiento agregado al sonido (ms hasta 1/e, 0: el del sonido) */
+} pad_config_t;
+
+/**
+ * @brief Registro binario de un golpe (ver @ref hitStream)
+ */
+typedef struct {
+    uint8_t sync;                   /*!< HIT_RECORD_SYNC */
+    uint8_t pad;                    /*!< Índice del PAD */
+    uint8_t velocity;               /*!< Velocidad (1 a 127) */
+    uint8_t checksum;               /*!< XOR de pad, velocity y los bytes de timestamp */
+    uint32_t timestamp;             /*!< Cruce del umbral (us desde el arranque) */
+} hit_record_t;
+_Static_assert(sizeof(hit_record_t) == 8, "hit_record_t debe ocupar 8 bytes");
 
 /*==================[internal data definition]===============================*/
 
+/** Tabla de PADs */
+static const pad_config_t pads[] = {
+    {"PAD A", CH1, 400, 1200, "snare", snare_drum_adpcm, &snare_drum_size, NEOPIXEL_COLOR_RED, 38, AUDIO_MIXER_NO_CHOKE, 0},
+    {"PAD B", CH0, 400, 1200, "hihat", hi_hat_adpcm, &hi_hat_size, NEOPIXEL_COLOR_BLUE, 42, HIHAT_CHOKE_GROUP, HIHAT_DECAY_MS},
+};
+_Static_assert(PAD_NUM <= HIT_MAX_PADS, "Demasiados PADs para la supresión de cross-talk");
+_Static_assert(PERF_ESTIMATE(PAD_NUM, ADC_SAMPLE_FREQ, SAMPLE_RATE, MIXER_VOICES, AUDIO_OUTPUT == AUDIO_OUTPUT_DAC,
+                             LED_FRAME_RATE, PERF_HIT_RATE) <= PERF_CPU_HZ,
+               "La configuración no entra en el CPU (ver perf_budget.h)");
+
+/**
+ * @brief Bloque de muestras crudas de los PADs del modo osciloscopio (ver @ref scopeMode, depende de PAD_NUM)
+ */
+typedef struct {
+    uint16_t data[PAD_NUM][ADC_FRAME_SIZE]; /*!< Muestras (12 bits) de cada PAD */
+    uint16_t lenght;                        /*!< Muestras por PAD */
+    uint32_t timestamp;                     /*!< Instante de la primera muestra (us) */
+} scope_block_t;
+
 /** Handle de la tarea de procesamiento ADC */
 TaskHandle_t adc_task_handle = NULL;
+STATIC_TASK_DEFINE(adc_task, ADC_TASK_STACK);
+
+/** Handle de la tarea que envía los registros de golpes */
+TaskHandle_t telemetry_task_handle = NULL;
+STATIC_TASK_DEFINE(telemetry_task, TELEMETRY_TASK_STACK);
+
+/** Anillo de registros de golpes (AdcTask -> TelemetryTask) */
+static ring_buffer_t hit_ring;
+static hit_record_t hit_ring_storage[HIT_RING_SIZE];
 
-/** Handle de la tarea de UMBRAL (visual) */
-TaskHandle_t umbral_task_handle = NULL;
+#if ADC_SOURCE != ADC_SOURCE_LIVE
+/** Captura que reemplaza al ADC (ver @ref replay) */
+static adc_replay_t adc_replay;
+#endif
+
+/** Modo osciloscopio activo (lo cambia 's' por UART_PC) */
+static volatile bool scope_mode = false;
+
+/** Anillo de bloques del modo osciloscopio (AdcTask -> TelemetryTask) */
+static ring_buffer_t scope_ring;
+static scope_block_t scope_ring_storage[SCOPE_RING_SIZE];
 
 // CAMBIO: Un solo Handle para la tarea de sonido
 /** Handle de la tarea de reproducción de sonido */
 TaskHandle_t  playSound_task_handle = NULL;
+STATIC_TASK_DEFINE(playSound_task, PLAY_SOUND_TASK_STACK);
+
+/** Filtros pasa altos de cada PAD */
+static iir_filter_t dc_filter[PAD_NUM];
+
+/** Detectores de golpes de cada PAD */
+static hit_detector_t hit_detector[PAD_NUM];
+
+/** Ruido de fondo de cada PAD (umbral adaptivo) */
+static noise_floor_t noise_floor[PAD_NUM];
+
+/** Supresión del cross-talk entre PADs */
+static hit_crosstalk_t crosstalk;
+
+#if ADC_SOURCE == ADC_SOURCE_LIVE && PAD_MONITOR
+/** Monitor de umbral del ADC de cada PAD (-1: sin monitor) */
+static int8_t pad_monitor[PAD_NUM];
+
+/** Monitores armados: los bloques se descartan hasta que uno dispare */
+static bool monitors_armed = false;
+#endif
+
+/** Ajustes de los PADs, editados por los comandos (protegidos por settings_mutex) */
+static pad_settings_t pad_settings[PAD_NUM];
+static SemaphoreHandle_t settings_mutex;
+STATIC_SEMAPHORE_DEFINE(settings_mutex);
+
+/** Ajustes en uso por AdcTask */
+static pad_settings_t pad_active[PAD_NUM];
+
+/** Ajustes editados aún no aplicados por AdcTask */
+static volatile bool settings_changed = false;
 
-/** Variable para almacenar la conversión ADC del PAD A (12 bits) */
-static uint16_t valor_adc_A = 0;
+/** Pedidos de guardar o borrar los ajustes de la NVS (los atiende TelemetryTask) */
+static volatile bool settings_save = false;
+static volatile bool settings_erase = false;
 
-/** Variable para almacenar la conversión ADC del PAD B (12 bits) */
-static uint16_t valor_adc_B = 0;
+/** Curva de velocidad de cada PAD (la arma ApplySettings) */
+static velocity_curve_t velocity_curve[PAD_NUM];
 
-/** Variable para almacenar los milivots registrados PAD A */
-static uint32_t milliv_A = 0;
+/** Ganancia del último golpe de cada PAD (Q15, la usa PlaySoundTask) */
+static volatile int16_t pad_gain[PAD_NUM];
 
-/** Variable para almacenar los milivots registrados PAD B */
-static uint32_t milliv_B = 0;
+/** Color del LED (back buffer de neopixel_stripe) */
+static neopixel_color_t led_color;
+
+/** Banco de sonidos mapeado desde la partición SAMPLE_BANK_PARTITION */
+static sample_bank_t sample_bank;
+
+/** Sonido de cada PAD (del banco o, si no hay banco, de drum_samples.c) */
+static sample_t pad_sound[PAD_NUM];
+
+/** Copia en RAM del ataque de los sonidos de los PADs */
+static sample_cache_t attack_cache;
+static uint8_t attack_cache_buffer[ATTACK_CACHE_SIZE] __attribute__((aligned(4)));
+
+/** Instante del cruce del umbral del último golpe de cada PAD (us, lo usa PlaySoundTask) */
+static volatile uint64_t hit_onset_time[PAD_NUM];
+
+/** Instante de la notificación del último golpe de cada PAD a PlaySoundTask (us) */
+static volatile uint64_t hit_notify_time[PAD_NUM];
+
+/** Grabación de sonidos (ver @ref sampleCapture) */
+static sample_capture_t capture;
+static int16_t capture_buffer[CAPTURE_LENGHT];
+
+/** Grabación pedida por 'g' (la arma AdcTask entre bloques) */
+static volatile bool capture_request = false;
+
+/** PAD que se está grabando (-1: ninguno) */
+static volatile int8_t capture_pad = -1;
+
+/** PAD cuyo sonido es la grabación de capture_buffer (-1: ninguno) */
+static volatile int8_t captured_pad = -1;
+
+/** Grabación terminada, aún no escrita en la flash (la escribe TelemetryTask) */
+static volatile bool capture_store = false;
+
+/** Último PAD golpeado */
+static volatile uint8_t last_pad = 0;
+
+/** Sonido nuevo de un PAD, lo copia PlaySoundTask con SOUND_UPDATE (sólo lo escribe AdcTask) */
+static sample_t sound_update;
+static volatile int8_t sound_update_pad = -1;
+
+/** Métricas (ver @ref metrics) */
+METRIC_COUNTER_DEFINE(metric_hits, "hits");
+METRIC_COUNTER_DEFINE(metric_hit_drops, "hit_drops");
+METRIC_COUNTER_DEFINE(metric_scope_drops, "scope_drops");
+METRIC_COUNTER_DEFINE(metric_ble_drops, "ble_drops");
+METRIC_HISTOGRAM_DEFINE(metric_latency, "latency_us", 2000, 4000, 6000, 8000, 10000, 15000, 20000, 50000);
+METRIC_HISTOGRAM_DEFINE(metric_block, "adc_block_us", 100, 200, 400, 800, 1600, 3200, 6400);
 
 /*==================[internal functions declaration]=========================*/
 /**
- * @brief Callback del timer A - dispara conversión ADC cada 50μs (20kHz)
+ * @brief Callback del ADC - un bloque de ADC_FRAME_SIZE muestras por canal está listo
+ */
+void AdcFrameCallback(void *param);
+
+/**
+ * @brief Callback de la salida de audio - pide más muestras a PlaySoundTask
  */
-void TimerAdcCallback(void *param);
+void AudioRefillCallback(void *param);
+
+/**
+ * @brief Callback de la UART - comandos del reporte de latencia
+ */
+void UartRxCallback(uint8_t *data, uint16_t lenght, void *param);
 
 /**
  * @brief Tarea que procesa y transmite datos del ADC
@@ -113,184 +698,952 @@ static void AdcTask(void *pvParameters);
 
 
 /**
- * @brief Tarea que enciende el LED momentáneamente al detectar un golpe
+ * @brief Tarea de baja prioridad que envía por UART los registros de golpes
  */
-static void UmbralTask(void *pvParameters);
+static void TelemetryTask(void *pvParameters);
 
 
 // CAMBIO: Declaración de la nueva tarea de sonido unificada
 /**
- * @brief Tarea que reproduce un sonido (Snare o HiHat) basado en una notificación
+ * @brief Tarea que reproduce los sonidos de los PADs golpeados basado en una notificación
  */
 static void PlaySoundTask(void *pvParameters);
 
 /*==================[external functions definition]==========================*/
 
-void TimerAdcCallback(void *param) {
-    // Notifica a la tarea AdcTask para que se ejecute
+void SAMPLE_PATH_ATTR AdcFrameCallback(void *param) {
+    // Notifica a la tarea AdcTask para que procese el bloque
     vTaskNotifyGiveFromISR(adc_task_handle, NULL);
 }
 
+#if ADC_SOURCE != ADC_SOURCE_LIVE
+/**
+ * @brief Callback de la reproducción de una captura (desde su tarea) - notifica a AdcTask
+ */
+static void ReplayBlockCallback(void *param) {
+    xTaskNotifyGive(adc_task_handle);
+}
+#endif
+
+/**
+ * @brief Callback de la salida de audio (desde ISR) cuando el buffer baja a AUDIO_LOW_LEVEL
+ */
+void SAMPLE_PATH_ATTR AudioRefillCallback(void *param) {
+    xTaskNotifyFromISR(playSound_task_handle, AUDIO_REFILL, eSetBits, NULL);
+}
+
+#if UART_OUTPUT == UART_OUTPUT_RECORDS
+/**
+ * @brief Envía por UART_PC una parte del volcado de la traza o de la instantánea de las métricas
+ */
+static void WriteUart(const void *data, uint32_t lenght) {
+    UartWrite(UART_PC, data, lenght);
+}
+#endif
+
+#if defined(CONFIG_DRIVERS_TASK_MONITOR) || UART_OUTPUT == UART_OUTPUT_RECORDS
+/**
+ * @brief Envía por UART_PC una línea del reporte de carga de las tareas o de la descripción de las métricas
+ */
+static void PrintUart(const char *line) {
+    UartSendString(UART_PC, line);
+}
+#endif
+
+/**
+ * @brief Ajustes por defecto de los PADs (tabla pads[])
+ */
+static void SettingsDefaults(pad_settings_t *settings) {
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        settings[i] = (pad_settings_t){
+            .threshold = pads[i].threshold, .max_level = pads[i].max_level, .sensitivity = 1.0f,
+            .crosstalk = CROSSTALK_RATIO, .curve = 1.0f, .flags = 0
+        };
+    }
+}
+
+/**
+ * @brief Ejecuta un comando de ajuste (ver @ref padSettings), desde la UART o el BLE
+ *
+ * @return true si el comando es válido
+ */
+static bool SettingsCommand(const char *line) {
+    xSemaphoreTake(settings_mutex, portMAX_DELAY);
+    pad_command_t command = PadSettingsCommand(pad_settings, PAD_NUM, line);
+    if (command == PAD_COMMAND_DEFAULTS) {
+        SettingsDefaults(pad_settings);
+        settings_erase = true;
+    } else if (command == PAD_COMMAND_SAVE) {
+        settings_save = true;
+    }
+    xSemaphoreGive(settings_mutex);
+    if (command == PAD_COMMAND_SET || command == PAD_COMMAND_DEFAULTS) {
+        settings_changed = true;
+    }
+    if ((command == PAD_COMMAND_SAVE || command == PAD_COMMAND_DEFAULTS) && telemetry_task_handle != NULL) {
+        // La escritura de la flash la hace TelemetryTask
+        xTaskNotifyGive(telemetry_task_handle);
+    }
+    return command != PAD_COMMAND_ERROR;
+}
+
+/**
+ * @brief Callback de la UART: 'l' envía el reporte de latencia, 'r' borra las mediciones,
+ * 's' activa o desactiva el modo osciloscopio, 't' envía la carga de las tareas, 'd' la traza,
+ * 'g' graba el próximo golpe del último PAD golpeado, 'm' envía las métricas y 'M' su descripción,
+ * 'p' el presupuesto de CPU;
+ * desde COMMAND_START hasta el fin de línea, un comando de ajuste
+ */
+void UartRxCallback(uint8_t *data, uint16_t lenght, void *param) {
+    static char command[COMMAND_MAX_LENGHT];
+    static int16_t command_lenght = -1;     // -1: fuera de un comando
+
+#if ADC_SOURCE == ADC_SOURCE_REPLAY_UART
+    // Todo lo que llega es la captura
+    AdcReplayFeed(&adc_replay, data, lenght);
+    return;
+#endif
+    for (uint16_t i = 0; i < lenght; i++) {
+        // Las letras de un comando no son comandos de un carácter
+        if (command_lenght >= 0) {
+            if (data[i] == '\n' || data[i] == '\r') {
+                command[command_lenght] = '\0';
+                bool ok = SettingsCommand(command);
+#if UART_OUTPUT == UART_OUTPUT_RECORDS
+                UartSendString(UART_PC, ok ? "ok\r\n" : "error\r\n");
+#else
+                (void)ok;
+#endif
+                command_lenght = -1;
+            } else if (command_lenght < COMMAND_MAX_LENGHT - 1) {
+                command[command_lenght++] = data[i];
+            }
+            continue;
+        }
+        if (data[i] == COMMAND_START) {
+            command_lenght = 0;
+        } else if (data[i] == 'l') {
+            LatencyProbeReport();
+        } else if (data[i] == 'r') {
+            LatencyProbeReset();
+        } else if (data[i] == 'p') {
+            PerfBudgetReport();
+        }
+#ifdef CONFIG_DRIVERS_TASK_MONITOR
+        else if (data[i] == 't') {
+            TaskMonitorReport(PrintUart);
+        }
+#endif
+#if UART_OUTPUT == UART_OUTPUT_RECORDS
+        else if (data[i] == 's') {
+            // MIDI serie (31250 baudios) no tiene ancho de banda para la señal cruda
+            scope_mode = !scope_mode;
+        } else if (data[i] == 'g') {
+            capture_request = true;
+        } else if (data[i] == 'm') {
+            MetricsDump(WriteUart);
+        } else if (data[i] == 'M') {
+            MetricsDescribe(PrintUart);
+        }
+#ifdef CONFIG_DRIVERS_TRACE
+        else if (data[i] == 'd') {
+            TraceDump(WriteUart);
+        }
+#endif
+#endif
+    }
+}
+
+#ifdef CONFIG_BT_ENABLED
+/**
+ * @brief Callback del BLE: una escritura que empieza con COMMAND_START es un comando de ajuste
+ * (los paquetes BLE-MIDI empiezan con un byte con el bit 7 en 1 y se ignoran)
+ */
+static void BleRxCallback(uint8_t *data, uint8_t length) {
+    char command[COMMAND_MAX_LENGHT];
+    uint8_t n = 0;
+    if (length == 0 || data[0] != COMMAND_START) {
+        return;
+    }
+    for (uint8_t i = 1; i < length && n < COMMAND_MAX_LENGHT - 1 && data[i] != '\n' && data[i] != '\r'; i++) {
+        command[n++] = data[i];
+    }
+    command[n] = '\0';
+    SettingsCommand(command);
+}
+#endif
+
+/**
+ * @brief Muestras cargadas en la salida de audio (aún no reproducidas)
+ */
+static uint32_t AudioQueued(void) {
+#if AUDIO_OUTPUT == AUDIO_OUTPUT_DAC
+    return DAC_STREAM_BUFFER_SIZE - AnalogOutputStreamFree();
+#else
+    return AUDIO_OUT_BUFFER_SIZE - AudioOutFree();
+#endif
+}
+
+/**
+ * @brief Mezcla bloques de audio hasta tener AUDIO_FILL_LEVEL muestras en la salida
+ */
+static void AudioFill(audio_mixer_t *mixer) {
+    int16_t mix[AUDIO_BLOCK_SIZE];
+    while (AudioQueued() < AUDIO_FILL_LEVEL) {
+        uint32_t t = PerfBudgetNow();
+        AudioMixerProcess(mixer, mix, AUDIO_BLOCK_SIZE);
+        t = PerfBudgetAdd(PERF_MIXING, t);
+#if AUDIO_OUTPUT == AUDIO_OUTPUT_DAC
+        AnalogOutputStreamWritePCM(mix, AUDIO_BLOCK_SIZE, AUDIO_GAIN);
+#else
+        // el bloque se copia a los buffers del DMA: sin interrupciones por muestra
+        AudioOutWrite(mix, AUDIO_BLOCK_SIZE, AUDIO_GAIN);
+#endif
+        PerfBudgetAdd(PERF_OUTPUT, t);
+    }
+}
+
+/**
+ * @brief Sonido de drum_samples.c de un PAD
+ */
+static sample_t DefaultSound(uint8_t pad) {
+    return (sample_t){
+        .data = pads[pad].adpcm, .lenght = *pads[pad].size, .sample_rate = SAMPLE_RATE,
+        .format = SAMPLE_ADPCM, .name = pads[pad].sound
+    };
+}
+
+/**
+ * @brief Carga el sonido de cada PAD: el del banco con su nombre (si existe y el mezclador puede remuestrearlo) o el de drum_samples.c,
+ * con su ataque en RAM
+ */
+static void LoadPadSounds(void) {
+    bool bank = SampleBankLoad(&sample_bank, SAMPLE_BANK_PARTITION);
+    SampleCacheInit(&attack_cache, ATTACK_CACHE_MS, attack_cache_buffer, ATTACK_CACHE_SIZE);
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        pad_sound[i] = DefaultSound(i);
+        sample_t sample;
+        int16_t index = bank ? SampleBankFind(&sample_bank, pads[i].sound) : -1;
+        if ((index >= 0) && SampleBankGet(&sample_bank, index, &sample) &&
+            (sample.sample_rate > 0) && (sample.sample_rate <= AUDIO_MIXER_MAX_RATIO * SAMPLE_RATE)) {
+            pad_sound[i] = sample;
+        }
+        // el ataque se copia a RAM: el golpe suena aunque la flash esté ocupada (NVS) o fuera de la caché
+        SampleCacheAdd(&attack_cache, &pad_sound[i]);
+    }
+}
+
+/**
+ * @brief Reproduce un sonido en una voz del mezclador según su formato (remuestreado si no está a SAMPLE_RATE,
+ * el ataque desde RAM), con la envolvente del PAD y cortando los sonidos de su grupo
+ */
+static void PlaySample(audio_mixer_t *mixer, const sample_t *sound, float gain, const pad_config_t *pad) {
+    uint8_t voice;
+    if (sound->format == SAMPLE_ADPCM) {
+        voice = AudioMixerPlayADPCM(mixer, sound->data, sound->lenght, gain);
+    } else {
+        voice = AudioMixerPlay(mixer, sound->data, sound->lenght, 0, gain);
+    }
+    if (sound->head != NULL) {
+        AudioMixerSetAttack(mixer, voice, sound->head, sound->head_lenght);
+    }
+    if (sound->sample_rate != SAMPLE_RATE) {
+        AudioMixerSetRatio(mixer, voice, (float)sound->sample_rate / SAMPLE_RATE);
+    }
+    AudioMixerSetDecay(mixer, voice, pad->decay_ms * SAMPLE_RATE / 1000);
+    AudioMixerSetChoke(mixer, voice, pad->choke);
+}
+
 // CAMBIO: Tarea de sonido unificada
 static void PlaySoundTask(void *pvParameters) {
-    uint32_t soundToPlay;
+    static audio_mixer_t mixer;
+    uint32_t events;
 
+    AudioMixerInit(&mixer);
+    AudioMixerSetPolicy(&mixer, MIXER_STEAL, MIXER_VOICES);
+    AudioMixerSetMaster(&mixer, MASTER_GAIN, MASTER_LIMIT, MASTER_RELEASE_MS * SAMPLE_RATE / 1000);
+    // Carga inicial: a partir de aquí la salida de audio pide más muestras
+    AudioFill(&mixer);
     while (true) {
-        // Espera permanentemente hasta recibir una notificación
-        if (xTaskNotifyWait(0, 0xFFFFFFFF, &soundToPlay, portMAX_DELAY) == pdTRUE) {
-            
-            // Revisa qué sonido debe reproducir según el valor de la notificación
-            if (soundToPlay == PLAY_SNARE) {
-                
-                // CAMBIO: Corregido el bug de 'sizeof'. 
-                // Usamos el tamaño real del array (definido en drum_samples.c)
-                for (int i = 0; i < snare_drum_size; i++) {
-                    AnalogOutputWrite(snare_drum_sample[i]);
-                    // Espera el tiempo de muestreo del audio
-                    vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE)); 
-                }
-
-            } else if (soundToPlay == PLAY_HIHAT) {
-                
-                // CAMBIO: Corregido el bug de 'sizeof'.
-                for (int i = 0; i < hi_hat_size; i++) {
-                    AnalogOutputWrite(hi_hat_sample[i]);
-                    vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE));
+        // Espera golpes (PLAY_PAD) o el pedido de más muestras (AUDIO_REFILL)
+        if (xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY) == pdTRUE) {
+            TRACE_BEGIN(TRACE_PLAY_SOUND_TASK, events);
+            if ((events & SOUND_UPDATE) && sound_update_pad >= 0) {
+                // Los golpes siguientes usan el sonido nuevo (las voces activas siguen con el anterior)
+                pad_sound[sound_update_pad] = sound_update;
+                sound_update_pad = -1;
+            }
+            // Cada golpe ocupa una voz del mezclador, así los sonidos se superponen
+            for (uint8_t i = 0; i < PAD_NUM; i++) {
+                if (events & PLAY_PAD(i)) {
+                    // La primera muestra de la voz sale después de las ya cargadas en la salida
+                    uint64_t t_voice = TimeNowUs();
+                    uint32_t queued = AudioQueued();
+                    uint32_t t = PerfBudgetNow();
+                    PlaySample(&mixer, &pad_sound[i], (float)pad_gain[i] / VELOCITY_CURVE_GAIN_ONE, &pads[i]);
+                    PerfBudgetAdd(PERF_MIXING, t);
+                    uint64_t t_dac = t_voice + (uint64_t)queued * 1000000 / SAMPLE_RATE;
+                    LatencyProbeAdd(hit_onset_time[i], hit_notify_time[i], t_voice, t_dac);
+                    MetricsObserve(&metric_latency, t_dac - hit_onset_time[i]);
                 }
             }
-            // Aseguramos que el DAC quede en silencio (valor medio)
-            AnalogOutputWrite(512); 
+            // Sin voces activas se mezcla silencio (costo constante por muestra)
+            AudioFill(&mixer);
+            TRACE_END(TRACE_PLAY_SOUND_TASK, events);
         }
     }
 }
 
 
-static void AdcTask(void *pvParameters) {
-    
-    uint32_t last_hit_time_A = 0;
-    uint32_t last_hit_time_B = 0;
-    uint32_t current_time = 0;
+/**
+ * @brief Cambia el sonido de un PAD (desde AdcTask, lo aplica PlaySoundTask)
+ */
+static void SoundUpdate(uint8_t pad, const sample_t *sound) {
+    sound_update = *sound;
+    sound_update_pad = pad;
+    xTaskNotify(playSound_task_handle, SOUND_UPDATE, eSetBits);
+}
 
-    // CAMBIO: Movemos el buffer aquí para no crearlo en cada bucle
-    char buffer[32]; 
+/**
+ * @brief Arma la grabación del próximo golpe del último PAD golpeado (desde AdcTask, entre bloques)
+ */
+static void CaptureArm(void) {
+    capture_request = false;
+    if (captured_pad >= 0) {
+        // El buffer se reutiliza: el PAD grabado antes vuelve a su sonido por defecto
+        sample_t sound = DefaultSound(captured_pad);
+        SoundUpdate(captured_pad, &sound);
+        captured_pad = -1;
+    }
+    SampleCaptureStart(&capture);
+    capture_pad = last_pad;
+}
+
+/**
+ * @brief Graba la señal filtrada del PAD; al terminar el golpe el PAD suena con la grabación y
+ * TelemetryTask la escribe en la flash
+ */
+static void CaptureProcess(uint8_t pad, const float *signal, uint16_t n) {
+    SampleCaptureSetThreshold(&capture, NoiseFloorThreshold(&noise_floor[pad]));
+    if (SampleCaptureProcess(&capture, signal, n) == SAMPLE_CAPTURE_DONE) {
+        sample_t sound;
+        SampleCaptureGet(&capture, &sound);
+        sound.name = pads[pad].sound;
+        SoundUpdate(pad, &sound);
+        captured_pad = pad;
+        capture_pad = -1;
+        capture_store = true;
+        xTaskNotifyGive(telemetry_task_handle);
+    }
+}
+
+/**
+ * @brief Filtra el bloque de un PAD y detecta sus golpes (devuelve la cantidad guardada en hits)
+ */
+static uint8_t DetectPad(const analog_block_t *block, uint8_t pad, hit_event_t *hits) {
+    float signal[ADC_CONT_MAX_FRAME_SIZE];
+    uint16_t n = block->lenght[pads[pad].channel];
+    uint32_t t = PerfBudgetNow();
+
+    // mV calibrados (tabla del canal) y sin deriva de continua
+    AnalogBlockToFloat(block, pads[pad].channel, signal);
+    IIRFilterProcess(&dc_filter[pad], signal, signal, n);
+    t = PerfBudgetAdd(PERF_ACQUISITION, t);
+    // Umbral estimado con los bloques anteriores, fijo durante el bloque
+    HitDetectorSetThreshold(&hit_detector[pad], NoiseFloorThreshold(&noise_floor[pad]));
+    uint8_t n_hits = HitDetectorProcess(&hit_detector[pad], signal, n, hits, HITS_PER_BLOCK);
+    if (pad == capture_pad) {
+        CaptureProcess(pad, signal, n);
+    }
+    NoiseFloorProcess(&noise_floor[pad], signal, n);
+    PerfBudgetAdd(PERF_DETECTION, t);
+    return (n_hits < HITS_PER_BLOCK) ? n_hits : HITS_PER_BLOCK;
+}
 
+/**
+ * @brief Copia los ajustes editados y los aplica a la detección (desde AdcTask, entre bloques)
+ */
+static void ApplySettings(void) {
+    settings_changed = false;
+    xSemaphoreTake(settings_mutex, portMAX_DELAY);
+    memcpy(pad_active, pad_settings, sizeof(pad_active));
+    xSemaphoreGive(settings_mutex);
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        // La sensibilidad escala los umbrales en lugar de la señal (sin costo por muestra)
+        hit_detector_config_t hit_config = {
+            .sample_frec = ADC_SAMPLE_FREQ,
+            .threshold = pad_active[i].threshold / pad_active[i].sensitivity,
+            .max_level = pad_active[i].max_level / pad_active[i].sensitivity,
+            .scan_time = HIT_SCAN_MS,
+            .mask_time = HIT_MASK_MS,
+            .decay_time = HIT_DECAY_MS
+        };
+        HitDetectorInit(&hit_detector[i], &hit_config);
+        // Tabla de la curva: una pasada por cambio de ajustes, no por golpe
+        if (pad_active[i].points > 0) {
+            VelocityCurveInitCustom(&velocity_curve[i], pad_active[i].point, pad_active[i].points,
+                                    hit_config.threshold, hit_config.max_level);
+        } else {
+            VelocityCurveInit(&velocity_curve[i], VELOCITY_CURVE_POWER, pad_active[i].curve,
+                              hit_config.threshold, hit_config.max_level);
+        }
+        NoiseFloorSetMinimum(&noise_floor[i], hit_config.threshold);
+        HitCrosstalkSetRatio(&crosstalk, i, pad_active[i].crosstalk);
+    }
+}
+
+/**
+ * @brief Calibración del primer arranque: el umbral de los PADs sin calibrar pasa a ser el
+ * estimado sobre el ruido de fondo, y los ajustes se guardan (ver @ref padSettings)
+ */
+static void CalibrateThresholds(void) {
+    bool calibrated = false;
+    xSemaphoreTake(settings_mutex, portMAX_DELAY);
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        pad_settings_t *settings = &pad_settings[i];
+        if (settings->flags & PAD_SETTINGS_CALIBRATED) {
+            continue;
+        }
+        // Umbral de la señal del PAD llevado a mV sin sensibilidad (nunca menor que el de la tabla)
+        float threshold = NoiseFloorThreshold(&noise_floor[i]) * settings->sensitivity;
+        if (threshold < settings->max_level) {
+            settings->threshold = threshold;
+        }
+        settings->flags |= PAD_SETTINGS_CALIBRATED;
+        calibrated = true;
+    }
+    xSemaphoreGive(settings_mutex);
+    if (calibrated) {
+        settings_changed = true;
+        settings_save = true;
+        xTaskNotifyGive(telemetry_task_handle);
+    }
+}
+
+/**
+ * @brief Guarda o borra los ajustes de la NVS si se pidió (desde TelemetryTask: escribir la flash demora ms)
+ */
+static void StoreSettings(void) {
+    uint8_t blob[PAD_SETTINGS_SIZE(PAD_NUM)];
+    if (settings_erase) {
+        settings_erase = false;
+        NvsErase(SETTINGS_KEY);
+    }
+    if (settings_save) {
+        settings_save = false;
+        xSemaphoreTake(settings_mutex, portMAX_DELAY);
+        uint16_t lenght = PadSettingsEncode(pad_settings, PAD_NUM, blob);
+        xSemaphoreGive(settings_mutex);
+        NvsWrite(SETTINGS_KEY, blob, lenght);
+    }
+}
+
+/**
+ * @brief Escribe la última grabación en el banco de la flash si terminó (desde TelemetryTask)
+ */
+static void StoreCapture(void) {
+    sample_t sound;
+    if (!capture_store) {
+        return;
+    }
+    SampleCaptureGet(&capture, &sound);
+    bool ok = SampleBankWrite(SAMPLE_BANK_PARTITION, pads[captured_pad].sound, sound.data, sound.lenght,
+                              sound.sample_rate, CAPTURE_FORMAT);
+#if UART_OUTPUT == UART_OUTPUT_RECORDS
+    UartSendString(UART_PC, ok ? "capture: ok\r\n" : "capture: error\r\n");
+#else
+    (void)ok;
+#endif
+    capture_store = false;
+}
+
+/**
+ * @brief Carga los ajustes guardados en la NVS (o los de la tabla si no hay, o no son de esta tabla)
+ */
+static void LoadSettings(void) {
+    uint8_t blob[PAD_SETTINGS_SIZE(PAD_NUM)];
+    uint32_t lenght = sizeof(blob);
+    SettingsDefaults(pad_settings);
+    if (NvsInit() && NvsRead(SETTINGS_KEY, blob, &lenght)) {
+        PadSettingsDecode(pad_settings, PAD_NUM, blob, lenght);
+    }
+}
+
+/**
+ * @brief Arma el registro binario de un golpe
+ */
+static hit_record_t HitRecord(uint8_t pad, uint8_t velocity, uint32_t timestamp) {
+    hit_record_t record = {
+        .sync = HIT_RECORD_SYNC, .pad = pad, .velocity = velocity, .checksum = 0, .timestamp = timestamp
+    };
+    const uint8_t *bytes = (const uint8_t *)&record;
+    for (uint8_t i = 1; i < sizeof(hit_record_t); i++) {
+        record.checksum ^= bytes[i];
+    }
+    return record;
+}
+
+/**
+ * @brief Notifica los golpes de un PAD a las otras tareas y guarda sus registros para TelemetryTask
+ *
+ * @param block_time Instante de la primera muestra del bloque (us), para fechar el cruce del umbral
+ */
+static void NotifyHits(uint8_t pad, const hit_event_t *hits, uint8_t n_hits, uint64_t block_time) {
+    for (uint8_t i = 0; i < n_hits; i++) {
+        uint32_t t = PerfBudgetNow();
+        // Velocidad y ganancia del pico con la tabla del PAD
+        velocity_entry_t entry = VelocityCurveLookup(&velocity_curve[pad], hits[i].peak);
+        uint8_t velocity = entry.velocity;
+        // onset es relativo al bloque (negativo si el cruce fue en un bloque anterior)
+        TRACE_EVENT(TRACE_HIT, pad << 8 | velocity);
+        hit_onset_time[pad] = block_time + (int64_t)hits[i].onset * 1000000 / ADC_SAMPLE_FREQ;
+        // Sin espera: si TelemetryTask está atrasada el registro se descarta, nunca se demora el muestreo
+        hit_record_t record = HitRecord(pad, velocity, (uint32_t)hit_onset_time[pad]);
+        if (RingBufferPush(&hit_ring, &record)) {
+            xTaskNotifyGive(telemetry_task_handle);
+        } else {
+            MetricsCount(&metric_hit_drops, 1);
+        }
+        MetricsCount(&metric_hits, 1);
+
+        pad_gain[pad] = entry.gain;
+        last_pad = pad;
+        t = PerfBudgetAdd(PERF_DETECTION, t);
+        NeoPixelEffectFlash(pads[pad].color, LED_FLASH_MS);
+        t = PerfBudgetAdd(PERF_LED, t);
+        hit_notify_time[pad] = TimeNowUs();
+        xTaskNotify(playSound_task_handle, PLAY_PAD(pad), eSetBits);
+        PerfBudgetAdd(PERF_DETECTION, t);
+    }
+}
+
+/**
+ * @brief Copia las muestras crudas de los PADs al anillo del modo osciloscopio (sin esperar)
+ */
+static void ScopeCapture(const analog_block_t *block) {
+    static scope_block_t scope_block;
+    scope_block.lenght = block->lenght[pads[0].channel];
+    scope_block.timestamp = (uint32_t)block->timestamp;
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        memcpy(scope_block.data[i], block->data[pads[i].channel], scope_block.lenght * sizeof(uint16_t));
+    }
+    // Si TelemetryTask está atrasada el bloque se descarta (lo cuenta scope_ring.overflows)
+    if (RingBufferPush(&scope_ring, &scope_block)) {
+        xTaskNotifyGive(telemetry_task_handle);
+    } else {
+        MetricsCount(&metric_scope_drops, 1);
+    }
+}
+
+/**
+ * @brief Siguiente bloque de los PADs: del ADC o de la captura (ver @ref replay)
+ */
+static analog_block_t *AdcGetBlock(void) {
+#if ADC_SOURCE == ADC_SOURCE_LIVE
+    return AnalogInputGetBlock();
+#else
+    return AdcReplayGetBlock(&adc_replay);
+#endif
+}
+
+/**
+ * @brief Devuelve un bloque obtenido con AdcGetBlock
+ */
+static void AdcReleaseBlock(analog_block_t *block) {
+#if ADC_SOURCE == ADC_SOURCE_LIVE
+    AnalogInputReleaseBlock(block);
+#else
+    AdcReplayReleaseBlock(&adc_replay, block);
+#endif
+}
+
+#if ADC_SOURCE == ADC_SOURCE_LIVE && PAD_MONITOR
+/**
+ * @brief Arma el monitor de cada PAD alrededor del nivel de reposo del bloque (ver @ref padMonitor)
+ *
+ * Sólo si todos los PADs tienen monitor y ninguno tiene un golpe en curso.
+ */
+static void PadMonitorsArm(const analog_block_t *block) {
+    uint16_t low[PAD_NUM], high[PAD_NUM];
+    if (monitors_armed || scope_mode || capture_pad >= 0) {
+        return;
+    }
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        adc_ch_t ch = pads[i].channel;
+        uint16_t n = block->lenght[ch];
+        if (pad_monitor[i] < 0 || hit_detector[i].state != HIT_IDLE || n == 0) {
+            return;
+        }
+        // Nivel de reposo: la continua que saca el pasa altos
+        uint32_t sum = 0;
+        for (uint16_t k = 0; k < n; k++) {
+            sum += block->data[ch][k];
+        }
+        int32_t rest = sum / n;
+        // Umbral en mV a cuentas, con la pendiente de la tabla del canal
+        const uint16_t *lut = AnalogInputGetLUT(ch);
+        float mv_per_code = (lut != NULL) ? (float)(lut[ADC_RAW_MAX] - lut[0]) / ADC_RAW_MAX : 3300.0f / ADC_RAW_MAX;
+        int32_t delta = NoiseFloorThreshold(&noise_floor[i]) * PAD_MONITOR_MARGIN / mv_per_code;
+        low[i] = (rest > delta) ? rest - delta : 0;
+        high[i] = (rest + delta < ADC_RAW_MAX) ? rest + delta : ADC_RAW_MAX;
+    }
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        AnalogInputMonitorArm(pad_monitor[i], low[i], high[i]);
+    }
+    monitors_armed = true;
+}
+
+/**
+ * @brief true si ningún monitor disparó (el próximo bloque no tiene golpes); si no, los desarma
+ */
+static bool PadMonitorsWaiting(void) {
+    if (!monitors_armed) {
+        return false;
+    }
+    bool fired = scope_mode || settings_changed || capture_request;
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        fired |= AnalogInputMonitorFired(pad_monitor[i]);
+    }
+    if (!fired) {
+        return true;
+    }
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        AnalogInputMonitorDisarm(pad_monitor[i]);
+    }
+    monitors_armed = false;
+    return false;
+}
+#endif
+
+#if ADC_SOURCE != ADC_SOURCE_LIVE
+/**
+ * @brief Al terminar la captura envía por UART_PC las muestras procesadas y la capacidad de AdcTask (una vez)
+ */
+static void ReplayReport(void) {
+    static bool reported = false;
+    adc_replay_stats_t stats;
+    char line[96];
+    AdcReplayGetStats(&adc_replay, &stats);
+    if (reported || !stats.done) {
+        return;
+    }
+    reported = true;
+    snprintf(line, sizeof(line), "replay: %lu bloques, %llu muestras en %llu us (%.0f muestras/s)\r\n",
+             (unsigned long)stats.blocks, (unsigned long long)stats.samples, (unsigned long long)stats.elapsed_us,
+             stats.samples_per_s);
+    UartSendString(UART_PC, line);
+}
+#endif
+
+static void AdcTask(void *pvParameters) {
+    analog_block_t *block;
+    static hit_event_t hits[PAD_NUM][HITS_PER_BLOCK];
+    hit_event_t *hits_p[PAD_NUM];
+    uint8_t n_hits[PAD_NUM];
+    // Sin ajustes calibrados guardados, se calibra al terminar estos bloques
+    uint32_t calibration_blocks = CALIBRATION_MS * (ADC_SAMPLE_FREQ / 1000) / ADC_FRAME_SIZE;
+
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        hits_p[i] = hits[i];
+    }
     while (1) {
-        // Espera la notificación del Timer (cada 50us)
+        // Espera la notificación del ADC (cada ADC_FRAME_SIZE muestras)
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        
-        // Lee ambos conversores ADC 
-        AnalogInputReadSingle(ADC_CHANNEL_A, &valor_adc_A);
-        AnalogInputReadSingle(ADC_CHANNEL_B, &valor_adc_B); 
-        
-        // Convierte a milivoltios
-        milliv_A = (uint32_t)((valor_adc_A * 3300UL) / 4095UL);
-        milliv_B = (uint32_t)((valor_adc_B * 3300UL) / 4095UL); 
-       
-        /*
-         * CAMBIO: Hemos movido la lógica de envío UART DENTRO
-         * de los 'if' que detectan el golpe.
-         * Ya no se envía en cada muestra de 50us.
-         */
-        
-        // --- Lógica de Detección de Golpes ---
-        
-        current_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-
-        // Comprueba PAD A
-        if ((milliv_A > ADC_THRESHOLD_MV_MINIMUM) && (current_time - last_hit_time_A > HIT_COOLDOWN_MS)) {
-            last_hit_time_A = current_time; 
-            
-            // CAMBIO: Enviar datos solo al detectar el golpe
-            sprintf(buffer, "PAD A: %lu\r\n", (unsigned long)milliv_A);
-            UartSendString(UART_PC, buffer);
-
-            // Notifica a las otras tareas
-            // Línea 208 (Corregida)
-            xTaskNotify(umbral_task_handle, 0, eIncrement);
-            xTaskNotify(playSound_task_handle, PLAY_SNARE, eSetValueWithOverwrite);
-        } 
-        
-        // Comprueba PAD B
-        if ((milliv_B > ADC_THRESHOLD_MV_MINIMUM) && (current_time - last_hit_time_B > HIT_COOLDOWN_MS)) {
-            last_hit_time_B = current_time; 
-
-            // CAMBIO: Enviar datos solo al detectar el golpe
-            sprintf(buffer, "PAD B: %lu\r\n", (unsigned long)milliv_B);
-            UartSendString(UART_PC, buffer);
-
-            // Notifica a las otras tareas
-            // Línea 208 (Corregida)
-            xTaskNotify(umbral_task_handle, 0, eIncrement);
-            xTaskNotify(playSound_task_handle, PLAY_HIHAT, eSetValueWithOverwrite);
+
+#if ADC_SOURCE == ADC_SOURCE_LIVE && PAD_MONITOR
+        // Sin disparos de los monitores no hay golpes: los bloques se descartan sin procesarlos
+        while (PadMonitorsWaiting() && AnalogInputSkipBlock()) {
+        }
+#endif
+        // Procesa todos los bloques convertidos
+        while ((block = AdcGetBlock()) != NULL) {
+            uint16_t block_hits = 0;
+            uint64_t t_block = TimeNowUs();
+            TRACE_BEGIN(TRACE_ADC_TASK, 0);
+            if (settings_changed) {
+                ApplySettings();
+            }
+            // La grabación anterior se termina de escribir antes de reutilizar el buffer
+            if (capture_request && !capture_store) {
+                CaptureArm();
+            }
+            for (uint8_t i = 0; i < PAD_NUM; i++) {
+                n_hits[i] = DetectPad(block, i, hits[i]);
+            }
+            // Descarta los golpes de un PAD provocados por la vibración de otro (en la misma pasada)
+            uint32_t t = PerfBudgetNow();
+            HitCrosstalkProcess(&crosstalk, hits_p, n_hits, block->lenght[pads[0].channel]);
+            PerfBudgetAdd(PERF_DETECTION, t);
+            for (uint8_t i = 0; i < PAD_NUM; i++) {
+                NotifyHits(i, hits[i], n_hits[i], block->timestamp);
+                block_hits += n_hits[i];
+            }
+            if (scope_mode) {
+                ScopeCapture(block);
+            }
+#if ADC_SOURCE == ADC_SOURCE_LIVE && PAD_MONITOR
+            if (calibration_blocks == 0) {
+                PadMonitorsArm(block);
+            }
+#endif
+            AdcReleaseBlock(block);
+            if (calibration_blocks > 0 && --calibration_blocks == 0) {
+                CalibrateThresholds();
+            }
+            MetricsObserve(&metric_block, TimeNowUs() - t_block);
+            TRACE_END(TRACE_ADC_TASK, block_hits);
         }
+#if ADC_SOURCE != ADC_SOURCE_LIVE
+        ReplayReport();
+#endif
     }
 }
 
+#if UART_OUTPUT == UART_OUTPUT_MIDI
 /**
- * @brief Tarea que monitorea el valor del ADC y reproduce sonido (o activa pin)
- * cuando se supera el umbral configurado.
+ * @brief Envía los golpes por UART_PC como MIDI serie
  */
-static void UmbralTask(void *pvParameters) {
-    // Esta tarea solo controla el LED como feedback visual
-    while(true){
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Espera un golpe
-        NeoPixelAllColor(NEOPIXEL_COLOR_RED);   
-        vTaskDelay(pdMS_TO_TICKS(125)); // Mantiene el LED encendido 125ms
-        NeoPixelAllOff(); 
+static void SendMidiSerial(midi_serial_t *midi, const hit_record_t *records, uint32_t n) {
+    uint8_t msg[MIDI_MSG_MAX_LENGHT];
+    uint8_t buffer[TELEMETRY_BATCH * MIDI_MSG_MAX_LENGHT];
+    uint8_t lenght = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint8_t msg_lenght = MidiNoteOn(MIDI_CHANNEL, pads[records[i].pad].note, records[i].velocity, msg);
+        lenght += MidiSerialEncode(midi, msg, msg_lenght, &buffer[lenght]);
     }
+    UartWrite(UART_PC, buffer, lenght);
 }
+#endif
 
-void app_main(void) {
+#ifdef CONFIG_BT_ENABLED
+/**
+ * @brief Envía los golpes por BLE-MIDI (en la menor cantidad de paquetes, con el timestamp de cada uno)
+ */
+static void SendBleMidi(const hit_record_t *records, uint32_t n) {
+    uint8_t msg[MIDI_MSG_MAX_LENGHT];
+    ble_midi_packet_t packet;
+    if (BleStatus() != BLE_CONNECTED) {
+        return;
+    }
+    BleMidiPacketInit(&packet);
+    for (uint32_t i = 0; i < n; i++) {
+        uint8_t msg_lenght = MidiNoteOn(MIDI_CHANNEL, pads[records[i].pad].note, records[i].velocity, msg);
+        uint16_t time = (records[i].timestamp / 1000) & BLE_MIDI_TIME_MASK;
+        if (!BleMidiPacketAdd(&packet, time, msg, msg_lenght)) {
+            // Paquete lleno: se envía y el golpe inicia el siguiente (sin esperar, si no entra se descarta)
+            if (!BleWrite(packet.data, packet.lenght)) {
+                MetricsCount(&metric_ble_drops, 1);
+            }
+            BleMidiPacketInit(&packet);
+            BleMidiPacketAdd(&packet, time, msg, msg_lenght);
+        }
+    }
+    if (!BleWrite(packet.data, packet.lenght)) {
+        MetricsCount(&metric_ble_drops, 1);
+    }
+}
+#endif
 
-    analog_input_config_t adc_config_A = {
-        .input = ADC_CHANNEL_A,   // Canal CH1 para PAD A
-        .mode = ADC_SINGLE,
-        .func_p = NULL,         
-        .param_p = NULL,
-        .sample_frec = 0        
-    };
-    
-    analog_input_config_t adc_config_B = { 
-        .input = ADC_CHANNEL_B,   // Canal CH0 para PAD B
-        .mode = ADC_SINGLE,
-        .func_p = NULL,         
-        .param_p = NULL,
-        .sample_frec = 0        
-    };
+/**
+ * @brief Envía por UART_PC los bloques acumulados del modo osciloscopio
+ */
+static void SendScope(scope_stream_t *scope) {
+    static scope_block_t block;
+    static uint8_t frame[SCOPE_FRAME_SIZE(PAD_NUM * ADC_FRAME_SIZE)];
+    const uint16_t *data[PAD_NUM];
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        data[i] = block.data[i];
+    }
+    while (RingBufferPop(&scope_ring, &block)) {
+        uint32_t t = PerfBudgetNow();
+        uint16_t lenght = ScopeStreamEncode(scope, data, block.lenght, block.timestamp, scope_ring.overflows, frame);
+        PerfBudgetAdd(PERF_TELEMETRY, t);
+        // Espera lugar en el buffer de transmisión: mientras tanto el anillo absorbe (o descarta) bloques
+        UartWrite(UART_PC, frame, lenght);
+    }
+}
+
+static void TelemetryTask(void *pvParameters) {
+    hit_record_t batch[TELEMETRY_BATCH];
+    uint32_t n;
+    static scope_stream_t scope;
+    ScopeStreamInit(&scope, SCOPE_PACK, PAD_NUM);
+#if UART_OUTPUT == UART_OUTPUT_MIDI
+    midi_serial_t midi;
+    MidiSerialInit(&midi);
+#endif
+    while (true) {
+        // Espera golpes y envía todos los registros acumulados, de a TELEMETRY_BATCH por vez
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TRACE_BEGIN(TRACE_TELEMETRY_TASK, 0);
+        uint32_t t = PerfBudgetNow();
+        while ((n = RingBufferRead(&hit_ring, batch, TELEMETRY_BATCH)) > 0) {
+#if UART_OUTPUT == UART_OUTPUT_MIDI
+            SendMidiSerial(&midi, batch, n);
+#else
+            // En modo osciloscopio los registros se mezclarían con las tramas
+            if (!scope_mode) {
+                UartWrite(UART_PC, batch, n * sizeof(hit_record_t));
+            }
+#endif
+#ifdef CONFIG_BT_ENABLED
+            SendBleMidi(batch, n);
+#endif
+        }
+        PerfBudgetAdd(PERF_TELEMETRY, t);
+        // La espera de lugar en la UART no es del presupuesto: sólo se mide la codificación
+        SendScope(&scope);
+        StoreSettings();
+        StoreCapture();
+        TRACE_END(TRACE_TELEMETRY_TASK, 0);
+    }
+}
+
+void app_main(void) {
 
     // Inicialización UART 
    serial_config_t uart_config = {
         .port = UART_PC,
         .baud_rate = UART_BAUD_RATE,
-        .func_p = NULL,         
-        .param_p = NULL
+        .func_p = UART_NO_INT,
+        .param_p = NULL,
+        .tx_buffer_size = UART_TX_BUFFER_SIZE,
+        .rx_func_p = UartRxCallback,
+        .rx_pattern = UART_NO_PATTERN
     };
+    bool calibrated = true;
     
-    // Configuración timer A para muestreo ADC (20kHz)
-    timer_config_t timer_adc_config = {
-        .timer = TIMER_A,
-        .period = TIMER_ADC_PERIOD_US,  // Cada 50μs = 20kHz
-        .func_p = TimerAdcCallback,     // Callback para lectura ADC
+    for (uint8_t i = 0; i < PAD_NUM; i++) {
+        // Todos los canales de los PADs entran en el barrido del ADC continuo
+        analog_input_config_t adc_config = {
+            .input = pads[i].channel,
+            .mode = ADC_CONTINUOUS,
+            .func_p = AdcFrameCallback,
+            .param_p = NULL,
+            .sample_frec = ADC_SAMPLE_FREQ,
+            .frame_size = ADC_FRAME_SIZE,
+            .oversampling = 0
+        };
+        AnalogInputInit(&adc_config);
+        // Sin tabla (calibración o memoria) los mV salen de raw * 3300 / 4095
+        calibrated &= AnalogInputLUTInit(pads[i].channel);
+        IIRFilterHiPassInit(&dc_filter[i], ADC_SAMPLE_FREQ, DC_FILTER_CUT_FREQ, ORDER_2);
+        // El umbral mínimo lo fijan los ajustes del PAD
+        NoiseFloorInit(&noise_floor[i], ADC_SAMPLE_FREQ, NOISE_FLOOR_MS, NOISE_FLOOR_K, 0);
+        pad_gain[i] = VELOCITY_CURVE_GAIN_ONE;
+#if ADC_SOURCE == ADC_SOURCE_LIVE && PAD_MONITOR
+        analog_monitor_config_t monitor_config = {.input = pads[i].channel, .func_p = NULL, .param_p = NULL};
+        pad_monitor[i] = AnalogInputMonitorInit(&monitor_config);
+#endif
+    }
+    HitCrosstalkInit(&crosstalk, ADC_SAMPLE_FREQ, PAD_NUM, CROSSTALK_WINDOW_MS, CROSSTALK_RATIO);
+    sample_capture_config_t capture_config = {
+        .sample_frec = ADC_SAMPLE_FREQ, .decimation = CAPTURE_DECIMATION, .threshold = 0,
+        .full_scale = CAPTURE_FULL_SCALE, .pre_ms = CAPTURE_PRE_MS, .release_ms = CAPTURE_RELEASE_MS,
+        .end_level = CAPTURE_END_LEVEL, .peak = CAPTURE_PEAK
+    };
+    SampleCaptureInit(&capture, &capture_config, capture_buffer, CAPTURE_LENGHT);
+    // Detección de golpes con los ajustes guardados de cada PAD (o los de la tabla)
+    settings_mutex = STATIC_MUTEX_CREATE(settings_mutex);
+    LoadSettings();
+    ApplySettings();
+    // Salida de audio temporizada por hardware a SAMPLE_RATE
+#if AUDIO_OUTPUT == AUDIO_OUTPUT_DAC
+    analog_output_stream_config_t audio_config = {
+        .sample_rate = SAMPLE_RATE,
+        .low_level = AUDIO_LOW_LEVEL,
+        .func_p = AudioRefillCallback,
         .param_p = NULL
     };
-
-    
-    neopixel_color_t LED_UNICO;
-    TimerInit(&timer_adc_config);
-    AnalogInputInit(&adc_config_A);
-    AnalogInputInit(&adc_config_B); 
-    AnalogOutputInit();
+    AnalogOutputStreamInit(&audio_config);
+#else
+    audio_out_config_t audio_config = {
+        .mode = (AUDIO_OUTPUT == AUDIO_OUTPUT_PDM) ? AUDIO_OUT_PDM : AUDIO_OUT_I2S,
+        .sample_rate = SAMPLE_RATE,
+        .bclk = GPIO_I2S_BCLK,
+        .ws = GPIO_I2S_WS,
+        .dout = GPIO_AUDIO_OUT,
+        .low_level = AUDIO_LOW_LEVEL,
+        .func_p = AudioRefillCallback,
+        .param_p = NULL
+    };
+    AudioOutInit(&audio_config);
+#endif
+    // Sonidos: los de drum_samples.c, reemplazados por los del banco de la flash si está grabado
+    LoadPadSounds();
+#if AUDIO_OUTPUT == AUDIO_OUTPUT_DAC
+    AnalogOutputStreamStart();
+#else
+    AudioOutStart();
+#endif
     UartInit(&uart_config);
-    NeoPixelInit(BUILT_IN_RGB_LED_PIN ,  BUILT_IN_RGB_LED_LENGTH ,  &LED_UNICO );
+    if (!calibrated) {
+        UartSendString(UART_PC, "adc: sin tabla de calibración, mV aproximados\r\n");
+    }
+    NeoPixelInit(BUILT_IN_RGB_LED_PIN ,  BUILT_IN_RGB_LED_LENGTH ,  &led_color );
+    NeoPixelEffectsInit(LED_FRAME_RATE);
+#ifdef CONFIG_BT_ENABLED
+    // Controlador MIDI por Bluetooth (los mensajes que llegan del DAW se ignoran, los comandos de ajuste no)
+    ble_config_t ble_config = {
+        .device_name = BLE_DEVICE_NAME,
+        .func_p = BleRxCallback,
+        .service = BLE_SERVICE_MIDI,
+        .profile = BLE_PROFILE_LOW_LATENCY
+    };
+    BleInit(&ble_config);
+#endif
     
     
+    // Métricas (antes de las tareas que las actualizan)
+    MetricsRegister(&metric_hits);
+    MetricsRegister(&metric_hit_drops);
+    MetricsRegister(&metric_scope_drops);
+    MetricsRegister(&metric_ble_drops);
+    MetricsRegister(&metric_latency);
+    MetricsRegister(&metric_block);
+    // Presupuesto de CPU: aviso si la configuración no entra (ver @ref perfBudget)
+    perf_config_t perf_config = {
+        .cpu_hz = PERF_CPU_HZ, .budget = PERF_BUDGET_PERCENT, .pads = PAD_NUM, .adc_frec = ADC_SAMPLE_FREQ,
+        .sample_rate = SAMPLE_RATE, .voices = MIXER_VOICES, .output_isr = (AUDIO_OUTPUT == AUDIO_OUTPUT_DAC),
+        .frame_rate = LED_FRAME_RATE, .hit_rate = PERF_HIT_RATE
+    };
+    PerfBudgetInit(&perf_config);
+    PerfBudgetCheck();
+
     // Crear tareas
-    xTaskCreate(AdcTask, "AdcTask", 4096, NULL, 5, &adc_task_handle);
-    xTaskCreate(UmbralTask, "UmbralTask", 4096, NULL, 5, &umbral_task_handle);
-    xTaskCreate(PlaySoundTask, "PlaySoundTask", 4096, NULL, 5, &playSound_task_handle);
+    RingBufferInit(&hit_ring, hit_ring_storage, sizeof(hit_record_t), HIT_RING_SIZE);
+    RingBufferInit(&scope_ring, scope_ring_storage, sizeof(scope_block_t), SCOPE_RING_SIZE);
+    STATIC_TASK_CREATE(telemetry_task, TelemetryTask, "TelemetryTask", NULL, 2, &telemetry_task_handle);
+    STATIC_TASK_CREATE(adc_task, AdcTask, "AdcTask", NULL, 5, &adc_task_handle);
+    STATIC_TASK_CREATE(playSound_task, PlaySoundTask, "PlaySoundTask", NULL, 5, &playSound_task_handle);
 
-    // Iniciar el timer que dispara todo el proceso
-    TimerStart(TIMER_A); 
+#ifdef CONFIG_DRIVERS_TASK_MONITOR
+    TaskMonitorInit(TASK_MONITOR_PERIOD_MS);
+#endif
+#ifdef CONFIG_DRIVERS_TRACE
+    TraceStart();
+#endif
+
+#if ADC_SOURCE == ADC_SOURCE_LIVE
+    // Iniciar la conversión continua que dispara todo el proceso
+    if (!AnalogStartContinuous(pads[0].channel)) {
+        UartSendString(UART_PC, "adc: frecuencia de muestreo fuera de rango\r\n");
+    }
+#else
+    // La captura reemplaza al ADC (los canales siguen inicializados por sus tablas de calibración)
+    adc_replay_config_t replay_config = {
+        .partition = (ADC_SOURCE == ADC_SOURCE_REPLAY_FLASH) ? REPLAY_PARTITION : NULL,
+        .pace = REPLAY_PACE,
+        .loop = false,
+        .func_p = ReplayBlockCallback,
+        .param_p = NULL
+    };
+    if (AdcReplayInit(&adc_replay, &replay_config)) {
+        AdcReplayStart(&adc_replay);
+    } else {
+        UartSendString(UART_PC, "replay: captura no encontrada\r\n");
+    }
+#endif
     
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -6,11 +6,226 @@
  * (Corta y pega tus arrays gigantes aquí)
  */
 
-// Definición del tamaño y el array del Snare
+// Definición del tamaño (en muestras) y el array del Snare
 const int snare_drum_size = 8426;
-const int16_t snare_drum_sample[] = {512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 513, 511, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 509, 513, 509, 514, 509, 513, 508, 514, 509, 514, 509, 515, 508, 514, 510, 514, 508, 513, 505, 512, 505, 515, 503, 519, 511, 528, 525, 514, 489, 525, 533, 494, 449, 282, 16, 77, 100, 636, 1024, 961, 973, 931, 667, 563, 779, 800, 953, 982, 981, 936, 629, 328, 389, 294, 205, 55, 50, 46, 51, 35, 64, 78, 178, 338, 392, 345, 350, 388, 483, 587, 630, 666, 861, 882, 903, 977, 944, 904, 863, 728, 639, 612, 585, 609, 498, 516, 588, 602, 503, 502, 456, 492, 428, 284, 151, 69, 38, 47, 39, 61, 131, 311, 489, 587, 629, 697, 688, 723, 758, 753, 740, 818, 811, 765, 805, 783, 775, 772, 634, 574, 492, 513, 465, 410, 311, 263, 292, 288, 264, 184, 274, 236, 249, 346, 268, 264, 418, 474, 545, 622, 606, 680, 716, 752, 782, 838, 842, 840, 802, 735, 646, 636, 573, 499, 466, 441, 440, 369, 332, 438, 416, 324, 317, 278, 286, 222, 195, 256, 331, 480, 495, 533, 635, 671, 644, 682, 674, 676, 576, 529, 602, 636, 678, 612, 637, 711, 677, 639, 594, 552, 573, 493, 438, 332, 318, 270, 198, 210, 348, 399, 384, 431, 399, 322, 341, 449, 517, 597, 704, 801, 759, 675, 584, 565, 579, 645, 720, 752, 742, 770, 651, 411, 422, 433, 416, 261, 274, 354, 419, 472, 531, 580, 567, 500, 345, 302, 310, 286, 280, 367, 415, 627, 587, 570, 648, 625, 695, 722, 724, 630, 556, 540, 526, 548, 531, 550, 629, 640, 626, 516, 599, 395, 359, 344, 455, 381, 377, 400, 414, 464, 449, 475, 492, 512, 489, 453, 472, 513, 627, 608, 443, 347, 482, 521, 573, 653, 611, 669, 612, 588, 532, 579, 651, 625, 595, 552, 540, 503, 386, 389, 451, 444, 340, 405, 439, 478, 397, 449, 386, 377, 401, 499, 536, 544, 669, 603, 770, 660, 530, 616, 552, 524, 501, 533, 554, 521, 496, 461, 435, 581, 529, 579, 547, 531, 512, 484, 442, 387, 392, 454, 454, 429, 469, 482, 486, 444, 457, 448, 467, 447, 481, 519, 542, 657, 648, 585, 659, 672, 654, 639, 562, 556, 532, 514, 539, 345, 446, 472, 397, 457, 517, 553, 552, 450, 455, 353, 359, 442, 438, 407, 491, 440, 504, 609, 612, 600, 602, 573, 644, 641, 546, 556, 611, 672, 684, 588, 511, 490, 430, 476, 392, 408, 489, 442, 454, 492, 442, 462, 382, 491, 446, 313, 388, 407, 461, 492, 508, 609, 656, 643, 627, 650, 631, 576, 553, 507, 529, 565, 549, 519, 562, 564, 591, 493, 501, 510, 517, 458, 373, 453, 453, 488, 454, 429, 388, 373, 424, 413, 387, 434, 461, 553, 537, 519, 595, 647, 668, 702, 690, 707, 672, 577, 548, 574, 520, 503, 494, 529, 515, 435, 421, 408, 436, 437, 326, 347, 303, 408, 513, 505, 492, 477, 579, 612, 555, 507, 521, 598, 618, 563, 540, 494, 543, 594, 596, 575, 570, 537, 542, 547, 509, 503, 495, 493, 462, 439, 492, 454, 455, 457, 478, 397, 439, 464, 462, 499, 522, 536, 575, 601, 560, 558, 458, 492, 493, 578, 583, 526, 551, 523, 574, 535, 556, 548, 642, 619, 515, 490, 447, 332, 383, 397, 457, 506, 543, 482, 477, 483, 444, 412, 502, 487, 531, 489, 550, 556, 565, 606, 615, 566, 536, 600, 620, 573, 593, 579, 519, 503, 431, 420, 390, 471, 436, 464, 484, 513, 415, 423, 435, 439, 450, 541, 596, 563, 530, 529, 522, 573, 492, 566, 535, 538, 513, 546, 488, 495, 574, 510, 557, 577, 612, 525, 567, 530, 469, 425, 512, 492, 456, 445, 471, 448, 487, 507, 514, 485, 436, 437, 473, 489, 524, 522, 566, 522, 595, 557, 586, 512, 610, 563, 575, 546, 531, 535, 476, 521, 547, 543, 465, 463, 458, 422, 416, 460, 484, 474, 511, 566, 590, 543, 559, 477, 415, 447, 448, 476, 465, 525, 569, 564, 584, 631, 620, 597, 569, 574, 531, 471, 419, 401, 447, 466, 517, 492, 541, 508, 483, 516, 502, 521, 513, 462, 492, 504, 543, 529, 487, 491, 492, 505, 494, 467, 514, 538, 474, 525, 582, 612, 577, 598, 593, 508, 533, 466, 449, 483, 462, 481, 448, 522, 488, 504, 516, 553, 562, 480, 464, 446, 434, 423, 447, 560, 537, 519, 567, 553, 603, 552, 516, 563, 571, 557, 560, 556, 506, 518, 488, 463, 409, 457, 466, 469, 491, 459, 450, 477, 508, 508, 543, 574, 575, 518, 553, 527, 519, 475, 462, 505, 528, 542, 577, 564, 585, 569, 538, 485, 498, 512, 497, 464, 465, 426, 442, 481, 484, 485, 514, 559, 553, 548, 514, 477, 500, 487, 483, 515, 547, 515, 509, 537, 551, 489, 520, 513, 541, 541, 518, 583, 534, 535, 500, 501, 479, 420, 502, 502, 529, 520, 494, 511, 502, 487, 524, 472, 532, 512, 529, 511, 485, 442, 469, 462, 469, 552, 535, 570, 558, 561, 590, 560, 533, 495, 520, 531, 468, 437, 471, 497, 492, 485, 543, 566, 540, 555, 549, 473, 474, 471, 501, 500, 525, 508, 514, 515, 502, 522, 504, 490, 481, 502, 511, 512, 521, 558, 552, 500, 487, 511, 489, 519, 507, 467, 518, 495, 509, 558, 526, 537, 544, 565, 558, 539, 513, 491, 439, 455, 474, 469, 476, 494, 525, 537, 526, 494, 552, 576, 555, 547, 499, 501, 492, 505, 495, 509, 502, 511, 544, 508, 468, 466, 486, 494, 504, 517, 508, 539, 527, 508, 516, 476, 496, 524, 549, 545, 508, 568, 557, 548, 501, 508, 505, 527, 501, 510, 469, 475, 438, 467, 481, 522, 506, 517, 535, 536, 553, 537, 557, 532, 528, 494, 490, 484, 507, 525, 546, 515, 484, 484, 507, 484, 529, 541, 510, 488, 470, 485, 472, 497, 536, 559, 543, 538, 523, 485, 482, 499, 530, 549, 534, 530, 545, 528, 488, 471, 497, 484, 492, 507, 487, 514, 500, 523, 514, 528, 536, 541, 529, 518, 484, 476, 519, 534, 490, 496, 506, 511, 505, 491, 526, 538, 536, 525, 517, 510, 482, 478, 512, 527, 575, 531, 496, 511, 538, 524, 530, 522, 527, 500, 473, 471, 458, 491, 506, 494, 486, 475, 491, 498, 481, 505, 525, 544, 530, 577, 545, 524, 533, 549, 508, 532, 539, 556, 497, 503, 491, 496, 500, 507, 492, 508, 529, 499, 496, 512, 505, 474, 482, 510, 511, 509, 526, 511, 513, 527, 525, 511, 505, 499, 492, 506, 515, 513, 520, 512, 498, 508, 528, 553, 535, 530, 528, 502, 530, 527, 488, 475, 493, 526, 528, 491, 490, 497, 485, 484, 513, 518, 503, 506, 502, 521, 530, 525, 493, 511, 531, 544, 554, 527, 519, 524, 523, 501, 502, 502, 501, 510, 496, 498, 496, 512, 486, 476, 480, 475, 489, 494, 497, 519, 498, 532, 571, 528, 521, 542, 524, 531, 521, 536, 530, 545, 520, 547, 537, 521, 508, 486, 503, 497, 468, 462, 515, 515, 499, 514, 489, 492, 507, 513, 514, 516, 513, 518, 504, 501, 520, 510, 505, 494, 500, 481, 493, 486, 500, 519, 546, 510, 524, 544, 536, 538, 592, 565, 557, 553, 500, 516, 501, 477, 505, 503, 487, 485, 482, 476, 470, 468, 492, 506, 504, 495, 510, 494, 509, 480, 522, 530, 523, 548, 548, 554, 552, 523, 533, 512, 523, 519, 515, 522, 500, 490, 524, 510, 507, 519, 502, 498, 499, 492, 513, 514, 531, 513, 504, 495, 483, 502, 518, 528, 500, 476, 486, 508, 501, 496, 518, 533, 527, 547, 547, 529, 501, 496, 508, 525, 526, 522, 537, 527, 520, 527, 501, 522, 519, 509, 490, 479, 466, 480, 485, 495, 485, 520, 507, 508, 488, 515, 503, 519, 530, 533, 546, 538, 532, 538, 536, 521, 534, 530, 513, 488, 505, 498, 497, 502, 496, 487, 478, 485, 477, 504, 515, 526, 524, 523, 494, 504, 533, 533, 533, 530, 531, 538, 553, 515, 489, 489, 494, 487, 500, 499, 502, 516, 496, 542, 524, 517, 534, 544, 502, 506, 502, 475, 511, 518, 509, 499, 491, 495, 501, 489, 503, 525, 528, 507, 519, 518, 512, 529, 529, 540, 532, 525, 486, 496, 507, 508, 516, 528, 540, 518, 513, 507, 490, 499, 502, 515, 505, 486, 474, 486, 494, 482, 499, 509, 519, 527, 543, 549, 525, 535, 543, 539, 531, 526, 538, 499, 504, 503, 511, 511, 507, 510, 485, 505, 484, 486, 499, 514, 500, 511, 495, 491, 494, 518, 517, 526, 531, 528, 519, 520, 512, 501, 519, 535, 529, 514, 514, 495, 510, 501, 492, 501, 513, 520, 524, 522, 526, 519, 527, 526, 529, 510, 510, 513, 506, 494, 486, 486, 478, 479, 484, 506, 506, 520, 515, 501, 518, 511, 531, 532, 528, 535, 538, 531, 531, 534, 523, 511, 514, 520, 527, 511, 521, 514, 492, 479, 473, 460, 487, 488, 484, 506, 526, 514, 509, 511, 504, 507, 518, 528, 533, 535, 512, 521, 525, 519, 506, 514, 502, 517, 505, 510, 506, 508, 512, 517, 500, 532, 538, 506, 518, 514, 510, 503, 511, 497, 515, 516, 509, 504, 501, 508, 510, 512, 501, 499, 500, 489, 507, 505, 505, 506, 509, 525, 523, 550, 545, 545, 526, 522, 507, 517, 520, 505, 511, 501, 518, 497, 483, 495, 503, 503, 504, 499, 503, 513, 495, 494, 500, 511, 518, 517, 533, 527, 539, 529, 517, 521, 509, 513, 519, 527, 521, 516, 506, 502, 495, 506, 503, 511, 508, 517, 516, 512, 535, 522, 519, 519, 504, 507, 508, 492, 506, 505, 496, 501, 498, 492, 493, 496, 507, 516, 505, 531, 516, 515, 530, 534, 536, 534, 529, 525, 516, 515, 527, 520, 499, 504, 497, 511, 512, 500, 502, 489, 509, 500, 498, 503, 507, 512, 514, 509, 505, 509, 520, 528, 522, 523, 511, 520, 511, 501, 515, 515, 513, 511, 515, 502, 512, 514, 510, 518, 513, 517, 503, 501, 505, 500, 492, 518, 512, 505, 529, 514, 519, 518, 505, 521, 506, 505, 491, 495, 514, 503, 506, 521, 516, 525, 528, 517, 509, 514, 502, 523, 528, 521, 502, 515, 503, 513, 512, 503, 495, 500, 499, 496, 508, 506, 496, 494, 520, 520, 527, 518, 506, 520, 525, 524, 522, 505, 510, 514, 498, 520, 518, 521, 507, 503, 510, 507, 500, 518, 514, 498, 496, 508, 524, 510, 506, 512, 522, 529, 521, 528, 537, 517, 508, 504, 502, 498, 492, 502, 522, 519, 495, 495, 502, 502, 502, 508, 513, 511, 520, 510, 523, 518, 520, 510, 505, 516, 521, 512, 511, 505, 523, 527, 524, 523, 514, 518, 522, 522, 521, 511, 487, 497, 494, 492, 501, 500, 508, 496, 503, 512, 515, 513, 522, 507, 510, 513, 520, 500, 506, 516, 525, 517, 527, 529, 526, 521, 520, 519, 503, 503, 513, 528, 539, 524, 513, 514, 495, 497, 508, 503, 511, 505, 497, 504, 507, 505, 498, 493, 501, 503, 505, 506, 502, 499, 525, 514, 533, 529, 520, 515, 520, 531, 538, 529, 520, 513, 508, 496, 507, 505, 507, 507, 506, 509, 515, 517, 511, 506, 505, 502, 499, 505, 496, 503, 511, 515, 498, 505, 513, 519, 525, 523, 517, 513, 512, 517, 538, 536, 526, 516, 514, 521, 511, 509, 508, 503, 508, 506, 512, 514, 512, 500, 505, 502, 502, 490, 477, 487, 493, 501, 495, 511, 512, 520, 513, 521, 523, 531, 537, 523, 518, 514, 522, 526, 523, 517, 523, 519, 537, 528, 509, 510, 510, 491, 504, 494, 495, 495, 492, 484, 489, 499, 504, 518, 530, 524, 519, 505, 494, 503, 519, 520, 522, 530, 531, 525, 517, 496, 497, 497, 510, 520, 515, 523, 521, 519, 537, 526, 516, 510, 511, 499, 502, 495, 497, 500, 506, 499, 506, 503, 514, 524, 525, 518, 512, 495, 491, 501, 505, 515, 524, 524, 525, 531, 515, 523, 527, 519, 511, 518, 514, 506, 501, 499, 495, 502, 511, 511, 515, 508, 508, 504, 500, 501, 506, 499, 513, 503, 515, 536, 535, 529, 503, 502, 495, 510, 520, 516, 518, 524, 529, 533, 516, 511, 509, 502, 512, 498, 498, 512, 507, 502, 504, 503, 514, 522, 526, 530, 522, 515, 502, 498, 501, 497, 501, 513, 512, 510, 515, 516, 523, 516, 519, 517, 528, 518, 513, 503, 487, 493, 503, 507, 524, 527, 521, 513, 512, 510, 507, 499, 506, 501, 504, 522, 518, 513, 514, 502, 502, 503, 508, 503, 509, 526, 537, 542, 535, 526, 524, 512, 507, 502, 505, 507, 505, 502, 491, 495, 494, 500, 508, 514, 530, 524, 518, 514, 498, 498, 504, 501, 514, 505, 520, 519, 523, 528, 521, 521, 536, 524, 512, 517, 497, 501, 498, 509, 510, 514, 505, 500, 499, 505, 501, 506, 502, 510, 520, 516, 527, 512, 504, 507, 513, 515, 511, 499, 508, 513, 524, 519, 528, 530, 542, 525, 532, 514, 509, 512, 498, 498, 493, 490, 490, 487, 501, 505, 510, 517, 517, 511, 520, 513, 506, 507, 500, 506, 507, 513, 528, 526, 523, 520, 534, 532, 528, 520, 520, 510, 510, 507, 505, 508, 499, 508, 500, 503, 503, 500, 495, 499, 506, 507, 516, 512, 522, 513, 515, 512, 505, 503, 503, 506, 509, 505, 507, 516, 523, 526, 526, 527, 532, 531, 529, 516, 522, 505, 511, 501, 495, 502, 502, 503, 503, 514, 515, 519, 517, 508, 498, 487, 499, 493, 508, 510, 505, 509, 524, 524, 517, 523, 514, 509, 516, 512, 513, 512, 514, 513, 521, 517, 516, 513, 511, 499, 502, 515, 512, 520, 514, 528, 534, 534, 518, 509, 501, 501, 489, 484, 484, 477, 491, 503, 510, 523, 519, 529, 528, 522, 525, 518, 519, 507, 503, 510, 510, 509, 508, 509, 522, 522, 517, 521, 518, 515, 516, 514, 510, 510, 500, 502, 507, 508, 510, 511, 514, 506, 498, 504, 505, 498, 510, 506, 518, 518, 514, 517, 507, 509, 516, 507, 509, 502, 510, 523, 528, 540, 545, 539, 527, 521, 515, 500, 506, 499, 502, 502, 495, 490, 492, 498, 504, 514, 521, 519, 515, 507, 509, 510, 504, 499, 506, 507, 519, 525, 527, 523, 523, 518, 520, 525, 522, 521, 516, 513, 518, 511, 505, 504, 500, 502, 503, 502, 506, 500, 505, 511, 523, 519, 532, 527, 516, 510, 506, 499, 501, 494, 491, 497, 504, 503, 511, 526, 526, 525, 526, 523, 517, 514, 521, 516, 515, 511, 510, 512, 513, 511, 517, 513, 517, 512, 507, 509, 509, 500, 497, 499, 499, 507, 505, 500, 508, 510, 512, 516, 514, 529, 517, 523, 530, 523, 525, 517, 511, 514, 511, 513, 503, 508, 500, 497, 504, 507, 513, 514, 516, 519, 515, 513, 500, 507, 503, 502, 501, 506, 509, 515, 516, 512, 522, 526, 524, 518, 517, 524, 524, 517, 502, 498, 501, 508, 508, 506, 511, 509, 513, 515, 511, 511, 509, 508, 515, 514, 503, 511, 508, 501, 498, 504, 514, 514, 519, 518, 520, 519, 518, 514, 514, 518, 516, 517, 518, 509, 511, 507, 502, 502, 504, 505, 519, 513, 513, 513, 516, 511, 512, 509, 505, 494, 502, 503, 506, 508, 509, 516, 519, 519, 527, 532, 530, 521, 515, 504, 508, 510, 515, 513, 511, 507, 506, 497, 501, 498, 497, 508, 522, 524, 523, 528, 522, 512, 508, 499, 503, 507, 510, 513, 513, 509, 515, 512, 513, 511, 516, 517, 511, 507, 505, 507, 508, 506, 504, 506, 517, 513, 518, 517, 520, 516, 520, 521, 515, 507, 511, 508, 506, 502, 505, 513, 510, 505, 511, 521, 515, 525, 523, 520, 514, 510, 510, 515, 507, 511, 513, 513, 510, 499, 497, 508, 500, 510, 511, 511, 504, 503, 505, 508, 512, 508, 514, 524, 518, 519, 516, 515, 510, 516, 520, 526, 529, 521, 516, 517, 511, 506, 498, 498, 504, 502, 502, 506, 508, 510, 513, 509, 507, 509, 507, 509, 508, 511, 518, 520, 509, 512, 511, 510, 513, 511, 511, 518, 519, 520, 518, 508, 507, 513, 513, 512, 513, 513, 509, 505, 503, 503, 511, 518, 522, 523, 516, 515, 509, 502, 497, 501, 504, 506, 507, 503, 511, 514, 516, 520, 523, 521, 524, 520, 511, 515, 511, 508, 510, 509, 515, 511, 510, 514, 512, 511, 507, 505, 500, 490, 495, 505, 512, 518, 509, 510, 511, 512, 511, 512, 513, 518, 523, 523, 517, 515, 518, 518, 519, 522, 514, 513, 512, 502, 501, 500, 504, 509, 509, 513, 514, 509, 511, 508, 505, 508, 512, 510, 511, 501, 498, 509, 509, 507, 515, 520, 521, 525, 523, 517, 515, 507, 510, 510, 517, 513, 518, 513, 515, 515, 515, 514, 514, 512, 511, 511, 507, 502, 499, 504, 502, 494, 506, 505, 508, 510, 511, 516, 516, 517, 511, 517, 520, 520, 526, 524, 526, 518, 516, 511, 504, 501, 503, 512, 516, 513, 510, 509, 504, 499, 504, 502, 496, 501, 505, 511, 506, 516, 515, 516, 518, 517, 527, 524, 518, 515, 513, 513, 512, 516, 518, 518, 518, 513, 513, 510, 507, 506, 506, 511, 510, 506, 509, 509, 502, 509, 504, 504, 505, 504, 511, 505, 505, 514, 509, 513, 519, 524, 527, 526, 521, 519, 520, 513, 508, 511, 514, 519, 520, 519, 514, 509, 507, 503, 500, 502, 493, 494, 503, 497, 498, 502, 507, 513, 513, 516, 521, 522, 525, 529, 526, 530, 526, 519, 518, 513, 514, 519, 516, 515, 512, 510, 501, 501, 506, 503, 501, 505, 503, 503, 506, 499, 506, 504, 507, 505, 508, 512, 512, 513, 515, 517, 521, 522, 528, 525, 530, 521, 520, 515, 505, 510, 513, 514, 515, 513, 513, 513, 518, 512, 509, 504, 504, 503, 497, 502, 496, 501, 503, 506, 508, 509, 507, 506, 511, 515, 519, 515, 515, 513, 517, 522, 524, 525, 519, 523, 520, 521, 518, 514, 507, 507, 510, 508, 508, 509, 510, 507, 506, 500, 498, 503, 499, 504, 502, 507, 508, 512, 514, 522, 526, 530, 527, 518, 513, 511, 503, 512, 513, 513, 512, 513, 517, 510, 507, 507, 506, 513, 515, 515, 510, 508, 508, 506, 504, 509, 506, 507, 504, 508, 511, 513, 512, 512, 515, 516, 518, 515, 518, 514, 517, 511, 507, 509, 508, 512, 513, 516, 519, 515, 517, 512, 513, 508, 515, 515, 512, 506, 501, 502, 496, 494, 494, 505, 513, 518, 524, 519, 520, 520, 513, 515, 511, 506, 511, 514, 517, 518, 518, 518, 519, 515, 514, 514, 511, 511, 508, 508, 509, 508, 509, 505, 505, 511, 509, 508, 504, 501, 503, 504, 516, 518, 524, 519, 518, 513, 505, 502, 502, 508, 516, 517, 514, 513, 516, 516, 516, 517, 523, 524, 517, 523, 519, 513, 503, 498, 499, 503, 506, 513, 518, 515, 513, 510, 499, 505, 502, 506, 510, 510, 510, 516, 510, 512, 516, 513, 511, 516, 516, 515, 517, 518, 521, 515, 515, 509, 508, 511, 510, 509, 511, 507, 503, 508, 505, 512, 518, 520, 525, 526, 516, 510, 506, 507, 506, 509, 507, 510, 507, 506, 505, 509, 512, 516, 517, 523, 521, 516, 510, 507, 500, 495, 505, 511, 514, 517, 516, 517, 515, 514, 511, 508, 510, 516, 516, 514, 513, 508, 511, 511, 507, 514, 510, 509, 509, 510, 514, 510, 512, 516, 514, 516, 517, 517, 515, 513, 508, 504, 503, 501, 506, 510, 511, 514, 518, 517, 513, 509, 511, 510, 510, 508, 509, 508, 506, 506, 511, 514, 516, 519, 523, 522, 521, 515, 508, 506, 503, 506, 506, 513, 516, 515, 512, 510, 508, 505, 504, 506, 511, 510, 516, 510, 511, 509, 509, 508, 510, 506, 507, 509, 508, 514, 512, 517, 519, 518, 517, 518, 523, 520, 525, 515, 512, 507, 504, 507, 508, 514, 511, 513, 511, 506, 508, 507, 507, 508, 507, 508, 507, 508, 510, 505, 510, 511, 517, 518, 516, 512, 512, 513, 510, 511, 511, 514, 513, 518, 517, 515, 511, 509, 510, 511, 511, 512, 513, 515, 512, 512, 513, 510, 512, 512, 506, 512, 508, 508, 505, 504, 504, 507, 511, 513, 518, 518, 519, 522, 512, 507, 505, 505, 509, 514, 516, 517, 518, 514, 514, 512, 509, 513, 508, 511, 509, 509, 509, 509, 509, 509, 511, 513, 518, 515, 512, 512, 505, 506, 504, 506, 512, 508, 516, 520, 521, 515, 512, 510, 508, 509, 506, 513, 514, 515, 516, 516, 514, 513, 514, 513, 510, 512, 508, 508, 508, 511, 507, 509, 510, 512, 511, 515, 517, 515, 513, 508, 501, 501, 506, 510, 512, 516, 515, 513, 516, 515, 512, 516, 514, 514, 515, 511, 506, 506, 506, 513, 512, 515, 514, 515, 512, 511, 508, 506, 505, 504, 512, 512, 511, 514, 515, 518, 513, 511, 509, 507, 507, 512, 511, 515, 514, 515, 514, 514, 514, 516, 517, 519, 517, 510, 506, 504, 503, 503, 507, 513, 516, 515, 514, 512, 504, 506, 507, 515, 511, 512, 515, 513, 514, 515, 514, 511, 517, 516, 516, 514, 510, 508, 508, 504, 507, 509, 513, 515, 515, 517, 515, 512, 508, 505, 507, 511, 512, 515, 514, 514, 511, 509, 510, 508, 511, 512, 511, 515, 512, 513, 512, 513, 512, 515, 510, 514, 514, 513, 510, 511, 507, 506, 508, 507, 508, 509, 512, 511, 513, 510, 510, 512, 511, 513, 511, 517, 518, 515, 516, 514, 511, 512, 510, 512, 511, 507, 508, 510, 509, 508, 509, 511, 512, 511, 513, 512, 509, 510, 509, 509, 511, 509, 513, 518, 519, 517, 514, 512, 508, 508, 510, 508, 512, 514, 515, 514, 512, 510, 508, 509, 509, 510, 514, 511, 508, 507, 506, 507, 509, 515, 518, 515, 515, 513, 507, 505, 502, 505, 512, 515, 520, 522, 518, 514, 512, 515, 519, 520, 517, 514, 508, 507, 504, 506, 504, 508, 509, 512, 509, 510, 509, 509, 507, 508, 503, 503, 509, 513, 518, 520, 522, 518, 518, 513, 516, 511, 512, 515, 515, 513, 511, 510, 509, 508, 509, 511, 510, 512, 512, 510, 506, 505, 504, 508, 511, 513, 515, 520, 516, 514, 510, 506, 504, 511, 512, 513, 516, 515, 511, 510, 512, 515, 518, 519, 517, 517, 515, 508, 508, 509, 508, 507, 506, 508, 509, 512, 509, 511, 509, 508, 506, 510, 509, 511, 512, 515, 515, 514, 512, 513, 514, 512, 518, 520, 519, 514, 512, 511, 511, 511, 514, 513, 514, 512, 510, 507, 508, 504, 506, 508, 508, 512, 515, 509, 506, 507, 507, 507, 510, 514, 513, 514, 512, 509, 508, 509, 514, 520, 520, 520, 522, 518, 513, 513, 511, 514, 511, 508, 510, 509, 513, 508, 507, 507, 506, 507, 509, 509, 513, 514, 513, 512, 509, 505, 503, 505, 507, 511, 517, 519, 518, 514, 514, 514, 516, 514, 518, 516, 516, 513, 510, 508, 506, 509, 508, 508, 512, 514, 511, 513, 508, 508, 511, 511, 515, 509, 510, 508, 510, 508, 509, 509, 514, 514, 515, 514, 515, 516, 514, 513, 512, 509, 510, 511, 508, 510, 507, 507, 510, 510, 513, 513, 514, 516, 518, 519, 513, 512, 511, 508, 506, 507, 507, 510, 513, 512, 511, 510, 508, 511, 515, 514, 521, 516, 517, 514, 510, 506, 506, 509, 511, 511, 511, 512, 511, 508, 510, 510, 513, 512, 512, 511, 511, 509, 507, 508, 510, 510, 513, 513, 513, 515, 516, 516, 514, 514, 517, 518, 515, 514, 511, 510, 510, 509, 506, 507, 508, 509, 509, 513, 513, 514, 512, 508, 506, 505, 506, 508, 511, 509, 510, 511, 513, 514, 515, 516, 517, 516, 516, 518, 515, 514, 513, 509, 509, 508, 509, 513, 515, 515, 513, 511, 511, 510, 511, 509, 507, 508, 506, 506, 507, 506, 508, 509, 509, 509, 509, 510, 511, 512, 515, 522, 521, 521, 520, 520, 515, 513, 512, 511, 510, 512, 510, 509, 510, 512, 511, 508, 507, 506, 508, 507, 510, 508, 508, 508, 509, 507, 507, 509, 513, 514, 518, 519, 518, 516, 516, 512, 512, 512, 517, 516, 516, 512, 515, 514, 513, 511, 512, 511, 511, 510, 511, 510, 508, 508, 504, 502, 503, 502, 503, 508, 510, 512, 513, 515, 512, 516, 520, 519, 521, 519, 519, 517, 512, 510, 510, 510, 511, 514, 516, 517, 514, 514, 512, 509, 511, 511, 508, 507, 506, 503, 506, 504, 506, 506, 508, 510, 511, 512, 517, 513, 512, 511, 513, 515, 517, 517, 522, 517, 515, 513, 513, 511, 510, 511, 513, 511, 515, 512, 509, 507, 505, 507, 508, 507, 502, 503, 506, 508, 509, 513, 516, 516, 513, 514, 515, 513, 514, 515, 512, 510, 511, 511, 515, 516, 516, 517, 517, 514, 514, 511, 511, 514, 513, 514, 511, 510, 506, 504, 506, 506, 506, 508, 508, 508, 511, 508, 506, 507, 507, 509, 513, 517, 517, 516, 515, 512, 514, 511, 512, 515, 518, 518, 517, 518, 514, 515, 510, 511, 512, 511, 511, 507, 508, 507, 505, 504, 504, 504, 510, 514, 516, 516, 514, 511, 509, 512, 512, 510, 514, 514, 515, 512, 512, 511, 510, 512, 512, 513, 513, 513, 511, 508, 509, 508, 509, 513, 515, 516, 516, 516, 512, 512, 512, 509, 511, 510, 513, 511, 510, 509, 510, 509, 507, 508, 510, 512, 513, 515, 514, 514, 512, 514, 516, 516, 515, 513, 510, 510, 506, 505, 506, 510, 510, 514, 513, 512, 513, 511, 510, 511, 511, 513, 513, 515, 515, 513, 513, 512, 510, 510, 512, 513, 514, 513, 512, 508, 507, 506, 509, 510, 512, 512, 512, 513, 510, 509, 510, 510, 512, 513, 514, 513, 513, 513, 511, 512, 509, 509, 511, 512, 512, 512, 513, 511, 512, 513, 513, 514, 512, 511, 511, 511, 511, 511, 508, 509, 508, 510, 511, 512, 514, 514, 515, 512, 513, 512, 511, 511, 510, 508, 510, 511, 513, 510, 510, 510, 512, 514, 515, 513, 512, 513, 511, 508, 511, 511, 512, 513, 512, 511, 510, 508, 508, 506, 511, 511, 511, 515, 514, 514, 514, 514, 509, 510, 510, 511, 511, 510, 511, 514, 516, 514, 515, 514, 515, 512, 512, 510, 507, 507, 506, 507, 509, 512, 514, 515, 513, 513, 510, 510, 508, 509, 507, 510, 511, 511, 514, 514, 514, 512, 512, 511, 512, 515, 517, 516, 515, 513, 513, 511, 510, 511, 513, 512, 509, 508, 508, 506, 505, 505, 507, 508, 512, 513, 514, 514, 512, 511, 511, 512, 512, 513, 514, 513, 516, 516, 514, 513, 513, 515, 514, 515, 514, 513, 511, 506, 506, 506, 507, 508, 508, 511, 510, 512, 511, 511, 508, 506, 510, 510, 514, 513, 512, 514, 512, 512, 514, 514, 519, 518, 518, 516, 515, 512, 512, 507, 509, 510, 507, 507, 510, 510, 507, 507, 506, 507, 508, 511, 513, 515, 513, 513, 512, 513, 511, 510, 512, 511, 510, 512, 513, 514, 516, 516, 516, 517, 516, 515, 515, 510, 508, 508, 509, 509, 508, 509, 510, 511, 511, 510, 508, 506, 507, 510, 511, 512, 513, 514, 513, 512, 508, 511, 512, 514, 516, 516, 514, 515, 516, 515, 513, 513, 513, 513, 511, 509, 509, 508, 506, 507, 508, 511, 512, 512, 515, 515, 513, 513, 511, 509, 509, 508, 509, 510, 510, 509, 514, 515, 516, 515, 515, 516, 513, 514, 514, 513, 513, 510, 510, 507, 507, 508, 509, 511, 512, 511, 511, 512, 511, 510, 513, 513, 515, 513, 510, 511, 509, 509, 511, 511, 511, 513, 511, 510, 509, 510, 512, 513, 513, 515, 515, 512, 511, 509, 510, 508, 510, 512, 511, 513, 513, 514, 515, 514, 511, 511, 512, 510, 509, 509, 509, 510, 512, 514, 516, 517, 515, 514, 514, 514, 512, 511, 510, 506, 505, 507, 509, 511, 511, 511, 511, 510, 509, 507, 511, 514, 514, 515, 514, 514, 512, 511, 510, 511, 511, 511, 513, 512, 511, 510, 510, 512, 513, 515, 516, 516, 514, 512, 510, 508, 507, 508, 508, 510, 511, 512, 513, 513, 511, 512, 510, 512, 510, 511, 511, 510, 509, 510, 510, 510, 511, 513, 514, 515, 515, 513, 511, 511, 510, 511, 511, 512, 513, 514, 514, 512, 511, 508, 509, 510, 510, 512, 513, 510, 512, 510, 508, 510, 510, 511, 512, 511, 511, 511, 509, 510, 512, 515, 517, 517, 515, 515, 514, 511, 507, 509, 510, 509, 509, 513, 514, 512, 511, 511, 511, 510, 513, 513, 514, 512, 509, 507, 508, 507, 507, 510, 511, 513, 514, 513, 512, 511, 510, 512, 512, 513, 513, 516, 516, 515, 514, 512, 510, 510, 511, 512, 512, 512, 513, 512, 512, 512, 511, 513, 511, 510, 509, 508, 504, 504, 507, 508, 512, 515, 516, 515, 514, 512, 511, 511, 511, 512, 513, 515, 514, 514, 514, 512, 511, 513, 513, 513, 511, 511, 512, 512, 511, 510, 510, 508, 510, 510, 510, 510, 509, 510, 510, 511, 510, 512, 511, 512, 513, 514, 513, 512, 511, 509, 511, 513, 513, 513, 516, 516, 515, 514, 513, 513, 515, 514, 513, 512, 510, 509, 506, 508, 507, 508, 510, 511, 511, 511, 510, 510, 508, 509, 510, 512, 512, 511, 512, 513, 514, 513, 514, 516, 516, 514, 513, 512, 513, 513, 512, 511, 512, 511, 511, 510, 510, 512, 511, 509, 508, 507, 509, 509, 510, 512, 513, 514, 513, 512, 510, 508, 509, 509, 510, 513, 514, 514, 514, 513, 514, 515, 515, 516, 516, 514, 512, 510, 508, 509, 508, 508, 509, 511, 512, 513, 510, 510, 509, 509, 510, 510, 510, 510, 511, 510, 510, 510, 511, 511, 514, 514, 514, 514, 514, 514, 513, 515, 514, 512, 512, 513, 514, 513, 511, 508, 507, 509, 507, 510, 510, 511, 511, 512, 511, 510, 509, 509, 511, 511, 511, 512, 510, 511, 512, 513, 515, 516, 517, 514, 514, 514, 513, 511, 508, 508, 508, 512, 512, 513, 513, 513, 511, 510, 510, 510, 512, 512, 511, 511, 510, 508, 509, 508, 510, 509, 511, 510, 512, 513, 514, 513, 514, 513, 514, 515, 516, 515, 515, 513, 511, 509, 508, 510, 512, 513, 512, 514, 513, 511, 509, 507, 509, 508, 509, 509, 510, 510, 509, 510, 510, 511, 512, 515, 515, 517, 515, 513, 512, 511, 511, 512, 513, 514, 514, 513, 513, 513, 510, 509, 508, 509, 509, 511, 512, 511, 512, 511, 511, 509, 511, 510, 512, 513, 512, 512, 510, 510, 511, 513, 513, 513, 515, 513, 512, 510, 510, 510, 511, 513, 514, 516, 516, 515, 514, 510, 509, 509, 509, 510, 510, 509, 509, 509, 508, 508, 508, 509, 510, 513, 514, 513, 513, 513, 514, 514, 515, 515, 514, 515, 514, 514, 513, 513, 511, 510, 509, 508, 510, 510, 509, 509, 509, 510, 509, 509, 511, 512, 513, 512, 513, 510, 510, 511, 512, 514, 515, 516, 515, 513, 511, 510, 509, 509, 510, 513, 515, 516, 514, 513, 510, 510, 509, 508, 509, 509, 509, 509, 509, 510, 509, 510, 510, 512, 513, 513, 513, 513, 513, 512, 513, 514, 513, 515, 515, 516, 514, 512, 512, 511, 511, 511, 509, 512, 512, 512, 511, 511, 509, 507, 507, 508, 509, 509, 512, 512, 512, 511, 510, 511, 512, 514, 515, 515, 515, 513, 511, 510, 511, 512, 512, 514, 513, 513, 512, 510, 509, 510, 509, 509, 509, 510, 511, 511, 512, 510, 510, 513, 514, 515, 514, 515, 513, 512, 511, 510, 510, 512, 513, 513, 514, 512, 511, 510, 509, 509, 509, 510, 511, 512, 511, 512, 510, 510, 509, 509, 510, 512, 513, 514, 513, 512, 512, 511, 512, 512, 514, 515, 514, 513, 512, 510, 509, 509, 511, 512, 512, 514, 514, 512, 511, 510, 509, 510, 510, 511, 511, 510, 509, 510, 510, 511, 510, 510, 512, 513, 512, 512, 511, 510, 509, 511, 512, 514, 515, 516, 515, 514, 512, 512, 512, 511, 511, 512, 513, 513, 511, 511, 510, 508, 509, 508, 510, 511, 510, 511, 511, 511, 511, 513, 513, 513, 514, 514, 513, 512, 511, 510, 511, 510, 511, 512, 512, 512, 514, 513, 512, 512, 511, 512, 512, 512, 511, 511, 511, 511, 510, 511, 512, 511, 512, 512, 510, 510, 509, 509, 509, 510, 512, 513, 513, 514, 514, 514, 513, 512, 512, 513, 514, 515, 515, 514, 513, 510, 510, 508, 508, 508, 509, 511, 509, 509, 508, 509, 509, 511, 513, 515, 515, 515, 514, 513, 511, 510, 511, 511, 510, 512, 513, 512, 513, 512, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 513, 512, 512, 511, 511, 510, 509, 509, 510, 510, 512, 512, 514, 515, 514, 513, 512, 510, 509, 509, 511, 512, 513, 513, 512, 512, 513, 513, 511, 512, 512, 510, 509, 508, 507, 508, 509, 510, 511, 512, 513, 513, 513, 513, 512, 511, 512, 511, 513, 515, 515, 515, 513, 513, 512, 512, 512, 511, 511, 511, 510, 510, 508, 508, 509, 510, 511, 510, 511, 510, 509, 509, 510, 511, 511, 511, 514, 515, 515, 514, 513, 512, 511, 511, 510, 511, 513, 512, 512, 512, 512, 511, 511, 512, 512, 513, 513, 513, 512, 509, 509, 509, 510, 509, 510, 511, 512, 511, 511, 511, 510, 510, 511, 511, 512, 513, 513, 514, 513, 512, 512, 513, 512, 513, 514, 514, 514, 513, 512, 511, 510, 511, 512, 510, 510, 510, 510, 509, 509, 509, 511, 511, 512, 512, 512, 511, 511, 511, 511, 512, 512, 513, 513, 514, 514, 514, 513, 513, 513, 512, 513, 512, 511, 510, 509, 508, 509, 509, 510, 512, 512, 512, 513, 511, 510, 510, 510, 510, 511, 513, 514, 514, 514, 513, 512, 511, 510, 510, 511, 511, 513, 513, 513, 513, 512, 512, 512, 513, 513, 513, 512, 511, 509, 508, 508, 508, 510, 511, 512, 512, 512, 511, 510, 509, 510, 511, 511, 513, 513, 513, 513, 513, 514, 514, 514, 515, 515, 514, 513, 511, 510, 509, 508, 508, 510, 511, 512, 512, 512, 511, 511, 510, 509, 509, 509, 511, 513, 514, 513, 513, 512, 512, 512, 512, 513, 513, 513, 512, 513, 512, 511, 511, 513, 513, 514, 513, 512, 511, 510, 508, 509, 510, 512, 512, 513, 512, 511, 511, 510, 510, 511, 512, 512, 510, 511, 511, 511, 511, 512, 513, 514, 514, 513, 513, 512, 509, 509, 509, 511, 512, 513, 514, 513, 513, 511, 511, 510, 510, 510, 510, 510, 511, 512, 511, 512, 512, 512, 511, 512, 512, 512, 512, 513, 512, 512, 510, 511, 512, 513, 513, 513, 512, 510, 510, 509, 509, 510, 511, 513, 514, 513, 512, 511, 510, 510, 511, 511, 512, 512, 512, 512, 510, 510, 511, 512, 512, 513, 513, 513, 512, 510, 510, 509, 510, 511, 512, 513, 515, 514, 514, 513, 511, 511, 511, 511, 512, 512, 511, 511, 510, 510, 510, 509, 509, 510, 510, 511, 510, 510, 511, 511, 512, 513, 513, 513, 513, 513, 512, 511, 511, 511, 512, 513, 514, 514, 513, 512, 511, 511, 512, 512, 511, 511, 510, 509, 508, 509, 510, 511, 512, 512, 513, 513, 512, 511, 510, 511, 510, 510, 510, 511, 512, 513, 512, 513, 513, 512, 512, 512, 513, 513, 513, 513, 513, 512, 512, 512, 512, 512, 512, 511, 511, 510, 509, 510, 509, 510, 511, 511, 511, 511, 510, 510, 510, 510, 511, 512, 513, 514, 514, 515, 514, 513, 514, 513, 512, 512, 512, 511, 511, 511, 510, 510, 509, 510, 511, 512, 512, 512, 512, 511, 511, 510, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 510, 510, 511, 511, 512, 512, 513, 513, 511, 512, 512, 512, 512, 513, 512, 511, 511, 510, 510, 511, 512, 512, 512, 512, 510, 510, 509, 509, 510, 511, 511, 512, 513, 513, 513, 513, 513, 514, 513, 514, 512, 512, 511, 510, 510, 510, 510, 510, 511, 511, 512, 512, 512, 512, 510, 510, 510, 511, 512, 512, 513, 513, 513, 512, 511, 511, 510, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 511, 510, 510, 510, 511, 512, 512, 513, 513, 512, 511, 512, 511, 510, 510, 510, 510, 511, 512, 511, 512, 512, 512, 511, 511, 512, 512, 513, 513, 513, 512, 511, 511, 511, 512, 512, 513, 513, 513, 512, 510, 509, 510, 511, 512, 512, 512, 512, 512, 511, 510, 510, 511, 511, 512, 511, 512, 512, 512, 512, 511, 511, 512, 512, 511, 511, 511, 511, 511, 510, 511, 512, 513, 513, 512, 512, 512, 511, 512, 512, 512, 512, 513, 513, 511, 511, 510, 510, 510, 511, 512, 512, 512, 512, 511, 511, 511, 510, 511, 511, 512, 513, 513, 512, 512, 511, 510, 509, 511, 511, 512, 513, 512, 512, 512, 511, 511, 511, 511, 510, 511, 512, 512, 511, 511, 512, 512, 512, 513, 513, 513, 512, 512, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 510, 511, 511, 512, 513, 513, 513, 514, 512, 511, 510, 510, 510, 511, 512, 513, 512, 512, 511, 511, 509, 511, 510, 511, 511, 512, 511, 511, 511, 511, 512, 513, 512, 513, 512, 512, 512, 512, 511, 511, 511, 511, 513, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 511, 510, 510, 510, 510, 510, 510, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 513, 513, 514, 513, 512, 511, 510, 510, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 512, 511, 512, 511, 510, 511, 510, 511, 512, 513, 513, 513, 512, 512, 511, 511, 511, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 513, 513, 513, 512, 512, 511, 511, 511, 511, 511, 512, 513, 512, 512, 510, 509, 509, 510, 510, 510, 511, 511, 511, 511, 511, 511, 512, 512, 513, 513, 514, 512, 512, 512, 512, 512, 512, 512, 513, 513, 512, 511, 510, 510, 510, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 510, 510, 510, 512, 513, 513, 513, 513, 512, 511, 511, 511, 511, 512, 512, 513, 513, 512, 511, 511, 511, 512, 511, 512, 512, 511, 510, 510, 510, 511, 511, 512, 512, 512, 512, 511, 511, 511, 512, 512, 513, 512, 512, 512, 512, 513, 512, 512, 512, 511, 512, 512, 512, 511, 510, 510, 510, 510, 511, 511, 512, 512, 513, 512, 511, 511, 511, 511, 512, 512, 512, 513, 513, 512, 512, 512, 512, 512, 511, 511, 512, 511, 511, 511, 511, 512, 512, 512, 512, 511, 511, 511, 510, 510, 510, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 513, 513, 513, 512, 512, 512, 511, 511, 512, 512, 513, 512, 512, 511, 511, 511, 511, 510, 510, 510, 510, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 512, 512, 512, 511, 512, 512, 512, 513, 513, 513, 512, 511, 511, 510, 511, 511, 512, 512, 512, 511, 511, 511, 510, 511, 510, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 513, 513, 513, 513, 513, 512, 512, 511, 511, 512, 512, 512, 512, 512, 511, 510, 510, 510, 511, 512, 511, 511, 511, 511, 511, 510, 510, 511, 511, 512, 511, 512, 512, 512, 511, 512, 512, 513, 513, 513, 512, 512, 512, 512, 512, 512, 511, 512, 512, 511, 511, 511, 511, 511, 511, 511, 510, 511, 510, 510, 510, 510, 509, 510, 511, 511, 512, 513, 513, 512, 512, 512, 512, 512, 513, 513, 514, 513, 512, 512, 511, 511, 512, 512, 513, 513, 513, 512, 511, 510, 509, 509, 509, 509, 510, 511, 511, 511, 511, 510, 510, 511, 512, 513, 512, 513, 512, 512, 512, 513, 513, 514, 513, 513, 512, 512, 512, 512, 511, 512, 512, 512, 511, 511, 510, 510, 509, 510, 509, 510, 510, 511, 511, 512, 512, 512, 511, 511, 511, 512, 512, 513, 513, 513, 512, 512, 512, 511, 512, 513, 513, 514, 513, 512, 511, 511, 510, 510, 511, 512, 511, 511, 510, 510, 509, 509, 510, 511, 511, 512, 511, 512, 511, 511, 511, 512, 513, 513, 513, 513, 512, 512, 512, 513, 512, 513, 512, 511, 511, 512, 511, 511, 511, 510, 510, 511, 511, 512, 511, 511, 509, 510, 510, 511, 512, 513, 513, 513, 512, 512, 512, 512, 511, 512, 512, 513, 513, 513, 512, 511, 510, 511, 511, 512, 512, 511, 511, 511, 510, 510, 511, 511, 512, 512, 512, 512, 511, 511, 510, 510, 511, 511, 512, 513, 512, 513, 513, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 510, 511, 511, 511, 512, 513, 513, 513, 512, 512, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 513, 512, 512, 511, 511, 510, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 510, 510, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 511, 511, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 512, 512, 513, 512, 512, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 510, 510, 511, 511, 511, 512, 512, 512, 512, 512, 511, 512, 511, 511, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 512, 512, 512, 512, 513, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 510, 510, 511, 511, 511, 512, 512, 513, 512, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 510, 510, 510, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 510, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 511, 510, 511, 511, 512, 512, 513, 513, 513, 512, 512, 511, 512, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 511, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 512, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 512, 512, 512, 512, 513, 513, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 511, 511, 510, 510, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 513, 512, 512, 512, 512, 511, 512, 511, 512, 512, 512, 511, 511, 510, 511, 511, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 513, 512, 512, 511, 511, 511, 511, 511, 511, 510, 511, 512, 513, 512, 512, 511, 511, 510, 510, 511, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 511, 512, 512, 512, 513, 512, 512, 512, 512, 511, 511, 511, 511, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 513, 513, 513, 512, 512, 511, 511, 510, 511, 511, 511, 511, 511, 511, 511, 510, 510, 511, 511, 511, 512, 511, 511, 511, 511, 512, 512, 512, 512, 512, 513, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 510, 510, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 512, 512, 513, 512, 513, 513, 513, 512, 512, 511, 512, 512, 512, 512, 512, 511, 511, 510, 510, 510, 511, 510, 511, 510, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 513, 512, 513, 512, 512, 511, 512, 511, 512, 513, 513, 513, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 512, 512, 512, 513, 512, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 510, 510, 511, 511, 511, 512, 512, 513, 512, 512, 511, 511, 511, 512, 512, 513, 513, 513, 512, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 512, 512, 512, 512, 513, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 510, 511, 511, 511, 511, 512, 512, 512, 511, 511, 510, 511, 511, 512, 512, 513, 513, 513, 512, 512, 511, 512, 511, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 510, 510, 510, 510, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 513, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 510, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 512, 513, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 511, 511, 512, 512, 512, 512, 511, 511, 510, 510, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 510, 511, 511, 511, 511, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 510, 511, 510, 511, 511, 512, 512, 512, 511, 512, 511, 511, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 510, 510, 510, 510, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 513, 512, 512, 512, 511, 510, 511, 510, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 512, 512, 513, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 513, 512, 513, 512, 512, 511, 512, 511, 511, 510, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 513
+const uint8_t snare_drum_adpcm[] = {
+240, 242, 243, 195, 179, 196, 179, 179, 196, 179, 179, 196, 179, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179,
+180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195,
+179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180,
+183, 212, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 196, 195, 180, 195, 180, 179, 196,
+163, 194, 211, 179, 196, 165, 133, 218, 5, 188, 255, 11, 119, 128, 168, 41, 32, 0, 233, 11, 153, 138, 128, 24, 48, 21, 9, 49, 20, 113, 0, 146,
+152, 172, 137, 192, 32, 192, 160, 177, 191, 154, 128, 49, 87, 1, 129, 1, 8, 130, 25, 137, 240, 171, 144, 218, 9, 144, 76, 9, 180, 96, 17, 130,
+18, 17, 131, 176, 220, 184, 155, 10, 173, 134, 139, 9, 155, 83, 7, 32, 129, 0, 200, 41, 33, 27, 149, 170, 26, 174, 140, 186, 112, 129, 129, 27,
+36, 83, 147, 203, 8, 66, 0, 208, 143, 128, 11, 33, 33, 129, 251, 9, 136, 19, 7, 24, 24, 129, 171, 137, 145, 97, 128, 46, 142, 40, 137, 0,
+129, 1, 145, 26, 115, 240, 41, 16, 130, 161, 168, 50, 169, 154, 251, 41, 240, 2, 177, 162, 24, 21, 96, 89, 186, 162, 136, 1, 153, 154, 135, 146,
+152, 169, 11, 4, 41, 1, 12, 40, 58, 37, 23, 75, 128, 201, 152, 24, 15, 176, 35, 130, 14, 140, 131, 56, 74, 133, 8, 57, 224, 32, 2, 173,
+184, 194, 64, 137, 162, 192, 149, 45, 16, 16, 20, 136, 128, 155, 27, 147, 91, 16, 143, 0, 219, 3, 145, 170, 73, 168, 20, 135, 40, 18, 146, 161,
+159, 161, 137, 146, 141, 41, 248, 144, 52, 136, 88, 144, 10, 4, 138, 59, 3, 138, 10, 208, 136, 200, 89, 138, 16, 31, 1, 18, 64, 177, 240, 128,
+133, 26, 57, 26, 120, 216, 152, 27, 48, 18, 139, 176, 122, 40, 74, 0, 2, 156, 20, 27, 201, 217, 152, 149, 16, 209, 0, 8, 22, 152, 136, 211,
+147, 152, 194, 80, 26, 17, 45, 170, 107, 152, 8, 24, 1, 186, 56, 66, 72, 123, 25, 76, 9, 153, 176, 34, 248, 128, 10, 18, 40, 21, 27, 190,
+130, 129, 36, 16, 131, 186, 208, 189, 57, 66, 74, 154, 146, 146, 45, 64, 185, 128, 145, 123, 193, 67, 161, 129, 31, 155, 146, 161, 150, 0, 2, 142,
+152, 24, 135, 24, 40, 154, 2, 136, 200, 160, 234, 3, 16, 139, 51, 88, 131, 46, 138, 155, 36, 49, 41, 217, 30, 144, 10, 28, 3, 48, 133, 184,
+44, 137, 83, 139, 19, 31, 40, 168, 167, 160, 152, 92, 0, 152, 129, 57, 77, 25, 169, 43, 24, 7, 129, 32, 171, 44, 241, 25, 130, 72, 145, 128,
+15, 24, 16, 9, 136, 145, 154, 35, 40, 135, 142, 145, 146, 92, 9, 164, 0, 130, 170, 235, 17, 8, 65, 145, 108, 145, 184, 136, 145, 129, 81, 188,
+40, 16, 146, 149, 26, 31, 34, 200, 133, 184, 128, 178, 209, 176, 19, 149, 17, 16, 41, 140, 141, 40, 51, 174, 40, 106, 177, 154, 145, 99, 146, 153,
+13, 49, 162, 40, 251, 41, 9, 162, 163, 149, 2, 161, 250, 89, 193, 16, 136, 73, 129, 137, 201, 88, 81, 187, 49, 9, 9, 188, 152, 37, 138, 58,
+193, 52, 162, 151, 10, 210, 2, 241, 128, 128, 128, 33, 140, 146, 11, 4, 56, 11, 131, 171, 169, 37, 24, 218, 98, 163, 137, 78, 216, 24, 131, 12,
+144, 72, 144, 128, 34, 249, 18, 18, 156, 0, 12, 8, 161, 136, 213, 9, 40, 1, 180, 55, 140, 145, 128, 129, 194, 148, 170, 59, 249, 104, 136, 161,
+40, 0, 136, 177, 72, 153, 26, 45, 57, 100, 28, 146, 112, 137, 216, 145, 41, 152, 136, 136, 56, 131, 74, 59, 95, 128, 130, 0, 28, 27, 136, 193,
+122, 137, 145, 9, 73, 32, 155, 170, 52, 242, 26, 130, 73, 146, 4, 219, 24, 2, 57, 154, 242, 130, 201, 169, 18, 162, 135, 176, 148, 18, 33, 154,
+146, 60, 217, 46, 9, 128, 170, 162, 39, 129, 216, 65, 8, 8, 33, 191, 24, 41, 8, 211, 151, 24, 193, 128, 75, 128, 153, 16, 58, 4, 44, 152,
+132, 146, 250, 16, 24, 34, 141, 169, 1, 163, 173, 18, 74, 34, 82, 225, 17, 152, 41, 143, 0, 128, 208, 162, 40, 179, 178, 9, 7, 17, 168, 160,
+91, 148, 11, 45, 153, 49, 17, 24, 58, 24, 159, 160, 172, 168, 16, 23, 148, 75, 89, 136, 1, 9, 176, 28, 33, 46, 233, 153, 90, 128, 51, 154,
+144, 64, 18, 240, 1, 169, 177, 164, 145, 16, 242, 6, 27, 152, 24, 75, 144, 153, 2, 176, 9, 109, 8, 24, 132, 134, 176, 185, 18, 28, 74, 173,
+18, 0, 9, 227, 24, 19, 88, 41, 186, 193, 17, 163, 202, 185, 133, 146, 132, 121, 137, 184, 0, 61, 168, 145, 10, 97, 178, 151, 56, 0, 152, 185,
+88, 249, 128, 130, 10, 107, 137, 1, 1, 153, 49, 163, 224, 162, 76, 128, 25, 44, 145, 163, 241, 24, 170, 7, 73, 26, 184, 180, 192, 65, 10, 131,
+2, 187, 226, 21, 201, 162, 130, 170, 129, 72, 184, 121, 18, 186, 20, 136, 13, 193, 133, 160, 41, 153, 133, 140, 66, 154, 33, 162, 50, 175, 136, 153,
+114, 200, 0, 128, 17, 40, 75, 9, 155, 20, 138, 123, 129, 168, 17, 144, 252, 128, 40, 40, 44, 18, 56, 15, 17, 13, 34, 58, 144, 137, 248, 40,
+36, 187, 224, 32, 25, 169, 18, 169, 74, 16, 160, 122, 113, 152, 25, 34, 187, 154, 61, 25, 136, 49, 177, 140, 154, 228, 50, 242, 17, 33, 168, 10,
+114, 177, 138, 194, 136, 42, 57, 145, 31, 137, 189, 19, 163, 7, 162, 18, 34, 158, 40, 145, 42, 122, 216, 8, 44, 10, 136, 26, 20, 52, 153, 189,
+67, 0, 2, 186, 143, 56, 163, 147, 120, 169, 10, 27, 27, 33, 75, 89, 132, 169, 143, 17, 34, 128, 226, 17, 170, 146, 171, 168, 68, 40, 139, 170,
+64, 124, 58, 134, 216, 152, 19, 8, 17, 208, 137, 41, 12, 147, 9, 88, 19, 177, 220, 8, 25, 133, 24, 48, 27, 105, 155, 220, 33, 81, 144, 10,
+137, 59, 26, 7, 137, 139, 32, 58, 71, 161, 138, 156, 25, 128, 217, 129, 50, 115, 168, 232, 0, 56, 90, 8, 145, 88, 186, 225, 128, 2, 160, 137,
+146, 162, 68, 89, 172, 17, 144, 44, 66, 58, 65, 29, 156, 176, 160, 136, 104, 16, 2, 58, 187, 193, 2, 116, 136, 73, 136, 138, 139, 137, 209, 179,
+129, 185, 83, 80, 73, 11, 200, 136, 18, 26, 38, 1, 48, 153, 15, 30, 170, 2, 8, 5, 128, 203, 60, 89, 144, 81, 152, 161, 41, 26, 25, 88,
+137, 138, 15, 132, 162, 21, 208, 154, 192, 136, 73, 34, 148, 131, 26, 11, 142, 1, 136, 96, 160, 129, 9, 153, 232, 32, 0, 32, 189, 2, 108, 73,
+136, 176, 48, 12, 58, 22, 4, 185, 170, 29, 26, 168, 10, 67, 37, 153, 11, 193, 74, 80, 2, 137, 26, 163, 200, 74, 188, 168, 17, 57, 61, 116,
+73, 185, 153, 10, 170, 67, 72, 135, 128, 152, 41, 137, 138, 1, 89, 42, 187, 129, 175, 1, 148, 90, 16, 129, 167, 33, 10, 187, 162, 241, 161, 57,
+33, 17, 177, 249, 144, 152, 35, 5, 106, 129, 154, 132, 251, 25, 1, 41, 24, 161, 152, 104, 232, 130, 139, 82, 40, 8, 136, 10, 146, 16, 143, 185,
+24, 113, 8, 40, 11, 170, 31, 17, 0, 21, 72, 146, 172, 30, 16, 136, 138, 28, 137, 86, 128, 161, 155, 43, 17, 130, 74, 9, 73, 208, 138, 1,
+169, 114, 32, 24, 58, 224, 44, 138, 26, 150, 58, 165, 132, 169, 137, 211, 17, 152, 142, 179, 5, 168, 8, 33, 74, 165, 144, 168, 51, 20, 173, 176,
+218, 56, 9, 18, 49, 156, 145, 129, 115, 242, 128, 0, 136, 4, 128, 143, 130, 0, 168, 154, 96, 19, 176, 201, 172, 18, 17, 123, 1, 18, 41, 251,
+145, 9, 72, 138, 146, 184, 217, 30, 36, 178, 128, 145, 1, 52, 200, 25, 0, 243, 137, 141, 24, 131, 3, 28, 170, 66, 9, 175, 5, 57, 2, 146,
+155, 31, 56, 41, 27, 128, 136, 138, 216, 157, 147, 95, 8, 129, 2, 176, 19, 80, 25, 157, 186, 26, 23, 153, 168, 58, 201, 50, 180, 135, 0, 72,
+168, 153, 136, 19, 8, 13, 170, 9, 133, 43, 248, 163, 24, 105, 11, 165, 34, 18, 184, 9, 189, 18, 4, 200, 155, 186, 242, 72, 10, 34, 4, 49,
+32, 163, 180, 143, 10, 163, 168, 250, 40, 153, 146, 32, 63, 41, 25, 3, 16, 82, 80, 57, 143, 201, 17, 0, 9, 56, 156, 139, 216, 195, 18, 18,
+144, 89, 51, 12, 57, 20, 225, 146, 160, 235, 16, 9, 0, 154, 158, 163, 147, 5, 19, 38, 162, 173, 201, 4, 136, 32, 156, 128, 20, 184, 9, 154,
+165, 160, 36, 129, 56, 49, 61, 44, 174, 129, 18, 50, 44, 14, 91, 160, 187, 209, 9, 39, 33, 9, 200, 161, 58, 33, 0, 24, 141, 168, 184, 16,
+25, 143, 150, 168, 26, 113, 35, 138, 235, 9, 66, 144, 40, 8, 80, 192, 163, 220, 10, 18, 51, 154, 250, 145, 34, 136, 181, 33, 154, 132, 24, 33,
+14, 140, 129, 24, 203, 164, 53, 48, 240, 154, 128, 146, 145, 137, 51, 4, 150, 202, 201, 90, 18, 128, 145, 168, 26, 134, 152, 43, 192, 165, 8, 48,
+27, 148, 17, 176, 250, 139, 90, 18, 50, 201, 27, 136, 26, 185, 112, 20, 66, 152, 221, 152, 129, 21, 168, 152, 138, 81, 72, 12, 136, 24, 27, 129,
+150, 4, 136, 80, 58, 143, 154, 1, 147, 145, 28, 136, 145, 145, 33, 63, 80, 128, 11, 176, 129, 148, 134, 185, 9, 129, 17, 211, 24, 44, 240, 179,
+160, 9, 83, 81, 24, 242, 139, 40, 19, 0, 11, 186, 197, 162, 128, 128, 32, 115, 185, 240, 144, 65, 74, 2, 171, 153, 160, 7, 0, 144, 25, 169,
+210, 8, 211, 17, 129, 36, 170, 222, 56, 18, 130, 41, 185, 149, 24, 189, 8, 135, 129, 160, 168, 138, 121, 129, 2, 194, 169, 137, 134, 130, 128, 8,
+18, 179, 239, 137, 32, 20, 136, 249, 0, 148, 16, 9, 128, 90, 8, 185, 10, 44, 66, 1, 161, 235, 26, 4, 147, 176, 27, 74, 145, 167, 128, 145,
+243, 2, 184, 193, 41, 25, 65, 57, 140, 146, 179, 55, 27, 202, 161, 146, 14, 146, 25, 19, 57, 234, 145, 56, 123, 5, 169, 201, 16, 73, 17, 169,
+186, 1, 113, 186, 152, 33, 71, 10, 217, 169, 82, 34, 161, 171, 67, 160, 251, 168, 145, 19, 162, 144, 176, 241, 88, 66, 1, 138, 44, 12, 2, 154,
+137, 25, 146, 132, 251, 137, 36, 18, 166, 185, 171, 7, 32, 184, 24, 50, 161, 168, 175, 128, 153, 19, 180, 178, 201, 134, 17, 3, 185, 33, 124, 147,
+172, 8, 56, 25, 186, 30, 29, 130, 36, 173, 129, 32, 132, 160, 155, 113, 133, 16, 187, 152, 179, 44, 89, 140, 136, 17, 64, 128, 185, 158, 33, 84,
+145, 138, 16, 73, 137, 203, 154, 147, 96, 178, 242, 16, 48, 13, 25, 9, 80, 24, 25, 160, 152, 29, 176, 194, 48, 80, 24, 51, 241, 154, 171, 1,
+52, 168, 185, 70, 120, 10, 185, 138, 34, 128, 145, 45, 48, 9, 10, 188, 65, 80, 8, 19, 192, 104, 176, 185, 10, 234, 17, 129, 7, 160, 156, 25,
+66, 26, 33, 33, 33, 138, 214, 152, 141, 24, 20, 160, 138, 41, 188, 194, 16, 74, 130, 128, 50, 114, 23, 144, 208, 137, 137, 161, 25, 147, 157, 57,
+106, 10, 24, 11, 115, 65, 145, 10, 141, 80, 136, 59, 153, 26, 137, 41, 218, 248, 9, 8, 22, 17, 178, 68, 41, 10, 250, 9, 24, 34, 176, 176,
+44, 200, 153, 60, 58, 72, 34, 113, 138, 41, 50, 112, 171, 137, 154, 49, 123, 186, 170, 18, 249, 56, 2, 53, 184, 17, 27, 226, 26, 80, 129, 129,
+12, 12, 147, 193, 233, 25, 128, 2, 88, 171, 129, 115, 131, 152, 43, 28, 52, 152, 225, 192, 16, 9, 29, 153, 137, 112, 19, 152, 170, 131, 106, 24,
+11, 153, 131, 1, 208, 29, 25, 22, 129, 208, 8, 43, 73, 154, 25, 185, 81, 19, 147, 216, 67, 152, 235, 216, 8, 4, 131, 25, 155, 130, 132, 132,
+11, 202, 72, 18, 170, 175, 73, 33, 128, 209, 25, 48, 33, 138, 224, 209, 56, 1, 40, 28, 130, 227, 137, 128, 240, 145, 18, 50, 40, 31, 153, 152,
+60, 50, 142, 48, 34, 156, 177, 62, 16, 161, 169, 140, 123, 1, 149, 0, 232, 0, 0, 25, 51, 27, 25, 15, 202, 144, 33, 21, 161, 208, 160, 160,
+20, 64, 128, 11, 42, 39, 153, 138, 171, 66, 233, 9, 155, 48, 114, 17, 176, 9, 1, 34, 123, 177, 10, 148, 161, 202, 159, 24, 129, 149, 146, 208,
+73, 72, 152, 162, 32, 112, 8, 138, 12, 29, 160, 56, 192, 144, 17, 36, 179, 160, 210, 57, 169, 36, 66, 8, 162, 11, 255, 24, 152, 17, 129, 185,
+27, 23, 16, 145, 249, 2, 34, 176, 33, 186, 136, 224, 139, 217, 33, 21, 88, 152, 184, 138, 25, 2, 123, 21, 137, 193, 1, 137, 13, 12, 16, 19,
+10, 162, 123, 48, 219, 161, 56, 8, 180, 170, 82, 1, 132, 157, 26, 59, 148, 131, 50, 251, 24, 171, 8, 98, 51, 193, 137, 192, 170, 159, 34, 2,
+8, 170, 125, 130, 145, 160, 169, 130, 64, 169, 138, 22, 35, 200, 172, 156, 130, 35, 34, 224, 177, 180, 1, 186, 131, 48, 39, 130, 204, 152, 1, 50,
+2, 175, 29, 129, 20, 45, 170, 2, 17, 137, 224, 65, 36, 168, 152, 206, 17, 9, 5, 153, 128, 89, 24, 202, 26, 137, 21, 18, 153, 170, 133, 130,
+6, 153, 187, 40, 130, 32, 11, 200, 183, 169, 250, 73, 80, 2, 152, 154, 128, 18, 148, 136, 156, 3, 224, 16, 152, 138, 61, 0, 168, 2, 195, 151,
+33, 161, 170, 62, 132, 80, 144, 154, 48, 170, 234, 233, 146, 49, 129, 160, 200, 33, 5, 42, 34, 59, 135, 155, 42, 176, 59, 11, 13, 150, 172, 73,
+40, 20, 162, 218, 27, 32, 23, 8, 25, 130, 130, 189, 188, 161, 32, 37, 225, 152, 16, 128, 32, 138, 48, 120, 131, 128, 176, 151, 12, 17, 217, 156,
+179, 133, 1, 161, 169, 80, 8, 193, 18, 82, 33, 142, 144, 219, 128, 134, 129, 160, 137, 48, 152, 168, 29, 73, 74, 57, 34, 42, 58, 67, 139, 207,
+155, 36, 162, 148, 172, 60, 25, 40, 176, 131, 36, 7, 179, 171, 10, 50, 131, 12, 248, 156, 1, 20, 25, 10, 61, 73, 145, 216, 16, 4, 72, 171,
+139, 56, 22, 132, 169, 159, 128, 129, 9, 152, 8, 50, 39, 9, 40, 32, 192, 179, 192, 240, 153, 74, 152, 8, 162, 120, 17, 41, 143, 17, 19, 161,
+219, 153, 40, 39, 160, 201, 152, 25, 128, 0, 178, 3, 39, 8, 8, 59, 180, 135, 194, 11, 10, 200, 134, 144, 184, 139, 50, 120, 0, 169, 34, 21,
+128, 204, 25, 130, 149, 152, 156, 161, 128, 35, 48, 143, 22, 145, 177, 170, 137, 37, 40, 157, 154, 8, 50, 195, 243, 160, 32, 20, 162, 10, 59, 120,
+162, 185, 157, 72, 130, 4, 156, 170, 2, 2, 203, 3, 195, 112, 145, 168, 170, 22, 20, 145, 202, 8, 138, 51, 248, 152, 28, 73, 145, 1, 8, 134,
+32, 168, 171, 59, 60, 132, 112, 169, 160, 130, 176, 8, 200, 52, 60, 248, 160, 128, 98, 129, 130, 160, 11, 51, 4, 188, 159, 11, 40, 181, 152, 1,
+69, 2, 160, 218, 25, 160, 21, 25, 10, 11, 8, 128, 133, 192, 151, 152, 168, 138, 3, 135, 20, 169, 217, 9, 35, 130, 138, 3, 31, 200, 154, 42,
+50, 67, 2, 128, 204, 179, 55, 128, 140, 137, 176, 128, 11, 159, 34, 179, 179, 12, 67, 8, 71, 152, 169, 138, 58, 150, 8, 168, 56, 48, 0, 254,
+136, 145, 18, 179, 128, 139, 133, 67, 56, 203, 48, 60, 132, 192, 186, 60, 243, 8, 168, 128, 6, 1, 168, 8, 48, 88, 56, 128, 12, 200, 179, 189,
+187, 132, 100, 8, 210, 137, 0, 81, 1, 160, 171, 11, 3, 7, 128, 10, 56, 0, 189, 175, 0, 20, 2, 168, 187, 67, 112, 8, 8, 2, 56, 192,
+251, 154, 10, 21, 130, 168, 176, 11, 120, 21, 137, 137, 128, 131, 192, 179, 12, 6, 161, 170, 235, 33, 4, 145, 11, 11, 67, 248, 1, 8, 50, 2,
+12, 251, 10, 20, 18, 10, 141, 137, 128, 48, 195, 3, 200, 3, 8, 181, 248, 33, 130, 176, 143, 137, 34, 22, 169, 154, 40, 48, 128, 240, 41, 131,
+3, 200, 143, 25, 50, 98, 137, 202, 128, 32, 184, 176, 8, 141, 132, 179, 64, 72, 3, 8, 216, 139, 88, 67, 184, 203, 72, 184, 192, 187, 83, 50,
+64, 184, 188, 180, 8, 52, 195, 3, 12, 72, 8, 128, 13, 8, 8, 14, 203, 179, 67, 8, 208, 128, 48, 53, 131, 180, 60, 203, 128, 11, 216, 192,
+51, 3, 8, 141, 60, 0, 132, 192, 195, 192, 48, 72, 48, 248, 1, 136, 179, 139, 12, 83, 8, 248, 168, 32, 131, 51, 0, 8, 197, 243, 160, 10,
+8, 48, 72, 8, 248, 136, 50, 56, 128, 188, 200, 7, 8, 8, 59, 8, 8, 189, 128, 68, 56, 192, 59, 219, 128, 48, 181, 3, 200, 48, 80, 8,
+188, 8, 4, 3, 216, 159, 33, 130, 128, 192, 11, 3, 180, 3, 128, 14, 3, 13, 8, 200, 67, 3, 140, 192, 3, 8, 4, 159, 137, 32, 3, 8,
+13, 200, 3, 52, 200, 192, 186, 135, 34, 138, 176, 8, 200, 67, 192, 48, 8, 4, 200, 184, 136, 96, 8, 12, 8, 88, 8, 12, 136, 0, 133, 128,
+208, 200, 3, 52, 8, 244, 169, 128, 50, 178, 192, 248, 147, 1, 162, 8, 72, 179, 195, 128, 208, 128, 112, 137, 0, 184, 3, 8, 205, 128, 128, 64,
+4, 8, 216, 128, 52, 48, 188, 188, 72, 3, 8, 216, 8, 64, 60, 203, 179, 52, 3, 216, 192, 128, 132, 11, 8, 8, 8, 8, 8, 23, 224, 128,
+64, 8, 8, 8, 8, 7, 200, 192, 8, 8, 53, 12, 159, 40, 8, 2, 8, 8, 132, 4, 243, 136, 0, 136, 132, 187, 11, 88, 195, 128, 128, 128,
+128, 7, 184, 200, 8, 55, 136, 176, 11, 8, 133, 132, 187, 8, 196, 3, 188, 128, 4, 132, 128, 140, 64, 48, 12, 8, 196, 128, 75, 8, 204, 128,
+64, 72, 56, 203, 8, 64, 8, 4, 140, 128, 208, 48, 12, 8, 132, 128, 140, 208, 128, 132, 128, 128, 134, 128, 4, 200, 128, 12, 3, 180, 200, 8,
+200, 8, 120, 130, 128, 184, 8, 133, 128, 76, 8, 3, 224, 11, 59, 80, 8, 140, 192, 179, 132, 128, 128, 128, 112, 72, 8, 8, 140, 139, 133, 128,
+208, 11, 72, 180, 8, 8, 13, 3, 196, 3, 200, 3, 132, 192, 8, 8, 224, 131, 139, 128, 0, 248, 179, 136, 208, 67, 48, 132, 139, 128, 96, 72,
+187, 192, 72, 56, 128, 188, 188, 8, 88, 3, 8, 141, 52, 195, 179, 8, 132, 180, 192, 8, 200, 132, 192, 176, 200, 179, 132, 132, 3, 200, 128, 4,
+3, 224, 128, 59, 133, 179, 188, 192, 72, 195, 176, 192, 48, 3, 180, 195, 128, 68, 8, 200, 128, 180, 179, 13, 195, 128, 139, 133, 179, 248, 1, 34,
+131, 192, 8, 200, 132, 3, 200, 203, 131, 4, 12, 184, 72, 64, 8, 200, 184, 88, 72, 195, 131, 11, 8, 8, 8, 143, 128, 0, 136, 0, 248, 131,
+80, 132, 192, 176, 72, 8, 200, 128, 128, 5, 180, 200, 192, 131, 132, 192, 128, 128, 0, 136, 183, 3, 8, 224, 131, 128, 208, 128, 132, 128, 208, 128,
+128, 133, 128, 208, 11, 3, 133, 192, 128, 128, 104, 8, 184, 8, 133, 128, 208, 195, 128, 4, 195, 192, 128, 128, 128, 5, 200, 192, 72, 8, 3, 8,
+232, 179, 72, 192, 179, 195, 132, 128, 128, 13, 8, 180, 195, 128, 128, 181, 132, 128, 208, 128, 128, 181, 195, 128, 4, 136, 181, 192, 128, 128, 4, 200,
+128, 200, 88, 8, 3, 196, 138, 128, 4, 8, 216, 128, 4, 200, 8, 128, 5, 8, 216, 8, 4, 200, 179, 216, 128, 4, 131, 128, 0, 248, 131, 0,
+8, 142, 128, 128, 0, 120, 128, 8, 128, 232, 3, 8, 8, 8, 248, 200, 3, 132, 128, 140, 128, 96, 8, 200, 192, 131, 4, 3, 216, 192, 179, 8,
+4, 200, 195, 128, 128, 80, 128, 128, 128, 240, 8, 180, 8, 88, 8, 200, 128, 128, 5, 200, 8, 64, 128, 128, 128, 143, 180, 128, 132, 0, 216, 128,
+128, 181, 8, 8, 104, 128, 200, 132, 128, 132, 203, 128, 128, 128, 128, 7, 200, 179, 180, 3, 13, 139, 132, 132, 128, 128, 208, 8, 180, 195, 179, 8,
+8, 6, 8, 216, 8, 180, 195, 128, 128, 128, 135, 176, 136, 128, 6, 195, 128, 208, 179, 3, 200, 200, 3, 4, 8, 216, 179, 8, 136, 7, 136, 139,
+128, 182, 3, 8, 8, 182, 200, 8, 128, 224, 51, 180, 192, 184, 88, 2, 128, 200, 132, 128, 208, 179, 8, 88, 128, 180, 8, 224, 128, 48, 208, 128,
+128, 128, 128, 8, 183, 4, 200, 179, 132, 128, 128, 6, 200, 192, 176, 3, 136, 0, 248, 72, 8, 179, 136, 96, 8, 8, 181, 8, 8, 232, 3, 8,
+216, 128, 8, 216, 72, 128, 128, 182, 179, 8, 133, 180, 3, 200, 200, 3, 128, 216, 192, 8, 180, 195, 3, 8, 8, 134, 128, 181, 179, 200, 179, 52,
+128, 140, 140, 0, 8, 8, 8, 8, 23, 224, 8, 128, 133, 128, 128, 224, 48, 8, 181, 200, 128, 128, 181, 8, 200, 88, 8, 3, 196, 176, 8, 4,
+3, 216, 192, 8, 8, 181, 195, 128, 128, 181, 8, 8, 8, 6, 8, 216, 3, 8, 181, 8, 8, 8, 8, 248, 9, 232, 3, 8, 133, 192, 184, 132,
+132, 3, 200, 192, 179, 3, 216, 3, 128, 128, 240, 139, 128, 133, 132, 192, 128, 128, 133, 179, 128, 8, 128, 8, 240, 137, 224, 3, 8, 196, 179, 128,
+8, 134, 180, 192, 179, 195, 3, 208, 128, 132, 128, 12, 12, 131, 180, 179, 196, 179, 179, 132, 0, 8, 248, 179, 195, 179, 128, 128, 134, 192, 179, 200,
+3, 8, 5, 8, 216, 179, 196, 3, 136, 0, 136, 240, 184, 180, 3, 4, 200, 195, 128, 180, 3, 208, 179, 195, 132, 128, 208, 128, 180, 179, 195, 192,
+8, 88, 8, 195, 3, 8, 128, 232, 179, 196, 3, 195, 128, 188, 180, 3, 136, 181, 128, 8, 5, 200, 179, 196, 3, 136, 208, 3, 200, 179, 180, 195,
+179, 8, 8, 182, 195, 128, 4, 200, 179, 8, 8, 6, 195, 128, 208, 8, 128, 181, 195, 128, 128, 128, 182, 179, 196, 179, 179, 196, 3, 200, 179, 180,
+195, 179, 8, 181, 195, 179, 132, 128, 128, 224, 8, 128, 133, 192, 179, 8, 8, 197, 179, 180, 195, 179, 132, 192, 179, 3, 224, 179, 195, 179, 180, 195,
+179, 180, 195, 128, 128, 181, 179, 196, 3, 200, 179, 180, 3, 136, 0, 248, 8, 180, 195, 179, 180, 8, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180,
+3, 216, 128, 128, 128, 183, 179, 180, 195, 3, 200, 179, 196, 3, 8, 216, 128, 180, 3, 200, 180, 195, 128, 180, 195, 179, 128, 181, 195, 179, 132, 128,
+181, 179, 200, 179, 216, 3, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 131, 0
 };
 
-// Definición del tamaño y el array del Hi-Hat
+// Definición del tamaño (en muestras) y el array del Hi-Hat
 const int hi_hat_size = 5239;
-const int16_t hi_hat_sample[] = {512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 513, 510, 514, 510, 514, 509, 514, 510, 514, 510, 515, 509, 514, 510, 514, 510, 513, 508, 519, 511, 516, 517, 514, 508, 519, 511, 518, 510, 505, 525, 559, 514, 538, 541, 475, 489, 496, 495, 495, 524, 433, 442, 538, 471, 563, 474, 466, 486, 524, 506, 536, 457, 497, 437, 579, 551, 563, 472, 581, 405, 572, 489, 464, 538, 525, 603, 568, 706, 537, 475, 559, 556, 371, 531, 376, 421, 425, 641, 501, 712, 520, 541, 367, 548, 257, 493, 463, 382, 354, 665, 501, 653, 511, 683, 414, 569, 581, 394, 572, 453, 556, 632, 750, 473, 555, 415, 595, 557, 627, 553, 508, 450, 701, 496, 821, 334, 287, 486, 494, 473, 411, 312, 0, 476, 259, 272, 582, 720, 497, 443, 816, 345, 806, 487, 533, 544, 729, 662, 569, 712, 606, 503, 459, 384, 531, 408, 633, 587, 551, 349, 230, 380, 455, 409, 386, 479, 418, 420, 468, 512, 554, 618, 774, 693, 827, 761, 735, 408, 669, 373, 394, 433, 627, 663, 249, 582, 486, 585, 383, 461, 425, 271, 451, 281, 561, 501, 420, 564, 532, 630, 395, 423, 536, 699, 548, 741, 649, 577, 558, 583, 397, 405, 823, 627, 629, 462, 366, 293, 483, 484, 285, 381, 393, 464, 658, 482, 420, 460, 546, 536, 619, 439, 675, 384, 678, 494, 603, 596, 579, 649, 495, 482, 389, 553, 554, 575, 550, 378, 465, 291, 462, 403, 498, 443, 360, 636, 670, 600, 478, 528, 615, 554, 622, 533, 375, 448, 515, 556, 538, 508, 472, 610, 600, 426, 375, 517, 415, 572, 515, 487, 410, 487, 499, 512, 646, 523, 487, 431, 669, 626, 654, 547, 522, 601, 592, 638, 351, 333, 307, 465, 502, 401, 457, 462, 559, 564, 580, 425, 470, 485, 571, 442, 481, 562, 538, 579, 581, 584, 495, 525, 540, 552, 503, 577, 546, 598, 528, 441, 341, 490, 430, 407, 488, 512, 522, 549, 438, 456, 531, 533, 553, 584, 527, 470, 522, 548, 458, 483, 561, 551, 544, 611, 540, 494, 481, 458, 428, 468, 458, 443, 512, 516, 512, 510, 507, 554, 568, 511, 502, 506, 531, 495, 562, 549, 445, 404, 438, 431, 474, 538, 490, 556, 589, 582, 517, 510, 486, 483, 505, 488, 489, 503, 543, 458, 526, 511, 537, 601, 572, 538, 475, 477, 446, 458, 483, 478, 483, 482, 510, 458, 522, 547, 520, 555, 540, 569, 494, 499, 523, 488, 480, 478, 491, 487, 530, 501, 541, 578, 548, 581, 555, 538, 493, 466, 482, 482, 495, 486, 488, 459, 452, 468, 480, 519, 523, 539, 499, 542, 504, 537, 505, 530, 531, 546, 521, 519, 507, 515, 498, 520, 535, 527, 523, 519, 522, 490, 480, 490, 480, 487, 504, 479, 488, 492, 514, 491, 521, 513, 511, 506, 537, 529, 544, 527, 536, 546, 527, 546, 523, 504, 508, 496, 509, 515, 492, 485, 504, 505, 482, 495, 489, 503, 492, 507, 489, 516, 507, 527, 518, 497, 515, 508, 535, 523, 520, 511, 526, 551, 531, 525, 508, 532, 490, 502, 482, 507, 487, 491, 483, 502, 522, 519, 543, 523, 522, 492, 507, 497, 493, 491, 501, 502, 521, 534, 537, 520, 521, 496, 517, 500, 512, 506, 525, 504, 529, 512, 516, 511, 496, 508, 487, 525, 503, 531, 506, 549, 514, 513, 498, 507, 504, 510, 504, 504, 499, 515, 501, 512, 520, 521, 528, 512, 524, 500, 512, 486, 505, 495, 508, 505, 511, 515, 523, 512, 520, 520, 513, 517, 526, 501, 521, 512, 520, 505, 502, 511, 506, 508, 511, 504, 513, 509, 500, 504, 491, 511, 491, 519, 507, 520, 511, 522, 520, 518, 529, 516, 529, 523, 518, 511, 500, 517, 492, 500, 484, 513, 502, 508, 495, 507, 518, 511, 516, 514, 519, 522, 526, 526, 510, 515, 502, 522, 522, 512, 512, 504, 511, 502, 514, 498, 510, 510, 507, 510, 505, 512, 503, 522, 525, 509, 509, 512, 521, 516, 510, 505, 512, 517, 509, 517, 515, 525, 516, 526, 518, 517, 515, 512, 520, 505, 501, 502, 512, 506, 505, 500, 502, 516, 507, 512, 512, 520, 525, 522, 518, 519, 511, 507, 513, 513, 507, 512, 511, 520, 516, 516, 514, 518, 517, 520, 519, 517, 512, 512, 514, 520, 516, 518, 516, 522, 521, 515, 519, 522, 522, 520, 519, 515, 514, 511, 508, 503, 504, 499, 500, 506, 507, 511, 517, 520, 524, 522, 522, 524, 520, 521, 510, 515, 515, 517, 509, 514, 514, 514, 515, 513, 516, 515, 511, 514, 507, 512, 509, 510, 507, 508, 511, 511, 519, 515, 511, 510, 512, 512, 508, 514, 511, 516, 516, 520, 516, 514, 516, 519, 520, 521, 515, 514, 513, 517, 513, 516, 509, 510, 509, 510, 510, 505, 501, 505, 503, 512, 510, 511, 509, 516, 517, 519, 516, 516, 516, 514, 516, 514, 511, 517, 512, 518, 514, 514, 510, 513, 518, 514, 516, 511, 511, 510, 512, 511, 509, 508, 509, 511, 506, 509, 505, 511, 508, 507, 507, 506, 510, 510, 512, 518, 516, 517, 515, 518, 515, 515, 512, 511, 520, 518, 517, 514, 513, 513, 514, 511, 513, 513, 512, 510, 511, 507, 508, 510, 502, 506, 502, 507, 507, 502, 509, 506, 511, 510, 514, 515, 520, 519, 514, 518, 518, 521, 516, 516, 516, 518, 515, 513, 510, 512, 513, 512, 509, 508, 506, 510, 511, 509, 504, 505, 507, 508, 507, 508, 510, 506, 508, 508, 507, 511, 511, 518, 515, 519, 512, 516, 516, 520, 517, 512, 515, 515, 512, 514, 509, 514, 512, 515, 505, 511, 507, 507, 508, 507, 508, 509, 508, 512, 510, 511, 509, 508, 512, 511, 511, 512, 512, 511, 514, 517, 520, 519, 517, 514, 513, 510, 510, 509, 511, 512, 512, 513, 514, 513, 510, 513, 509, 511, 509, 510, 511, 509, 509, 509, 510, 510, 512, 512, 512, 511, 509, 507, 511, 509, 510, 510, 514, 516, 514, 513, 514, 513, 515, 513, 512, 514, 514, 514, 514, 516, 511, 510, 511, 509, 508, 507, 508, 508, 509, 510, 510, 513, 511, 511, 513, 514, 514, 513, 511, 513, 514, 507, 508, 511, 510, 508, 511, 511, 507, 511, 514, 514, 513, 513, 511, 511, 511, 515, 509, 514, 513, 510, 514, 512, 515, 512, 510, 513, 511, 514, 510, 511, 512, 509, 510, 508, 511, 506, 510, 509, 511, 514, 511, 517, 513, 511, 512, 511, 510, 505, 509, 510, 511, 510, 510, 513, 513, 517, 515, 515, 518, 517, 512, 515, 511, 513, 510, 510, 507, 507, 506, 506, 507, 508, 509, 512, 513, 512, 511, 512, 510, 510, 510, 510, 510, 512, 511, 510, 514, 515, 515, 517, 518, 515, 518, 512, 512, 511, 510, 510, 507, 508, 508, 507, 510, 511, 513, 512, 511, 510, 511, 512, 510, 513, 506, 508, 510, 511, 510, 509, 512, 511, 513, 513, 511, 513, 515, 512, 511, 515, 515, 513, 514, 512, 510, 510, 508, 510, 512, 512, 512, 513, 513, 510, 510, 510, 509, 508, 510, 509, 508, 509, 508, 511, 512, 512, 508, 514, 516, 513, 512, 513, 513, 513, 513, 511, 512, 513, 510, 513, 512, 514, 510, 513, 511, 511, 508, 509, 507, 511, 509, 513, 512, 511, 510, 514, 510, 510, 508, 511, 512, 513, 512, 511, 511, 511, 509, 512, 512, 514, 512, 517, 514, 514, 513, 511, 511, 511, 514, 511, 509, 508, 508, 508, 510, 507, 509, 511, 515, 516, 512, 513, 510, 512, 513, 514, 513, 515, 517, 513, 513, 511, 511, 513, 511, 511, 509, 512, 509, 510, 510, 509, 507, 508, 509, 507, 510, 511, 511, 512, 512, 513, 515, 513, 514, 514, 514, 514, 512, 511, 512, 511, 508, 509, 511, 511, 514, 514, 514, 512, 513, 512, 512, 510, 511, 511, 510, 510, 508, 509, 509, 510, 509, 513, 512, 512, 511, 511, 512, 514, 509, 512, 512, 513, 510, 511, 511, 513, 515, 514, 514, 511, 511, 512, 512, 511, 511, 510, 511, 513, 511, 511, 512, 512, 513, 512, 513, 512, 510, 512, 511, 513, 510, 512, 512, 512, 511, 509, 508, 508, 509, 512, 511, 513, 512, 511, 513, 513, 511, 511, 513, 512, 512, 514, 511, 512, 512, 511, 510, 511, 510, 509, 510, 510, 510, 511, 512, 514, 513, 514, 514, 513, 513, 515, 513, 512, 512, 509, 511, 509, 508, 510, 507, 511, 510, 511, 510, 512, 511, 515, 516, 514, 513, 514, 513, 511, 513, 512, 512, 512, 512, 510, 510, 509, 510, 508, 509, 509, 510, 512, 513, 513, 512, 514, 510, 513, 513, 513, 512, 511, 510, 510, 510, 508, 508, 509, 512, 512, 511, 514, 512, 515, 516, 516, 514, 514, 513, 513, 511, 509, 508, 509, 511, 509, 509, 508, 507, 507, 511, 512, 513, 513, 512, 513, 514, 513, 511, 512, 512, 512, 513, 514, 511, 512, 512, 513, 512, 511, 511, 511, 511, 512, 510, 512, 509, 513, 511, 511, 513, 511, 511, 513, 512, 509, 509, 511, 509, 510, 510, 512, 511, 513, 511, 512, 513, 515, 512, 514, 516, 513, 512, 510, 508, 508, 509, 510, 511, 512, 511, 513, 511, 510, 513, 512, 514, 513, 511, 510, 511, 513, 510, 512, 511, 511, 511, 511, 513, 511, 512, 512, 511, 513, 512, 512, 510, 510, 511, 509, 513, 511, 512, 510, 512, 510, 509, 512, 511, 513, 515, 515, 513, 513, 513, 510, 511, 513, 510, 511, 512, 512, 513, 512, 511, 509, 508, 511, 510, 510, 510, 510, 513, 512, 514, 512, 513, 513, 512, 511, 508, 512, 509, 510, 510, 511, 512, 513, 512, 512, 513, 516, 512, 513, 510, 513, 512, 514, 513, 512, 510, 510, 509, 508, 508, 510, 511, 511, 509, 511, 511, 511, 510, 509, 513, 514, 513, 513, 514, 516, 512, 513, 511, 512, 512, 510, 512, 510, 512, 511, 511, 513, 511, 512, 509, 513, 511, 512, 513, 512, 511, 511, 512, 511, 510, 508, 507, 508, 509, 508, 509, 511, 514, 514, 517, 517, 515, 515, 515, 513, 510, 511, 511, 510, 512, 511, 510, 511, 511, 512, 510, 511, 509, 509, 511, 513, 513, 510, 512, 511, 511, 513, 510, 510, 510, 511, 512, 512, 512, 512, 513, 515, 513, 514, 513, 513, 513, 513, 513, 509, 510, 510, 511, 511, 509, 510, 511, 510, 511, 509, 509, 509, 509, 510, 510, 511, 509, 514, 512, 514, 514, 514, 513, 515, 513, 513, 511, 512, 510, 514, 512, 512, 513, 513, 512, 511, 510, 510, 510, 509, 508, 509, 509, 510, 509, 510, 511, 508, 510, 511, 512, 510, 512, 513, 513, 514, 513, 515, 514, 514, 512, 513, 513, 512, 513, 513, 512, 510, 512, 510, 511, 511, 511, 511, 510, 511, 510, 512, 511, 509, 511, 511, 511, 511, 510, 510, 510, 510, 510, 511, 511, 511, 511, 512, 512, 513, 513, 513, 513, 515, 515, 516, 514, 513, 514, 512, 511, 509, 510, 509, 509, 511, 508, 509, 510, 511, 509, 511, 510, 510, 511, 512, 511, 511, 512, 510, 511, 512, 512, 513, 512, 512, 513, 513, 513, 512, 513, 513, 514, 511, 512, 511, 512, 512, 510, 512, 510, 512, 511, 509, 509, 509, 511, 511, 509, 510, 510, 510, 512, 511, 512, 513, 515, 515, 514, 516, 513, 515, 514, 514, 511, 511, 509, 508, 508, 509, 509, 509, 508, 511, 510, 512, 511, 513, 514, 513, 513, 512, 511, 512, 512, 512, 511, 513, 513, 512, 512, 511, 511, 511, 512, 511, 510, 513, 511, 512, 511, 511, 511, 512, 511, 512, 511, 511, 511, 510, 510, 511, 510, 510, 511, 511, 512, 512, 512, 510, 512, 513, 514, 513, 515, 512, 515, 513, 513, 511, 510, 511, 510, 511, 510, 510, 511, 510, 511, 511, 512, 512, 511, 513, 511, 512, 510, 511, 510, 511, 510, 510, 511, 511, 511, 512, 512, 513, 513, 514, 514, 513, 512, 512, 514, 513, 512, 512, 512, 513, 511, 511, 510, 510, 510, 511, 510, 510, 511, 511, 512, 510, 510, 510, 510, 509, 509, 512, 510, 512, 512, 512, 512, 514, 513, 514, 513, 514, 513, 513, 512, 512, 512, 512, 512, 511, 511, 511, 510, 509, 510, 511, 511, 511, 512, 512, 513, 512, 511, 511, 512, 512, 511, 513, 511, 511, 510, 512, 512, 512, 511, 513, 512, 511, 510, 511, 510, 509, 511, 510, 512, 512, 510, 512, 511, 512, 512, 513, 513, 513, 513, 513, 512, 512, 512, 511, 510, 513, 510, 512, 511, 511, 511, 511, 511, 510, 511, 511, 511, 511, 510, 511, 510, 511, 510, 510, 512, 511, 512, 512, 511, 513, 512, 514, 513, 513, 513, 513, 512, 512, 512, 512, 512, 512, 512, 512, 510, 512, 512, 510, 511, 511, 510, 510, 511, 510, 511, 512, 511, 510, 510, 510, 510, 511, 512, 512, 513, 515, 515, 513, 514, 512, 511, 511, 510, 512, 511, 511, 509, 511, 510, 512, 511, 512, 513, 512, 513, 512, 511, 511, 511, 512, 510, 510, 509, 511, 510, 509, 510, 511, 511, 511, 512, 512, 513, 513, 513, 513, 513, 512, 512, 512, 511, 513, 512, 512, 511, 512, 511, 511, 510, 510, 511, 511, 512, 511, 511, 510, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 512, 511, 511, 512, 511, 511, 511, 513, 512, 513, 512, 512, 513, 513, 512, 511, 511, 511, 511, 511, 511, 511, 511, 510, 511, 511, 511, 511, 512, 512, 511, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 513, 511, 511, 512, 512, 512, 512, 512, 511, 511, 513, 512, 512, 511, 511, 513, 512, 512, 512, 512, 512, 511, 513, 512, 512, 512, 513, 512, 511, 511, 509, 510, 510, 509, 510, 510, 511, 511, 511, 512, 511, 511, 513, 513, 513, 512, 513, 513, 514, 513, 512, 512, 511, 512, 512, 510, 511, 510, 511, 510, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 510, 511, 511, 512, 512, 511, 511, 511, 512, 512, 513, 513, 512, 512, 512, 511, 511, 511, 511, 510, 510, 510, 510, 511, 510, 512, 512, 513, 512, 514, 512, 513, 513, 512, 513, 512, 513, 512, 512, 511, 510, 511, 509, 510, 509, 511, 510, 510, 511, 511, 511, 511, 512, 513, 512, 512, 512, 512, 511, 512, 511, 511, 511, 512, 511, 512, 512, 511, 512, 513, 511, 511, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 510, 512, 511, 512, 512, 512, 512, 512, 512, 510, 511, 511, 511, 511, 511, 512, 512, 513, 512, 513, 512, 513, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 511, 511, 510, 510, 510, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 512, 511, 511, 510, 511, 511, 511, 512, 512, 512, 512, 512, 512, 513, 512, 512, 511, 511, 511, 510, 510, 510, 510, 511, 511, 511, 511, 512, 513, 513, 513, 513, 513, 513, 513, 513, 511, 511, 510, 510, 511, 511, 511, 510, 511, 510, 511, 511, 511, 512, 512, 513, 512, 513, 512, 513, 512, 511, 512, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 512, 512, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 513, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 512, 510, 510, 511, 510, 511, 510, 511, 510, 511, 511, 512, 513, 512, 513, 511, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 513, 513, 511, 511, 511, 512, 511, 512, 511, 511, 510, 510, 510, 510, 510, 511, 511, 512, 511, 511, 512, 512, 511, 512, 512, 512, 512, 512, 513, 513, 512, 512, 512, 513, 512, 513, 512, 512, 512, 511, 512, 512, 511, 511, 511, 511, 509, 510, 510, 511, 510, 511, 511, 511, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 512, 513, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 510, 511, 511, 511, 511, 511, 510, 510, 511, 510, 510, 510, 511, 512, 512, 512, 513, 513, 513, 513, 513, 514, 513, 513, 512, 512, 512, 511, 511, 511, 511, 510, 510, 510, 510, 511, 510, 511, 510, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 513, 512, 512, 512, 513, 512, 512, 511, 512, 512, 511, 511, 511, 512, 512, 511, 512, 512, 511, 511, 512, 510, 511, 510, 510, 509, 509, 510, 510, 511, 510, 511, 512, 513, 513, 513, 514, 514, 513, 513, 513, 512, 513, 512, 512, 511, 511, 510, 510, 511, 511, 510, 511, 511, 511, 511, 511, 510, 511, 510, 511, 511, 512, 511, 512, 511, 511, 511, 512, 513, 512, 512, 513, 513, 513, 512, 512, 511, 512, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 510, 510, 511, 510, 511, 510, 511, 510, 511, 511, 512, 511, 513, 512, 512, 512, 513, 512, 513, 512, 513, 511, 513, 513, 513, 513, 512, 512, 511, 511, 511, 511, 511, 511, 511, 510, 511, 509, 510, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 513, 512, 513, 512, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 512, 511, 511, 511, 510, 511, 511, 511, 510, 511, 511, 511, 511, 511, 512, 512, 513, 513, 513, 513, 513, 513, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 511, 511, 510, 511, 510, 511, 511, 511, 511, 512, 511, 512, 512, 512, 513, 513, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 511, 511, 511, 511, 512, 511, 511, 512, 512, 512, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 513, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 510, 511, 511, 511, 511, 512, 511, 511, 512, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 511, 512, 512, 511, 512, 512, 512, 511, 512, 512, 512, 512, 511, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 511, 512, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 513, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 510, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 512, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 510, 511, 511, 511, 511, 512, 512, 511, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 511, 512, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 512, 511, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 512, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 512, 512, 512, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 512, 511, 512, 511, 512, 512, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 511, 511, 511, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512, 511, 512};
\ No newline at end of file
+const uint8_t hi_hat_adpcm[] = {
+240, 242, 243, 195, 179, 196, 179, 179, 196, 179, 179, 196, 179, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 243, 197, 179, 180, 195, 179, 180, 195,
+179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 181, 211, 163, 195, 196, 146, 178, 178,
+167, 2, 201, 166, 178, 121, 199, 1, 13, 0, 40, 143, 165, 179, 8, 146, 210, 177, 7, 168, 243, 147, 24, 40, 89, 156, 130, 61, 27, 104, 74, 11,
+75, 45, 144, 88, 42, 58, 28, 176, 163, 18, 243, 144, 130, 145, 153, 167, 212, 24, 128, 152, 92, 137, 19, 138, 213, 163, 0, 129, 41, 169, 152, 179,
+134, 200, 41, 145, 40, 137, 18, 49, 151, 163, 248, 210, 0, 2, 47, 24, 10, 168, 179, 134, 41, 41, 12, 49, 75, 153, 8, 13, 151, 160, 137, 2,
+27, 16, 181, 25, 1, 226, 196, 163, 1, 24, 139, 90, 8, 200, 177, 148, 146, 122, 145, 26, 145, 161, 28, 18, 137, 105, 216, 40, 74, 137, 25, 0,
+181, 168, 7, 152, 24, 24, 143, 40, 160, 1, 2, 208, 0, 195, 48, 25, 0, 29, 0, 58, 57, 220, 107, 137, 2, 0, 12, 2, 17, 187, 19, 31,
+130, 48, 172, 152, 58, 137, 6, 136, 48, 209, 136, 178, 134, 158, 129, 34, 74, 129, 139, 138, 146, 40, 245, 130, 49, 169, 13, 9, 129, 128, 227, 20,
+25, 24, 13, 161, 9, 0, 164, 67, 42, 170, 173, 1, 145, 208, 24, 82, 16, 76, 59, 43, 16, 139, 42, 76, 146, 137, 240, 25, 25, 194, 1, 180,
+132, 152, 150, 162, 17, 59, 188, 161, 18, 142, 2, 44, 41, 58, 108, 41, 184, 146, 150, 152, 66, 154, 74, 31, 42, 9, 41, 131, 180, 208, 145, 136,
+130, 36, 176, 232, 179, 130, 195, 164, 128, 43, 109, 58, 90, 11, 26, 24, 137, 56, 59, 1, 210, 226, 193, 163, 130, 17, 177, 131, 26, 244, 146, 177,
+57, 26, 160, 148, 28, 108, 91, 25, 41, 136, 178, 147, 170, 108, 29, 74, 9, 41, 145, 129, 1, 1, 31, 91, 152, 152, 145, 211, 2, 25, 42, 122,
+176, 0, 146, 154, 34, 75, 89, 75, 138, 152, 243, 9, 163, 152, 96, 26, 32, 146, 10, 156, 131, 59, 121, 9, 41, 24, 152, 12, 65, 26, 89, 200,
+18, 144, 185, 169, 204, 192, 80, 32, 20, 146, 16, 28, 15, 0, 43, 128, 144, 147, 44, 46, 9, 26, 130, 151, 153, 1, 91, 41, 48, 171, 50, 17,
+159, 57, 59, 143, 24, 200, 58, 122, 8, 56, 16, 10, 152, 162, 108, 58, 138, 43, 166, 193, 144, 146, 153, 33, 46, 91, 138, 144, 132, 81, 8, 41,
+11, 155, 23, 153, 9, 176, 2, 185, 241, 32, 31, 58, 184, 149, 147, 3, 132, 60, 40, 12, 24, 170, 43, 145, 157, 106, 144, 13, 17, 25, 210, 1,
+73, 96, 41, 28, 32, 201, 1, 26, 60, 57, 31, 138, 145, 1, 72, 26, 138, 132, 24, 160, 53, 148, 186, 217, 144, 18, 16, 162, 63, 28, 26, 161,
+8, 1, 132, 160, 189, 151, 0, 36, 154, 145, 179, 74, 128, 64, 159, 160, 152, 129, 33, 120, 10, 18, 160, 75, 241, 58, 169, 4, 61, 2, 9, 11,
+120, 60, 169, 148, 178, 57, 58, 13, 177, 177, 228, 147, 34, 123, 138, 144, 200, 3, 128, 56, 96, 137, 147, 46, 27, 10, 139, 9, 17, 98, 145, 25,
+139, 128, 80, 154, 39, 40, 193, 243, 136, 9, 27, 144, 4, 147, 154, 18, 92, 15, 1, 152, 147, 2, 59, 211, 105, 152, 144, 138, 42, 132, 16, 232,
+128, 153, 147, 42, 122, 1, 94, 161, 8, 128, 160, 17, 61, 41, 61, 138, 27, 123, 57, 137, 89, 139, 74, 16, 153, 128, 91, 32, 122, 10, 168, 8,
+180, 155, 128, 212, 34, 5, 11, 59, 32, 74, 243, 152, 16, 10, 91, 27, 152, 26, 177, 22, 40, 40, 195, 130, 128, 173, 162, 31, 130, 133, 160, 161,
+192, 1, 137, 28, 32, 123, 0, 137, 50, 31, 0, 28, 32, 147, 232, 24, 144, 152, 81, 11, 1, 161, 179, 63, 57, 46, 128, 185, 10, 114, 57, 154,
+3, 12, 163, 80, 29, 152, 25, 169, 2, 56, 115, 25, 160, 104, 155, 232, 162, 57, 77, 8, 57, 105, 144, 25, 185, 147, 128, 200, 168, 227, 1, 65,
+1, 90, 46, 128, 137, 137, 184, 16, 7, 73, 74, 0, 138, 137, 203, 25, 180, 152, 138, 55, 129, 41, 161, 28, 128, 51, 143, 32, 170, 8, 56, 63,
+93, 10, 162, 56, 217, 56, 27, 48, 90, 27, 66, 45, 194, 169, 138, 18, 34, 107, 155, 149, 147, 156, 50, 46, 9, 8, 195, 1, 74, 137, 139, 210,
+151, 144, 161, 89, 41, 2, 11, 232, 33, 28, 129, 145, 186, 122, 9, 8, 149, 162, 1, 170, 94, 10, 0, 17, 137, 98, 12, 75, 41, 153, 138, 169,
+64, 130, 60, 128, 170, 55, 9, 65, 14, 9, 176, 179, 147, 88, 27, 94, 9, 128, 9, 161, 185, 42, 162, 114, 4, 132, 10, 184, 30, 136, 146, 25,
+40, 28, 12, 83, 200, 146, 72, 140, 16, 1, 136, 83, 27, 10, 8, 248, 137, 130, 28, 162, 227, 8, 40, 32, 126, 24, 8, 41, 10, 28, 106, 137,
+129, 153, 137, 160, 42, 48, 60, 243, 33, 193, 35, 32, 107, 137, 27, 160, 2, 236, 179, 130, 128, 59, 123, 201, 3, 8, 138, 128, 48, 128, 96, 72,
+8, 120, 32, 172, 194, 202, 162, 64, 30, 1, 58, 10, 34, 11, 243, 17, 32, 138, 131, 192, 131, 244, 144, 1, 60, 60, 201, 128, 132, 43, 8, 148,
+34, 133, 73, 45, 137, 140, 155, 16, 128, 122, 56, 74, 145, 168, 41, 8, 123, 152, 152, 136, 179, 123, 41, 138, 32, 75, 139, 192, 48, 12, 3, 132,
+240, 35, 162, 229, 163, 176, 25, 42, 10, 178, 132, 3, 124, 27, 43, 42, 11, 131, 64, 48, 80, 184, 12, 151, 10, 40, 141, 137, 32, 11, 3, 244,
+8, 152, 120, 58, 8, 72, 25, 41, 11, 11, 8, 200, 8, 189, 67, 128, 132, 180, 11, 3, 125, 11, 74, 128, 90, 169, 25, 185, 150, 131, 60, 41,
+40, 128, 0, 140, 192, 123, 59, 137, 128, 176, 3, 136, 77, 59, 139, 151, 2, 107, 57, 10, 128, 11, 8, 8, 8, 63, 248, 1, 10, 178, 51, 203,
+128, 88, 131, 115, 192, 194, 137, 73, 137, 60, 73, 42, 162, 178, 138, 48, 143, 90, 154, 18, 0, 2, 3, 8, 232, 128, 124, 137, 25, 10, 138, 3,
+195, 192, 3, 3, 8, 14, 8, 196, 48, 12, 120, 25, 137, 2, 187, 128, 128, 128, 240, 3, 136, 5, 60, 184, 8, 8, 128, 120, 11, 4, 136, 208,
+120, 9, 138, 150, 8, 136, 106, 137, 16, 170, 224, 1, 42, 32, 8, 179, 120, 129, 58, 56, 219, 176, 3, 31, 42, 59, 128, 128, 80, 60, 128, 208,
+128, 128, 60, 64, 192, 8, 132, 132, 11, 200, 8, 200, 8, 104, 123, 40, 74, 27, 160, 162, 195, 176, 75, 30, 73, 10, 1, 128, 51, 12, 8, 60,
+139, 64, 60, 192, 67, 142, 32, 8, 184, 128, 128, 128, 126, 25, 128, 128, 216, 1, 128, 72, 56, 59, 60, 139, 208, 3, 8, 8, 14, 12, 56, 0,
+8, 8, 135, 128, 0, 136, 142, 180, 192, 131, 64, 128, 128, 96, 139, 12, 200, 128, 64, 128, 64, 4, 136, 0, 136, 175, 139, 132, 192, 179, 132, 48,
+80, 59, 60, 203, 179, 8, 8, 120, 59, 75, 139, 64, 8, 140, 64, 139, 64, 60, 128, 0, 197, 128, 128, 128, 0, 143, 228, 16, 42, 58, 59, 72,
+178, 228, 1, 8, 8, 11, 8, 88, 8, 8, 133, 15, 40, 42, 11, 139, 128, 80, 48, 12, 3, 61, 128, 128, 134, 11, 88, 59, 139, 208, 3, 140,
+128, 31, 56, 59, 8, 132, 192, 3, 8, 8, 120, 11, 8, 8, 232, 128, 128, 61, 128, 128, 13, 195, 128, 68, 8, 3, 8, 104, 139, 12, 184, 8,
+232, 128, 64, 60, 59, 128, 128, 96, 128, 64, 139, 104, 11, 60, 184, 128, 133, 75, 184, 72, 31, 137, 10, 2, 179, 83, 131, 72, 192, 128, 75, 139,
+12, 12, 131, 60, 0, 136, 77, 59, 72, 75, 139, 64, 195, 48, 8, 140, 75, 8, 200, 195, 128, 128, 224, 48, 60, 59, 76, 56, 123, 137, 32, 42,
+75, 62, 128, 176, 176, 128, 128, 128, 62, 31, 130, 128, 128, 3, 8, 128, 8, 63, 59, 124, 25, 137, 128, 128, 59, 12, 72, 139, 208, 3, 200, 3,
+128, 80, 64, 8, 128, 224, 59, 60, 11, 136, 0, 136, 112, 75, 75, 8, 140, 75, 59, 128, 80, 60, 128, 132, 11, 216, 128, 128, 128, 128, 120, 0,
+8, 8, 63, 59, 60, 75, 139, 128, 128, 120, 128, 59, 128, 128, 240, 3, 200, 8, 88, 139, 4, 200, 128, 4, 8, 136, 0, 143, 0, 136, 128, 128,
+7, 60, 59, 75, 60, 128, 8, 13, 8, 8, 133, 0, 61, 8, 60, 12, 8, 8, 8, 8, 120, 0, 128, 128, 8, 63, 60, 60, 75, 139, 64, 139,
+128, 128, 128, 128, 128, 39, 8, 112, 139, 12, 8, 8, 8, 135, 128, 76, 8, 60, 59, 12, 8, 8, 8, 120, 128, 128, 128, 240, 8, 128, 60, 128,
+80, 139, 180, 72, 75, 8, 8, 8, 14, 136, 0, 136, 0, 136, 128, 128, 55, 63, 75, 59, 8, 128, 8, 63, 59, 12, 8, 8, 120, 11, 8, 88,
+8, 12, 8, 88, 8, 200, 3, 60, 128, 60, 0, 232, 48, 12, 8, 8, 8, 136, 0, 8, 120, 123, 8, 8, 8, 141, 64, 59, 76, 59, 139, 8,
+8, 8, 120, 75, 139, 133, 75, 8, 8, 8, 8, 120, 31, 9, 8, 8, 136, 0, 136, 0, 63, 72, 8, 8, 8, 136, 0, 136, 63, 61, 11, 136,
+0, 136, 0, 8, 120, 131, 143, 128, 0, 104, 8, 8, 8, 128, 63, 139, 88, 59, 139, 128, 128, 8, 128, 112, 107, 59, 60, 75, 59, 128, 13, 8,
+88, 139, 64, 59, 0, 62, 139, 128, 133, 75, 59, 12, 72, 11, 72, 139, 80, 59, 128, 8, 128, 143, 128, 76, 8, 72, 184, 132, 128, 76, 59, 139,
+128, 128, 128, 128, 128, 120, 131, 128, 8, 159, 104, 139, 128, 128, 128, 128, 7, 76, 8, 8, 8, 136, 240, 8, 128, 104, 59, 75, 139, 128, 128, 8,
+128, 8, 8, 8, 120, 133, 128, 128, 128, 0, 8, 8, 239, 128, 128, 128, 128, 128, 128, 112, 4, 8, 128, 128, 128, 128, 8, 63, 128, 63, 143, 0,
+136, 0, 136, 0, 8, 120, 11, 8, 120, 1, 136, 0, 136, 128, 128, 191, 8, 128, 128, 128, 128, 120, 6, 8, 8, 8, 63, 232, 128, 128, 128, 128,
+128, 8, 120, 2, 136, 0, 63, 13, 8, 136, 96, 59, 128, 128, 128, 128, 63, 60, 60, 11, 8, 136, 0, 136, 112, 1, 8, 128, 8, 159, 197, 128,
+128, 80, 139, 64, 12, 8, 88, 59, 75, 59, 8, 128, 62, 59, 0, 8, 136, 143, 128, 128, 128, 128, 8, 8, 120, 123, 128, 128, 128, 8, 63, 139,
+64, 12, 8, 88, 59, 75, 12, 8, 8, 8, 8, 112, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75, 59, 12, 8, 196, 3, 8, 61, 59, 12,
+8, 8, 8, 8, 120, 75, 75, 59, 60, 75, 59, 60, 128, 60, 0, 216, 8, 8, 8, 8, 8, 8, 112, 107, 75, 139, 128, 80, 60, 59, 0, 8,
+8, 8, 8, 136, 63, 15, 8, 8, 8, 8, 8, 8, 120, 2, 136, 0, 8, 63, 62, 59, 76, 8, 60, 139, 128, 128, 128, 128, 128, 128, 112, 3,
+8, 8, 8, 8, 136, 63, 128, 175, 8, 136, 128, 128, 128, 0, 120, 139, 112, 123, 59, 75, 8, 8, 8, 8, 63, 60, 59, 12, 8, 8, 8, 8,
+120, 11, 8, 120, 11, 72, 59, 0, 8, 136, 0, 63, 61, 139, 128, 128, 128, 112, 75, 59, 76, 8, 60, 59, 139, 104, 59, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 128, 60, 75, 60, 59, 75, 139, 8, 8, 8, 120, 75, 75, 8, 8, 8, 8, 63, 59, 12, 8, 88, 75, 59, 60,
+139, 128, 128, 128, 0, 120, 91, 128, 60, 75, 59, 12, 72, 75, 139, 64, 12, 72, 59, 59, 76, 59, 59, 76, 59, 59, 76, 59, 59, 60, 75, 139,
+8, 104, 59, 75, 59, 12, 8, 88, 75, 59, 60, 75, 59, 60, 75, 59, 8, 61, 75, 59, 60, 139, 128, 0, 136, 112, 75, 75, 8, 60, 60, 59,
+139, 128, 96, 139, 64, 60, 75, 59, 60, 75, 59, 60, 75, 139, 128, 128, 128, 112, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 139, 128, 128, 96, 59, 76, 59, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 128, 128, 128, 8, 8, 8, 120,
+123, 75, 128, 128, 128, 128, 63, 60, 139, 0, 136, 112, 59, 75, 60, 59, 75, 139, 88, 59, 75, 60, 59, 75, 59, 128, 128, 62, 75, 60, 11, 136,
+128, 96, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75, 59, 60, 75, 59,
+60, 139, 80, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 128, 60, 75, 12, 8, 88, 59, 75, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+12, 8, 88, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 12
+};
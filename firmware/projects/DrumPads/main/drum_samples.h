@@ -2,19 +2,23 @@
 #ifndef DRUM_SAMPLES_H
 #define DRUM_SAMPLES_H
 
-#include <stdint.h> // Para que reconozca el tipo int16_t
+#include <stdint.h> // Para que reconozca el tipo uint8_t
 
 /* * Declaramos los arrays y sus tamaños como "extern".
  * Esto le dice al compilador: "Estas variables existen,
  * pero su definición está en otro archivo .c".
+ *
+ * Las muestras están comprimidas en IMA-ADPCM (4 bits por muestra, ver adpcm.h)
+ * a partir de PCM de 16 bits con signo a 8 kHz. Los tamaños son en muestras
+ * (el array tiene ADPCM_BYTES(tamaño) bytes). Se generan con wav_to_adpcm.py.
  */
 
 // Sample para el PAD A (Snare)
 extern const int snare_drum_size;
-extern const int16_t snare_drum_sample[];
+extern const uint8_t snare_drum_adpcm[];
 
 // Sample para el PAD B (Hi-Hat)
 extern const int hi_hat_size;
-extern const int16_t hi_hat_sample[];
+extern const uint8_t hi_hat_adpcm[];
 
 #endif // DRUM_SAMPLES_H
\ No newline at end of file
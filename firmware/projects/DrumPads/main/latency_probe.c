@@ -0,0 +1,82 @@
+/* latency_probe.c */
+#include <stdio.h>
+#include <string.h>
+#include "latency_probe.h"
+#include "uart_mcu.h"
+
+/** Estadística de una etapa */
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+    uint16_t hist[LATENCY_BINS];
+} latency_stat_t;
+
+/** Nombres de las etapas (para el reporte) */
+static const char *stage_name[LATENCY_STAGES] = {"detect", "schedule", "output", "total"};
+
+static latency_stat_t stats[LATENCY_STAGES];
+
+/** Agrega una medición a una etapa */
+static void LatencyStatAdd(latency_stat_t *stat, uint64_t us) {
+    uint32_t v = (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+    uint32_t bin = v / LATENCY_BIN_US;
+    if (stat->count == 0 || v < stat->min) {
+        stat->min = v;
+    }
+    if (v > stat->max) {
+        stat->max = v;
+    }
+    stat->sum += v;
+    stat->count++;
+    // el histograma satura en lugar de desbordar
+    bin = (bin < LATENCY_BINS) ? bin : LATENCY_BINS - 1;
+    if (stat->hist[bin] < UINT16_MAX) {
+        stat->hist[bin]++;
+    }
+}
+
+/** Percentil 99 (límite superior del intervalo del histograma que lo contiene) */
+static uint32_t LatencyStatP99(const latency_stat_t *stat) {
+    uint32_t target = stat->count - stat->count / 100;
+    uint32_t acc = 0;
+    for (uint32_t bin = 0; bin < LATENCY_BINS; bin++) {
+        acc += stat->hist[bin];
+        if (acc >= target) {
+            uint32_t p99 = (bin + 1) * LATENCY_BIN_US;
+            return (p99 < stat->max) ? p99 : stat->max;
+        }
+    }
+    return stat->max;
+}
+
+void LatencyProbeReset(void) {
+    memset(stats, 0, sizeof(stats));
+}
+
+void LatencyProbeAdd(uint64_t t_onset, uint64_t t_notify, uint64_t t_voice, uint64_t t_dac) {
+    LatencyStatAdd(&stats[LATENCY_DETECT], t_notify - t_onset);
+    LatencyStatAdd(&stats[LATENCY_SCHEDULE], t_voice - t_notify);
+    LatencyStatAdd(&stats[LATENCY_OUTPUT], t_dac - t_voice);
+    LatencyStatAdd(&stats[LATENCY_TOTAL], t_dac - t_onset);
+}
+
+void LatencyProbeReport(void) {
+    char buffer[80];
+    // copia: las mediciones siguen llegando mientras se envía el reporte
+    static latency_stat_t snapshot[LATENCY_STAGES];
+    memcpy(snapshot, stats, sizeof(stats));
+    sprintf(buffer, "Latencia (us), %lu golpes\r\n", (unsigned long)snapshot[LATENCY_TOTAL].count);
+    UartSendString(UART_PC, buffer);
+    UartSendString(UART_PC, "etapa     min     avg     max     p99\r\n");
+    for (uint8_t i = 0; i < LATENCY_STAGES; i++) {
+        const latency_stat_t *s = &snapshot[i];
+        if (s->count == 0) {
+            continue;
+        }
+        sprintf(buffer, "%-8s %6lu  %6lu  %6lu  %6lu\r\n", stage_name[i], (unsigned long)s->min,
+                (unsigned long)(s->sum / s->count), (unsigned long)s->max, (unsigned long)LatencyStatP99(s));
+        UartSendString(UART_PC, buffer);
+    }
+}
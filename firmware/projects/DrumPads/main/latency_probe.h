@@ -0,0 +1,45 @@
+/* latency_probe.h */
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <stdint.h>
+
+/*
+ * Medición de la latencia golpe -> sonido, separada en etapas:
+ *
+ * - LATENCY_DETECT: cruce del umbral en el ADC -> notificación a PlaySoundTask
+ *   (bloque del ADC + ventana de búsqueda del pico + procesamiento).
+ * - LATENCY_SCHEDULE: notificación -> el sonido se asigna a una voz del mezclador.
+ * - LATENCY_OUTPUT: voz asignada -> primera muestra del sonido en el DAC (muestras
+ *   ya cargadas en la salida de audio, que el timer envía a SAMPLE_RATE).
+ * - LATENCY_TOTAL: cruce del umbral -> primera muestra en el DAC.
+ *
+ * Cada etapa guarda mínimo, máximo, promedio y un histograma (de LATENCY_BIN_US)
+ * del que se obtiene el percentil 99.
+ */
+
+/** Resolución del histograma (us) */
+#define LATENCY_BIN_US      100
+
+/** Intervalos del histograma (el último acumula las latencias mayores) */
+#define LATENCY_BINS        256
+
+/** Etapas medidas */
+typedef enum {
+    LATENCY_DETECT,
+    LATENCY_SCHEDULE,
+    LATENCY_OUTPUT,
+    LATENCY_TOTAL,
+    LATENCY_STAGES
+} latency_stage_t;
+
+/** Borra las mediciones */
+void LatencyProbeReset(void);
+
+/** Agrega la medición de un golpe a partir de sus instantes (us desde el arranque) */
+void LatencyProbeAdd(uint64_t t_onset, uint64_t t_notify, uint64_t t_voice, uint64_t t_dac);
+
+/** Envía por UART_PC una tabla con min/avg/max/p99 (en us) de cada etapa */
+void LatencyProbeReport(void);
+
+#endif // LATENCY_PROBE_H
@@ -0,0 +1,133 @@
+/* perf_budget.c */
+#include <stdio.h>
+#include "perf_budget.h"
+#include "metrics_mcu.h"
+#include "time_mcu.h"
+#include "uart_mcu.h"
+
+/** Nombres de las etapas (para el reporte) */
+static const char *stage_name[PERF_STAGES] = {"adquisicion", "deteccion", "mezcla", "salida", "led", "telemetria"};
+
+/** Ciclos acumulados de cada etapa (en el registro de métricas) */
+METRIC_COUNTER_DEFINE(metric_acquisition, "cycles_acq");
+METRIC_COUNTER_DEFINE(metric_detection, "cycles_detect");
+METRIC_COUNTER_DEFINE(metric_mixing, "cycles_mix");
+METRIC_COUNTER_DEFINE(metric_output, "cycles_output");
+METRIC_COUNTER_DEFINE(metric_led, "cycles_led");
+METRIC_COUNTER_DEFINE(metric_telemetry, "cycles_telemetry");
+
+static metric_t *stage_metric[PERF_STAGES] = {
+    &metric_acquisition, &metric_detection, &metric_mixing, &metric_output, &metric_led, &metric_telemetry
+};
+
+static perf_config_t config;
+
+/** Contadores e instante del reporte anterior (inicio de la ventana medida) */
+static uint32_t window_cycles[PERF_STAGES];
+static uint64_t window_start;
+
+/** Ciclos por segundo estimados de cada etapa */
+static void PerfBudgetEstimate(uint64_t estimate[PERF_STAGES]) {
+    estimate[PERF_ACQUISITION] = PERF_ESTIMATE_ACQUISITION(config.pads, config.adc_frec);
+    estimate[PERF_DETECTION] = PERF_ESTIMATE_DETECTION(config.pads, config.adc_frec);
+    estimate[PERF_MIXING] = PERF_ESTIMATE_MIXING(config.voices, config.sample_rate);
+    estimate[PERF_OUTPUT] = PERF_ESTIMATE_OUTPUT(config.sample_rate, config.output_isr);
+    estimate[PERF_LED] = PERF_ESTIMATE_LED(config.frame_rate);
+    estimate[PERF_TELEMETRY] = PERF_ESTIMATE_TELEMETRY(config.hit_rate);
+}
+
+/** Porcentaje del CPU */
+static uint32_t PerfBudgetPercent(uint64_t cycles) {
+    return cycles * 100 / config.cpu_hz;
+}
+
+/** Envía la configuración y el presupuesto */
+static void PerfBudgetHeader(void) {
+    char buffer[96];
+    sprintf(buffer, "CPU %lu MHz, presupuesto %u%%: %u PADs a %lu Hz, audio a %lu Hz, %u voces\r\n",
+            (unsigned long)(config.cpu_hz / 1000000), config.budget, config.pads,
+            (unsigned long)config.adc_frec, (unsigned long)config.sample_rate, config.voices);
+    UartSendString(UART_PC, buffer);
+}
+
+void PerfBudgetInit(const perf_config_t *cfg) {
+    config = *cfg;
+    for (uint8_t i = 0; i < PERF_STAGES; i++) {
+        MetricsRegister(stage_metric[i]);
+    }
+    window_start = TimeNowUs();
+}
+
+uint32_t PerfBudgetAdd(perf_stage_t stage, uint32_t start) {
+    uint32_t now = PerfBudgetNow();
+    MetricsCount(stage_metric[stage], now - start);
+    return now;
+}
+
+bool PerfBudgetCheck(void) {
+    char buffer[80];
+    uint64_t estimate[PERF_STAGES];
+    uint64_t total = 0;
+    PerfBudgetEstimate(estimate);
+    for (uint8_t i = 0; i < PERF_STAGES; i++) {
+        total += estimate[i];
+    }
+    if (PerfBudgetPercent(total) <= config.budget) {
+        return true;
+    }
+    sprintf(buffer, "AVISO: el kit necesita el %lu%% del CPU (estimado)\r\n", (unsigned long)PerfBudgetPercent(total));
+    UartSendString(UART_PC, buffer);
+    PerfBudgetHeader();
+    UartSendString(UART_PC, "etapa        kciclos/s  %CPU\r\n");
+    for (uint8_t i = 0; i < PERF_STAGES; i++) {
+        sprintf(buffer, "%-12s %9lu  %4lu\r\n", stage_name[i], (unsigned long)(estimate[i] / 1000),
+                (unsigned long)PerfBudgetPercent(estimate[i]));
+        UartSendString(UART_PC, buffer);
+    }
+    return false;
+}
+
+void PerfBudgetReport(void) {
+    char buffer[80];
+    uint64_t estimate[PERF_STAGES];
+    uint64_t measured[PERF_STAGES];
+    uint64_t total_estimate = 0;
+    uint64_t total_measured = 0;
+    uint64_t now = TimeNowUs();
+    uint64_t window = now - window_start;
+    // antes de PerfBudgetInit (la UART recibe comandos desde su inicialización)
+    if (config.cpu_hz == 0) {
+        return;
+    }
+    PerfBudgetEstimate(estimate);
+    // ciclos/s de la ventana; el reporte siguiente mide desde aquí
+    for (uint8_t i = 0; i < PERF_STAGES; i++) {
+        uint32_t cycles = __atomic_load_n(&stage_metric[i]->values[0], __ATOMIC_RELAXED);
+        measured[i] = (window > 0) ? (uint64_t)(cycles - window_cycles[i]) * 1000000 / window : 0;
+        window_cycles[i] = cycles;
+        total_estimate += estimate[i];
+        total_measured += measured[i];
+    }
+    window_start = now;
+    PerfBudgetHeader();
+    sprintf(buffer, "kciclos/s, medido en %lu ms\r\n", (unsigned long)(window / 1000));
+    UartSendString(UART_PC, buffer);
+    // un contador de 32 bits da la vuelta si su etapa usa 2^32 ciclos en la ventana
+    if (window > (uint64_t)UINT32_MAX * 1000000 / config.cpu_hz) {
+        UartSendString(UART_PC, "ventana muy larga: el medido puede estar truncado, pedir el reporte de nuevo\r\n");
+    }
+    UartSendString(UART_PC, "etapa         medido  %CPU  estimado  %CPU\r\n");
+    for (uint8_t i = 0; i < PERF_STAGES; i++) {
+        sprintf(buffer, "%-12s %7lu  %4lu   %7lu  %4lu\r\n", stage_name[i], (unsigned long)(measured[i] / 1000),
+                (unsigned long)PerfBudgetPercent(measured[i]), (unsigned long)(estimate[i] / 1000),
+                (unsigned long)PerfBudgetPercent(estimate[i]));
+        UartSendString(UART_PC, buffer);
+    }
+    sprintf(buffer, "%-12s %7lu  %4lu   %7lu  %4lu\r\n", "total", (unsigned long)(total_measured / 1000),
+            (unsigned long)PerfBudgetPercent(total_measured), (unsigned long)(total_estimate / 1000),
+            (unsigned long)PerfBudgetPercent(total_estimate));
+    UartSendString(UART_PC, buffer);
+    if (PerfBudgetPercent(total_measured) > config.budget || PerfBudgetPercent(total_estimate) > config.budget) {
+        UartSendString(UART_PC, "AVISO: fuera del presupuesto\r\n");
+    }
+}
@@ -0,0 +1,131 @@
+/* perf_budget.h */
+#ifndef PERF_BUDGET_H
+#define PERF_BUDGET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_cpu.h"
+
+/*
+ * Presupuesto de CPU del kit, por etapas:
+ *
+ * - PERF_ACQUISITION: bloque del ADC a mV y pasa altos (por muestra de cada PAD).
+ * - PERF_DETECTION: detector de golpes, ruido de fondo, cross-talk y notificaciones.
+ * - PERF_MIXING: mezclador (por muestra de audio de cada voz, más el master).
+ * - PERF_OUTPUT: carga de las muestras en la salida de audio y, con el DAC, la
+ *   interrupción del timer de cada muestra.
+ * - PERF_LED: destellos del LED y sus cuadros (tarea de esp_timer).
+ * - PERF_TELEMETRY: envío de los golpes (UART, MIDI, BLE) y codificación del modo osciloscopio.
+ *
+ * Estimado: con el costo por unidad de cada etapa (PERF_CYCLES_*, ciclos del
+ * ESP32-C6 sin FPU) y las frecuencias de la configuración. PERF_ESTIMATE es una
+ * expresión constante, así la aplicación puede rechazar en compilación una
+ * configuración que no entra en el CPU.
+ *
+ * Medido: la aplicación encierra cada etapa entre PerfBudgetNow y PerfBudgetAdd
+ * (contador de ciclos del CPU, tiempo de pared: incluye las interrupciones).
+ * Los ciclos de cada etapa se acumulan en un contador del registro de métricas
+ * (metrics_mcu.h), que también va en sus instantáneas. La interrupción de la
+ * salida y los cuadros del LED corren fuera de la aplicación: sólo se estiman.
+ *
+ * Los PERF_CYCLES_* se ajustan comparando el medido con el estimado del reporte.
+ */
+
+/** Ciclos por muestra de cada PAD: tabla de calibración y pasa altos de orden 2 */
+#ifndef PERF_CYCLES_ACQUISITION
+#define PERF_CYCLES_ACQUISITION     600
+#endif
+
+/** Ciclos por muestra de cada PAD: detector de golpes y ruido de fondo */
+#ifndef PERF_CYCLES_DETECTION
+#define PERF_CYCLES_DETECTION       350
+#endif
+
+/** Ciclos por muestra de audio de cada voz del mezclador */
+#ifndef PERF_CYCLES_MIXING
+#define PERF_CYCLES_MIXING          150
+#endif
+
+/** Ciclos por muestra de audio del master (ganancia y limitador) */
+#ifndef PERF_CYCLES_MASTER
+#define PERF_CYCLES_MASTER          80
+#endif
+
+/** Ciclos por muestra de audio cargada en la salida */
+#ifndef PERF_CYCLES_OUTPUT
+#define PERF_CYCLES_OUTPUT          40
+#endif
+
+/** Ciclos por muestra de audio de la interrupción del timer del DAC */
+#ifndef PERF_CYCLES_OUTPUT_ISR
+#define PERF_CYCLES_OUTPUT_ISR      400
+#endif
+
+/** Ciclos por cuadro del LED */
+#ifndef PERF_CYCLES_LED
+#define PERF_CYCLES_LED             20000
+#endif
+
+/** Ciclos por golpe enviado */
+#ifndef PERF_CYCLES_TELEMETRY
+#define PERF_CYCLES_TELEMETRY       4000
+#endif
+
+/** Ciclos por segundo estimados de cada etapa */
+#define PERF_ESTIMATE_ACQUISITION(pads, adc_frec)   ((uint64_t)(pads) * (adc_frec) * PERF_CYCLES_ACQUISITION)
+#define PERF_ESTIMATE_DETECTION(pads, adc_frec)     ((uint64_t)(pads) * (adc_frec) * PERF_CYCLES_DETECTION)
+#define PERF_ESTIMATE_MIXING(voices, sample_rate)   \
+    ((uint64_t)(sample_rate) * ((voices) * PERF_CYCLES_MIXING + PERF_CYCLES_MASTER))
+#define PERF_ESTIMATE_OUTPUT(sample_rate, isr)      \
+    ((uint64_t)(sample_rate) * (PERF_CYCLES_OUTPUT + ((isr) ? PERF_CYCLES_OUTPUT_ISR : 0)))
+#define PERF_ESTIMATE_LED(frame_rate)               ((uint64_t)(frame_rate) * PERF_CYCLES_LED)
+#define PERF_ESTIMATE_TELEMETRY(hit_rate)           ((uint64_t)(hit_rate) * PERF_CYCLES_TELEMETRY)
+
+/** Ciclos por segundo estimados del kit (expresión constante si los argumentos lo son) */
+#define PERF_ESTIMATE(pads, adc_frec, sample_rate, voices, isr, frame_rate, hit_rate)  \
+    (PERF_ESTIMATE_ACQUISITION(pads, adc_frec) + PERF_ESTIMATE_DETECTION(pads, adc_frec) +  \
+     PERF_ESTIMATE_MIXING(voices, sample_rate) + PERF_ESTIMATE_OUTPUT(sample_rate, isr) +    \
+     PERF_ESTIMATE_LED(frame_rate) + PERF_ESTIMATE_TELEMETRY(hit_rate))
+
+/** Etapas */
+typedef enum {
+    PERF_ACQUISITION,
+    PERF_DETECTION,
+    PERF_MIXING,
+    PERF_OUTPUT,
+    PERF_LED,
+    PERF_TELEMETRY,
+    PERF_STAGES
+} perf_stage_t;
+
+/** Configuración del kit */
+typedef struct {
+    uint32_t cpu_hz;            /*!< Frecuencia del CPU (Hz) */
+    uint8_t budget;             /*!< Presupuesto (% del CPU, el resto queda para el BLE, la UART, ...) */
+    uint8_t pads;               /*!< PADs */
+    uint32_t adc_frec;          /*!< Frecuencia de muestreo de cada PAD (Hz) */
+    uint32_t sample_rate;       /*!< Frecuencia de la salida de audio (Hz) */
+    uint8_t voices;             /*!< Voces del mezclador */
+    bool output_isr;            /*!< Una interrupción por muestra de audio (DAC) */
+    uint16_t frame_rate;        /*!< Cuadros por segundo del LED */
+    uint16_t hit_rate;          /*!< Golpes por segundo del kit (peor caso) */
+} perf_config_t;
+
+/** Ciclos del CPU (la diferencia entre dos lecturas es válida aunque el contador dé la vuelta) */
+static inline uint32_t PerfBudgetNow(void) {
+    return esp_cpu_get_cycle_count();
+}
+
+/** Guarda la configuración y registra los contadores de ciclos de las etapas en las métricas */
+void PerfBudgetInit(const perf_config_t *config);
+
+/** Suma a una etapa los ciclos desde start; devuelve el instante actual (el inicio de la etapa siguiente) */
+uint32_t PerfBudgetAdd(perf_stage_t stage, uint32_t start);
+
+/** Si el estimado supera el presupuesto envía un aviso y la tabla por UART_PC; devuelve si entra */
+bool PerfBudgetCheck(void);
+
+/** Envía por UART_PC el medido (desde el reporte anterior) y el estimado de cada etapa, en kciclos/s */
+void PerfBudgetReport(void);
+
+#endif // PERF_BUDGET_H
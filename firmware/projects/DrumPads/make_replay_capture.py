@@ -0,0 +1,87 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 10:00:00 2026
+
+@author: Albano Peñalva
+
+Generación de una captura para reproducir en DrumPads (formato de
+adc_replay_mcu.h) a partir de la salida de scope_decoder.py (modo osciloscopio,
+una línea por instante: tiempo y una muestra cruda por PAD, en el orden de la
+tabla pads[]):
+
+    python3 scope_decoder.py /dev/ttyUSB0 > scope.txt
+    python3 make_replay_capture.py scope.txt
+    parttool.py write_partition --partition-name capture --input capture.bin
+
+o para enviarla por UART_PC (ADC_SOURCE_REPLAY_UART, requiere pyserial):
+
+    python3 make_replay_capture.py scope.txt --port /dev/ttyUSB0
+"""
+
+# Librerías
+import argparse
+import struct
+import time
+
+# Formato de la captura (little endian)
+ADC_REPLAY_MAGIC = 0x52434441       # "ADCR"
+ADC_REPLAY_VERSION = 1
+HEADER = '<IBBHII'                  # magic, version, canales, muestras por bloque, frecuencia, bloques
+ADC_CONT_MAX_FRAME_SIZE = 256
+ADC_REPLAY_STREAM_TIMEOUT = 1.0     # s sin bytes que terminan la reproducción
+
+# %% Parámetros
+parser = argparse.ArgumentParser(description='Captura para la reproducción de DrumPads')
+parser.add_argument('entrada', help='salida de scope_decoder.py (espacios o comas)')
+parser.add_argument('-o', '--salida', default='capture.bin', help='captura generada')
+parser.add_argument('--canales', default='1,0', help='canal del ADC de cada PAD (pads[]: PAD A -> CH1, PAD B -> CH0)')
+parser.add_argument('--fs', type=int, default=20000, help='frecuencia de muestreo (ADC_SAMPLE_FREQ)')
+parser.add_argument('--bloque', type=int, default=64, help='muestras por bloque (ADC_FRAME_SIZE)')
+parser.add_argument('--port', help='puerto serie por el que se envía la captura (en lugar de guardarla)')
+parser.add_argument('--baud', type=int, default=921600, help='velocidad del puerto serie')
+args = parser.parse_args()
+
+canales = [int(c) for c in args.canales.split(',')]
+if args.bloque > ADC_CONT_MAX_FRAME_SIZE:
+    raise ValueError(f'Bloques de más de {ADC_CONT_MAX_FRAME_SIZE} muestras')
+
+# %% Lectura: se descarta la columna del tiempo
+with open(args.entrada) as f:
+    filas = [[int(v) for v in linea.replace(',', ' ').split()[1:]] for linea in f if linea.strip()]
+if any(len(fila) != len(canales) for fila in filas):
+    raise ValueError(f'Se esperaban {len(canales)} PADs por línea')
+
+# %% Armado: bloques completos, cada uno con las muestras del canal más bajo primero
+N = len(filas) // args.bloque
+mascara = sum(1 << c for c in canales)
+orden = [canales.index(c) for c in sorted(canales)]
+cuerpo = b''
+for i in range(N):
+    bloque = filas[i * args.bloque:(i + 1) * args.bloque]
+    for pad in orden:
+        cuerpo += struct.pack(f'<{args.bloque}H', *(fila[pad] for fila in bloque))
+encabezado = struct.pack(HEADER, ADC_REPLAY_MAGIC, ADC_REPLAY_VERSION, mascara, args.bloque, args.fs, N)
+captura = encabezado + cuerpo
+print(f'{N} bloques de {args.bloque} muestras, {len(canales)} canales ({N * args.bloque / args.fs:.1f} s, {len(captura)} bytes)')
+
+if args.port is None:
+    with open(args.salida, 'wb') as f:
+        f.write(captura)
+    print(f'{args.salida}: {len(captura)} bytes')
+else:
+    # Al ritmo del ADC: DrumPads no puede frenar al emisor (la UART no tiene control de flujo)
+    import serial
+    tam_bloque = len(canales) * args.bloque * 2
+    periodo = args.bloque / args.fs
+    with serial.Serial(args.port, args.baud, timeout=2 * ADC_REPLAY_STREAM_TIMEOUT) as puerto:
+        puerto.write(encabezado)
+        inicio = time.monotonic()
+        for i in range(N):
+            puerto.write(captura[len(encabezado) + i * tam_bloque:len(encabezado) + (i + 1) * tam_bloque])
+            espera = inicio + (i + 1) * periodo - time.monotonic()
+            if espera > 0:
+                time.sleep(espera)
+        # la reproducción termina al dejar de recibir bytes y DrumPads envía su reporte
+        # (entre los registros binarios de los golpes)
+        reporte = puerto.read_until(b'muestras/s)')
+        print(reporte[reporte.rfind(b'replay:'):].decode(errors='replace'))
@@ -0,0 +1,85 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Wed Oct 14 10:00:00 2026
+
+@author: Albano Peñalva
+
+Generación de un banco de sonidos (formato de sample_bank.h) a partir de
+archivos .wav, para grabar en la partición "samples" sin recompilar el firmware:
+
+    parttool.py write_partition --partition-name samples --input bank.bin
+"""
+
+# Librerías
+import struct
+from scipy import signal
+from scipy.io import wavfile
+import numpy as np
+from adpcm import adpcm_encode
+
+# %% Parámetros
+F_SUB = 8000                # frecuencia de muestreo de la salida de audio (SAMPLE_RATE)
+# (nombre del sample, archivo .wav, formato: 'adpcm' o 'pcm16', frecuencia: F_SUB o None)
+# Con frecuencia None el sample se guarda a la frecuencia del .wav y el mezclador
+# lo remuestrea al reproducirlo (AudioMixerSetRatio); se filtra a F_SUB / 2 porque
+# la interpolación lineal no filtra.
+SAMPLES = [
+    ('snare', 'snare.wav', 'adpcm', F_SUB),
+    ('hihat', 'hihat.wav', 'adpcm', F_SUB),
+]
+ARCHIVO = 'bank.bin'        # banco generado
+TAM_PARTICION = 0xF0000     # tamaño de la partición "samples" (partitions.csv)
+LIBRES = 8                  # entradas libres del índice para los sonidos grabados en la placa (SampleBankWrite)
+
+# Formato del banco (little endian)
+SAMPLE_BANK_MAGIC = 0x4B4E4253      # "SBNK"
+SAMPLE_BANK_VERSION = 1
+HEADER = '<IHHI'                    # magic, version, count, size
+ENTRY = '<IIHBB12s'                 # offset, lenght, sample_rate, format, reserved, name
+FORMATO = {'pcm16': 0, 'adpcm': 1}
+
+# %% Lectura y conversión de los samples
+datos = []
+for nombre, filename, formato, frecuencia in SAMPLES:
+    fs, data = wavfile.read(filename)   # frecuencia de muestreo y datos de la señal
+    if data.ndim > 1:
+        data = data[:, 0]               # se extrae un canal (si el audio es estereo)
+    if frecuencia is None:
+        # Frecuencia nativa, limitada en banda a la mitad de la de salida
+        if fs > 65535 or fs > 8 * F_SUB:
+            raise ValueError(f'{filename}: {fs} Hz no se puede remuestrear en el mezclador')
+        frecuencia = fs
+        sos = signal.butter(8, 0.45 * F_SUB, fs=fs, output='sos')
+        senial = signal.sosfiltfilt(sos, data.astype(np.float64))
+    else:
+        # Submuestreo
+        senial = signal.resample(data.astype(np.float64), int(len(data) * frecuencia / fs))
+    # Escalado a PCM de 16 bits con signo (escala completa)
+    senial = senial / np.max(np.abs(senial))
+    senial = np.round(senial * 32767).astype(np.int16)
+    if formato == 'adpcm':
+        muestras = bytes(adpcm_encode(senial))
+    else:
+        muestras = senial.astype('<i2').tobytes()
+    datos.append((nombre, formato, frecuencia, len(senial), muestras))
+
+# %% Armado del banco: encabezado, índice (con LIBRES entradas en cero) y datos (alineados a 4 bytes)
+offset = struct.calcsize(HEADER) + (len(datos) + LIBRES) * struct.calcsize(ENTRY)
+indice = b''
+cuerpo = b''
+for nombre, formato, frecuencia, N, muestras in datos:
+    indice += struct.pack(ENTRY, offset + len(cuerpo), N, frecuencia, FORMATO[formato], 0,
+                          nombre.encode('ascii')[:11])
+    cuerpo += muestras + bytes(-len(muestras) % 4)
+tam = offset + len(cuerpo)
+if tam > TAM_PARTICION:
+    raise ValueError(f'El banco ({tam} bytes) no entra en la partición ({TAM_PARTICION} bytes)')
+indice += bytes(LIBRES * struct.calcsize(ENTRY))
+banco = struct.pack(HEADER, SAMPLE_BANK_MAGIC, SAMPLE_BANK_VERSION, len(datos), tam) + indice + cuerpo
+
+with open(ARCHIVO, 'wb') as f:
+    f.write(banco)
+
+for nombre, formato, frecuencia, N, muestras in datos:
+    print(f'{nombre}: {N} muestras ({formato}, {frecuencia} Hz, {len(muestras)} bytes)')
+print(f'{ARCHIVO}: {tam} bytes')
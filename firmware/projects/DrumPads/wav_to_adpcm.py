@@ -0,0 +1,46 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Wed Oct 14 10:00:00 2026
+
+@author: Albano Peñalva
+
+Conversión de un archivo .wav a un sample IMA-ADPCM para drum_samples.c
+(el codificador está en adpcm.py).
+"""
+
+# Librerías
+from scipy import signal
+from scipy.io import wavfile
+import numpy as np
+from adpcm import adpcm_encode
+
+# %% Parámetros
+filename = 'snare.wav'      # nombre de archivo
+NOMBRE = 'snare_drum'       # prefijo de las variables (NOMBRE_size y NOMBRE_adpcm)
+F_SUB = 8000                # frecuencia de muestreo de la salida de audio (SAMPLE_RATE)
+
+# %% Lectura del archivo de audio
+fs, data = wavfile.read(filename)   # frecuencia de muestreo y datos de la señal
+if data.ndim > 1:
+    data = data[:, 0]               # se extrae un canal de la pista de audio (si el audio es estereo)
+
+# Submuestreo
+senial = signal.resample(data.astype(np.float64), int(len(data) * F_SUB / fs))
+
+# Escalado a PCM de 16 bits con signo (escala completa)
+senial = senial / np.max(np.abs(senial))
+senial = np.round(senial * 32767).astype(np.int16)
+N = len(senial)
+
+# Compresión
+datos = adpcm_encode(senial)
+
+# %% Guardado en archivo .c (para copiar en drum_samples.c)
+with open(f'{NOMBRE}.c', 'w') as f:
+    f.write(f'const int {NOMBRE}_size = {N};\n')
+    f.write(f'const uint8_t {NOMBRE}_adpcm[] = {{\n')
+    lineas = [', '.join(str(b) for b in datos[i:i + 32]) for i in range(0, len(datos), 32)]
+    f.write(',\n'.join(lineas))
+    f.write('\n};\n')
+
+print(f'{NOMBRE}: {N} muestras, {len(datos)} bytes (PCM 16 bits: {2 * N} bytes)')
@@ -47,6 +47,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "timer_mcu.h"
+#include "iram_mcu.h"
 #include "uart_mcu.h"
 #include "analog_io_mcu.h"
 #include "neopixel_stripe.h"
@@ -151,7 +152,7 @@ static void SonarBTask(void *pvParameters);
 
 /*==================[external functions definition]==========================*/
 
-void TimerAdcCallback(void *param) {
+void SAMPLE_PATH_ATTR TimerAdcCallback(void *param) {
 
     vTaskNotifyGiveFromISR(adc_task_handle, NULL);
 
@@ -164,7 +165,7 @@ static void SonarATask(void *pvParameters) {
 
      //PAD A AUDIO
     
-    for(int i = 0; i < sizeof(snare_drum1); i++){
+    for(int i = 0; i < snare_drum; i++){
         AnalogOutputWrite(snare_drum1[i]);
         vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE)); // Ajusta el retardo según la frecuencia de muestreo
      }
@@ -179,7 +180,7 @@ static void SonarBTask(void *pvParameters) {
 
      //PAD B AUDIO
     
-    for(int i = 0; i < sizeof(Hi_Hat1); i++){
+    for(int i = 0; i < Hi_Hat; i++){
         AnalogOutputWrite(Hi_Hat1[i]);
         vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE)); // Ajusta el retardo según la frecuencia de muestreo
      }
@@ -278,7 +279,7 @@ void app_main(void) {
     };
 
     
-    neopixel_color_t LED_UNICO;
+    static neopixel_color_t LED_UNICO;     // el driver lo usa después de que app_main termina
     TimerInit(&timer_adc_config);
     AnalogInputInit(&adc_config_A);
     AnalogInputInit(&adc_config_B);
@@ -8,16 +8,24 @@
  * específico (Snare o Hi-Hat) por el DAC.
  *
  * Características principales:
- * - Sensores: 2 Piezoeléctricos (PAD A -> CH1, PAD B -> CH0).
+ * - Sensores: Piezoeléctricos, configurados en la tabla pads[] (canal, umbral, sonido
+ *   y color del LED). Con dos PADs: PAD A -> CH1, PAD B -> CH0.
  * - Muestreo: 20 kHz (50 μs) (Ver nota de rendimiento).
  * - Detección: Por umbral en la tarea de ADC.
  * - Salida de audio: DAC (Buzzer/Audio Out).
  * - Feedback visual: LED Neopixel.
  * - Implementación: 
  * - Timer notifica a AdcTask.
- * - AdcTask lee ADCs, compara con umbral y envía datos por UART.
- * - Si hay golpe, AdcTask notifica a UmbralTask (LED) y a PlaySoundTask (Audio).
- * - PlaySoundTask es una tarea única que reproduce el sonido correspondiente.
+ * - AdcTask lee ADCs y compara con umbral.
+ * - Si hay golpe, AdcTask lo publica una sola vez en hit_bus (event_bus_mcu.h).
+ *   UmbralTask (LED), PlaySoundTask (Audio) y TelemetryTask (UART) son suscriptores:
+ *   cada una lee todos los golpes a su ritmo, así dos golpes seguidos no se pisan y
+ *   agregar un consumidor no agrega trabajo al muestreo.
+ * - PlaySoundTask es una tarea única que mezcla los sonidos activos (hasta 8 voces,
+ *   los golpes se superponen) y carga las muestras en la salida de audio (un timer
+ *   de hardware las envía al DAC a SAMPLE_RATE).
+ * - Los samples están comprimidos en IMA-ADPCM (1/4 de la memoria de PCM de 16 bits)
+ *   y se decodifican por bloques sólo mientras su voz está activa (ver wav_to_adpcm.py).
  *
  * @section hardConn Conexión de Hardware
  *
@@ -40,8 +48,12 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "timer_mcu.h"
+#include "time_mcu.h"
+#include "iram_mcu.h"
 #include "uart_mcu.h"
 #include "analog_io_mcu.h"
+#include "event_bus_mcu.h"
+#include "audio_mixer.h"
 #include "neopixel_stripe.h"
 #include "gpio_mcu.h"
 #include "drum_samples.h" 
@@ -50,30 +62,63 @@
 /** Período del timer A para muestreo ADC: 20KHz = 50μs */
 #define TIMER_ADC_PERIOD_US     50
 
-/** Canal ADC a usar para PAD A */
-#define ADC_CHANNEL_A            CH1
-
-/** Canal ADC a usar para PAD B */
-#define ADC_CHANNEL_B            CH0
-
 /** Velocidad UART para transmisión */
 #define UART_BAUD_RATE          921600
 
-/** Umbral para la detección del evento*/
-#define ADC_THRESHOLD_MV_MINIMUM        400
-
 /** Pin de salida para el buzzer/audio */
 #define GPIO_AUDIO_OUT          GPIO_4  
 
 /** Frecuencia de muestreo utilizada en la señal de audio (DAC) */
 #define SAMPLE_RATE             8000
 
+/** Muestras de audio mezcladas por bloque (8 ms a 8 kHz) */
+#define AUDIO_BLOCK_SIZE        64
+
+/** Muestras que se mantienen cargadas en la salida de audio (latencia máxima de un golpe) */
+#define AUDIO_FILL_LEVEL        (2 * AUDIO_BLOCK_SIZE)
+
+/** Nivel del buffer de la salida de audio que dispara el pedido de más muestras */
+#define AUDIO_LOW_LEVEL         AUDIO_BLOCK_SIZE
+
+/** Ganancia de la salida de audio (1.0: PCM a escala completa del DAC) */
+#define AUDIO_GAIN              1.0f
+
 /** Cooldown para evitar múltiples disparos del mismo golpe (en milisegundos) */
-#define HIT_COOLDOWN_MS         100 
+#ifndef HIT_COOLDOWN_MS
+#define HIT_COOLDOWN_MS         100
+#endif
+
+/** Golpes del bus que un suscriptor puede tener sin leer (potencia de 2) */
+#define HIT_BUS_SIZE            16
 
-// CAMBIO: Definimos valores para las notificaciones de sonido
-#define PLAY_SNARE              1
-#define PLAY_HIHAT              2
+/** Notificaciones de PlaySoundTask (bits, para no perder un pedido de muestras durante un golpe) */
+#define PLAY_HIT                (1 << 0)
+#define AUDIO_REFILL            (1 << 1)
+
+/** Cantidad de PADs (filas de la tabla pads[]) */
+#define PAD_NUM                 (sizeof(pads) / sizeof(pads[0]))
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Configuración de un PAD
+ */
+typedef struct {
+    const char *name;               /*!< Nombre (para los mensajes por UART) */
+    adc_ch_t channel;               /*!< Canal del ADC */
+    uint32_t threshold;             /*!< Umbral para la detección del golpe (mV) */
+    const uint8_t *adpcm;           /*!< Sonido del PAD en IMA-ADPCM (drum_samples.c) */
+    const int *size;                /*!< Muestras del sonido */
+    neopixel_color_t color;         /*!< Color del LED al golpear el PAD */
+} pad_config_t;
+
+/**
+ * @brief Golpe publicado en hit_bus
+ */
+typedef struct {
+    uint8_t pad;                    /*!< Índice del PAD en la tabla pads[] */
+    uint32_t milliv;                /*!< Nivel que superó el umbral (mV) */
+    uint32_t time;                  /*!< Instante del golpe (ms) */
+} hit_event_t;
 
 /*==================[internal data definition]===============================*/
 
@@ -87,17 +132,21 @@ TaskHandle_t umbral_task_handle = NULL;
 /** Handle de la tarea de reproducción de sonido */
 TaskHandle_t  playSound_task_handle = NULL;
 
-/** Variable para almacenar la conversión ADC del PAD A (12 bits) */
-static uint16_t valor_adc_A = 0;
+/** Handle de la tarea que envía los golpes por UART */
+TaskHandle_t telemetry_task_handle = NULL;
 
-/** Variable para almacenar la conversión ADC del PAD B (12 bits) */
-static uint16_t valor_adc_B = 0;
+/** Bus de golpes (AdcTask -> LED, sonido y UART) */
+static event_bus_t hit_bus;
+static hit_event_t hit_bus_storage[HIT_BUS_SIZE];
 
-/** Variable para almacenar los milivots registrados PAD A */
-static uint32_t milliv_A = 0;
+/** Suscripciones a hit_bus de cada tarea */
+static int8_t led_sub, sound_sub, telemetry_sub;
 
-/** Variable para almacenar los milivots registrados PAD B */
-static uint32_t milliv_B = 0;
+/** Tabla de PADs */
+static const pad_config_t pads[] = {
+    {"PAD A", CH1, 400, snare_drum_adpcm, &snare_drum_size, NEOPIXEL_COLOR_RED},
+    {"PAD B", CH0, 400, hi_hat_adpcm, &hi_hat_size, NEOPIXEL_COLOR_BLUE},
+};
 
 /*==================[internal functions declaration]=========================*/
 /**
@@ -105,6 +154,11 @@ static uint32_t milliv_B = 0;
  */
 void TimerAdcCallback(void *param);
 
+/**
+ * @brief Callback de la salida de audio - pide más muestras a PlaySoundTask
+ */
+void AudioRefillCallback(void *param);
+
 /**
  * @brief Tarea que procesa y transmite datos del ADC
  */
@@ -119,46 +173,72 @@ static void UmbralTask(void *pvParameters);
 
 // CAMBIO: Declaración de la nueva tarea de sonido unificada
 /**
- * @brief Tarea que reproduce un sonido (Snare o HiHat) basado en una notificación
+ * @brief Tarea que reproduce el sonido de cada golpe de hit_bus
  */
 static void PlaySoundTask(void *pvParameters);
 
+/**
+ * @brief Tarea de baja prioridad que envía por UART los golpes de hit_bus
+ */
+static void TelemetryTask(void *pvParameters);
+
 /*==================[external functions definition]==========================*/
 
-void TimerAdcCallback(void *param) {
+void SAMPLE_PATH_ATTR TimerAdcCallback(void *param) {
     // Notifica a la tarea AdcTask para que se ejecute
     vTaskNotifyGiveFromISR(adc_task_handle, NULL);
 }
 
+/**
+ * @brief Callback de la salida de audio (desde ISR) cuando el buffer baja a AUDIO_LOW_LEVEL
+ */
+void SAMPLE_PATH_ATTR AudioRefillCallback(void *param) {
+    xTaskNotifyFromISR(playSound_task_handle, AUDIO_REFILL, eSetBits, NULL);
+}
+
+/**
+ * @brief Mezcla bloques de audio hasta tener AUDIO_FILL_LEVEL muestras en la salida
+ */
+static void AudioFill(audio_mixer_t *mixer) {
+    int16_t mix[AUDIO_BLOCK_SIZE];
+    while (DAC_STREAM_BUFFER_SIZE - AnalogOutputStreamFree() < AUDIO_FILL_LEVEL) {
+        AudioMixerProcess(mixer, mix, AUDIO_BLOCK_SIZE);
+        AnalogOutputStreamWritePCM(mix, AUDIO_BLOCK_SIZE, AUDIO_GAIN);
+    }
+}
+
 // CAMBIO: Tarea de sonido unificada
 static void PlaySoundTask(void *pvParameters) {
-    uint32_t soundToPlay;
+    static audio_mixer_t mixer;
+    hit_event_t hit;
+    uint32_t events;
 
+    AudioMixerInit(&mixer);
+    // Carga inicial: a partir de aquí la salida de audio pide más muestras
+    AudioFill(&mixer);
     while (true) {
-        // Espera permanentemente hasta recibir una notificación
-        if (xTaskNotifyWait(0, 0xFFFFFFFF, &soundToPlay, portMAX_DELAY) == pdTRUE) {
-            
-            // Revisa qué sonido debe reproducir según el valor de la notificación
-            if (soundToPlay == PLAY_SNARE) {
-                
-                // CAMBIO: Corregido el bug de 'sizeof'. 
-                // Usamos el tamaño real del array (definido en drum_samples.c)
-                for (int i = 0; i < snare_drum_size; i++) {
-                    AnalogOutputWrite(snare_drum_sample[i]);
-                    // Espera el tiempo de muestreo del audio
-                    vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE)); 
-                }
-
-            } else if (soundToPlay == PLAY_HIHAT) {
-                
-                // CAMBIO: Corregido el bug de 'sizeof'.
-                for (int i = 0; i < hi_hat_size; i++) {
-                    AnalogOutputWrite(hi_hat_sample[i]);
-                    vTaskDelay(pdMS_TO_TICKS(1000 / SAMPLE_RATE));
-                }
+        // Espera golpes (PLAY_HIT) o el pedido de más muestras (AUDIO_REFILL)
+        if (xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY) == pdTRUE) {
+            // Cada golpe ocupa una voz del mezclador, así los sonidos se superponen
+            while (EventBusRead(&hit_bus, sound_sub, &hit)) {
+                const pad_config_t *pad = &pads[hit.pad];
+                AudioMixerPlayADPCM(&mixer, pad->adpcm, *pad->size, 1.0f);
             }
-            // Aseguramos que el DAC quede en silencio (valor medio)
-            AnalogOutputWrite(512); 
+            // Sin voces activas se mezcla silencio (costo constante por muestra)
+            AudioFill(&mixer);
+        }
+    }
+}
+
+static void TelemetryTask(void *pvParameters) {
+    hit_event_t hit;
+    char buffer[32];
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (EventBusRead(&hit_bus, telemetry_sub, &hit)) {
+            sprintf(buffer, "%s: %lu\r\n", pads[hit.pad].name, (unsigned long)hit.milliv);
+            UartSendString(UART_PC, buffer);
         }
     }
 }
@@ -166,59 +246,30 @@ static void PlaySoundTask(void *pvParameters) {
 
 static void AdcTask(void *pvParameters) {
     
-    uint32_t last_hit_time_A = 0;
-    uint32_t last_hit_time_B = 0;
+    uint32_t last_hit_time[PAD_NUM] = {0};
     uint32_t current_time = 0;
-
-    // CAMBIO: Movemos el buffer aquí para no crearlo en cada bucle
-    char buffer[32]; 
+    uint16_t valor_adc = 0;
+    uint32_t milliv = 0;
 
     while (1) {
         // Espera la notificación del Timer (cada 50us)
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
         
-        // Lee ambos conversores ADC 
-        AnalogInputReadSingle(ADC_CHANNEL_A, &valor_adc_A);
-        AnalogInputReadSingle(ADC_CHANNEL_B, &valor_adc_B); 
-        
-        // Convierte a milivoltios
-        milliv_A = (uint32_t)((valor_adc_A * 3300UL) / 4095UL);
-        milliv_B = (uint32_t)((valor_adc_B * 3300UL) / 4095UL); 
-       
-        /*
-         * CAMBIO: Hemos movido la lógica de envío UART DENTRO
-         * de los 'if' que detectan el golpe.
-         * Ya no se envía en cada muestra de 50us.
-         */
-        
-        // --- Lógica de Detección de Golpes ---
-        
-        current_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-
-        // Comprueba PAD A
-        if ((milliv_A > ADC_THRESHOLD_MV_MINIMUM) && (current_time - last_hit_time_A > HIT_COOLDOWN_MS)) {
-            last_hit_time_A = current_time; 
-            
-            // CAMBIO: Enviar datos solo al detectar el golpe
-            sprintf(buffer, "PAD A: %lu\r\n", (unsigned long)milliv_A);
-            UartSendString(UART_PC, buffer);
+        current_time = TimeNowMs();
 
-            // Notifica a las otras tareas
-            vTaskNotifyGive(umbral_task_handle); 
-            xTaskNotify(playSound_task_handle, PLAY_SNARE, eSetValueWithOverwrite);
-        } 
-        
-        // Comprueba PAD B
-        if ((milliv_B > ADC_THRESHOLD_MV_MINIMUM) && (current_time - last_hit_time_B > HIT_COOLDOWN_MS)) {
-            last_hit_time_B = current_time; 
+        // --- Lógica de Detección de Golpes (un recorrido de la tabla de PADs) ---
+        for (uint8_t p = 0; p < PAD_NUM; p++) {
+            // Lee el conversor ADC y convierte a milivoltios
+            AnalogInputReadSingle(pads[p].channel, &valor_adc);
+            milliv = (uint32_t)((valor_adc * 3300UL) / 4095UL);
 
-            // CAMBIO: Enviar datos solo al detectar el golpe
-            sprintf(buffer, "PAD B: %lu\r\n", (unsigned long)milliv_B);
-            UartSendString(UART_PC, buffer);
+            if ((milliv > pads[p].threshold) && (current_time - last_hit_time[p] > HIT_COOLDOWN_MS)) {
+                last_hit_time[p] = current_time; 
 
-            // Notifica a las otras tareas
-            vTaskNotifyGive(umbral_task_handle);
-            xTaskNotify(playSound_task_handle, PLAY_HIHAT, eSetValueWithOverwrite);
+                // Una sola publicación: los suscriptores (LED, sonido, UART) la leen a su ritmo
+                hit_event_t hit = {.pad = p, .milliv = milliv, .time = current_time};
+                EventBusPublish(&hit_bus, &hit);
+            }
         }
     }
 }
@@ -229,9 +280,18 @@ static void AdcTask(void *pvParameters) {
  */
 static void UmbralTask(void *pvParameters) {
     // Esta tarea solo controla el LED como feedback visual
+    hit_event_t hit;
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Espera un golpe
-        NeoPixelAllColor(NEOPIXEL_COLOR_RED);   
+        // El LED toma el color del último golpe pendiente
+        bool pending = false;
+        while (EventBusRead(&hit_bus, led_sub, &hit)) {
+            pending = true;
+        }
+        if (!pending) {
+            continue;
+        }
+        NeoPixelAllColor(pads[hit.pad].color);
         vTaskDelay(pdMS_TO_TICKS(125)); // Mantiene el LED encendido 125ms
         NeoPixelAllOff(); 
     }
@@ -239,22 +299,6 @@ static void UmbralTask(void *pvParameters) {
 
 void app_main(void) {
 
-    analog_input_config_t adc_config_A = {
-        .input = ADC_CHANNEL_A,   // Canal CH1 para PAD A
-        .mode = ADC_SINGLE,
-        .func_p = NULL,         
-        .param_p = NULL,
-        .sample_frec = 0        
-    };
-    
-    analog_input_config_t adc_config_B = { 
-        .input = ADC_CHANNEL_B,   // Canal CH0 para PAD B
-        .mode = ADC_SINGLE,
-        .func_p = NULL,         
-        .param_p = NULL,
-        .sample_frec = 0        
-    };
-
     // Inicialización UART 
    serial_config_t uart_config = {
         .port = UART_PC,
@@ -272,11 +316,27 @@ void app_main(void) {
     };
 
     
-    neopixel_color_t LED_UNICO;
+    static neopixel_color_t LED_UNICO;     // el driver lo usa después de que app_main termina
     TimerInit(&timer_adc_config);
-    AnalogInputInit(&adc_config_A);
-    AnalogInputInit(&adc_config_B); 
-    AnalogOutputInit();
+    for (uint8_t p = 0; p < PAD_NUM; p++) {
+        analog_input_config_t adc_config = {
+            .input = pads[p].channel,
+            .mode = ADC_SINGLE,
+            .func_p = NULL,         
+            .param_p = NULL,
+            .sample_frec = 0        
+        };
+        AnalogInputInit(&adc_config);
+    }
+    // Salida de audio temporizada por hardware a SAMPLE_RATE
+    analog_output_stream_config_t audio_config = {
+        .sample_rate = SAMPLE_RATE,
+        .low_level = AUDIO_LOW_LEVEL,
+        .func_p = AudioRefillCallback,
+        .param_p = NULL
+    };
+    AnalogOutputStreamInit(&audio_config);
+    AnalogOutputStreamStart();
     UartInit(&uart_config);
     NeoPixelInit(BUILT_IN_RGB_LED_PIN ,  BUILT_IN_RGB_LED_LENGTH ,  &LED_UNICO );
     
@@ -285,6 +345,13 @@ void app_main(void) {
     xTaskCreate(AdcTask, "AdcTask", 4096, NULL, 5, &adc_task_handle);
     xTaskCreate(UmbralTask, "UmbralTask", 4096, NULL, 5, &umbral_task_handle);
     xTaskCreate(PlaySoundTask, "PlaySoundTask", 4096, NULL, 5, &playSound_task_handle);
+    xTaskCreate(TelemetryTask, "TelemetryTask", 2048, NULL, 2, &telemetry_task_handle);
+
+    // Suscripciones al bus de golpes (antes del primer golpe)
+    EventBusInit(&hit_bus, hit_bus_storage, sizeof(hit_event_t), HIT_BUS_SIZE);
+    led_sub = EventBusSubscribe(&hit_bus, umbral_task_handle, 0);
+    sound_sub = EventBusSubscribe(&hit_bus, playSound_task_handle, PLAY_HIT);
+    telemetry_sub = EventBusSubscribe(&hit_bus, telemetry_task_handle, 0);
 
     // Iniciar el timer que dispara todo el proceso
     TimerStart(TIMER_A); 
@@ -6,14 +6,226 @@
  * (Corta y pega tus arrays gigantes aquí)
  */
 
-// Definición del tamaño y el array del Snare
+// Definición del tamaño (en muestras) y el array del Snare
 const int snare_drum_size = 8426;
-const int16_t snare_drum_sample[] = {
-    512,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.080000000000000000e+02,5.130000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.050000000000000000e+02,5.150000000000000000e+02,5.030000000000000000e+02,5.190000000000000000e+02,5.110000000000000000e+02,5.280000000000000000e+02,5.250000000000000000e+02,5.140000000000000000e+02,4.890000000000000000e+02,5.250000000000000000e+02,5.330000000000000000e+02,4.940000000000000000e+02,4.490000000000000000e+02,2.820000000000000000e+02,1.600000000000000000e+01,7.700000000000000000e+01,1.000000000000000000e+02,6.360000000000000000e+02,1.024000000000000000e+03,9.610000000000000000e+02,9.730000000000000000e+02,9.310000000000000000e+02,6.670000000000000000e+02,5.630000000000000000e+02,7.790000000000000000e+02,8.000000000000000000e+02,9.530000000000000000e+02,9.820000000000000000e+02,9.810000000000000000e+02,9.360000000000000000e+02,6.290000000000000000e+02,3.280000000000000000e+02,3.890000000000000000e+02,2.940000000000000000e+02,2.050000000000000000e+02,5.500000000000000000e+01,5.000000000000000000e+01,4.600000000000000000e+01,5.100000000000000000e+01,3.500000000000000000e+01,6.400000000000000000e+01,7.800000000000000000e+01,1.780000000000000000e+02,3.380000000000000000e+02,3.920000000000000000e+02,3.450000000000000000e+02,3.500000000000000000e+02,3.880000000000000000e+02,4.830000000000000000e+02,5.870000000000000000e+02,6.300000000000000000e+02,6.660000000000000000e+02,8.610000000000000000e+02,8.820000000000000000e+02,9.030000000000000000e+02,9.770000000000000000e+02,9.440000000000000000e+02,9.040000000000000000e+02,8.630000000000000000e+02,7.280000000000000000e+02,6.390000000000000000e+02,6.120000000000000000e+02,5.850000000000000000e+02,6.090000000000000000e+02,4.980000000000000000e+02,5.160000000000000000e+02,5.880000000000000000e+02,6.020000000000000000e+02,5.030000000000000000e+02,5.020000000000000000e+02,4.560000000000000000e+02,4.920000000000000000e+02,4.280000000000000000e+02,2.840000000000000000e+02,1.510000000000000000e+02,6.900000000000000000e+01,3.800000000000000000e+01,4.700000000000000000e+01,3.900000000000000000e+01,6.100000000000000000e+01,1.310000000000000000e+02,3.110000000000000000e+02,4.890000000000000000e+02,5.870000000000000000e+02,6.290000000000000000e+02,6.970000000000000000e+02,6.880000000000000000e+02,7.230000000000000000e+02,7.580000000000000000e+02,7.530000000000000000e+02,7.400000000000000000e+02,8.180000000000000000e+02,8.110000000000000000e+02,7.650000000000000000e+02,8.050000000000000000e+02,7.830000000000000000e+02,7.750000000000000000e+02,7.720000000000000000e+02,6.340000000000000000e+02,5.740000000000000000e+02,4.920000000000000000e+02,5.130000000000000000e+02,4.650000000000000000e+02,4.100000000000000000e+02,3.110000000000000000e+02,2.630000000000000000e+02,2.920000000000000000e+02,2.880000000000000000e+02,2.640000000000000000e+02,1.840000000000000000e+02,2.740000000000000000e+02,2.360000000000000000e+02,2.490000000000000000e+02,3.460000000000000000e+02,2.680000000000000000e+02,2.640000000000000000e+02,4.180000000000000000e+02,4.740000000000000000e+02,5.450000000000000000e+02,6.220000000000000000e+02,6.060000000000000000e+02,6.800000000000000000e+02,7.160000000000000000e+02,7.520000000000000000e+02,7.820000000000000000e+02,8.380000000000000000e+02,8.420000000000000000e+02,8.400000000000000000e+02,8.020000000000000000e+02,7.350000000000000000e+02,6.460000000000000000e+02,6.360000000000000000e+02,5.730000000000000000e+02,4.990000000000000000e+02,4.660000000000000000e+02,4.410000000000000000e+02,4.400000000000000000e+02,3.690000000000000000e+02,3.320000000000000000e+02,4.380000000000000000e+02,4.160000000000000000e+02,3.240000000000000000e+02,3.170000000000000000e+02,2.780000000000000000e+02,2.860000000000000000e+02,2.220000000000000000e+02,1.950000000000000000e+02,2.560000000000000000e+02,3.310000000000000000e+02,4.800000000000000000e+02,4.950000000000000000e+02,5.330000000000000000e+02,6.350000000000000000e+02,6.710000000000000000e+02,6.440000000000000000e+02,6.820000000000000000e+02,6.740000000000000000e+02,6.760000000000000000e+02,5.760000000000000000e+02,5.290000000000000000e+02,6.020000000000000000e+02,6.360000000000000000e+02,6.780000000000000000e+02,6.120000000000000000e+02,6.370000000000000000e+02,7.110000000000000000e+02,6.770000000000000000e+02,6.390000000000000000e+02,5.940000000000000000e+02,5.520000000000000000e+02,5.730000000000000000e+02,4.930000000000000000e+02,4.380000000000000000e+02,3.320000000000000000e+02,3.180000000000000000e+02,2.700000000000000000e+02,1.980000000000000000e+02,2.100000000000000000e+02,3.480000000000000000e+02,3.990000000000000000e+02,3.840000000000000000e+02,4.310000000000000000e+02,3.990000000000000000e+02,3.220000000000000000e+02,3.410000000000000000e+02,4.490000000000000000e+02,5.170000000000000000e+02,5.970000000000000000e+02,7.040000000000000000e+02,8.010000000000000000e+02,7.590000000000000000e+02,6.750000000000000000e+02,5.840000000000000000e+02,5.650000000000000000e+02,5.790000000000000000e+02,6.450000000000000000e+02,7.200000000000000000e+02,7.520000000000000000e+02,7.420000000000000000e+02,7.700000000000000000e+02,6.510000000000000000e+02,4.110000000000000000e+02,4.220000000000000000e+02,4.330000000000000000e+02,4.160000000000000000e+02,2.610000000000000000e+02,2.740000000000000000e+02,3.540000000000000000e+02,4.190000000000000000e+02,4.720000000000000000e+02,5.310000000000000000e+02,5.800000000000000000e+02,5.670000000000000000e+02,5.000000000000000000e+02,3.450000000000000000e+02,3.020000000000000000e+02,3.100000000000000000e+02,2.860000000000000000e+02,2.800000000000000000e+02,3.670000000000000000e+02,4.150000000000000000e+02,6.270000000000000000e+02,5.870000000000000000e+02,5.700000000000000000e+02,6.480000000000000000e+02,6.250000000000000000e+02,6.950000000000000000e+02,7.220000000000000000e+02,7.240000000000000000e+02,6.300000000000000000e+02,5.560000000000000000e+02,5.400000000000000000e+02,5.260000000000000000e+02,5.480000000000000000e+02,5.310000000000000000e+02,5.500000000000000000e+02,6.290000000000000000e+02,6.400000000000000000e+02,6.260000000000000000e+02,5.160000000000000000e+02,5.990000000000000000e+02,3.950000000000000000e+02,3.590000000000000000e+02,3.440000000000000000e+02,4.550000000000000000e+02,3.810000000000000000e+02,3.770000000000000000e+02,4.000000000000000000e+02,4.140000000000000000e+02,4.640000000000000000e+02,4.490000000000000000e+02,4.750000000000000000e+02,4.920000000000000000e+02,5.120000000000000000e+02,4.890000000000000000e+02,4.530000000000000000e+02,4.720000000000000000e+02,5.130000000000000000e+02,6.270000000000000000e+02,6.080000000000000000e+02,4.430000000000000000e+02,3.470000000000000000e+02,4.820000000000000000e+02,5.210000000000000000e+02,5.730000000000000000e+02,6.530000000000000000e+02,6.110000000000000000e+02,6.690000000000000000e+02,6.120000000000000000e+02,5.880000000000000000e+02,5.320000000000000000e+02,5.790000000000000000e+02,6.510000000000000000e+02,6.250000000000000000e+02,5.950000000000000000e+02,5.520000000000000000e+02,5.400000000000000000e+02,5.030000000000000000e+02,3.860000000000000000e+02,3.890000000000000000e+02,4.510000000000000000e+02,4.440000000000000000e+02,3.400000000000000000e+02,4.050000000000000000e+02,4.390000000000000000e+02,4.780000000000000000e+02,3.970000000000000000e+02,4.490000000000000000e+02,3.860000000000000000e+02,3.770000000000000000e+02,4.010000000000000000e+02,4.990000000000000000e+02,5.360000000000000000e+02,5.440000000000000000e+02,6.690000000000000000e+02,6.030000000000000000e+02,7.700000000000000000e+02,6.600000000000000000e+02,5.300000000000000000e+02,6.160000000000000000e+02,5.520000000000000000e+02,5.240000000000000000e+02,5.010000000000000000e+02,5.330000000000000000e+02,5.540000000000000000e+02,5.210000000000000000e+02,4.960000000000000000e+02,4.610000000000000000e+02,4.350000000000000000e+02,5.810000000000000000e+02,5.290000000000000000e+02,5.790000000000000000e+02,5.470000000000000000e+02,5.310000000000000000e+02,5.120000000000000000e+02,4.840000000000000000e+02,4.420000000000000000e+02,3.870000000000000000e+02,3.920000000000000000e+02,4.540000000000000000e+02,4.540000000000000000e+02,4.290000000000000000e+02,4.690000000000000000e+02,4.820000000000000000e+02,4.860000000000000000e+02,4.440000000000000000e+02,4.570000000000000000e+02,4.480000000000000000e+02,4.670000000000000000e+02,4.470000000000000000e+02,4.810000000000000000e+02,5.190000000000000000e+02,5.420000000000000000e+02,6.570000000000000000e+02,6.480000000000000000e+02,5.850000000000000000e+02,6.590000000000000000e+02,6.720000000000000000e+02,6.540000000000000000e+02,6.390000000000000000e+02,5.620000000000000000e+02,5.560000000000000000e+02,5.320000000000000000e+02,5.140000000000000000e+02,5.390000000000000000e+02,3.450000000000000000e+02,4.460000000000000000e+02,4.720000000000000000e+02,3.970000000000000000e+02,4.570000000000000000e+02,5.170000000000000000e+02,5.530000000000000000e+02,5.520000000000000000e+02,4.500000000000000000e+02,4.550000000000000000e+02,3.530000000000000000e+02,3.590000000000000000e+02,4.420000000000000000e+02,4.380000000000000000e+02,4.070000000000000000e+02,4.910000000000000000e+02,4.400000000000000000e+02,5.040000000000000000e+02,6.090000000000000000e+02,6.120000000000000000e+02,6.000000000000000000e+02,6.020000000000000000e+02,5.730000000000000000e+02,6.440000000000000000e+02,6.410000000000000000e+02,5.460000000000000000e+02,5.560000000000000000e+02,6.110000000000000000e+02,6.720000000000000000e+02,6.840000000000000000e+02,5.880000000000000000e+02,5.110000000000000000e+02,4.900000000000000000e+02,4.300000000000000000e+02,4.760000000000000000e+02,3.920000000000000000e+02,4.080000000000000000e+02,4.890000000000000000e+02,4.420000000000000000e+02,4.540000000000000000e+02,4.920000000000000000e+02,4.420000000000000000e+02,4.620000000000000000e+02,3.820000000000000000e+02,4.910000000000000000e+02,4.460000000000000000e+02,3.130000000000000000e+02,3.880000000000000000e+02,4.070000000000000000e+02,4.610000000000000000e+02,4.920000000000000000e+02,5.080000000000000000e+02,6.090000000000000000e+02,6.560000000000000000e+02,6.430000000000000000e+02,6.270000000000000000e+02,6.500000000000000000e+02,6.310000000000000000e+02,5.760000000000000000e+02,5.530000000000000000e+02,5.070000000000000000e+02,5.290000000000000000e+02,5.650000000000000000e+02,5.490000000000000000e+02,5.190000000000000000e+02,5.620000000000000000e+02,5.640000000000000000e+02,5.910000000000000000e+02,4.930000000000000000e+02,5.010000000000000000e+02,5.100000000000000000e+02,5.170000000000000000e+02,4.580000000000000000e+02,3.730000000000000000e+02,4.530000000000000000e+02,4.530000000000000000e+02,4.880000000000000000e+02,4.540000000000000000e+02,4.290000000000000000e+02,3.880000000000000000e+02,3.730000000000000000e+02,4.240000000000000000e+02,4.130000000000000000e+02,3.870000000000000000e+02,4.340000000000000000e+02,4.610000000000000000e+02,5.530000000000000000e+02,5.370000000000000000e+02,5.190000000000000000e+02,5.950000000000000000e+02,6.470000000000000000e+02,6.680000000000000000e+02,7.020000000000000000e+02,6.900000000000000000e+02,7.070000000000000000e+02,6.720000000000000000e+02,5.770000000000000000e+02,5.480000000000000000e+02,5.740000000000000000e+02,5.200000000000000000e+02,5.030000000000000000e+02,4.940000000000000000e+02,5.290000000000000000e+02,5.150000000000000000e+02,4.350000000000000000e+02,4.210000000000000000e+02,4.080000000000000000e+02,4.360000000000000000e+02,4.370000000000000000e+02,3.260000000000000000e+02,3.470000000000000000e+02,3.030000000000000000e+02,4.080000000000000000e+02,5.130000000000000000e+02,5.050000000000000000e+02,4.920000000000000000e+02,4.770000000000000000e+02,5.790000000000000000e+02,6.120000000000000000e+02,5.550000000000000000e+02,5.070000000000000000e+02,5.210000000000000000e+02,5.980000000000000000e+02,6.180000000000000000e+02,5.630000000000000000e+02,5.400000000000000000e+02,4.940000000000000000e+02,5.430000000000000000e+02,5.940000000000000000e+02,5.960000000000000000e+02,5.750000000000000000e+02,5.700000000000000000e+02,5.370000000000000000e+02,5.420000000000000000e+02,5.470000000000000000e+02,5.090000000000000000e+02,5.030000000000000000e+02,4.950000000000000000e+02,4.930000000000000000e+02,4.620000000000000000e+02,4.390000000000000000e+02,4.920000000000000000e+02,4.540000000000000000e+02,4.550000000000000000e+02,4.570000000000000000e+02,4.780000000000000000e+02,3.970000000000000000e+02,4.390000000000000000e+02,4.640000000000000000e+02,4.620000000000000000e+02,4.990000000000000000e+02,5.220000000000000000e+02,5.360000000000000000e+02,5.750000000000000000e+02,6.010000000000000000e+02,5.600000000000000000e+02,5.580000000000000000e+02,4.580000000000000000e+02,4.920000000000000000e+02,4.930000000000000000e+02,5.780000000000000000e+02,5.830000000000000000e+02,5.260000000000000000e+02,5.510000000000000000e+02,5.230000000000000000e+02,5.740000000000000000e+02,5.350000000000000000e+02,5.560000000000000000e+02,5.480000000000000000e+02,6.420000000000000000e+02,6.190000000000000000e+02,5.150000000000000000e+02,4.900000000000000000e+02,4.470000000000000000e+02,3.320000000000000000e+02,3.830000000000000000e+02,3.970000000000000000e+02,4.570000000000000000e+02,5.060000000000000000e+02,5.430000000000000000e+02,4.820000000000000000e+02,4.770000000000000000e+02,4.830000000000000000e+02,4.440000000000000000e+02,4.120000000000000000e+02,5.020000000000000000e+02,4.870000000000000000e+02,5.310000000000000000e+02,4.890000000000000000e+02,5.500000000000000000e+02,5.560000000000000000e+02,5.650000000000000000e+02,6.060000000000000000e+02,6.150000000000000000e+02,5.660000000000000000e+02,5.360000000000000000e+02,6.000000000000000000e+02,6.200000000000000000e+02,5.730000000000000000e+02,5.930000000000000000e+02,5.790000000000000000e+02,5.190000000000000000e+02,5.030000000000000000e+02,4.310000000000000000e+02,4.200000000000000000e+02,3.900000000000000000e+02,4.710000000000000000e+02,4.360000000000000000e+02,4.640000000000000000e+02,4.840000000000000000e+02,5.130000000000000000e+02,4.150000000000000000e+02,4.230000000000000000e+02,4.350000000000000000e+02,4.390000000000000000e+02,4.500000000000000000e+02,5.410000000000000000e+02,5.960000000000000000e+02,5.630000000000000000e+02,5.300000000000000000e+02,5.290000000000000000e+02,5.220000000000000000e+02,5.730000000000000000e+02,4.920000000000000000e+02,5.660000000000000000e+02,5.350000000000000000e+02,5.380000000000000000e+02,5.130000000000000000e+02,5.460000000000000000e+02,4.880000000000000000e+02,4.950000000000000000e+02,5.740000000000000000e+02,5.100000000000000000e+02,5.570000000000000000e+02,5.770000000000000000e+02,6.120000000000000000e+02,5.250000000000000000e+02,5.670000000000000000e+02,5.300000000000000000e+02,4.690000000000000000e+02,4.250000000000000000e+02,5.120000000000000000e+02,4.920000000000000000e+02,4.560000000000000000e+02,4.450000000000000000e+02,4.710000000000000000e+02,4.480000000000000000e+02,4.870000000000000000e+02,5.070000000000000000e+02,5.140000000000000000e+02,4.850000000000000000e+02,4.360000000000000000e+02,4.370000000000000000e+02,4.730000000000000000e+02,4.890000000000000000e+02,5.240000000000000000e+02,5.220000000000000000e+02,5.660000000000000000e+02,5.220000000000000000e+02,5.950000000000000000e+02,5.570000000000000000e+02,5.860000000000000000e+02,5.120000000000000000e+02,6.100000000000000000e+02,5.630000000000000000e+02,5.750000000000000000e+02,5.460000000000000000e+02,5.310000000000000000e+02,5.350000000000000000e+02,4.760000000000000000e+02,5.210000000000000000e+02,5.470000000000000000e+02,5.430000000000000000e+02,4.650000000000000000e+02,4.630000000000000000e+02,4.580000000000000000e+02,4.220000000000000000e+02,4.160000000000000000e+02,4.600000000000000000e+02,4.840000000000000000e+02,4.740000000000000000e+02,5.110000000000000000e+02,5.660000000000000000e+02,5.900000000000000000e+02,5.430000000000000000e+02,5.590000000000000000e+02,4.770000000000000000e+02,4.150000000000000000e+02,4.470000000000000000e+02,4.480000000000000000e+02,4.760000000000000000e+02,4.650000000000000000e+02,5.250000000000000000e+02,5.690000000000000000e+02,5.640000000000000000e+02,5.840000000000000000e+02,6.310000000000000000e+02,6.200000000000000000e+02,5.970000000000000000e+02,5.690000000000000000e+02,5.740000000000000000e+02,5.310000000000000000e+02,4.710000000000000000e+02,4.190000000000000000e+02,4.010000000000000000e+02,4.470000000000000000e+02,4.660000000000000000e+02,5.170000000000000000e+02,4.920000000000000000e+02,5.410000000000000000e+02,5.080000000000000000e+02,4.830000000000000000e+02,5.160000000000000000e+02,5.020000000000000000e+02,5.210000000000000000e+02,5.130000000000000000e+02,4.620000000000000000e+02,4.920000000000000000e+02,5.040000000000000000e+02,5.430000000000000000e+02,5.290000000000000000e+02,4.870000000000000000e+02,4.910000000000000000e+02,4.920000000000000000e+02,5.050000000000000000e+02,4.940000000000000000e+02,4.670000000000000000e+02,5.140000000000000000e+02,5.380000000000000000e+02,4.740000000000000000e+02,5.250000000000000000e+02,5.820000000000000000e+02,6.120000000000000000e+02,5.770000000000000000e+02,5.980000000000000000e+02,5.930000000000000000e+02,5.080000000000000000e+02,5.330000000000000000e+02,4.660000000000000000e+02,4.490000000000000000e+02,4.830000000000000000e+02,4.620000000000000000e+02,4.810000000000000000e+02,4.480000000000000000e+02,5.220000000000000000e+02,4.880000000000000000e+02,5.040000000000000000e+02,5.160000000000000000e+02,5.530000000000000000e+02,5.620000000000000000e+02,4.800000000000000000e+02,4.640000000000000000e+02,4.460000000000000000e+02,4.340000000000000000e+02,4.230000000000000000e+02,4.470000000000000000e+02,5.600000000000000000e+02,5.370000000000000000e+02,5.190000000000000000e+02,5.670000000000000000e+02,5.530000000000000000e+02,6.030000000000000000e+02,5.520000000000000000e+02,5.160000000000000000e+02,5.630000000000000000e+02,5.710000000000000000e+02,5.570000000000000000e+02,5.600000000000000000e+02,5.560000000000000000e+02,5.060000000000000000e+02,5.180000000000000000e+02,4.880000000000000000e+02,4.630000000000000000e+02,4.090000000000000000e+02,4.570000000000000000e+02,4.660000000000000000e+02,4.690000000000000000e+02,4.910000000000000000e+02,4.590000000000000000e+02,4.500000000000000000e+02,4.770000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.430000000000000000e+02,5.740000000000000000e+02,5.750000000000000000e+02,5.180000000000000000e+02,5.530000000000000000e+02,5.270000000000000000e+02,5.190000000000000000e+02,4.750000000000000000e+02,4.620000000000000000e+02,5.050000000000000000e+02,5.280000000000000000e+02,5.420000000000000000e+02,5.770000000000000000e+02,5.640000000000000000e+02,5.850000000000000000e+02,5.690000000000000000e+02,5.380000000000000000e+02,4.850000000000000000e+02,4.980000000000000000e+02,5.120000000000000000e+02,4.970000000000000000e+02,4.640000000000000000e+02,4.650000000000000000e+02,4.260000000000000000e+02,4.420000000000000000e+02,4.810000000000000000e+02,4.840000000000000000e+02,4.850000000000000000e+02,5.140000000000000000e+02,5.590000000000000000e+02,5.530000000000000000e+02,5.480000000000000000e+02,5.140000000000000000e+02,4.770000000000000000e+02,5.000000000000000000e+02,4.870000000000000000e+02,4.830000000000000000e+02,5.150000000000000000e+02,5.470000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.370000000000000000e+02,5.510000000000000000e+02,4.890000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.410000000000000000e+02,5.410000000000000000e+02,5.180000000000000000e+02,5.830000000000000000e+02,5.340000000000000000e+02,5.350000000000000000e+02,5.000000000000000000e+02,5.010000000000000000e+02,4.790000000000000000e+02,4.200000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.290000000000000000e+02,5.200000000000000000e+02,4.940000000000000000e+02,5.110000000000000000e+02,5.020000000000000000e+02,4.870000000000000000e+02,5.240000000000000000e+02,4.720000000000000000e+02,5.320000000000000000e+02,5.120000000000000000e+02,5.290000000000000000e+02,5.110000000000000000e+02,4.850000000000000000e+02,4.420000000000000000e+02,4.690000000000000000e+02,4.620000000000000000e+02,4.690000000000000000e+02,5.520000000000000000e+02,5.350000000000000000e+02,5.700000000000000000e+02,5.580000000000000000e+02,5.610000000000000000e+02,5.900000000000000000e+02,5.600000000000000000e+02,5.330000000000000000e+02,4.950000000000000000e+02,5.200000000000000000e+02,5.310000000000000000e+02,4.680000000000000000e+02,4.370000000000000000e+02,4.710000000000000000e+02,4.970000000000000000e+02,4.920000000000000000e+02,4.850000000000000000e+02,5.430000000000000000e+02,5.660000000000000000e+02,5.400000000000000000e+02,5.550000000000000000e+02,5.490000000000000000e+02,4.730000000000000000e+02,4.740000000000000000e+02,4.710000000000000000e+02,5.010000000000000000e+02,5.000000000000000000e+02,5.250000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.020000000000000000e+02,5.220000000000000000e+02,5.040000000000000000e+02,4.900000000000000000e+02,4.810000000000000000e+02,5.020000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.210000000000000000e+02,5.580000000000000000e+02,5.520000000000000000e+02,5.000000000000000000e+02,4.870000000000000000e+02,5.110000000000000000e+02,4.890000000000000000e+02,5.190000000000000000e+02,5.070000000000000000e+02,4.670000000000000000e+02,5.180000000000000000e+02,4.950000000000000000e+02,5.090000000000000000e+02,5.580000000000000000e+02,5.260000000000000000e+02,5.370000000000000000e+02,5.440000000000000000e+02,5.650000000000000000e+02,5.580000000000000000e+02,5.390000000000000000e+02,5.130000000000000000e+02,4.910000000000000000e+02,4.390000000000000000e+02,4.550000000000000000e+02,4.740000000000000000e+02,4.690000000000000000e+02,4.760000000000000000e+02,4.940000000000000000e+02,5.250000000000000000e+02,5.370000000000000000e+02,5.260000000000000000e+02,4.940000000000000000e+02,5.520000000000000000e+02,5.760000000000000000e+02,5.550000000000000000e+02,5.470000000000000000e+02,4.990000000000000000e+02,5.010000000000000000e+02,4.920000000000000000e+02,5.050000000000000000e+02,4.950000000000000000e+02,5.090000000000000000e+02,5.020000000000000000e+02,5.110000000000000000e+02,5.440000000000000000e+02,5.080000000000000000e+02,4.680000000000000000e+02,4.660000000000000000e+02,4.860000000000000000e+02,4.940000000000000000e+02,5.040000000000000000e+02,5.170000000000000000e+02,5.080000000000000000e+02,5.390000000000000000e+02,5.270000000000000000e+02,5.080000000000000000e+02,5.160000000000000000e+02,4.760000000000000000e+02,4.960000000000000000e+02,5.240000000000000000e+02,5.490000000000000000e+02,5.450000000000000000e+02,5.080000000000000000e+02,5.680000000000000000e+02,5.570000000000000000e+02,5.480000000000000000e+02,5.010000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.270000000000000000e+02,5.010000000000000000e+02,5.100000000000000000e+02,4.690000000000000000e+02,4.750000000000000000e+02,4.380000000000000000e+02,4.670000000000000000e+02,4.810000000000000000e+02,5.220000000000000000e+02,5.060000000000000000e+02,5.170000000000000000e+02,5.350000000000000000e+02,5.360000000000000000e+02,5.530000000000000000e+02,5.370000000000000000e+02,5.570000000000000000e+02,5.320000000000000000e+02,5.280000000000000000e+02,4.940000000000000000e+02,4.900000000000000000e+02,4.840000000000000000e+02,5.070000000000000000e+02,5.250000000000000000e+02,5.460000000000000000e+02,5.150000000000000000e+02,4.840000000000000000e+02,4.840000000000000000e+02,5.070000000000000000e+02,4.840000000000000000e+02,5.290000000000000000e+02,5.410000000000000000e+02,5.100000000000000000e+02,4.880000000000000000e+02,4.700000000000000000e+02,4.850000000000000000e+02,4.720000000000000000e+02,4.970000000000000000e+02,5.360000000000000000e+02,5.590000000000000000e+02,5.430000000000000000e+02,5.380000000000000000e+02,5.230000000000000000e+02,4.850000000000000000e+02,4.820000000000000000e+02,4.990000000000000000e+02,5.300000000000000000e+02,5.490000000000000000e+02,5.340000000000000000e+02,5.300000000000000000e+02,5.450000000000000000e+02,5.280000000000000000e+02,4.880000000000000000e+02,4.710000000000000000e+02,4.970000000000000000e+02,4.840000000000000000e+02,4.920000000000000000e+02,5.070000000000000000e+02,4.870000000000000000e+02,5.140000000000000000e+02,5.000000000000000000e+02,5.230000000000000000e+02,5.140000000000000000e+02,5.280000000000000000e+02,5.360000000000000000e+02,5.410000000000000000e+02,5.290000000000000000e+02,5.180000000000000000e+02,4.840000000000000000e+02,4.760000000000000000e+02,5.190000000000000000e+02,5.340000000000000000e+02,4.900000000000000000e+02,4.960000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,4.910000000000000000e+02,5.260000000000000000e+02,5.380000000000000000e+02,5.360000000000000000e+02,5.250000000000000000e+02,5.170000000000000000e+02,5.100000000000000000e+02,4.820000000000000000e+02,4.780000000000000000e+02,5.120000000000000000e+02,5.270000000000000000e+02,5.750000000000000000e+02,5.310000000000000000e+02,4.960000000000000000e+02,5.110000000000000000e+02,5.380000000000000000e+02,5.240000000000000000e+02,5.300000000000000000e+02,5.220000000000000000e+02,5.270000000000000000e+02,5.000000000000000000e+02,4.730000000000000000e+02,4.710000000000000000e+02,4.580000000000000000e+02,4.910000000000000000e+02,5.060000000000000000e+02,4.940000000000000000e+02,4.860000000000000000e+02,4.750000000000000000e+02,4.910000000000000000e+02,4.980000000000000000e+02,4.810000000000000000e+02,5.050000000000000000e+02,5.250000000000000000e+02,5.440000000000000000e+02,5.300000000000000000e+02,5.770000000000000000e+02,5.450000000000000000e+02,5.240000000000000000e+02,5.330000000000000000e+02,5.490000000000000000e+02,5.080000000000000000e+02,5.320000000000000000e+02,5.390000000000000000e+02,5.560000000000000000e+02,4.970000000000000000e+02,5.030000000000000000e+02,4.910000000000000000e+02,4.960000000000000000e+02,5.000000000000000000e+02,5.070000000000000000e+02,4.920000000000000000e+02,5.080000000000000000e+02,5.290000000000000000e+02,4.990000000000000000e+02,4.960000000000000000e+02,5.120000000000000000e+02,5.050000000000000000e+02,4.740000000000000000e+02,4.820000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.260000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.270000000000000000e+02,5.250000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,4.990000000000000000e+02,4.920000000000000000e+02,5.060000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.200000000000000000e+02,5.120000000000000000e+02,4.980000000000000000e+02,5.080000000000000000e+02,5.280000000000000000e+02,5.530000000000000000e+02,5.350000000000000000e+02,5.300000000000000000e+02,5.280000000000000000e+02,5.020000000000000000e+02,5.300000000000000000e+02,5.270000000000000000e+02,4.880000000000000000e+02,4.750000000000000000e+02,4.930000000000000000e+02,5.260000000000000000e+02,5.280000000000000000e+02,4.910000000000000000e+02,4.900000000000000000e+02,4.970000000000000000e+02,4.850000000000000000e+02,4.840000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,5.210000000000000000e+02,5.300000000000000000e+02,5.250000000000000000e+02,4.930000000000000000e+02,5.110000000000000000e+02,5.310000000000000000e+02,5.440000000000000000e+02,5.540000000000000000e+02,5.270000000000000000e+02,5.190000000000000000e+02,5.240000000000000000e+02,5.230000000000000000e+02,5.010000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.010000000000000000e+02,5.100000000000000000e+02,4.960000000000000000e+02,4.980000000000000000e+02,4.960000000000000000e+02,5.120000000000000000e+02,4.860000000000000000e+02,4.760000000000000000e+02,4.800000000000000000e+02,4.750000000000000000e+02,4.890000000000000000e+02,4.940000000000000000e+02,4.970000000000000000e+02,5.190000000000000000e+02,4.980000000000000000e+02,5.320000000000000000e+02,5.710000000000000000e+02,5.280000000000000000e+02,5.210000000000000000e+02,5.420000000000000000e+02,5.240000000000000000e+02,5.310000000000000000e+02,5.210000000000000000e+02,5.360000000000000000e+02,5.300000000000000000e+02,5.450000000000000000e+02,5.200000000000000000e+02,5.470000000000000000e+02,5.370000000000000000e+02,5.210000000000000000e+02,5.080000000000000000e+02,4.860000000000000000e+02,5.030000000000000000e+02,4.970000000000000000e+02,4.680000000000000000e+02,4.620000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,4.990000000000000000e+02,5.140000000000000000e+02,4.890000000000000000e+02,4.920000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.040000000000000000e+02,5.010000000000000000e+02,5.200000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,4.940000000000000000e+02,5.000000000000000000e+02,4.810000000000000000e+02,4.930000000000000000e+02,4.860000000000000000e+02,5.000000000000000000e+02,5.190000000000000000e+02,5.460000000000000000e+02,5.100000000000000000e+02,5.240000000000000000e+02,5.440000000000000000e+02,5.360000000000000000e+02,5.380000000000000000e+02,5.920000000000000000e+02,5.650000000000000000e+02,5.570000000000000000e+02,5.530000000000000000e+02,5.000000000000000000e+02,5.160000000000000000e+02,5.010000000000000000e+02,4.770000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,4.870000000000000000e+02,4.850000000000000000e+02,4.820000000000000000e+02,4.760000000000000000e+02,4.700000000000000000e+02,4.680000000000000000e+02,4.920000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,4.950000000000000000e+02,5.100000000000000000e+02,4.940000000000000000e+02,5.090000000000000000e+02,4.800000000000000000e+02,5.220000000000000000e+02,5.300000000000000000e+02,5.230000000000000000e+02,5.480000000000000000e+02,5.480000000000000000e+02,5.540000000000000000e+02,5.520000000000000000e+02,5.230000000000000000e+02,5.330000000000000000e+02,5.120000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.220000000000000000e+02,5.000000000000000000e+02,4.900000000000000000e+02,5.240000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.190000000000000000e+02,5.020000000000000000e+02,4.980000000000000000e+02,4.990000000000000000e+02,4.920000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.310000000000000000e+02,5.130000000000000000e+02,5.040000000000000000e+02,4.950000000000000000e+02,4.830000000000000000e+02,5.020000000000000000e+02,5.180000000000000000e+02,5.280000000000000000e+02,5.000000000000000000e+02,4.760000000000000000e+02,4.860000000000000000e+02,5.080000000000000000e+02,5.010000000000000000e+02,4.960000000000000000e+02,5.180000000000000000e+02,5.330000000000000000e+02,5.270000000000000000e+02,5.470000000000000000e+02,5.470000000000000000e+02,5.290000000000000000e+02,5.010000000000000000e+02,4.960000000000000000e+02,5.080000000000000000e+02,5.250000000000000000e+02,5.260000000000000000e+02,5.220000000000000000e+02,5.370000000000000000e+02,5.270000000000000000e+02,5.200000000000000000e+02,5.270000000000000000e+02,5.010000000000000000e+02,5.220000000000000000e+02,5.190000000000000000e+02,5.090000000000000000e+02,4.900000000000000000e+02,4.790000000000000000e+02,4.660000000000000000e+02,4.800000000000000000e+02,4.850000000000000000e+02,4.950000000000000000e+02,4.850000000000000000e+02,5.200000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,4.880000000000000000e+02,5.150000000000000000e+02,5.030000000000000000e+02,5.190000000000000000e+02,5.300000000000000000e+02,5.330000000000000000e+02,5.460000000000000000e+02,5.380000000000000000e+02,5.320000000000000000e+02,5.380000000000000000e+02,5.360000000000000000e+02,5.210000000000000000e+02,5.340000000000000000e+02,5.300000000000000000e+02,5.130000000000000000e+02,4.880000000000000000e+02,5.050000000000000000e+02,4.980000000000000000e+02,4.970000000000000000e+02,5.020000000000000000e+02,4.960000000000000000e+02,4.870000000000000000e+02,4.780000000000000000e+02,4.850000000000000000e+02,4.770000000000000000e+02,5.040000000000000000e+02,5.150000000000000000e+02,5.260000000000000000e+02,5.240000000000000000e+02,5.230000000000000000e+02,4.940000000000000000e+02,5.040000000000000000e+02,5.330000000000000000e+02,5.330000000000000000e+02,5.330000000000000000e+02,5.300000000000000000e+02,5.310000000000000000e+02,5.380000000000000000e+02,5.530000000000000000e+02,5.150000000000000000e+02,4.890000000000000000e+02,4.890000000000000000e+02,4.940000000000000000e+02,4.870000000000000000e+02,5.000000000000000000e+02,4.990000000000000000e+02,5.020000000000000000e+02,5.160000000000000000e+02,4.960000000000000000e+02,5.420000000000000000e+02,5.240000000000000000e+02,5.170000000000000000e+02,5.340000000000000000e+02,5.440000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,4.750000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.090000000000000000e+02,4.990000000000000000e+02,4.910000000000000000e+02,4.950000000000000000e+02,5.010000000000000000e+02,4.890000000000000000e+02,5.030000000000000000e+02,5.250000000000000000e+02,5.280000000000000000e+02,5.070000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.120000000000000000e+02,5.290000000000000000e+02,5.290000000000000000e+02,5.400000000000000000e+02,5.320000000000000000e+02,5.250000000000000000e+02,4.860000000000000000e+02,4.960000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.160000000000000000e+02,5.280000000000000000e+02,5.400000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.070000000000000000e+02,4.900000000000000000e+02,4.990000000000000000e+02,5.020000000000000000e+02,5.150000000000000000e+02,5.050000000000000000e+02,4.860000000000000000e+02,4.740000000000000000e+02,4.860000000000000000e+02,4.940000000000000000e+02,4.820000000000000000e+02,4.990000000000000000e+02,5.090000000000000000e+02,5.190000000000000000e+02,5.270000000000000000e+02,5.430000000000000000e+02,5.490000000000000000e+02,5.250000000000000000e+02,5.350000000000000000e+02,5.430000000000000000e+02,5.390000000000000000e+02,5.310000000000000000e+02,5.260000000000000000e+02,5.380000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,4.850000000000000000e+02,5.050000000000000000e+02,4.840000000000000000e+02,4.860000000000000000e+02,4.990000000000000000e+02,5.140000000000000000e+02,5.000000000000000000e+02,5.110000000000000000e+02,4.950000000000000000e+02,4.910000000000000000e+02,4.940000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.260000000000000000e+02,5.310000000000000000e+02,5.280000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.120000000000000000e+02,5.010000000000000000e+02,5.190000000000000000e+02,5.350000000000000000e+02,5.290000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,4.950000000000000000e+02,5.100000000000000000e+02,5.010000000000000000e+02,4.920000000000000000e+02,5.010000000000000000e+02,5.130000000000000000e+02,5.200000000000000000e+02,5.240000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.190000000000000000e+02,5.270000000000000000e+02,5.260000000000000000e+02,5.290000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.060000000000000000e+02,4.940000000000000000e+02,4.860000000000000000e+02,4.860000000000000000e+02,4.780000000000000000e+02,4.790000000000000000e+02,4.840000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.200000000000000000e+02,5.150000000000000000e+02,5.010000000000000000e+02,5.180000000000000000e+02,5.110000000000000000e+02,5.310000000000000000e+02,5.320000000000000000e+02,5.280000000000000000e+02,5.350000000000000000e+02,5.380000000000000000e+02,5.310000000000000000e+02,5.310000000000000000e+02,5.340000000000000000e+02,5.230000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.200000000000000000e+02,5.270000000000000000e+02,5.110000000000000000e+02,5.210000000000000000e+02,5.140000000000000000e+02,4.920000000000000000e+02,4.790000000000000000e+02,4.730000000000000000e+02,4.600000000000000000e+02,4.870000000000000000e+02,4.880000000000000000e+02,4.840000000000000000e+02,5.060000000000000000e+02,5.260000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.180000000000000000e+02,5.280000000000000000e+02,5.330000000000000000e+02,5.350000000000000000e+02,5.120000000000000000e+02,5.210000000000000000e+02,5.250000000000000000e+02,5.190000000000000000e+02,5.060000000000000000e+02,5.140000000000000000e+02,5.020000000000000000e+02,5.170000000000000000e+02,5.050000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.000000000000000000e+02,5.320000000000000000e+02,5.380000000000000000e+02,5.060000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,4.970000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.090000000000000000e+02,5.040000000000000000e+02,5.010000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.010000000000000000e+02,4.990000000000000000e+02,5.000000000000000000e+02,4.890000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.050000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.250000000000000000e+02,5.230000000000000000e+02,5.500000000000000000e+02,5.450000000000000000e+02,5.450000000000000000e+02,5.260000000000000000e+02,5.220000000000000000e+02,5.070000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.010000000000000000e+02,5.180000000000000000e+02,4.970000000000000000e+02,4.830000000000000000e+02,4.950000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.040000000000000000e+02,4.990000000000000000e+02,5.030000000000000000e+02,5.130000000000000000e+02,4.950000000000000000e+02,4.940000000000000000e+02,5.000000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.330000000000000000e+02,5.270000000000000000e+02,5.390000000000000000e+02,5.290000000000000000e+02,5.170000000000000000e+02,5.210000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.190000000000000000e+02,5.270000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,4.950000000000000000e+02,5.060000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.350000000000000000e+02,5.220000000000000000e+02,5.190000000000000000e+02,5.190000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,4.920000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,4.960000000000000000e+02,5.010000000000000000e+02,4.980000000000000000e+02,4.920000000000000000e+02,4.930000000000000000e+02,4.960000000000000000e+02,5.070000000000000000e+02,5.160000000000000000e+02,5.050000000000000000e+02,5.310000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.300000000000000000e+02,5.340000000000000000e+02,5.360000000000000000e+02,5.340000000000000000e+02,5.290000000000000000e+02,5.250000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.270000000000000000e+02,5.200000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,4.970000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.000000000000000000e+02,5.020000000000000000e+02,4.890000000000000000e+02,5.090000000000000000e+02,5.000000000000000000e+02,4.980000000000000000e+02,5.030000000000000000e+02,5.070000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.090000000000000000e+02,5.200000000000000000e+02,5.280000000000000000e+02,5.220000000000000000e+02,5.230000000000000000e+02,5.110000000000000000e+02,5.200000000000000000e+02,5.110000000000000000e+02,5.010000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.020000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.030000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.000000000000000000e+02,4.920000000000000000e+02,5.180000000000000000e+02,5.120000000000000000e+02,5.050000000000000000e+02,5.290000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.050000000000000000e+02,5.210000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,4.910000000000000000e+02,4.950000000000000000e+02,5.140000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.250000000000000000e+02,5.280000000000000000e+02,5.170000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.020000000000000000e+02,5.230000000000000000e+02,5.280000000000000000e+02,5.210000000000000000e+02,5.020000000000000000e+02,5.150000000000000000e+02,5.030000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.030000000000000000e+02,4.950000000000000000e+02,5.000000000000000000e+02,4.990000000000000000e+02,4.960000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,4.960000000000000000e+02,4.940000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.270000000000000000e+02,5.180000000000000000e+02,5.060000000000000000e+02,5.200000000000000000e+02,5.250000000000000000e+02,5.240000000000000000e+02,5.220000000000000000e+02,5.050000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,4.980000000000000000e+02,5.200000000000000000e+02,5.180000000000000000e+02,5.210000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.000000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,4.980000000000000000e+02,4.960000000000000000e+02,5.080000000000000000e+02,5.240000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.120000000000000000e+02,5.220000000000000000e+02,5.290000000000000000e+02,5.210000000000000000e+02,5.280000000000000000e+02,5.370000000000000000e+02,5.170000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,4.980000000000000000e+02,4.920000000000000000e+02,5.020000000000000000e+02,5.220000000000000000e+02,5.190000000000000000e+02,4.950000000000000000e+02,4.950000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.080000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.200000000000000000e+02,5.100000000000000000e+02,5.230000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.160000000000000000e+02,5.210000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,5.230000000000000000e+02,5.270000000000000000e+02,5.240000000000000000e+02,5.230000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.220000000000000000e+02,5.220000000000000000e+02,5.210000000000000000e+02,5.110000000000000000e+02,4.870000000000000000e+02,4.970000000000000000e+02,4.940000000000000000e+02,4.920000000000000000e+02,5.010000000000000000e+02,5.000000000000000000e+02,5.080000000000000000e+02,4.960000000000000000e+02,5.030000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.220000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.200000000000000000e+02,5.000000000000000000e+02,5.060000000000000000e+02,5.160000000000000000e+02,5.250000000000000000e+02,5.170000000000000000e+02,5.270000000000000000e+02,5.290000000000000000e+02,5.260000000000000000e+02,5.210000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.130000000000000000e+02,5.280000000000000000e+02,5.390000000000000000e+02,5.240000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,4.950000000000000000e+02,4.970000000000000000e+02,5.080000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,4.970000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,4.980000000000000000e+02,4.930000000000000000e+02,5.010000000000000000e+02,5.030000000000000000e+02,5.050000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,4.990000000000000000e+02,5.250000000000000000e+02,5.140000000000000000e+02,5.330000000000000000e+02,5.290000000000000000e+02,5.200000000000000000e+02,5.150000000000000000e+02,5.200000000000000000e+02,5.310000000000000000e+02,5.380000000000000000e+02,5.290000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,4.960000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,4.990000000000000000e+02,5.050000000000000000e+02,4.960000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,4.980000000000000000e+02,5.050000000000000000e+02,5.130000000000000000e+02,5.190000000000000000e+02,5.250000000000000000e+02,5.230000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.380000000000000000e+02,5.360000000000000000e+02,5.260000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.210000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.030000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.000000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,4.900000000000000000e+02,4.770000000000000000e+02,4.870000000000000000e+02,4.930000000000000000e+02,5.010000000000000000e+02,4.950000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.210000000000000000e+02,5.230000000000000000e+02,5.310000000000000000e+02,5.370000000000000000e+02,5.230000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.230000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.370000000000000000e+02,5.280000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,4.910000000000000000e+02,5.040000000000000000e+02,4.940000000000000000e+02,4.950000000000000000e+02,4.950000000000000000e+02,4.920000000000000000e+02,4.840000000000000000e+02,4.890000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,5.180000000000000000e+02,5.300000000000000000e+02,5.240000000000000000e+02,5.190000000000000000e+02,5.050000000000000000e+02,4.940000000000000000e+02,5.030000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.220000000000000000e+02,5.300000000000000000e+02,5.310000000000000000e+02,5.250000000000000000e+02,5.170000000000000000e+02,4.960000000000000000e+02,4.970000000000000000e+02,4.970000000000000000e+02,5.100000000000000000e+02,5.200000000000000000e+02,5.150000000000000000e+02,5.230000000000000000e+02,5.210000000000000000e+02,5.190000000000000000e+02,5.370000000000000000e+02,5.260000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,4.990000000000000000e+02,5.020000000000000000e+02,4.950000000000000000e+02,4.970000000000000000e+02,5.000000000000000000e+02,5.060000000000000000e+02,4.990000000000000000e+02,5.060000000000000000e+02,5.030000000000000000e+02,5.140000000000000000e+02,5.240000000000000000e+02,5.250000000000000000e+02,5.180000000000000000e+02,5.120000000000000000e+02,4.950000000000000000e+02,4.910000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.150000000000000000e+02,5.240000000000000000e+02,5.240000000000000000e+02,5.250000000000000000e+02,5.310000000000000000e+02,5.150000000000000000e+02,5.230000000000000000e+02,5.270000000000000000e+02,5.190000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.060000000000000000e+02,5.010000000000000000e+02,4.990000000000000000e+02,4.950000000000000000e+02,5.020000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.000000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,4.990000000000000000e+02,5.130000000000000000e+02,5.030000000000000000e+02,5.150000000000000000e+02,5.360000000000000000e+02,5.350000000000000000e+02,5.290000000000000000e+02,5.030000000000000000e+02,5.020000000000000000e+02,4.950000000000000000e+02,5.100000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.240000000000000000e+02,5.290000000000000000e+02,5.330000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.020000000000000000e+02,5.120000000000000000e+02,4.980000000000000000e+02,4.980000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.140000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.300000000000000000e+02,5.220000000000000000e+02,5.150000000000000000e+02,5.020000000000000000e+02,4.980000000000000000e+02,5.010000000000000000e+02,4.970000000000000000e+02,5.010000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.230000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.280000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.030000000000000000e+02,4.870000000000000000e+02,4.930000000000000000e+02,5.030000000000000000e+02,5.070000000000000000e+02,5.240000000000000000e+02,5.270000000000000000e+02,5.210000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,4.990000000000000000e+02,5.060000000000000000e+02,5.010000000000000000e+02,5.040000000000000000e+02,5.220000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.080000000000000000e+02,5.030000000000000000e+02,5.090000000000000000e+02,5.260000000000000000e+02,5.370000000000000000e+02,5.420000000000000000e+02,5.350000000000000000e+02,5.260000000000000000e+02,5.240000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,4.910000000000000000e+02,4.950000000000000000e+02,4.940000000000000000e+02,5.000000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.300000000000000000e+02,5.240000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,4.980000000000000000e+02,4.980000000000000000e+02,5.040000000000000000e+02,5.010000000000000000e+02,5.140000000000000000e+02,5.050000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.230000000000000000e+02,5.280000000000000000e+02,5.210000000000000000e+02,5.210000000000000000e+02,5.360000000000000000e+02,5.240000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,4.970000000000000000e+02,5.010000000000000000e+02,4.980000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.050000000000000000e+02,5.000000000000000000e+02,4.990000000000000000e+02,5.050000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,5.100000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.270000000000000000e+02,5.120000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,4.990000000000000000e+02,5.080000000000000000e+02,5.130000000000000000e+02,5.240000000000000000e+02,5.190000000000000000e+02,5.280000000000000000e+02,5.300000000000000000e+02,5.420000000000000000e+02,5.250000000000000000e+02,5.320000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,4.980000000000000000e+02,4.980000000000000000e+02,4.930000000000000000e+02,4.900000000000000000e+02,4.900000000000000000e+02,4.870000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.100000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.000000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.280000000000000000e+02,5.260000000000000000e+02,5.230000000000000000e+02,5.200000000000000000e+02,5.340000000000000000e+02,5.320000000000000000e+02,5.280000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.080000000000000000e+02,4.990000000000000000e+02,5.080000000000000000e+02,5.000000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.000000000000000000e+02,4.950000000000000000e+02,4.990000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.220000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.160000000000000000e+02,5.230000000000000000e+02,5.260000000000000000e+02,5.260000000000000000e+02,5.270000000000000000e+02,5.320000000000000000e+02,5.310000000000000000e+02,5.290000000000000000e+02,5.160000000000000000e+02,5.220000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.010000000000000000e+02,4.950000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.080000000000000000e+02,4.980000000000000000e+02,4.870000000000000000e+02,4.990000000000000000e+02,4.930000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.090000000000000000e+02,5.240000000000000000e+02,5.240000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.210000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,4.990000000000000000e+02,5.020000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.140000000000000000e+02,5.280000000000000000e+02,5.340000000000000000e+02,5.340000000000000000e+02,5.180000000000000000e+02,5.090000000000000000e+02,5.010000000000000000e+02,5.010000000000000000e+02,4.890000000000000000e+02,4.840000000000000000e+02,4.840000000000000000e+02,4.770000000000000000e+02,4.910000000000000000e+02,5.030000000000000000e+02,5.100000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.290000000000000000e+02,5.280000000000000000e+02,5.220000000000000000e+02,5.250000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.220000000000000000e+02,5.220000000000000000e+02,5.170000000000000000e+02,5.210000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.000000000000000000e+02,5.020000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.060000000000000000e+02,4.980000000000000000e+02,5.040000000000000000e+02,5.050000000000000000e+02,4.980000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.160000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.020000000000000000e+02,5.100000000000000000e+02,5.230000000000000000e+02,5.280000000000000000e+02,5.400000000000000000e+02,5.450000000000000000e+02,5.390000000000000000e+02,5.270000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.000000000000000000e+02,5.060000000000000000e+02,4.990000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,4.950000000000000000e+02,4.900000000000000000e+02,4.920000000000000000e+02,4.980000000000000000e+02,5.040000000000000000e+02,5.140000000000000000e+02,5.210000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.040000000000000000e+02,4.990000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.190000000000000000e+02,5.250000000000000000e+02,5.270000000000000000e+02,5.230000000000000000e+02,5.230000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.250000000000000000e+02,5.220000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.000000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.000000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.320000000000000000e+02,5.270000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,4.990000000000000000e+02,5.010000000000000000e+02,4.940000000000000000e+02,4.910000000000000000e+02,4.970000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.260000000000000000e+02,5.260000000000000000e+02,5.250000000000000000e+02,5.260000000000000000e+02,5.230000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.000000000000000000e+02,4.970000000000000000e+02,4.990000000000000000e+02,4.990000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.000000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.290000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.300000000000000000e+02,5.230000000000000000e+02,5.250000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.030000000000000000e+02,5.080000000000000000e+02,5.000000000000000000e+02,4.970000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.000000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.020000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.240000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.240000000000000000e+02,5.240000000000000000e+02,5.170000000000000000e+02,5.020000000000000000e+02,4.980000000000000000e+02,5.010000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.010000000000000000e+02,4.980000000000000000e+02,5.040000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.040000000000000000e+02,5.050000000000000000e+02,5.190000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,4.940000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.190000000000000000e+02,5.270000000000000000e+02,5.320000000000000000e+02,5.300000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.040000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,4.970000000000000000e+02,5.010000000000000000e+02,4.980000000000000000e+02,4.970000000000000000e+02,5.080000000000000000e+02,5.220000000000000000e+02,5.240000000000000000e+02,5.230000000000000000e+02,5.280000000000000000e+02,5.220000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,4.990000000000000000e+02,5.030000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,5.050000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.250000000000000000e+02,5.230000000000000000e+02,5.200000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,4.990000000000000000e+02,4.970000000000000000e+02,5.080000000000000000e+02,5.000000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.050000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.240000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.100000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.260000000000000000e+02,5.290000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,4.980000000000000000e+02,4.980000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.180000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.220000000000000000e+02,5.230000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.020000000000000000e+02,4.970000000000000000e+02,5.010000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.230000000000000000e+02,5.210000000000000000e+02,5.240000000000000000e+02,5.200000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.000000000000000000e+02,4.900000000000000000e+02,4.950000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.180000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.230000000000000000e+02,5.230000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.220000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.020000000000000000e+02,5.010000000000000000e+02,5.000000000000000000e+02,5.040000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.010000000000000000e+02,4.980000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.150000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.250000000000000000e+02,5.230000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,4.940000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.260000000000000000e+02,5.240000000000000000e+02,5.260000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.040000000000000000e+02,5.010000000000000000e+02,5.030000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.040000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,4.960000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.270000000000000000e+02,5.240000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.020000000000000000e+02,5.090000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.110000000000000000e+02,5.050000000000000000e+02,5.050000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.190000000000000000e+02,5.240000000000000000e+02,5.270000000000000000e+02,5.260000000000000000e+02,5.210000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.000000000000000000e+02,5.020000000000000000e+02,4.930000000000000000e+02,4.940000000000000000e+02,5.030000000000000000e+02,4.970000000000000000e+02,4.980000000000000000e+02,5.020000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.210000000000000000e+02,5.220000000000000000e+02,5.250000000000000000e+02,5.290000000000000000e+02,5.260000000000000000e+02,5.300000000000000000e+02,5.260000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.010000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,5.030000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,4.990000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.210000000000000000e+02,5.220000000000000000e+02,5.280000000000000000e+02,5.250000000000000000e+02,5.300000000000000000e+02,5.210000000000000000e+02,5.200000000000000000e+02,5.150000000000000000e+02,5.050000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,4.970000000000000000e+02,5.020000000000000000e+02,4.960000000000000000e+02,5.010000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.220000000000000000e+02,5.240000000000000000e+02,5.250000000000000000e+02,5.190000000000000000e+02,5.230000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.000000000000000000e+02,4.980000000000000000e+02,5.030000000000000000e+02,4.990000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.300000000000000000e+02,5.270000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.030000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.040000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.060000000000000000e+02,5.010000000000000000e+02,5.020000000000000000e+02,4.960000000000000000e+02,4.940000000000000000e+02,4.940000000000000000e+02,5.050000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.240000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.010000000000000000e+02,5.030000000000000000e+02,5.040000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.240000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,5.020000000000000000e+02,5.080000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.240000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.130000000000000000e+02,5.030000000000000000e+02,4.980000000000000000e+02,4.990000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,4.990000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.030000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.250000000000000000e+02,5.260000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.230000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.000000000000000000e+02,4.950000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.230000000000000000e+02,5.220000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.230000000000000000e+02,5.200000000000000000e+02,5.250000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.060000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.220000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.050000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.050000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.010000000000000000e+02,5.010000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.200000000000000000e+02,5.220000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.030000000000000000e+02,5.030000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.220000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.180000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.220000000000000000e+02,5.180000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.220000000000000000e+02,5.210000000000000000e+02,5.210000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.210000000000000000e+02,5.190000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.220000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,5.030000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.040000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.050000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,};//,
+const uint8_t snare_drum_adpcm[] = {
+240, 242, 243, 195, 179, 196, 179, 179, 196, 179, 179, 196, 179, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179,
+180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195,
+179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180,
+183, 212, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 196, 195, 180, 195, 180, 179, 196,
+163, 194, 211, 179, 196, 165, 133, 218, 5, 188, 255, 11, 119, 128, 168, 41, 32, 0, 233, 11, 153, 138, 128, 24, 48, 21, 9, 49, 20, 113, 0, 146,
+152, 172, 137, 192, 32, 192, 160, 177, 191, 154, 128, 49, 87, 1, 129, 1, 8, 130, 25, 137, 240, 171, 144, 218, 9, 144, 76, 9, 180, 96, 17, 130,
+18, 17, 131, 176, 220, 184, 155, 10, 173, 134, 139, 9, 155, 83, 7, 32, 129, 0, 200, 41, 33, 27, 149, 170, 26, 174, 140, 186, 112, 129, 129, 27,
+36, 83, 147, 203, 8, 66, 0, 208, 143, 128, 11, 33, 33, 129, 251, 9, 136, 19, 7, 24, 24, 129, 171, 137, 145, 97, 128, 46, 142, 40, 137, 0,
+129, 1, 145, 26, 115, 240, 41, 16, 130, 161, 168, 50, 169, 154, 251, 41, 240, 2, 177, 162, 24, 21, 96, 89, 186, 162, 136, 1, 153, 154, 135, 146,
+152, 169, 11, 4, 41, 1, 12, 40, 58, 37, 23, 75, 128, 201, 152, 24, 15, 176, 35, 130, 14, 140, 131, 56, 74, 133, 8, 57, 224, 32, 2, 173,
+184, 194, 64, 137, 162, 192, 149, 45, 16, 16, 20, 136, 128, 155, 27, 147, 91, 16, 143, 0, 219, 3, 145, 170, 73, 168, 20, 135, 40, 18, 146, 161,
+159, 161, 137, 146, 141, 41, 248, 144, 52, 136, 88, 144, 10, 4, 138, 59, 3, 138, 10, 208, 136, 200, 89, 138, 16, 31, 1, 18, 64, 177, 240, 128,
+133, 26, 57, 26, 120, 216, 152, 27, 48, 18, 139, 176, 122, 40, 74, 0, 2, 156, 20, 27, 201, 217, 152, 149, 16, 209, 0, 8, 22, 152, 136, 211,
+147, 152, 194, 80, 26, 17, 45, 170, 107, 152, 8, 24, 1, 186, 56, 66, 72, 123, 25, 76, 9, 153, 176, 34, 248, 128, 10, 18, 40, 21, 27, 190,
+130, 129, 36, 16, 131, 186, 208, 189, 57, 66, 74, 154, 146, 146, 45, 64, 185, 128, 145, 123, 193, 67, 161, 129, 31, 155, 146, 161, 150, 0, 2, 142,
+152, 24, 135, 24, 40, 154, 2, 136, 200, 160, 234, 3, 16, 139, 51, 88, 131, 46, 138, 155, 36, 49, 41, 217, 30, 144, 10, 28, 3, 48, 133, 184,
+44, 137, 83, 139, 19, 31, 40, 168, 167, 160, 152, 92, 0, 152, 129, 57, 77, 25, 169, 43, 24, 7, 129, 32, 171, 44, 241, 25, 130, 72, 145, 128,
+15, 24, 16, 9, 136, 145, 154, 35, 40, 135, 142, 145, 146, 92, 9, 164, 0, 130, 170, 235, 17, 8, 65, 145, 108, 145, 184, 136, 145, 129, 81, 188,
+40, 16, 146, 149, 26, 31, 34, 200, 133, 184, 128, 178, 209, 176, 19, 149, 17, 16, 41, 140, 141, 40, 51, 174, 40, 106, 177, 154, 145, 99, 146, 153,
+13, 49, 162, 40, 251, 41, 9, 162, 163, 149, 2, 161, 250, 89, 193, 16, 136, 73, 129, 137, 201, 88, 81, 187, 49, 9, 9, 188, 152, 37, 138, 58,
+193, 52, 162, 151, 10, 210, 2, 241, 128, 128, 128, 33, 140, 146, 11, 4, 56, 11, 131, 171, 169, 37, 24, 218, 98, 163, 137, 78, 216, 24, 131, 12,
+144, 72, 144, 128, 34, 249, 18, 18, 156, 0, 12, 8, 161, 136, 213, 9, 40, 1, 180, 55, 140, 145, 128, 129, 194, 148, 170, 59, 249, 104, 136, 161,
+40, 0, 136, 177, 72, 153, 26, 45, 57, 100, 28, 146, 112, 137, 216, 145, 41, 152, 136, 136, 56, 131, 74, 59, 95, 128, 130, 0, 28, 27, 136, 193,
+122, 137, 145, 9, 73, 32, 155, 170, 52, 242, 26, 130, 73, 146, 4, 219, 24, 2, 57, 154, 242, 130, 201, 169, 18, 162, 135, 176, 148, 18, 33, 154,
+146, 60, 217, 46, 9, 128, 170, 162, 39, 129, 216, 65, 8, 8, 33, 191, 24, 41, 8, 211, 151, 24, 193, 128, 75, 128, 153, 16, 58, 4, 44, 152,
+132, 146, 250, 16, 24, 34, 141, 169, 1, 163, 173, 18, 74, 34, 82, 225, 17, 152, 41, 143, 0, 128, 208, 162, 40, 179, 178, 9, 7, 17, 168, 160,
+91, 148, 11, 45, 153, 49, 17, 24, 58, 24, 159, 160, 172, 168, 16, 23, 148, 75, 89, 136, 1, 9, 176, 28, 33, 46, 233, 153, 90, 128, 51, 154,
+144, 64, 18, 240, 1, 169, 177, 164, 145, 16, 242, 6, 27, 152, 24, 75, 144, 153, 2, 176, 9, 109, 8, 24, 132, 134, 176, 185, 18, 28, 74, 173,
+18, 0, 9, 227, 24, 19, 88, 41, 186, 193, 17, 163, 202, 185, 133, 146, 132, 121, 137, 184, 0, 61, 168, 145, 10, 97, 178, 151, 56, 0, 152, 185,
+88, 249, 128, 130, 10, 107, 137, 1, 1, 153, 49, 163, 224, 162, 76, 128, 25, 44, 145, 163, 241, 24, 170, 7, 73, 26, 184, 180, 192, 65, 10, 131,
+2, 187, 226, 21, 201, 162, 130, 170, 129, 72, 184, 121, 18, 186, 20, 136, 13, 193, 133, 160, 41, 153, 133, 140, 66, 154, 33, 162, 50, 175, 136, 153,
+114, 200, 0, 128, 17, 40, 75, 9, 155, 20, 138, 123, 129, 168, 17, 144, 252, 128, 40, 40, 44, 18, 56, 15, 17, 13, 34, 58, 144, 137, 248, 40,
+36, 187, 224, 32, 25, 169, 18, 169, 74, 16, 160, 122, 113, 152, 25, 34, 187, 154, 61, 25, 136, 49, 177, 140, 154, 228, 50, 242, 17, 33, 168, 10,
+114, 177, 138, 194, 136, 42, 57, 145, 31, 137, 189, 19, 163, 7, 162, 18, 34, 158, 40, 145, 42, 122, 216, 8, 44, 10, 136, 26, 20, 52, 153, 189,
+67, 0, 2, 186, 143, 56, 163, 147, 120, 169, 10, 27, 27, 33, 75, 89, 132, 169, 143, 17, 34, 128, 226, 17, 170, 146, 171, 168, 68, 40, 139, 170,
+64, 124, 58, 134, 216, 152, 19, 8, 17, 208, 137, 41, 12, 147, 9, 88, 19, 177, 220, 8, 25, 133, 24, 48, 27, 105, 155, 220, 33, 81, 144, 10,
+137, 59, 26, 7, 137, 139, 32, 58, 71, 161, 138, 156, 25, 128, 217, 129, 50, 115, 168, 232, 0, 56, 90, 8, 145, 88, 186, 225, 128, 2, 160, 137,
+146, 162, 68, 89, 172, 17, 144, 44, 66, 58, 65, 29, 156, 176, 160, 136, 104, 16, 2, 58, 187, 193, 2, 116, 136, 73, 136, 138, 139, 137, 209, 179,
+129, 185, 83, 80, 73, 11, 200, 136, 18, 26, 38, 1, 48, 153, 15, 30, 170, 2, 8, 5, 128, 203, 60, 89, 144, 81, 152, 161, 41, 26, 25, 88,
+137, 138, 15, 132, 162, 21, 208, 154, 192, 136, 73, 34, 148, 131, 26, 11, 142, 1, 136, 96, 160, 129, 9, 153, 232, 32, 0, 32, 189, 2, 108, 73,
+136, 176, 48, 12, 58, 22, 4, 185, 170, 29, 26, 168, 10, 67, 37, 153, 11, 193, 74, 80, 2, 137, 26, 163, 200, 74, 188, 168, 17, 57, 61, 116,
+73, 185, 153, 10, 170, 67, 72, 135, 128, 152, 41, 137, 138, 1, 89, 42, 187, 129, 175, 1, 148, 90, 16, 129, 167, 33, 10, 187, 162, 241, 161, 57,
+33, 17, 177, 249, 144, 152, 35, 5, 106, 129, 154, 132, 251, 25, 1, 41, 24, 161, 152, 104, 232, 130, 139, 82, 40, 8, 136, 10, 146, 16, 143, 185,
+24, 113, 8, 40, 11, 170, 31, 17, 0, 21, 72, 146, 172, 30, 16, 136, 138, 28, 137, 86, 128, 161, 155, 43, 17, 130, 74, 9, 73, 208, 138, 1,
+169, 114, 32, 24, 58, 224, 44, 138, 26, 150, 58, 165, 132, 169, 137, 211, 17, 152, 142, 179, 5, 168, 8, 33, 74, 165, 144, 168, 51, 20, 173, 176,
+218, 56, 9, 18, 49, 156, 145, 129, 115, 242, 128, 0, 136, 4, 128, 143, 130, 0, 168, 154, 96, 19, 176, 201, 172, 18, 17, 123, 1, 18, 41, 251,
+145, 9, 72, 138, 146, 184, 217, 30, 36, 178, 128, 145, 1, 52, 200, 25, 0, 243, 137, 141, 24, 131, 3, 28, 170, 66, 9, 175, 5, 57, 2, 146,
+155, 31, 56, 41, 27, 128, 136, 138, 216, 157, 147, 95, 8, 129, 2, 176, 19, 80, 25, 157, 186, 26, 23, 153, 168, 58, 201, 50, 180, 135, 0, 72,
+168, 153, 136, 19, 8, 13, 170, 9, 133, 43, 248, 163, 24, 105, 11, 165, 34, 18, 184, 9, 189, 18, 4, 200, 155, 186, 242, 72, 10, 34, 4, 49,
+32, 163, 180, 143, 10, 163, 168, 250, 40, 153, 146, 32, 63, 41, 25, 3, 16, 82, 80, 57, 143, 201, 17, 0, 9, 56, 156, 139, 216, 195, 18, 18,
+144, 89, 51, 12, 57, 20, 225, 146, 160, 235, 16, 9, 0, 154, 158, 163, 147, 5, 19, 38, 162, 173, 201, 4, 136, 32, 156, 128, 20, 184, 9, 154,
+165, 160, 36, 129, 56, 49, 61, 44, 174, 129, 18, 50, 44, 14, 91, 160, 187, 209, 9, 39, 33, 9, 200, 161, 58, 33, 0, 24, 141, 168, 184, 16,
+25, 143, 150, 168, 26, 113, 35, 138, 235, 9, 66, 144, 40, 8, 80, 192, 163, 220, 10, 18, 51, 154, 250, 145, 34, 136, 181, 33, 154, 132, 24, 33,
+14, 140, 129, 24, 203, 164, 53, 48, 240, 154, 128, 146, 145, 137, 51, 4, 150, 202, 201, 90, 18, 128, 145, 168, 26, 134, 152, 43, 192, 165, 8, 48,
+27, 148, 17, 176, 250, 139, 90, 18, 50, 201, 27, 136, 26, 185, 112, 20, 66, 152, 221, 152, 129, 21, 168, 152, 138, 81, 72, 12, 136, 24, 27, 129,
+150, 4, 136, 80, 58, 143, 154, 1, 147, 145, 28, 136, 145, 145, 33, 63, 80, 128, 11, 176, 129, 148, 134, 185, 9, 129, 17, 211, 24, 44, 240, 179,
+160, 9, 83, 81, 24, 242, 139, 40, 19, 0, 11, 186, 197, 162, 128, 128, 32, 115, 185, 240, 144, 65, 74, 2, 171, 153, 160, 7, 0, 144, 25, 169,
+210, 8, 211, 17, 129, 36, 170, 222, 56, 18, 130, 41, 185, 149, 24, 189, 8, 135, 129, 160, 168, 138, 121, 129, 2, 194, 169, 137, 134, 130, 128, 8,
+18, 179, 239, 137, 32, 20, 136, 249, 0, 148, 16, 9, 128, 90, 8, 185, 10, 44, 66, 1, 161, 235, 26, 4, 147, 176, 27, 74, 145, 167, 128, 145,
+243, 2, 184, 193, 41, 25, 65, 57, 140, 146, 179, 55, 27, 202, 161, 146, 14, 146, 25, 19, 57, 234, 145, 56, 123, 5, 169, 201, 16, 73, 17, 169,
+186, 1, 113, 186, 152, 33, 71, 10, 217, 169, 82, 34, 161, 171, 67, 160, 251, 168, 145, 19, 162, 144, 176, 241, 88, 66, 1, 138, 44, 12, 2, 154,
+137, 25, 146, 132, 251, 137, 36, 18, 166, 185, 171, 7, 32, 184, 24, 50, 161, 168, 175, 128, 153, 19, 180, 178, 201, 134, 17, 3, 185, 33, 124, 147,
+172, 8, 56, 25, 186, 30, 29, 130, 36, 173, 129, 32, 132, 160, 155, 113, 133, 16, 187, 152, 179, 44, 89, 140, 136, 17, 64, 128, 185, 158, 33, 84,
+145, 138, 16, 73, 137, 203, 154, 147, 96, 178, 242, 16, 48, 13, 25, 9, 80, 24, 25, 160, 152, 29, 176, 194, 48, 80, 24, 51, 241, 154, 171, 1,
+52, 168, 185, 70, 120, 10, 185, 138, 34, 128, 145, 45, 48, 9, 10, 188, 65, 80, 8, 19, 192, 104, 176, 185, 10, 234, 17, 129, 7, 160, 156, 25,
+66, 26, 33, 33, 33, 138, 214, 152, 141, 24, 20, 160, 138, 41, 188, 194, 16, 74, 130, 128, 50, 114, 23, 144, 208, 137, 137, 161, 25, 147, 157, 57,
+106, 10, 24, 11, 115, 65, 145, 10, 141, 80, 136, 59, 153, 26, 137, 41, 218, 248, 9, 8, 22, 17, 178, 68, 41, 10, 250, 9, 24, 34, 176, 176,
+44, 200, 153, 60, 58, 72, 34, 113, 138, 41, 50, 112, 171, 137, 154, 49, 123, 186, 170, 18, 249, 56, 2, 53, 184, 17, 27, 226, 26, 80, 129, 129,
+12, 12, 147, 193, 233, 25, 128, 2, 88, 171, 129, 115, 131, 152, 43, 28, 52, 152, 225, 192, 16, 9, 29, 153, 137, 112, 19, 152, 170, 131, 106, 24,
+11, 153, 131, 1, 208, 29, 25, 22, 129, 208, 8, 43, 73, 154, 25, 185, 81, 19, 147, 216, 67, 152, 235, 216, 8, 4, 131, 25, 155, 130, 132, 132,
+11, 202, 72, 18, 170, 175, 73, 33, 128, 209, 25, 48, 33, 138, 224, 209, 56, 1, 40, 28, 130, 227, 137, 128, 240, 145, 18, 50, 40, 31, 153, 152,
+60, 50, 142, 48, 34, 156, 177, 62, 16, 161, 169, 140, 123, 1, 149, 0, 232, 0, 0, 25, 51, 27, 25, 15, 202, 144, 33, 21, 161, 208, 160, 160,
+20, 64, 128, 11, 42, 39, 153, 138, 171, 66, 233, 9, 155, 48, 114, 17, 176, 9, 1, 34, 123, 177, 10, 148, 161, 202, 159, 24, 129, 149, 146, 208,
+73, 72, 152, 162, 32, 112, 8, 138, 12, 29, 160, 56, 192, 144, 17, 36, 179, 160, 210, 57, 169, 36, 66, 8, 162, 11, 255, 24, 152, 17, 129, 185,
+27, 23, 16, 145, 249, 2, 34, 176, 33, 186, 136, 224, 139, 217, 33, 21, 88, 152, 184, 138, 25, 2, 123, 21, 137, 193, 1, 137, 13, 12, 16, 19,
+10, 162, 123, 48, 219, 161, 56, 8, 180, 170, 82, 1, 132, 157, 26, 59, 148, 131, 50, 251, 24, 171, 8, 98, 51, 193, 137, 192, 170, 159, 34, 2,
+8, 170, 125, 130, 145, 160, 169, 130, 64, 169, 138, 22, 35, 200, 172, 156, 130, 35, 34, 224, 177, 180, 1, 186, 131, 48, 39, 130, 204, 152, 1, 50,
+2, 175, 29, 129, 20, 45, 170, 2, 17, 137, 224, 65, 36, 168, 152, 206, 17, 9, 5, 153, 128, 89, 24, 202, 26, 137, 21, 18, 153, 170, 133, 130,
+6, 153, 187, 40, 130, 32, 11, 200, 183, 169, 250, 73, 80, 2, 152, 154, 128, 18, 148, 136, 156, 3, 224, 16, 152, 138, 61, 0, 168, 2, 195, 151,
+33, 161, 170, 62, 132, 80, 144, 154, 48, 170, 234, 233, 146, 49, 129, 160, 200, 33, 5, 42, 34, 59, 135, 155, 42, 176, 59, 11, 13, 150, 172, 73,
+40, 20, 162, 218, 27, 32, 23, 8, 25, 130, 130, 189, 188, 161, 32, 37, 225, 152, 16, 128, 32, 138, 48, 120, 131, 128, 176, 151, 12, 17, 217, 156,
+179, 133, 1, 161, 169, 80, 8, 193, 18, 82, 33, 142, 144, 219, 128, 134, 129, 160, 137, 48, 152, 168, 29, 73, 74, 57, 34, 42, 58, 67, 139, 207,
+155, 36, 162, 148, 172, 60, 25, 40, 176, 131, 36, 7, 179, 171, 10, 50, 131, 12, 248, 156, 1, 20, 25, 10, 61, 73, 145, 216, 16, 4, 72, 171,
+139, 56, 22, 132, 169, 159, 128, 129, 9, 152, 8, 50, 39, 9, 40, 32, 192, 179, 192, 240, 153, 74, 152, 8, 162, 120, 17, 41, 143, 17, 19, 161,
+219, 153, 40, 39, 160, 201, 152, 25, 128, 0, 178, 3, 39, 8, 8, 59, 180, 135, 194, 11, 10, 200, 134, 144, 184, 139, 50, 120, 0, 169, 34, 21,
+128, 204, 25, 130, 149, 152, 156, 161, 128, 35, 48, 143, 22, 145, 177, 170, 137, 37, 40, 157, 154, 8, 50, 195, 243, 160, 32, 20, 162, 10, 59, 120,
+162, 185, 157, 72, 130, 4, 156, 170, 2, 2, 203, 3, 195, 112, 145, 168, 170, 22, 20, 145, 202, 8, 138, 51, 248, 152, 28, 73, 145, 1, 8, 134,
+32, 168, 171, 59, 60, 132, 112, 169, 160, 130, 176, 8, 200, 52, 60, 248, 160, 128, 98, 129, 130, 160, 11, 51, 4, 188, 159, 11, 40, 181, 152, 1,
+69, 2, 160, 218, 25, 160, 21, 25, 10, 11, 8, 128, 133, 192, 151, 152, 168, 138, 3, 135, 20, 169, 217, 9, 35, 130, 138, 3, 31, 200, 154, 42,
+50, 67, 2, 128, 204, 179, 55, 128, 140, 137, 176, 128, 11, 159, 34, 179, 179, 12, 67, 8, 71, 152, 169, 138, 58, 150, 8, 168, 56, 48, 0, 254,
+136, 145, 18, 179, 128, 139, 133, 67, 56, 203, 48, 60, 132, 192, 186, 60, 243, 8, 168, 128, 6, 1, 168, 8, 48, 88, 56, 128, 12, 200, 179, 189,
+187, 132, 100, 8, 210, 137, 0, 81, 1, 160, 171, 11, 3, 7, 128, 10, 56, 0, 189, 175, 0, 20, 2, 168, 187, 67, 112, 8, 8, 2, 56, 192,
+251, 154, 10, 21, 130, 168, 176, 11, 120, 21, 137, 137, 128, 131, 192, 179, 12, 6, 161, 170, 235, 33, 4, 145, 11, 11, 67, 248, 1, 8, 50, 2,
+12, 251, 10, 20, 18, 10, 141, 137, 128, 48, 195, 3, 200, 3, 8, 181, 248, 33, 130, 176, 143, 137, 34, 22, 169, 154, 40, 48, 128, 240, 41, 131,
+3, 200, 143, 25, 50, 98, 137, 202, 128, 32, 184, 176, 8, 141, 132, 179, 64, 72, 3, 8, 216, 139, 88, 67, 184, 203, 72, 184, 192, 187, 83, 50,
+64, 184, 188, 180, 8, 52, 195, 3, 12, 72, 8, 128, 13, 8, 8, 14, 203, 179, 67, 8, 208, 128, 48, 53, 131, 180, 60, 203, 128, 11, 216, 192,
+51, 3, 8, 141, 60, 0, 132, 192, 195, 192, 48, 72, 48, 248, 1, 136, 179, 139, 12, 83, 8, 248, 168, 32, 131, 51, 0, 8, 197, 243, 160, 10,
+8, 48, 72, 8, 248, 136, 50, 56, 128, 188, 200, 7, 8, 8, 59, 8, 8, 189, 128, 68, 56, 192, 59, 219, 128, 48, 181, 3, 200, 48, 80, 8,
+188, 8, 4, 3, 216, 159, 33, 130, 128, 192, 11, 3, 180, 3, 128, 14, 3, 13, 8, 200, 67, 3, 140, 192, 3, 8, 4, 159, 137, 32, 3, 8,
+13, 200, 3, 52, 200, 192, 186, 135, 34, 138, 176, 8, 200, 67, 192, 48, 8, 4, 200, 184, 136, 96, 8, 12, 8, 88, 8, 12, 136, 0, 133, 128,
+208, 200, 3, 52, 8, 244, 169, 128, 50, 178, 192, 248, 147, 1, 162, 8, 72, 179, 195, 128, 208, 128, 112, 137, 0, 184, 3, 8, 205, 128, 128, 64,
+4, 8, 216, 128, 52, 48, 188, 188, 72, 3, 8, 216, 8, 64, 60, 203, 179, 52, 3, 216, 192, 128, 132, 11, 8, 8, 8, 8, 8, 23, 224, 128,
+64, 8, 8, 8, 8, 7, 200, 192, 8, 8, 53, 12, 159, 40, 8, 2, 8, 8, 132, 4, 243, 136, 0, 136, 132, 187, 11, 88, 195, 128, 128, 128,
+128, 7, 184, 200, 8, 55, 136, 176, 11, 8, 133, 132, 187, 8, 196, 3, 188, 128, 4, 132, 128, 140, 64, 48, 12, 8, 196, 128, 75, 8, 204, 128,
+64, 72, 56, 203, 8, 64, 8, 4, 140, 128, 208, 48, 12, 8, 132, 128, 140, 208, 128, 132, 128, 128, 134, 128, 4, 200, 128, 12, 3, 180, 200, 8,
+200, 8, 120, 130, 128, 184, 8, 133, 128, 76, 8, 3, 224, 11, 59, 80, 8, 140, 192, 179, 132, 128, 128, 128, 112, 72, 8, 8, 140, 139, 133, 128,
+208, 11, 72, 180, 8, 8, 13, 3, 196, 3, 200, 3, 132, 192, 8, 8, 224, 131, 139, 128, 0, 248, 179, 136, 208, 67, 48, 132, 139, 128, 96, 72,
+187, 192, 72, 56, 128, 188, 188, 8, 88, 3, 8, 141, 52, 195, 179, 8, 132, 180, 192, 8, 200, 132, 192, 176, 200, 179, 132, 132, 3, 200, 128, 4,
+3, 224, 128, 59, 133, 179, 188, 192, 72, 195, 176, 192, 48, 3, 180, 195, 128, 68, 8, 200, 128, 180, 179, 13, 195, 128, 139, 133, 179, 248, 1, 34,
+131, 192, 8, 200, 132, 3, 200, 203, 131, 4, 12, 184, 72, 64, 8, 200, 184, 88, 72, 195, 131, 11, 8, 8, 8, 143, 128, 0, 136, 0, 248, 131,
+80, 132, 192, 176, 72, 8, 200, 128, 128, 5, 180, 200, 192, 131, 132, 192, 128, 128, 0, 136, 183, 3, 8, 224, 131, 128, 208, 128, 132, 128, 208, 128,
+128, 133, 128, 208, 11, 3, 133, 192, 128, 128, 104, 8, 184, 8, 133, 128, 208, 195, 128, 4, 195, 192, 128, 128, 128, 5, 200, 192, 72, 8, 3, 8,
+232, 179, 72, 192, 179, 195, 132, 128, 128, 13, 8, 180, 195, 128, 128, 181, 132, 128, 208, 128, 128, 181, 195, 128, 4, 136, 181, 192, 128, 128, 4, 200,
+128, 200, 88, 8, 3, 196, 138, 128, 4, 8, 216, 128, 4, 200, 8, 128, 5, 8, 216, 8, 4, 200, 179, 216, 128, 4, 131, 128, 0, 248, 131, 0,
+8, 142, 128, 128, 0, 120, 128, 8, 128, 232, 3, 8, 8, 8, 248, 200, 3, 132, 128, 140, 128, 96, 8, 200, 192, 131, 4, 3, 216, 192, 179, 8,
+4, 200, 195, 128, 128, 80, 128, 128, 128, 240, 8, 180, 8, 88, 8, 200, 128, 128, 5, 200, 8, 64, 128, 128, 128, 143, 180, 128, 132, 0, 216, 128,
+128, 181, 8, 8, 104, 128, 200, 132, 128, 132, 203, 128, 128, 128, 128, 7, 200, 179, 180, 3, 13, 139, 132, 132, 128, 128, 208, 8, 180, 195, 179, 8,
+8, 6, 8, 216, 8, 180, 195, 128, 128, 128, 135, 176, 136, 128, 6, 195, 128, 208, 179, 3, 200, 200, 3, 4, 8, 216, 179, 8, 136, 7, 136, 139,
+128, 182, 3, 8, 8, 182, 200, 8, 128, 224, 51, 180, 192, 184, 88, 2, 128, 200, 132, 128, 208, 179, 8, 88, 128, 180, 8, 224, 128, 48, 208, 128,
+128, 128, 128, 8, 183, 4, 200, 179, 132, 128, 128, 6, 200, 192, 176, 3, 136, 0, 248, 72, 8, 179, 136, 96, 8, 8, 181, 8, 8, 232, 3, 8,
+216, 128, 8, 216, 72, 128, 128, 182, 179, 8, 133, 180, 3, 200, 200, 3, 128, 216, 192, 8, 180, 195, 3, 8, 8, 134, 128, 181, 179, 200, 179, 52,
+128, 140, 140, 0, 8, 8, 8, 8, 23, 224, 8, 128, 133, 128, 128, 224, 48, 8, 181, 200, 128, 128, 181, 8, 200, 88, 8, 3, 196, 176, 8, 4,
+3, 216, 192, 8, 8, 181, 195, 128, 128, 181, 8, 8, 8, 6, 8, 216, 3, 8, 181, 8, 8, 8, 8, 248, 9, 232, 3, 8, 133, 192, 184, 132,
+132, 3, 200, 192, 179, 3, 216, 3, 128, 128, 240, 139, 128, 133, 132, 192, 128, 128, 133, 179, 128, 8, 128, 8, 240, 137, 224, 3, 8, 196, 179, 128,
+8, 134, 180, 192, 179, 195, 3, 208, 128, 132, 128, 12, 12, 131, 180, 179, 196, 179, 179, 132, 0, 8, 248, 179, 195, 179, 128, 128, 134, 192, 179, 200,
+3, 8, 5, 8, 216, 179, 196, 3, 136, 0, 136, 240, 184, 180, 3, 4, 200, 195, 128, 180, 3, 208, 179, 195, 132, 128, 208, 128, 180, 179, 195, 192,
+8, 88, 8, 195, 3, 8, 128, 232, 179, 196, 3, 195, 128, 188, 180, 3, 136, 181, 128, 8, 5, 200, 179, 196, 3, 136, 208, 3, 200, 179, 180, 195,
+179, 8, 8, 182, 195, 128, 4, 200, 179, 8, 8, 6, 195, 128, 208, 8, 128, 181, 195, 128, 128, 128, 182, 179, 196, 179, 179, 196, 3, 200, 179, 180,
+195, 179, 8, 181, 195, 179, 132, 128, 128, 224, 8, 128, 133, 192, 179, 8, 8, 197, 179, 180, 195, 179, 132, 192, 179, 3, 224, 179, 195, 179, 180, 195,
+179, 180, 195, 128, 128, 181, 179, 196, 3, 200, 179, 180, 3, 136, 0, 248, 8, 180, 195, 179, 180, 8, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180,
+3, 216, 128, 128, 128, 183, 179, 180, 195, 3, 200, 179, 196, 3, 8, 216, 128, 180, 3, 200, 180, 195, 128, 180, 195, 179, 128, 181, 195, 179, 132, 128,
+181, 179, 200, 179, 216, 3, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 131, 0
 };
 
-// Definición del tamaño y el array del Hi-Hat
+// Definición del tamaño (en muestras) y el array del Hi-Hat
 const int hi_hat_size = 5239;
-const int16_t hi_hat_sample[] = {
-    512,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.080000000000000000e+02,5.190000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.080000000000000000e+02,5.190000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.250000000000000000e+02,5.590000000000000000e+02,5.140000000000000000e+02,5.380000000000000000e+02,5.410000000000000000e+02,4.750000000000000000e+02,4.890000000000000000e+02,4.960000000000000000e+02,4.950000000000000000e+02,4.950000000000000000e+02,5.240000000000000000e+02,4.330000000000000000e+02,4.420000000000000000e+02,5.380000000000000000e+02,4.710000000000000000e+02,5.630000000000000000e+02,4.740000000000000000e+02,4.660000000000000000e+02,4.860000000000000000e+02,5.240000000000000000e+02,5.060000000000000000e+02,5.360000000000000000e+02,4.570000000000000000e+02,4.970000000000000000e+02,4.370000000000000000e+02,5.790000000000000000e+02,5.510000000000000000e+02,5.630000000000000000e+02,4.720000000000000000e+02,5.810000000000000000e+02,4.050000000000000000e+02,5.720000000000000000e+02,4.890000000000000000e+02,4.640000000000000000e+02,5.380000000000000000e+02,5.250000000000000000e+02,6.030000000000000000e+02,5.680000000000000000e+02,7.060000000000000000e+02,5.370000000000000000e+02,4.750000000000000000e+02,5.590000000000000000e+02,5.560000000000000000e+02,3.710000000000000000e+02,5.310000000000000000e+02,3.760000000000000000e+02,4.210000000000000000e+02,4.250000000000000000e+02,6.410000000000000000e+02,5.010000000000000000e+02,7.120000000000000000e+02,5.200000000000000000e+02,5.410000000000000000e+02,3.670000000000000000e+02,5.480000000000000000e+02,2.570000000000000000e+02,4.930000000000000000e+02,4.630000000000000000e+02,3.820000000000000000e+02,3.540000000000000000e+02,6.650000000000000000e+02,5.010000000000000000e+02,6.530000000000000000e+02,5.110000000000000000e+02,6.830000000000000000e+02,4.140000000000000000e+02,5.690000000000000000e+02,5.810000000000000000e+02,3.940000000000000000e+02,5.720000000000000000e+02,4.530000000000000000e+02,5.560000000000000000e+02,6.320000000000000000e+02,7.500000000000000000e+02,4.730000000000000000e+02,5.550000000000000000e+02,4.150000000000000000e+02,5.950000000000000000e+02,5.570000000000000000e+02,6.270000000000000000e+02,5.530000000000000000e+02,5.080000000000000000e+02,4.500000000000000000e+02,7.010000000000000000e+02,4.960000000000000000e+02,8.210000000000000000e+02,3.340000000000000000e+02,2.870000000000000000e+02,4.860000000000000000e+02,4.940000000000000000e+02,4.730000000000000000e+02,4.110000000000000000e+02,3.120000000000000000e+02,0.000000000000000000e+00,4.760000000000000000e+02,2.590000000000000000e+02,2.720000000000000000e+02,5.820000000000000000e+02,7.200000000000000000e+02,4.970000000000000000e+02,4.430000000000000000e+02,8.160000000000000000e+02,3.450000000000000000e+02,8.060000000000000000e+02,4.870000000000000000e+02,5.330000000000000000e+02,5.440000000000000000e+02,7.290000000000000000e+02,6.620000000000000000e+02,5.690000000000000000e+02,7.120000000000000000e+02,6.060000000000000000e+02,5.030000000000000000e+02,4.590000000000000000e+02,3.840000000000000000e+02,5.310000000000000000e+02,4.080000000000000000e+02,6.330000000000000000e+02,5.870000000000000000e+02,5.510000000000000000e+02,3.490000000000000000e+02,2.300000000000000000e+02,3.800000000000000000e+02,4.550000000000000000e+02,4.090000000000000000e+02,3.860000000000000000e+02,4.790000000000000000e+02,4.180000000000000000e+02,4.200000000000000000e+02,4.680000000000000000e+02,5.120000000000000000e+02,5.540000000000000000e+02,6.180000000000000000e+02,7.740000000000000000e+02,6.930000000000000000e+02,8.270000000000000000e+02,7.610000000000000000e+02,7.350000000000000000e+02,4.080000000000000000e+02,6.690000000000000000e+02,3.730000000000000000e+02,3.940000000000000000e+02,4.330000000000000000e+02,6.270000000000000000e+02,6.630000000000000000e+02,2.490000000000000000e+02,5.820000000000000000e+02,4.860000000000000000e+02,5.850000000000000000e+02,3.830000000000000000e+02,4.610000000000000000e+02,4.250000000000000000e+02,2.710000000000000000e+02,4.510000000000000000e+02,2.810000000000000000e+02,5.610000000000000000e+02,5.010000000000000000e+02,4.200000000000000000e+02,5.640000000000000000e+02,5.320000000000000000e+02,6.300000000000000000e+02,3.950000000000000000e+02,4.230000000000000000e+02,5.360000000000000000e+02,6.990000000000000000e+02,5.480000000000000000e+02,7.410000000000000000e+02,6.490000000000000000e+02,5.770000000000000000e+02,5.580000000000000000e+02,5.830000000000000000e+02,3.970000000000000000e+02,4.050000000000000000e+02,8.230000000000000000e+02,6.270000000000000000e+02,6.290000000000000000e+02,4.620000000000000000e+02,3.660000000000000000e+02,2.930000000000000000e+02,4.830000000000000000e+02,4.840000000000000000e+02,2.850000000000000000e+02,3.810000000000000000e+02,3.930000000000000000e+02,4.640000000000000000e+02,6.580000000000000000e+02,4.820000000000000000e+02,4.200000000000000000e+02,4.600000000000000000e+02,5.460000000000000000e+02,5.360000000000000000e+02,6.190000000000000000e+02,4.390000000000000000e+02,6.750000000000000000e+02,3.840000000000000000e+02,6.780000000000000000e+02,4.940000000000000000e+02,6.030000000000000000e+02,5.960000000000000000e+02,5.790000000000000000e+02,6.490000000000000000e+02,4.950000000000000000e+02,4.820000000000000000e+02,3.890000000000000000e+02,5.530000000000000000e+02,5.540000000000000000e+02,5.750000000000000000e+02,5.500000000000000000e+02,3.780000000000000000e+02,4.650000000000000000e+02,2.910000000000000000e+02,4.620000000000000000e+02,4.030000000000000000e+02,4.980000000000000000e+02,4.430000000000000000e+02,3.600000000000000000e+02,6.360000000000000000e+02,6.700000000000000000e+02,6.000000000000000000e+02,4.780000000000000000e+02,5.280000000000000000e+02,6.150000000000000000e+02,5.540000000000000000e+02,6.220000000000000000e+02,5.330000000000000000e+02,3.750000000000000000e+02,4.480000000000000000e+02,5.150000000000000000e+02,5.560000000000000000e+02,5.380000000000000000e+02,5.080000000000000000e+02,4.720000000000000000e+02,6.100000000000000000e+02,6.000000000000000000e+02,4.260000000000000000e+02,3.750000000000000000e+02,5.170000000000000000e+02,4.150000000000000000e+02,5.720000000000000000e+02,5.150000000000000000e+02,4.870000000000000000e+02,4.100000000000000000e+02,4.870000000000000000e+02,4.990000000000000000e+02,5.120000000000000000e+02,6.460000000000000000e+02,5.230000000000000000e+02,4.870000000000000000e+02,4.310000000000000000e+02,6.690000000000000000e+02,6.260000000000000000e+02,6.540000000000000000e+02,5.470000000000000000e+02,5.220000000000000000e+02,6.010000000000000000e+02,5.920000000000000000e+02,6.380000000000000000e+02,3.510000000000000000e+02,3.330000000000000000e+02,3.070000000000000000e+02,4.650000000000000000e+02,5.020000000000000000e+02,4.010000000000000000e+02,4.570000000000000000e+02,4.620000000000000000e+02,5.590000000000000000e+02,5.640000000000000000e+02,5.800000000000000000e+02,4.250000000000000000e+02,4.700000000000000000e+02,4.850000000000000000e+02,5.710000000000000000e+02,4.420000000000000000e+02,4.810000000000000000e+02,5.620000000000000000e+02,5.380000000000000000e+02,5.790000000000000000e+02,5.810000000000000000e+02,5.840000000000000000e+02,4.950000000000000000e+02,5.250000000000000000e+02,5.400000000000000000e+02,5.520000000000000000e+02,5.030000000000000000e+02,5.770000000000000000e+02,5.460000000000000000e+02,5.980000000000000000e+02,5.280000000000000000e+02,4.410000000000000000e+02,3.410000000000000000e+02,4.900000000000000000e+02,4.300000000000000000e+02,4.070000000000000000e+02,4.880000000000000000e+02,5.120000000000000000e+02,5.220000000000000000e+02,5.490000000000000000e+02,4.380000000000000000e+02,4.560000000000000000e+02,5.310000000000000000e+02,5.330000000000000000e+02,5.530000000000000000e+02,5.840000000000000000e+02,5.270000000000000000e+02,4.700000000000000000e+02,5.220000000000000000e+02,5.480000000000000000e+02,4.580000000000000000e+02,4.830000000000000000e+02,5.610000000000000000e+02,5.510000000000000000e+02,5.440000000000000000e+02,6.110000000000000000e+02,5.400000000000000000e+02,4.940000000000000000e+02,4.810000000000000000e+02,4.580000000000000000e+02,4.280000000000000000e+02,4.680000000000000000e+02,4.580000000000000000e+02,4.430000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.540000000000000000e+02,5.680000000000000000e+02,5.110000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.310000000000000000e+02,4.950000000000000000e+02,5.620000000000000000e+02,5.490000000000000000e+02,4.450000000000000000e+02,4.040000000000000000e+02,4.380000000000000000e+02,4.310000000000000000e+02,4.740000000000000000e+02,5.380000000000000000e+02,4.900000000000000000e+02,5.560000000000000000e+02,5.890000000000000000e+02,5.820000000000000000e+02,5.170000000000000000e+02,5.100000000000000000e+02,4.860000000000000000e+02,4.830000000000000000e+02,5.050000000000000000e+02,4.880000000000000000e+02,4.890000000000000000e+02,5.030000000000000000e+02,5.430000000000000000e+02,4.580000000000000000e+02,5.260000000000000000e+02,5.110000000000000000e+02,5.370000000000000000e+02,6.010000000000000000e+02,5.720000000000000000e+02,5.380000000000000000e+02,4.750000000000000000e+02,4.770000000000000000e+02,4.460000000000000000e+02,4.580000000000000000e+02,4.830000000000000000e+02,4.780000000000000000e+02,4.830000000000000000e+02,4.820000000000000000e+02,5.100000000000000000e+02,4.580000000000000000e+02,5.220000000000000000e+02,5.470000000000000000e+02,5.200000000000000000e+02,5.550000000000000000e+02,5.400000000000000000e+02,5.690000000000000000e+02,4.940000000000000000e+02,4.990000000000000000e+02,5.230000000000000000e+02,4.880000000000000000e+02,4.800000000000000000e+02,4.780000000000000000e+02,4.910000000000000000e+02,4.870000000000000000e+02,5.300000000000000000e+02,5.010000000000000000e+02,5.410000000000000000e+02,5.780000000000000000e+02,5.480000000000000000e+02,5.810000000000000000e+02,5.550000000000000000e+02,5.380000000000000000e+02,4.930000000000000000e+02,4.660000000000000000e+02,4.820000000000000000e+02,4.820000000000000000e+02,4.950000000000000000e+02,4.860000000000000000e+02,4.880000000000000000e+02,4.590000000000000000e+02,4.520000000000000000e+02,4.680000000000000000e+02,4.800000000000000000e+02,5.190000000000000000e+02,5.230000000000000000e+02,5.390000000000000000e+02,4.990000000000000000e+02,5.420000000000000000e+02,5.040000000000000000e+02,5.370000000000000000e+02,5.050000000000000000e+02,5.300000000000000000e+02,5.310000000000000000e+02,5.460000000000000000e+02,5.210000000000000000e+02,5.190000000000000000e+02,5.070000000000000000e+02,5.150000000000000000e+02,4.980000000000000000e+02,5.200000000000000000e+02,5.350000000000000000e+02,5.270000000000000000e+02,5.230000000000000000e+02,5.190000000000000000e+02,5.220000000000000000e+02,4.900000000000000000e+02,4.800000000000000000e+02,4.900000000000000000e+02,4.800000000000000000e+02,4.870000000000000000e+02,5.040000000000000000e+02,4.790000000000000000e+02,4.880000000000000000e+02,4.920000000000000000e+02,5.140000000000000000e+02,4.910000000000000000e+02,5.210000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.370000000000000000e+02,5.290000000000000000e+02,5.440000000000000000e+02,5.270000000000000000e+02,5.360000000000000000e+02,5.460000000000000000e+02,5.270000000000000000e+02,5.460000000000000000e+02,5.230000000000000000e+02,5.040000000000000000e+02,5.080000000000000000e+02,4.960000000000000000e+02,5.090000000000000000e+02,5.150000000000000000e+02,4.920000000000000000e+02,4.850000000000000000e+02,5.040000000000000000e+02,5.050000000000000000e+02,4.820000000000000000e+02,4.950000000000000000e+02,4.890000000000000000e+02,5.030000000000000000e+02,4.920000000000000000e+02,5.070000000000000000e+02,4.890000000000000000e+02,5.160000000000000000e+02,5.070000000000000000e+02,5.270000000000000000e+02,5.180000000000000000e+02,4.970000000000000000e+02,5.150000000000000000e+02,5.080000000000000000e+02,5.350000000000000000e+02,5.230000000000000000e+02,5.200000000000000000e+02,5.110000000000000000e+02,5.260000000000000000e+02,5.510000000000000000e+02,5.310000000000000000e+02,5.250000000000000000e+02,5.080000000000000000e+02,5.320000000000000000e+02,4.900000000000000000e+02,5.020000000000000000e+02,4.820000000000000000e+02,5.070000000000000000e+02,4.870000000000000000e+02,4.910000000000000000e+02,4.830000000000000000e+02,5.020000000000000000e+02,5.220000000000000000e+02,5.190000000000000000e+02,5.430000000000000000e+02,5.230000000000000000e+02,5.220000000000000000e+02,4.920000000000000000e+02,5.070000000000000000e+02,4.970000000000000000e+02,4.930000000000000000e+02,4.910000000000000000e+02,5.010000000000000000e+02,5.020000000000000000e+02,5.210000000000000000e+02,5.340000000000000000e+02,5.370000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,4.960000000000000000e+02,5.170000000000000000e+02,5.000000000000000000e+02,5.120000000000000000e+02,5.060000000000000000e+02,5.250000000000000000e+02,5.040000000000000000e+02,5.290000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,4.960000000000000000e+02,5.080000000000000000e+02,4.870000000000000000e+02,5.250000000000000000e+02,5.030000000000000000e+02,5.310000000000000000e+02,5.060000000000000000e+02,5.490000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,4.980000000000000000e+02,5.070000000000000000e+02,5.040000000000000000e+02,5.100000000000000000e+02,5.040000000000000000e+02,5.040000000000000000e+02,4.990000000000000000e+02,5.150000000000000000e+02,5.010000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.280000000000000000e+02,5.120000000000000000e+02,5.240000000000000000e+02,5.000000000000000000e+02,5.120000000000000000e+02,4.860000000000000000e+02,5.050000000000000000e+02,4.950000000000000000e+02,5.080000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.230000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.200000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.260000000000000000e+02,5.010000000000000000e+02,5.210000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.050000000000000000e+02,5.020000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.040000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.000000000000000000e+02,5.040000000000000000e+02,4.910000000000000000e+02,5.110000000000000000e+02,4.910000000000000000e+02,5.190000000000000000e+02,5.070000000000000000e+02,5.200000000000000000e+02,5.110000000000000000e+02,5.220000000000000000e+02,5.200000000000000000e+02,5.180000000000000000e+02,5.290000000000000000e+02,5.160000000000000000e+02,5.290000000000000000e+02,5.230000000000000000e+02,5.180000000000000000e+02,5.110000000000000000e+02,5.000000000000000000e+02,5.170000000000000000e+02,4.920000000000000000e+02,5.000000000000000000e+02,4.840000000000000000e+02,5.130000000000000000e+02,5.020000000000000000e+02,5.080000000000000000e+02,4.950000000000000000e+02,5.070000000000000000e+02,5.180000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.190000000000000000e+02,5.220000000000000000e+02,5.260000000000000000e+02,5.260000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.020000000000000000e+02,5.220000000000000000e+02,5.220000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.040000000000000000e+02,5.110000000000000000e+02,5.020000000000000000e+02,5.140000000000000000e+02,4.980000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.030000000000000000e+02,5.220000000000000000e+02,5.250000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.090000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.250000000000000000e+02,5.160000000000000000e+02,5.260000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.050000000000000000e+02,5.010000000000000000e+02,5.020000000000000000e+02,5.120000000000000000e+02,5.060000000000000000e+02,5.050000000000000000e+02,5.000000000000000000e+02,5.020000000000000000e+02,5.160000000000000000e+02,5.070000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.200000000000000000e+02,5.250000000000000000e+02,5.220000000000000000e+02,5.180000000000000000e+02,5.190000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.070000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.220000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.190000000000000000e+02,5.220000000000000000e+02,5.220000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.030000000000000000e+02,5.040000000000000000e+02,4.990000000000000000e+02,5.000000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.240000000000000000e+02,5.220000000000000000e+02,5.220000000000000000e+02,5.240000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.100000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.070000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.190000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.190000000000000000e+02,5.200000000000000000e+02,5.210000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.010000000000000000e+02,5.050000000000000000e+02,5.030000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.190000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.180000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.090000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.180000000000000000e+02,5.160000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.200000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.020000000000000000e+02,5.060000000000000000e+02,5.020000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.020000000000000000e+02,5.090000000000000000e+02,5.060000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.140000000000000000e+02,5.180000000000000000e+02,5.180000000000000000e+02,5.210000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.040000000000000000e+02,5.050000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.190000000000000000e+02,5.120000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.200000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.050000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.200000000000000000e+02,5.190000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.060000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.050000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.170000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.060000000000000000e+02,5.060000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.180000000000000000e+02,5.150000000000000000e+02,5.180000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.060000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.080000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.170000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.170000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.070000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.070000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.090000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.080000000000000000e+02,5.070000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.170000000000000000e+02,5.170000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.160000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.160000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.080000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.080000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.120000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.130000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.150000000000000000e+02,5.150000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.140000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.090000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.140000000000000000e+02,5.140000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.090000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.130000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.100000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,5.110000000000000000e+02,5.120000000000000000e+02,};//,
-};
\ No newline at end of file
+const uint8_t hi_hat_adpcm[] = {
+240, 242, 243, 195, 179, 196, 179, 179, 196, 179, 179, 196, 179, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 243, 197, 179, 180, 195, 179, 180, 195,
+179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 195, 181, 211, 163, 195, 196, 146, 178, 178,
+167, 2, 201, 166, 178, 121, 199, 1, 13, 0, 40, 143, 165, 179, 8, 146, 210, 177, 7, 168, 243, 147, 24, 40, 89, 156, 130, 61, 27, 104, 74, 11,
+75, 45, 144, 88, 42, 58, 28, 176, 163, 18, 243, 144, 130, 145, 153, 167, 212, 24, 128, 152, 92, 137, 19, 138, 213, 163, 0, 129, 41, 169, 152, 179,
+134, 200, 41, 145, 40, 137, 18, 49, 151, 163, 248, 210, 0, 2, 47, 24, 10, 168, 179, 134, 41, 41, 12, 49, 75, 153, 8, 13, 151, 160, 137, 2,
+27, 16, 181, 25, 1, 226, 196, 163, 1, 24, 139, 90, 8, 200, 177, 148, 146, 122, 145, 26, 145, 161, 28, 18, 137, 105, 216, 40, 74, 137, 25, 0,
+181, 168, 7, 152, 24, 24, 143, 40, 160, 1, 2, 208, 0, 195, 48, 25, 0, 29, 0, 58, 57, 220, 107, 137, 2, 0, 12, 2, 17, 187, 19, 31,
+130, 48, 172, 152, 58, 137, 6, 136, 48, 209, 136, 178, 134, 158, 129, 34, 74, 129, 139, 138, 146, 40, 245, 130, 49, 169, 13, 9, 129, 128, 227, 20,
+25, 24, 13, 161, 9, 0, 164, 67, 42, 170, 173, 1, 145, 208, 24, 82, 16, 76, 59, 43, 16, 139, 42, 76, 146, 137, 240, 25, 25, 194, 1, 180,
+132, 152, 150, 162, 17, 59, 188, 161, 18, 142, 2, 44, 41, 58, 108, 41, 184, 146, 150, 152, 66, 154, 74, 31, 42, 9, 41, 131, 180, 208, 145, 136,
+130, 36, 176, 232, 179, 130, 195, 164, 128, 43, 109, 58, 90, 11, 26, 24, 137, 56, 59, 1, 210, 226, 193, 163, 130, 17, 177, 131, 26, 244, 146, 177,
+57, 26, 160, 148, 28, 108, 91, 25, 41, 136, 178, 147, 170, 108, 29, 74, 9, 41, 145, 129, 1, 1, 31, 91, 152, 152, 145, 211, 2, 25, 42, 122,
+176, 0, 146, 154, 34, 75, 89, 75, 138, 152, 243, 9, 163, 152, 96, 26, 32, 146, 10, 156, 131, 59, 121, 9, 41, 24, 152, 12, 65, 26, 89, 200,
+18, 144, 185, 169, 204, 192, 80, 32, 20, 146, 16, 28, 15, 0, 43, 128, 144, 147, 44, 46, 9, 26, 130, 151, 153, 1, 91, 41, 48, 171, 50, 17,
+159, 57, 59, 143, 24, 200, 58, 122, 8, 56, 16, 10, 152, 162, 108, 58, 138, 43, 166, 193, 144, 146, 153, 33, 46, 91, 138, 144, 132, 81, 8, 41,
+11, 155, 23, 153, 9, 176, 2, 185, 241, 32, 31, 58, 184, 149, 147, 3, 132, 60, 40, 12, 24, 170, 43, 145, 157, 106, 144, 13, 17, 25, 210, 1,
+73, 96, 41, 28, 32, 201, 1, 26, 60, 57, 31, 138, 145, 1, 72, 26, 138, 132, 24, 160, 53, 148, 186, 217, 144, 18, 16, 162, 63, 28, 26, 161,
+8, 1, 132, 160, 189, 151, 0, 36, 154, 145, 179, 74, 128, 64, 159, 160, 152, 129, 33, 120, 10, 18, 160, 75, 241, 58, 169, 4, 61, 2, 9, 11,
+120, 60, 169, 148, 178, 57, 58, 13, 177, 177, 228, 147, 34, 123, 138, 144, 200, 3, 128, 56, 96, 137, 147, 46, 27, 10, 139, 9, 17, 98, 145, 25,
+139, 128, 80, 154, 39, 40, 193, 243, 136, 9, 27, 144, 4, 147, 154, 18, 92, 15, 1, 152, 147, 2, 59, 211, 105, 152, 144, 138, 42, 132, 16, 232,
+128, 153, 147, 42, 122, 1, 94, 161, 8, 128, 160, 17, 61, 41, 61, 138, 27, 123, 57, 137, 89, 139, 74, 16, 153, 128, 91, 32, 122, 10, 168, 8,
+180, 155, 128, 212, 34, 5, 11, 59, 32, 74, 243, 152, 16, 10, 91, 27, 152, 26, 177, 22, 40, 40, 195, 130, 128, 173, 162, 31, 130, 133, 160, 161,
+192, 1, 137, 28, 32, 123, 0, 137, 50, 31, 0, 28, 32, 147, 232, 24, 144, 152, 81, 11, 1, 161, 179, 63, 57, 46, 128, 185, 10, 114, 57, 154,
+3, 12, 163, 80, 29, 152, 25, 169, 2, 56, 115, 25, 160, 104, 155, 232, 162, 57, 77, 8, 57, 105, 144, 25, 185, 147, 128, 200, 168, 227, 1, 65,
+1, 90, 46, 128, 137, 137, 184, 16, 7, 73, 74, 0, 138, 137, 203, 25, 180, 152, 138, 55, 129, 41, 161, 28, 128, 51, 143, 32, 170, 8, 56, 63,
+93, 10, 162, 56, 217, 56, 27, 48, 90, 27, 66, 45, 194, 169, 138, 18, 34, 107, 155, 149, 147, 156, 50, 46, 9, 8, 195, 1, 74, 137, 139, 210,
+151, 144, 161, 89, 41, 2, 11, 232, 33, 28, 129, 145, 186, 122, 9, 8, 149, 162, 1, 170, 94, 10, 0, 17, 137, 98, 12, 75, 41, 153, 138, 169,
+64, 130, 60, 128, 170, 55, 9, 65, 14, 9, 176, 179, 147, 88, 27, 94, 9, 128, 9, 161, 185, 42, 162, 114, 4, 132, 10, 184, 30, 136, 146, 25,
+40, 28, 12, 83, 200, 146, 72, 140, 16, 1, 136, 83, 27, 10, 8, 248, 137, 130, 28, 162, 227, 8, 40, 32, 126, 24, 8, 41, 10, 28, 106, 137,
+129, 153, 137, 160, 42, 48, 60, 243, 33, 193, 35, 32, 107, 137, 27, 160, 2, 236, 179, 130, 128, 59, 123, 201, 3, 8, 138, 128, 48, 128, 96, 72,
+8, 120, 32, 172, 194, 202, 162, 64, 30, 1, 58, 10, 34, 11, 243, 17, 32, 138, 131, 192, 131, 244, 144, 1, 60, 60, 201, 128, 132, 43, 8, 148,
+34, 133, 73, 45, 137, 140, 155, 16, 128, 122, 56, 74, 145, 168, 41, 8, 123, 152, 152, 136, 179, 123, 41, 138, 32, 75, 139, 192, 48, 12, 3, 132,
+240, 35, 162, 229, 163, 176, 25, 42, 10, 178, 132, 3, 124, 27, 43, 42, 11, 131, 64, 48, 80, 184, 12, 151, 10, 40, 141, 137, 32, 11, 3, 244,
+8, 152, 120, 58, 8, 72, 25, 41, 11, 11, 8, 200, 8, 189, 67, 128, 132, 180, 11, 3, 125, 11, 74, 128, 90, 169, 25, 185, 150, 131, 60, 41,
+40, 128, 0, 140, 192, 123, 59, 137, 128, 176, 3, 136, 77, 59, 139, 151, 2, 107, 57, 10, 128, 11, 8, 8, 8, 63, 248, 1, 10, 178, 51, 203,
+128, 88, 131, 115, 192, 194, 137, 73, 137, 60, 73, 42, 162, 178, 138, 48, 143, 90, 154, 18, 0, 2, 3, 8, 232, 128, 124, 137, 25, 10, 138, 3,
+195, 192, 3, 3, 8, 14, 8, 196, 48, 12, 120, 25, 137, 2, 187, 128, 128, 128, 240, 3, 136, 5, 60, 184, 8, 8, 128, 120, 11, 4, 136, 208,
+120, 9, 138, 150, 8, 136, 106, 137, 16, 170, 224, 1, 42, 32, 8, 179, 120, 129, 58, 56, 219, 176, 3, 31, 42, 59, 128, 128, 80, 60, 128, 208,
+128, 128, 60, 64, 192, 8, 132, 132, 11, 200, 8, 200, 8, 104, 123, 40, 74, 27, 160, 162, 195, 176, 75, 30, 73, 10, 1, 128, 51, 12, 8, 60,
+139, 64, 60, 192, 67, 142, 32, 8, 184, 128, 128, 128, 126, 25, 128, 128, 216, 1, 128, 72, 56, 59, 60, 139, 208, 3, 8, 8, 14, 12, 56, 0,
+8, 8, 135, 128, 0, 136, 142, 180, 192, 131, 64, 128, 128, 96, 139, 12, 200, 128, 64, 128, 64, 4, 136, 0, 136, 175, 139, 132, 192, 179, 132, 48,
+80, 59, 60, 203, 179, 8, 8, 120, 59, 75, 139, 64, 8, 140, 64, 139, 64, 60, 128, 0, 197, 128, 128, 128, 0, 143, 228, 16, 42, 58, 59, 72,
+178, 228, 1, 8, 8, 11, 8, 88, 8, 8, 133, 15, 40, 42, 11, 139, 128, 80, 48, 12, 3, 61, 128, 128, 134, 11, 88, 59, 139, 208, 3, 140,
+128, 31, 56, 59, 8, 132, 192, 3, 8, 8, 120, 11, 8, 8, 232, 128, 128, 61, 128, 128, 13, 195, 128, 68, 8, 3, 8, 104, 139, 12, 184, 8,
+232, 128, 64, 60, 59, 128, 128, 96, 128, 64, 139, 104, 11, 60, 184, 128, 133, 75, 184, 72, 31, 137, 10, 2, 179, 83, 131, 72, 192, 128, 75, 139,
+12, 12, 131, 60, 0, 136, 77, 59, 72, 75, 139, 64, 195, 48, 8, 140, 75, 8, 200, 195, 128, 128, 224, 48, 60, 59, 76, 56, 123, 137, 32, 42,
+75, 62, 128, 176, 176, 128, 128, 128, 62, 31, 130, 128, 128, 3, 8, 128, 8, 63, 59, 124, 25, 137, 128, 128, 59, 12, 72, 139, 208, 3, 200, 3,
+128, 80, 64, 8, 128, 224, 59, 60, 11, 136, 0, 136, 112, 75, 75, 8, 140, 75, 59, 128, 80, 60, 128, 132, 11, 216, 128, 128, 128, 128, 120, 0,
+8, 8, 63, 59, 60, 75, 139, 128, 128, 120, 128, 59, 128, 128, 240, 3, 200, 8, 88, 139, 4, 200, 128, 4, 8, 136, 0, 143, 0, 136, 128, 128,
+7, 60, 59, 75, 60, 128, 8, 13, 8, 8, 133, 0, 61, 8, 60, 12, 8, 8, 8, 8, 120, 0, 128, 128, 8, 63, 60, 60, 75, 139, 64, 139,
+128, 128, 128, 128, 128, 39, 8, 112, 139, 12, 8, 8, 8, 135, 128, 76, 8, 60, 59, 12, 8, 8, 8, 120, 128, 128, 128, 240, 8, 128, 60, 128,
+80, 139, 180, 72, 75, 8, 8, 8, 14, 136, 0, 136, 0, 136, 128, 128, 55, 63, 75, 59, 8, 128, 8, 63, 59, 12, 8, 8, 120, 11, 8, 88,
+8, 12, 8, 88, 8, 200, 3, 60, 128, 60, 0, 232, 48, 12, 8, 8, 8, 136, 0, 8, 120, 123, 8, 8, 8, 141, 64, 59, 76, 59, 139, 8,
+8, 8, 120, 75, 139, 133, 75, 8, 8, 8, 8, 120, 31, 9, 8, 8, 136, 0, 136, 0, 63, 72, 8, 8, 8, 136, 0, 136, 63, 61, 11, 136,
+0, 136, 0, 8, 120, 131, 143, 128, 0, 104, 8, 8, 8, 128, 63, 139, 88, 59, 139, 128, 128, 8, 128, 112, 107, 59, 60, 75, 59, 128, 13, 8,
+88, 139, 64, 59, 0, 62, 139, 128, 133, 75, 59, 12, 72, 11, 72, 139, 80, 59, 128, 8, 128, 143, 128, 76, 8, 72, 184, 132, 128, 76, 59, 139,
+128, 128, 128, 128, 128, 120, 131, 128, 8, 159, 104, 139, 128, 128, 128, 128, 7, 76, 8, 8, 8, 136, 240, 8, 128, 104, 59, 75, 139, 128, 128, 8,
+128, 8, 8, 8, 120, 133, 128, 128, 128, 0, 8, 8, 239, 128, 128, 128, 128, 128, 128, 112, 4, 8, 128, 128, 128, 128, 8, 63, 128, 63, 143, 0,
+136, 0, 136, 0, 8, 120, 11, 8, 120, 1, 136, 0, 136, 128, 128, 191, 8, 128, 128, 128, 128, 120, 6, 8, 8, 8, 63, 232, 128, 128, 128, 128,
+128, 8, 120, 2, 136, 0, 63, 13, 8, 136, 96, 59, 128, 128, 128, 128, 63, 60, 60, 11, 8, 136, 0, 136, 112, 1, 8, 128, 8, 159, 197, 128,
+128, 80, 139, 64, 12, 8, 88, 59, 75, 59, 8, 128, 62, 59, 0, 8, 136, 143, 128, 128, 128, 128, 8, 8, 120, 123, 128, 128, 128, 8, 63, 139,
+64, 12, 8, 88, 59, 75, 12, 8, 8, 8, 8, 112, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75, 59, 12, 8, 196, 3, 8, 61, 59, 12,
+8, 8, 8, 8, 120, 75, 75, 59, 60, 75, 59, 60, 128, 60, 0, 216, 8, 8, 8, 8, 8, 8, 112, 107, 75, 139, 128, 80, 60, 59, 0, 8,
+8, 8, 8, 136, 63, 15, 8, 8, 8, 8, 8, 8, 120, 2, 136, 0, 8, 63, 62, 59, 76, 8, 60, 139, 128, 128, 128, 128, 128, 128, 112, 3,
+8, 8, 8, 8, 136, 63, 128, 175, 8, 136, 128, 128, 128, 0, 120, 139, 112, 123, 59, 75, 8, 8, 8, 8, 63, 60, 59, 12, 8, 8, 8, 8,
+120, 11, 8, 120, 11, 72, 59, 0, 8, 136, 0, 63, 61, 139, 128, 128, 128, 112, 75, 59, 76, 8, 60, 59, 139, 104, 59, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 128, 60, 75, 60, 59, 75, 139, 8, 8, 8, 120, 75, 75, 8, 8, 8, 8, 63, 59, 12, 8, 88, 75, 59, 60,
+139, 128, 128, 128, 0, 120, 91, 128, 60, 75, 59, 12, 72, 75, 139, 64, 12, 72, 59, 59, 76, 59, 59, 76, 59, 59, 76, 59, 59, 60, 75, 139,
+8, 104, 59, 75, 59, 12, 8, 88, 75, 59, 60, 75, 59, 60, 75, 59, 8, 61, 75, 59, 60, 139, 128, 0, 136, 112, 75, 75, 8, 60, 60, 59,
+139, 128, 96, 139, 64, 60, 75, 59, 60, 75, 59, 60, 75, 139, 128, 128, 128, 112, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 139, 128, 128, 96, 59, 76, 59, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 128, 128, 128, 8, 8, 8, 120,
+123, 75, 128, 128, 128, 128, 63, 60, 139, 0, 136, 112, 59, 75, 60, 59, 75, 139, 88, 59, 75, 60, 59, 75, 59, 128, 128, 62, 75, 60, 11, 136,
+128, 96, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 75, 59, 60, 75, 59,
+60, 139, 80, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 139, 80, 59, 60, 128, 60, 75, 12, 8, 88, 59, 75, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+12, 8, 88, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75,
+59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60,
+75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59,
+60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 60, 75, 59, 12
+};